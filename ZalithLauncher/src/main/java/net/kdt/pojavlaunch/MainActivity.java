@@ -185,6 +185,7 @@ public class MainActivity extends BaseActivity implements ControlButtonMenuListe
             Logger.begin(latestLogFile.getAbsolutePath());
             // FIXME: is it safe for multi thread?
             GLOBAL_CLIPBOARD = (ClipboardManager) getSystemService(CLIPBOARD_SERVICE);
+            CallbackBridge.syncClipboard(GLOBAL_CLIPBOARD);
             binding.mainTouchCharInput.setCharacterSender(new LwjglCharSender());
 
             Logging.i("RdrDebug","__P_renderer=" + minecraftVersion.getRenderer());
@@ -288,6 +289,12 @@ public class MainActivity extends BaseActivity implements ControlButtonMenuListe
         CallbackBridge.nativeSetWindowAttrib(LwjglGlfwKeycode.GLFW_HOVERED, 1);
     }
 
+    @Override
+    public void onWindowFocusChanged(boolean hasFocus) {
+        super.onWindowFocusChanged(hasFocus);
+        if (hasFocus && GLOBAL_CLIPBOARD != null) CallbackBridge.syncClipboard(GLOBAL_CLIPBOARD);
+    }
+
     @Override
     protected void onPause() {
         mGyroControl.disable();
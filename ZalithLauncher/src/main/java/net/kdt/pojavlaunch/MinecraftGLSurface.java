@@ -209,7 +209,13 @@ public class MinecraftGLSurface extends View implements GrabListener {
             return true; //mouse event handled successfully
         }
         if (mIngameProcessor == null || mInGUIProcessor == null) return true;
-        return mCurrentTouchProcessor.processTouchEvent(e);
+        // Multi-finger gestures can produce a lot of events, send them to the game in one go
+        CallbackBridge.beginEventBatch();
+        try {
+            return mCurrentTouchProcessor.processTouchEvent(e);
+        } finally {
+            CallbackBridge.endEventBatch();
+        }
     }
 
     private void createGamepad(View contextView, InputDevice inputDevice) {
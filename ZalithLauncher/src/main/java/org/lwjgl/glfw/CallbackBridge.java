@@ -2,6 +2,7 @@ package org.lwjgl.glfw;
 
 import android.content.ClipData;
 import android.content.ClipDescription;
+import android.content.ClipboardManager;
 import android.view.Choreographer;
 
 import androidx.annotation.Keep;
@@ -11,6 +12,8 @@ import net.kdt.pojavlaunch.GrabListener;
 import net.kdt.pojavlaunch.LwjglGlfwKeycode;
 import net.kdt.pojavlaunch.MainActivity;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.ArrayList;
 
 import dalvik.annotation.optimization.CriticalNative;
@@ -24,6 +27,22 @@ public class CallbackBridge {
     public static final int CLIPBOARD_PASTE = 2001;
     public static final int CLIPBOARD_OPEN = 2002;
     
+    // Event types understood by nativeSendEventBatch(), see input_bridge_v3.c
+    private static final int EVENT_TYPE_CHAR = 1000;
+    private static final int EVENT_TYPE_CHAR_MODS = 1001;
+    private static final int EVENT_TYPE_CURSOR_POS = 1003;
+    private static final int EVENT_TYPE_KEY = 1005;
+    private static final int EVENT_TYPE_MOUSE_BUTTON = 1006;
+    private static final int EVENT_TYPE_SCROLL = 1007;
+
+    // One batched event is a GLFWInputEvent: type, i1, i2, i3, i4 as native ints
+    private static final int BATCH_EVENT_SIZE = 5 * 4;
+    private static final int BATCH_MAX_EVENTS = 256;
+    // Only accessed from the UI thread
+    private static final ByteBuffer sEventBatch = ByteBuffer.allocateDirect(BATCH_EVENT_SIZE * BATCH_MAX_EVENTS).order(ByteOrder.nativeOrder());
+    private static int sBatchedEvents = 0;
+    private static boolean sBatching = false;
+
     public static volatile int windowWidth, windowHeight;
     public static volatile int physicalWidth, physicalHeight;
     public static float mouseX, mouseY;
@@ -41,22 +60,60 @@ public class CallbackBridge {
     }
 
 
+    /**
+     * Start collecting input events instead of sending them one by one.
+     * Everything sent until {@link #endEventBatch()} crosses the JNI in a single call.
+     * Must be called from the UI thread.
+     */
+    public static void beginEventBatch() {
+        sBatching = true;
+    }
+
+    /** Send the collected input events and go back to sending them one by one. */
+    public static void endEventBatch() {
+        flushEventBatch();
+        sBatching = false;
+    }
+
+    private static void flushEventBatch() {
+        if (sBatchedEvents == 0) return;
+        nativeSendEventBatch(sEventBatch, sBatchedEvents);
+        sBatchedEvents = 0;
+        sEventBatch.clear();
+    }
+
+    private static void putBatchedEvent(int type, int i1, int i2, int i3, int i4) {
+        if (sBatchedEvents == BATCH_MAX_EVENTS) flushEventBatch();
+        sEventBatch.putInt(type).putInt(i1).putInt(i2).putInt(i3).putInt(i4);
+        sBatchedEvents++;
+    }
+
     public static void sendCursorPos(float x, float y) {
         mouseX = x;
         mouseY = y;
-        nativeSendCursorPos(mouseX, mouseY);
+        if (sBatching) putBatchedEvent(EVENT_TYPE_CURSOR_POS, Float.floatToRawIntBits(x), Float.floatToRawIntBits(y), 0, 0);
+        else nativeSendCursorPos(mouseX, mouseY);
     }
 
     public static void sendKeycode(int keycode, char keychar, int scancode, int modifiers, boolean isDown) {
         // TODO CHECK: This may cause input issue, not receive input!
-        if(keycode != 0)  nativeSendKey(keycode,scancode,isDown ? 1 : 0, modifiers);
+        if(keycode != 0) sendKey(keycode, scancode, isDown ? 1 : 0, modifiers);
         if(isDown && keychar != '\u0000') {
-            nativeSendCharMods(keychar,modifiers);
-            nativeSendChar(keychar);
+            sendChar(keychar, modifiers);
         }
     }
 
+    private static void sendKey(int keycode, int scancode, int action, int modifiers) {
+        if (sBatching) putBatchedEvent(EVENT_TYPE_KEY, keycode, scancode, action, modifiers);
+        else nativeSendKey(keycode, scancode, action, modifiers);
+    }
+
     public static void sendChar(char keychar, int modifiers){
+        if (sBatching) {
+            putBatchedEvent(EVENT_TYPE_CHAR_MODS, keychar, modifiers, 0, 0);
+            putBatchedEvent(EVENT_TYPE_CHAR, keychar, 0, 0, 0);
+            return;
+        }
         nativeSendCharMods(keychar,modifiers);
         nativeSendChar(keychar);
     }
@@ -84,7 +141,8 @@ public class CallbackBridge {
 
     public static void sendMouseKeycode(int button, int modifiers, boolean isDown) {
         // if (isGrabbing()) DEBUG_STRING.append("MouseGrabStrace: " + android.util.Log.getStackTraceString(new Throwable()) + "\n");
-        nativeSendMouseButton(button, isDown ? 1 : 0, modifiers);
+        if (sBatching) putBatchedEvent(EVENT_TYPE_MOUSE_BUTTON, button, isDown ? 1 : 0, modifiers, 0);
+        else nativeSendMouseButton(button, isDown ? 1 : 0, modifiers);
     }
 
     public static void sendMouseKeycode(int keycode) {
@@ -93,7 +151,8 @@ public class CallbackBridge {
     }
     
     public static void sendScroll(double xoffset, double yoffset) {
-        nativeSendScroll(xoffset, yoffset);
+        if (sBatching) putBatchedEvent(EVENT_TYPE_SCROLL, (int) xoffset, (int) yoffset, 0, 0);
+        else nativeSendScroll(xoffset, yoffset);
     }
 
     public static void sendUpdateWindowSize(int w, int h) {
@@ -105,6 +164,29 @@ public class CallbackBridge {
         return isGrabbing;
     }
 
+    private static ClipboardManager sSyncedClipboard;
+
+    /**
+     * Keep the native clipboard cache up to date, so that the game can read the clipboard
+     * without waiting on Android. Call again when the window gets focus back: Android only lets
+     * focused apps read the clipboard, so changes made meanwhile were not seen.
+     */
+    public static void syncClipboard(ClipboardManager clipboard) {
+        if (sSyncedClipboard != clipboard) {
+            sSyncedClipboard = clipboard;
+            clipboard.addPrimaryClipChangedListener(() -> pushClipboard(clipboard));
+        }
+        pushClipboard(clipboard);
+    }
+
+    private static void pushClipboard(ClipboardManager clipboard) {
+        ClipData clip = clipboard.getPrimaryClip();
+        // Null when the clipboard can't be read right now, keep what the cache has
+        if (clip == null || clip.getItemCount() == 0) return;
+        CharSequence text = clip.getItemAt(0).getText();
+        nativeClipboardChanged(text != null ? text.toString() : "");
+    }
+
     // Called from JRE side
     @SuppressWarnings("unused")
     public static @Nullable String accessAndroidClipboard(int type, String copy) {
@@ -206,8 +288,52 @@ public class CallbackBridge {
     @Keep @CriticalNative private static native void nativeSendMouseButton(int button, int action, int mods);
     @Keep @CriticalNative private static native void nativeSendScroll(double xoffset, double yoffset);
     @Keep @CriticalNative private static native void nativeSendScreenSize(int width, int height);
+    @Keep private static native void nativeSendEventBatch(ByteBuffer events, int count);
     @Keep public static native void nativeSetWindowAttrib(int attrib, int value);
+    /** Frames swapped during the last second, by any renderer */
     @Keep public static native int getCurrentFps();
+    /**
+     * Frame time statistics over the last 1024 frames.
+     * @param stats receives the frames swapped so far, how many of them are in the history, and the average, p50, p95,
+     *              p99 and max frame time, then the average time of the slowest 1% and 0.1% frames (microseconds,
+     *              1000000 / value for the "1% low" FPS)
+     */
+    @Keep public static native void nativeGetFrameStats(long[] stats);
+    /**
+     * Copies the newest frame times, oldest first, for an overlay graph.
+     * @param frameTimes a direct buffer in native order, receives one int per frame, in microseconds
+     * @return how many frame times were copied, at most 1024
+     */
+    @Keep public static native int nativeCopyFrameTimes(ByteBuffer frameTimes);
+    /**
+     * Frame pacing, enabled with POJAV_FRAME_CAP and/or POJAV_FRAME_POWER_SAVE.
+     * @param stats receives the current target FPS, the paced frames, the frames that came after their deadline,
+     *              the average and max time the pacer released a frame past its deadline, and the margin it
+     *              spins for before a deadline (microseconds)
+     * @return false if pacing is disabled
+     */
+    @Keep public static native boolean nativeGetFramePacerStats(long[] stats);
+    /**
+     * Input queueing latency, only collected when POJAV_INPUT_LATENCY is set.
+     * @param stats receives count, p50, p95, p99 and max (microseconds) for each event type, 9 * 5 values
+     * @return false if latency tracking is disabled
+     */
+    @Keep public static native boolean nativeGetInputLatency(long[] stats);
+    @Keep public static native void nativeDumpInputLatency(boolean reset);
+    /**
+     * Input queue overflow handling, the policy is picked by POJAV_INPUT_OVERFLOW.
+     * @param stats receives the policy (0 coalesce, 1 grow, 2 drop_oldest), the queue capacity, its high-water mark,
+     *              the dropped events and the events folded while the queue was full
+     */
+    @Keep public static native void nativeGetInputQueueStats(long[] stats);
+    /**
+     * Late latching statistics, only collected when POJAV_LATE_LATCH is set.
+     * @param stats receives the buffer swaps, the swaps where a newer cursor sample than the polled one was
+     *              available, and the average and max age gap in microseconds
+     * @return false if late latching is disabled
+     */
+    @Keep public static native boolean nativeGetLateLatchStats(long[] stats);
+    @Keep private static native void nativeClipboardChanged(String text);
 
     static {
         System.loadLibrary("pojavexec");
@@ -21,13 +21,26 @@ LOCAL_SRC_FILES := \
     bigcoreaffinity.c \
     egl_bridge.c \
     ctxbridges/br_loader.c \
+    ctxbridges/frame_pacer.c \
     ctxbridges/gl_bridge.c \
+    ctxbridges/gl_present.c \
+    ctxbridges/gl_proc_cache.c \
+    ctxbridges/gl_proc_table.c \
+    ctxbridges/gl_program_cache.c \
+    ctxbridges/gl_profile.c \
+    ctxbridges/gl_state_filter.c \
+    ctxbridges/gl_thread.c \
+    ctxbridges/gl_upload.c \
     ctxbridges/osm_bridge.c \
+    ctxbridges/egl_config.c \
     ctxbridges/egl_loader.c \
     ctxbridges/osmesa_loader.c \
     ctxbridges/swap_interval_no_egl.c \
     ctxbridges/virgl_bridge.c \
     environ/environ.c \
+    environ/frame_time.c \
+    environ/input_latency.c \
+    environ/input_trace.c \
     input_bridge_v3.c \
     jre_launcher.c \
     utils.c \
@@ -0,0 +1,171 @@
+//
+// EGL config selection, see egl_config.h
+//
+
+#include <android/log.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "egl_config.h"
+#include "egl_loader.h"
+
+// A missing bit of depth/stencil/sample costs this much more than an extra one
+#define SHORTFALL_WEIGHT 1000
+// And a slow config this much more than any size mismatch
+#define SLOW_WEIGHT 1000000
+
+static const char* g_LogTag = "EGLConfig";
+
+typedef struct {
+    EGLConfig config;
+    EGLint redSize, greenSize, blueSize, alphaSize;
+    EGLint depthSize, stencilSize, samples;
+    EGLint surfaceType, renderableType;
+    EGLint nativeVisualId, caveat, colorBufferType;
+} egl_config_info_t;
+
+typedef struct egl_config_choice_s {
+    struct egl_config_choice_s* next;
+    egl_config_request_t request;
+    EGLConfig config;
+    EGLint format;
+} egl_config_choice_t;
+
+typedef struct egl_config_display_s {
+    struct egl_config_display_s* next;
+    EGLDisplay display;
+    egl_config_info_t* configs;
+    EGLint count;
+    egl_config_choice_t* choices;
+} egl_config_display_t;
+
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static egl_config_display_t* g_Displays;
+
+static bool egl_config_same_request(const egl_config_request_t* a, const egl_config_request_t* b) {
+    return a->redSize == b->redSize && a->greenSize == b->greenSize && a->blueSize == b->blueSize &&
+           a->alphaSize == b->alphaSize && a->depthSize == b->depthSize && a->stencilSize == b->stencilSize &&
+           a->samples == b->samples && a->surfaceType == b->surfaceType &&
+           a->renderableType == b->renderableType && a->nativeVisual == b->nativeVisual;
+}
+
+static EGLint egl_config_attrib(EGLDisplay display, EGLConfig config, EGLint attribute) {
+    EGLint value = 0;
+    if (!eglGetConfigAttrib_p(display, config, attribute, &value)) return 0;
+    return value;
+}
+
+static egl_config_display_t* egl_config_enumerate(EGLDisplay display) {
+    EGLint count = 0;
+    if (!eglGetConfigs_p(display, NULL, 0, &count) || count <= 0) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "eglGetConfigs() failed: %04x", eglGetError_p());
+        return NULL;
+    }
+    EGLConfig* configs = calloc(count, sizeof(EGLConfig));
+    egl_config_display_t* entry = calloc(1, sizeof(egl_config_display_t));
+    if (entry != NULL) entry->configs = calloc(count, sizeof(egl_config_info_t));
+    if (configs == NULL || entry == NULL || entry->configs == NULL ||
+        !eglGetConfigs_p(display, configs, count, &count)) {
+        free(configs);
+        if (entry != NULL) free(entry->configs);
+        free(entry);
+        return NULL;
+    }
+    for (EGLint i = 0; i < count; i++) {
+        egl_config_info_t* info = &entry->configs[i];
+        info->config = configs[i];
+        info->redSize = egl_config_attrib(display, configs[i], EGL_RED_SIZE);
+        info->greenSize = egl_config_attrib(display, configs[i], EGL_GREEN_SIZE);
+        info->blueSize = egl_config_attrib(display, configs[i], EGL_BLUE_SIZE);
+        info->alphaSize = egl_config_attrib(display, configs[i], EGL_ALPHA_SIZE);
+        info->depthSize = egl_config_attrib(display, configs[i], EGL_DEPTH_SIZE);
+        info->stencilSize = egl_config_attrib(display, configs[i], EGL_STENCIL_SIZE);
+        info->samples = egl_config_attrib(display, configs[i], EGL_SAMPLES);
+        info->surfaceType = egl_config_attrib(display, configs[i], EGL_SURFACE_TYPE);
+        info->renderableType = egl_config_attrib(display, configs[i], EGL_RENDERABLE_TYPE);
+        info->nativeVisualId = egl_config_attrib(display, configs[i], EGL_NATIVE_VISUAL_ID);
+        info->caveat = egl_config_attrib(display, configs[i], EGL_CONFIG_CAVEAT);
+        info->colorBufferType = egl_config_attrib(display, configs[i], EGL_COLOR_BUFFER_TYPE);
+    }
+    free(configs);
+    entry->display = display;
+    entry->count = count;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Display %p has %d configs", display, count);
+    return entry;
+}
+
+static EGLint egl_config_size_cost(EGLint requested, EGLint actual) {
+    if (actual < requested) return (requested - actual) * SHORTFALL_WEIGHT;
+    return actual - requested;
+}
+
+/** @return the cost of `info` for `request`, lower is better, -1 if it can't be used at all */
+static long egl_config_score(const egl_config_info_t* info, const egl_config_request_t* request) {
+    if (info->colorBufferType != EGL_RGB_BUFFER) return -1;
+    if ((info->surfaceType & request->surfaceType) != request->surfaceType) return -1;
+    if ((info->renderableType & request->renderableType) != request->renderableType) return -1;
+    if (request->nativeVisual && info->nativeVisualId == 0) return -1;
+    if (info->redSize < request->redSize || info->greenSize < request->greenSize ||
+        info->blueSize < request->blueSize || info->alphaSize < request->alphaSize) return -1;
+
+    long cost = (info->redSize - request->redSize) + (info->greenSize - request->greenSize) +
+                (info->blueSize - request->blueSize) + (info->alphaSize - request->alphaSize);
+    cost += egl_config_size_cost(request->depthSize, info->depthSize);
+    cost += egl_config_size_cost(request->stencilSize, info->stencilSize);
+    cost += egl_config_size_cost(request->samples, info->samples);
+    if (info->caveat == EGL_SLOW_CONFIG) cost += SLOW_WEIGHT;
+    return cost;
+}
+
+bool egl_config_choose(EGLDisplay display, const egl_config_request_t* request, EGLConfig* config, EGLint* format) {
+    pthread_mutex_lock(&g_Lock);
+    egl_config_display_t* entry = g_Displays;
+    while (entry != NULL && entry->display != display) entry = entry->next;
+    if (entry == NULL) {
+        entry = egl_config_enumerate(display);
+        if (entry == NULL) {
+            pthread_mutex_unlock(&g_Lock);
+            return false;
+        }
+        entry->next = g_Displays;
+        g_Displays = entry;
+    }
+
+    egl_config_choice_t* choice = entry->choices;
+    while (choice != NULL && !egl_config_same_request(&choice->request, request)) choice = choice->next;
+    if (choice == NULL) {
+        const egl_config_info_t* best = NULL;
+        long bestCost = -1;
+        for (EGLint i = 0; i < entry->count; i++) {
+            long cost = egl_config_score(&entry->configs[i], request);
+            if (cost < 0 || (best != NULL && cost >= bestCost)) continue;
+            best = &entry->configs[i];
+            bestCost = cost;
+        }
+        if (best == NULL) {
+            pthread_mutex_unlock(&g_Lock);
+            __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "No config of %d matches", entry->count);
+            return false;
+        }
+        choice = malloc(sizeof(egl_config_choice_t));
+        if (choice == NULL) {
+            pthread_mutex_unlock(&g_Lock);
+            return false;
+        }
+        choice->request = *request;
+        choice->config = best->config;
+        choice->format = best->nativeVisualId;
+        choice->next = entry->choices;
+        entry->choices = choice;
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag,
+                            "Chose config %p: RGBA %d%d%d%d, depth %d, stencil %d, samples %d, visual %d",
+                            best->config, best->redSize, best->greenSize, best->blueSize, best->alphaSize,
+                            best->depthSize, best->stencilSize, best->samples, best->nativeVisualId);
+    }
+
+    *config = choice->config;
+    if (format != NULL) *format = choice->format;
+    pthread_mutex_unlock(&g_Lock);
+    return true;
+}
@@ -0,0 +1,34 @@
+//
+// EGL config selection shared by the bridges.
+//
+// The configs of a display are enumerated once, with the attributes that matter here. A request is
+// then scored against all of them, and the winner is cached per display and request, so contexts
+// created later (shared ones for worker threads in particular) don't go through eglChooseConfig().
+//
+// Colour sizes, the surface type and the renderable type are hard requirements. Depth, stencil and
+// samples are not: a config that falls short is still taken when nothing better exists, since some
+// drivers only expose 16 bit depth. Beyond the request, fewer extra bits win, like eglChooseConfig().
+//
+
+#ifndef POJAVLAUNCHER_EGL_CONFIG_H
+#define POJAVLAUNCHER_EGL_CONFIG_H
+
+#include <EGL/egl.h>
+#include <stdbool.h>
+
+typedef struct {
+    EGLint redSize, greenSize, blueSize, alphaSize;
+    EGLint depthSize, stencilSize, samples;
+    EGLint surfaceType;    // EGL_*_BIT that have to be set
+    EGLint renderableType; // EGL_OPENGL_*_BIT that have to be set
+    bool nativeVisual;     // whether the config needs a native visual, for window surfaces
+} egl_config_request_t;
+
+/**
+ * @param config the best config of `display` for `request`
+ * @param format its EGL_NATIVE_VISUAL_ID, may be NULL
+ * @return false if no config meets the hard requirements
+ */
+bool egl_config_choose(EGLDisplay display, const egl_config_request_t* request, EGLConfig* config, EGLint* format);
+
+#endif //POJAVLAUNCHER_EGL_CONFIG_H
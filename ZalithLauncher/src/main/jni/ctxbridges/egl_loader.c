@@ -17,6 +17,7 @@ EGLContext (*eglGetCurrentContext_p) (void);
 EGLDisplay (*eglGetDisplay_p) (NativeDisplayType display);
 EGLBoolean (*eglInitialize_p) (EGLDisplay dpy, EGLint *major, EGLint *minor);
 EGLBoolean (*eglChooseConfig_p) (EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config);
+EGLBoolean (*eglGetConfigs_p) (EGLDisplay dpy, EGLConfig *configs, EGLint config_size, EGLint *num_config);
 EGLBoolean (*eglGetConfigAttrib_p) (EGLDisplay dpy, EGLConfig config, EGLint attribute, EGLint *value);
 EGLBoolean (*eglBindAPI_p) (EGLenum api);
 EGLSurface (*eglCreatePbufferSurface_p) (EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list);
@@ -32,29 +33,9 @@ extern __eglMustCastToProperFunctionPointerType (*eglGetProcAddress_p) (const ch
 // ============================================================================
 // HOOKS
 // ============================================================================
-static EGLBoolean (*real_eglChooseConfig)(EGLDisplay, const EGLint*, EGLConfig*, EGLint, EGLint*) = NULL;
 static EGLContext (*real_eglCreateContext)(EGLDisplay, EGLConfig, EGLContext, const EGLint*) = NULL;
 static EGLBoolean (*real_eglBindAPI)(EGLenum) = NULL;
 
-static EGLBoolean hook_eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config) {
-    EGLint new_attribs[64];
-    int i = 0, j = 0;
-    if (attrib_list) {
-        while (attrib_list[i] != EGL_NONE && j < 60) {
-            EGLint attr = attrib_list[i];
-            EGLint val = attrib_list[i+1];
-            if (attr == EGL_RENDERABLE_TYPE) val = 0x0004; // ES2
-            // 保持深度为 16 以获得最大兼容性
-            if (attr == EGL_DEPTH_SIZE) if (val > 16) val = 16;
-            new_attribs[j++] = attr;
-            new_attribs[j++] = val;
-            i += 2;
-        }
-    }
-    new_attribs[j] = EGL_NONE;
-    return real_eglChooseConfig(dpy, new_attribs, configs, config_size, num_config);
-}
-
 static EGLContext hook_eglCreateContext(EGLDisplay dpy, EGLConfig config, EGLContext share_list, const EGLint *attrib_list) {
     EGLint new_attribs[64];
     int i = 0, j = 0, has_ver = 0;
@@ -101,7 +82,6 @@ void dlsym_EGL() {
     dlopen("libGLESv2.so", RTLD_GLOBAL | RTLD_LAZY);
 
     // 加载原始指针
-    real_eglChooseConfig = dlsym(dl_handle, "eglChooseConfig");
     real_eglCreateContext = dlsym(dl_handle, "eglCreateContext");
     real_eglBindAPI = dlsym(dl_handle, "eglBindAPI");
 
@@ -109,13 +89,13 @@ void dlsym_EGL() {
     #define LOAD(name) name##_p = dlsym(dl_handle, #name);
     LOAD(eglMakeCurrent); LOAD(eglDestroyContext); LOAD(eglDestroySurface);
     LOAD(eglTerminate); LOAD(eglReleaseThread); LOAD(eglGetCurrentContext);
-    LOAD(eglGetDisplay); LOAD(eglInitialize); LOAD(eglGetConfigAttrib);
+    LOAD(eglGetDisplay); LOAD(eglInitialize); LOAD(eglChooseConfig);
+    LOAD(eglGetConfigs); LOAD(eglGetConfigAttrib);
     LOAD(eglCreatePbufferSurface); LOAD(eglCreateWindowSurface); LOAD(eglSwapBuffers);
     LOAD(eglGetError); LOAD(eglSwapInterval); LOAD(eglGetCurrentSurface);
     LOAD(eglQuerySurface);
     
     eglGetProcAddress_p = dlsym(dl_handle, "eglGetProcAddress");
-    eglChooseConfig_p = hook_eglChooseConfig;
     eglCreateContext_p = hook_eglCreateContext;
     eglBindAPI_p = hook_eglBindAPI;
 
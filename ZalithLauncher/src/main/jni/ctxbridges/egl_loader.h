@@ -14,6 +14,7 @@ extern EGLContext (*eglGetCurrentContext_p) (void);
 extern EGLDisplay (*eglGetDisplay_p) (NativeDisplayType display);
 extern EGLBoolean (*eglInitialize_p) (EGLDisplay dpy, EGLint *major, EGLint *minor);
 extern EGLBoolean (*eglChooseConfig_p) (EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *configs, EGLint config_size, EGLint *num_config);
+extern EGLBoolean (*eglGetConfigs_p) (EGLDisplay dpy, EGLConfig *configs, EGLint config_size, EGLint *num_config);
 extern EGLBoolean (*eglGetConfigAttrib_p) (EGLDisplay dpy, EGLConfig config, EGLint attribute, EGLint *value);
 extern EGLBoolean (*eglBindAPI_p) (EGLenum api);
 extern EGLSurface (*eglCreatePbufferSurface_p) (EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list);
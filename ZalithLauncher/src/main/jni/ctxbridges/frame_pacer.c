@@ -0,0 +1,129 @@
+//
+// Deadline-based frame pacing with hybrid sleep and spin waits.
+//
+
+#include <android/log.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "frame_pacer.h"
+
+#define NS_PER_SECOND 1000000000ULL
+#define POWER_SAVE_FPS 30
+#define MAX_FPS 1000
+/* Bounds of the spin margin, it starts in between */
+#define MIN_SPIN_MARGIN 100000ULL
+#define START_SPIN_MARGIN 1000000ULL
+#define MAX_SPIN_MARGIN 2000000ULL
+/* Added to the oversleep the margin follows */
+#define SPIN_MARGIN_SLACK 50000ULL
+/* The margin shrinks by 1/SPIN_MARGIN_DECAY per sleep, a few seconds to forget a bad oversleep */
+#define SPIN_MARGIN_DECAY 256
+
+static const char* g_LogTag = "FramePacer";
+
+static uint64_t frame_pacer_monotonic_now(__attribute__((unused)) void* context) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * NS_PER_SECOND + (uint64_t) now.tv_nsec;
+}
+
+static void frame_pacer_nanosleep(__attribute__((unused)) void* context, uint64_t ns) {
+    struct timespec duration = { (time_t) (ns / NS_PER_SECOND), (long) (ns % NS_PER_SECOND) };
+    nanosleep(&duration, NULL);
+}
+
+void frame_pacer_init(frame_pacer_t* pacer, const char* cap, bool powerSave, const frame_pacer_clock_t* clock) {
+    *pacer = (frame_pacer_t) {0};
+    if (clock != NULL) {
+        pacer->clock = *clock;
+    } else {
+        pacer->clock.now = frame_pacer_monotonic_now;
+        pacer->clock.sleep = frame_pacer_nanosleep;
+    }
+    int fps = cap != NULL ? atoi(cap) : 0;
+    if (fps > MAX_FPS) fps = MAX_FPS;
+    if (fps > 0) pacer->period = NS_PER_SECOND / fps;
+    if (powerSave) pacer->menuPeriod = pacer->period ? pacer->period * 2 : NS_PER_SECOND / POWER_SAVE_FPS;
+    pacer->spinMargin = START_SPIN_MARGIN;
+    atomic_store_explicit(&pacer->spinMargin_us, START_SPIN_MARGIN / 1000, memory_order_relaxed);
+    int menuFps = pacer->menuPeriod ? (int) (NS_PER_SECOND / pacer->menuPeriod) : 0;
+    if (fps > 0 && menuFps > 0)
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Frames are capped at %d FPS, %d FPS in menus", fps, menuFps);
+    else if (fps > 0)
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Frames are capped at %d FPS", fps);
+    else if (menuFps > 0)
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Frames are capped at %d FPS in menus", menuFps);
+}
+
+bool frame_pacer_enabled(const frame_pacer_t* pacer) {
+    return pacer->period != 0 || pacer->menuPeriod != 0;
+}
+
+// Single writer: plain load + store is enough for the readers
+static void frame_pacer_add(atomic_uint_fast64_t* counter, uint64_t value) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+// Follows the worst oversleep right away, and forgets it slowly
+static void frame_pacer_adapt(frame_pacer_t* pacer, uint64_t oversleep) {
+    uint64_t margin = pacer->spinMargin - pacer->spinMargin / SPIN_MARGIN_DECAY;
+    if (oversleep + SPIN_MARGIN_SLACK > margin) margin = oversleep + SPIN_MARGIN_SLACK;
+    if (margin < MIN_SPIN_MARGIN) margin = MIN_SPIN_MARGIN;
+    if (margin > MAX_SPIN_MARGIN) margin = MAX_SPIN_MARGIN;
+    pacer->spinMargin = margin;
+    atomic_store_explicit(&pacer->spinMargin_us, margin / 1000, memory_order_relaxed);
+}
+
+void frame_pacer_wait(frame_pacer_t* pacer, bool inMenu) {
+    uint64_t period = inMenu && pacer->menuPeriod ? pacer->menuPeriod : pacer->period;
+    if (period == 0) {
+        pacer->currentPeriod = 0;
+        return;
+    }
+    uint64_t now = pacer->clock.now(pacer->clock.context);
+    if (period != pacer->currentPeriod) {
+        // New rate: this frame goes right away and starts the schedule
+        pacer->currentPeriod = period;
+        pacer->deadline = now;
+        atomic_store_explicit(&pacer->targetFps, NS_PER_SECOND / period, memory_order_relaxed);
+    }
+    frame_pacer_add(&pacer->paced, 1);
+
+    if (now >= pacer->deadline) {
+        if (now > pacer->deadline) frame_pacer_add(&pacer->late, 1);
+        // Too late to catch up without a burst of frames
+        uint64_t behind = now - pacer->deadline;
+        pacer->deadline = behind > period ? now + period : pacer->deadline + period;
+        return;
+    }
+
+    uint64_t remaining = pacer->deadline - now;
+    if (remaining > pacer->spinMargin) {
+        uint64_t request = remaining - pacer->spinMargin;
+        pacer->clock.sleep(pacer->clock.context, request);
+        uint64_t woke = pacer->clock.now(pacer->clock.context);
+        frame_pacer_adapt(pacer, woke > now + request ? woke - (now + request) : 0);
+        now = woke;
+    }
+    while (now < pacer->deadline) now = pacer->clock.now(pacer->clock.context);
+
+    uint64_t overshoot_us = (now - pacer->deadline) / 1000;
+    frame_pacer_add(&pacer->overshootSum_us, overshoot_us);
+    if (overshoot_us > atomic_load_explicit(&pacer->overshootMax_us, memory_order_relaxed))
+        atomic_store_explicit(&pacer->overshootMax_us, overshoot_us, memory_order_relaxed);
+    pacer->deadline += period;
+}
+
+void frame_pacer_snapshot(frame_pacer_t* pacer, int64_t* out) {
+    uint64_t paced = atomic_load_explicit(&pacer->paced, memory_order_relaxed);
+    uint64_t late = atomic_load_explicit(&pacer->late, memory_order_relaxed);
+    // Only the frames that waited for their deadline can overshoot it
+    uint64_t waited = paced > late ? paced - late : 0;
+    out[0] = (int64_t) atomic_load_explicit(&pacer->targetFps, memory_order_relaxed);
+    out[1] = (int64_t) paced;
+    out[2] = (int64_t) late;
+    out[3] = waited ? (int64_t) (atomic_load_explicit(&pacer->overshootSum_us, memory_order_relaxed) / waited) : 0;
+    out[4] = (int64_t) atomic_load_explicit(&pacer->overshootMax_us, memory_order_relaxed);
+    out[5] = (int64_t) atomic_load_explicit(&pacer->spinMargin_us, memory_order_relaxed);
+}
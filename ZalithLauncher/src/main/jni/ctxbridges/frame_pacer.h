@@ -0,0 +1,57 @@
+//
+// Frame pacing in front of br_swap_buffers(), whatever the bridge. Enabled with POJAV_FRAME_CAP (the
+// target FPS) and/or POJAV_FRAME_POWER_SAVE (while the cursor isn't grabbed, in menus, the rate is
+// halved, to 30 FPS without a cap).
+//
+// Each swap waits for a deadline one frame period after the previous one, so frames stay evenly
+// spaced as long as the game keeps up. Most of the wait is slept, the last stretch is spun, as the
+// scheduler may wake the thread late: the spin margin follows the worst recent oversleep. A frame
+// that comes more than a period late starts a new schedule instead of rushing the next ones.
+//
+// The clock is a parameter, so that the pacer can be driven by a mock clock on a host (see
+// hostbench/frame_pacer_bench.c).
+//
+
+#ifndef POJAVLAUNCHER_FRAME_PACER_H
+#define POJAVLAUNCHER_FRAME_PACER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Values reported by frame_pacer_snapshot(): target FPS, paced frames, late frames, average and max overshoot, spin margin (us) */
+#define FRAME_PACER_STATS 6
+
+typedef struct {
+    uint64_t (*now)(void* context); // Monotonic nanoseconds
+    void (*sleep)(void* context, uint64_t ns);
+    void* context;
+} frame_pacer_clock_t;
+
+typedef struct {
+    frame_pacer_clock_t clock;
+    uint64_t period; // Nanoseconds, 0 without a cap
+    uint64_t menuPeriod; // Period in menus, 0 without power saving
+    // Only touched by the swapping thread
+    uint64_t currentPeriod; // Period the deadline was computed for, 0 before the first frame
+    uint64_t deadline;
+    uint64_t spinMargin; // Nanoseconds before the deadline where sleeping stops
+    // Single writer, any thread may read them
+    atomic_uint_fast64_t targetFps, paced, late, overshootSum_us, overshootMax_us, spinMargin_us;
+} frame_pacer_t;
+
+/**
+ * @param cap value of POJAV_FRAME_CAP, NULL or not a positive number for no cap
+ * @param clock NULL for CLOCK_MONOTONIC and nanosleep()
+ */
+void frame_pacer_init(frame_pacer_t* pacer, const char* cap, bool powerSave, const frame_pacer_clock_t* clock);
+
+bool frame_pacer_enabled(const frame_pacer_t* pacer);
+
+/** Swapping thread, right before the swap. `inMenu` picks the power saving rate. */
+void frame_pacer_wait(frame_pacer_t* pacer, bool inMenu);
+
+/** @param out FRAME_PACER_STATS values */
+void frame_pacer_snapshot(frame_pacer_t* pacer, int64_t* out);
+
+#endif //POJAVLAUNCHER_FRAME_PACER_H
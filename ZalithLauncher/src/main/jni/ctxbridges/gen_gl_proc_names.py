@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Generates gl_proc_names.h: every entry point declared in GL/gl.h and GL/glext.h, and a
+# perfect hash over their names for gl_proc_table.c. Also generates gl_proc_prototypes.h, the
+# same entry points as an X-macro list for code that wraps them, and gl_proc_marshal.h, the list
+# gl_thread.c needs to move calls to another thread. Run it again whenever those headers change:
+#   python3 ctxbridges/gen_gl_proc_names.py
+#
+# The hash is "hash, displace and compress": names are split into buckets by their plain hash,
+# and each bucket gets the first seed that moves all its names to free slots. Buckets with a
+# single name go straight to a free slot, stored as -(slot + 1).
+#
+
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+HEADERS = ["GL/gl.h", "GL/glext.h"]
+OUTPUT = os.path.join(HERE, "gl_proc_names.h")
+PROTOTYPES_OUTPUT = os.path.join(HERE, "gl_proc_prototypes.h")
+ENTRY_POINT = re.compile(r"\bG?L?APIENTRY\s+(gl\w+)\s*\(")
+PROTOTYPE = re.compile(r"GLAPI\s+([^;]*?)\s*\bG?L?APIENTRY\s+(gl\w+)\s*\(([^;]*?)\)\s*;", re.S)
+MARSHAL_OUTPUT = os.path.join(HERE, "gl_proc_marshal.h")
+PARAMETER_NAME = re.compile(r"(\w+)\s*(\[\w*\])?\s*$")
+# Entry points without pointers that still have to wait for the driver
+SYNCHRONOUS = {"glFinish"}
+# Entry points that point the GL at client memory it reads later, during draws
+CLIENT_ARRAY = re.compile(r"^(?!glGet).*Pointer|^glInterleavedArrays")
+
+
+def hash_name(name, seed):
+    # FNV-1a, must match gl_proc_hash() in gl_proc_table.c
+    value = (0x811c9dc5 ^ seed) & 0xffffffff
+    for byte in name.encode():
+        value = ((value ^ byte) * 0x01000193) & 0xffffffff
+    return value
+
+
+def entry_points():
+    names = set()
+    for header in HEADERS:
+        with open(os.path.join(HERE, "..", header)) as source:
+            names.update(ENTRY_POINT.findall(source.read()))
+    return sorted(names)
+
+
+def prototypes():
+    found = {}
+    for header in HEADERS:
+        with open(os.path.join(HERE, "..", header)) as source:
+            for result, name, parameters in PROTOTYPE.findall(source.read()):
+                found.setdefault(name, (" ".join(result.split()), " ".join(parameters.split())))
+    return found
+
+
+def x_macro(slot, name, prototype):
+    result, parameters = prototype
+    if parameters in ("", "void"):
+        parameters, arguments = "void", ""
+    else:
+        arguments = ", ".join(PARAMETER_NAME.search(parameter).group(1) for parameter in parameters.split(","))
+    if result == "void":
+        return "GL_PROC_VOID(%d, %s, (%s), (%s))" % (slot, name, parameters, arguments)
+    return "GL_PROC(%d, %s, %s, (%s), (%s))" % (slot, result, name, parameters, arguments)
+
+
+def marshal_macro(slot, name, prototype):
+    result, parameters = prototype
+    if parameters in ("", "void"):
+        parameters, arguments, fields, call_arguments = "void", "", "", ""
+    else:
+        names, fields = [], []
+        for parameter in parameters.split(","):
+            match = PARAMETER_NAME.search(parameter)
+            names.append(match.group(1))
+            # Arrays are pointers as parameters, but not as struct fields
+            field = parameter[:match.start()] + ("*" + match.group(1) if match.group(2) else match.group(1))
+            fields.append(" ".join(field.split()) + ";")
+        arguments = ", ".join(names)
+        fields = " ".join(fields)
+        call_arguments = ", ".join("call->" + name for name in names)
+    if result != "void":
+        return "GL_PROC_SYNC(%d, %s, %s, (%s), (%s), %s, (%s))" % (slot, result, name, parameters, arguments, fields, call_arguments)
+    if "*" in parameters or "[" in parameters or name in SYNCHRONOUS:
+        kind = "GL_PROC_SYNC_CLIENT_ARRAY" if CLIENT_ARRAY.search(name) else "GL_PROC_SYNC_VOID"
+        return "%s(%d, %s, (%s), (%s), %s, (%s))" % (kind, slot, name, parameters, arguments, fields, call_arguments)
+    return "GL_PROC_ASYNC(%d, %s, (%s), (%s), %s, (%s))" % (slot, name, parameters, arguments, fields, call_arguments)
+
+
+def build(names):
+    size = len(names)
+    buckets = [[] for _ in range(size)]
+    for name in names:
+        buckets[hash_name(name, 0) % size].append(name)
+    displacements = [0] * size
+    slots = [None] * size
+    order = sorted(range(size), key=lambda bucket: -len(buckets[bucket]))
+    for bucket in order:
+        members = buckets[bucket]
+        if len(members) <= 1:
+            break
+        seed = 1
+        while True:
+            taken = [hash_name(name, seed) % size for name in members]
+            if len(set(taken)) == len(taken) and all(slots[slot] is None for slot in taken):
+                break
+            seed += 1
+        displacements[bucket] = seed
+        for name, slot in zip(members, taken):
+            slots[slot] = name
+    free = [slot for slot in range(size) if slots[slot] is None]
+    for bucket in order:
+        if len(buckets[bucket]) != 1:
+            continue
+        slot = free.pop()
+        displacements[bucket] = -(slot + 1)
+        slots[slot] = buckets[bucket][0]
+    return displacements, slots
+
+
+def main():
+    names = entry_points()
+    displacements, slots = build(names)
+    with open(OUTPUT, "w") as output:
+        output.write("//\n// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.\n//\n\n")
+        output.write("#ifndef POJAVLAUNCHER_GL_PROC_NAMES_H\n#define POJAVLAUNCHER_GL_PROC_NAMES_H\n\n")
+        output.write("#include <stdint.h>\n\n")
+        output.write("#define GL_PROC_COUNT %d\n" % len(slots))
+        # Tells persisted copies of the table (gl_proc_cache.c) apart from the current one
+        output.write("#define GL_PROC_TABLE_HASH 0x%08xu\n\n" % hash_name("\n".join(slots), 0))
+        output.write("static const int32_t gl_proc_displacements[GL_PROC_COUNT] = {\n")
+        for start in range(0, len(displacements), 12):
+            output.write("    " + ", ".join(str(value) for value in displacements[start:start + 12]) + ",\n")
+        output.write("};\n\n")
+        output.write("static const char* const gl_proc_names[GL_PROC_COUNT] = {\n")
+        for name in slots:
+            output.write('    "%s",\n' % name)
+        output.write("};\n\n#endif //POJAVLAUNCHER_GL_PROC_NAMES_H\n")
+
+    found = prototypes()
+    with open(PROTOTYPES_OUTPUT, "w") as output:
+        output.write("//\n// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.\n//\n")
+        output.write("// Every entry point of gl_proc_names.h with its slot, include it after defining\n")
+        output.write("//   GL_PROC_VOID(slot, name, parameters, arguments)\n")
+        output.write("//   GL_PROC(slot, result, name, parameters, arguments)\n//\n\n")
+        for slot, name in enumerate(slots):
+            output.write(x_macro(slot, name, found[name]) + "\n")
+
+    with open(MARSHAL_OUTPUT, "w") as output:
+        output.write("//\n// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.\n//\n")
+        output.write("// Every entry point of gl_proc_names.h with what it takes to call it from another thread:\n")
+        output.write("//   GL_PROC_ASYNC(slot, name, parameters, arguments, fields, call_arguments)\n")
+        output.write("//     returns nothing and takes no pointers, can run later\n")
+        output.write("//   GL_PROC_SYNC_VOID(slot, name, parameters, arguments, fields, call_arguments)\n")
+        output.write("//     returns nothing, but takes pointers (or has to wait anyway)\n")
+        output.write("//   GL_PROC_SYNC_CLIENT_ARRAY(slot, name, parameters, arguments, fields, call_arguments)\n")
+        output.write("//     the same, and may leave a pointer to client memory for later draws\n")
+        output.write("//   GL_PROC_SYNC(slot, result, name, parameters, arguments, fields, call_arguments)\n")
+        output.write("//     returns a value\n")
+        output.write("// `fields` declares the parameters as struct members, `call_arguments` reads them from `call`.\n//\n\n")
+        for slot, name in enumerate(slots):
+            output.write(marshal_macro(slot, name, found[name]) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -10,6 +10,10 @@
 #include <environ/environ.h>
 #include "gl_bridge.h"
 #include "egl_loader.h"
+#include "egl_config.h"
+#include "gl_thread.h"
+#include "gl_present.h"
+#include "gl_program_cache.h"
 
 //
 // Created by maks on 17.09.2022.
@@ -58,38 +62,28 @@ static void gl4esi_get_display_dimensions(int* width, int* height) {
 gl_render_window_t* gl_init_context(gl_render_window_t *share) {
     gl_render_window_t* bundle = malloc(sizeof(gl_render_window_t));
     memset(bundle, 0, sizeof(gl_render_window_t));
-    EGLint egl_attributes[] = { EGL_BLUE_SIZE, 8,
-                    EGL_GREEN_SIZE, 8,
-                    EGL_RED_SIZE, 8,
-                    EGL_ALPHA_SIZE, 8,
-                    EGL_DEPTH_SIZE, 24,
-                    EGL_SURFACE_TYPE,
-                    EGL_WINDOW_BIT|EGL_PBUFFER_BIT,
-                    EGL_RENDERABLE_TYPE,
-                    EGL_OPENGL_ES2_BIT,
-                    EGL_NONE
-                    };
-    EGLint num_configs = 0;
-
-    if (eglChooseConfig_p(g_EglDisplay, egl_attributes, NULL, 0, &num_configs) != EGL_TRUE)
+    if (share != NULL)
     {
-        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "eglChooseConfig_p() failed: %04x",
-                            eglGetError_p());
-        free(bundle);
-        return NULL;
-    }
-
-    if (num_configs == 0)
-    {
-        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "%s",
-                            "eglChooseConfig_p() found no matching config");
-        free(bundle);
-        return NULL;
+        // A shared context takes the config of its group, nothing to choose
+        bundle->config = share->config;
+        bundle->format = share->format;
+    } else {
+        const egl_config_request_t request = {
+                .redSize = 8, .greenSize = 8, .blueSize = 8, .alphaSize = 8,
+                .depthSize = 24,
+                .surfaceType = EGL_WINDOW_BIT|EGL_PBUFFER_BIT,
+                .renderableType = EGL_OPENGL_ES2_BIT,
+                .nativeVisual = true
+        };
+        if (!egl_config_choose(g_EglDisplay, &request, &bundle->config, &bundle->format))
+        {
+            __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "%s",
+                                "egl_config_choose() found no matching config");
+            free(bundle);
+            return NULL;
+        }
     }
 
-    eglChooseConfig_p(g_EglDisplay, egl_attributes, &bundle->config, 1, &num_configs);
-    eglGetConfigAttrib_p(g_EglDisplay, bundle->config, EGL_NATIVE_VISUAL_ID, &bundle->format);
-
     {
         EGLBoolean bindResult;
 
@@ -116,15 +110,19 @@ gl_render_window_t* gl_init_context(gl_render_window_t *share) {
         free(bundle);
         return NULL;
     }
+    gl_state_shadow_init(&bundle->stateShadow, share == NULL ? NULL : &share->stateShadow);
+    gl_upload_shadow_init(&bundle->uploadShadow, bundle, share == NULL ? NULL : &share->uploadShadow);
     return bundle;
 }
 
 void gl_swap_surface(gl_render_window_t* bundle) {
+    bool isMainWindow = (basic_render_window_t*) bundle == pojav_environ->mainWindowBundle;
     if (bundle->nativeSurface != NULL)
         ANativeWindow_release(bundle->nativeSurface);
 
     if (bundle->surface != NULL)
         eglDestroySurface_p(g_EglDisplay, bundle->surface);
+    bundle->presented = false;
 
     if (bundle->newNativeSurface != NULL)
     {
@@ -133,22 +131,35 @@ void gl_swap_surface(gl_render_window_t* bundle) {
         bundle->newNativeSurface = NULL;
         ANativeWindow_acquire(bundle->nativeSurface);
         ANativeWindow_setBuffersGeometry(bundle->nativeSurface, 0, 0, bundle->format);
-        bundle->surface = eglCreateWindowSurface_p(g_EglDisplay, bundle->config, bundle->nativeSurface, NULL);
+        if (isMainWindow && gl_present_enabled() &&
+            gl_present_set_window(g_EglDisplay, bundle->config, bundle->context, bundle->nativeSurface))
+        {
+            // The presenter thread owns the window, frames are rendered into a pbuffer of its size
+            const EGLint pbuffer_attrs[] = {EGL_WIDTH, ANativeWindow_getWidth(bundle->nativeSurface),
+                                            EGL_HEIGHT, ANativeWindow_getHeight(bundle->nativeSurface), EGL_NONE};
+            bundle->surface = eglCreatePbufferSurface_p(g_EglDisplay, bundle->config, pbuffer_attrs);
+            bundle->presented = bundle->surface != EGL_NO_SURFACE;
+        } else {
+            bundle->surface = eglCreateWindowSurface_p(g_EglDisplay, bundle->config, bundle->nativeSurface, NULL);
+        }
     } else {
         __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "No new native surface, switching to 1x1 pbuffer");
         bundle->nativeSurface = NULL;
         const EGLint pbuffer_attrs[] = {EGL_WIDTH, 1 , EGL_HEIGHT, 1, EGL_NONE};
         bundle->surface = eglCreatePbufferSurface_p(g_EglDisplay, bundle->config, pbuffer_attrs);
+        if (isMainWindow && gl_present_enabled())
+            gl_present_set_window(g_EglDisplay, bundle->config, bundle->context, NULL);
     }
 }
 
-void gl_make_current(gl_render_window_t* bundle) {
+static void gl_make_current_here(gl_render_window_t* bundle) {
 
     if (bundle == NULL)
     {
         if (eglMakeCurrent_p(g_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT))
         {
             currentBundle = NULL;
+            gl_upload_make_current(NULL);
         }
         return;
     }
@@ -168,6 +179,7 @@ void gl_make_current(gl_render_window_t* bundle) {
     if (eglMakeCurrent_p(g_EglDisplay, bundle->surface, bundle->surface, bundle->context))
     {
         currentBundle = bundle;
+        gl_upload_make_current(&bundle->uploadShadow);
     } else {
         if (hasSetMainWindow)
         {
@@ -180,7 +192,52 @@ void gl_make_current(gl_render_window_t* bundle) {
 
 }
 
-void gl_swap_buffers() {
+typedef struct {
+    gl_render_window_t* bundle;
+    gl_render_window_t* current;
+} gl_make_current_call_t;
+
+static void gl_make_current_on_gl_thread(void* data) {
+    gl_make_current_call_t* call = data;
+    gl_make_current_here(call->bundle);
+    call->current = currentBundle;
+}
+
+void gl_make_current(gl_render_window_t* bundle) {
+    if (gl_thread_enabled() && gl_thread_claim())
+    {
+        // The context is current on the GL thread, this thread records the calls for it
+        gl_make_current_call_t call = { bundle, NULL };
+        gl_thread_run(gl_make_current_on_gl_thread, &call);
+        currentBundle = call.current;
+        gl_thread_set_recording(currentBundle != NULL);
+    } else {
+        gl_make_current_here(bundle);
+    }
+    gl_state_filter_make_current(currentBundle != NULL ? &currentBundle->stateShadow : NULL);
+    // The shadow state group pointer is shared by exactly the contexts of a share group
+    gl_program_cache_make_current(currentBundle != NULL ? currentBundle->stateShadow.group : NULL);
+}
+
+// The window of a presented bundle can change size without a new surface (refreshSize()), the pbuffer has to follow
+static void gl_resize_pbuffer(gl_render_window_t* bundle, EGLint width, EGLint height) {
+    eglMakeCurrent_p(g_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface_p(g_EglDisplay, bundle->surface);
+    const EGLint pbuffer_attrs[] = {EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE};
+    bundle->surface = eglCreatePbufferSurface_p(g_EglDisplay, bundle->config, pbuffer_attrs);
+    if (bundle->surface == EGL_NO_SURFACE)
+    {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Failed to resize the pbuffer to %dx%d: %04x", width, height,
+                            eglGetError_p());
+        bundle->surface = NULL;
+        bundle->presented = false;
+        eglMakeCurrent_p(g_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, bundle->context);
+        return;
+    }
+    eglMakeCurrent_p(g_EglDisplay, bundle->surface, bundle->surface, bundle->context);
+}
+
+static void gl_swap_buffers_here() {
     if (currentBundle->state == STATE_RENDERER_NEW_WINDOW)
     {
         eglMakeCurrent_p(g_EglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
@@ -189,6 +246,24 @@ void gl_swap_buffers() {
         currentBundle->state = STATE_RENDERER_ALIVE;
     }
 
+    if (gl_present_enabled() && currentBundle->surface != NULL)
+    {
+        EGLint width = 0, height = 0;
+        eglQuerySurface_p(g_EglDisplay, currentBundle->surface, EGL_WIDTH, &width);
+        eglQuerySurface_p(g_EglDisplay, currentBundle->surface, EGL_HEIGHT, &height);
+        EGLint windowWidth = width, windowHeight = height;
+        if (currentBundle->presented && currentBundle->nativeSurface != NULL)
+        {
+            windowWidth = ANativeWindow_getWidth(currentBundle->nativeSurface);
+            windowHeight = ANativeWindow_getHeight(currentBundle->nativeSurface);
+        }
+        bool presented = gl_present_frame(currentBundle->context, width, height);
+        // After the frame was copied out at the size it was rendered at, the next one gets the new size
+        if (presented && windowWidth > 0 && windowHeight > 0 && (windowWidth != width || windowHeight != height))
+            gl_resize_pbuffer(currentBundle, windowWidth, windowHeight);
+        if (presented) return;
+    }
+
     if (currentBundle->surface != NULL)
         if (!eglSwapBuffers_p(g_EglDisplay, currentBundle->surface) && eglGetError_p() == EGL_BAD_SURFACE)
         {
@@ -201,6 +276,11 @@ void gl_swap_buffers() {
 
 }
 
+void gl_swap_buffers() {
+    if (gl_thread_recording()) gl_thread_present(gl_swap_buffers_here);
+    else gl_swap_buffers_here();
+}
+
 void gl_setup_window() {
     if (pojav_environ->mainWindowBundle != NULL)
     {
@@ -210,10 +290,16 @@ void gl_setup_window() {
     }
 }
 
+static void gl_swap_interval_here(void* swapInterval) {
+    if (currentBundle != NULL && gl_present_swap_interval(currentBundle->context, *(int*) swapInterval)) return;
+    eglSwapInterval_p(g_EglDisplay, *(int*) swapInterval);
+}
+
 void gl_swap_interval(int swapInterval) {
     if (pojav_environ->force_vsync) swapInterval = 1;
 
-    eglSwapInterval_p(g_EglDisplay, swapInterval);
+    if (gl_thread_recording()) gl_thread_run(gl_swap_interval_here, &swapInterval);
+    else gl_swap_interval_here(&swapInterval);
 }
 
 JNIEXPORT void JNICALL
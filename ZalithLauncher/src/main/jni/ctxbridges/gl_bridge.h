@@ -3,6 +3,8 @@
 //
 #include <EGL//egl.h>
 #include <stdbool.h>
+#include "gl_state_filter.h"
+#include "gl_upload.h"
 #ifndef POJAVLAUNCHER_GL_BRIDGE_H
 #define POJAVLAUNCHER_GL_BRIDGE_H
 
@@ -14,6 +16,9 @@ typedef struct {
     EGLint     format;
     EGLContext context;
     EGLSurface surface;
+    bool       presented; // surface is a pbuffer the presenter thread copies into nativeSurface
+    gl_state_shadow_t stateShadow;
+    gl_upload_shadow_t uploadShadow;
 } gl_render_window_t;
 
 bool gl_init();
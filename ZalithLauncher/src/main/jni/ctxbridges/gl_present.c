@@ -0,0 +1,378 @@
+//
+// Presentation offload, see gl_present.h
+//
+
+#include <android/log.h>
+#include <android/native_window.h>
+#include <dlfcn.h>
+#include <jni.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+
+#include "gl_present.h"
+#include "egl_loader.h"
+
+#define GL_PRESENT_MAX_DEPTH 4
+#define GL_PRESENT_DEFAULT_DEPTH 2
+
+static const char* g_LogTag = "GLPresent";
+
+/* Only the few entry points the copy and the draw need, resolved like pojavGetProcAddress() does */
+#define GL_PRESENT_FUNCTIONS(X) \
+    X(void, glActiveTexture, (GLenum texture)) \
+    X(void, glAttachShader, (GLuint program, GLuint shader)) \
+    X(void, glBindAttribLocation, (GLuint program, GLuint index, const GLchar* name)) \
+    X(void, glBindBuffer, (GLenum target, GLuint buffer)) \
+    X(void, glBindFramebuffer, (GLenum target, GLuint framebuffer)) \
+    X(void, glBindTexture, (GLenum target, GLuint texture)) \
+    X(void, glCompileShader, (GLuint shader)) \
+    X(void, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)) \
+    X(GLuint, glCreateProgram, (void)) \
+    X(GLuint, glCreateShader, (GLenum type)) \
+    X(void, glDrawArrays, (GLenum mode, GLint first, GLsizei count)) \
+    X(void, glEnableVertexAttribArray, (GLuint index)) \
+    X(void, glFlush, (void)) \
+    X(void, glGenTextures, (GLsizei n, GLuint* textures)) \
+    X(void, glGetIntegerv, (GLenum pname, GLint* data)) \
+    X(const GLubyte*, glGetString, (GLenum name)) \
+    X(GLint, glGetUniformLocation, (GLuint program, const GLchar* name)) \
+    X(void, glLinkProgram, (GLuint program)) \
+    X(void, glShaderSource, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)) \
+    X(void, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)) \
+    X(void, glTexParameteri, (GLenum target, GLenum pname, GLint param)) \
+    X(void, glUniform1i, (GLint location, GLint v0)) \
+    X(void, glUseProgram, (GLuint program)) \
+    X(void, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)) \
+    X(void, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height))
+
+#define GL_PRESENT_POINTER(type, name, parameters) static type (*name##_p) parameters;
+GL_PRESENT_FUNCTIONS(GL_PRESENT_POINTER)
+#undef GL_PRESENT_POINTER
+
+static PFNEGLCREATESYNCKHRPROC eglCreateSyncKHR_p;
+static PFNEGLDESTROYSYNCKHRPROC eglDestroySyncKHR_p;
+static PFNEGLCLIENTWAITSYNCKHRPROC eglClientWaitSyncKHR_p;
+static PFNEGLWAITSYNCKHRPROC eglWaitSyncKHR_p; // Optional, a wait on the CPU does the same
+
+typedef struct {
+    GLuint texture;
+    int width, height;
+    EGLSyncKHR rendered; // Made by the swapping thread after the copy, destroyed by the presenter
+    EGLSyncKHR presented; // Made by the presenter after the draw, destroyed by the swapping thread
+} gl_present_slot_t;
+
+static const char* g_VertexShader =
+        "attribute vec2 position;\n"
+        "varying vec2 coordinate;\n"
+        "void main() {\n"
+        "    coordinate = position * 0.5 + 0.5;\n"
+        "    gl_Position = vec4(position, 0.0, 1.0);\n"
+        "}\n";
+static const char* g_FragmentShader =
+        "precision mediump float;\n"
+        "uniform sampler2D frame;\n"
+        "varying vec2 coordinate;\n"
+        "void main() {\n"
+        "    gl_FragColor = texture2D(frame, coordinate);\n"
+        "}\n";
+static const GLfloat g_Triangle[] = { -1, -1, 3, -1, -1, 3 }; // Covers the whole viewport
+
+static bool g_Enabled, g_Resolved, g_Usable;
+static int g_Depth;
+static EGLDisplay g_Display;
+static EGLConfig g_Config;
+static EGLContext g_Presented; // The context whose frames are presented
+static bool g_Es3; // Of g_Presented, decides which framebuffer bindings exist
+static gl_present_slot_t g_Slots[GL_PRESENT_MAX_DEPTH];
+
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_QueuedCond = PTHREAD_COND_INITIALIZER, g_PresentedCond = PTHREAD_COND_INITIALIZER;
+/* Under g_Lock */
+static unsigned long g_Queued, g_Done;
+static bool g_WindowChanged;
+static struct ANativeWindow* g_PendingWindow;
+static int g_PendingInterval = -1;
+
+/* Presenter thread only */
+static EGLContext g_Context = EGL_NO_CONTEXT;
+static EGLSurface g_Surface = EGL_NO_SURFACE;
+static struct ANativeWindow* g_Window;
+static GLuint g_Program;
+
+/* Statistics */
+static atomic_ulong g_Swapped, g_Dropped, g_WaitNs, g_MaxWaitNs;
+
+static uint64_t gl_present_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+static bool gl_present_resolve() {
+    if (g_Resolved) return g_Usable;
+    g_Resolved = true;
+    bool found = true;
+#define GL_PRESENT_RESOLVE(type, name, parameters) \
+    name##_p = dlsym(RTLD_DEFAULT, #name); \
+    if (name##_p == NULL) name##_p = (void*) eglGetProcAddress_p(#name); \
+    found &= name##_p != NULL;
+    GL_PRESENT_FUNCTIONS(GL_PRESENT_RESOLVE)
+#undef GL_PRESENT_RESOLVE
+    eglCreateSyncKHR_p = (PFNEGLCREATESYNCKHRPROC) eglGetProcAddress_p("eglCreateSyncKHR");
+    eglDestroySyncKHR_p = (PFNEGLDESTROYSYNCKHRPROC) eglGetProcAddress_p("eglDestroySyncKHR");
+    eglClientWaitSyncKHR_p = (PFNEGLCLIENTWAITSYNCKHRPROC) eglGetProcAddress_p("eglClientWaitSyncKHR");
+    eglWaitSyncKHR_p = (PFNEGLWAITSYNCKHRPROC) eglGetProcAddress_p("eglWaitSyncKHR");
+    g_Usable = found && eglCreateSyncKHR_p && eglDestroySyncKHR_p && eglClientWaitSyncKHR_p;
+    if (!g_Usable) __android_log_print(ANDROID_LOG_WARN, g_LogTag, "EGL fence syncs or GL entry points are missing, presenting on the swapping thread");
+    return g_Usable;
+}
+
+/** Make the current context wait for `sync` and destroy it. */
+static void gl_present_wait_sync(EGLSyncKHR sync) {
+    if (eglWaitSyncKHR_p == NULL || !eglWaitSyncKHR_p(g_Display, sync, 0))
+        eglClientWaitSyncKHR_p(g_Display, sync, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, EGL_FOREVER_KHR);
+    eglDestroySyncKHR_p(g_Display, sync);
+}
+
+static GLuint gl_present_shader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader_p(type);
+    glShaderSource_p(shader, 1, &source, NULL);
+    glCompileShader_p(shader);
+    return shader;
+}
+
+/** On the presenter thread, with its context current. */
+static void gl_present_setup_program() {
+    g_Program = glCreateProgram_p();
+    glAttachShader_p(g_Program, gl_present_shader(GL_VERTEX_SHADER, g_VertexShader));
+    glAttachShader_p(g_Program, gl_present_shader(GL_FRAGMENT_SHADER, g_FragmentShader));
+    glBindAttribLocation_p(g_Program, 0, "position");
+    glLinkProgram_p(g_Program);
+    glUseProgram_p(g_Program);
+    glUniform1i_p(glGetUniformLocation_p(g_Program, "frame"), 0);
+    glVertexAttribPointer_p(0, 2, GL_FLOAT, GL_FALSE, 0, g_Triangle);
+    glEnableVertexAttribArray_p(0);
+    glActiveTexture_p(GL_TEXTURE0);
+}
+
+/** On the presenter thread: present into `window` from now on. */
+static void gl_present_switch_window(struct ANativeWindow* window) {
+    if (g_Context != EGL_NO_CONTEXT) eglMakeCurrent_p(g_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (g_Surface != EGL_NO_SURFACE) eglDestroySurface_p(g_Display, g_Surface);
+    if (g_Window != NULL) ANativeWindow_release(g_Window);
+    g_Surface = EGL_NO_SURFACE;
+    g_Window = window;
+    if (window == NULL) return;
+
+    if (g_Context == EGL_NO_CONTEXT) {
+        const EGLint attributes[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+        eglBindAPI_p(EGL_OPENGL_ES_API);
+        g_Context = eglCreateContext_p(g_Display, g_Config, g_Presented, attributes);
+        if (g_Context == EGL_NO_CONTEXT)
+            __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "eglCreateContext_p() failed: %04x", eglGetError_p());
+    }
+    g_Surface = eglCreateWindowSurface_p(g_Display, g_Config, window, NULL);
+    if (g_Context == EGL_NO_CONTEXT || g_Surface == EGL_NO_SURFACE ||
+        !eglMakeCurrent_p(g_Display, g_Surface, g_Surface, g_Context)) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't present into the new window: %04x", eglGetError_p());
+        if (g_Surface != EGL_NO_SURFACE) eglDestroySurface_p(g_Display, g_Surface);
+        g_Surface = EGL_NO_SURFACE;
+        return;
+    }
+    if (g_Program == 0) gl_present_setup_program();
+}
+
+/** On the presenter thread: draw `slot` into the window and swap. */
+static void gl_present_draw(gl_present_slot_t* slot) {
+    gl_present_wait_sync(slot->rendered);
+    slot->rendered = EGL_NO_SYNC_KHR;
+    glViewport_p(0, 0, ANativeWindow_getWidth(g_Window), ANativeWindow_getHeight(g_Window));
+    glBindTexture_p(GL_TEXTURE_2D, slot->texture);
+    glDrawArrays_p(GL_TRIANGLES, 0, 3);
+    slot->presented = eglCreateSyncKHR_p(g_Display, EGL_SYNC_FENCE_KHR, NULL);
+    if (eglSwapBuffers_p(g_Display, g_Surface)) {
+        atomic_fetch_add_explicit(&g_Swapped, 1, memory_order_relaxed);
+    } else if (eglGetError_p() == EGL_BAD_SURFACE) {
+        gl_present_switch_window(NULL);
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "The window has died, awaiting window change");
+    }
+}
+
+static void* gl_present_main(__attribute__((unused)) void* unused) {
+    pthread_setname_np(pthread_self(), "GLPresent");
+    for (;;) {
+        pthread_mutex_lock(&g_Lock);
+        while (g_Done == g_Queued && !g_WindowChanged) pthread_cond_wait(&g_QueuedCond, &g_Lock);
+        if (g_WindowChanged) {
+            struct ANativeWindow* window = g_PendingWindow;
+            g_PendingWindow = NULL;
+            g_WindowChanged = false;
+            pthread_mutex_unlock(&g_Lock);
+            gl_present_switch_window(window);
+            continue;
+        }
+        gl_present_slot_t* slot = &g_Slots[g_Done % g_Depth];
+        int interval = g_PendingInterval;
+        g_PendingInterval = -1;
+        pthread_mutex_unlock(&g_Lock);
+
+        if (g_Surface != EGL_NO_SURFACE) {
+            if (interval >= 0) eglSwapInterval_p(g_Display, interval);
+            gl_present_draw(slot);
+        } else {
+            eglDestroySyncKHR_p(g_Display, slot->rendered);
+            slot->rendered = EGL_NO_SYNC_KHR;
+            atomic_fetch_add_explicit(&g_Dropped, 1, memory_order_relaxed);
+        }
+
+        pthread_mutex_lock(&g_Lock);
+        g_Done++;
+        pthread_cond_broadcast(&g_PresentedCond);
+        pthread_mutex_unlock(&g_Lock);
+    }
+    return NULL;
+}
+
+void gl_present_init(const char* setting) {
+    if (setting == NULL) return;
+    const char* renderer = getenv("POJAV_RENDERER");
+    if (renderer != NULL && !strncmp(renderer, "opengles3_desktopgl", 19)) {
+        __android_log_print(ANDROID_LOG_WARN, g_LogTag, "Presentation offload needs an OpenGL ES context, disabled");
+        return;
+    }
+    int depth = atoi(setting);
+    g_Depth = depth < 1 ? GL_PRESENT_DEFAULT_DEPTH : depth > GL_PRESENT_MAX_DEPTH ? GL_PRESENT_MAX_DEPTH : depth;
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, gl_present_main, NULL) != 0) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Failed to start the presenter thread");
+        return;
+    }
+    pthread_detach(thread);
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Frames are presented on their own thread, queue depth %d", g_Depth);
+}
+
+bool gl_present_enabled() {
+    return g_Enabled;
+}
+
+bool gl_present_set_window(EGLDisplay display, EGLConfig config, EGLContext context, struct ANativeWindow* window) {
+    if (!gl_present_resolve()) return false;
+    if (g_Presented != EGL_NO_CONTEXT && g_Presented != context) return false;
+    g_Display = display;
+    g_Config = config;
+    g_Presented = context;
+    if (window != NULL) ANativeWindow_acquire(window);
+    pthread_mutex_lock(&g_Lock);
+    // A window the presenter never got to is replaced right away
+    if (g_PendingWindow != NULL) ANativeWindow_release(g_PendingWindow);
+    g_PendingWindow = window;
+    g_WindowChanged = true;
+    pthread_cond_signal(&g_QueuedCond);
+    pthread_mutex_unlock(&g_Lock);
+    return true;
+}
+
+/** With the presented context current: copy its default framebuffer into `slot`, leaving its bindings as they were. */
+static void gl_present_copy(gl_present_slot_t* slot, int width, int height) {
+    GLint texture = 0, framebuffer = 0, unpackBuffer = 0;
+    GLenum framebufferTarget = g_Es3 ? GL_READ_FRAMEBUFFER : GL_FRAMEBUFFER;
+    glGetIntegerv_p(GL_TEXTURE_BINDING_2D, &texture);
+    glGetIntegerv_p(g_Es3 ? GL_READ_FRAMEBUFFER_BINDING : GL_FRAMEBUFFER_BINDING, &framebuffer);
+    if (slot->texture == 0) glGenTextures_p(1, &slot->texture);
+    glBindTexture_p(GL_TEXTURE_2D, slot->texture);
+    if (slot->width != width || slot->height != height) {
+        if (g_Es3) {
+            glGetIntegerv_p(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+            if (unpackBuffer) glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        glTexImage2D_p(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri_p(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri_p(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri_p(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri_p(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        if (unpackBuffer) glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, (GLuint) unpackBuffer);
+        slot->width = width;
+        slot->height = height;
+    }
+    if (framebuffer) glBindFramebuffer_p(framebufferTarget, 0);
+    glCopyTexSubImage2D_p(GL_TEXTURE_2D, 0, 0, 0, 0, 0, width, height);
+    if (framebuffer) glBindFramebuffer_p(framebufferTarget, (GLuint) framebuffer);
+    glBindTexture_p(GL_TEXTURE_2D, (GLuint) texture);
+}
+
+bool gl_present_frame(EGLContext context, int width, int height) {
+    if (!g_Enabled || context != g_Presented || g_Presented == EGL_NO_CONTEXT) return false;
+    if (width <= 1 || height <= 1) return true; // The 1x1 pbuffer of a bundle without a window
+
+    static bool versionChecked;
+    if (!versionChecked) {
+        const char* version = (const char*) glGetString_p(GL_VERSION);
+        g_Es3 = version != NULL && !strncmp(version, "OpenGL ES ", 10) && version[10] >= '3';
+        versionChecked = true;
+    }
+
+    pthread_mutex_lock(&g_Lock);
+    if (g_Queued - g_Done >= (unsigned long) g_Depth) {
+        uint64_t start = gl_present_now();
+        while (g_Queued - g_Done >= (unsigned long) g_Depth) pthread_cond_wait(&g_PresentedCond, &g_Lock);
+        uint64_t waited = gl_present_now() - start;
+        atomic_fetch_add_explicit(&g_WaitNs, waited, memory_order_relaxed);
+        if (waited > atomic_load_explicit(&g_MaxWaitNs, memory_order_relaxed))
+            atomic_store_explicit(&g_MaxWaitNs, waited, memory_order_relaxed);
+    }
+    gl_present_slot_t* slot = &g_Slots[g_Queued % g_Depth];
+    pthread_mutex_unlock(&g_Lock);
+
+    // The presenter may still be sampling the texture on the GPU
+    if (slot->presented != EGL_NO_SYNC_KHR) {
+        gl_present_wait_sync(slot->presented);
+        slot->presented = EGL_NO_SYNC_KHR;
+    }
+    gl_present_copy(slot, width, height);
+    slot->rendered = eglCreateSyncKHR_p(g_Display, EGL_SYNC_FENCE_KHR, NULL);
+    // The fence has to reach the GPU before another context can wait for it
+    glFlush_p();
+
+    pthread_mutex_lock(&g_Lock);
+    g_Queued++;
+    pthread_cond_signal(&g_QueuedCond);
+    pthread_mutex_unlock(&g_Lock);
+    return true;
+}
+
+bool gl_present_swap_interval(EGLContext context, int interval) {
+    if (!g_Enabled || context != g_Presented || g_Presented == EGL_NO_CONTEXT) return false;
+    pthread_mutex_lock(&g_Lock);
+    g_PendingInterval = interval;
+    pthread_mutex_unlock(&g_Lock);
+    return true;
+}
+
+/**
+ * Copy the presenter statistics into the given array: queue depth, frames swapped, frames dropped without a window,
+ * nanoseconds the swapping thread waited for a free slot, longest single wait in nanoseconds.
+ * @return false if presentation offload is disabled (POJAV_GL_PRESENT_QUEUE is not set)
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeGetPresentStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!g_Enabled) return JNI_FALSE;
+    jlong values[] = {
+            g_Depth,
+            (jlong) atomic_load_explicit(&g_Swapped, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Dropped, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_WaitNs, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_MaxWaitNs, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
@@ -0,0 +1,44 @@
+//
+// Presentation offload, enabled with POJAV_GL_PRESENT_QUEUE (the queue depth, 1 to 4, 2 if it isn't a number).
+//
+// eglSwapBuffers() blocks on buffer dequeue with vsync on, on many drivers. Instead, the main window
+// bundle renders into a pbuffer of the window's size, and each frame is copied into one of
+// `depth` textures of its share group. A presenter thread, with its own shared context on the
+// window surface, draws the texture into the window and swaps. EGL fence syncs order the copy
+// before the draw, and the draw before the texture is reused. The swapping thread only waits
+// when `depth` frames are already queued.
+//
+// The surface loss recovery happens on the presenter thread as well: frames are dropped until
+// gl_setup_window() brings a new window.
+//
+
+#ifndef POJAVLAUNCHER_GL_PRESENT_H
+#define POJAVLAUNCHER_GL_PRESENT_H
+
+#include <EGL/egl.h>
+#include <stdbool.h>
+
+struct ANativeWindow;
+
+/** Call once, before the first context is created. `setting` is the value of POJAV_GL_PRESENT_QUEUE. */
+void gl_present_init(const char* setting);
+
+bool gl_present_enabled();
+
+/**
+ * From gl_swap_surface() of the main window bundle: `window` (NULL if there is none) is where the
+ * frames rendered with `context` go from now on. The presenter keeps its own reference.
+ * @return false if the presenter can't be used, the bundle has to present by itself then
+ */
+bool gl_present_set_window(EGLDisplay display, EGLConfig config, EGLContext context, struct ANativeWindow* window);
+
+/**
+ * Instead of eglSwapBuffers(), with `context` current on a `width` x `height` pbuffer.
+ * @return false if `context` isn't the one that is presented
+ */
+bool gl_present_frame(EGLContext context, int width, int height);
+
+/** @return false if `context` isn't the one that is presented, eglSwapInterval() applies then */
+bool gl_present_swap_interval(EGLContext context, int interval);
+
+#endif //POJAVLAUNCHER_GL_PRESENT_H
@@ -0,0 +1,182 @@
+//
+// Persistent GL entry point offsets, see gl_proc_cache.h
+//
+
+#include <android/log.h>
+#include <dlfcn.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gl_proc_cache.h"
+
+#define GL_PROC_CACHE_MAGIC 0x43504C47 // "GLPC"
+#define GL_PROC_CACHE_VERSION 2
+#define GL_PROC_CACHE_FILE "gl_proc_offsets.bin"
+/* Offset value that isn't an offset */
+#define GL_PROC_OFFSET_ELSEWHERE UINT32_MAX
+
+#define KEY_BUILD_ID 1
+#define KEY_SIZE_MTIME 2
+
+static const char* g_LogTag = "GLProcCache";
+
+/* Followed by `count` uint32_t offsets */
+typedef struct {
+    uint32_t magic, version, count, tableHash;
+    uint32_t keyLength;
+    uint8_t key[GL_PROC_CACHE_KEY_SIZE];
+} gl_proc_cache_header_t;
+
+typedef struct {
+    uintptr_t probe;
+    gl_proc_cache_t* cache;
+} library_search_t;
+
+static int find_library(struct dl_phdr_info* info, __attribute__((unused)) size_t size, void* data) {
+    library_search_t* search = data;
+    gl_proc_cache_t* cache = search->cache;
+    uintptr_t probe = search->probe, start = UINTPTR_MAX, end = 0;
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD) continue;
+        uintptr_t segment = info->dlpi_addr + phdr->p_vaddr;
+        if (segment < start) start = segment;
+        if (segment + phdr->p_memsz > end) end = segment + phdr->p_memsz;
+    }
+    if (probe < start || probe >= end) return 0;
+    cache->bias = info->dlpi_addr;
+    cache->start = start;
+    cache->end = end;
+
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_NOTE) continue;
+        const uint8_t* note = (const uint8_t*) (info->dlpi_addr + phdr->p_vaddr);
+        const uint8_t* notesEnd = note + phdr->p_memsz;
+        while (note + sizeof(ElfW(Nhdr)) <= notesEnd) {
+            const ElfW(Nhdr)* header = (const ElfW(Nhdr)*) note;
+            const uint8_t* name = note + sizeof(ElfW(Nhdr));
+            const uint8_t* desc = name + ((header->n_namesz + 3) & ~3u);
+            if (header->n_type == NT_GNU_BUILD_ID && header->n_namesz == 4 && !memcmp(name, "GNU", 4) &&
+                header->n_descsz > 0 && header->n_descsz < GL_PROC_CACHE_KEY_SIZE) {
+                cache->key[0] = KEY_BUILD_ID;
+                memcpy(cache->key + 1, desc, header->n_descsz);
+                cache->keyLength = header->n_descsz + 1;
+                return 1;
+            }
+            note = desc + ((header->n_descsz + 3) & ~3u);
+        }
+    }
+    return 1;
+}
+
+bool gl_proc_cache_open(gl_proc_cache_t* cache, const void* probe) {
+    memset(cache, 0, sizeof(gl_proc_cache_t));
+    const char* directory = getenv("TMPDIR");
+    if (probe == NULL || directory == NULL) return false;
+    if (snprintf(cache->path, sizeof(cache->path), "%s/%s", directory, GL_PROC_CACHE_FILE) >= (int) sizeof(cache->path))
+        return false;
+
+    library_search_t search = { (uintptr_t) probe, cache };
+    if (!dl_iterate_phdr(find_library, &search)) return false;
+    if (cache->keyLength == 0) {
+        // No build-id: the size and modification time of the file have to do
+        Dl_info info;
+        struct stat library;
+        if (!dladdr(probe, &info) || info.dli_fname == NULL || stat(info.dli_fname, &library) != 0) return false;
+        int64_t values[2] = { library.st_size, library.st_mtime };
+        cache->key[0] = KEY_SIZE_MTIME;
+        memcpy(cache->key + 1, values, sizeof(values));
+        cache->keyLength = 1 + sizeof(values);
+    }
+    return true;
+}
+
+bool gl_proc_cache_load(gl_proc_cache_t* cache, const char* const* names, void** addresses, int count,
+                        uint32_t tableHash, gl_proc_resolver_t resolver) {
+    int fd = open(cache->path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "No cache yet, %d entry points will be resolved", count);
+        return false;
+    }
+    size_t size = sizeof(gl_proc_cache_header_t) + (size_t) count * sizeof(uint32_t);
+    struct stat file;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &file) == 0 && (size_t) file.st_size == size)
+        mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    const gl_proc_cache_header_t* header = mapping;
+    const char* invalidated = NULL;
+    if (mapping == MAP_FAILED) invalidated = "unexpected size";
+    else if (header->magic != GL_PROC_CACHE_MAGIC || header->version != GL_PROC_CACHE_VERSION) invalidated = "unknown format";
+    else if (header->count != (uint32_t) count || header->tableHash != tableHash) invalidated = "entry point table changed";
+    else if (header->keyLength != cache->keyLength || memcmp(header->key, cache->key, cache->keyLength) != 0)
+        invalidated = cache->key[0] == KEY_BUILD_ID ? "library build-id changed" : "library file changed";
+    if (invalidated) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Cache invalidated: %s", invalidated);
+        if (mapping != MAP_FAILED) munmap(mapping, size);
+        return false;
+    }
+
+    const uint32_t* offsets = (const uint32_t*) (header + 1);
+    int hits = 0, misses = 0;
+    for (int slot = 0; slot < count; slot++) {
+        if (offsets[slot] == GL_PROC_OFFSET_ELSEWHERE) {
+            addresses[slot] = resolver(names[slot]);
+            misses++;
+        } else {
+            addresses[slot] = (void*) (cache->bias + offsets[slot]);
+            hits++;
+        }
+    }
+    munmap(mapping, size);
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Cache hit: %d entry points rebased, %d resolved through the linker", hits, misses);
+    return true;
+}
+
+void gl_proc_cache_store(gl_proc_cache_t* cache, void* const* addresses, int count, uint32_t tableHash) {
+    size_t size = sizeof(gl_proc_cache_header_t) + (size_t) count * sizeof(uint32_t);
+    gl_proc_cache_header_t* header = calloc(1, size);
+    if (header == NULL) return;
+    header->magic = GL_PROC_CACHE_MAGIC;
+    header->version = GL_PROC_CACHE_VERSION;
+    header->count = (uint32_t) count;
+    header->tableHash = tableHash;
+    header->keyLength = cache->keyLength;
+    memcpy(header->key, cache->key, cache->keyLength);
+
+    uint32_t* offsets = (uint32_t*) (header + 1);
+    int elsewhere = 0;
+    for (int slot = 0; slot < count; slot++) {
+        uintptr_t address = (uintptr_t) addresses[slot];
+        // Missing ones are resolved again too, eglGetProcAddress() may find them after a driver update that leaves libGLESv2 alone
+        if (address != 0 && address >= cache->start && address < cache->end && address - cache->bias < GL_PROC_OFFSET_ELSEWHERE) {
+            offsets[slot] = (uint32_t) (address - cache->bias);
+        } else {
+            offsets[slot] = GL_PROC_OFFSET_ELSEWHERE;
+            elsewhere++;
+        }
+    }
+
+    // Written next to it and renamed, so that a concurrent launch never maps half a file
+    char temporary[PATH_MAX + 8];
+    snprintf(temporary, sizeof(temporary), "%s.%d", cache->path, getpid());
+    int fd = open(temporary, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    bool written = fd >= 0 && write(fd, header, size) == (ssize_t) size;
+    if (fd >= 0) close(fd);
+    if (written && rename(temporary, cache->path) == 0) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Cached %d entry points, %d of them live in other libraries", count, elsewhere);
+    } else {
+        __android_log_print(ANDROID_LOG_WARN, g_LogTag, "Failed to write %s", cache->path);
+        unlink(temporary);
+    }
+    free(header);
+}
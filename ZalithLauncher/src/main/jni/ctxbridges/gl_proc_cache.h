@@ -0,0 +1,45 @@
+//
+// Persistent cache of GL entry point offsets, so that gl_proc_table.c doesn't have to go through
+// the dynamic linker for thousands of names on every launch.
+//
+// Each entry point is stored as its offset from the load bias of libGLESv2. The file is keyed by
+// the ELF build-id of the library (or its size and mtime when it has none), so that a system
+// update that replaces the library invalidates it. Entry points that came from another library,
+// or weren't found at all, are marked as such and resolved as before on every launch.
+//
+
+#ifndef POJAVLAUNCHER_GL_PROC_CACHE_H
+#define POJAVLAUNCHER_GL_PROC_CACHE_H
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gl_proc_table.h"
+
+#define GL_PROC_CACHE_KEY_SIZE 32
+
+typedef struct {
+    char path[PATH_MAX]; // The cache file
+    uintptr_t bias, start, end; // Where the library is mapped
+    uint32_t keyLength;
+    uint8_t key[GL_PROC_CACHE_KEY_SIZE];
+} gl_proc_cache_t;
+
+/**
+ * Identify the library that contains `probe`.
+ * @return false if the library or the cache directory can't be found, the cache is unusable then
+ */
+bool gl_proc_cache_open(gl_proc_cache_t* cache, const void* probe);
+
+/**
+ * Fill `addresses` from the cache file, entries of other libraries are resolved with `resolver`.
+ * @return false if the file is missing or was made for another library or table, nothing is filled then
+ */
+bool gl_proc_cache_load(gl_proc_cache_t* cache, const char* const* names, void** addresses, int count,
+                        uint32_t tableHash, gl_proc_resolver_t resolver);
+
+/** Replace the cache file with the offsets of freshly resolved `addresses`. */
+void gl_proc_cache_store(gl_proc_cache_t* cache, void* const* addresses, int count, uint32_t tableHash);
+
+#endif //POJAVLAUNCHER_GL_PROC_CACHE_H
@@ -0,0 +1,2978 @@
+//
+// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.
+//
+// Every entry point of gl_proc_names.h with what it takes to call it from another thread:
+//   GL_PROC_ASYNC(slot, name, parameters, arguments, fields, call_arguments)
+//     returns nothing and takes no pointers, can run later
+//   GL_PROC_SYNC_VOID(slot, name, parameters, arguments, fields, call_arguments)
+//     returns nothing, but takes pointers (or has to wait anyway)
+//   GL_PROC_SYNC_CLIENT_ARRAY(slot, name, parameters, arguments, fields, call_arguments)
+//     the same, and may leave a pointer to client memory for later draws
+//   GL_PROC_SYNC(slot, result, name, parameters, arguments, fields, call_arguments)
+//     returns a value
+// `fields` declares the parameters as struct members, `call_arguments` reads them from `call`.
+//
+
+GL_PROC_ASYNC(0, glVertexAttribL1i64NV, (GLuint index, GLint64EXT x), (index, x), GLuint index; GLint64EXT x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1, glTransformFeedbackVaryingsEXT, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode), GLuint program; GLsizei count; const GLchar *const*varyings; GLenum bufferMode;, (call->program, call->count, call->varyings, call->bufferMode))
+GL_PROC_SYNC_VOID(2, glVDPAUGetSurfaceivNV, (GLvdpauSurfaceNV surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (surface, pname, bufSize, length, values), GLvdpauSurfaceNV surface; GLenum pname; GLsizei bufSize; GLsizei *length; GLint *values;, (call->surface, call->pname, call->bufSize, call->length, call->values))
+GL_PROC_SYNC_CLIENT_ARRAY(3, glNormalPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride), GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_SYNC_VOID(4, glGenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLsizei n; GLuint *framebuffers;, (call->n, call->framebuffers))
+GL_PROC_SYNC_VOID(5, glMapParameterfvNV, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(6, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params), GLuint program; GLsizei uniformCount; const GLuint *uniformIndices; GLenum pname; GLint *params;, (call->program, call->uniformCount, call->uniformIndices, call->pname, call->params))
+GL_PROC_SYNC_VOID(7, glCombinerStageParameterfvNV, (GLenum stage, GLenum pname, const GLfloat *params), (stage, pname, params), GLenum stage; GLenum pname; const GLfloat *params;, (call->stage, call->pname, call->params))
+GL_PROC_ASYNC(8, glVertexAttrib1fARB, (GLuint index, GLfloat x), (index, x), GLuint index; GLfloat x;, (call->index, call->x))
+GL_PROC_SYNC(9, GLboolean, glIsFenceNV, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(10, glVertexAttrib4dvNV, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(11, glVertexAttribArrayObjectATI, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset), (index, size, type, normalized, stride, buffer, offset), GLuint index; GLint size; GLenum type; GLboolean normalized; GLsizei stride; GLuint buffer; GLuint offset;, (call->index, call->size, call->type, call->normalized, call->stride, call->buffer, call->offset))
+GL_PROC_SYNC_VOID(12, glTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, width, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->xoffset, call->width, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(13, glProgramParameteriEXT, (GLuint program, GLenum pname, GLint value), (program, pname, value), GLuint program; GLenum pname; GLint value;, (call->program, call->pname, call->value))
+GL_PROC_SYNC_VOID(14, glGetnColorTable, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table), GLenum target; GLenum format; GLenum type; GLsizei bufSize; void *table;, (call->target, call->format, call->type, call->bufSize, call->table))
+GL_PROC_SYNC_VOID(15, glVertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(16, glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels), (target, level, format, type, pixels), GLenum target; GLint level; GLenum format; GLenum type; GLvoid *pixels;, (call->target, call->level, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(17, glTextureStorage2D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height), GLuint texture; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height;, (call->texture, call->levels, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(18, glPassThrough, (GLfloat token), (token), GLfloat token;, (call->token))
+GL_PROC_SYNC_VOID(19, glGetQueryObjecti64vEXT, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params), GLuint id; GLenum pname; GLint64 *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(20, glSecondaryColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride), GLint size; GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->size, call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_SYNC_VOID(21, glGetClipPlane, (GLenum plane, GLdouble *equation), (plane, equation), GLenum plane; GLdouble *equation;, (call->plane, call->equation))
+GL_PROC_SYNC_VOID(22, glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v), (rc, tc, n, v), const GLuint *rc; const GLfloat *tc; const GLfloat *n; const GLfloat *v;, (call->rc, call->tc, call->n, call->v))
+GL_PROC_SYNC_VOID(23, glMultTransposeMatrixd, (const GLdouble m[16]), (m), const GLdouble *m;, (call->m))
+GL_PROC_ASYNC(24, glCopyColorTableSGI, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width;, (call->target, call->internalformat, call->x, call->y, call->width))
+GL_PROC_ASYNC(25, glVertexAttrib4fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(26, glGetVertexAttribPointervARB, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), GLuint index; GLenum pname; void **pointer;, (call->index, call->pname, call->pointer))
+GL_PROC_SYNC_VOID(27, glDrawRangeElementsEXT, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices), GLenum mode; GLuint start; GLuint end; GLsizei count; GLenum type; const void *indices;, (call->mode, call->start, call->end, call->count, call->type, call->indices))
+GL_PROC_SYNC_VOID(28, glRectiv, (const GLint *v1, const GLint *v2), (v1, v2), const GLint *v1; const GLint *v2;, (call->v1, call->v2))
+GL_PROC_SYNC_VOID(29, glCompressedTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, border, imageSize, bits), GLuint texture; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLint border; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->internalformat, call->width, call->height, call->border, call->imageSize, call->bits))
+GL_PROC_ASYNC(30, glClearAccumxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha), GLfixed red; GLfixed green; GLfixed blue; GLfixed alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(31, glVertexAttrib3svNV, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC(32, GLuint, glGetProgramResourceIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLuint program; GLenum programInterface; const GLchar *name;, (call->program, call->programInterface, call->name))
+GL_PROC_SYNC_VOID(33, glSecondaryColor3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(34, glEdgeFlagv, (const GLboolean *flag), (flag), const GLboolean *flag;, (call->flag))
+GL_PROC_SYNC_VOID(35, glTexCoord1iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(36, glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, nx, ny, nz, x, y, z), GLuint rc; GLfloat s; GLfloat t; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->s, call->t, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(37, glImportMemoryWin32HandleEXT, (GLuint memory, GLuint64 size, GLenum handleType, void *handle), (memory, size, handleType, handle), GLuint memory; GLuint64 size; GLenum handleType; void *handle;, (call->memory, call->size, call->handleType, call->handle))
+GL_PROC_ASYNC(38, glWindowPos2i, (GLint x, GLint y), (x, y), GLint x; GLint y;, (call->x, call->y))
+GL_PROC_ASYNC(39, glBindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format), GLuint unit; GLuint texture; GLint level; GLboolean layered; GLint layer; GLenum access; GLenum format;, (call->unit, call->texture, call->level, call->layered, call->layer, call->access, call->format))
+GL_PROC_SYNC_VOID(40, glVertexAttribs1hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v), GLuint index; GLsizei n; const GLhalfNV *v;, (call->index, call->n, call->v))
+GL_PROC_SYNC_VOID(41, glVertexAttrib4NusvARB, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_ASYNC(42, glMemoryBarrier, (GLbitfield barriers), (barriers), GLbitfield barriers;, (call->barriers))
+GL_PROC_ASYNC(43, glMultiTexCoord2f, (GLenum target, GLfloat s, GLfloat t), (target, s, t), GLenum target; GLfloat s; GLfloat t;, (call->target, call->s, call->t))
+GL_PROC_SYNC_VOID(44, glTexImage4DSGIS, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, size4d, border, format, type, pixels), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLsizei size4d; GLint border; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->size4d, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(45, glGetIntegerui64vNV, (GLenum value, GLuint64EXT *result), (value, result), GLenum value; GLuint64EXT *result;, (call->value, call->result))
+GL_PROC_SYNC_VOID(46, glFeedbackBuffer, (GLsizei size, GLenum type, GLfloat *buffer), (size, type, buffer), GLsizei size; GLenum type; GLfloat *buffer;, (call->size, call->type, call->buffer))
+GL_PROC_ASYNC(47, glReplacementCodeusSUN, (GLushort code), (code), GLushort code;, (call->code))
+GL_PROC_ASYNC(48, glFramebufferRenderbufferEXT, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), GLenum target; GLenum attachment; GLenum renderbuffertarget; GLuint renderbuffer;, (call->target, call->attachment, call->renderbuffertarget, call->renderbuffer))
+GL_PROC_ASYNC(49, glStopInstrumentsSGIX, (GLint marker), (marker), GLint marker;, (call->marker))
+GL_PROC_SYNC(50, GLenum, glGetGraphicsResetStatusARB, (void), (), , ())
+GL_PROC_ASYNC(51, glProgramEnvParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w), GLenum target; GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(52, glCopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLint border;, (call->target, call->level, call->internalformat, call->x, call->y, call->width, call->border))
+GL_PROC_SYNC_VOID(53, glBindTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLuint first; GLsizei count; const GLuint *textures;, (call->first, call->count, call->textures))
+GL_PROC_SYNC_VOID(54, glGetActiveUniformARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name), GLhandleARB programObj; GLuint index; GLsizei maxLength; GLsizei *length; GLint *size; GLenum *type; GLcharARB *name;, (call->programObj, call->index, call->maxLength, call->length, call->size, call->type, call->name))
+GL_PROC_SYNC_VOID(55, glVertex2hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_SYNC_VOID(56, glSecondaryColor3ubvEXT, (const GLubyte *v), (v), const GLubyte *v;, (call->v))
+GL_PROC_ASYNC(57, glTexRenderbufferNV, (GLenum target, GLuint renderbuffer), (target, renderbuffer), GLenum target; GLuint renderbuffer;, (call->target, call->renderbuffer))
+GL_PROC_SYNC_VOID(58, glVertexAttribL1dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(59, glMultiTexCoord1bvOES, (GLenum texture, const GLbyte *coords), (texture, coords), GLenum texture; const GLbyte *coords;, (call->texture, call->coords))
+GL_PROC_SYNC_VOID(60, glTexImage1D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, border, format, type, pixels), GLenum target; GLint level; GLint internalFormat; GLsizei width; GLint border; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->internalFormat, call->width, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(61, glGetMemoryObjectParameterivEXT, (GLuint memoryObject, GLenum pname, GLint *params), (memoryObject, pname, params), GLuint memoryObject; GLenum pname; GLint *params;, (call->memoryObject, call->pname, call->params))
+GL_PROC_SYNC_VOID(62, glVertexAttribs4svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v), GLuint index; GLsizei count; const GLshort *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(63, glVertexAttrib4sv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(64, glGetHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values), (target, reset, format, type, values), GLenum target; GLboolean reset; GLenum format; GLenum type; GLvoid *values;, (call->target, call->reset, call->format, call->type, call->values))
+GL_PROC_ASYNC(65, glValidateProgram, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_SYNC_VOID(66, glGetPathSpacingNV, (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing), (pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing), GLenum pathListMode; GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLfloat advanceScale; GLfloat kerningScale; GLenum transformType; GLfloat *returnedSpacing;, (call->pathListMode, call->numPaths, call->pathNameType, call->paths, call->pathBase, call->advanceScale, call->kerningScale, call->transformType, call->returnedSpacing))
+GL_PROC_SYNC_VOID(67, glTransformFeedbackVaryingsNV, (GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode), (program, count, locations, bufferMode), GLuint program; GLsizei count; const GLint *locations; GLenum bufferMode;, (call->program, call->count, call->locations, call->bufferMode))
+GL_PROC_ASYNC(68, glVertexArrayAttribBinding, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex), GLuint vaobj; GLuint attribindex; GLuint bindingindex;, (call->vaobj, call->attribindex, call->bindingindex))
+GL_PROC_SYNC_VOID(69, glProgramUniform4ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(70, glEnableClientState, (GLenum cap), (cap), GLenum cap;, (call->cap))
+GL_PROC_SYNC_VOID(71, glMultiDrawElementArrayAPPLE, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount), GLenum mode; const GLint *first; const GLsizei *count; GLsizei primcount;, (call->mode, call->first, call->count, call->primcount))
+GL_PROC_SYNC_VOID(72, glRasterPos4sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(73, glVertexAttrib1dvARB, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(74, glDepthRangef, (GLfloat n, GLfloat f), (n, f), GLfloat n; GLfloat f;, (call->n, call->f))
+GL_PROC_SYNC_VOID(75, glMultiDrawArraysEXT, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount), GLenum mode; const GLint *first; const GLsizei *count; GLsizei primcount;, (call->mode, call->first, call->count, call->primcount))
+GL_PROC_ASYNC(76, glTangent3sEXT, (GLshort tx, GLshort ty, GLshort tz), (tx, ty, tz), GLshort tx; GLshort ty; GLshort tz;, (call->tx, call->ty, call->tz))
+GL_PROC_SYNC_VOID(77, glGetColorTable, (GLenum target, GLenum format, GLenum type, GLvoid *table), (target, format, type, table), GLenum target; GLenum format; GLenum type; GLvoid *table;, (call->target, call->format, call->type, call->table))
+GL_PROC_SYNC_VOID(78, glGetVertexArrayIntegeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param), GLuint vaobj; GLuint index; GLenum pname; GLint *param;, (call->vaobj, call->index, call->pname, call->param))
+GL_PROC_ASYNC(79, glPathParameterfNV, (GLuint path, GLenum pname, GLfloat value), (path, pname, value), GLuint path; GLenum pname; GLfloat value;, (call->path, call->pname, call->value))
+GL_PROC_SYNC_VOID(80, glGetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name), GLuint program; GLenum shadertype; GLuint index; GLsizei bufsize; GLsizei *length; GLchar *name;, (call->program, call->shadertype, call->index, call->bufsize, call->length, call->name))
+GL_PROC_SYNC_VOID(81, glCreateVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays), GLsizei n; GLuint *arrays;, (call->n, call->arrays))
+GL_PROC_ASYNC(82, glCopyColorSubTableEXT, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width), GLenum target; GLsizei start; GLint x; GLint y; GLsizei width;, (call->target, call->start, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(83, glTexParameterIivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(84, glStencilFuncSeparateATI, (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask), (frontfunc, backfunc, ref, mask), GLenum frontfunc; GLenum backfunc; GLint ref; GLuint mask;, (call->frontfunc, call->backfunc, call->ref, call->mask))
+GL_PROC_SYNC_VOID(85, glRasterPos3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(86, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(87, glColorFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride), GLint size; GLenum type; GLsizei stride;, (call->size, call->type, call->stride))
+GL_PROC_ASYNC(88, glProgramUniformHandleui64ARB, (GLuint program, GLint location, GLuint64 value), (program, location, value), GLuint program; GLint location; GLuint64 value;, (call->program, call->location, call->value))
+GL_PROC_SYNC(89, GLuint64, glGetImageHandleNV, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format), GLuint texture; GLint level; GLboolean layered; GLint layer; GLenum format;, (call->texture, call->level, call->layered, call->layer, call->format))
+GL_PROC_ASYNC(90, glBeginConditionalRenderNV, (GLuint id, GLenum mode), (id, mode), GLuint id; GLenum mode;, (call->id, call->mode))
+GL_PROC_SYNC_VOID(91, glRasterPos4fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC(92, GLint, glGetFragDataIndex, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_ASYNC(93, glShaderOp3EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3), (op, res, arg1, arg2, arg3), GLenum op; GLuint res; GLuint arg1; GLuint arg2; GLuint arg3;, (call->op, call->res, call->arg1, call->arg2, call->arg3))
+GL_PROC_SYNC_VOID(94, glDeleteFramebuffersEXT, (GLsizei n, const GLuint *framebuffers), (n, framebuffers), GLsizei n; const GLuint *framebuffers;, (call->n, call->framebuffers))
+GL_PROC_SYNC_VOID(95, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex), GLenum mode; GLsizei count; GLenum type; const void *indices; GLint basevertex;, (call->mode, call->count, call->type, call->indices, call->basevertex))
+GL_PROC_ASYNC(96, glNamedBufferStorageExternalEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (buffer, offset, size, clientBuffer, flags), GLuint buffer; GLintptr offset; GLsizeiptr size; GLeglClientBufferEXT clientBuffer; GLbitfield flags;, (call->buffer, call->offset, call->size, call->clientBuffer, call->flags))
+GL_PROC_ASYNC(97, glFrontFace, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(98, glProgramUniformMatrix4x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(99, glTexParameterIuivEXT, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params), GLenum target; GLenum pname; const GLuint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(100, glVertexAttribs2hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v), GLuint index; GLsizei n; const GLhalfNV *v;, (call->index, call->n, call->v))
+GL_PROC_SYNC(101, GLuint, glCreateProgressFenceNVX, (void), (), , ())
+GL_PROC_SYNC_VOID(102, glProgramUniformMatrix4x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(103, glVertexAttrib3sNV, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), GLuint index; GLshort x; GLshort y; GLshort z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(104, glCreateProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines), GLsizei n; GLuint *pipelines;, (call->n, call->pipelines))
+GL_PROC_SYNC_VOID(105, glGetLightxOES, (GLenum light, GLenum pname, GLfixed *params), (light, pname, params), GLenum light; GLenum pname; GLfixed *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(106, glTexCoord2xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(107, glRasterPos2f, (GLfloat x, GLfloat y), (x, y), GLfloat x; GLfloat y;, (call->x, call->y))
+GL_PROC_SYNC_CLIENT_ARRAY(108, glNormalPointervINTEL, (GLenum type, const void **pointer), (type, pointer), GLenum type; const void **pointer;, (call->type, call->pointer))
+GL_PROC_ASYNC(109, glRasterPos2s, (GLshort x, GLshort y), (x, y), GLshort x; GLshort y;, (call->x, call->y))
+GL_PROC_ASYNC(110, glTexEnvi, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(111, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers), GLsizei n; const GLuint *renderbuffers;, (call->n, call->renderbuffers))
+GL_PROC_SYNC_VOID(112, glGetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params), GLenum shadertype; GLint location; GLuint *params;, (call->shadertype, call->location, call->params))
+GL_PROC_ASYNC(113, glVertexAttrib3sARB, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), GLuint index; GLshort x; GLshort y; GLshort z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(114, glGetPerfMonitorCounterInfoAMD, (GLuint group, GLuint counter, GLenum pname, void *data), (group, counter, pname, data), GLuint group; GLuint counter; GLenum pname; void *data;, (call->group, call->counter, call->pname, call->data))
+GL_PROC_SYNC_VOID(115, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), GLuint id; GLenum pname; GLuint *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(116, glExecuteProgramNV, (GLenum target, GLuint id, const GLfloat *params), (target, id, params), GLenum target; GLuint id; const GLfloat *params;, (call->target, call->id, call->params))
+GL_PROC_SYNC_VOID(117, glMultiDrawElementsIndirectCount, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride), GLenum mode; GLenum type; const void *indirect; GLintptr drawcount; GLsizei maxdrawcount; GLsizei stride;, (call->mode, call->type, call->indirect, call->drawcount, call->maxdrawcount, call->stride))
+GL_PROC_ASYNC(118, glUniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z), GLint location; GLdouble x; GLdouble y; GLdouble z;, (call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(119, glListParameterfSGIX, (GLuint list, GLenum pname, GLfloat param), (list, pname, param), GLuint list; GLenum pname; GLfloat param;, (call->list, call->pname, call->param))
+GL_PROC_ASYNC(120, glInvalidateTexImage, (GLuint texture, GLint level), (texture, level), GLuint texture; GLint level;, (call->texture, call->level))
+GL_PROC_ASYNC(121, glClientActiveTexture, (GLenum texture), (texture), GLenum texture;, (call->texture))
+GL_PROC_SYNC_VOID(122, glListDrawCommandsStatesClientNV, (GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (list, segment, indirects, sizes, states, fbos, count), GLuint list; GLuint segment; const void **indirects; const GLsizei *sizes; const GLuint *states; const GLuint *fbos; GLuint count;, (call->list, call->segment, call->indirects, call->sizes, call->states, call->fbos, call->count))
+GL_PROC_SYNC_VOID(123, glBinormal3ivEXT, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(124, glTexCoord4d, (GLdouble s, GLdouble t, GLdouble r, GLdouble q), (s, t, r, q), GLdouble s; GLdouble t; GLdouble r; GLdouble q;, (call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(125, glPrimitiveRestartIndex, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_ASYNC(126, glRotatexOES, (GLfixed angle, GLfixed x, GLfixed y, GLfixed z), (angle, x, y, z), GLfixed angle; GLfixed x; GLfixed y; GLfixed z;, (call->angle, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(127, glVertexAttribs3hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v), GLuint index; GLsizei n; const GLhalfNV *v;, (call->index, call->n, call->v))
+GL_PROC_SYNC_VOID(128, glGenFencesNV, (GLsizei n, GLuint *fences), (n, fences), GLsizei n; GLuint *fences;, (call->n, call->fences))
+GL_PROC_SYNC_VOID(129, glGetFramebufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(130, glSamplePatternSGIS, (GLenum pattern), (pattern), GLenum pattern;, (call->pattern))
+GL_PROC_SYNC_VOID(131, glLoadTransposeMatrixd, (const GLdouble m[16]), (m), const GLdouble *m;, (call->m))
+GL_PROC_ASYNC(132, glVertexAttribI4uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), GLuint index; GLuint x; GLuint y; GLuint z; GLuint w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(133, glFramebufferTextureLayerEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), GLenum target; GLenum attachment; GLuint texture; GLint level; GLint layer;, (call->target, call->attachment, call->texture, call->level, call->layer))
+GL_PROC_ASYNC(134, glIndexub, (GLubyte c), (c), GLubyte c;, (call->c))
+GL_PROC_SYNC_VOID(135, glTexCoord2bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_ASYNC(136, glBindBufferRangeNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), GLenum target; GLuint index; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->target, call->index, call->buffer, call->offset, call->size))
+GL_PROC_SYNC_VOID(137, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; const GLuint *value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_ASYNC(138, glTangent3fEXT, (GLfloat tx, GLfloat ty, GLfloat tz), (tx, ty, tz), GLfloat tx; GLfloat ty; GLfloat tz;, (call->tx, call->ty, call->tz))
+GL_PROC_ASYNC(139, glWindowPos2f, (GLfloat x, GLfloat y), (x, y), GLfloat x; GLfloat y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(140, glColor4fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(141, glStencilOpValueAMD, (GLenum face, GLuint value), (face, value), GLenum face; GLuint value;, (call->face, call->value))
+GL_PROC_SYNC_VOID(142, glLoadProgramNV, (GLenum target, GLuint id, GLsizei len, const GLubyte *program), (target, id, len, program), GLenum target; GLuint id; GLsizei len; const GLubyte *program;, (call->target, call->id, call->len, call->program))
+GL_PROC_SYNC_VOID(143, glGetFloati_vEXT, (GLenum pname, GLuint index, GLfloat *params), (pname, index, params), GLenum pname; GLuint index; GLfloat *params;, (call->pname, call->index, call->params))
+GL_PROC_ASYNC(144, glShadingRateImageBarrierNV, (GLboolean synchronize), (synchronize), GLboolean synchronize;, (call->synchronize))
+GL_PROC_SYNC_VOID(145, glProgramUniform3ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(146, glWindowPos2iMESA, (GLint x, GLint y), (x, y), GLint x; GLint y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(147, glTexCoord3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(148, glGetMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; GLint *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_ASYNC(149, glGetQueryBufferObjecti64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLuint id; GLuint buffer; GLenum pname; GLintptr offset;, (call->id, call->buffer, call->pname, call->offset))
+GL_PROC_SYNC_VOID(150, glVertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(151, glProgramEnvParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params), (target, index, params), GLenum target; GLuint index; const GLfloat *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(152, glVertexAttribL3ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v), GLuint index; const GLuint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(153, glClipPlanexOES, (GLenum plane, const GLfixed *equation), (plane, equation), GLenum plane; const GLfixed *equation;, (call->plane, call->equation))
+GL_PROC_SYNC_VOID(154, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog), GLuint shader; GLsizei bufSize; GLsizei *length; GLchar *infoLog;, (call->shader, call->bufSize, call->length, call->infoLog))
+GL_PROC_ASYNC(155, glAttachObjectARB, (GLhandleARB containerObj, GLhandleARB obj), (containerObj, obj), GLhandleARB containerObj; GLhandleARB obj;, (call->containerObj, call->obj))
+GL_PROC_ASYNC(156, glColor4hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha), (red, green, blue, alpha), GLhalfNV red; GLhalfNV green; GLhalfNV blue; GLhalfNV alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(157, glMatrixScaledEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z), GLenum mode; GLdouble x; GLdouble y; GLdouble z;, (call->mode, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(158, glNamedFramebufferSampleLocationsfvNV, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v), GLuint framebuffer; GLuint start; GLsizei count; const GLfloat *v;, (call->framebuffer, call->start, call->count, call->v))
+GL_PROC_ASYNC(159, glColorP4ui, (GLenum type, GLuint color), (type, color), GLenum type; GLuint color;, (call->type, call->color))
+GL_PROC_SYNC_VOID(160, glScissorExclusiveArrayvNV, (GLuint first, GLsizei count, const GLint *v), (first, count, v), GLuint first; GLsizei count; const GLint *v;, (call->first, call->count, call->v))
+GL_PROC_SYNC_VOID(161, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value), GLenum buffer; GLint drawbuffer; const GLuint *value;, (call->buffer, call->drawbuffer, call->value))
+GL_PROC_ASYNC(162, glVertex4i, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w), GLint x; GLint y; GLint z; GLint w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(163, glCompressedTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, depth, border, imageSize, bits), GLuint texture; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(164, glUniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(165, GLint, glGetProgramResourceLocationIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLuint program; GLenum programInterface; const GLchar *name;, (call->program, call->programInterface, call->name))
+GL_PROC_SYNC_VOID(166, glGetTextureParameteriv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), GLuint texture; GLenum pname; GLint *params;, (call->texture, call->pname, call->params))
+GL_PROC_SYNC_VOID(167, glDeleteTransformFeedbacksNV, (GLsizei n, const GLuint *ids), (n, ids), GLsizei n; const GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(168, glGetVertexAttribfvARB, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLuint index; GLenum pname; GLfloat *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC(169, GLvdpauSurfaceNV, glVDPAURegisterOutputSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames), const void *vdpSurface; GLenum target; GLsizei numTextureNames; const GLuint *textureNames;, (call->vdpSurface, call->target, call->numTextureNames, call->textureNames))
+GL_PROC_SYNC_VOID(170, glMatrixMultTransposefEXT, (GLenum mode, const GLfloat *m), (mode, m), GLenum mode; const GLfloat *m;, (call->mode, call->m))
+GL_PROC_ASYNC(171, glPushMatrix, (void), (), , ())
+GL_PROC_SYNC_VOID(172, glMultiTexCoord4fvARB, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(173, glDeleteProgram, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_SYNC(174, GLboolean, glAreTexturesResident, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences), GLsizei n; const GLuint *textures; GLboolean *residences;, (call->n, call->textures, call->residences))
+GL_PROC_ASYNC(175, glBufferAttachMemoryNV, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset), GLenum target; GLuint memory; GLuint64 offset;, (call->target, call->memory, call->offset))
+GL_PROC_SYNC(176, GLhandleARB, glCreateProgramObjectARB, (void), (), , ())
+GL_PROC_SYNC_VOID(177, glGetPathColorGenivNV, (GLenum color, GLenum pname, GLint *value), (color, pname, value), GLenum color; GLenum pname; GLint *value;, (call->color, call->pname, call->value))
+GL_PROC_SYNC_VOID(178, glWindowPos3fvARB, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(179, glInsertComponentEXT, (GLuint res, GLuint src, GLuint num), (res, src, num), GLuint res; GLuint src; GLuint num;, (call->res, call->src, call->num))
+GL_PROC_SYNC_VOID(180, glVertexAttrib2hvNV, (GLuint index, const GLhalfNV *v), (index, v), GLuint index; const GLhalfNV *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(181, glColorTableSGI, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalformat, width, format, type, table), GLenum target; GLenum internalformat; GLsizei width; GLenum format; GLenum type; const void *table;, (call->target, call->internalformat, call->width, call->format, call->type, call->table))
+GL_PROC_SYNC_VOID(182, glGetUniformui64vNV, (GLuint program, GLint location, GLuint64EXT *params), (program, location, params), GLuint program; GLint location; GLuint64EXT *params;, (call->program, call->location, call->params))
+GL_PROC_SYNC_VOID(183, glProgramUniformMatrix4x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(184, glProgramUniformMatrix4x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(185, glTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(186, glEvalCoord1d, (GLdouble u), (u), GLdouble u;, (call->u))
+GL_PROC_SYNC_VOID(187, glGetInternalformatSampleivNV, (GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei bufSize, GLint *params), (target, internalformat, samples, pname, bufSize, params), GLenum target; GLenum internalformat; GLsizei samples; GLenum pname; GLsizei bufSize; GLint *params;, (call->target, call->internalformat, call->samples, call->pname, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(188, glSharpenTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points), GLenum target; GLsizei n; const GLfloat *points;, (call->target, call->n, call->points))
+GL_PROC_SYNC_VOID(189, glGetLightiv, (GLenum light, GLenum pname, GLint *params), (light, pname, params), GLenum light; GLenum pname; GLint *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(190, glBinormal3fvEXT, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(191, glCreateFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLsizei n; GLuint *framebuffers;, (call->n, call->framebuffers))
+GL_PROC_ASYNC(192, glDepthRangefOES, (GLclampf n, GLclampf f), (n, f), GLclampf n; GLclampf f;, (call->n, call->f))
+GL_PROC_SYNC_VOID(193, glVertexAttrib4NsvARB, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(194, glResetMinmax, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(195, glDepthFunc, (GLenum func), (func), GLenum func;, (call->func))
+GL_PROC_SYNC_VOID(196, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length), GLuint shader; GLsizei count; const GLchar *const*string; const GLint *length;, (call->shader, call->count, call->string, call->length))
+GL_PROC_ASYNC(197, glBinormal3sEXT, (GLshort bx, GLshort by, GLshort bz), (bx, by, bz), GLshort bx; GLshort by; GLshort bz;, (call->bx, call->by, call->bz))
+GL_PROC_SYNC_VOID(198, glVertexAttrib2sv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC(199, GLboolean, glIsList, (GLuint list), (list), GLuint list;, (call->list))
+GL_PROC_SYNC(200, GLint, glGetAttribLocation, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_ASYNC(201, glWindowPos3i, (GLint x, GLint y, GLint z), (x, y, z), GLint x; GLint y; GLint z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(202, glUniform4ui64ARB, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (location, x, y, z, w), GLint location; GLuint64 x; GLuint64 y; GLuint64 z; GLuint64 w;, (call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(203, glProgramUniform4uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLuint v0; GLuint v1; GLuint v2; GLuint v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(204, glLabelObjectEXT, (GLenum type, GLuint object, GLsizei length, const GLchar *label), (type, object, length, label), GLenum type; GLuint object; GLsizei length; const GLchar *label;, (call->type, call->object, call->length, call->label))
+GL_PROC_ASYNC(205, glTexCoord3s, (GLshort s, GLshort t, GLshort r), (s, t, r), GLshort s; GLshort t; GLshort r;, (call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(206, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels), (x, y, width, height, format, type, pixels), GLint x; GLint y; GLsizei width; GLsizei height; GLenum format; GLenum type; GLvoid *pixels;, (call->x, call->y, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(207, glHintPGI, (GLenum target, GLint mode), (target, mode), GLenum target; GLint mode;, (call->target, call->mode))
+GL_PROC_SYNC(208, GLint, glGetUniformLocation, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_SYNC_VOID(209, glGetPixelMapxv, (GLenum map, GLint size, GLfixed *values), (map, size, values), GLenum map; GLint size; GLfixed *values;, (call->map, call->size, call->values))
+GL_PROC_SYNC_VOID(210, glNamedStringARB, (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string), (type, namelen, name, stringlen, string), GLenum type; GLint namelen; const GLchar *name; GLint stringlen; const GLchar *string;, (call->type, call->namelen, call->name, call->stringlen, call->string))
+GL_PROC_ASYNC(211, glTexCoord4s, (GLshort s, GLshort t, GLshort r, GLshort q), (s, t, r, q), GLshort s; GLshort t; GLshort r; GLshort q;, (call->s, call->t, call->r, call->q))
+GL_PROC_SYNC_VOID(212, glGetTrackMatrixivNV, (GLenum target, GLuint address, GLenum pname, GLint *params), (target, address, pname, params), GLenum target; GLuint address; GLenum pname; GLint *params;, (call->target, call->address, call->pname, call->params))
+GL_PROC_ASYNC(213, glProvokingVertex, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(214, glSpriteParameterfSGIX, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_ASYNC(215, glTexGenf, (GLenum coord, GLenum pname, GLfloat param), (coord, pname, param), GLenum coord; GLenum pname; GLfloat param;, (call->coord, call->pname, call->param))
+GL_PROC_ASYNC(216, glWindowPos3sMESA, (GLshort x, GLshort y, GLshort z), (x, y, z), GLshort x; GLshort y; GLshort z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(217, glVertex2xOES, (GLfixed x), (x), GLfixed x;, (call->x))
+GL_PROC_SYNC_VOID(218, glPathDashArrayNV, (GLuint path, GLsizei dashCount, const GLfloat *dashArray), (path, dashCount, dashArray), GLuint path; GLsizei dashCount; const GLfloat *dashArray;, (call->path, call->dashCount, call->dashArray))
+GL_PROC_ASYNC(219, glClearColorIiEXT, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha), GLint red; GLint green; GLint blue; GLint alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(220, glProgramUniform3ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(221, glGetActiveAtomicCounterBufferiv, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params), GLuint program; GLuint bufferIndex; GLenum pname; GLint *params;, (call->program, call->bufferIndex, call->pname, call->params))
+GL_PROC_SYNC_VOID(222, glVertexAttrib3fvARB, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_ASYNC(223, glVertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y), GLuint index; GLint x; GLint y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(224, glGetProgramEnvParameterdvARB, (GLenum target, GLuint index, GLdouble *params), (target, index, params), GLenum target; GLuint index; GLdouble *params;, (call->target, call->index, call->params))
+GL_PROC_ASYNC(225, glVertexAttribL1ui64ARB, (GLuint index, GLuint64EXT x), (index, x), GLuint index; GLuint64EXT x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(226, glGetPathTexGenfvNV, (GLenum texCoordSet, GLenum pname, GLfloat *value), (texCoordSet, pname, value), GLenum texCoordSet; GLenum pname; GLfloat *value;, (call->texCoordSet, call->pname, call->value))
+GL_PROC_ASYNC(227, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLint x; GLint y; GLsizei width; GLsizei height;, (call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(228, glColor3us, (GLushort red, GLushort green, GLushort blue), (red, green, blue), GLushort red; GLushort green; GLushort blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(229, glDrawRangeElementArrayATI, (GLenum mode, GLuint start, GLuint end, GLsizei count), (mode, start, end, count), GLenum mode; GLuint start; GLuint end; GLsizei count;, (call->mode, call->start, call->end, call->count))
+GL_PROC_SYNC_VOID(230, glConvolutionFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *image), (target, internalformat, width, height, format, type, image), GLenum target; GLenum internalformat; GLsizei width; GLsizei height; GLenum format; GLenum type; const GLvoid *image;, (call->target, call->internalformat, call->width, call->height, call->format, call->type, call->image))
+GL_PROC_SYNC(231, GLint, glPollInstrumentsSGIX, (GLint *marker_p), (marker_p), GLint *marker_p;, (call->marker_p))
+GL_PROC_SYNC_VOID(232, glSecondaryColor3usv, (const GLushort *v), (v), const GLushort *v;, (call->v))
+GL_PROC_ASYNC(233, glColor4fNormal3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, nx, ny, nz, x, y, z), GLfloat r; GLfloat g; GLfloat b; GLfloat a; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->r, call->g, call->b, call->a, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_ASYNC(234, glVertexStream2sATI, (GLenum stream, GLshort x, GLshort y), (stream, x, y), GLenum stream; GLshort x; GLshort y;, (call->stream, call->x, call->y))
+GL_PROC_ASYNC(235, glDrawArraysEXT, (GLenum mode, GLint first, GLsizei count), (mode, first, count), GLenum mode; GLint first; GLsizei count;, (call->mode, call->first, call->count))
+GL_PROC_SYNC_VOID(236, glColorSubTableEXT, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data), (target, start, count, format, type, data), GLenum target; GLsizei start; GLsizei count; GLenum format; GLenum type; const void *data;, (call->target, call->start, call->count, call->format, call->type, call->data))
+GL_PROC_SYNC_VOID(237, glSecondaryColor3bv, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_ASYNC(238, glEndTransformFeedbackNV, (void), (), , ())
+GL_PROC_ASYNC(239, glBindBufferRangeEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), GLenum target; GLuint index; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->target, call->index, call->buffer, call->offset, call->size))
+GL_PROC_SYNC_VOID(240, glPushGroupMarkerEXT, (GLsizei length, const GLchar *marker), (length, marker), GLsizei length; const GLchar *marker;, (call->length, call->marker))
+GL_PROC_ASYNC(241, glNamedRenderbufferStorageMultisample, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height), GLuint renderbuffer; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->samples, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(242, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), GLuint sampler; GLenum pname; GLfloat param;, (call->sampler, call->pname, call->param))
+GL_PROC_SYNC_VOID(243, glTexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords), GLenum type; const GLuint *coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(244, glMultiTexCoord4ivARB, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(245, glConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image), (target, internalformat, width, height, format, type, image), GLenum target; GLenum internalformat; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *image;, (call->target, call->internalformat, call->width, call->height, call->format, call->type, call->image))
+GL_PROC_SYNC_VOID(246, glGetConvolutionFilter, (GLenum target, GLenum format, GLenum type, GLvoid *image), (target, format, type, image), GLenum target; GLenum format; GLenum type; GLvoid *image;, (call->target, call->format, call->type, call->image))
+GL_PROC_SYNC_VOID(247, glGetProgramLocalParameterIivNV, (GLenum target, GLuint index, GLint *params), (target, index, params), GLenum target; GLuint index; GLint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(248, glUniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(249, glVertexAttrib3fvNV, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_ASYNC(250, glColor3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (r, g, b, x, y, z), GLfloat r; GLfloat g; GLfloat b; GLfloat x; GLfloat y; GLfloat z;, (call->r, call->g, call->b, call->x, call->y, call->z))
+GL_PROC_ASYNC(251, glColorMaterial, (GLenum face, GLenum mode), (face, mode), GLenum face; GLenum mode;, (call->face, call->mode))
+GL_PROC_SYNC(252, GLboolean, glIsRenderbuffer, (GLuint renderbuffer), (renderbuffer), GLuint renderbuffer;, (call->renderbuffer))
+GL_PROC_ASYNC(253, glColor4ub, (GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha), (red, green, blue, alpha), GLubyte red; GLubyte green; GLubyte blue; GLubyte alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(254, glDepthRangexOES, (GLfixed n, GLfixed f), (n, f), GLfixed n; GLfixed f;, (call->n, call->f))
+GL_PROC_SYNC_VOID(255, glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures), GLsizei n; const GLuint *textures;, (call->n, call->textures))
+GL_PROC_SYNC_VOID(256, glCompressedMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->imageSize, call->bits))
+GL_PROC_ASYNC(257, glPrimitiveRestartNV, (void), (), , ())
+GL_PROC_SYNC_VOID(258, glUniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(259, glNamedProgramLocalParameter4fvEXT, (GLuint program, GLenum target, GLuint index, const GLfloat *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; const GLfloat *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(260, glGetVertexAttribIuivEXT, (GLuint index, GLenum pname, GLuint *params), (index, pname, params), GLuint index; GLenum pname; GLuint *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC(261, GLuint, glAsyncCopyBufferSubDataNVX, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, fenceValueArray, readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size, signalSemaphoreCount, signalSemaphoreArray, signalValueArray), GLsizei waitSemaphoreCount; const GLuint *waitSemaphoreArray; const GLuint64 *fenceValueArray; GLuint readGpu; GLbitfield writeGpuMask; GLuint readBuffer; GLuint writeBuffer; GLintptr readOffset; GLintptr writeOffset; GLsizeiptr size; GLsizei signalSemaphoreCount; const GLuint *signalSemaphoreArray; const GLuint64 *signalValueArray;, (call->waitSemaphoreCount, call->waitSemaphoreArray, call->fenceValueArray, call->readGpu, call->writeGpuMask, call->readBuffer, call->writeBuffer, call->readOffset, call->writeOffset, call->size, call->signalSemaphoreCount, call->signalSemaphoreArray, call->signalValueArray))
+GL_PROC_SYNC_VOID(262, glPathColorGenNV, (GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs), (color, genMode, colorFormat, coeffs), GLenum color; GLenum genMode; GLenum colorFormat; const GLfloat *coeffs;, (call->color, call->genMode, call->colorFormat, call->coeffs))
+GL_PROC_SYNC_VOID(263, glGetTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; GLfloat *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(264, glVertexAttribI4bvEXT, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(265, glVertex3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(266, glGetnPolygonStippleARB, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern), GLsizei bufSize; GLubyte *pattern;, (call->bufSize, call->pattern))
+GL_PROC_SYNC_VOID(267, glProgramUniform1fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(268, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), GLenum face; GLenum sfail; GLenum dpfail; GLenum dppass;, (call->face, call->sfail, call->dpfail, call->dppass))
+GL_PROC_SYNC_VOID(269, glGetSynciv, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (sync, pname, bufSize, length, values), GLsync sync; GLenum pname; GLsizei bufSize; GLsizei *length; GLint *values;, (call->sync, call->pname, call->bufSize, call->length, call->values))
+GL_PROC_SYNC(270, GLenum, glCheckNamedFramebufferStatusEXT, (GLuint framebuffer, GLenum target), (framebuffer, target), GLuint framebuffer; GLenum target;, (call->framebuffer, call->target))
+GL_PROC_ASYNC(271, glUniform2i64NV, (GLint location, GLint64EXT x, GLint64EXT y), (location, x, y), GLint location; GLint64EXT x; GLint64EXT y;, (call->location, call->x, call->y))
+GL_PROC_ASYNC(272, glVertexAttrib4sNV, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), GLuint index; GLshort x; GLshort y; GLshort z; GLshort w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(273, glUniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(274, glProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLfloat v0; GLfloat v1; GLfloat v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_SYNC_VOID(275, glUniform3uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(276, glDeleteQueriesARB, (GLsizei n, const GLuint *ids), (n, ids), GLsizei n; const GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(277, glMultiTexCoord4svARB, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_ASYNC(278, glReplacementCodeuiNormal3fVertex3fSUN, (GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, nx, ny, nz, x, y, z), GLuint rc; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(279, glProgramUniformHandleui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values), GLuint program; GLint location; GLsizei count; const GLuint64 *values;, (call->program, call->location, call->count, call->values))
+GL_PROC_SYNC_VOID(280, glGetDoublev, (GLenum pname, GLdouble *params), (pname, params), GLenum pname; GLdouble *params;, (call->pname, call->params))
+GL_PROC_ASYNC(281, glTexCoord1xOES, (GLfixed s), (s), GLfixed s;, (call->s))
+GL_PROC_SYNC_VOID(282, glMultiTexCoord1sv, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_ASYNC(283, glLogicOp, (GLenum opcode), (opcode), GLenum opcode;, (call->opcode))
+GL_PROC_ASYNC(284, glVertexAttrib1s, (GLuint index, GLshort x), (index, x), GLuint index; GLshort x;, (call->index, call->x))
+GL_PROC_ASYNC(285, glLinkProgram, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_ASYNC(286, glIndexxOES, (GLfixed component), (component), GLfixed component;, (call->component))
+GL_PROC_SYNC_VOID(287, glProgramUniformMatrix3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC(288, GLboolean, glIsSync, (GLsync sync), (sync), GLsync sync;, (call->sync))
+GL_PROC_SYNC_VOID(289, glTexEnviv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(290, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(291, glVertexAttrib2fvNV, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_ASYNC(292, glPushClientAttribDefaultEXT, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_SYNC_VOID(293, glGetVariantPointervEXT, (GLuint id, GLenum value, void **data), (id, value, data), GLuint id; GLenum value; void **data;, (call->id, call->value, call->data))
+GL_PROC_ASYNC(294, glPolygonMode, (GLenum face, GLenum mode), (face, mode), GLenum face; GLenum mode;, (call->face, call->mode))
+GL_PROC_ASYNC(295, glMultiTexCoord3s, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r), GLenum target; GLshort s; GLshort t; GLshort r;, (call->target, call->s, call->t, call->r))
+GL_PROC_ASYNC(296, glMatrixScalefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z), GLenum mode; GLfloat x; GLfloat y; GLfloat z;, (call->mode, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(297, glProgramEnvParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLint *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(298, glGetnTexImageARB, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img), (target, level, format, type, bufSize, img), GLenum target; GLint level; GLenum format; GLenum type; GLsizei bufSize; void *img;, (call->target, call->level, call->format, call->type, call->bufSize, call->img))
+GL_PROC_SYNC_VOID(299, glVertexAttrib1svNV, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(300, glProgramUniformMatrix4x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(301, glVertexArrayVertexBuffer, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride), GLuint vaobj; GLuint bindingindex; GLuint buffer; GLintptr offset; GLsizei stride;, (call->vaobj, call->bindingindex, call->buffer, call->offset, call->stride))
+GL_PROC_ASYNC(302, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), GLenum face; GLenum func; GLint ref; GLuint mask;, (call->face, call->func, call->ref, call->mask))
+GL_PROC_SYNC(303, void *, glMapNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access), GLuint buffer; GLintptr offset; GLsizeiptr length; GLbitfield access;, (call->buffer, call->offset, call->length, call->access))
+GL_PROC_ASYNC(304, glAccumxOES, (GLenum op, GLfixed value), (op, value), GLenum op; GLfixed value;, (call->op, call->value))
+GL_PROC_SYNC_VOID(305, glMultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLenum texture; GLenum type; const GLuint *coords;, (call->texture, call->type, call->coords))
+GL_PROC_SYNC_VOID(306, glMatrixMultTransposedEXT, (GLenum mode, const GLdouble *m), (mode, m), GLenum mode; const GLdouble *m;, (call->mode, call->m))
+GL_PROC_ASYNC(307, glBeginQueryIndexed, (GLenum target, GLuint index, GLuint id), (target, index, id), GLenum target; GLuint index; GLuint id;, (call->target, call->index, call->id))
+GL_PROC_ASYNC(308, glVertexP3ui, (GLenum type, GLuint value), (type, value), GLenum type; GLuint value;, (call->type, call->value))
+GL_PROC_SYNC_VOID(309, glTexCoord3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(310, glVertexStream3dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z), (stream, x, y, z), GLenum stream; GLdouble x; GLdouble y; GLdouble z;, (call->stream, call->x, call->y, call->z))
+GL_PROC_ASYNC(311, glMultiTexCoord4dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q), GLenum target; GLdouble s; GLdouble t; GLdouble r; GLdouble q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_SYNC(312, GLenum, glCheckNamedFramebufferStatus, (GLuint framebuffer, GLenum target), (framebuffer, target), GLuint framebuffer; GLenum target;, (call->framebuffer, call->target))
+GL_PROC_SYNC_VOID(313, glCompressedTexImage3DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLsizei imageSize; const void *data;, (call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(314, glMapVertexAttrib1fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (index, size, u1, u2, stride, order, points), GLuint index; GLuint size; GLfloat u1; GLfloat u2; GLint stride; GLint order; const GLfloat *points;, (call->index, call->size, call->u1, call->u2, call->stride, call->order, call->points))
+GL_PROC_SYNC_VOID(315, glGetColorTableParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC(316, GLboolean, glIsOcclusionQueryNV, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(317, glVertexAttrib3hvNV, (GLuint index, const GLhalfNV *v), (index, v), GLuint index; const GLhalfNV *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(318, glSetMultisamplefvAMD, (GLenum pname, GLuint index, const GLfloat *val), (pname, index, val), GLenum pname; GLuint index; const GLfloat *val;, (call->pname, call->index, call->val))
+GL_PROC_ASYNC(319, glResolveDepthValuesNV, (void), (), , ())
+GL_PROC_ASYNC(320, glMultiDrawMeshTasksIndirectCountNV, (GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (indirect, drawcount, maxdrawcount, stride), GLintptr indirect; GLintptr drawcount; GLsizei maxdrawcount; GLsizei stride;, (call->indirect, call->drawcount, call->maxdrawcount, call->stride))
+GL_PROC_SYNC_VOID(321, glVertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(322, glCompressedMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, depth, border, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->imageSize, call->bits))
+GL_PROC_SYNC(323, GLboolean, glIsBufferResidentNV, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(324, glMultiTexCoord2bvOES, (GLenum texture, const GLbyte *coords), (texture, coords), GLenum texture; const GLbyte *coords;, (call->texture, call->coords))
+GL_PROC_ASYNC(325, glTexCoord1s, (GLshort s), (s), GLshort s;, (call->s))
+GL_PROC_ASYNC(326, glTexCoord2bOES, (GLbyte s, GLbyte t), (s, t), GLbyte s; GLbyte t;, (call->s, call->t))
+GL_PROC_SYNC_VOID(327, glGetQueryivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(328, glVertexAttribL2ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y), (index, x, y), GLuint index; GLuint64EXT x; GLuint64EXT y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(329, glVertexAttrib2hNV, (GLuint index, GLhalfNV x, GLhalfNV y), (index, x, y), GLuint index; GLhalfNV x; GLhalfNV y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(330, glMulticastScissorArrayvNVX, (GLuint gpu, GLuint first, GLsizei count, const GLint *v), (gpu, first, count, v), GLuint gpu; GLuint first; GLsizei count; const GLint *v;, (call->gpu, call->first, call->count, call->v))
+GL_PROC_SYNC(331, GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceWithPictureStructureNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames, GLboolean isFrameStructure), (vdpSurface, target, numTextureNames, textureNames, isFrameStructure), const void *vdpSurface; GLenum target; GLsizei numTextureNames; const GLuint *textureNames; GLboolean isFrameStructure;, (call->vdpSurface, call->target, call->numTextureNames, call->textureNames, call->isFrameStructure))
+GL_PROC_SYNC_VOID(332, glProgramUniform4i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(333, glMultiTexCoord3iv, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_ASYNC(334, glFramebufferTextureEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), GLenum target; GLenum attachment; GLuint texture; GLint level;, (call->target, call->attachment, call->texture, call->level))
+GL_PROC_ASYNC(335, glUniform1uiEXT, (GLint location, GLuint v0), (location, v0), GLint location; GLuint v0;, (call->location, call->v0))
+GL_PROC_SYNC_VOID(336, glImportMemoryWin32NameEXT, (GLuint memory, GLuint64 size, GLenum handleType, const void *name), (memory, size, handleType, name), GLuint memory; GLuint64 size; GLenum handleType; const void *name;, (call->memory, call->size, call->handleType, call->name))
+GL_PROC_ASYNC(337, glClearColor, (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha), (red, green, blue, alpha), GLclampf red; GLclampf green; GLclampf blue; GLclampf alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(338, glGenProgramsNV, (GLsizei n, GLuint *programs), (n, programs), GLsizei n; GLuint *programs;, (call->n, call->programs))
+GL_PROC_SYNC_VOID(339, glTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->xoffset, call->width, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(340, glUniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w), GLint location; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(341, glCopyMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, x, y, width, height), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(342, glGenBuffers, (GLsizei n, GLuint *buffers), (n, buffers), GLsizei n; GLuint *buffers;, (call->n, call->buffers))
+GL_PROC_ASYNC(343, glClientActiveTextureARB, (GLenum texture), (texture), GLenum texture;, (call->texture))
+GL_PROC_ASYNC(344, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), GLuint index; GLshort x; GLshort y; GLshort z; GLshort w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(345, glTexGendv, (GLenum coord, GLenum pname, const GLdouble *params), (coord, pname, params), GLenum coord; GLenum pname; const GLdouble *params;, (call->coord, call->pname, call->params))
+GL_PROC_ASYNC(346, glDrawElementArrayATI, (GLenum mode, GLsizei count), (mode, count), GLenum mode; GLsizei count;, (call->mode, call->count))
+GL_PROC_SYNC_VOID(347, glColor3fVertex3fvSUN, (const GLfloat *c, const GLfloat *v), (c, v), const GLfloat *c; const GLfloat *v;, (call->c, call->v))
+GL_PROC_SYNC_VOID(348, glUniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(349, glResetHistogram, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(350, glProgramParameters4fvNV, (GLenum target, GLuint index, GLsizei count, const GLfloat *v), (target, index, count, v), GLenum target; GLuint index; GLsizei count; const GLfloat *v;, (call->target, call->index, call->count, call->v))
+GL_PROC_ASYNC(351, glEndList, (void), (), , ())
+GL_PROC_ASYNC(352, glTexCoord1hNV, (GLhalfNV s), (s), GLhalfNV s;, (call->s))
+GL_PROC_ASYNC(353, glFragmentColorMaterialSGIX, (GLenum face, GLenum mode), (face, mode), GLenum face; GLenum mode;, (call->face, call->mode))
+GL_PROC_SYNC_VOID(354, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value), GLenum buffer; GLint drawbuffer; const GLfloat *value;, (call->buffer, call->drawbuffer, call->value))
+GL_PROC_SYNC_VOID(355, glColor4xvOES, (const GLfixed *components), (components), const GLfixed *components;, (call->components))
+GL_PROC_ASYNC(356, glEndQuery, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(357, glVertexAttribL3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLuint index; GLdouble x; GLdouble y; GLdouble z;, (call->index, call->x, call->y, call->z))
+GL_PROC_ASYNC(358, glBufferPageCommitmentARB, (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit), (target, offset, size, commit), GLenum target; GLintptr offset; GLsizeiptr size; GLboolean commit;, (call->target, call->offset, call->size, call->commit))
+GL_PROC_SYNC_VOID(359, glVariantubvEXT, (GLuint id, const GLubyte *addr), (id, addr), GLuint id; const GLubyte *addr;, (call->id, call->addr))
+GL_PROC_ASYNC(360, glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLint x; GLint y; GLsizei width; GLsizei height;, (call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(361, glGetnPixelMapusvARB, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLushort *values;, (call->map, call->bufSize, call->values))
+GL_PROC_ASYNC(362, glImageTransformParameterfHP, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLenum target; GLenum pname; GLfloat param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(363, glProgramUniformMatrix2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(364, glVertexAttribs4dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v), GLuint index; GLsizei count; const GLdouble *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(365, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->imageSize, call->data))
+GL_PROC_SYNC(366, GLenum, glGetGraphicsResetStatus, (void), (), , ())
+GL_PROC_SYNC_VOID(367, glWindowPos2dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(368, glVertex3bOES, (GLbyte x, GLbyte y, GLbyte z), (x, y, z), GLbyte x; GLbyte y; GLbyte z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(369, glMatrixRotatefEXT, (GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (mode, angle, x, y, z), GLenum mode; GLfloat angle; GLfloat x; GLfloat y; GLfloat z;, (call->mode, call->angle, call->x, call->y, call->z))
+GL_PROC_ASYNC(370, glMultiTexCoord4sARB, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q), GLenum target; GLshort s; GLshort t; GLshort r; GLshort q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_SYNC_VOID(371, glColorTableEXT, (GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalFormat, width, format, type, table), GLenum target; GLenum internalFormat; GLsizei width; GLenum format; GLenum type; const void *table;, (call->target, call->internalFormat, call->width, call->format, call->type, call->table))
+GL_PROC_SYNC_VOID(372, glVertexAttribI4usvEXT, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(373, glVertexAttrib4Niv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(374, glGetProgramParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params), GLenum target; GLuint index; GLenum pname; GLfloat *params;, (call->target, call->index, call->pname, call->params))
+GL_PROC_ASYNC(375, glMultiTexCoord3f, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r), GLenum target; GLfloat s; GLfloat t; GLfloat r;, (call->target, call->s, call->t, call->r))
+GL_PROC_ASYNC(376, glProgramUniform4ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (program, location, x, y, z, w), GLuint program; GLint location; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z; GLuint64EXT w;, (call->program, call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(377, glEvalCoord1f, (GLfloat u), (u), GLfloat u;, (call->u))
+GL_PROC_SYNC_VOID(378, glProgramUniform3fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(379, glProgramSubroutineParametersuivNV, (GLenum target, GLsizei count, const GLuint *params), (target, count, params), GLenum target; GLsizei count; const GLuint *params;, (call->target, call->count, call->params))
+GL_PROC_SYNC_VOID(380, glUniform1fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(381, glCommandListSegmentsNV, (GLuint list, GLuint segments), (list, segments), GLuint list; GLuint segments;, (call->list, call->segments))
+GL_PROC_ASYNC(382, glReplacementCodeubSUN, (GLubyte code), (code), GLubyte code;, (call->code))
+GL_PROC_ASYNC(383, glEnableIndexedEXT, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_ASYNC(384, glProgramUniformui64NV, (GLuint program, GLint location, GLuint64EXT value), (program, location, value), GLuint program; GLint location; GLuint64EXT value;, (call->program, call->location, call->value))
+GL_PROC_SYNC_VOID(385, glVertexAttrib3dvARB, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(386, glBlitFramebufferEXT, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLint srcX0; GLint srcY0; GLint srcX1; GLint srcY1; GLint dstX0; GLint dstY0; GLint dstX1; GLint dstY1; GLbitfield mask; GLenum filter;, (call->srcX0, call->srcY0, call->srcX1, call->srcY1, call->dstX0, call->dstY0, call->dstX1, call->dstY1, call->mask, call->filter))
+GL_PROC_SYNC_VOID(387, glUniform3ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(388, glReplacementCodeuiVertex3fvSUN, (const GLuint *rc, const GLfloat *v), (rc, v), const GLuint *rc; const GLfloat *v;, (call->rc, call->v))
+GL_PROC_SYNC_VOID(389, glUniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(390, glWindowPos3svMESA, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(391, glNamedProgramLocalParameterI4iEXT, (GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (program, target, index, x, y, z, w), GLuint program; GLenum target; GLuint index; GLint x; GLint y; GLint z; GLint w;, (call->program, call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(392, glWindowPos2sARB, (GLshort x, GLshort y), (x, y), GLshort x; GLshort y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(393, glCreateQueries, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids), GLenum target; GLsizei n; GLuint *ids;, (call->target, call->n, call->ids))
+GL_PROC_SYNC_VOID(394, glGetVertexAttribLdvEXT, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLuint index; GLenum pname; GLdouble *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(395, glVertexP3uiv, (GLenum type, const GLuint *value), (type, value), GLenum type; const GLuint *value;, (call->type, call->value))
+GL_PROC_SYNC_VOID(396, glDrawArraysIndirect, (GLenum mode, const void *indirect), (mode, indirect), GLenum mode; const void *indirect;, (call->mode, call->indirect))
+GL_PROC_SYNC_VOID(397, glDebugMessageCallbackARB, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam), GLDEBUGPROCARB callback; const void *userParam;, (call->callback, call->userParam))
+GL_PROC_ASYNC(398, glPopMatrix, (void), (), , ())
+GL_PROC_SYNC(399, GLhandleARB, glGetHandleARB, (GLenum pname), (pname), GLenum pname;, (call->pname))
+GL_PROC_SYNC_VOID(400, glDeleteNamedStringARB, (GLint namelen, const GLchar *name), (namelen, name), GLint namelen; const GLchar *name;, (call->namelen, call->name))
+GL_PROC_ASYNC(401, glEvalCoord1xOES, (GLfixed u), (u), GLfixed u;, (call->u))
+GL_PROC_ASYNC(402, glProvokingVertexEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(403, glMultiTexCoord1dARB, (GLenum target, GLdouble s), (target, s), GLenum target; GLdouble s;, (call->target, call->s))
+GL_PROC_SYNC_VOID(404, glGetListParameterfvSGIX, (GLuint list, GLenum pname, GLfloat *params), (list, pname, params), GLuint list; GLenum pname; GLfloat *params;, (call->list, call->pname, call->params))
+GL_PROC_SYNC_VOID(405, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei instancecount;, (call->mode, call->count, call->type, call->indices, call->instancecount))
+GL_PROC_ASYNC(406, glColorFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod), GLenum op; GLuint dst; GLuint dstMask; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod;, (call->op, call->dst, call->dstMask, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod))
+GL_PROC_SYNC_VOID(407, glVariantbvEXT, (GLuint id, const GLbyte *addr), (id, addr), GLuint id; const GLbyte *addr;, (call->id, call->addr))
+GL_PROC_SYNC_VOID(408, glVertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(409, glPixelMapusv, (GLenum map, GLsizei mapsize, const GLushort *values), (map, mapsize, values), GLenum map; GLsizei mapsize; const GLushort *values;, (call->map, call->mapsize, call->values))
+GL_PROC_ASYNC(410, glBindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride), GLuint bindingindex; GLuint buffer; GLintptr offset; GLsizei stride;, (call->bindingindex, call->buffer, call->offset, call->stride))
+GL_PROC_SYNC_VOID(411, glWeightPathsNV, (GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights), (resultPath, numPaths, paths, weights), GLuint resultPath; GLsizei numPaths; const GLuint *paths; const GLfloat *weights;, (call->resultPath, call->numPaths, call->paths, call->weights))
+GL_PROC_ASYNC(412, glEndVertexShaderEXT, (void), (), , ())
+GL_PROC_SYNC_VOID(413, glSpecializeShaderARB, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), GLuint shader; const GLchar *pEntryPoint; GLuint numSpecializationConstants; const GLuint *pConstantIndex; const GLuint *pConstantValue;, (call->shader, call->pEntryPoint, call->numSpecializationConstants, call->pConstantIndex, call->pConstantValue))
+GL_PROC_ASYNC(414, glDepthRangedNV, (GLdouble zNear, GLdouble zFar), (zNear, zFar), GLdouble zNear; GLdouble zFar;, (call->zNear, call->zFar))
+GL_PROC_ASYNC(415, glPixelTransferf, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(416, glBindAttribLocationARB, (GLhandleARB programObj, GLuint index, const GLcharARB *name), (programObj, index, name), GLhandleARB programObj; GLuint index; const GLcharARB *name;, (call->programObj, call->index, call->name))
+GL_PROC_SYNC_VOID(417, glGetnUniformfv, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLfloat *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(418, glMultiTexCoord4xvOES, (GLenum texture, const GLfixed *coords), (texture, coords), GLenum texture; const GLfixed *coords;, (call->texture, call->coords))
+GL_PROC_ASYNC(419, glShaderOp2EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2), (op, res, arg1, arg2), GLenum op; GLuint res; GLuint arg1; GLuint arg2;, (call->op, call->res, call->arg1, call->arg2))
+GL_PROC_ASYNC(420, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y), GLuint index; GLuint x; GLuint y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(421, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), GLenum readTarget; GLenum writeTarget; GLintptr readOffset; GLintptr writeOffset; GLsizeiptr size;, (call->readTarget, call->writeTarget, call->readOffset, call->writeOffset, call->size))
+GL_PROC_SYNC_VOID(422, glWindowPos3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(423, glTexEnvf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLenum target; GLenum pname; GLfloat param;, (call->target, call->pname, call->param))
+GL_PROC_ASYNC(424, glVertexAttrib3fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), GLuint index; GLfloat x; GLfloat y; GLfloat z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(425, glGetPerfMonitorGroupsAMD, (GLint *numGroups, GLsizei groupsSize, GLuint *groups), (numGroups, groupsSize, groups), GLint *numGroups; GLsizei groupsSize; GLuint *groups;, (call->numGroups, call->groupsSize, call->groups))
+GL_PROC_SYNC(426, GLboolean, glIsMemoryObjectEXT, (GLuint memoryObject), (memoryObject), GLuint memoryObject;, (call->memoryObject))
+GL_PROC_SYNC(427, GLuint, glBindMaterialParameterEXT, (GLenum face, GLenum value), (face, value), GLenum face; GLenum value;, (call->face, call->value))
+GL_PROC_SYNC_VOID(428, glColor4iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(429, glGetPathCoordsNV, (GLuint path, GLfloat *coords), (path, coords), GLuint path; GLfloat *coords;, (call->path, call->coords))
+GL_PROC_SYNC_VOID(430, glRasterPos4dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(431, glGetIntegerui64i_vNV, (GLenum value, GLuint index, GLuint64EXT *result), (value, index, result), GLenum value; GLuint index; GLuint64EXT *result;, (call->value, call->index, call->result))
+GL_PROC_SYNC_VOID(432, glPrioritizeTextures, (GLsizei n, const GLuint *textures, const GLclampf *priorities), (n, textures, priorities), GLsizei n; const GLuint *textures; const GLclampf *priorities;, (call->n, call->textures, call->priorities))
+GL_PROC_SYNC_VOID(433, glVertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(434, glVertexStream2fvATI, (GLenum stream, const GLfloat *coords), (stream, coords), GLenum stream; const GLfloat *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(435, glTrackMatrixNV, (GLenum target, GLuint address, GLenum matrix, GLenum transform), (target, address, matrix, transform), GLenum target; GLuint address; GLenum matrix; GLenum transform;, (call->target, call->address, call->matrix, call->transform))
+GL_PROC_SYNC_VOID(436, glGetnMapfv, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLfloat *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_ASYNC(437, glMakeNamedBufferNonResidentNV, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_ASYNC(438, glPixelTexGenSGIX, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(439, glVertex4bOES, (GLbyte x, GLbyte y, GLbyte z, GLbyte w), (x, y, z, w), GLbyte x; GLbyte y; GLbyte z; GLbyte w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(440, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLuint id; GLenum pname; GLint *params;, (call->id, call->pname, call->params))
+GL_PROC_ASYNC(441, glProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), GLuint program; GLint location; GLfloat v0; GLfloat v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC_CLIENT_ARRAY(442, glIndexPointer, (GLenum type, GLsizei stride, const GLvoid *ptr), (type, stride, ptr), GLenum type; GLsizei stride; const GLvoid *ptr;, (call->type, call->stride, call->ptr))
+GL_PROC_SYNC_VOID(443, glGetInvariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data), GLuint id; GLenum value; GLfloat *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(444, glGetMapxvOES, (GLenum target, GLenum query, GLfixed *v), (target, query, v), GLenum target; GLenum query; GLfixed *v;, (call->target, call->query, call->v))
+GL_PROC_ASYNC(445, glDeleteShader, (GLuint shader), (shader), GLuint shader;, (call->shader))
+GL_PROC_ASYNC(446, glBlendEquationSeparateATI, (GLenum modeRGB, GLenum modeA), (modeRGB, modeA), GLenum modeRGB; GLenum modeA;, (call->modeRGB, call->modeA))
+GL_PROC_ASYNC(447, glClearIndex, (GLfloat c), (c), GLfloat c;, (call->c))
+GL_PROC_ASYNC(448, glMultiTexParameteriEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param), GLenum texunit; GLenum target; GLenum pname; GLint param;, (call->texunit, call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(449, glGetBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data), (target, offset, size, data), GLenum target; GLintptrARB offset; GLsizeiptrARB size; void *data;, (call->target, call->offset, call->size, call->data))
+GL_PROC_ASYNC(450, glDeleteAsyncMarkersSGIX, (GLuint marker, GLsizei range), (marker, range), GLuint marker; GLsizei range;, (call->marker, call->range))
+GL_PROC_SYNC_VOID(451, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(452, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLuint sampler; GLenum pname; GLint *params;, (call->sampler, call->pname, call->params))
+GL_PROC_ASYNC(453, glFlushPixelDataRangeNV, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(454, glMultiTexCoord1svARB, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(455, glProgramUniformMatrix3x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(456, glGetVertexAttribdvNV, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLuint index; GLenum pname; GLdouble *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(457, glGetBufferParameterui64vNV, (GLenum target, GLenum pname, GLuint64EXT *params), (target, pname, params), GLenum target; GLenum pname; GLuint64EXT *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(458, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; const GLuint *value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(459, glTexCoord2sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(460, glMultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLenum texture; GLenum type; const GLuint *coords;, (call->texture, call->type, call->coords))
+GL_PROC_ASYNC(461, glQueryObjectParameteruiAMD, (GLenum target, GLuint id, GLenum pname, GLuint param), (target, id, pname, param), GLenum target; GLuint id; GLenum pname; GLuint param;, (call->target, call->id, call->pname, call->param))
+GL_PROC_ASYNC(462, glProgramEnvParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w), GLenum target; GLuint index; GLuint x; GLuint y; GLuint z; GLuint w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(463, glDrawCommandsAddressNV, (GLenum primitiveMode, const GLuint64 *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, indirects, sizes, count), GLenum primitiveMode; const GLuint64 *indirects; const GLsizei *sizes; GLuint count;, (call->primitiveMode, call->indirects, call->sizes, call->count))
+GL_PROC_SYNC_VOID(464, glMultiDrawElementsIndirectBindlessNV, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, stride, vertexBufferCount), GLenum mode; GLenum type; const void *indirect; GLsizei drawCount; GLsizei stride; GLint vertexBufferCount;, (call->mode, call->type, call->indirect, call->drawCount, call->stride, call->vertexBufferCount))
+GL_PROC_SYNC_VOID(465, glReferencePlaneSGIX, (const GLdouble *equation), (equation), const GLdouble *equation;, (call->equation))
+GL_PROC_ASYNC(466, glBeginFragmentShaderATI, (void), (), , ())
+GL_PROC_SYNC_VOID(467, glGetMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLfloat *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(468, glProgramParameter4fvNV, (GLenum target, GLuint index, const GLfloat *v), (target, index, v), GLenum target; GLuint index; const GLfloat *v;, (call->target, call->index, call->v))
+GL_PROC_ASYNC(469, glCopyConvolutionFilter1D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width;, (call->target, call->internalformat, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(470, glGetTransformFeedbackiv, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param), GLuint xfb; GLenum pname; GLint *param;, (call->xfb, call->pname, call->param))
+GL_PROC_SYNC_VOID(471, glCreateTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC(472, void *, glMapBuffer, (GLenum target, GLenum access), (target, access), GLenum target; GLenum access;, (call->target, call->access))
+GL_PROC_SYNC_VOID(473, glVertexStream1ivATI, (GLenum stream, const GLint *coords), (stream, coords), GLenum stream; const GLint *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(474, glGetMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; GLdouble *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(475, glGetnUniformdv, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLdouble *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_ASYNC(476, glWindowPos4dMESA, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w), GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(477, glGlobalAlphaFactordSUN, (GLdouble factor), (factor), GLdouble factor;, (call->factor))
+GL_PROC_ASYNC(478, glTextureLightEXT, (GLenum pname), (pname), GLenum pname;, (call->pname))
+GL_PROC_ASYNC(479, glNormalStream3bATI, (GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz), (stream, nx, ny, nz), GLenum stream; GLbyte nx; GLbyte ny; GLbyte nz;, (call->stream, call->nx, call->ny, call->nz))
+GL_PROC_ASYNC(480, glVertex2i, (GLint x, GLint y), (x, y), GLint x; GLint y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(481, glLoadTransposeMatrixdARB, (const GLdouble *m), (m), const GLdouble *m;, (call->m))
+GL_PROC_ASYNC(482, glDeleteSync, (GLsync sync), (sync), GLsync sync;, (call->sync))
+GL_PROC_ASYNC(483, glRectf, (GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2), (x1, y1, x2, y2), GLfloat x1; GLfloat y1; GLfloat x2; GLfloat y2;, (call->x1, call->y1, call->x2, call->y2))
+GL_PROC_ASYNC(484, glClampColor, (GLenum target, GLenum clamp), (target, clamp), GLenum target; GLenum clamp;, (call->target, call->clamp))
+GL_PROC_ASYNC(485, glVertexWeighthNV, (GLhalfNV weight), (weight), GLhalfNV weight;, (call->weight))
+GL_PROC_SYNC_VOID(486, glTexCoord2fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *n, const GLfloat *v), (tc, n, v), const GLfloat *tc; const GLfloat *n; const GLfloat *v;, (call->tc, call->n, call->v))
+GL_PROC_SYNC(487, GLboolean, glIsBuffer, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_ASYNC(488, glVertexArrayVertexAttribDivisorEXT, (GLuint vaobj, GLuint index, GLuint divisor), (vaobj, index, divisor), GLuint vaobj; GLuint index; GLuint divisor;, (call->vaobj, call->index, call->divisor))
+GL_PROC_SYNC_VOID(489, glGetQueryObjectui64vEXT, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params), GLuint id; GLenum pname; GLuint64 *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(490, glVertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC(491, GLuint, glNewObjectBufferATI, (GLsizei size, const void *pointer, GLenum usage), (size, pointer, usage), GLsizei size; const void *pointer; GLenum usage;, (call->size, call->pointer, call->usage))
+GL_PROC_SYNC_VOID(492, glMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(493, glGetUniformui64vARB, (GLuint program, GLint location, GLuint64 *params), (program, location, params), GLuint program; GLint location; GLuint64 *params;, (call->program, call->location, call->params))
+GL_PROC_SYNC_VOID(494, glMultiDrawArraysIndirect, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride), GLenum mode; const void *indirect; GLsizei drawcount; GLsizei stride;, (call->mode, call->indirect, call->drawcount, call->stride))
+GL_PROC_ASYNC(495, glProgramUniform2ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y), (program, location, x, y), GLuint program; GLint location; GLuint64 x; GLuint64 y;, (call->program, call->location, call->x, call->y))
+GL_PROC_ASYNC(496, glSecondaryColor3d, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue), GLdouble red; GLdouble green; GLdouble blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(497, glGetPerfMonitorCountersAMD, (GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters), (group, numCounters, maxActiveCounters, counterSize, counters), GLuint group; GLint *numCounters; GLint *maxActiveCounters; GLsizei counterSize; GLuint *counters;, (call->group, call->numCounters, call->maxActiveCounters, call->counterSize, call->counters))
+GL_PROC_ASYNC(498, glDepthBoundsEXT, (GLclampd zmin, GLclampd zmax), (zmin, zmax), GLclampd zmin; GLclampd zmax;, (call->zmin, call->zmax))
+GL_PROC_ASYNC(499, glWindowPos3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(500, glGetFragmentMaterialivSGIX, (GLenum face, GLenum pname, GLint *params), (face, pname, params), GLenum face; GLenum pname; GLint *params;, (call->face, call->pname, call->params))
+GL_PROC_SYNC_VOID(501, glFeedbackBufferxOES, (GLsizei n, GLenum type, const GLfixed *buffer), (n, type, buffer), GLsizei n; GLenum type; const GLfixed *buffer;, (call->n, call->type, call->buffer))
+GL_PROC_ASYNC(502, glProgramUniform2i, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), GLuint program; GLint location; GLint v0; GLint v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC(503, void *, glMapBufferARB, (GLenum target, GLenum access), (target, access), GLenum target; GLenum access;, (call->target, call->access))
+GL_PROC_SYNC_VOID(504, glVertexWeighthvNV, (const GLhalfNV *weight), (weight), const GLhalfNV *weight;, (call->weight))
+GL_PROC_ASYNC(505, glCopyConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->internalformat, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(506, glInstrumentsBufferSGIX, (GLsizei size, GLint *buffer), (size, buffer), GLsizei size; GLint *buffer;, (call->size, call->buffer))
+GL_PROC_SYNC_VOID(507, glGetVertexAttribArrayObjectivATI, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(508, glVertexArrayElementBuffer, (GLuint vaobj, GLuint buffer), (vaobj, buffer), GLuint vaobj; GLuint buffer;, (call->vaobj, call->buffer))
+GL_PROC_SYNC_VOID(509, glGenFramebuffersEXT, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLsizei n; GLuint *framebuffers;, (call->n, call->framebuffers))
+GL_PROC_ASYNC(510, glColor4b, (GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha), (red, green, blue, alpha), GLbyte red; GLbyte green; GLbyte blue; GLbyte alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(511, glMultiTexCoord1d, (GLenum target, GLdouble s), (target, s), GLenum target; GLdouble s;, (call->target, call->s))
+GL_PROC_ASYNC(512, glSecondaryColorP3ui, (GLenum type, GLuint color), (type, color), GLenum type; GLuint color;, (call->type, call->color))
+GL_PROC_SYNC_VOID(513, glGetPathMetricsNV, (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics), (metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics), GLbitfield metricQueryMask; GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLsizei stride; GLfloat *metrics;, (call->metricQueryMask, call->numPaths, call->pathNameType, call->paths, call->pathBase, call->stride, call->metrics))
+GL_PROC_SYNC_VOID(514, glGetTexGenfv, (GLenum coord, GLenum pname, GLfloat *params), (coord, pname, params), GLenum coord; GLenum pname; GLfloat *params;, (call->coord, call->pname, call->params))
+GL_PROC_ASYNC(515, glGenerateMipmapEXT, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(516, glDrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream), GLenum mode; GLuint id; GLuint stream;, (call->mode, call->id, call->stream))
+GL_PROC_SYNC_VOID(517, glColorP4uiv, (GLenum type, const GLuint *color), (type, color), GLenum type; const GLuint *color;, (call->type, call->color))
+GL_PROC_SYNC_VOID(518, glVertexAttrib4iv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(519, glVertexStream3fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z), (stream, x, y, z), GLenum stream; GLfloat x; GLfloat y; GLfloat z;, (call->stream, call->x, call->y, call->z))
+GL_PROC_ASYNC(520, glListParameteriSGIX, (GLuint list, GLenum pname, GLint param), (list, pname, param), GLuint list; GLenum pname; GLint param;, (call->list, call->pname, call->param))
+GL_PROC_ASYNC(521, glTexCoord4i, (GLint s, GLint t, GLint r, GLint q), (s, t, r, q), GLint s; GLint t; GLint r; GLint q;, (call->s, call->t, call->r, call->q))
+GL_PROC_SYNC_VOID(522, glCreateSamplers, (GLsizei n, GLuint *samplers), (n, samplers), GLsizei n; GLuint *samplers;, (call->n, call->samplers))
+GL_PROC_SYNC_VOID(523, glMultiTexCoord1fvARB, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(524, glSeparableFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column), (target, internalformat, width, height, format, type, row, column), GLenum target; GLenum internalformat; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *row; const void *column;, (call->target, call->internalformat, call->width, call->height, call->format, call->type, call->row, call->column))
+GL_PROC_ASYNC(525, glBlendFuncSeparateIndexedAMD, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha), GLuint buf; GLenum srcRGB; GLenum dstRGB; GLenum srcAlpha; GLenum dstAlpha;, (call->buf, call->srcRGB, call->dstRGB, call->srcAlpha, call->dstAlpha))
+GL_PROC_ASYNC(526, glRenderbufferStorageMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->samples, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(527, glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z), GLuint num_groups_x; GLuint num_groups_y; GLuint num_groups_z;, (call->num_groups_x, call->num_groups_y, call->num_groups_z))
+GL_PROC_ASYNC(528, glBindProgramARB, (GLenum target, GLuint program), (target, program), GLenum target; GLuint program;, (call->target, call->program))
+GL_PROC_SYNC_VOID(529, glGetTextureImageEXT, (GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texture, target, level, format, type, pixels), GLuint texture; GLenum target; GLint level; GLenum format; GLenum type; void *pixels;, (call->texture, call->target, call->level, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(530, glMatrixMultfEXT, (GLenum mode, const GLfloat *m), (mode, m), GLenum mode; const GLfloat *m;, (call->mode, call->m))
+GL_PROC_ASYNC(531, glEndConditionalRenderNVX, (void), (), , ())
+GL_PROC_ASYNC(532, glProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLfloat v0; GLfloat v1; GLfloat v2; GLfloat v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(533, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(534, glResumeTransformFeedback, (void), (), , ())
+GL_PROC_SYNC_VOID(535, glProgramUniformMatrix2x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(536, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), GLenum target; GLenum attachment; GLuint texture; GLint level;, (call->target, call->attachment, call->texture, call->level))
+GL_PROC_ASYNC(537, glFlush, (void), (), , ())
+GL_PROC_SYNC_VOID(538, glSecondaryColor3usvEXT, (const GLushort *v), (v), const GLushort *v;, (call->v))
+GL_PROC_SYNC_VOID(539, glGetObjectParameterivAPPLE, (GLenum objectType, GLuint name, GLenum pname, GLint *params), (objectType, name, pname, params), GLenum objectType; GLuint name; GLenum pname; GLint *params;, (call->objectType, call->name, call->pname, call->params))
+GL_PROC_SYNC_VOID(540, glUniform3i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(541, glCreateBuffers, (GLsizei n, GLuint *buffers), (n, buffers), GLsizei n; GLuint *buffers;, (call->n, call->buffers))
+GL_PROC_SYNC_VOID(542, glGetColorTableEXT, (GLenum target, GLenum format, GLenum type, void *data), (target, format, type, data), GLenum target; GLenum format; GLenum type; void *data;, (call->target, call->format, call->type, call->data))
+GL_PROC_ASYNC(543, glIndexMask, (GLuint mask), (mask), GLuint mask;, (call->mask))
+GL_PROC_SYNC_VOID(544, glColor4hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(545, glFinishFenceNV, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(546, glTexGenfv, (GLenum coord, GLenum pname, const GLfloat *params), (coord, pname, params), GLenum coord; GLenum pname; const GLfloat *params;, (call->coord, call->pname, call->params))
+GL_PROC_SYNC(547, GLuint64, glGetTextureSamplerHandleNV, (GLuint texture, GLuint sampler), (texture, sampler), GLuint texture; GLuint sampler;, (call->texture, call->sampler))
+GL_PROC_SYNC_VOID(548, glFogCoordhvNV, (const GLhalfNV *fog), (fog), const GLhalfNV *fog;, (call->fog))
+GL_PROC_SYNC_VOID(549, glDeleteQueryResourceTagNV, (GLsizei n, const GLint *tagIds), (n, tagIds), GLsizei n; const GLint *tagIds;, (call->n, call->tagIds))
+GL_PROC_SYNC_CLIENT_ARRAY(550, glVertexAttribLPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLuint index; GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(551, glColor3xvOES, (const GLfixed *components), (components), const GLfixed *components;, (call->components))
+GL_PROC_SYNC_VOID(552, glMemoryObjectParameterivEXT, (GLuint memoryObject, GLenum pname, const GLint *params), (memoryObject, pname, params), GLuint memoryObject; GLenum pname; const GLint *params;, (call->memoryObject, call->pname, call->params))
+GL_PROC_SYNC_VOID(553, glGetCompressedTextureImageEXT, (GLuint texture, GLenum target, GLint lod, void *img), (texture, target, lod, img), GLuint texture; GLenum target; GLint lod; void *img;, (call->texture, call->target, call->lod, call->img))
+GL_PROC_ASYNC(554, glPolygonOffsetxOES, (GLfixed factor, GLfixed units), (factor, units), GLfixed factor; GLfixed units;, (call->factor, call->units))
+GL_PROC_SYNC_CLIENT_ARRAY(555, glNormalPointer, (GLenum type, GLsizei stride, const GLvoid *ptr), (type, stride, ptr), GLenum type; GLsizei stride; const GLvoid *ptr;, (call->type, call->stride, call->ptr))
+GL_PROC_SYNC_VOID(556, glVertexAttribI4ivEXT, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(557, glMultiTexCoord2fARB, (GLenum target, GLfloat s, GLfloat t), (target, s, t), GLenum target; GLfloat s; GLfloat t;, (call->target, call->s, call->t))
+GL_PROC_SYNC(558, GLint, glGetFragDataLocation, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_SYNC_VOID(559, glVertexArrayRangeAPPLE, (GLsizei length, void *pointer), (length, pointer), GLsizei length; void *pointer;, (call->length, call->pointer))
+GL_PROC_SYNC(560, GLsync, glImportSyncEXT, (GLenum external_sync_type, GLintptr external_sync, GLbitfield flags), (external_sync_type, external_sync, flags), GLenum external_sync_type; GLintptr external_sync; GLbitfield flags;, (call->external_sync_type, call->external_sync, call->flags))
+GL_PROC_SYNC_VOID(561, glUniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(562, glAccum, (GLenum op, GLfloat value), (op, value), GLenum op; GLfloat value;, (call->op, call->value))
+GL_PROC_ASYNC(563, glEnableVertexAttribArrayARB, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_SYNC_VOID(564, glGetTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; GLsizei bufSize; void *pixels;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->bufSize, call->pixels))
+GL_PROC_ASYNC(565, glTessellationFactorAMD, (GLfloat factor), (factor), GLfloat factor;, (call->factor))
+GL_PROC_SYNC_VOID(566, glGetMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum types, GLvoid *values), (target, reset, format, types, values), GLenum target; GLboolean reset; GLenum format; GLenum types; GLvoid *values;, (call->target, call->reset, call->format, call->types, call->values))
+GL_PROC_SYNC_VOID(567, glUniform4dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLint location; GLsizei count; const GLdouble *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(568, glPathGlyphsNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale), GLuint firstPathName; GLenum fontTarget; const void *fontName; GLbitfield fontStyle; GLsizei numGlyphs; GLenum type; const void *charcodes; GLenum handleMissingGlyphs; GLuint pathParameterTemplate; GLfloat emScale;, (call->firstPathName, call->fontTarget, call->fontName, call->fontStyle, call->numGlyphs, call->type, call->charcodes, call->handleMissingGlyphs, call->pathParameterTemplate, call->emScale))
+GL_PROC_SYNC_VOID(569, glGetTexGendv, (GLenum coord, GLenum pname, GLdouble *params), (coord, pname, params), GLenum coord; GLenum pname; GLdouble *params;, (call->coord, call->pname, call->params))
+GL_PROC_ASYNC(570, glProgramUniform2iEXT, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), GLuint program; GLint location; GLint v0; GLint v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC_VOID(571, glVertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(572, glScissorArrayv, (GLuint first, GLsizei count, const GLint *v), (first, count, v), GLuint first; GLsizei count; const GLint *v;, (call->first, call->count, call->v))
+GL_PROC_SYNC_VOID(573, glColor3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(574, glTexCoord1dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(575, glGetVariantArrayObjectfvATI, (GLuint id, GLenum pname, GLfloat *params), (id, pname, params), GLuint id; GLenum pname; GLfloat *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(576, glVertexAttribI4ubvEXT, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_ASYNC(577, glTexCoord2fColor4fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, nx, ny, nz, x, y, z), GLfloat s; GLfloat t; GLfloat r; GLfloat g; GLfloat b; GLfloat a; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->s, call->t, call->r, call->g, call->b, call->a, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(578, glConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image), (target, internalformat, width, format, type, image), GLenum target; GLenum internalformat; GLsizei width; GLenum format; GLenum type; const void *image;, (call->target, call->internalformat, call->width, call->format, call->type, call->image))
+GL_PROC_ASYNC(579, glMultiTexGendEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble param), (texunit, coord, pname, param), GLenum texunit; GLenum coord; GLenum pname; GLdouble param;, (call->texunit, call->coord, call->pname, call->param))
+GL_PROC_ASYNC(580, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), GLuint index; GLint x; GLint y; GLint z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_CLIENT_ARRAY(581, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLuint index; GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(582, glGetProgramResourcefvNV, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLfloat *params), (program, programInterface, index, propCount, props, bufSize, length, params), GLuint program; GLenum programInterface; GLuint index; GLsizei propCount; const GLenum *props; GLsizei bufSize; GLsizei *length; GLfloat *params;, (call->program, call->programInterface, call->index, call->propCount, call->props, call->bufSize, call->length, call->params))
+GL_PROC_SYNC_VOID(583, glGetMapdv, (GLenum target, GLenum query, GLdouble *v), (target, query, v), GLenum target; GLenum query; GLdouble *v;, (call->target, call->query, call->v))
+GL_PROC_ASYNC(584, glProgramUniform3ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (program, location, x, y, z), GLuint program; GLint location; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z;, (call->program, call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(585, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), GLint location; GLfloat v0; GLfloat v1;, (call->location, call->v0, call->v1))
+GL_PROC_ASYNC(586, glCopyTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, zoffset, x, y, width, height), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC(587, GLint, glGetFragDataLocationEXT, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_ASYNC(588, glPolygonOffsetClamp, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp), GLfloat factor; GLfloat units; GLfloat clamp;, (call->factor, call->units, call->clamp))
+GL_PROC_SYNC_VOID(589, glGetVertexAttribivNV, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(590, glNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data), GLuint buffer; GLintptr offset; GLsizeiptr size; const void *data;, (call->buffer, call->offset, call->size, call->data))
+GL_PROC_ASYNC(591, glMultiTexCoord4hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (target, s, t, r, q), GLenum target; GLhalfNV s; GLhalfNV t; GLhalfNV r; GLhalfNV q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(592, glLinkProgramARB, (GLhandleARB programObj), (programObj), GLhandleARB programObj;, (call->programObj))
+GL_PROC_SYNC_CLIENT_ARRAY(593, glTexCoordPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer), GLint size; GLenum type; GLsizei stride; GLsizei count; const void *pointer;, (call->size, call->type, call->stride, call->count, call->pointer))
+GL_PROC_SYNC_VOID(594, glVertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(595, glGetCoverageModulationTableNV, (GLsizei bufsize, GLfloat *v), (bufsize, v), GLsizei bufsize; GLfloat *v;, (call->bufsize, call->v))
+GL_PROC_SYNC_VOID(596, glVertexAttribs4ubvNV, (GLuint index, GLsizei count, const GLubyte *v), (index, count, v), GLuint index; GLsizei count; const GLubyte *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(597, glVertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_ASYNC(598, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), GLint location; GLuint v0; GLuint v1; GLuint v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(599, glBindBufferBaseNV, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), GLenum target; GLuint index; GLuint buffer;, (call->target, call->index, call->buffer))
+GL_PROC_SYNC_VOID(600, glVertexAttribL4i64vNV, (GLuint index, const GLint64EXT *v), (index, v), GLuint index; const GLint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(601, glWindowRectanglesEXT, (GLenum mode, GLsizei count, const GLint *box), (mode, count, box), GLenum mode; GLsizei count; const GLint *box;, (call->mode, call->count, call->box))
+GL_PROC_ASYNC(602, glVertexAttribI1uiEXT, (GLuint index, GLuint x), (index, x), GLuint index; GLuint x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(603, glVertexAttrib1hvNV, (GLuint index, const GLhalfNV *v), (index, v), GLuint index; const GLhalfNV *v;, (call->index, call->v))
+GL_PROC_ASYNC(604, glVertexAttrib3fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), GLuint index; GLfloat x; GLfloat y; GLfloat z;, (call->index, call->x, call->y, call->z))
+GL_PROC_ASYNC(605, glUnmapObjectBufferATI, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC_VOID(606, glShadingRateImagePaletteNV, (GLuint viewport, GLuint first, GLsizei count, const GLenum *rates), (viewport, first, count, rates), GLuint viewport; GLuint first; GLsizei count; const GLenum *rates;, (call->viewport, call->first, call->count, call->rates))
+GL_PROC_SYNC_VOID(607, glGetInternalformativ, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params), (target, internalformat, pname, bufSize, params), GLenum target; GLenum internalformat; GLenum pname; GLsizei bufSize; GLint *params;, (call->target, call->internalformat, call->pname, call->bufSize, call->params))
+GL_PROC_ASYNC(608, glBlendColorEXT, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLfloat red; GLfloat green; GLfloat blue; GLfloat alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(609, glTexSubImage4DSGIS, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint woffset; GLsizei width; GLsizei height; GLsizei depth; GLsizei size4d; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->woffset, call->width, call->height, call->depth, call->size4d, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(610, glMakeImageHandleNonResidentARB, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_SYNC_VOID(611, glTexCoord4fVertex4fvSUN, (const GLfloat *tc, const GLfloat *v), (tc, v), const GLfloat *tc; const GLfloat *v;, (call->tc, call->v))
+GL_PROC_SYNC(612, GLuint, glCreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings), GLenum type; GLsizei count; const GLchar *const*strings;, (call->type, call->count, call->strings))
+GL_PROC_ASYNC(613, glPresentFrameDualFillNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3), GLuint video_slot; GLuint64EXT minPresentTime; GLuint beginPresentTimeId; GLuint presentDurationId; GLenum type; GLenum target0; GLuint fill0; GLenum target1; GLuint fill1; GLenum target2; GLuint fill2; GLenum target3; GLuint fill3;, (call->video_slot, call->minPresentTime, call->beginPresentTimeId, call->presentDurationId, call->type, call->target0, call->fill0, call->target1, call->fill1, call->target2, call->fill2, call->target3, call->fill3))
+GL_PROC_ASYNC(614, glCopyTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, x, y, width, height), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(615, glGetNamedRenderbufferParameterivEXT, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params), GLuint renderbuffer; GLenum pname; GLint *params;, (call->renderbuffer, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(616, glColorPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr), GLint size; GLenum type; GLsizei stride; const GLvoid *ptr;, (call->size, call->type, call->stride, call->ptr))
+GL_PROC_SYNC_VOID(617, glGetCompressedTexImage, (GLenum target, GLint lod, GLvoid *img), (target, lod, img), GLenum target; GLint lod; GLvoid *img;, (call->target, call->lod, call->img))
+GL_PROC_SYNC_VOID(618, glUniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(619, glProgramUniform3i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (program, location, x, y, z), GLuint program; GLint location; GLint64EXT x; GLint64EXT y; GLint64EXT z;, (call->program, call->location, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(620, glReplacementCodeuiColor3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *v), (rc, c, v), const GLuint *rc; const GLfloat *c; const GLfloat *v;, (call->rc, call->c, call->v))
+GL_PROC_ASYNC(621, glNormalStream3fATI, (GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz), (stream, nx, ny, nz), GLenum stream; GLfloat nx; GLfloat ny; GLfloat nz;, (call->stream, call->nx, call->ny, call->nz))
+GL_PROC_SYNC(622, GLuint, glBindTexGenParameterEXT, (GLenum unit, GLenum coord, GLenum value), (unit, coord, value), GLenum unit; GLenum coord; GLenum value;, (call->unit, call->coord, call->value))
+GL_PROC_ASYNC(623, glTextureBarrier, (void), (), , ())
+GL_PROC_SYNC_VOID(624, glVertexAttrib1sv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(625, glStencilThenCoverStrokePathNV, (GLuint path, GLint reference, GLuint mask, GLenum coverMode), (path, reference, mask, coverMode), GLuint path; GLint reference; GLuint mask; GLenum coverMode;, (call->path, call->reference, call->mask, call->coverMode))
+GL_PROC_ASYNC(626, glProgramLocalParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w), GLenum target; GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(627, glSecondaryColor3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(628, glBufferStorage, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags), GLenum target; GLsizeiptr size; const void *data; GLbitfield flags;, (call->target, call->size, call->data, call->flags))
+GL_PROC_ASYNC(629, glGlobalAlphaFactorsSUN, (GLshort factor), (factor), GLshort factor;, (call->factor))
+GL_PROC_SYNC_VOID(630, glFogFuncSGIS, (GLsizei n, const GLfloat *points), (n, points), GLsizei n; const GLfloat *points;, (call->n, call->points))
+GL_PROC_SYNC_VOID(631, glTangent3bvEXT, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_SYNC_VOID(632, glGetVideoCaptureStreamivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLint *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; GLint *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_SYNC(633, GLuint, glGetDebugMessageLogARB, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), GLuint count; GLsizei bufSize; GLenum *sources; GLenum *types; GLuint *ids; GLenum *severities; GLsizei *lengths; GLchar *messageLog;, (call->count, call->bufSize, call->sources, call->types, call->ids, call->severities, call->lengths, call->messageLog))
+GL_PROC_ASYNC(634, glVertexStream1iATI, (GLenum stream, GLint x), (stream, x), GLenum stream; GLint x;, (call->stream, call->x))
+GL_PROC_SYNC_VOID(635, glWindowPos4svMESA, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(636, glMaterialxvOES, (GLenum face, GLenum pname, const GLfixed *param), (face, pname, param), GLenum face; GLenum pname; const GLfixed *param;, (call->face, call->pname, call->param))
+GL_PROC_ASYNC(637, glTexCoord4fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, x, y, z, w), GLfloat s; GLfloat t; GLfloat p; GLfloat q; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->s, call->t, call->p, call->q, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC(638, GLboolean, glIsFramebuffer, (GLuint framebuffer), (framebuffer), GLuint framebuffer;, (call->framebuffer))
+GL_PROC_SYNC_VOID(639, glCreatePerfQueryINTEL, (GLuint queryId, GLuint *queryHandle), (queryId, queryHandle), GLuint queryId; GLuint *queryHandle;, (call->queryId, call->queryHandle))
+GL_PROC_ASYNC(640, glSecondaryColor3usEXT, (GLushort red, GLushort green, GLushort blue), (red, green, blue), GLushort red; GLushort green; GLushort blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(641, glGetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params), GLuint program; GLint location; GLfloat *params;, (call->program, call->location, call->params))
+GL_PROC_ASYNC(642, glTexCoord4hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (s, t, r, q), GLhalfNV s; GLhalfNV t; GLhalfNV r; GLhalfNV q;, (call->s, call->t, call->r, call->q))
+GL_PROC_SYNC_VOID(643, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName), GLuint program; GLuint uniformIndex; GLsizei bufSize; GLsizei *length; GLchar *uniformName;, (call->program, call->uniformIndex, call->bufSize, call->length, call->uniformName))
+GL_PROC_ASYNC(644, glVertex2d, (GLdouble x, GLdouble y), (x, y), GLdouble x; GLdouble y;, (call->x, call->y))
+GL_PROC_ASYNC(645, glFlushVertexArrayRangeNV, (void), (), , ())
+GL_PROC_SYNC_VOID(646, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, height, depth, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(647, glMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; const GLfloat *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(648, glMultiTexCoord3svARB, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(649, glMultiTexCoord3fv, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(650, glProgramUniform3i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z), (program, location, x, y, z), GLuint program; GLint location; GLint64 x; GLint64 y; GLint64 z;, (call->program, call->location, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(651, glGetNamedBufferParameterivEXT, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLint *params;, (call->buffer, call->pname, call->params))
+GL_PROC_SYNC_VOID(652, glGetConvolutionParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(653, glBlendFuncIndexedAMD, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst), GLuint buf; GLenum src; GLenum dst;, (call->buf, call->src, call->dst))
+GL_PROC_SYNC_VOID(654, glColor3usv, (const GLushort *v), (v), const GLushort *v;, (call->v))
+GL_PROC_SYNC_VOID(655, glColor3uiv, (const GLuint *v), (v), const GLuint *v;, (call->v))
+GL_PROC_ASYNC(656, glVertexAttribI3iEXT, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), GLuint index; GLint x; GLint y; GLint z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(657, glVertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(658, glGetNamedBufferPointerv, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params), GLuint buffer; GLenum pname; void **params;, (call->buffer, call->pname, call->params))
+GL_PROC_ASYNC(659, glTextureNormalEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(660, glCompressedTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLsizei imageSize; const void *data;, (call->texture, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(661, glVertexAttrib4hvNV, (GLuint index, const GLhalfNV *v), (index, v), GLuint index; const GLhalfNV *v;, (call->index, call->v))
+GL_PROC_ASYNC(662, glMultiTexCoord3fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r), GLenum target; GLfloat s; GLfloat t; GLfloat r;, (call->target, call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(663, glDebugMessageInsertAMD, (GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar *buf), (category, severity, id, length, buf), GLenum category; GLenum severity; GLuint id; GLsizei length; const GLchar *buf;, (call->category, call->severity, call->id, call->length, call->buf))
+GL_PROC_ASYNC(664, glClearDepthf, (GLfloat d), (d), GLfloat d;, (call->d))
+GL_PROC_SYNC_VOID(665, glGetConvolutionFilterEXT, (GLenum target, GLenum format, GLenum type, void *image), (target, format, type, image), GLenum target; GLenum format; GLenum type; void *image;, (call->target, call->format, call->type, call->image))
+GL_PROC_SYNC_VOID(666, glGetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params), GLenum target; GLenum pname; void **params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(667, glNormal3hNV, (GLhalfNV nx, GLhalfNV ny, GLhalfNV nz), (nx, ny, nz), GLhalfNV nx; GLhalfNV ny; GLhalfNV nz;, (call->nx, call->ny, call->nz))
+GL_PROC_ASYNC(668, glNamedFramebufferParameteri, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param), GLuint framebuffer; GLenum pname; GLint param;, (call->framebuffer, call->pname, call->param))
+GL_PROC_SYNC_VOID(669, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message), GLenum source; GLuint id; GLsizei length; const GLchar *message;, (call->source, call->id, call->length, call->message))
+GL_PROC_SYNC_VOID(670, glGetUniformfvARB, (GLhandleARB programObj, GLint location, GLfloat *params), (programObj, location, params), GLhandleARB programObj; GLint location; GLfloat *params;, (call->programObj, call->location, call->params))
+GL_PROC_SYNC_VOID(671, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), GLuint index; GLenum pname; void **pointer;, (call->index, call->pname, call->pointer))
+GL_PROC_ASYNC(672, glProgramVertexLimitNV, (GLenum target, GLint limit), (target, limit), GLenum target; GLint limit;, (call->target, call->limit))
+GL_PROC_SYNC_CLIENT_ARRAY(673, glSecondaryColorPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->size, call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(674, glTexCoord3i, (GLint s, GLint t, GLint r), (s, t, r), GLint s; GLint t; GLint r;, (call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(675, glMultiTexCoord1ivARB, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(676, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLuint program; GLuint index; GLsizei bufSize; GLsizei *length; GLint *size; GLenum *type; GLchar *name;, (call->program, call->index, call->bufSize, call->length, call->size, call->type, call->name))
+GL_PROC_ASYNC(677, glProgramParameteriARB, (GLuint program, GLenum pname, GLint value), (program, pname, value), GLuint program; GLenum pname; GLint value;, (call->program, call->pname, call->value))
+GL_PROC_ASYNC(678, glBlendEquationSeparateIndexedAMD, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha), GLuint buf; GLenum modeRGB; GLenum modeAlpha;, (call->buf, call->modeRGB, call->modeAlpha))
+GL_PROC_ASYNC(679, glOrtho, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val), (left, right, bottom, top, near_val, far_val), GLdouble left; GLdouble right; GLdouble bottom; GLdouble top; GLdouble near_val; GLdouble far_val;, (call->left, call->right, call->bottom, call->top, call->near_val, call->far_val))
+GL_PROC_SYNC_VOID(680, glGetMultisamplefvNV, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val), GLenum pname; GLuint index; GLfloat *val;, (call->pname, call->index, call->val))
+GL_PROC_SYNC_VOID(681, glGenVertexArraysAPPLE, (GLsizei n, GLuint *arrays), (n, arrays), GLsizei n; GLuint *arrays;, (call->n, call->arrays))
+GL_PROC_SYNC_VOID(682, glNamedProgramStringEXT, (GLuint program, GLenum target, GLenum format, GLsizei len, const void *string), (program, target, format, len, string), GLuint program; GLenum target; GLenum format; GLsizei len; const void *string;, (call->program, call->target, call->format, call->len, call->string))
+GL_PROC_SYNC_VOID(683, glGetVideoCaptureStreamfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; GLfloat *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_ASYNC(684, glEvalMesh2, (GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2), (mode, i1, i2, j1, j2), GLenum mode; GLint i1; GLint i2; GLint j1; GLint j2;, (call->mode, call->i1, call->i2, call->j1, call->j2))
+GL_PROC_SYNC_VOID(685, glGetLightfv, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params), GLenum light; GLenum pname; GLfloat *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(686, glColor3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(687, glVertexAttribL2i64NV, (GLuint index, GLint64EXT x, GLint64EXT y), (index, x, y), GLuint index; GLint64EXT x; GLint64EXT y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(688, glProgramUniformMatrix3x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(689, glMulticastCopyImageSubDataNV, (GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth), GLuint srcGpu; GLbitfield dstGpuMask; GLuint srcName; GLenum srcTarget; GLint srcLevel; GLint srcX; GLint srcY; GLint srcZ; GLuint dstName; GLenum dstTarget; GLint dstLevel; GLint dstX; GLint dstY; GLint dstZ; GLsizei srcWidth; GLsizei srcHeight; GLsizei srcDepth;, (call->srcGpu, call->dstGpuMask, call->srcName, call->srcTarget, call->srcLevel, call->srcX, call->srcY, call->srcZ, call->dstName, call->dstTarget, call->dstLevel, call->dstX, call->dstY, call->dstZ, call->srcWidth, call->srcHeight, call->srcDepth))
+GL_PROC_ASYNC(690, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer), GLenum target; GLuint framebuffer;, (call->target, call->framebuffer))
+GL_PROC_SYNC_VOID(691, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label), GLenum identifier; GLuint name; GLsizei length; const GLchar *label;, (call->identifier, call->name, call->length, call->label))
+GL_PROC_SYNC_VOID(692, glTexGenxvOES, (GLenum coord, GLenum pname, const GLfixed *params), (coord, pname, params), GLenum coord; GLenum pname; const GLfixed *params;, (call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(693, glViewportArrayv, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v), GLuint first; GLsizei count; const GLfloat *v;, (call->first, call->count, call->v))
+GL_PROC_ASYNC(694, glTexAttachMemoryNV, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset), GLenum target; GLuint memory; GLuint64 offset;, (call->target, call->memory, call->offset))
+GL_PROC_ASYNC(695, glResetMinmaxEXT, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(696, glVertexArraySecondaryColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->size, call->type, call->stride, call->offset))
+GL_PROC_SYNC_VOID(697, glMultiTexCoord3xvOES, (GLenum texture, const GLfixed *coords), (texture, coords), GLenum texture; const GLfixed *coords;, (call->texture, call->coords))
+GL_PROC_SYNC_VOID(698, glRasterPos2sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(699, glProgramEnvParameterI4ivNV, (GLenum target, GLuint index, const GLint *params), (target, index, params), GLenum target; GLuint index; const GLint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(700, glVertexAttribs4fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v), GLuint index; GLsizei count; const GLfloat *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(701, glDisableVertexAttribArrayARB, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_ASYNC(702, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), GLenum sfactorRGB; GLenum dfactorRGB; GLenum sfactorAlpha; GLenum dfactorAlpha;, (call->sfactorRGB, call->dfactorRGB, call->sfactorAlpha, call->dfactorAlpha))
+GL_PROC_ASYNC(703, glTexGenxOES, (GLenum coord, GLenum pname, GLfixed param), (coord, pname, param), GLenum coord; GLenum pname; GLfixed param;, (call->coord, call->pname, call->param))
+GL_PROC_SYNC_VOID(704, glVertex3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(705, glProgramUniformMatrix2x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(706, glEGLImageTargetTextureStorageEXT, (GLuint texture, GLeglImageOES image, const GLint* attrib_list), (texture, image, attrib_list), GLuint texture; GLeglImageOES image; const GLint* attrib_list;, (call->texture, call->image, call->attrib_list))
+GL_PROC_SYNC_VOID(707, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params), GLuint sampler; GLenum pname; GLuint *params;, (call->sampler, call->pname, call->params))
+GL_PROC_SYNC_VOID(708, glPointParameterfv, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(709, glUniform1dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLint location; GLsizei count; const GLdouble *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(710, glBlendFunciARB, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst), GLuint buf; GLenum src; GLenum dst;, (call->buf, call->src, call->dst))
+GL_PROC_ASYNC(711, glVertex3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(712, glVertexAttrib1dvNV, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(713, glLoadName, (GLuint name), (name), GLuint name;, (call->name))
+GL_PROC_SYNC(714, GLboolean, glIsStateNV, (GLuint state), (state), GLuint state;, (call->state))
+GL_PROC_SYNC_VOID(715, glUniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(716, glTexCoord1d, (GLdouble s), (s), GLdouble s;, (call->s))
+GL_PROC_SYNC_VOID(717, glDeleteProgramsARB, (GLsizei n, const GLuint *programs), (n, programs), GLsizei n; const GLuint *programs;, (call->n, call->programs))
+GL_PROC_SYNC_VOID(718, glGetUniformdv, (GLuint program, GLint location, GLdouble *params), (program, location, params), GLuint program; GLint location; GLdouble *params;, (call->program, call->location, call->params))
+GL_PROC_ASYNC(719, glProgramUniform1fEXT, (GLuint program, GLint location, GLfloat v0), (program, location, v0), GLuint program; GLint location; GLfloat v0;, (call->program, call->location, call->v0))
+GL_PROC_ASYNC(720, glVertexAttribL2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLuint index; GLdouble x; GLdouble y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(721, glGetFramebufferAttachmentParameterivEXT, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params), GLenum target; GLenum attachment; GLenum pname; GLint *params;, (call->target, call->attachment, call->pname, call->params))
+GL_PROC_SYNC_VOID(722, glWindowPos2iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC(723, GLboolean, glIsVariantEnabledEXT, (GLuint id, GLenum cap), (id, cap), GLuint id; GLenum cap;, (call->id, call->cap))
+GL_PROC_ASYNC(724, glBeginVertexShaderEXT, (void), (), , ())
+GL_PROC_SYNC_VOID(725, glTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, border, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint internalformat; GLsizei width; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->internalformat, call->width, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(726, glGetBufferPointervARB, (GLenum target, GLenum pname, void **params), (target, pname, params), GLenum target; GLenum pname; void **params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC(727, void *, glMapNamedBuffer, (GLuint buffer, GLenum access), (buffer, access), GLuint buffer; GLenum access;, (call->buffer, call->access))
+GL_PROC_SYNC_VOID(728, glGetFirstPerfQueryIdINTEL, (GLuint *queryId), (queryId), GLuint *queryId;, (call->queryId))
+GL_PROC_ASYNC(729, glMinmax, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink), GLenum target; GLenum internalformat; GLboolean sink;, (call->target, call->internalformat, call->sink))
+GL_PROC_SYNC_CLIENT_ARRAY(730, glTexCoordPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride), GLint size; GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->size, call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_ASYNC(731, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), GLint location; GLint v0; GLint v1; GLint v2; GLint v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_ASYNC(732, glTextureImage3DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations), GLuint texture; GLenum target; GLsizei samples; GLint internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedSampleLocations;, (call->texture, call->target, call->samples, call->internalFormat, call->width, call->height, call->depth, call->fixedSampleLocations))
+GL_PROC_SYNC_VOID(733, glPathSubCoordsNV, (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords), (path, coordStart, numCoords, coordType, coords), GLuint path; GLsizei coordStart; GLsizei numCoords; GLenum coordType; const void *coords;, (call->path, call->coordStart, call->numCoords, call->coordType, call->coords))
+GL_PROC_SYNC_VOID(734, glVertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_SYNC_CLIENT_ARRAY(735, glEdgeFlagPointerEXT, (GLsizei stride, GLsizei count, const GLboolean *pointer), (stride, count, pointer), GLsizei stride; GLsizei count; const GLboolean *pointer;, (call->stride, call->count, call->pointer))
+GL_PROC_ASYNC(736, glVertexP2ui, (GLenum type, GLuint value), (type, value), GLenum type; GLuint value;, (call->type, call->value))
+GL_PROC_ASYNC(737, glRenderbufferStorageEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), GLenum target; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(738, glClearNamedFramebufferuiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value), GLuint framebuffer; GLenum buffer; GLint drawbuffer; const GLuint *value;, (call->framebuffer, call->buffer, call->drawbuffer, call->value))
+GL_PROC_ASYNC(739, glAlphaFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod), GLenum op; GLuint dst; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod; GLuint arg2; GLuint arg2Rep; GLuint arg2Mod; GLuint arg3; GLuint arg3Rep; GLuint arg3Mod;, (call->op, call->dst, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod, call->arg2, call->arg2Rep, call->arg2Mod, call->arg3, call->arg3Rep, call->arg3Mod))
+GL_PROC_ASYNC(740, glSecondaryColor3us, (GLushort red, GLushort green, GLushort blue), (red, green, blue), GLushort red; GLushort green; GLushort blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(741, glCallCommandListNV, (GLuint list), (list), GLuint list;, (call->list))
+GL_PROC_ASYNC(742, glFogCoordFormatNV, (GLenum type, GLsizei stride), (type, stride), GLenum type; GLsizei stride;, (call->type, call->stride))
+GL_PROC_SYNC_VOID(743, glDeleteFencesAPPLE, (GLsizei n, const GLuint *fences), (n, fences), GLsizei n; const GLuint *fences;, (call->n, call->fences))
+GL_PROC_SYNC_VOID(744, glGetInfoLogARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog), (obj, maxLength, length, infoLog), GLhandleARB obj; GLsizei maxLength; GLsizei *length; GLcharARB *infoLog;, (call->obj, call->maxLength, call->length, call->infoLog))
+GL_PROC_ASYNC(745, glDisablei, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_SYNC_VOID(746, glProgramUniform2i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(747, glArrayElement, (GLint i), (i), GLint i;, (call->i))
+GL_PROC_SYNC_VOID(748, glClearNamedBufferDataEXT, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data), GLuint buffer; GLenum internalformat; GLenum format; GLenum type; const void *data;, (call->buffer, call->internalformat, call->format, call->type, call->data))
+GL_PROC_ASYNC(749, glProgramUniform2ui, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), GLuint program; GLint location; GLuint v0; GLuint v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC_VOID(750, glUniform2ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLuint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(751, glWindowPos3dvARB, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(752, glGetHistogramParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(753, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data), GLenum target; GLintptr offset; GLsizeiptr size; void *data;, (call->target, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(754, glTextureParameteriv, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param), GLuint texture; GLenum pname; const GLint *param;, (call->texture, call->pname, call->param))
+GL_PROC_SYNC_VOID(755, glGetCompressedTexImageARB, (GLenum target, GLint level, void *img), (target, level, img), GLenum target; GLint level; void *img;, (call->target, call->level, call->img))
+GL_PROC_ASYNC(756, glMultiTexCoord2iARB, (GLenum target, GLint s, GLint t), (target, s, t), GLenum target; GLint s; GLint t;, (call->target, call->s, call->t))
+GL_PROC_SYNC_VOID(757, glGenSamplers, (GLsizei count, GLuint *samplers), (count, samplers), GLsizei count; GLuint *samplers;, (call->count, call->samplers))
+GL_PROC_ASYNC(758, glMinSampleShadingARB, (GLfloat value), (value), GLfloat value;, (call->value))
+GL_PROC_ASYNC(759, glColor4f, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLfloat red; GLfloat green; GLfloat blue; GLfloat alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(760, glGetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params), GLuint program; GLint location; GLuint *params;, (call->program, call->location, call->params))
+GL_PROC_SYNC_VOID(761, glGetTextureImage, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels), GLuint texture; GLint level; GLenum format; GLenum type; GLsizei bufSize; void *pixels;, (call->texture, call->level, call->format, call->type, call->bufSize, call->pixels))
+GL_PROC_SYNC_VOID(762, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(763, glMakeBufferNonResidentNV, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(764, glGetTransformFeedbacki_v, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param), GLuint xfb; GLenum pname; GLuint index; GLint *param;, (call->xfb, call->pname, call->index, call->param))
+GL_PROC_SYNC(765, GLuint, glGetCommandHeaderNV, (GLenum tokenID, GLuint size), (tokenID, size), GLenum tokenID; GLuint size;, (call->tokenID, call->size))
+GL_PROC_SYNC_VOID(766, glGetTextureLevelParameterfv, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params), GLuint texture; GLint level; GLenum pname; GLfloat *params;, (call->texture, call->level, call->pname, call->params))
+GL_PROC_ASYNC(767, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->target, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_SYNC_VOID(768, glVertexAttrib4usvARB, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(769, glWindowPos3dvMESA, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(770, glReplacementCodeuiColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, nx, ny, nz, x, y, z), GLuint rc; GLfloat r; GLfloat g; GLfloat b; GLfloat a; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->r, call->g, call->b, call->a, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_ASYNC(771, glCopyMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(772, glGetTexFilterFuncSGIS, (GLenum target, GLenum filter, GLfloat *weights), (target, filter, weights), GLenum target; GLenum filter; GLfloat *weights;, (call->target, call->filter, call->weights))
+GL_PROC_ASYNC(773, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), GLuint index; GLfloat x; GLfloat y; GLfloat z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(774, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data), GLenum target; GLintptr offset; GLsizeiptr size; const void *data;, (call->target, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(775, glTexCoord4dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_CLIENT_ARRAY(776, glFogCoordPointer, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLenum type; GLsizei stride; const void *pointer;, (call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(777, glWindowPos2s, (GLshort x, GLshort y), (x, y), GLshort x; GLshort y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(778, glGetPixelTransformParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(779, glClear, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_SYNC_VOID(780, glGetCombinerOutputParameterivNV, (GLenum stage, GLenum portion, GLenum pname, GLint *params), (stage, portion, pname, params), GLenum stage; GLenum portion; GLenum pname; GLint *params;, (call->stage, call->portion, call->pname, call->params))
+GL_PROC_ASYNC(781, glClearDepthfOES, (GLclampf depth), (depth), GLclampf depth;, (call->depth))
+GL_PROC_SYNC_VOID(782, glSecondaryColor3svEXT, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(783, glSampleMaskSGIS, (GLclampf value, GLboolean invert), (value, invert), GLclampf value; GLboolean invert;, (call->value, call->invert))
+GL_PROC_SYNC_VOID(784, glMap1d, (GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (target, u1, u2, stride, order, points), GLenum target; GLdouble u1; GLdouble u2; GLint stride; GLint order; const GLdouble *points;, (call->target, call->u1, call->u2, call->stride, call->order, call->points))
+GL_PROC_ASYNC(785, glPixelStorex, (GLenum pname, GLfixed param), (pname, param), GLenum pname; GLfixed param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(786, glSpriteParameterivSGIX, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(787, glCoverageModulationNV, (GLenum components), (components), GLenum components;, (call->components))
+GL_PROC_SYNC_VOID(788, glNormal3hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(789, glEdgeFlagFormatNV, (GLsizei stride), (stride), GLsizei stride;, (call->stride))
+GL_PROC_SYNC_VOID(790, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value), GLenum buffer; GLint drawbuffer; const GLint *value;, (call->buffer, call->drawbuffer, call->value))
+GL_PROC_SYNC_VOID(791, glInvalidateSubFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height), GLenum target; GLsizei numAttachments; const GLenum *attachments; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->numAttachments, call->attachments, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(792, glProgramUniform1i64NV, (GLuint program, GLint location, GLint64EXT x), (program, location, x), GLuint program; GLint location; GLint64EXT x;, (call->program, call->location, call->x))
+GL_PROC_SYNC(793, GLuint, glGenFragmentShadersATI, (GLuint range), (range), GLuint range;, (call->range))
+GL_PROC_SYNC_VOID(794, glStencilThenCoverStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLint reference; GLuint mask; GLenum coverMode; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->reference, call->mask, call->coverMode, call->transformType, call->transformValues))
+GL_PROC_ASYNC(795, glUniform1fARB, (GLint location, GLfloat v0), (location, v0), GLint location; GLfloat v0;, (call->location, call->v0))
+GL_PROC_ASYNC(796, glProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0), GLuint program; GLint location; GLint v0;, (call->program, call->location, call->v0))
+GL_PROC_ASYNC(797, glGetQueryBufferObjectiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLuint id; GLuint buffer; GLenum pname; GLintptr offset;, (call->id, call->buffer, call->pname, call->offset))
+GL_PROC_SYNC(798, GLuint64, glGetTextureHandleNV, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_SYNC(799, GLhandleARB, glCreateShaderObjectARB, (GLenum shaderType), (shaderType), GLenum shaderType;, (call->shaderType))
+GL_PROC_SYNC_VOID(800, glVertex2fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(801, glGetListParameterivSGIX, (GLuint list, GLenum pname, GLint *params), (list, pname, params), GLuint list; GLenum pname; GLint *params;, (call->list, call->pname, call->params))
+GL_PROC_ASYNC(802, glFramebufferParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(803, glUniform4ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLuint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(804, GLboolean, glPointAlongPathNV, (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY), (path, startSegment, numSegments, distance, x, y, tangentX, tangentY), GLuint path; GLsizei startSegment; GLsizei numSegments; GLfloat distance; GLfloat *x; GLfloat *y; GLfloat *tangentX; GLfloat *tangentY;, (call->path, call->startSegment, call->numSegments, call->distance, call->x, call->y, call->tangentX, call->tangentY))
+GL_PROC_SYNC_VOID(805, glGetnSeparableFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span), GLenum target; GLenum format; GLenum type; GLsizei rowBufSize; void *row; GLsizei columnBufSize; void *column; void *span;, (call->target, call->format, call->type, call->rowBufSize, call->row, call->columnBufSize, call->column, call->span))
+GL_PROC_ASYNC(806, glNormal3s, (GLshort nx, GLshort ny, GLshort nz), (nx, ny, nz), GLshort nx; GLshort ny; GLshort nz;, (call->nx, call->ny, call->nz))
+GL_PROC_ASYNC(807, glVertexArrayEdgeFlagOffsetEXT, (GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset), (vaobj, buffer, stride, offset), GLuint vaobj; GLuint buffer; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->stride, call->offset))
+GL_PROC_ASYNC(808, glSpriteParameteriSGIX, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(809, glProgramUniform3dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(810, glFogCoorddv, (const GLdouble *coord), (coord), const GLdouble *coord;, (call->coord))
+GL_PROC_SYNC_VOID(811, glProgramUniform1ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(812, glGetMultiTexImageEXT, (GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texunit, target, level, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLenum format; GLenum type; void *pixels;, (call->texunit, call->target, call->level, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(813, glGetNamedFramebufferAttachmentParameteriv, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params), GLuint framebuffer; GLenum attachment; GLenum pname; GLint *params;, (call->framebuffer, call->attachment, call->pname, call->params))
+GL_PROC_SYNC_VOID(814, glMultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount), GLenum mode; const GLsizei *count; GLenum type; const void *const*indices; GLsizei drawcount;, (call->mode, call->count, call->type, call->indices, call->drawcount))
+GL_PROC_SYNC_VOID(815, glShadingRateSampleOrderCustomNV, (GLenum rate, GLuint samples, const GLint *locations), (rate, samples, locations), GLenum rate; GLuint samples; const GLint *locations;, (call->rate, call->samples, call->locations))
+GL_PROC_ASYNC(816, glColor4ui, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha), GLuint red; GLuint green; GLuint blue; GLuint alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(817, glCompressedTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, width, format, imageSize, bits), GLuint texture; GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->xoffset, call->width, call->format, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(818, glProgramUniform1uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(819, glStencilOpSeparateATI, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), GLenum face; GLenum sfail; GLenum dpfail; GLenum dppass;, (call->face, call->sfail, call->dpfail, call->dppass))
+GL_PROC_SYNC_VOID(820, glProgramUniform1fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(821, glTextureParameterIiv, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params), GLuint texture; GLenum pname; const GLint *params;, (call->texture, call->pname, call->params))
+GL_PROC_SYNC_VOID(822, glUniform4i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), GLint location; GLsizei count; const GLint64 *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(823, GLboolean, glIsObjectBufferATI, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_ASYNC(824, glVertexArrayParameteriAPPLE, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(825, glProgramUniform4fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(826, glDeletePathsNV, (GLuint path, GLsizei range), (path, range), GLuint path; GLsizei range;, (call->path, call->range))
+GL_PROC_SYNC_VOID(827, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params), GLuint program; GLuint uniformBlockIndex; GLenum pname; GLint *params;, (call->program, call->uniformBlockIndex, call->pname, call->params))
+GL_PROC_ASYNC(828, glVertexAttribI2iEXT, (GLuint index, GLint x, GLint y), (index, x, y), GLuint index; GLint x; GLint y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(829, glGetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(830, glGetTextureLevelParameterivEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params), (texture, target, level, pname, params), GLuint texture; GLenum target; GLint level; GLenum pname; GLint *params;, (call->texture, call->target, call->level, call->pname, call->params))
+GL_PROC_SYNC(831, GLboolean, glIsImageHandleResidentARB, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(832, glVertexAttrib2dNV, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLuint index; GLdouble x; GLdouble y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(833, glProgramUniform2uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), GLuint program; GLint location; GLuint v0; GLuint v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC(834, GLsync, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags), GLenum condition; GLbitfield flags;, (call->condition, call->flags))
+GL_PROC_SYNC_VOID(835, glNormalStream3dvATI, (GLenum stream, const GLdouble *coords), (stream, coords), GLenum stream; const GLdouble *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(836, glPathCoverDepthFuncNV, (GLenum func), (func), GLenum func;, (call->func))
+GL_PROC_ASYNC(837, glGetMaterialxOES, (GLenum face, GLenum pname, GLfixed param), (face, pname, param), GLenum face; GLenum pname; GLfixed param;, (call->face, call->pname, call->param))
+GL_PROC_ASYNC(838, glTextureStorageMem2DMultisampleEXT, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset), GLuint texture; GLsizei samples; GLenum internalFormat; GLsizei width; GLsizei height; GLboolean fixedSampleLocations; GLuint memory; GLuint64 offset;, (call->texture, call->samples, call->internalFormat, call->width, call->height, call->fixedSampleLocations, call->memory, call->offset))
+GL_PROC_SYNC_VOID(839, glTexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords), GLenum type; const GLuint *coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(840, glDeleteProgramPipelines, (GLsizei n, const GLuint *pipelines), (n, pipelines), GLsizei n; const GLuint *pipelines;, (call->n, call->pipelines))
+GL_PROC_ASYNC(841, glEvalMesh1, (GLenum mode, GLint i1, GLint i2), (mode, i1, i2), GLenum mode; GLint i1; GLint i2;, (call->mode, call->i1, call->i2))
+GL_PROC_SYNC_CLIENT_ARRAY(842, glWeightPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->size, call->type, call->stride, call->pointer))
+GL_PROC_SYNC(843, GLboolean, glIsVertexArray, (GLuint array), (array), GLuint array;, (call->array))
+GL_PROC_ASYNC(844, glTexCoord4f, (GLfloat s, GLfloat t, GLfloat r, GLfloat q), (s, t, r, q), GLfloat s; GLfloat t; GLfloat r; GLfloat q;, (call->s, call->t, call->r, call->q))
+GL_PROC_SYNC(845, GLuint, glBindTextureUnitParameterEXT, (GLenum unit, GLenum value), (unit, value), GLenum unit; GLenum value;, (call->unit, call->value))
+GL_PROC_SYNC_VOID(846, glNamedBufferStorage, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags), GLuint buffer; GLsizeiptr size; const void *data; GLbitfield flags;, (call->buffer, call->size, call->data, call->flags))
+GL_PROC_SYNC_VOID(847, glTexCoord3xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_SYNC_VOID(848, glGetnPixelMapuivARB, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLuint *values;, (call->map, call->bufSize, call->values))
+GL_PROC_ASYNC(849, glDrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount), GLenum mode; GLuint id; GLuint stream; GLsizei instancecount;, (call->mode, call->id, call->stream, call->instancecount))
+GL_PROC_ASYNC(850, glVertexArrayFogCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset), GLuint vaobj; GLuint buffer; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->type, call->stride, call->offset))
+GL_PROC_ASYNC(851, glNormal3fVertex3fSUN, (GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (nx, ny, nz, x, y, z), GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_ASYNC(852, glShadingRateSampleOrderNV, (GLenum order), (order), GLenum order;, (call->order))
+GL_PROC_SYNC_VOID(853, glRasterPos2xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(854, glTextureAttachMemoryNV, (GLuint texture, GLuint memory, GLuint64 offset), (texture, memory, offset), GLuint texture; GLuint memory; GLuint64 offset;, (call->texture, call->memory, call->offset))
+GL_PROC_ASYNC(855, glMultiTexCoord4s, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q), GLenum target; GLshort s; GLshort t; GLshort r; GLshort q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(856, glMultiTexCoord1i, (GLenum target, GLint s), (target, s), GLenum target; GLint s;, (call->target, call->s))
+GL_PROC_ASYNC(857, glEGLImageTargetTexture2DOES, (GLenum target, GLeglImageOES image), (target, image), GLenum target; GLeglImageOES image;, (call->target, call->image))
+GL_PROC_SYNC_CLIENT_ARRAY(858, glNormalPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer), GLenum type; GLsizei stride; GLsizei count; const void *pointer;, (call->type, call->stride, call->count, call->pointer))
+GL_PROC_SYNC_VOID(859, glReplacementCodeuiTexCoord2fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *v), (rc, tc, v), const GLuint *rc; const GLfloat *tc; const GLfloat *v;, (call->rc, call->tc, call->v))
+GL_PROC_ASYNC(860, glColor3i, (GLint red, GLint green, GLint blue), (red, green, blue), GLint red; GLint green; GLint blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC(861, GLboolean, glIsEnabledi, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_ASYNC(862, glMultiTexRenderbufferEXT, (GLenum texunit, GLenum target, GLuint renderbuffer), (texunit, target, renderbuffer), GLenum texunit; GLenum target; GLuint renderbuffer;, (call->texunit, call->target, call->renderbuffer))
+GL_PROC_SYNC(863, const GLubyte *, glGetString, (GLenum name), (name), GLenum name;, (call->name))
+GL_PROC_SYNC_VOID(864, glColor4sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(865, glRectdv, (const GLdouble *v1, const GLdouble *v2), (v1, v2), const GLdouble *v1; const GLdouble *v2;, (call->v1, call->v2))
+GL_PROC_SYNC_VOID(866, glProgramUniform1i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(867, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value), GLuint program; GLenum pname; GLint value;, (call->program, call->pname, call->value))
+GL_PROC_ASYNC(868, glBindTexture, (GLenum target, GLuint texture), (target, texture), GLenum target; GLuint texture;, (call->target, call->texture))
+GL_PROC_SYNC_VOID(869, glWindowPos3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(870, glVertexAttrib2svARB, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(871, glNewList, (GLuint list, GLenum mode), (list, mode), GLuint list; GLenum mode;, (call->list, call->mode))
+GL_PROC_SYNC_VOID(872, glMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(873, glVertexStream4sATI, (GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w), (stream, x, y, z, w), GLenum stream; GLshort x; GLshort y; GLshort z; GLshort w;, (call->stream, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(874, glGenTransformFeedbacksNV, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(875, glGetMapAttribParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params), GLenum target; GLuint index; GLenum pname; GLfloat *params;, (call->target, call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(876, glGetTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; GLint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(877, glReadnPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data), GLint x; GLint y; GLsizei width; GLsizei height; GLenum format; GLenum type; GLsizei bufSize; void *data;, (call->x, call->y, call->width, call->height, call->format, call->type, call->bufSize, call->data))
+GL_PROC_SYNC_VOID(878, glUniform1i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(879, glCombinerParameterfvNV, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(880, glPointParameteriv, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(881, glGetSeparableFilter, (GLenum target, GLenum format, GLenum type, GLvoid *row, GLvoid *column, GLvoid *span), (target, format, type, row, column, span), GLenum target; GLenum format; GLenum type; GLvoid *row; GLvoid *column; GLvoid *span;, (call->target, call->format, call->type, call->row, call->column, call->span))
+GL_PROC_ASYNC(882, glTexCoordP2ui, (GLenum type, GLuint coords), (type, coords), GLenum type; GLuint coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(883, glRasterPos2dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(884, glVertexP4uiv, (GLenum type, const GLuint *value), (type, value), GLenum type; const GLuint *value;, (call->type, call->value))
+GL_PROC_SYNC_VOID(885, glLoadTransposeMatrixfARB, (const GLfloat *m), (m), const GLfloat *m;, (call->m))
+GL_PROC_SYNC_VOID(886, glProgramLocalParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params), (target, index, params), GLenum target; GLuint index; const GLfloat *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(887, glTexCoord4xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(888, glMatrixPopEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(889, glVertexAttribI2uiEXT, (GLuint index, GLuint x, GLuint y), (index, x, y), GLuint index; GLuint x; GLuint y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(890, glCopyTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texture, target, level, internalformat, x, y, width, height, border), GLuint texture; GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height; GLint border;, (call->texture, call->target, call->level, call->internalformat, call->x, call->y, call->width, call->height, call->border))
+GL_PROC_ASYNC(891, glDrawElementArrayAPPLE, (GLenum mode, GLint first, GLsizei count), (mode, first, count), GLenum mode; GLint first; GLsizei count;, (call->mode, call->first, call->count))
+GL_PROC_SYNC_VOID(892, glGetProgramEnvParameterIivNV, (GLenum target, GLuint index, GLint *params), (target, index, params), GLenum target; GLuint index; GLint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(893, glTexCoord4bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_ASYNC(894, glPixelTexGenParameteriSGIS, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(895, glGenProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines), GLsizei n; GLuint *pipelines;, (call->n, call->pipelines))
+GL_PROC_SYNC_VOID(896, glProgramUniformMatrix2x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(897, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), GLuint index; GLubyte x; GLubyte y; GLubyte z; GLubyte w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(898, glGetFramebufferParameterivMESA, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(899, glPathStencilFuncNV, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), GLenum func; GLint ref; GLuint mask;, (call->func, call->ref, call->mask))
+GL_PROC_ASYNC(900, glTexCoord2xOES, (GLfixed s, GLfixed t), (s, t), GLfixed s; GLfixed t;, (call->s, call->t))
+GL_PROC_SYNC_VOID(901, glVertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_ASYNC(902, glInvalidateBufferData, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC_VOID(903, glTextureParameterIuiv, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params), GLuint texture; GLenum pname; const GLuint *params;, (call->texture, call->pname, call->params))
+GL_PROC_ASYNC(904, glMakeImageHandleNonResidentNV, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(905, glVertexAttribLFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_ASYNC(906, glViewportPositionWScaleNV, (GLuint index, GLfloat xcoeff, GLfloat ycoeff), (index, xcoeff, ycoeff), GLuint index; GLfloat xcoeff; GLfloat ycoeff;, (call->index, call->xcoeff, call->ycoeff))
+GL_PROC_ASYNC(907, glFragmentLightiSGIX, (GLenum light, GLenum pname, GLint param), (light, pname, param), GLenum light; GLenum pname; GLint param;, (call->light, call->pname, call->param))
+GL_PROC_ASYNC(908, glRenderGpuMaskNV, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_SYNC_VOID(909, glVariantuivEXT, (GLuint id, const GLuint *addr), (id, addr), GLuint id; const GLuint *addr;, (call->id, call->addr))
+GL_PROC_ASYNC(910, glNamedFramebufferTextureEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level), GLuint framebuffer; GLenum attachment; GLuint texture; GLint level;, (call->framebuffer, call->attachment, call->texture, call->level))
+GL_PROC_ASYNC(911, glTextureImage2DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations), GLuint texture; GLenum target; GLsizei coverageSamples; GLsizei colorSamples; GLint internalFormat; GLsizei width; GLsizei height; GLboolean fixedSampleLocations;, (call->texture, call->target, call->coverageSamples, call->colorSamples, call->internalFormat, call->width, call->height, call->fixedSampleLocations))
+GL_PROC_ASYNC(912, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(913, glMulticastGetQueryObjecti64vNV, (GLuint gpu, GLuint id, GLenum pname, GLint64 *params), (gpu, id, pname, params), GLuint gpu; GLuint id; GLenum pname; GLint64 *params;, (call->gpu, call->id, call->pname, call->params))
+GL_PROC_ASYNC(914, glMap1xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points), (target, u1, u2, stride, order, points), GLenum target; GLfixed u1; GLfixed u2; GLint stride; GLint order; GLfixed points;, (call->target, call->u1, call->u2, call->stride, call->order, call->points))
+GL_PROC_SYNC_VOID(915, glNormal3bv, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_ASYNC(916, glColorFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod), GLenum op; GLuint dst; GLuint dstMask; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod; GLuint arg2; GLuint arg2Rep; GLuint arg2Mod; GLuint arg3; GLuint arg3Rep; GLuint arg3Mod;, (call->op, call->dst, call->dstMask, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod, call->arg2, call->arg2Rep, call->arg2Mod, call->arg3, call->arg3Rep, call->arg3Mod))
+GL_PROC_SYNC_VOID(917, glGetClipPlanexOES, (GLenum plane, GLfixed *equation), (plane, equation), GLenum plane; GLfixed *equation;, (call->plane, call->equation))
+GL_PROC_SYNC_VOID(918, glVertexAttrib1fvNV, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC(919, GLboolean, glIsEnabledIndexedEXT, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_SYNC_VOID(920, glProgramUniform1i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(921, glTextureStorageMem2DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, memory, offset), GLuint texture; GLsizei levels; GLenum internalFormat; GLsizei width; GLsizei height; GLuint memory; GLuint64 offset;, (call->texture, call->levels, call->internalFormat, call->width, call->height, call->memory, call->offset))
+GL_PROC_ASYNC(922, glCopyTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texture, target, level, internalformat, x, y, width, border), GLuint texture; GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLint border;, (call->texture, call->target, call->level, call->internalformat, call->x, call->y, call->width, call->border))
+GL_PROC_SYNC_VOID(923, glGetVariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data), GLuint id; GLenum value; GLboolean *data;, (call->id, call->value, call->data))
+GL_PROC_ASYNC(924, glBlendEquationEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC(925, GLboolean, glIsProgramARB, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_ASYNC(926, glBlendFuncSeparateEXT, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), GLenum sfactorRGB; GLenum dfactorRGB; GLenum sfactorAlpha; GLenum dfactorAlpha;, (call->sfactorRGB, call->dfactorRGB, call->sfactorAlpha, call->dfactorAlpha))
+GL_PROC_SYNC_VOID(927, glGetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values), GLuint program; GLenum shadertype; GLenum pname; GLint *values;, (call->program, call->shadertype, call->pname, call->values))
+GL_PROC_SYNC_VOID(928, glConvolutionFilter1D, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *image), (target, internalformat, width, format, type, image), GLenum target; GLenum internalformat; GLsizei width; GLenum format; GLenum type; const GLvoid *image;, (call->target, call->internalformat, call->width, call->format, call->type, call->image))
+GL_PROC_SYNC_VOID(929, glGetCombinerOutputParameterfvNV, (GLenum stage, GLenum portion, GLenum pname, GLfloat *params), (stage, portion, pname, params), GLenum stage; GLenum portion; GLenum pname; GLfloat *params;, (call->stage, call->portion, call->pname, call->params))
+GL_PROC_ASYNC(930, glPopClientAttrib, (void), (), , ())
+GL_PROC_SYNC_VOID(931, glWaitSemaphoreEXT, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts), GLuint semaphore; GLuint numBufferBarriers; const GLuint *buffers; GLuint numTextureBarriers; const GLuint *textures; const GLenum *srcLayouts;, (call->semaphore, call->numBufferBarriers, call->buffers, call->numTextureBarriers, call->textures, call->srcLayouts))
+GL_PROC_ASYNC(932, glEnable, (GLenum cap), (cap), GLenum cap;, (call->cap))
+GL_PROC_ASYNC(933, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), GLint location; GLint v0; GLint v1; GLint v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(934, glFrustumxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f), GLfixed l; GLfixed r; GLfixed b; GLfixed t; GLfixed n; GLfixed f;, (call->l, call->r, call->b, call->t, call->n, call->f))
+GL_PROC_ASYNC(935, glMultiTexEnvfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param), GLenum texunit; GLenum target; GLenum pname; GLfloat param;, (call->texunit, call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(936, glEvalCoord2xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(937, glProgramUniform3uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLuint v0; GLuint v1; GLuint v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(938, glHistogram, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink), GLenum target; GLsizei width; GLenum internalformat; GLboolean sink;, (call->target, call->width, call->internalformat, call->sink))
+GL_PROC_ASYNC(939, glFinishObjectAPPLE, (GLenum object, GLint name), (object, name), GLenum object; GLint name;, (call->object, call->name))
+GL_PROC_ASYNC(940, glProgramUniform4i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (program, location, x, y, z, w), GLuint program; GLint location; GLint64EXT x; GLint64EXT y; GLint64EXT z; GLint64EXT w;, (call->program, call->location, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(941, glNormalStream3fvATI, (GLenum stream, const GLfloat *coords), (stream, coords), GLenum stream; const GLfloat *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(942, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(943, glNamedProgramLocalParameter4dEXT, (GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, target, index, x, y, z, w), GLuint program; GLenum target; GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->program, call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(944, glMultiTexCoord2d, (GLenum target, GLdouble s, GLdouble t), (target, s, t), GLenum target; GLdouble s; GLdouble t;, (call->target, call->s, call->t))
+GL_PROC_SYNC_VOID(945, glFogCoorddvEXT, (const GLdouble *coord), (coord), const GLdouble *coord;, (call->coord))
+GL_PROC_SYNC(946, GLboolean, glAcquireKeyedMutexWin32EXT, (GLuint memory, GLuint64 key, GLuint timeout), (memory, key, timeout), GLuint memory; GLuint64 key; GLuint timeout;, (call->memory, call->key, call->timeout))
+GL_PROC_SYNC(947, GLboolean, glIsBufferARB, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_ASYNC(948, glTextureBuffer, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer), GLuint texture; GLenum internalformat; GLuint buffer;, (call->texture, call->internalformat, call->buffer))
+GL_PROC_SYNC_VOID(949, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays), GLsizei n; const GLuint *arrays;, (call->n, call->arrays))
+GL_PROC_SYNC_VOID(950, glGetBooleanIndexedvEXT, (GLenum target, GLuint index, GLboolean *data), (target, index, data), GLenum target; GLuint index; GLboolean *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(951, glBindVertexBuffers, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides), GLuint first; GLsizei count; const GLuint *buffers; const GLintptr *offsets; const GLsizei *strides;, (call->first, call->count, call->buffers, call->offsets, call->strides))
+GL_PROC_SYNC_VOID(952, glMap2f, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLenum target; GLfloat u1; GLfloat u2; GLint ustride; GLint uorder; GLfloat v1; GLfloat v2; GLint vstride; GLint vorder; const GLfloat *points;, (call->target, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->points))
+GL_PROC_SYNC_VOID(953, glGetPerfMonitorCounterStringAMD, (GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString), (group, counter, bufSize, length, counterString), GLuint group; GLuint counter; GLsizei bufSize; GLsizei *length; GLchar *counterString;, (call->group, call->counter, call->bufSize, call->length, call->counterString))
+GL_PROC_ASYNC(954, glOrthoxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f), GLfixed l; GLfixed r; GLfixed b; GLfixed t; GLfixed n; GLfixed f;, (call->l, call->r, call->b, call->t, call->n, call->f))
+GL_PROC_ASYNC(955, glNormal3f, (GLfloat nx, GLfloat ny, GLfloat nz), (nx, ny, nz), GLfloat nx; GLfloat ny; GLfloat nz;, (call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(956, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(957, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(958, glProgramUniformMatrix3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(959, glResumeTransformFeedbackNV, (void), (), , ())
+GL_PROC_SYNC_VOID(960, glGetUniformivARB, (GLhandleARB programObj, GLint location, GLint *params), (programObj, location, params), GLhandleARB programObj; GLint location; GLint *params;, (call->programObj, call->location, call->params))
+GL_PROC_ASYNC(961, glUniform2d, (GLint location, GLdouble x, GLdouble y), (location, x, y), GLint location; GLdouble x; GLdouble y;, (call->location, call->x, call->y))
+GL_PROC_ASYNC(962, glRenderbufferStorageMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, coverageSamples, colorSamples, internalformat, width, height), GLenum target; GLsizei coverageSamples; GLsizei colorSamples; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->coverageSamples, call->colorSamples, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(963, glTextureStorage3DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations), GLuint texture; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedsamplelocations;, (call->texture, call->samples, call->internalformat, call->width, call->height, call->depth, call->fixedsamplelocations))
+GL_PROC_ASYNC(964, glSampleMaskIndexedNV, (GLuint index, GLbitfield mask), (index, mask), GLuint index; GLbitfield mask;, (call->index, call->mask))
+GL_PROC_SYNC_VOID(965, glFramebufferSampleLocationsfvNV, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v), GLenum target; GLuint start; GLsizei count; const GLfloat *v;, (call->target, call->start, call->count, call->v))
+GL_PROC_SYNC_VOID(966, glMatrixMult3x2fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_SYNC_VOID(967, glGetnHistogramARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLenum target; GLboolean reset; GLenum format; GLenum type; GLsizei bufSize; void *values;, (call->target, call->reset, call->format, call->type, call->bufSize, call->values))
+GL_PROC_SYNC_VOID(968, glGetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params), GLenum target; GLint level; GLenum pname; GLint *params;, (call->target, call->level, call->pname, call->params))
+GL_PROC_ASYNC(969, glProgramUniform3i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLint v0; GLint v1; GLint v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(970, glCopyImageSubDataNV, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth), GLuint srcName; GLenum srcTarget; GLint srcLevel; GLint srcX; GLint srcY; GLint srcZ; GLuint dstName; GLenum dstTarget; GLint dstLevel; GLint dstX; GLint dstY; GLint dstZ; GLsizei width; GLsizei height; GLsizei depth;, (call->srcName, call->srcTarget, call->srcLevel, call->srcX, call->srcY, call->srcZ, call->dstName, call->dstTarget, call->dstLevel, call->dstX, call->dstY, call->dstZ, call->width, call->height, call->depth))
+GL_PROC_ASYNC(971, glUniformHandleui64NV, (GLint location, GLuint64 value), (location, value), GLint location; GLuint64 value;, (call->location, call->value))
+GL_PROC_ASYNC(972, glRasterPos3i, (GLint x, GLint y, GLint z), (x, y, z), GLint x; GLint y; GLint z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(973, glVertex3i, (GLint x, GLint y, GLint z), (x, y, z), GLint x; GLint y; GLint z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(974, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLsync sync; GLbitfield flags; GLuint64 timeout;, (call->sync, call->flags, call->timeout))
+GL_PROC_ASYNC(975, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedsamplelocations;, (call->target, call->samples, call->internalformat, call->width, call->height, call->depth, call->fixedsamplelocations))
+GL_PROC_ASYNC(976, glTextureMaterialEXT, (GLenum face, GLenum mode), (face, mode), GLenum face; GLenum mode;, (call->face, call->mode))
+GL_PROC_ASYNC(977, glUniform2fARB, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), GLint location; GLfloat v0; GLfloat v1;, (call->location, call->v0, call->v1))
+GL_PROC_SYNC_VOID(978, glGetFogFuncSGIS, (GLfloat *points), (points), GLfloat *points;, (call->points))
+GL_PROC_SYNC_CLIENT_ARRAY(979, glIndexPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride), GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_SYNC_VOID(980, glVertex3bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_SYNC_VOID(981, glUniform3fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(982, glClearBufferData, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data), GLenum target; GLenum internalformat; GLenum format; GLenum type; const void *data;, (call->target, call->internalformat, call->format, call->type, call->data))
+GL_PROC_SYNC_VOID(983, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices), (mode, start, end, count, type, indices), GLenum mode; GLuint start; GLuint end; GLsizei count; GLenum type; const GLvoid *indices;, (call->mode, call->start, call->end, call->count, call->type, call->indices))
+GL_PROC_SYNC_VOID(984, glGetMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLfloat *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(985, glTexEnvfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(986, glFogxOES, (GLenum pname, GLfixed param), (pname, param), GLenum pname; GLfixed param;, (call->pname, call->param))
+GL_PROC_ASYNC(987, glCopyTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width), GLuint texture; GLint level; GLint xoffset; GLint x; GLint y; GLsizei width;, (call->texture, call->level, call->xoffset, call->x, call->y, call->width))
+GL_PROC_ASYNC(988, glFramebufferFetchBarrierEXT, (void), (), , ())
+GL_PROC_SYNC_VOID(989, glVertex2iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(990, glGetNamedProgramLocalParameterdvEXT, (GLuint program, GLenum target, GLuint index, GLdouble *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; GLdouble *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_ASYNC(991, glBeginOcclusionQueryNV, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(992, glColor4fNormal3fVertex3fvSUN, (const GLfloat *c, const GLfloat *n, const GLfloat *v), (c, n, v), const GLfloat *c; const GLfloat *n; const GLfloat *v;, (call->c, call->n, call->v))
+GL_PROC_ASYNC(993, glStateCaptureNV, (GLuint state, GLenum mode), (state, mode), GLuint state; GLenum mode;, (call->state, call->mode))
+GL_PROC_SYNC_VOID(994, glProgramUniform2dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(995, glGetInvariantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data), GLuint id; GLenum value; GLint *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(996, glUpdateObjectBufferATI, (GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve), (buffer, offset, size, pointer, preserve), GLuint buffer; GLuint offset; GLsizei size; const void *pointer; GLenum preserve;, (call->buffer, call->offset, call->size, call->pointer, call->preserve))
+GL_PROC_ASYNC(997, glDeformSGIX, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_SYNC_CLIENT_ARRAY(998, glColorPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer), GLint size; GLenum type; GLsizei stride; GLsizei count; const void *pointer;, (call->size, call->type, call->stride, call->count, call->pointer))
+GL_PROC_SYNC_VOID(999, glGetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values), GLuint program; GLenum shadertype; GLuint index; GLenum pname; GLint *values;, (call->program, call->shadertype, call->index, call->pname, call->values))
+GL_PROC_SYNC_VOID(1000, glGetClipPlanefOES, (GLenum plane, GLfloat *equation), (plane, equation), GLenum plane; GLfloat *equation;, (call->plane, call->equation))
+GL_PROC_SYNC_VOID(1001, glTexImage2D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, height, border, format, type, pixels), GLenum target; GLint level; GLint internalFormat; GLsizei width; GLsizei height; GLint border; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->internalFormat, call->width, call->height, call->border, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(1002, glScalef, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(1003, glTextureBufferRangeEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, target, internalformat, buffer, offset, size), GLuint texture; GLenum target; GLenum internalformat; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->texture, call->target, call->internalformat, call->buffer, call->offset, call->size))
+GL_PROC_ASYNC(1004, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), GLenum target; GLenum internalformat; GLuint buffer;, (call->target, call->internalformat, call->buffer))
+GL_PROC_SYNC(1005, GLuint, glGenAsyncMarkersSGIX, (GLsizei range), (range), GLsizei range;, (call->range))
+GL_PROC_SYNC_VOID(1006, glGetShaderSourceARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source), (obj, maxLength, length, source), GLhandleARB obj; GLsizei maxLength; GLsizei *length; GLcharARB *source;, (call->obj, call->maxLength, call->length, call->source))
+GL_PROC_ASYNC(1007, glMapGrid2d, (GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2), (un, u1, u2, vn, v1, v2), GLint un; GLdouble u1; GLdouble u2; GLint vn; GLdouble v1; GLdouble v2;, (call->un, call->u1, call->u2, call->vn, call->v1, call->v2))
+GL_PROC_ASYNC(1008, glConvolutionParameteri, (GLenum target, GLenum pname, GLint params), (target, pname, params), GLenum target; GLenum pname; GLint params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1009, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(1010, glGetTransformFeedbackVaryingEXT, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLuint program; GLuint index; GLsizei bufSize; GLsizei *length; GLsizei *size; GLenum *type; GLchar *name;, (call->program, call->index, call->bufSize, call->length, call->size, call->type, call->name))
+GL_PROC_SYNC_VOID(1011, glGetPathDashArrayNV, (GLuint path, GLfloat *dashArray), (path, dashArray), GLuint path; GLfloat *dashArray;, (call->path, call->dashArray))
+GL_PROC_SYNC_VOID(1012, glGetProgramivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1013, glPixelStorei, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1014, glMultiDrawArraysIndirectAMD, (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride), (mode, indirect, primcount, stride), GLenum mode; const void *indirect; GLsizei primcount; GLsizei stride;, (call->mode, call->indirect, call->primcount, call->stride))
+GL_PROC_ASYNC(1015, glColor3f, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue), GLfloat red; GLfloat green; GLfloat blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(1016, glEvalCoord2d, (GLdouble u, GLdouble v), (u, v), GLdouble u; GLdouble v;, (call->u, call->v))
+GL_PROC_SYNC_VOID(1017, glTexCoord1bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_SYNC_VOID(1018, glClearNamedBufferSubDataEXT, (GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data), GLuint buffer; GLenum internalformat; GLsizeiptr offset; GLsizeiptr size; GLenum format; GLenum type; const void *data;, (call->buffer, call->internalformat, call->offset, call->size, call->format, call->type, call->data))
+GL_PROC_ASYNC(1019, glMultiTexBufferEXT, (GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer), (texunit, target, internalformat, buffer), GLenum texunit; GLenum target; GLenum internalformat; GLuint buffer;, (call->texunit, call->target, call->internalformat, call->buffer))
+GL_PROC_SYNC_VOID(1020, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1021, glCompressedTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, border, imageSize, bits), GLuint texture; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLint border; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->internalformat, call->width, call->border, call->imageSize, call->bits))
+GL_PROC_ASYNC(1022, glDrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount), GLenum mode; GLuint id; GLsizei instancecount;, (call->mode, call->id, call->instancecount))
+GL_PROC_ASYNC(1023, glProgramUniform1ui64ARB, (GLuint program, GLint location, GLuint64 x), (program, location, x), GLuint program; GLint location; GLuint64 x;, (call->program, call->location, call->x))
+GL_PROC_ASYNC(1024, glVertexAttribIFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride), GLuint index; GLint size; GLenum type; GLsizei stride;, (call->index, call->size, call->type, call->stride))
+GL_PROC_SYNC_VOID(1025, glSecondaryColor3hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(1026, glActiveTextureARB, (GLenum texture), (texture), GLenum texture;, (call->texture))
+GL_PROC_ASYNC(1027, glRasterPos4i, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w), GLint x; GLint y; GLint z; GLint w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1028, glGetnMapivARB, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLint *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_SYNC_VOID(1029, glVDPAUInitNV, (const void *vdpDevice, const void *getProcAddress), (vdpDevice, getProcAddress), const void *vdpDevice; const void *getProcAddress;, (call->vdpDevice, call->getProcAddress))
+GL_PROC_SYNC_VOID(1030, glMulticastBufferSubDataNV, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data), GLbitfield gpuMask; GLuint buffer; GLintptr offset; GLsizeiptr size; const void *data;, (call->gpuMask, call->buffer, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(1031, glUniform3i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), GLint location; GLsizei count; const GLint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(1032, glResetHistogramEXT, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(1033, glPathCommandsNV, (GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCommands, commands, numCoords, coordType, coords), GLuint path; GLsizei numCommands; const GLubyte *commands; GLsizei numCoords; GLenum coordType; const void *coords;, (call->path, call->numCommands, call->commands, call->numCoords, call->coordType, call->coords))
+GL_PROC_ASYNC(1034, glBlendColor, (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha), (red, green, blue, alpha), GLclampf red; GLclampf green; GLclampf blue; GLclampf alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(1035, glIndexFuncEXT, (GLenum func, GLclampf ref), (func, ref), GLenum func; GLclampf ref;, (call->func, call->ref))
+GL_PROC_SYNC_VOID(1036, glReplacementCodeubvSUN, (const GLubyte *code), (code), const GLubyte *code;, (call->code))
+GL_PROC_ASYNC(1037, glBindFragmentShaderATI, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_CLIENT_ARRAY(1038, glVariantPointerEXT, (GLuint id, GLenum type, GLuint stride, const void *addr), (id, type, stride, addr), GLuint id; GLenum type; GLuint stride; const void *addr;, (call->id, call->type, call->stride, call->addr))
+GL_PROC_SYNC_VOID(1039, glCompressedMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->imageSize, call->bits))
+GL_PROC_SYNC_CLIENT_ARRAY(1040, glVertexAttribPointerNV, (GLuint index, GLint fsize, GLenum type, GLsizei stride, const void *pointer), (index, fsize, type, stride, pointer), GLuint index; GLint fsize; GLenum type; GLsizei stride; const void *pointer;, (call->index, call->fsize, call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(1041, glVertexAttrib2dvNV, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(1042, glCurrentPaletteMatrixARB, (GLint index), (index), GLint index;, (call->index))
+GL_PROC_SYNC_VOID(1043, glFragmentLightModelivSGIX, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1044, glTextureStorage3DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, depth, fixedsamplelocations), GLuint texture; GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedsamplelocations;, (call->texture, call->target, call->samples, call->internalformat, call->width, call->height, call->depth, call->fixedsamplelocations))
+GL_PROC_ASYNC(1045, glScaled, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1046, glGetShadingRateImagePaletteNV, (GLuint viewport, GLuint entry, GLenum *rate), (viewport, entry, rate), GLuint viewport; GLuint entry; GLenum *rate;, (call->viewport, call->entry, call->rate))
+GL_PROC_SYNC_VOID(1047, glTexCoord4fColor4fNormal3fVertex4fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v), const GLfloat *tc; const GLfloat *c; const GLfloat *n; const GLfloat *v;, (call->tc, call->c, call->n, call->v))
+GL_PROC_ASYNC(1048, glTexCoord2i, (GLint s, GLint t), (s, t), GLint s; GLint t;, (call->s, call->t))
+GL_PROC_ASYNC(1049, glFragmentLightModelfSGIX, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1050, glColorTableParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1051, glFogfv, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1052, glMultiTexCoord2i, (GLenum target, GLint s, GLint t), (target, s, t), GLenum target; GLint s; GLint t;, (call->target, call->s, call->t))
+GL_PROC_ASYNC(1053, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, r, g, b, a, nx, ny, nz, x, y, z), GLuint rc; GLfloat s; GLfloat t; GLfloat r; GLfloat g; GLfloat b; GLfloat a; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->s, call->t, call->r, call->g, call->b, call->a, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_ASYNC(1054, glEvaluateDepthValuesARB, (void), (), , ())
+GL_PROC_SYNC_VOID(1055, glMultiDrawArraysIndirectBindlessNV, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, stride, vertexBufferCount), GLenum mode; const void *indirect; GLsizei drawCount; GLsizei stride; GLint vertexBufferCount;, (call->mode, call->indirect, call->drawCount, call->stride, call->vertexBufferCount))
+GL_PROC_ASYNC(1056, glMultiTexCoord3d, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r), GLenum target; GLdouble s; GLdouble t; GLdouble r;, (call->target, call->s, call->t, call->r))
+GL_PROC_ASYNC(1057, glMultiTexCoord1iARB, (GLenum target, GLint s), (target, s), GLenum target; GLint s;, (call->target, call->s))
+GL_PROC_SYNC_VOID(1058, glGetInvariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data), GLuint id; GLenum value; GLboolean *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(1059, glDeleteProgramsNV, (GLsizei n, const GLuint *programs), (n, programs), GLsizei n; const GLuint *programs;, (call->n, call->programs))
+GL_PROC_SYNC_CLIENT_ARRAY(1060, glVertexWeightPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->size, call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(1061, glGetPathTexGenivNV, (GLenum texCoordSet, GLenum pname, GLint *value), (texCoordSet, pname, value), GLenum texCoordSet; GLenum pname; GLint *value;, (call->texCoordSet, call->pname, call->value))
+GL_PROC_SYNC_VOID(1062, glGetnPolygonStipple, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern), GLsizei bufSize; GLubyte *pattern;, (call->bufSize, call->pattern))
+GL_PROC_ASYNC(1063, glVertexAttrib4fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1064, glGlobalAlphaFactorubSUN, (GLubyte factor), (factor), GLubyte factor;, (call->factor))
+GL_PROC_ASYNC(1065, glTexCoord3d, (GLdouble s, GLdouble t, GLdouble r), (s, t, r), GLdouble s; GLdouble t; GLdouble r;, (call->s, call->t, call->r))
+GL_PROC_ASYNC(1066, glActiveProgramEXT, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_SYNC_VOID(1067, glTexCoord4hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_SYNC_VOID(1068, glProgramUniformMatrix2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1069, glIndexi, (GLint c), (c), GLint c;, (call->c))
+GL_PROC_SYNC_VOID(1070, glClipPlane, (GLenum plane, const GLdouble *equation), (plane, equation), GLenum plane; const GLdouble *equation;, (call->plane, call->equation))
+GL_PROC_ASYNC(1071, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), GLenum modeRGB; GLenum modeAlpha;, (call->modeRGB, call->modeAlpha))
+GL_PROC_SYNC_VOID(1072, glGetProgramResourceiv, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, bufSize, length, params), GLuint program; GLenum programInterface; GLuint index; GLsizei propCount; const GLenum *props; GLsizei bufSize; GLsizei *length; GLint *params;, (call->program, call->programInterface, call->index, call->propCount, call->props, call->bufSize, call->length, call->params))
+GL_PROC_ASYNC(1073, glMaxShaderCompilerThreadsKHR, (GLuint count), (count), GLuint count;, (call->count))
+GL_PROC_SYNC_VOID(1074, glTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(1075, glPixelTexGenParameterfvSGIS, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(1076, glTexEnvxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params), GLenum target; GLenum pname; const GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1077, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), GLint location; GLfloat v0; GLfloat v1; GLfloat v2; GLfloat v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(1078, glPrioritizeTexturesxOES, (GLsizei n, const GLuint *textures, const GLfixed *priorities), (n, textures, priorities), GLsizei n; const GLuint *textures; const GLfixed *priorities;, (call->n, call->textures, call->priorities))
+GL_PROC_SYNC_VOID(1079, glCompressedTexSubImage1DARB, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLsizei imageSize; const void *data;, (call->target, call->level, call->xoffset, call->width, call->format, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(1080, glMultiModeDrawElementsIBM, (const GLenum *mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, GLint modestride), (mode, count, type, indices, primcount, modestride), const GLenum *mode; const GLsizei *count; GLenum type; const void *const*indices; GLsizei primcount; GLint modestride;, (call->mode, call->count, call->type, call->indices, call->primcount, call->modestride))
+GL_PROC_SYNC_VOID(1081, glUniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices), GLenum shadertype; GLsizei count; const GLuint *indices;, (call->shadertype, call->count, call->indices))
+GL_PROC_SYNC_VOID(1082, glProgramUniform1iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1083, glNamedFramebufferTexture3DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (framebuffer, attachment, textarget, texture, level, zoffset), GLuint framebuffer; GLenum attachment; GLenum textarget; GLuint texture; GLint level; GLint zoffset;, (call->framebuffer, call->attachment, call->textarget, call->texture, call->level, call->zoffset))
+GL_PROC_ASYNC(1084, glCopyMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texunit, target, level, xoffset, x, y, width), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint x; GLint y; GLsizei width;, (call->texunit, call->target, call->level, call->xoffset, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(1085, glVertexStream4dvATI, (GLenum stream, const GLdouble *coords), (stream, coords), GLenum stream; const GLdouble *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(1086, glVertexStream1dATI, (GLenum stream, GLdouble x), (stream, x), GLenum stream; GLdouble x;, (call->stream, call->x))
+GL_PROC_SYNC_VOID(1087, glGetTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; GLint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1088, glUniform3iARB, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), GLint location; GLint v0; GLint v1; GLint v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(1089, glWindowPos2fARB, (GLfloat x, GLfloat y), (x, y), GLfloat x; GLfloat y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(1090, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name), GLuint program; GLuint color; const GLchar *name;, (call->program, call->color, call->name))
+GL_PROC_SYNC_VOID(1091, glGetSemaphoreParameterui64vEXT, (GLuint semaphore, GLenum pname, GLuint64 *params), (semaphore, pname, params), GLuint semaphore; GLenum pname; GLuint64 *params;, (call->semaphore, call->pname, call->params))
+GL_PROC_SYNC_VOID(1092, glUniform2uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1093, glGetColorTableParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1094, glMakeNamedBufferResidentNV, (GLuint buffer, GLenum access), (buffer, access), GLuint buffer; GLenum access;, (call->buffer, call->access))
+GL_PROC_ASYNC(1095, glVertexAttribL3i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z), (index, x, y, z), GLuint index; GLint64EXT x; GLint64EXT y; GLint64EXT z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1096, glGetTexParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params), GLenum target; GLenum pname; GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1097, glDetachObjectARB, (GLhandleARB containerObj, GLhandleARB attachedObj), (containerObj, attachedObj), GLhandleARB containerObj; GLhandleARB attachedObj;, (call->containerObj, call->attachedObj))
+GL_PROC_ASYNC(1098, glUnlockArraysEXT, (void), (), , ())
+GL_PROC_SYNC(1099, GLenum, glObjectPurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option), GLenum objectType; GLuint name; GLenum option;, (call->objectType, call->name, call->option))
+GL_PROC_SYNC_VOID(1100, glGetNamedProgramLocalParameterIuivEXT, (GLuint program, GLenum target, GLuint index, GLuint *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; GLuint *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_ASYNC(1101, glBlendBarrierNV, (void), (), , ())
+GL_PROC_SYNC_VOID(1102, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, tc, c, n, v), const GLuint *rc; const GLfloat *tc; const GLfloat *c; const GLfloat *n; const GLfloat *v;, (call->rc, call->tc, call->c, call->n, call->v))
+GL_PROC_SYNC_VOID(1103, glVertexAttribs4hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v), GLuint index; GLsizei n; const GLhalfNV *v;, (call->index, call->n, call->v))
+GL_PROC_SYNC_VOID(1104, glGetSharpenTexFuncSGIS, (GLenum target, GLfloat *points), (target, points), GLenum target; GLfloat *points;, (call->target, call->points))
+GL_PROC_SYNC_VOID(1105, glGetMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points), (target, index, type, ustride, vstride, packed, points), GLenum target; GLuint index; GLenum type; GLsizei ustride; GLsizei vstride; GLboolean packed; void *points;, (call->target, call->index, call->type, call->ustride, call->vstride, call->packed, call->points))
+GL_PROC_ASYNC(1106, glMaxShaderCompilerThreadsARB, (GLuint count), (count), GLuint count;, (call->count))
+GL_PROC_ASYNC(1107, glUniform1iARB, (GLint location, GLint v0), (location, v0), GLint location; GLint v0;, (call->location, call->v0))
+GL_PROC_SYNC_VOID(1108, glMultiTexCoord3ivARB, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1109, glNormal3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(1110, glVertexAttrib2fNV, (GLuint index, GLfloat x, GLfloat y), (index, x, y), GLuint index; GLfloat x; GLfloat y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(1111, glNamedBufferStorageEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags), GLuint buffer; GLsizeiptr size; const void *data; GLbitfield flags;, (call->buffer, call->size, call->data, call->flags))
+GL_PROC_SYNC_VOID(1112, glGetDetailTexFuncSGIS, (GLenum target, GLfloat *points), (target, points), GLenum target; GLfloat *points;, (call->target, call->points))
+GL_PROC_ASYNC(1113, glNormal3d, (GLdouble nx, GLdouble ny, GLdouble nz), (nx, ny, nz), GLdouble nx; GLdouble ny; GLdouble nz;, (call->nx, call->ny, call->nz))
+GL_PROC_ASYNC(1114, glFragmentLightModeliSGIX, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1115, glRectsv, (const GLshort *v1, const GLshort *v2), (v1, v2), const GLshort *v1; const GLshort *v2;, (call->v1, call->v2))
+GL_PROC_SYNC_VOID(1116, glGetInternalformati64v, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params), (target, internalformat, pname, bufSize, params), GLenum target; GLenum internalformat; GLenum pname; GLsizei bufSize; GLint64 *params;, (call->target, call->internalformat, call->pname, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(1117, glGenProgramsARB, (GLsizei n, GLuint *programs), (n, programs), GLsizei n; GLuint *programs;, (call->n, call->programs))
+GL_PROC_SYNC_VOID(1118, glViewportIndexedfv, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1119, glProgramStringARB, (GLenum target, GLenum format, GLsizei len, const void *string), (target, format, len, string), GLenum target; GLenum format; GLsizei len; const void *string;, (call->target, call->format, call->len, call->string))
+GL_PROC_ASYNC(1120, glWindowPos3dARB, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(1121, glFramebufferTexture2DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->target, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_ASYNC(1122, glCompileShaderARB, (GLhandleARB shaderObj), (shaderObj), GLhandleARB shaderObj;, (call->shaderObj))
+GL_PROC_SYNC(1123, GLboolean, glIsPointInStrokePathNV, (GLuint path, GLfloat x, GLfloat y), (path, x, y), GLuint path; GLfloat x; GLfloat y;, (call->path, call->x, call->y))
+GL_PROC_ASYNC(1124, glCopyNamedBufferSubData, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size), GLuint readBuffer; GLuint writeBuffer; GLintptr readOffset; GLintptr writeOffset; GLsizeiptr size;, (call->readBuffer, call->writeBuffer, call->readOffset, call->writeOffset, call->size))
+GL_PROC_ASYNC(1125, glTexCoord3hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r), (s, t, r), GLhalfNV s; GLhalfNV t; GLhalfNV r;, (call->s, call->t, call->r))
+GL_PROC_ASYNC(1126, glSubpixelPrecisionBiasNV, (GLuint xbits, GLuint ybits), (xbits, ybits), GLuint xbits; GLuint ybits;, (call->xbits, call->ybits))
+GL_PROC_SYNC_VOID(1127, glDetailTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points), GLenum target; GLsizei n; const GLfloat *points;, (call->target, call->n, call->points))
+GL_PROC_ASYNC(1128, glBlendBarrierKHR, (void), (), , ())
+GL_PROC_ASYNC(1129, glSecondaryColor3dEXT, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue), GLdouble red; GLdouble green; GLdouble blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1130, glVertexAttrib2fvARB, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_ASYNC(1131, glSetFenceNV, (GLuint fence, GLenum condition), (fence, condition), GLuint fence; GLenum condition;, (call->fence, call->condition))
+GL_PROC_SYNC_VOID(1132, glGetVideouivNV, (GLuint video_slot, GLenum pname, GLuint *params), (video_slot, pname, params), GLuint video_slot; GLenum pname; GLuint *params;, (call->video_slot, call->pname, call->params))
+GL_PROC_SYNC_VOID(1133, glGetnConvolutionFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image), GLenum target; GLenum format; GLenum type; GLsizei bufSize; void *image;, (call->target, call->format, call->type, call->bufSize, call->image))
+GL_PROC_SYNC_VOID(1134, glCreateStatesNV, (GLsizei n, GLuint *states), (n, states), GLsizei n; GLuint *states;, (call->n, call->states))
+GL_PROC_SYNC_VOID(1135, glVertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1136, glGetProgramNamedParameterdvNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble *params), (id, len, name, params), GLuint id; GLsizei len; const GLubyte *name; GLdouble *params;, (call->id, call->len, call->name, call->params))
+GL_PROC_ASYNC(1137, glDepthBoundsdNV, (GLdouble zmin, GLdouble zmax), (zmin, zmax), GLdouble zmin; GLdouble zmax;, (call->zmin, call->zmax))
+GL_PROC_SYNC_VOID(1138, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), GLenum mode; GLuint start; GLuint end; GLsizei count; GLenum type; const void *indices; GLint basevertex;, (call->mode, call->start, call->end, call->count, call->type, call->indices, call->basevertex))
+GL_PROC_ASYNC(1139, glCopyMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texunit, target, level, internalformat, x, y, width, border), GLenum texunit; GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLint border;, (call->texunit, call->target, call->level, call->internalformat, call->x, call->y, call->width, call->border))
+GL_PROC_ASYNC(1140, glQueryCounter, (GLuint id, GLenum target), (id, target), GLuint id; GLenum target;, (call->id, call->target))
+GL_PROC_ASYNC(1141, glMaterialxOES, (GLenum face, GLenum pname, GLfixed param), (face, pname, param), GLenum face; GLenum pname; GLfixed param;, (call->face, call->pname, call->param))
+GL_PROC_SYNC_VOID(1142, glGetMinmaxEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values), GLenum target; GLboolean reset; GLenum format; GLenum type; void *values;, (call->target, call->reset, call->format, call->type, call->values))
+GL_PROC_ASYNC(1143, glCombinerOutputNV, (GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum), (stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum), GLenum stage; GLenum portion; GLenum abOutput; GLenum cdOutput; GLenum sumOutput; GLenum scale; GLenum bias; GLboolean abDotProduct; GLboolean cdDotProduct; GLboolean muxSum;, (call->stage, call->portion, call->abOutput, call->cdOutput, call->sumOutput, call->scale, call->bias, call->abDotProduct, call->cdDotProduct, call->muxSum))
+GL_PROC_SYNC_VOID(1144, glGetConvolutionParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1145, glUseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program), GLuint pipeline; GLbitfield stages; GLuint program;, (call->pipeline, call->stages, call->program))
+GL_PROC_ASYNC(1146, glVertexAttrib4ubNV, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), GLuint index; GLubyte x; GLubyte y; GLubyte z; GLubyte w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1147, glDispatchComputeIndirect, (GLintptr indirect), (indirect), GLintptr indirect;, (call->indirect))
+GL_PROC_SYNC_VOID(1148, glColor4usv, (const GLushort *v), (v), const GLushort *v;, (call->v))
+GL_PROC_ASYNC(1149, glNamedCopyBufferSubDataEXT, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size), GLuint readBuffer; GLuint writeBuffer; GLintptr readOffset; GLintptr writeOffset; GLsizeiptr size;, (call->readBuffer, call->writeBuffer, call->readOffset, call->writeOffset, call->size))
+GL_PROC_ASYNC(1150, glDrawArraysInstancedARB, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount), GLenum mode; GLint first; GLsizei count; GLsizei primcount;, (call->mode, call->first, call->count, call->primcount))
+GL_PROC_ASYNC(1151, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), GLuint program; GLuint uniformBlockIndex; GLuint uniformBlockBinding;, (call->program, call->uniformBlockIndex, call->uniformBlockBinding))
+GL_PROC_SYNC_VOID(1152, glVertexAttribL3dvEXT, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC(1153, GLboolean, glIsProgram, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_SYNC_VOID(1154, glCompressedTexImage2DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLint border; GLsizei imageSize; const void *data;, (call->target, call->level, call->internalformat, call->width, call->height, call->border, call->imageSize, call->data))
+GL_PROC_SYNC(1155, GLushort, glGetStageIndexNV, (GLenum shadertype), (shadertype), GLenum shadertype;, (call->shadertype))
+GL_PROC_ASYNC(1156, glDrawVkImageNV, (GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (vkImage, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1), GLuint64 vkImage; GLuint sampler; GLfloat x0; GLfloat y0; GLfloat x1; GLfloat y1; GLfloat z; GLfloat s0; GLfloat t0; GLfloat s1; GLfloat t1;, (call->vkImage, call->sampler, call->x0, call->y0, call->x1, call->y1, call->z, call->s0, call->t0, call->s1, call->t1))
+GL_PROC_ASYNC(1157, glActiveStencilFaceEXT, (GLenum face), (face), GLenum face;, (call->face))
+GL_PROC_ASYNC(1158, glCompileCommandListNV, (GLuint list), (list), GLuint list;, (call->list))
+GL_PROC_ASYNC(1159, glPushClientAttrib, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_SYNC_VOID(1160, glGetnUniformi64vARB, (GLuint program, GLint location, GLsizei bufSize, GLint64 *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLint64 *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(1161, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei instancecount; GLint basevertex; GLuint baseinstance;, (call->mode, call->count, call->type, call->indices, call->instancecount, call->basevertex, call->baseinstance))
+GL_PROC_ASYNC(1162, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->level, call->xoffset, call->yoffset, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(1163, glClearDepth, (GLclampd depth), (depth), GLclampd depth;, (call->depth))
+GL_PROC_SYNC_VOID(1164, glVertexAttribL3dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1165, glTextureRangeAPPLE, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer), GLenum target; GLsizei length; const void *pointer;, (call->target, call->length, call->pointer))
+GL_PROC_SYNC_VOID(1166, glEvalCoord2fv, (const GLfloat *u), (u), const GLfloat *u;, (call->u))
+GL_PROC_ASYNC(1167, glVertexStream1sATI, (GLenum stream, GLshort x), (stream, x), GLenum stream; GLshort x;, (call->stream, call->x))
+GL_PROC_ASYNC(1168, glReplacementCodeuiVertex3fSUN, (GLuint rc, GLfloat x, GLfloat y, GLfloat z), (rc, x, y, z), GLuint rc; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1169, glProgramUniform4uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1170, glRasterPos4xOES, (GLfixed x, GLfixed y, GLfixed z, GLfixed w), (x, y, z, w), GLfixed x; GLfixed y; GLfixed z; GLfixed w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1171, glProgramNamedParameter4dvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v), (id, len, name, v), GLuint id; GLsizei len; const GLubyte *name; const GLdouble *v;, (call->id, call->len, call->name, call->v))
+GL_PROC_ASYNC(1172, glLighti, (GLenum light, GLenum pname, GLint param), (light, pname, param), GLenum light; GLenum pname; GLint param;, (call->light, call->pname, call->param))
+GL_PROC_SYNC_CLIENT_ARRAY(1173, glTexCoordPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer), GLint size; GLenum type; const void **pointer;, (call->size, call->type, call->pointer))
+GL_PROC_ASYNC(1174, glClampColorARB, (GLenum target, GLenum clamp), (target, clamp), GLenum target; GLenum clamp;, (call->target, call->clamp))
+GL_PROC_SYNC_VOID(1175, glVertex4xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(1176, glRotated, (GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (angle, x, y, z), GLdouble angle; GLdouble x; GLdouble y; GLdouble z;, (call->angle, call->x, call->y, call->z))
+GL_PROC_ASYNC(1177, glBindBufferOffsetNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset), GLenum target; GLuint index; GLuint buffer; GLintptr offset;, (call->target, call->index, call->buffer, call->offset))
+GL_PROC_SYNC_VOID(1178, glWindowPos2dvARB, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(1179, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), GLuint index; GLshort x; GLshort y; GLshort z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1180, glGetPathMetricRangeNV, (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics), (metricQueryMask, firstPathName, numPaths, stride, metrics), GLbitfield metricQueryMask; GLuint firstPathName; GLsizei numPaths; GLsizei stride; GLfloat *metrics;, (call->metricQueryMask, call->firstPathName, call->numPaths, call->stride, call->metrics))
+GL_PROC_ASYNC(1181, glMultiTexGeniEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint param), (texunit, coord, pname, param), GLenum texunit; GLenum coord; GLenum pname; GLint param;, (call->texunit, call->coord, call->pname, call->param))
+GL_PROC_SYNC_VOID(1182, glGetMapfv, (GLenum target, GLenum query, GLfloat *v), (target, query, v), GLenum target; GLenum query; GLfloat *v;, (call->target, call->query, call->v))
+GL_PROC_ASYNC(1183, glTexImage3DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations), GLenum target; GLsizei coverageSamples; GLsizei colorSamples; GLint internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedSampleLocations;, (call->target, call->coverageSamples, call->colorSamples, call->internalFormat, call->width, call->height, call->depth, call->fixedSampleLocations))
+GL_PROC_ASYNC(1184, glTangent3dEXT, (GLdouble tx, GLdouble ty, GLdouble tz), (tx, ty, tz), GLdouble tx; GLdouble ty; GLdouble tz;, (call->tx, call->ty, call->tz))
+GL_PROC_ASYNC(1185, glMapGrid1d, (GLint un, GLdouble u1, GLdouble u2), (un, u1, u2), GLint un; GLdouble u1; GLdouble u2;, (call->un, call->u1, call->u2))
+GL_PROC_SYNC(1186, GLboolean, glIsQueryARB, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1187, glMultiTexCoord1fARB, (GLenum target, GLfloat s), (target, s), GLenum target; GLfloat s;, (call->target, call->s))
+GL_PROC_SYNC_VOID(1188, glProgramLocalParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLint *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(1189, glDebugMessageEnableAMD, (GLenum category, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (category, severity, count, ids, enabled), GLenum category; GLenum severity; GLsizei count; const GLuint *ids; GLboolean enabled;, (call->category, call->severity, call->count, call->ids, call->enabled))
+GL_PROC_ASYNC(1190, glEndConditionalRenderNV, (void), (), , ())
+GL_PROC_SYNC_VOID(1191, glGetMinmaxParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1192, glDeleteFencesNV, (GLsizei n, const GLuint *fences), (n, fences), GLsizei n; const GLuint *fences;, (call->n, call->fences))
+GL_PROC_ASYNC(1193, glVertexAttribL2dEXT, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLuint index; GLdouble x; GLdouble y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(1194, glViewportSwizzleNV, (GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew), (index, swizzlex, swizzley, swizzlez, swizzlew), GLuint index; GLenum swizzlex; GLenum swizzley; GLenum swizzlez; GLenum swizzlew;, (call->index, call->swizzlex, call->swizzley, call->swizzlez, call->swizzlew))
+GL_PROC_SYNC_VOID(1195, glRasterPos3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(1196, glProgramUniform2fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1197, glWindowPos4ivMESA, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(1198, glMultiTexCoord1xvOES, (GLenum texture, const GLfixed *coords), (texture, coords), GLenum texture; const GLfixed *coords;, (call->texture, call->coords))
+GL_PROC_SYNC_VOID(1199, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params), GLuint id; GLenum pname; GLuint64 *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(1200, glGenQueriesARB, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(1201, glCompressedTexImage1DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLint border; GLsizei imageSize; const void *data;, (call->target, call->level, call->internalformat, call->width, call->border, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(1202, glUniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1203, glDisableVariantClientStateEXT, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1204, glTexCoord4bOES, (GLbyte s, GLbyte t, GLbyte r, GLbyte q), (s, t, r, q), GLbyte s; GLbyte t; GLbyte r; GLbyte q;, (call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(1205, glMultiTexCoord4i, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q), GLenum target; GLint s; GLint t; GLint r; GLint q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(1206, glInvalidateTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth))
+GL_PROC_SYNC_VOID(1207, glGetnMinmaxARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLenum target; GLboolean reset; GLenum format; GLenum type; GLsizei bufSize; void *values;, (call->target, call->reset, call->format, call->type, call->bufSize, call->values))
+GL_PROC_ASYNC(1208, glEvalMapsNV, (GLenum target, GLenum mode), (target, mode), GLenum target; GLenum mode;, (call->target, call->mode))
+GL_PROC_SYNC_VOID(1209, glGenBuffersARB, (GLsizei n, GLuint *buffers), (n, buffers), GLsizei n; GLuint *buffers;, (call->n, call->buffers))
+GL_PROC_ASYNC(1210, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; GLuint value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(1211, glMultiTexCoord2dvARB, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_ASYNC(1212, glPopAttrib, (void), (), , ())
+GL_PROC_SYNC(1213, GLuint, glBindLightParameterEXT, (GLenum light, GLenum value), (light, value), GLenum light; GLenum value;, (call->light, call->value))
+GL_PROC_ASYNC(1214, glVertexAttribL3ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (index, x, y, z), GLuint index; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1215, glUniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1216, glProgramUniformMatrix2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1217, glFramebufferTextureARB, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), GLenum target; GLenum attachment; GLuint texture; GLint level;, (call->target, call->attachment, call->texture, call->level))
+GL_PROC_SYNC_VOID(1218, glProgramUniform4dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1219, glVertexAttribI2iv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(1220, glActiveTexture, (GLenum texture), (texture), GLenum texture;, (call->texture))
+GL_PROC_ASYNC(1221, glBindVertexArrayAPPLE, (GLuint array), (array), GLuint array;, (call->array))
+GL_PROC_SYNC_VOID(1222, glPixelDataRangeNV, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer), GLenum target; GLsizei length; const void *pointer;, (call->target, call->length, call->pointer))
+GL_PROC_ASYNC(1223, glLockArraysEXT, (GLint first, GLsizei count), (first, count), GLint first; GLsizei count;, (call->first, call->count))
+GL_PROC_SYNC_VOID(1224, glTexGeniv, (GLenum coord, GLenum pname, const GLint *params), (coord, pname, params), GLenum coord; GLenum pname; const GLint *params;, (call->coord, call->pname, call->params))
+GL_PROC_ASYNC(1225, glMap2xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLenum target; GLfixed u1; GLfixed u2; GLint ustride; GLint uorder; GLfixed v1; GLfixed v2; GLint vstride; GLint vorder; GLfixed points;, (call->target, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->points))
+GL_PROC_ASYNC(1226, glColorP3ui, (GLenum type, GLuint color), (type, color), GLenum type; GLuint color;, (call->type, call->color))
+GL_PROC_SYNC_VOID(1227, glFinish, (void), (), , ())
+GL_PROC_SYNC_VOID(1228, glGetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params), GLenum target; GLint level; GLenum pname; GLfloat *params;, (call->target, call->level, call->pname, call->params))
+GL_PROC_SYNC_VOID(1229, glGetQueryObjectuivARB, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), GLuint id; GLenum pname; GLuint *params;, (call->id, call->pname, call->params))
+GL_PROC_ASYNC(1230, glEndVideoCaptureNV, (GLuint video_capture_slot), (video_capture_slot), GLuint video_capture_slot;, (call->video_capture_slot))
+GL_PROC_ASYNC(1231, glMultiTexCoord1f, (GLenum target, GLfloat s), (target, s), GLenum target; GLfloat s;, (call->target, call->s))
+GL_PROC_ASYNC(1232, glRasterPos2d, (GLdouble x, GLdouble y), (x, y), GLdouble x; GLdouble y;, (call->x, call->y))
+GL_PROC_ASYNC(1233, glSecondaryColor3f, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue), GLfloat red; GLfloat green; GLfloat blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1234, glProgramUniform1uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1235, glUniform3ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (location, x, y, z), GLint location; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z;, (call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(1236, glPixelZoomxOES, (GLfixed xfactor, GLfixed yfactor), (xfactor, yfactor), GLfixed xfactor; GLfixed yfactor;, (call->xfactor, call->yfactor))
+GL_PROC_SYNC_VOID(1237, glGenPerfMonitorsAMD, (GLsizei n, GLuint *monitors), (n, monitors), GLsizei n; GLuint *monitors;, (call->n, call->monitors))
+GL_PROC_SYNC_VOID(1238, glGetVertexAttribPointervNV, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), GLuint index; GLenum pname; void **pointer;, (call->index, call->pname, call->pointer))
+GL_PROC_SYNC(1239, GLboolean, glIsVertexAttribEnabledAPPLE, (GLuint index, GLenum pname), (index, pname), GLuint index; GLenum pname;, (call->index, call->pname))
+GL_PROC_ASYNC(1240, glMakeTextureHandleNonResidentNV, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(1241, glTextureStorage2DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, fixedsamplelocations), GLuint texture; GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLboolean fixedsamplelocations;, (call->texture, call->target, call->samples, call->internalformat, call->width, call->height, call->fixedsamplelocations))
+GL_PROC_ASYNC(1242, glBlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha), GLuint buf; GLenum modeRGB; GLenum modeAlpha;, (call->buf, call->modeRGB, call->modeAlpha))
+GL_PROC_ASYNC(1243, glNamedBufferStorageMemEXT, (GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset), (buffer, size, memory, offset), GLuint buffer; GLsizeiptr size; GLuint memory; GLuint64 offset;, (call->buffer, call->size, call->memory, call->offset))
+GL_PROC_ASYNC(1244, glEndPerfMonitorAMD, (GLuint monitor), (monitor), GLuint monitor;, (call->monitor))
+GL_PROC_SYNC_CLIENT_ARRAY(1245, glTangentPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLenum type; GLsizei stride; const void *pointer;, (call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(1246, glTangent3dvEXT, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(1247, glColor4d, (GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha), (red, green, blue, alpha), GLdouble red; GLdouble green; GLdouble blue; GLdouble alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(1248, glMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(1249, glReplacementCodeuiSUN, (GLuint code), (code), GLuint code;, (call->code))
+GL_PROC_SYNC_VOID(1250, glGetUniformi64vARB, (GLuint program, GLint location, GLint64 *params), (program, location, params), GLuint program; GLint location; GLint64 *params;, (call->program, call->location, call->params))
+GL_PROC_ASYNC(1251, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; GLuint value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(1252, glNamedProgramLocalParameter4dvEXT, (GLuint program, GLenum target, GLuint index, const GLdouble *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; const GLdouble *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_ASYNC(1253, glWriteMaskEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW), GLuint res; GLuint in; GLenum outX; GLenum outY; GLenum outZ; GLenum outW;, (call->res, call->in, call->outX, call->outY, call->outZ, call->outW))
+GL_PROC_SYNC_VOID(1254, glGetVariantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data), GLuint id; GLenum value; GLint *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(1255, glTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, const GLuint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; const GLuint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1256, glProgramUniform4i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (program, location, x, y, z, w), GLuint program; GLint location; GLint64 x; GLint64 y; GLint64 z; GLint64 w;, (call->program, call->location, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1257, glGetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params), GLenum target; GLuint index; GLenum pname; GLint *params;, (call->target, call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(1258, glProgramUniformHandleui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values), GLuint program; GLint location; GLsizei count; const GLuint64 *values;, (call->program, call->location, call->count, call->values))
+GL_PROC_ASYNC(1259, glPolygonOffsetEXT, (GLfloat factor, GLfloat bias), (factor, bias), GLfloat factor; GLfloat bias;, (call->factor, call->bias))
+GL_PROC_SYNC_VOID(1260, glMapVertexAttrib1dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (index, size, u1, u2, stride, order, points), GLuint index; GLuint size; GLdouble u1; GLdouble u2; GLint stride; GLint order; const GLdouble *points;, (call->index, call->size, call->u1, call->u2, call->stride, call->order, call->points))
+GL_PROC_ASYNC(1261, glMatrixTranslatefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z), GLenum mode; GLfloat x; GLfloat y; GLfloat z;, (call->mode, call->x, call->y, call->z))
+GL_PROC_SYNC(1262, GLboolean, glIsShader, (GLuint shader), (shader), GLuint shader;, (call->shader))
+GL_PROC_SYNC_VOID(1263, glVertexP2uiv, (GLenum type, const GLuint *value), (type, value), GLenum type; const GLuint *value;, (call->type, call->value))
+GL_PROC_SYNC_VOID(1264, glUniform1ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1265, glGetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params), GLuint program; GLint location; GLint *params;, (call->program, call->location, call->params))
+GL_PROC_ASYNC(1266, glPixelTransformParameterfEXT, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLenum target; GLenum pname; GLfloat param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(1267, glVertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1268, glMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLint *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; const GLint *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(1269, glProgramUniform2uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1270, glFogCoordfvEXT, (const GLfloat *coord), (coord), const GLfloat *coord;, (call->coord))
+GL_PROC_ASYNC(1271, glVertexAttribL1d, (GLuint index, GLdouble x), (index, x), GLuint index; GLdouble x;, (call->index, call->x))
+GL_PROC_SYNC(1272, GLsync, glCreateSyncFromCLeventARB, (struct _cl_context *context, struct _cl_event *event, GLbitfield flags), (context, event, flags), struct _cl_context *context; struct _cl_event *event; GLbitfield flags;, (call->context, call->event, call->flags))
+GL_PROC_SYNC(1273, GLboolean, glIsPathNV, (GLuint path), (path), GLuint path;, (call->path))
+GL_PROC_ASYNC(1274, glBindVertexArray, (GLuint array), (array), GLuint array;, (call->array))
+GL_PROC_ASYNC(1275, glMultiTexCoord1bOES, (GLenum texture, GLbyte s), (texture, s), GLenum texture; GLbyte s;, (call->texture, call->s))
+GL_PROC_SYNC_VOID(1276, glProgramEnvParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLfloat *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_ASYNC(1277, glSecondaryColor3bEXT, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue), GLbyte red; GLbyte green; GLbyte blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1278, glTexCoord2hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(1279, glBlendFunci, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst), GLuint buf; GLenum src; GLenum dst;, (call->buf, call->src, call->dst))
+GL_PROC_ASYNC(1280, glTextureStorageMem3DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, depth, memory, offset), GLuint texture; GLsizei levels; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLuint memory; GLuint64 offset;, (call->texture, call->levels, call->internalFormat, call->width, call->height, call->depth, call->memory, call->offset))
+GL_PROC_ASYNC(1281, glVertexAttrib3dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLuint index; GLdouble x; GLdouble y; GLdouble z;, (call->index, call->x, call->y, call->z))
+GL_PROC_ASYNC(1282, glReleaseShaderCompiler, (void), (), , ())
+GL_PROC_ASYNC(1283, glVertexStream2dATI, (GLenum stream, GLdouble x, GLdouble y), (stream, x, y), GLenum stream; GLdouble x; GLdouble y;, (call->stream, call->x, call->y))
+GL_PROC_ASYNC(1284, glInitNames, (void), (), , ())
+GL_PROC_ASYNC(1285, glWindowPos4sMESA, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w), GLshort x; GLshort y; GLshort z; GLshort w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1286, glImportSemaphoreWin32HandleEXT, (GLuint semaphore, GLenum handleType, void *handle), (semaphore, handleType, handle), GLuint semaphore; GLenum handleType; void *handle;, (call->semaphore, call->handleType, call->handle))
+GL_PROC_SYNC_VOID(1287, glColor3bv, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_ASYNC(1288, glAlphaToCoverageDitherControlNV, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(1289, glProgramUniform3iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLint v0; GLint v1; GLint v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(1290, glBlitNamedFramebuffer, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLuint readFramebuffer; GLuint drawFramebuffer; GLint srcX0; GLint srcY0; GLint srcX1; GLint srcY1; GLint dstX0; GLint dstY0; GLint dstX1; GLint dstY1; GLbitfield mask; GLenum filter;, (call->readFramebuffer, call->drawFramebuffer, call->srcX0, call->srcY0, call->srcX1, call->srcY1, call->dstX0, call->dstY0, call->dstX1, call->dstY1, call->mask, call->filter))
+GL_PROC_ASYNC(1291, glActiveShaderProgram, (GLuint pipeline, GLuint program), (pipeline, program), GLuint pipeline; GLuint program;, (call->pipeline, call->program))
+GL_PROC_SYNC_CLIENT_ARRAY(1292, glVertexAttribPointerARB, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer), GLuint index; GLint size; GLenum type; GLboolean normalized; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->normalized, call->stride, call->pointer))
+GL_PROC_ASYNC(1293, glTransformFeedbackBufferBase, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer), GLuint xfb; GLuint index; GLuint buffer;, (call->xfb, call->index, call->buffer))
+GL_PROC_SYNC_VOID(1294, glMapParameterivNV, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1295, glReplacementCodeusvSUN, (const GLushort *code), (code), const GLushort *code;, (call->code))
+GL_PROC_SYNC(1296, GLuint, glGenPathsNV, (GLsizei range), (range), GLsizei range;, (call->range))
+GL_PROC_SYNC_VOID(1297, glGetProgramResourceName, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name), GLuint program; GLenum programInterface; GLuint index; GLsizei bufSize; GLsizei *length; GLchar *name;, (call->program, call->programInterface, call->index, call->bufSize, call->length, call->name))
+GL_PROC_SYNC_VOID(1298, glPatchParameterfv, (GLenum pname, const GLfloat *values), (pname, values), GLenum pname; const GLfloat *values;, (call->pname, call->values))
+GL_PROC_SYNC_VOID(1299, glNamedProgramLocalParametersI4ivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params), (program, target, index, count, params), GLuint program; GLenum target; GLuint index; GLsizei count; const GLint *params;, (call->program, call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(1300, glVertexAttrib4dvARB, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1301, glProgramUniform2ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1302, glNamedFramebufferTextureLayer, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer), GLuint framebuffer; GLenum attachment; GLuint texture; GLint level; GLint layer;, (call->framebuffer, call->attachment, call->texture, call->level, call->layer))
+GL_PROC_SYNC_VOID(1303, glProgramUniformMatrix2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1304, glTexCoord1fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(1305, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers), GLsizei n; const GLuint *framebuffers;, (call->n, call->framebuffers))
+GL_PROC_SYNC_VOID(1306, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1307, glVertexWeightfEXT, (GLfloat weight), (weight), GLfloat weight;, (call->weight))
+GL_PROC_SYNC_VOID(1308, glMultiModeDrawArraysIBM, (const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride), (mode, first, count, primcount, modestride), const GLenum *mode; const GLint *first; const GLsizei *count; GLsizei primcount; GLint modestride;, (call->mode, call->first, call->count, call->primcount, call->modestride))
+GL_PROC_SYNC_VOID(1309, glGetnUniformui64vARB, (GLuint program, GLint location, GLsizei bufSize, GLuint64 *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLuint64 *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_ASYNC(1310, glTexCoord1i, (GLint s), (s), GLint s;, (call->s))
+GL_PROC_SYNC_VOID(1311, glVertexAttrib4svARB, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1312, glGetTexBumpParameterfvATI, (GLenum pname, GLfloat *param), (pname, param), GLenum pname; GLfloat *param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1313, glGetnCompressedTexImage, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels), GLenum target; GLint lod; GLsizei bufSize; void *pixels;, (call->target, call->lod, call->bufSize, call->pixels))
+GL_PROC_SYNC(1314, GLint, glGetProgramResourceLocation, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLuint program; GLenum programInterface; const GLchar *name;, (call->program, call->programInterface, call->name))
+GL_PROC_SYNC_VOID(1315, glMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLuint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLuint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1316, glProgramUniform1dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1317, glGetShaderPrecisionFormat, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision), GLenum shadertype; GLenum precisiontype; GLint *range; GLint *precision;, (call->shadertype, call->precisiontype, call->range, call->precision))
+GL_PROC_SYNC_VOID(1318, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->imageSize, call->data))
+GL_PROC_ASYNC(1319, glSecondaryColor3i, (GLint red, GLint green, GLint blue), (red, green, blue), GLint red; GLint green; GLint blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1320, glMultiTexCoord3hvNV, (GLenum target, const GLhalfNV *v), (target, v), GLenum target; const GLhalfNV *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1321, glDrawBuffersARB, (GLsizei n, const GLenum *bufs), (n, bufs), GLsizei n; const GLenum *bufs;, (call->n, call->bufs))
+GL_PROC_SYNC_VOID(1322, glSpecializeShader, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), GLuint shader; const GLchar *pEntryPoint; GLuint numSpecializationConstants; const GLuint *pConstantIndex; const GLuint *pConstantValue;, (call->shader, call->pEntryPoint, call->numSpecializationConstants, call->pConstantIndex, call->pConstantValue))
+GL_PROC_ASYNC(1323, glProgramUniform2i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y), (program, location, x, y), GLuint program; GLint location; GLint64 x; GLint64 y;, (call->program, call->location, call->x, call->y))
+GL_PROC_SYNC_VOID(1324, glGetMinmaxParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1325, glMultiDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, start, end, first, count, primcount), GLenum mode; GLuint start; GLuint end; const GLint *first; const GLsizei *count; GLsizei primcount;, (call->mode, call->start, call->end, call->first, call->count, call->primcount))
+GL_PROC_ASYNC(1326, glCompileShader, (GLuint shader), (shader), GLuint shader;, (call->shader))
+GL_PROC_SYNC(1327, GLboolean, glIsNamedStringARB, (GLint namelen, const GLchar *name), (namelen, name), GLint namelen; const GLchar *name;, (call->namelen, call->name))
+GL_PROC_ASYNC(1328, glPushAttrib, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_ASYNC(1329, glSamplePatternEXT, (GLenum pattern), (pattern), GLenum pattern;, (call->pattern))
+GL_PROC_SYNC_VOID(1330, glGetPixelTexGenParameterfvSGIS, (GLenum pname, GLfloat *params), (pname, params), GLenum pname; GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1331, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count), GLenum mode; GLint first; GLsizei count;, (call->mode, call->first, call->count))
+GL_PROC_SYNC_VOID(1332, glTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels), GLuint texture; GLint level; GLint xoffset; GLsizei width; GLenum format; GLenum type; const void *pixels;, (call->texture, call->level, call->xoffset, call->width, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(1333, glMultiTexCoord2fvARB, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(1334, glVertexArrayVertexAttribFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLboolean normalized; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->normalized, call->relativeoffset))
+GL_PROC_SYNC_VOID(1335, glSelectPerfMonitorCountersAMD, (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList), (monitor, enable, group, numCounters, counterList), GLuint monitor; GLboolean enable; GLuint group; GLint numCounters; GLuint *counterList;, (call->monitor, call->enable, call->group, call->numCounters, call->counterList))
+GL_PROC_SYNC(1336, GLboolean, glIsTextureHandleResidentNV, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(1337, glPointSize, (GLfloat size), (size), GLfloat size;, (call->size))
+GL_PROC_SYNC_VOID(1338, glGetVertexAttribLdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLuint index; GLenum pname; GLdouble *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(1339, glBindVideoCaptureStreamTextureNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture), (video_capture_slot, stream, frame_region, target, texture), GLuint video_capture_slot; GLuint stream; GLenum frame_region; GLenum target; GLuint texture;, (call->video_capture_slot, call->stream, call->frame_region, call->target, call->texture))
+GL_PROC_ASYNC(1340, glFlushMappedNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLuint buffer; GLintptr offset; GLsizeiptr length;, (call->buffer, call->offset, call->length))
+GL_PROC_ASYNC(1341, glPathParameteriNV, (GLuint path, GLenum pname, GLint value), (path, pname, value), GLuint path; GLenum pname; GLint value;, (call->path, call->pname, call->value))
+GL_PROC_SYNC_VOID(1342, glCombinerParameterivNV, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1343, glVertexBindingDivisor, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor), GLuint bindingindex; GLuint divisor;, (call->bindingindex, call->divisor))
+GL_PROC_SYNC_VOID(1344, glGetnPixelMapfv, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLfloat *values;, (call->map, call->bufSize, call->values))
+GL_PROC_SYNC_VOID(1345, glGenRenderbuffersEXT, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLsizei n; GLuint *renderbuffers;, (call->n, call->renderbuffers))
+GL_PROC_ASYNC(1346, glMultiTexCoord2bOES, (GLenum texture, GLbyte s, GLbyte t), (texture, s, t), GLenum texture; GLbyte s; GLbyte t;, (call->texture, call->s, call->t))
+GL_PROC_ASYNC(1347, glTexCoord4fColor4fNormal3fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w), GLfloat s; GLfloat t; GLfloat p; GLfloat q; GLfloat r; GLfloat g; GLfloat b; GLfloat a; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->s, call->t, call->p, call->q, call->r, call->g, call->b, call->a, call->nx, call->ny, call->nz, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1348, glGenerateTextureMipmap, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_SYNC_VOID(1349, glSecondaryColor3uiv, (const GLuint *v), (v), const GLuint *v;, (call->v))
+GL_PROC_SYNC_VOID(1350, glMultiTexCoord1fv, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(1351, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLint srcX0; GLint srcY0; GLint srcX1; GLint srcY1; GLint dstX0; GLint dstY0; GLint dstX1; GLint dstY1; GLbitfield mask; GLenum filter;, (call->srcX0, call->srcY0, call->srcX1, call->srcY1, call->dstX0, call->dstY0, call->dstX1, call->dstY1, call->mask, call->filter))
+GL_PROC_ASYNC(1352, glTextureBufferRange, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size), GLuint texture; GLenum internalformat; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->texture, call->internalformat, call->buffer, call->offset, call->size))
+GL_PROC_ASYNC(1353, glMultiTexCoord2dARB, (GLenum target, GLdouble s, GLdouble t), (target, s, t), GLenum target; GLdouble s; GLdouble t;, (call->target, call->s, call->t))
+GL_PROC_SYNC_VOID(1354, glGetMapiv, (GLenum target, GLenum query, GLint *v), (target, query, v), GLenum target; GLenum query; GLint *v;, (call->target, call->query, call->v))
+GL_PROC_ASYNC(1355, glProgramUniform3dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z), (program, location, x, y, z), GLuint program; GLint location; GLdouble x; GLdouble y; GLdouble z;, (call->program, call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(1356, glVertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset), GLuint attribindex; GLint size; GLenum type; GLboolean normalized; GLuint relativeoffset;, (call->attribindex, call->size, call->type, call->normalized, call->relativeoffset))
+GL_PROC_ASYNC(1357, glTextureStorage1D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width), GLuint texture; GLsizei levels; GLenum internalformat; GLsizei width;, (call->texture, call->levels, call->internalformat, call->width))
+GL_PROC_SYNC_VOID(1358, glGetNamedBufferParameteri64v, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLint64 *params;, (call->buffer, call->pname, call->params))
+GL_PROC_ASYNC(1359, glCopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth), GLuint srcName; GLenum srcTarget; GLint srcLevel; GLint srcX; GLint srcY; GLint srcZ; GLuint dstName; GLenum dstTarget; GLint dstLevel; GLint dstX; GLint dstY; GLint dstZ; GLsizei srcWidth; GLsizei srcHeight; GLsizei srcDepth;, (call->srcName, call->srcTarget, call->srcLevel, call->srcX, call->srcY, call->srcZ, call->dstName, call->dstTarget, call->dstLevel, call->dstX, call->dstY, call->dstZ, call->srcWidth, call->srcHeight, call->srcDepth))
+GL_PROC_SYNC_VOID(1360, glVertex3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(1361, glGetnMapiv, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLint *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_ASYNC(1362, glProgramEnvParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w), GLenum target; GLuint index; GLint x; GLint y; GLint z; GLint w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1363, glSignalVkSemaphoreNV, (GLuint64 vkSemaphore), (vkSemaphore), GLuint64 vkSemaphore;, (call->vkSemaphore))
+GL_PROC_ASYNC(1364, glTextureStorage3D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth), GLuint texture; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth;, (call->texture, call->levels, call->internalformat, call->width, call->height, call->depth))
+GL_PROC_SYNC_VOID(1365, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params), GLuint id; GLenum pname; GLint64 *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(1366, glFogiv, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(1367, glColorSubTable, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid *data), (target, start, count, format, type, data), GLenum target; GLsizei start; GLsizei count; GLenum format; GLenum type; const GLvoid *data;, (call->target, call->start, call->count, call->format, call->type, call->data))
+GL_PROC_ASYNC(1368, glBufferAddressRangeNV, (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length), (pname, index, address, length), GLenum pname; GLuint index; GLuint64EXT address; GLsizeiptr length;, (call->pname, call->index, call->address, call->length))
+GL_PROC_ASYNC(1369, glConvolutionParameteriEXT, (GLenum target, GLenum pname, GLint params), (target, pname, params), GLenum target; GLenum pname; GLint params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1370, glDisableClientStateiEXT, (GLenum array, GLuint index), (array, index), GLenum array; GLuint index;, (call->array, call->index))
+GL_PROC_ASYNC(1371, glVertexAttribL4ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (index, x, y, z, w), GLuint index; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z; GLuint64EXT w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1372, glProgramUniform4fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLfloat v0; GLfloat v1; GLfloat v2; GLfloat v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(1373, glSetFragmentShaderConstantATI, (GLuint dst, const GLfloat *value), (dst, value), GLuint dst; const GLfloat *value;, (call->dst, call->value))
+GL_PROC_ASYNC(1374, glVertexAttrib4hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (index, x, y, z, w), GLuint index; GLhalfNV x; GLhalfNV y; GLhalfNV z; GLhalfNV w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1375, glTexCoord2fColor4ubVertex3fvSUN, (const GLfloat *tc, const GLubyte *c, const GLfloat *v), (tc, c, v), const GLfloat *tc; const GLubyte *c; const GLfloat *v;, (call->tc, call->c, call->v))
+GL_PROC_ASYNC(1376, glFreeObjectBufferATI, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC_VOID(1377, glProgramLocalParameterI4ivNV, (GLenum target, GLuint index, const GLint *params), (target, index, params), GLenum target; GLuint index; const GLint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(1378, glProgramUniformMatrix4x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1379, glDeleteNamesAMD, (GLenum identifier, GLuint num, const GLuint *names), (identifier, num, names), GLenum identifier; GLuint num; const GLuint *names;, (call->identifier, call->num, call->names))
+GL_PROC_ASYNC(1380, glTexStorageMem3DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, depth, memory, offset), GLenum target; GLsizei levels; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLuint memory; GLuint64 offset;, (call->target, call->levels, call->internalFormat, call->width, call->height, call->depth, call->memory, call->offset))
+GL_PROC_ASYNC(1381, glNamedProgramLocalParameter4fEXT, (GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (program, target, index, x, y, z, w), GLuint program; GLenum target; GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->program, call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1382, glGetPixelMapusv, (GLenum map, GLushort *values), (map, values), GLenum map; GLushort *values;, (call->map, call->values))
+GL_PROC_SYNC_VOID(1383, glMatrixMult3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_SYNC(1384, GLboolean, glUnmapNamedBufferEXT, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_ASYNC(1385, glVertexStream2iATI, (GLenum stream, GLint x, GLint y), (stream, x, y), GLenum stream; GLint x; GLint y;, (call->stream, call->x, call->y))
+GL_PROC_SYNC_VOID(1386, glVertexArrayRangeNV, (GLsizei length, const void *pointer), (length, pointer), GLsizei length; const void *pointer;, (call->length, call->pointer))
+GL_PROC_SYNC_CLIENT_ARRAY(1387, glIndexPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer), GLenum type; GLsizei stride; GLsizei count; const void *pointer;, (call->type, call->stride, call->count, call->pointer))
+GL_PROC_SYNC_VOID(1388, glGetProgramNamedParameterfvNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat *params), (id, len, name, params), GLuint id; GLsizei len; const GLubyte *name; GLfloat *params;, (call->id, call->len, call->name, call->params))
+GL_PROC_SYNC(1389, GLboolean, glIsFenceAPPLE, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(1390, glCullParameterfvEXT, (GLenum pname, GLfloat *params), (pname, params), GLenum pname; GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1391, glTexCoord1bOES, (GLbyte s), (s), GLbyte s;, (call->s))
+GL_PROC_ASYNC(1392, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), GLint location; GLuint v0; GLuint v1; GLuint v2; GLuint v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(1393, glPointParameterfvSGIS, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1394, glEndOcclusionQueryNV, (void), (), , ())
+GL_PROC_ASYNC(1395, glVertexArrayNormalOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset), GLuint vaobj; GLuint buffer; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->type, call->stride, call->offset))
+GL_PROC_SYNC_VOID(1396, glVertexAttribI3uivEXT, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1397, glNormal3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(1398, glBlendEquationi, (GLuint buf, GLenum mode), (buf, mode), GLuint buf; GLenum mode;, (call->buf, call->mode))
+GL_PROC_SYNC_VOID(1399, glUniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1400, glVertex4hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(1401, glCopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), GLenum target; GLint level; GLint xoffset; GLint x; GLint y; GLsizei width;, (call->target, call->level, call->xoffset, call->x, call->y, call->width))
+GL_PROC_SYNC(1402, GLuint, glAsyncCopyImageSubDataNVX, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *waitValueArray, GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, waitValueArray, srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth, signalSemaphoreCount, signalSemaphoreArray, signalValueArray), GLsizei waitSemaphoreCount; const GLuint *waitSemaphoreArray; const GLuint64 *waitValueArray; GLuint srcGpu; GLbitfield dstGpuMask; GLuint srcName; GLenum srcTarget; GLint srcLevel; GLint srcX; GLint srcY; GLint srcZ; GLuint dstName; GLenum dstTarget; GLint dstLevel; GLint dstX; GLint dstY; GLint dstZ; GLsizei srcWidth; GLsizei srcHeight; GLsizei srcDepth; GLsizei signalSemaphoreCount; const GLuint *signalSemaphoreArray; const GLuint64 *signalValueArray;, (call->waitSemaphoreCount, call->waitSemaphoreArray, call->waitValueArray, call->srcGpu, call->dstGpuMask, call->srcName, call->srcTarget, call->srcLevel, call->srcX, call->srcY, call->srcZ, call->dstName, call->dstTarget, call->dstLevel, call->dstX, call->dstY, call->dstZ, call->srcWidth, call->srcHeight, call->srcDepth, call->signalSemaphoreCount, call->signalSemaphoreArray, call->signalValueArray))
+GL_PROC_ASYNC(1403, glPopGroupMarkerEXT, (void), (), , ())
+GL_PROC_SYNC_VOID(1404, glNamedBufferData, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage), GLuint buffer; GLsizeiptr size; const void *data; GLenum usage;, (call->buffer, call->size, call->data, call->usage))
+GL_PROC_ASYNC(1405, glRotatef, (GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (angle, x, y, z), GLfloat angle; GLfloat x; GLfloat y; GLfloat z;, (call->angle, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1406, glGetCompressedTextureImage, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels), GLuint texture; GLint level; GLsizei bufSize; void *pixels;, (call->texture, call->level, call->bufSize, call->pixels))
+GL_PROC_ASYNC(1407, glProgramLocalParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w), GLenum target; GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1408, glVertexArrayAttribIFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_SYNC_VOID(1409, glClearNamedFramebufferiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value), GLuint framebuffer; GLenum buffer; GLint drawbuffer; const GLint *value;, (call->framebuffer, call->buffer, call->drawbuffer, call->value))
+GL_PROC_SYNC_VOID(1410, glMultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLenum texture; GLenum type; const GLuint *coords;, (call->texture, call->type, call->coords))
+GL_PROC_ASYNC(1411, glTextureBarrierNV, (void), (), , ())
+GL_PROC_SYNC_VOID(1412, glUniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC(1413, GLint, glGetUniformBufferSizeEXT, (GLuint program, GLint location), (program, location), GLuint program; GLint location;, (call->program, call->location))
+GL_PROC_SYNC(1414, GLenum, glCheckFramebufferStatusEXT, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(1415, glGetPixelTexGenParameterivSGIS, (GLenum pname, GLint *params), (pname, params), GLenum pname; GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1416, glMateriali, (GLenum face, GLenum pname, GLint param), (face, pname, param), GLenum face; GLenum pname; GLint param;, (call->face, call->pname, call->param))
+GL_PROC_ASYNC(1417, glUniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), GLint location; GLuint v0; GLuint v1;, (call->location, call->v0, call->v1))
+GL_PROC_ASYNC(1418, glFramebufferTextureLayerARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), GLenum target; GLenum attachment; GLuint texture; GLint level; GLint layer;, (call->target, call->attachment, call->texture, call->level, call->layer))
+GL_PROC_SYNC_VOID(1419, glSecondaryColor3fvEXT, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(1420, glProgramUniform4ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (program, location, x, y, z, w), GLuint program; GLint location; GLuint64 x; GLuint64 y; GLuint64 z; GLuint64 w;, (call->program, call->location, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1421, glRasterPos4xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(1422, glDrawMeshTasksNV, (GLuint first, GLuint count), (first, count), GLuint first; GLuint count;, (call->first, call->count))
+GL_PROC_SYNC_VOID(1423, glInvalidateNamedFramebufferData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments), GLuint framebuffer; GLsizei numAttachments; const GLenum *attachments;, (call->framebuffer, call->numAttachments, call->attachments))
+GL_PROC_ASYNC(1424, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), GLenum target; GLenum attachment; GLenum renderbuffertarget; GLuint renderbuffer;, (call->target, call->attachment, call->renderbuffertarget, call->renderbuffer))
+GL_PROC_SYNC_VOID(1425, glGetnUniformiv, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLint *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_ASYNC(1426, glVertexBlendEnvfATI, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1427, glGetFragmentLightivSGIX, (GLenum light, GLenum pname, GLint *params), (light, pname, params), GLenum light; GLenum pname; GLint *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(1428, glGetTextureParameterfv, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params), GLuint texture; GLenum pname; GLfloat *params;, (call->texture, call->pname, call->params))
+GL_PROC_ASYNC(1429, glEnableVertexArrayAttribEXT, (GLuint vaobj, GLuint index), (vaobj, index), GLuint vaobj; GLuint index;, (call->vaobj, call->index))
+GL_PROC_SYNC_VOID(1430, glDebugMessageInsertARB, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), GLenum source; GLenum type; GLuint id; GLenum severity; GLsizei length; const GLchar *buf;, (call->source, call->type, call->id, call->severity, call->length, call->buf))
+GL_PROC_SYNC_VOID(1431, glVertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1432, glGetActiveVaryingNV, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLuint program; GLuint index; GLsizei bufSize; GLsizei *length; GLsizei *size; GLenum *type; GLchar *name;, (call->program, call->index, call->bufSize, call->length, call->size, call->type, call->name))
+GL_PROC_SYNC_VOID(1433, glFramebufferDrawBuffersEXT, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs), GLuint framebuffer; GLsizei n; const GLenum *bufs;, (call->framebuffer, call->n, call->bufs))
+GL_PROC_ASYNC(1434, glFramebufferParameteriMESA, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(1435, glBinormal3dvEXT, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(1436, glColor3hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(1437, glMultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLenum texture; GLenum type; GLuint coords;, (call->texture, call->type, call->coords))
+GL_PROC_SYNC_VOID(1438, glGetnTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels), GLenum target; GLint level; GLenum format; GLenum type; GLsizei bufSize; void *pixels;, (call->target, call->level, call->format, call->type, call->bufSize, call->pixels))
+GL_PROC_SYNC_VOID(1439, glDrawPixels, (GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels), (width, height, format, type, pixels), GLsizei width; GLsizei height; GLenum format; GLenum type; const GLvoid *pixels;, (call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(1440, glDeleteLists, (GLuint list, GLsizei range), (list, range), GLuint list; GLsizei range;, (call->list, call->range))
+GL_PROC_SYNC(1441, GLboolean, glAreTexturesResidentEXT, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences), GLsizei n; const GLuint *textures; GLboolean *residences;, (call->n, call->textures, call->residences))
+GL_PROC_SYNC_VOID(1442, glGetFragmentLightfvSGIX, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params), GLenum light; GLenum pname; GLfloat *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(1443, glMultMatrixxOES, (const GLfixed *m), (m), const GLfixed *m;, (call->m))
+GL_PROC_SYNC_VOID(1444, glTexCoord4iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(1445, glGetVideoui64vNV, (GLuint video_slot, GLenum pname, GLuint64EXT *params), (video_slot, pname, params), GLuint video_slot; GLenum pname; GLuint64EXT *params;, (call->video_slot, call->pname, call->params))
+GL_PROC_ASYNC(1446, glMultiTexCoord1sARB, (GLenum target, GLshort s), (target, s), GLenum target; GLshort s;, (call->target, call->s))
+GL_PROC_SYNC_VOID(1447, glGetTexEnvxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params), GLenum target; GLenum pname; GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1448, glFogCoordfEXT, (GLfloat coord), (coord), GLfloat coord;, (call->coord))
+GL_PROC_ASYNC(1449, glMultiTexCoord3i, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r), GLenum target; GLint s; GLint t; GLint r;, (call->target, call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(1450, glGetPointerIndexedvEXT, (GLenum target, GLuint index, void **data), (target, index, data), GLenum target; GLuint index; void **data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(1451, glMultTransposeMatrixdARB, (const GLdouble *m), (m), const GLdouble *m;, (call->m))
+GL_PROC_ASYNC(1452, glNormalFormatNV, (GLenum type, GLsizei stride), (type, stride), GLenum type; GLsizei stride;, (call->type, call->stride))
+GL_PROC_ASYNC(1453, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(1454, glNormalStream3ivATI, (GLenum stream, const GLint *coords), (stream, coords), GLenum stream; const GLint *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(1455, glEnablei, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_SYNC_VOID(1456, glVertexAttrib4NbvARB, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_SYNC(1457, GLint, glFinishAsyncSGIX, (GLuint *markerp), (markerp), GLuint *markerp;, (call->markerp))
+GL_PROC_ASYNC(1458, glTexCoord2fColor3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, x, y, z), GLfloat s; GLfloat t; GLfloat r; GLfloat g; GLfloat b; GLfloat x; GLfloat y; GLfloat z;, (call->s, call->t, call->r, call->g, call->b, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1459, glTexCoord2fColor3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *v), (tc, c, v), const GLfloat *tc; const GLfloat *c; const GLfloat *v;, (call->tc, call->c, call->v))
+GL_PROC_SYNC(1460, GLboolean, glIsSampler, (GLuint sampler), (sampler), GLuint sampler;, (call->sampler))
+GL_PROC_ASYNC(1461, glTexCoord2fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, nx, ny, nz, x, y, z), GLfloat s; GLfloat t; GLfloat nx; GLfloat ny; GLfloat nz; GLfloat x; GLfloat y; GLfloat z;, (call->s, call->t, call->nx, call->ny, call->nz, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1462, glProgramUniformMatrix4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1463, glRasterPos3xOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z), GLfixed x; GLfixed y; GLfixed z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1464, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1465, glGetProgramSubroutineParameteruivNV, (GLenum target, GLuint index, GLuint *param), (target, index, param), GLenum target; GLuint index; GLuint *param;, (call->target, call->index, call->param))
+GL_PROC_ASYNC(1466, glTextureImage3DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations), GLuint texture; GLenum target; GLsizei coverageSamples; GLsizei colorSamples; GLint internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedSampleLocations;, (call->texture, call->target, call->coverageSamples, call->colorSamples, call->internalFormat, call->width, call->height, call->depth, call->fixedSampleLocations))
+GL_PROC_ASYNC(1467, glVertexArrayVertexAttribIOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLuint index; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->index, call->size, call->type, call->stride, call->offset))
+GL_PROC_ASYNC(1468, glVertexArrayIndexOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset), GLuint vaobj; GLuint buffer; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->type, call->stride, call->offset))
+GL_PROC_SYNC_VOID(1469, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), GLuint program; GLuint uniformBlockIndex; GLsizei bufSize; GLsizei *length; GLchar *uniformBlockName;, (call->program, call->uniformBlockIndex, call->bufSize, call->length, call->uniformBlockName))
+GL_PROC_ASYNC(1470, glTexCoord1f, (GLfloat s), (s), GLfloat s;, (call->s))
+GL_PROC_ASYNC(1471, glTranslatef, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(1472, glMapGrid1f, (GLint un, GLfloat u1, GLfloat u2), (un, u1, u2), GLint un; GLfloat u1; GLfloat u2;, (call->un, call->u1, call->u2))
+GL_PROC_SYNC_VOID(1473, glGetVertexArrayiv, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param), GLuint vaobj; GLenum pname; GLint *param;, (call->vaobj, call->pname, call->param))
+GL_PROC_SYNC_VOID(1474, glGetnUniformfvARB, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLfloat *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(1475, glGetUnsignedBytei_vEXT, (GLenum target, GLuint index, GLubyte *data), (target, index, data), GLenum target; GLuint index; GLubyte *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(1476, glGetProgramStringARB, (GLenum target, GLenum pname, void *string), (target, pname, string), GLenum target; GLenum pname; void *string;, (call->target, call->pname, call->string))
+GL_PROC_ASYNC(1477, glCopyPathNV, (GLuint resultPath, GLuint srcPath), (resultPath, srcPath), GLuint resultPath; GLuint srcPath;, (call->resultPath, call->srcPath))
+GL_PROC_SYNC_VOID(1478, glMultiTexCoord2svARB, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1479, glTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, width, height, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(1480, glColor4xOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha), GLfixed red; GLfixed green; GLfixed blue; GLfixed alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(1481, glPointParameterf, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1482, glCoverFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLenum coverMode; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->coverMode, call->transformType, call->transformValues))
+GL_PROC_ASYNC(1483, glEndTransformFeedbackEXT, (void), (), , ())
+GL_PROC_SYNC_VOID(1484, glNormal3xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_SYNC_VOID(1485, glMultiTexCoord4dvARB, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1486, glNamedBufferDataEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage), GLuint buffer; GLsizeiptr size; const void *data; GLenum usage;, (call->buffer, call->size, call->data, call->usage))
+GL_PROC_SYNC_VOID(1487, glWindowPos2fvMESA, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC(1488, GLenum, glPathGlyphIndexArrayNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale), GLuint firstPathName; GLenum fontTarget; const void *fontName; GLbitfield fontStyle; GLuint firstGlyphIndex; GLsizei numGlyphs; GLuint pathParameterTemplate; GLfloat emScale;, (call->firstPathName, call->fontTarget, call->fontName, call->fontStyle, call->firstGlyphIndex, call->numGlyphs, call->pathParameterTemplate, call->emScale))
+GL_PROC_ASYNC(1489, glBindBufferBaseEXT, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), GLenum target; GLuint index; GLuint buffer;, (call->target, call->index, call->buffer))
+GL_PROC_ASYNC(1490, glSampleCoverage, (GLclampf value, GLboolean invert), (value, invert), GLclampf value; GLboolean invert;, (call->value, call->invert))
+GL_PROC_ASYNC(1491, glEvalPoint2, (GLint i, GLint j), (i, j), GLint i; GLint j;, (call->i, call->j))
+GL_PROC_ASYNC(1492, glMakeTextureHandleResidentNV, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(1493, glNormalStream3sATI, (GLenum stream, GLshort nx, GLshort ny, GLshort nz), (stream, nx, ny, nz), GLenum stream; GLshort nx; GLshort ny; GLshort nz;, (call->stream, call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(1494, glIndexxvOES, (const GLfixed *component), (component), const GLfixed *component;, (call->component))
+GL_PROC_SYNC_VOID(1495, glVideoCaptureStreamParameterivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; const GLint *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_SYNC_VOID(1496, glUniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(1497, glColor4ubVertex2fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y), (r, g, b, a, x, y), GLubyte r; GLubyte g; GLubyte b; GLubyte a; GLfloat x; GLfloat y;, (call->r, call->g, call->b, call->a, call->x, call->y))
+GL_PROC_ASYNC(1498, glStencilFillPathNV, (GLuint path, GLenum fillMode, GLuint mask), (path, fillMode, mask), GLuint path; GLenum fillMode; GLuint mask;, (call->path, call->fillMode, call->mask))
+GL_PROC_SYNC_VOID(1499, glWindowPos2svARB, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(1500, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params), GLuint shader; GLenum pname; GLint *params;, (call->shader, call->pname, call->params))
+GL_PROC_ASYNC(1501, glDrawMeshArraysSUN, (GLenum mode, GLint first, GLsizei count, GLsizei width), (mode, first, count, width), GLenum mode; GLint first; GLsizei count; GLsizei width;, (call->mode, call->first, call->count, call->width))
+GL_PROC_SYNC_VOID(1502, glWeightfvARB, (GLint size, const GLfloat *weights), (size, weights), GLint size; const GLfloat *weights;, (call->size, call->weights))
+GL_PROC_SYNC(1503, GLboolean, glIsQuery, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1504, glVertexFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride), GLint size; GLenum type; GLsizei stride;, (call->size, call->type, call->stride))
+GL_PROC_SYNC_VOID(1505, glProgramUniform4i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1506, glViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h), GLuint index; GLfloat x; GLfloat y; GLfloat w; GLfloat h;, (call->index, call->x, call->y, call->w, call->h))
+GL_PROC_SYNC_VOID(1507, glGetNamedFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params), GLuint framebuffer; GLenum pname; GLint *params;, (call->framebuffer, call->pname, call->params))
+GL_PROC_SYNC(1508, void *, glMapNamedBufferEXT, (GLuint buffer, GLenum access), (buffer, access), GLuint buffer; GLenum access;, (call->buffer, call->access))
+GL_PROC_SYNC_VOID(1509, glGetArrayObjectfvATI, (GLenum array, GLenum pname, GLfloat *params), (array, pname, params), GLenum array; GLenum pname; GLfloat *params;, (call->array, call->pname, call->params))
+GL_PROC_SYNC_VOID(1510, glDeformationMap3fSGIX, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points), GLenum target; GLfloat u1; GLfloat u2; GLint ustride; GLint uorder; GLfloat v1; GLfloat v2; GLint vstride; GLint vorder; GLfloat w1; GLfloat w2; GLint wstride; GLint worder; const GLfloat *points;, (call->target, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->w1, call->w2, call->wstride, call->worder, call->points))
+GL_PROC_ASYNC(1511, glTextureStorageSparseAMD, (GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (texture, target, internalFormat, width, height, depth, layers, flags), GLuint texture; GLenum target; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLsizei layers; GLbitfield flags;, (call->texture, call->target, call->internalFormat, call->width, call->height, call->depth, call->layers, call->flags))
+GL_PROC_ASYNC(1512, glProgramParameter4dNV, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w), GLenum target; GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1513, glCoverStrokePathNV, (GLuint path, GLenum coverMode), (path, coverMode), GLuint path; GLenum coverMode;, (call->path, call->coverMode))
+GL_PROC_ASYNC(1514, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), GLuint index; GLuint x; GLuint y; GLuint z; GLuint w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1515, glResizeBuffersMESA, (void), (), , ())
+GL_PROC_SYNC_VOID(1516, glMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points), (target, index, type, ustride, vstride, uorder, vorder, packed, points), GLenum target; GLuint index; GLenum type; GLsizei ustride; GLsizei vstride; GLint uorder; GLint vorder; GLboolean packed; const void *points;, (call->target, call->index, call->type, call->ustride, call->vstride, call->uorder, call->vorder, call->packed, call->points))
+GL_PROC_SYNC_VOID(1517, glProgramNamedParameter4fNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (id, len, name, x, y, z, w), GLuint id; GLsizei len; const GLubyte *name; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->id, call->len, call->name, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1518, glReplacementCodeuiNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *n, const GLfloat *v), (rc, n, v), const GLuint *rc; const GLfloat *n; const GLfloat *v;, (call->rc, call->n, call->v))
+GL_PROC_ASYNC(1519, glValidateProgramARB, (GLhandleARB programObj), (programObj), GLhandleARB programObj;, (call->programObj))
+GL_PROC_SYNC_VOID(1520, glVertexAttribL1ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v), GLuint index; const GLuint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1521, glMap1f, (GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (target, u1, u2, stride, order, points), GLenum target; GLfloat u1; GLfloat u2; GLint stride; GLint order; const GLfloat *points;, (call->target, call->u1, call->u2, call->stride, call->order, call->points))
+GL_PROC_SYNC_VOID(1522, glCreateMemoryObjectsEXT, (GLsizei n, GLuint *memoryObjects), (n, memoryObjects), GLsizei n; GLuint *memoryObjects;, (call->n, call->memoryObjects))
+GL_PROC_SYNC_VOID(1523, glGetCombinerInputParameterfvNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params), (stage, portion, variable, pname, params), GLenum stage; GLenum portion; GLenum variable; GLenum pname; GLfloat *params;, (call->stage, call->portion, call->variable, call->pname, call->params))
+GL_PROC_SYNC_VOID(1524, glCompressedMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, width, format, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->xoffset, call->width, call->format, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(1525, glGetTexEnvfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1526, glTangent3bEXT, (GLbyte tx, GLbyte ty, GLbyte tz), (tx, ty, tz), GLbyte tx; GLbyte ty; GLbyte tz;, (call->tx, call->ty, call->tz))
+GL_PROC_SYNC_VOID(1527, glTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, border, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint internalformat; GLsizei width; GLsizei height; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->internalformat, call->width, call->height, call->border, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(1528, glReadBuffer, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(1529, glVertexAttribL4dvEXT, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(1530, glVertex3xOES, (GLfixed x, GLfixed y), (x, y), GLfixed x; GLfixed y;, (call->x, call->y))
+GL_PROC_ASYNC(1531, glFlushStaticDataIBM, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(1532, glShadeModel, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(1533, glDeleteVertexArraysAPPLE, (GLsizei n, const GLuint *arrays), (n, arrays), GLsizei n; const GLuint *arrays;, (call->n, call->arrays))
+GL_PROC_SYNC_VOID(1534, glGetNamedStringivARB, (GLint namelen, const GLchar *name, GLenum pname, GLint *params), (namelen, name, pname, params), GLint namelen; const GLchar *name; GLenum pname; GLint *params;, (call->namelen, call->name, call->pname, call->params))
+GL_PROC_ASYNC(1535, glTexStorageSparseAMD, (GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (target, internalFormat, width, height, depth, layers, flags), GLenum target; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLsizei layers; GLbitfield flags;, (call->target, call->internalFormat, call->width, call->height, call->depth, call->layers, call->flags))
+GL_PROC_ASYNC(1536, glTexGeni, (GLenum coord, GLenum pname, GLint param), (coord, pname, param), GLenum coord; GLenum pname; GLint param;, (call->coord, call->pname, call->param))
+GL_PROC_ASYNC(1537, glUseShaderProgramEXT, (GLenum type, GLuint program), (type, program), GLenum type; GLuint program;, (call->type, call->program))
+GL_PROC_SYNC_VOID(1538, glGetNamedRenderbufferParameteriv, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params), GLuint renderbuffer; GLenum pname; GLint *params;, (call->renderbuffer, call->pname, call->params))
+GL_PROC_SYNC_VOID(1539, glColorP3uiv, (GLenum type, const GLuint *color), (type, color), GLenum type; const GLuint *color;, (call->type, call->color))
+GL_PROC_ASYNC(1540, glVertexBlendEnviATI, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1541, glBinormal3bvEXT, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_SYNC_VOID(1542, glMatrixIndexubvARB, (GLint size, const GLubyte *indices), (size, indices), GLint size; const GLubyte *indices;, (call->size, call->indices))
+GL_PROC_ASYNC(1543, glPixelTransferi, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1544, glVertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1545, glColorTable, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *table), (target, internalformat, width, format, type, table), GLenum target; GLenum internalformat; GLsizei width; GLenum format; GLenum type; const GLvoid *table;, (call->target, call->internalformat, call->width, call->format, call->type, call->table))
+GL_PROC_ASYNC(1546, glTexCoord2hNV, (GLhalfNV s, GLhalfNV t), (s, t), GLhalfNV s; GLhalfNV t;, (call->s, call->t))
+GL_PROC_SYNC_VOID(1547, glVertexStream1fvATI, (GLenum stream, const GLfloat *coords), (stream, coords), GLenum stream; const GLfloat *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(1548, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1549, glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height; GLint border;, (call->target, call->level, call->internalformat, call->x, call->y, call->width, call->height, call->border))
+GL_PROC_ASYNC(1550, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), GLenum mode; GLint first; GLsizei count; GLsizei instancecount;, (call->mode, call->first, call->count, call->instancecount))
+GL_PROC_SYNC_VOID(1551, glTexCoord1xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_SYNC_VOID(1552, glVertexAttribI2ivEXT, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1553, glGetVertexArrayIndexed64iv, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param), GLuint vaobj; GLuint index; GLenum pname; GLint64 *param;, (call->vaobj, call->index, call->pname, call->param))
+GL_PROC_ASYNC(1554, glPointSizexOES, (GLfixed size), (size), GLfixed size;, (call->size))
+GL_PROC_SYNC_VOID(1555, glGetnPixelMapusv, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLushort *values;, (call->map, call->bufSize, call->values))
+GL_PROC_SYNC_VOID(1556, glGenQueryResourceTagNV, (GLsizei n, GLint *tagIds), (n, tagIds), GLsizei n; GLint *tagIds;, (call->n, call->tagIds))
+GL_PROC_ASYNC(1557, glVertex4xOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z), GLfixed x; GLfixed y; GLfixed z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1558, glBindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name), GLuint program; GLuint index; const GLchar *name;, (call->program, call->index, call->name))
+GL_PROC_SYNC_VOID(1559, glColor4ubv, (const GLubyte *v), (v), const GLubyte *v;, (call->v))
+GL_PROC_SYNC_VOID(1560, glGetVertexAttribLui64vARB, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params), GLuint index; GLenum pname; GLuint64EXT *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(1561, glVertexArrayVertexBindingDivisorEXT, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor), GLuint vaobj; GLuint bindingindex; GLuint divisor;, (call->vaobj, call->bindingindex, call->divisor))
+GL_PROC_ASYNC(1562, glProgramUniform3ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLuint v0; GLuint v1; GLuint v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(1563, glEndFragmentShaderATI, (void), (), , ())
+GL_PROC_SYNC_VOID(1564, glUniformMatrix3fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1565, glGetPixelTransformParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1566, glBindBuffersBase, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers), GLenum target; GLuint first; GLsizei count; const GLuint *buffers;, (call->target, call->first, call->count, call->buffers))
+GL_PROC_SYNC_VOID(1567, glTexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords), GLenum type; const GLuint *coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(1568, glUniform1ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1569, glGetTransformFeedbacki64_v, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param), GLuint xfb; GLenum pname; GLuint index; GLint64 *param;, (call->xfb, call->pname, call->index, call->param))
+GL_PROC_ASYNC(1570, glVertexStream4iATI, (GLenum stream, GLint x, GLint y, GLint z, GLint w), (stream, x, y, z, w), GLenum stream; GLint x; GLint y; GLint z; GLint w;, (call->stream, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1571, glGetPerfMonitorCounterDataAMD, (GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten), (monitor, pname, dataSize, data, bytesWritten), GLuint monitor; GLenum pname; GLsizei dataSize; GLuint *data; GLint *bytesWritten;, (call->monitor, call->pname, call->dataSize, call->data, call->bytesWritten))
+GL_PROC_SYNC_VOID(1572, glGetMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1573, glDeleteSemaphoresEXT, (GLsizei n, const GLuint *semaphores), (n, semaphores), GLsizei n; const GLuint *semaphores;, (call->n, call->semaphores))
+GL_PROC_ASYNC(1574, glDisableIndexedEXT, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_ASYNC(1575, glGlobalAlphaFactoriSUN, (GLint factor), (factor), GLint factor;, (call->factor))
+GL_PROC_SYNC_VOID(1576, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, width, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->xoffset, call->width, call->format, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(1577, glGetProgramivNV, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLuint id; GLenum pname; GLint *params;, (call->id, call->pname, call->params))
+GL_PROC_ASYNC(1578, glVertexAttrib1fNV, (GLuint index, GLfloat x), (index, x), GLuint index; GLfloat x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1579, glProgramBufferParametersIuivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint *params), (target, bindingIndex, wordIndex, count, params), GLenum target; GLuint bindingIndex; GLuint wordIndex; GLsizei count; const GLuint *params;, (call->target, call->bindingIndex, call->wordIndex, call->count, call->params))
+GL_PROC_ASYNC(1580, glVertex4d, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w), GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1581, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y), GLuint index; GLshort x; GLshort y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(1582, glProgramParameter4dvNV, (GLenum target, GLuint index, const GLdouble *v), (target, index, v), GLenum target; GLuint index; const GLdouble *v;, (call->target, call->index, call->v))
+GL_PROC_ASYNC(1583, glVertexArrayAttribLFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_ASYNC(1584, glBindVertexShaderEXT, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1585, glCopyColorTable, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width;, (call->target, call->internalformat, call->x, call->y, call->width))
+GL_PROC_ASYNC(1586, glStencilClearTagEXT, (GLsizei stencilTagBits, GLuint stencilClearTag), (stencilTagBits, stencilClearTag), GLsizei stencilTagBits; GLuint stencilClearTag;, (call->stencilTagBits, call->stencilClearTag))
+GL_PROC_SYNC_CLIENT_ARRAY(1587, glFogCoordPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride), GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_ASYNC(1588, glDrawTransformFeedback, (GLenum mode, GLuint id), (mode, id), GLenum mode; GLuint id;, (call->mode, call->id))
+GL_PROC_SYNC_VOID(1589, glGetnMapdvARB, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLdouble *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_SYNC_VOID(1590, glMultTransposeMatrixf, (const GLfloat m[16]), (m), const GLfloat *m;, (call->m))
+GL_PROC_ASYNC(1591, glBeginConditionalRenderNVX, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1592, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), GLenum target; GLuint index; GLuint buffer;, (call->target, call->index, call->buffer))
+GL_PROC_ASYNC(1593, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->samples, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(1594, glGetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params), GLuint pipeline; GLenum pname; GLint *params;, (call->pipeline, call->pname, call->params))
+GL_PROC_SYNC_VOID(1595, glGetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label), const void *ptr; GLsizei bufSize; GLsizei *length; GLchar *label;, (call->ptr, call->bufSize, call->length, call->label))
+GL_PROC_ASYNC(1596, glEdgeFlag, (GLboolean flag), (flag), GLboolean flag;, (call->flag))
+GL_PROC_SYNC_VOID(1597, glGetMaterialiv, (GLenum face, GLenum pname, GLint *params), (face, pname, params), GLenum face; GLenum pname; GLint *params;, (call->face, call->pname, call->params))
+GL_PROC_ASYNC(1598, glMatrixOrthoEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar), GLenum mode; GLdouble left; GLdouble right; GLdouble bottom; GLdouble top; GLdouble zNear; GLdouble zFar;, (call->mode, call->left, call->right, call->bottom, call->top, call->zNear, call->zFar))
+GL_PROC_SYNC(1599, GLboolean, glIsProgramPipeline, (GLuint pipeline), (pipeline), GLuint pipeline;, (call->pipeline))
+GL_PROC_ASYNC(1600, glMatrixLoadIdentityEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(1601, glEGLImageTargetTexStorageEXT, (GLenum target, GLeglImageOES image, const GLint* attrib_list), (target, image, attrib_list), GLenum target; GLeglImageOES image; const GLint* attrib_list;, (call->target, call->image, call->attrib_list))
+GL_PROC_ASYNC(1602, glPixelTexGenParameterfSGIS, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_ASYNC(1603, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; GLuint value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(1604, glNamedFramebufferDrawBuffers, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs), GLuint framebuffer; GLsizei n; const GLenum *bufs;, (call->framebuffer, call->n, call->bufs))
+GL_PROC_SYNC_VOID(1605, glFlushVertexArrayRangeAPPLE, (GLsizei length, void *pointer), (length, pointer), GLsizei length; void *pointer;, (call->length, call->pointer))
+GL_PROC_ASYNC(1606, glReplacementCodeuiColor3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, x, y, z), GLuint rc; GLfloat r; GLfloat g; GLfloat b; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->r, call->g, call->b, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1607, glStringMarkerGREMEDY, (GLsizei len, const void *string), (len, string), GLsizei len; const void *string;, (call->len, call->string))
+GL_PROC_ASYNC(1608, glMinmaxEXT, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink), GLenum target; GLenum internalformat; GLboolean sink;, (call->target, call->internalformat, call->sink))
+GL_PROC_ASYNC(1609, glRasterPos3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(1610, glWindowPos2fMESA, (GLfloat x, GLfloat y), (x, y), GLfloat x; GLfloat y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(1611, glVertexAttribI1ivEXT, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(1612, glUniform1ui64ARB, (GLint location, GLuint64 x), (location, x), GLint location; GLuint64 x;, (call->location, call->x))
+GL_PROC_ASYNC(1613, glSecondaryColor3ub, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue), GLubyte red; GLubyte green; GLubyte blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(1614, glVertexAttrib1d, (GLuint index, GLdouble x), (index, x), GLuint index; GLdouble x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1615, glGetnSeparableFilter, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span), GLenum target; GLenum format; GLenum type; GLsizei rowBufSize; void *row; GLsizei columnBufSize; void *column; void *span;, (call->target, call->format, call->type, call->rowBufSize, call->row, call->columnBufSize, call->column, call->span))
+GL_PROC_SYNC_VOID(1616, glVertexAttribI3ivEXT, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC(1617, GLboolean, glTestFenceNV, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(1618, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders), GLuint program; GLsizei maxCount; GLsizei *count; GLuint *shaders;, (call->program, call->maxCount, call->count, call->shaders))
+GL_PROC_SYNC(1619, GLboolean, glIsCommandListNV, (GLuint list), (list), GLuint list;, (call->list))
+GL_PROC_SYNC(1620, GLboolean, glIsSemaphoreEXT, (GLuint semaphore), (semaphore), GLuint semaphore;, (call->semaphore))
+GL_PROC_SYNC(1621, GLboolean, glVDPAUIsSurfaceNV, (GLvdpauSurfaceNV surface), (surface), GLvdpauSurfaceNV surface;, (call->surface))
+GL_PROC_SYNC_VOID(1622, glRasterPos4iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(1623, glMapGrid1xOES, (GLint n, GLfixed u1, GLfixed u2), (n, u1, u2), GLint n; GLfixed u1; GLfixed u2;, (call->n, call->u1, call->u2))
+GL_PROC_ASYNC(1624, glBlendColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha), GLfixed red; GLfixed green; GLfixed blue; GLfixed alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(1625, glUniform4fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), GLint location; GLfloat v0; GLfloat v1; GLfloat v2; GLfloat v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_ASYNC(1626, glTexCoord2f, (GLfloat s, GLfloat t), (s, t), GLfloat s; GLfloat t;, (call->s, call->t))
+GL_PROC_SYNC_VOID(1627, glLoadMatrixd, (const GLdouble *m), (m), const GLdouble *m;, (call->m))
+GL_PROC_ASYNC(1628, glWindowPos4iMESA, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w), GLint x; GLint y; GLint z; GLint w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1629, glSecondaryColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue), GLhalfNV red; GLhalfNV green; GLhalfNV blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC(1630, GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLsync sync; GLbitfield flags; GLuint64 timeout;, (call->sync, call->flags, call->timeout))
+GL_PROC_ASYNC(1631, glInvalidateBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLuint buffer; GLintptr offset; GLsizeiptr length;, (call->buffer, call->offset, call->length))
+GL_PROC_SYNC_VOID(1632, glTexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1633, glGetNamedProgramStringEXT, (GLuint program, GLenum target, GLenum pname, void *string), (program, target, pname, string), GLuint program; GLenum target; GLenum pname; void *string;, (call->program, call->target, call->pname, call->string))
+GL_PROC_SYNC_VOID(1634, glMultiTexCoord1hvNV, (GLenum target, const GLhalfNV *v), (target, v), GLenum target; const GLhalfNV *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1635, glGetAttachedObjectsARB, (GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj), (containerObj, maxCount, count, obj), GLhandleARB containerObj; GLsizei maxCount; GLsizei *count; GLhandleARB *obj;, (call->containerObj, call->maxCount, call->count, call->obj))
+GL_PROC_ASYNC(1636, glBeginQueryARB, (GLenum target, GLuint id), (target, id), GLenum target; GLuint id;, (call->target, call->id))
+GL_PROC_SYNC_VOID(1637, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source), GLuint shader; GLsizei bufSize; GLsizei *length; GLchar *source;, (call->shader, call->bufSize, call->length, call->source))
+GL_PROC_SYNC_VOID(1638, glRequestResidentProgramsNV, (GLsizei n, const GLuint *programs), (n, programs), GLsizei n; const GLuint *programs;, (call->n, call->programs))
+GL_PROC_ASYNC(1639, glVertexAttrib1dARB, (GLuint index, GLdouble x), (index, x), GLuint index; GLdouble x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1640, glGetBooleanv, (GLenum pname, GLboolean *params), (pname, params), GLenum pname; GLboolean *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(1641, glProgramUniformui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1642, glPointParameterfARB, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1643, glMultiDrawElementsIndirectBindlessCountNV, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, maxDrawCount, stride, vertexBufferCount), GLenum mode; GLenum type; const void *indirect; GLsizei drawCount; GLsizei maxDrawCount; GLsizei stride; GLint vertexBufferCount;, (call->mode, call->type, call->indirect, call->drawCount, call->maxDrawCount, call->stride, call->vertexBufferCount))
+GL_PROC_ASYNC(1644, glLightf, (GLenum light, GLenum pname, GLfloat param), (light, pname, param), GLenum light; GLenum pname; GLfloat param;, (call->light, call->pname, call->param))
+GL_PROC_SYNC_VOID(1645, glProgramUniform3iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1646, glGetnPixelMapfvARB, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLfloat *values;, (call->map, call->bufSize, call->values))
+GL_PROC_SYNC_VOID(1647, glVertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1648, glGetPointeri_vEXT, (GLenum pname, GLuint index, void **params), (pname, index, params), GLenum pname; GLuint index; void **params;, (call->pname, call->index, call->params))
+GL_PROC_ASYNC(1649, glDeleteVertexShaderEXT, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(1650, glMultMatrixf, (const GLfloat *m), (m), const GLfloat *m;, (call->m))
+GL_PROC_ASYNC(1651, glResetMemoryObjectParameterNV, (GLuint memory, GLenum pname), (memory, pname), GLuint memory; GLenum pname;, (call->memory, call->pname))
+GL_PROC_ASYNC(1652, glBegin, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(1653, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; GLuint value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(1654, glActiveVaryingNV, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_SYNC_VOID(1655, glGetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data), GLenum target; GLuint index; GLint *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(1656, glProgramUniform3ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1657, glUniform4uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(1658, glSecondaryColor3iEXT, (GLint red, GLint green, GLint blue), (red, green, blue), GLint red; GLint green; GLint blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1659, glGetnMapfvARB, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLfloat *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_ASYNC(1660, glTexStorageMem2DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, memory, offset), GLenum target; GLsizei levels; GLenum internalFormat; GLsizei width; GLsizei height; GLuint memory; GLuint64 offset;, (call->target, call->levels, call->internalFormat, call->width, call->height, call->memory, call->offset))
+GL_PROC_SYNC_VOID(1661, glProgramUniformMatrix3x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1662, glTexCoordP3ui, (GLenum type, GLuint coords), (type, coords), GLenum type; GLuint coords;, (call->type, call->coords))
+GL_PROC_ASYNC(1663, glBinormal3iEXT, (GLint bx, GLint by, GLint bz), (bx, by, bz), GLint bx; GLint by; GLint bz;, (call->bx, call->by, call->bz))
+GL_PROC_SYNC_VOID(1664, glGetHistogramParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1665, glGetPathParameterivNV, (GLuint path, GLenum pname, GLint *value), (path, pname, value), GLuint path; GLenum pname; GLint *value;, (call->path, call->pname, call->value))
+GL_PROC_ASYNC(1666, glMultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLenum texture; GLenum type; GLuint coords;, (call->texture, call->type, call->coords))
+GL_PROC_ASYNC(1667, glGenerateMultiTexMipmapEXT, (GLenum texunit, GLenum target), (texunit, target), GLenum texunit; GLenum target;, (call->texunit, call->target))
+GL_PROC_ASYNC(1668, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLboolean fixedsamplelocations;, (call->target, call->samples, call->internalformat, call->width, call->height, call->fixedsamplelocations))
+GL_PROC_SYNC_VOID(1669, glDepthRangeArrayv, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v), GLuint first; GLsizei count; const GLdouble *v;, (call->first, call->count, call->v))
+GL_PROC_SYNC(1670, GLint, glPollAsyncSGIX, (GLuint *markerp), (markerp), GLuint *markerp;, (call->markerp))
+GL_PROC_SYNC_VOID(1671, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param), GLuint sampler; GLenum pname; const GLuint *param;, (call->sampler, call->pname, call->param))
+GL_PROC_SYNC_VOID(1672, glGetProgramInterfaceiv, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params), GLuint program; GLenum programInterface; GLenum pname; GLint *params;, (call->program, call->programInterface, call->pname, call->params))
+GL_PROC_ASYNC(1673, glVertexAttribI3uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), GLuint index; GLuint x; GLuint y; GLuint z;, (call->index, call->x, call->y, call->z))
+GL_PROC_ASYNC(1674, glMakeImageHandleResidentARB, (GLuint64 handle, GLenum access), (handle, access), GLuint64 handle; GLenum access;, (call->handle, call->access))
+GL_PROC_SYNC_VOID(1675, glGetTexParameterIuivEXT, (GLenum target, GLenum pname, GLuint *params), (target, pname, params), GLenum target; GLenum pname; GLuint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(1676, glEdgeFlagPointer, (GLsizei stride, const GLvoid *ptr), (stride, ptr), GLsizei stride; const GLvoid *ptr;, (call->stride, call->ptr))
+GL_PROC_SYNC_VOID(1677, glGetObjectBufferivATI, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLint *params;, (call->buffer, call->pname, call->params))
+GL_PROC_SYNC_VOID(1678, glPathParameterivNV, (GLuint path, GLenum pname, const GLint *value), (path, pname, value), GLuint path; GLenum pname; const GLint *value;, (call->path, call->pname, call->value))
+GL_PROC_SYNC_VOID(1679, glMap2d, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLenum target; GLdouble u1; GLdouble u2; GLint ustride; GLint uorder; GLdouble v1; GLdouble v2; GLint vstride; GLint vorder; const GLdouble *points;, (call->target, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->points))
+GL_PROC_ASYNC(1680, glPointParameterfSGIS, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1681, glMultiTexCoord3dvARB, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1682, glCompressedTexSubImage3DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLsizei imageSize; const void *data;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->imageSize, call->data))
+GL_PROC_ASYNC(1683, glProgramEnvParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w), GLenum target; GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1684, glVertexArrayVertexAttribBindingEXT, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex), GLuint vaobj; GLuint attribindex; GLuint bindingindex;, (call->vaobj, call->attribindex, call->bindingindex))
+GL_PROC_ASYNC(1685, glBlendEquation, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(1686, glBinormal3bEXT, (GLbyte bx, GLbyte by, GLbyte bz), (bx, by, bz), GLbyte bx; GLbyte by; GLbyte bz;, (call->bx, call->by, call->bz))
+GL_PROC_SYNC_VOID(1687, glFogCoordfv, (const GLfloat *coord), (coord), const GLfloat *coord;, (call->coord))
+GL_PROC_ASYNC(1688, glTexCoordFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride), GLint size; GLenum type; GLsizei stride;, (call->size, call->type, call->stride))
+GL_PROC_SYNC_VOID(1689, glPointParameterxvOES, (GLenum pname, const GLfixed *params), (pname, params), GLenum pname; const GLfixed *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1690, glConservativeRasterParameteriNV, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1691, glWaitSemaphoreui64NVX, (GLuint waitGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (waitGpu, fenceObjectCount, semaphoreArray, fenceValueArray), GLuint waitGpu; GLsizei fenceObjectCount; const GLuint *semaphoreArray; const GLuint64 *fenceValueArray;, (call->waitGpu, call->fenceObjectCount, call->semaphoreArray, call->fenceValueArray))
+GL_PROC_ASYNC(1692, glMaterialf, (GLenum face, GLenum pname, GLfloat param), (face, pname, param), GLenum face; GLenum pname; GLfloat param;, (call->face, call->pname, call->param))
+GL_PROC_ASYNC(1693, glDisableClientStateIndexedEXT, (GLenum array, GLuint index), (array, index), GLenum array; GLuint index;, (call->array, call->index))
+GL_PROC_ASYNC(1694, glMakeTextureHandleResidentARB, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(1695, glVertexAttribParameteriAMD, (GLuint index, GLenum pname, GLint param), (index, pname, param), GLuint index; GLenum pname; GLint param;, (call->index, call->pname, call->param))
+GL_PROC_ASYNC(1696, glClearDepthdNV, (GLdouble depth), (depth), GLdouble depth;, (call->depth))
+GL_PROC_SYNC_VOID(1697, glGetObjectParameterfvARB, (GLhandleARB obj, GLenum pname, GLfloat *params), (obj, pname, params), GLhandleARB obj; GLenum pname; GLfloat *params;, (call->obj, call->pname, call->params))
+GL_PROC_SYNC_VOID(1698, glProgramLocalParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLuint *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(1699, glVertex4sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(1700, glVertexArrayVertexBuffers, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides), GLuint vaobj; GLuint first; GLsizei count; const GLuint *buffers; const GLintptr *offsets; const GLsizei *strides;, (call->vaobj, call->first, call->count, call->buffers, call->offsets, call->strides))
+GL_PROC_ASYNC(1701, glFramebufferDrawBufferEXT, (GLuint framebuffer, GLenum mode), (framebuffer, mode), GLuint framebuffer; GLenum mode;, (call->framebuffer, call->mode))
+GL_PROC_ASYNC(1702, glVertexAttrib4dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1703, glVertexAttrib1f, (GLuint index, GLfloat x), (index, x), GLuint index; GLfloat x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1704, glVertexAttribI1iv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1705, glRectxvOES, (const GLfixed *v1, const GLfixed *v2), (v1, v2), const GLfixed *v1; const GLfixed *v2;, (call->v1, call->v2))
+GL_PROC_ASYNC(1706, glEndQueryARB, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_ASYNC(1707, glVertexStream4fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (stream, x, y, z, w), GLenum stream; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->stream, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1708, glTexCoord1hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_ASYNC(1709, glMinSampleShading, (GLfloat value), (value), GLfloat value;, (call->value))
+GL_PROC_SYNC_VOID(1710, glVertexAttribI4sv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(1711, glVertex3s, (GLshort x, GLshort y, GLshort z), (x, y, z), GLshort x; GLshort y; GLshort z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(1712, glGenerateTextureMipmapEXT, (GLuint texture, GLenum target), (texture, target), GLuint texture; GLenum target;, (call->texture, call->target))
+GL_PROC_SYNC_VOID(1713, glVertexAttribI2uivEXT, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1714, glSecondaryColor3uivEXT, (const GLuint *v), (v), const GLuint *v;, (call->v))
+GL_PROC_SYNC_VOID(1715, glVertexAttribs3dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v), GLuint index; GLsizei count; const GLdouble *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(1716, glTexEnvxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param), GLenum target; GLenum pname; GLfixed param;, (call->target, call->pname, call->param))
+GL_PROC_ASYNC(1717, glFrameZoomSGIX, (GLint factor), (factor), GLint factor;, (call->factor))
+GL_PROC_ASYNC(1718, glSecondaryColor3ubEXT, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue), GLubyte red; GLubyte green; GLubyte blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1719, glTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, const GLfloat *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; const GLfloat *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1720, glPathGlyphRangeNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale), GLuint firstPathName; GLenum fontTarget; const void *fontName; GLbitfield fontStyle; GLuint firstGlyph; GLsizei numGlyphs; GLenum handleMissingGlyphs; GLuint pathParameterTemplate; GLfloat emScale;, (call->firstPathName, call->fontTarget, call->fontName, call->fontStyle, call->firstGlyph, call->numGlyphs, call->handleMissingGlyphs, call->pathParameterTemplate, call->emScale))
+GL_PROC_SYNC_VOID(1721, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage), GLenum target; GLsizeiptr size; const void *data; GLenum usage;, (call->target, call->size, call->data, call->usage))
+GL_PROC_SYNC_VOID(1722, glIndexfv, (const GLfloat *c), (c), const GLfloat *c;, (call->c))
+GL_PROC_ASYNC(1723, glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units), GLfloat factor; GLfloat units;, (call->factor, call->units))
+GL_PROC_ASYNC(1724, glVDPAUSurfaceAccessNV, (GLvdpauSurfaceNV surface, GLenum access), (surface, access), GLvdpauSurfaceNV surface; GLenum access;, (call->surface, call->access))
+GL_PROC_SYNC_VOID(1725, glMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLfloat *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1726, glDrawTextureNV, (GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1), GLuint texture; GLuint sampler; GLfloat x0; GLfloat y0; GLfloat x1; GLfloat y1; GLfloat z; GLfloat s0; GLfloat t0; GLfloat s1; GLfloat t1;, (call->texture, call->sampler, call->x0, call->y0, call->x1, call->y1, call->z, call->s0, call->t0, call->s1, call->t1))
+GL_PROC_SYNC_CLIENT_ARRAY(1727, glMatrixIndexPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->size, call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(1728, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLuint program; GLuint index; GLsizei bufSize; GLsizei *length; GLint *size; GLenum *type; GLchar *name;, (call->program, call->index, call->bufSize, call->length, call->size, call->type, call->name))
+GL_PROC_SYNC_VOID(1729, glWindowPos2dvMESA, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(1730, glUniform1f, (GLint location, GLfloat v0), (location, v0), GLint location; GLfloat v0;, (call->location, call->v0))
+GL_PROC_SYNC_VOID(1731, glGetNamedBufferParameteriv, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLint *params;, (call->buffer, call->pname, call->params))
+GL_PROC_SYNC_VOID(1732, glGetFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params), GLuint framebuffer; GLenum pname; GLint *params;, (call->framebuffer, call->pname, call->params))
+GL_PROC_ASYNC(1733, glAlphaFuncxOES, (GLenum func, GLfixed ref), (func, ref), GLenum func; GLfixed ref;, (call->func, call->ref))
+GL_PROC_ASYNC(1734, glFrustum, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val), (left, right, bottom, top, near_val, far_val), GLdouble left; GLdouble right; GLdouble bottom; GLdouble top; GLdouble near_val; GLdouble far_val;, (call->left, call->right, call->bottom, call->top, call->near_val, call->far_val))
+GL_PROC_ASYNC(1735, glBindBufferARB, (GLenum target, GLuint buffer), (target, buffer), GLenum target; GLuint buffer;, (call->target, call->buffer))
+GL_PROC_ASYNC(1736, glIndexs, (GLshort c), (c), GLshort c;, (call->c))
+GL_PROC_SYNC(1737, GLboolean, glIsFramebufferEXT, (GLuint framebuffer), (framebuffer), GLuint framebuffer;, (call->framebuffer))
+GL_PROC_SYNC_VOID(1738, glPixelMapfv, (GLenum map, GLsizei mapsize, const GLfloat *values), (map, mapsize, values), GLenum map; GLsizei mapsize; const GLfloat *values;, (call->map, call->mapsize, call->values))
+GL_PROC_SYNC_VOID(1739, glMultiTexCoord3dv, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_CLIENT_ARRAY(1740, glColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride), GLint size; GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->size, call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_ASYNC(1741, glLineWidth, (GLfloat width), (width), GLfloat width;, (call->width))
+GL_PROC_SYNC_VOID(1742, glUniform4ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(1743, glEvalCoord2f, (GLfloat u, GLfloat v), (u, v), GLfloat u; GLfloat v;, (call->u, call->v))
+GL_PROC_SYNC_VOID(1744, glDrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs), GLsizei n; const GLenum *bufs;, (call->n, call->bufs))
+GL_PROC_SYNC_VOID(1745, glProgramEnvParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLuint *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_ASYNC(1746, glCopyTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->level, call->xoffset, call->yoffset, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(1747, glVertexAttribBinding, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex), GLuint attribindex; GLuint bindingindex;, (call->attribindex, call->bindingindex))
+GL_PROC_SYNC_VOID(1748, glGetMinmaxParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1749, glTexImage2DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations), GLenum target; GLsizei coverageSamples; GLsizei colorSamples; GLint internalFormat; GLsizei width; GLsizei height; GLboolean fixedSampleLocations;, (call->target, call->coverageSamples, call->colorSamples, call->internalFormat, call->width, call->height, call->fixedSampleLocations))
+GL_PROC_SYNC_VOID(1750, glColorTableParameterivSGI, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1751, glGetPixelMapuiv, (GLenum map, GLuint *values), (map, values), GLenum map; GLuint *values;, (call->map, call->values))
+GL_PROC_SYNC_VOID(1752, glVertexAttribI4svEXT, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(1753, glMultiTexCoord3hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r), (target, s, t, r), GLenum target; GLhalfNV s; GLhalfNV t; GLhalfNV r;, (call->target, call->s, call->t, call->r))
+GL_PROC_ASYNC(1754, glNamedRenderbufferStorageMultisampleEXT, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height), GLuint renderbuffer; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->samples, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(1755, glVertexAttrib1dNV, (GLuint index, GLdouble x), (index, x), GLuint index; GLdouble x;, (call->index, call->x))
+GL_PROC_SYNC(1756, GLuint64, glGetImageHandleARB, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format), GLuint texture; GLint level; GLboolean layered; GLint layer; GLenum format;, (call->texture, call->level, call->layered, call->layer, call->format))
+GL_PROC_ASYNC(1757, glListBase, (GLuint base), (base), GLuint base;, (call->base))
+GL_PROC_ASYNC(1758, glVertexAttribFormatNV, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride), (index, size, type, normalized, stride), GLuint index; GLint size; GLenum type; GLboolean normalized; GLsizei stride;, (call->index, call->size, call->type, call->normalized, call->stride))
+GL_PROC_ASYNC(1759, glMulticastBarrierNV, (void), (), , ())
+GL_PROC_ASYNC(1760, glTexStorageMem2DMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset), GLenum target; GLsizei samples; GLenum internalFormat; GLsizei width; GLsizei height; GLboolean fixedSampleLocations; GLuint memory; GLuint64 offset;, (call->target, call->samples, call->internalFormat, call->width, call->height, call->fixedSampleLocations, call->memory, call->offset))
+GL_PROC_ASYNC(1761, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), GLenum buffer; GLint drawbuffer; GLfloat depth; GLint stencil;, (call->buffer, call->drawbuffer, call->depth, call->stencil))
+GL_PROC_ASYNC(1762, glVertexAttribL1ui64NV, (GLuint index, GLuint64EXT x), (index, x), GLuint index; GLuint64EXT x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(1763, glGetPathParameterfvNV, (GLuint path, GLenum pname, GLfloat *value), (path, pname, value), GLuint path; GLenum pname; GLfloat *value;, (call->path, call->pname, call->value))
+GL_PROC_ASYNC(1764, glBindImageTextureEXT, (GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format), (index, texture, level, layered, layer, access, format), GLuint index; GLuint texture; GLint level; GLboolean layered; GLint layer; GLenum access; GLint format;, (call->index, call->texture, call->level, call->layered, call->layer, call->access, call->format))
+GL_PROC_SYNC_VOID(1765, glGetFixedvOES, (GLenum pname, GLfixed *params), (pname, params), GLenum pname; GLfixed *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1766, glTexStorageMem1DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, memory, offset), GLenum target; GLsizei levels; GLenum internalFormat; GLsizei width; GLuint memory; GLuint64 offset;, (call->target, call->levels, call->internalFormat, call->width, call->memory, call->offset))
+GL_PROC_SYNC_VOID(1767, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLuint sampler; GLenum pname; const GLint *param;, (call->sampler, call->pname, call->param))
+GL_PROC_SYNC_VOID(1768, glGetCombinerStageParameterfvNV, (GLenum stage, GLenum pname, GLfloat *params), (stage, pname, params), GLenum stage; GLenum pname; GLfloat *params;, (call->stage, call->pname, call->params))
+GL_PROC_SYNC_VOID(1769, glProgramUniform4ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1770, glCopyTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(1771, glRasterPos2xOES, (GLfixed x, GLfixed y), (x, y), GLfixed x; GLfixed y;, (call->x, call->y))
+GL_PROC_ASYNC(1772, glNamedFramebufferTexture2DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level), GLuint framebuffer; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->framebuffer, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_SYNC_VOID(1773, glImageTransformParameterivHP, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1774, glVertexAttrib4uivARB, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_ASYNC(1775, glBlendEquationSeparateiARB, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha), GLuint buf; GLenum modeRGB; GLenum modeAlpha;, (call->buf, call->modeRGB, call->modeAlpha))
+GL_PROC_ASYNC(1776, glFlushMappedBufferRangeAPPLE, (GLenum target, GLintptr offset, GLsizeiptr size), (target, offset, size), GLenum target; GLintptr offset; GLsizeiptr size;, (call->target, call->offset, call->size))
+GL_PROC_ASYNC(1777, glRasterPos3s, (GLshort x, GLshort y, GLshort z), (x, y, z), GLshort x; GLshort y; GLshort z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1778, glGetColorTableParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1779, glColor4ubVertex2fvSUN, (const GLubyte *c, const GLfloat *v), (c, v), const GLubyte *c; const GLfloat *v;, (call->c, call->v))
+GL_PROC_SYNC_VOID(1780, glMultiDrawElementsIndirectCountARB, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride), GLenum mode; GLenum type; const void *indirect; GLintptr drawcount; GLsizei maxdrawcount; GLsizei stride;, (call->mode, call->type, call->indirect, call->drawcount, call->maxdrawcount, call->stride))
+GL_PROC_ASYNC(1781, glTexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth), GLenum target; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth;, (call->target, call->levels, call->internalformat, call->width, call->height, call->depth))
+GL_PROC_ASYNC(1782, glWindowPos3iMESA, (GLint x, GLint y, GLint z), (x, y, z), GLint x; GLint y; GLint z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1783, glVertexAttrib4ubvNV, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1784, glTexBumpParameterivATI, (GLenum pname, const GLint *param), (pname, param), GLenum pname; const GLint *param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1785, glProgramEnvParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params), (target, index, params), GLenum target; GLuint index; const GLuint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(1786, glProgramUniform3fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1787, glFogi, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_ASYNC(1788, glShaderOp1EXT, (GLenum op, GLuint res, GLuint arg1), (op, res, arg1), GLenum op; GLuint res; GLuint arg1;, (call->op, call->res, call->arg1))
+GL_PROC_ASYNC(1789, glWindowPos3sARB, (GLshort x, GLshort y, GLshort z), (x, y, z), GLshort x; GLshort y; GLshort z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1790, glGetHistogramParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params), GLenum target; GLenum pname; GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1791, glEndTransformFeedback, (void), (), , ())
+GL_PROC_SYNC_VOID(1792, glDrawCommandsNV, (GLenum primitiveMode, GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, buffer, indirects, sizes, count), GLenum primitiveMode; GLuint buffer; const GLintptr *indirects; const GLsizei *sizes; GLuint count;, (call->primitiveMode, call->buffer, call->indirects, call->sizes, call->count))
+GL_PROC_SYNC_VOID(1793, glTexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1794, glFogxvOES, (GLenum pname, const GLfixed *param), (pname, param), GLenum pname; const GLfixed *param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(1795, glUniformMatrix2fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1796, glGetTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, GLuint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; GLuint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC(1797, GLenum, glPathGlyphIndexRangeNV, (GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount[2]), (fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount), GLenum fontTarget; const void *fontName; GLbitfield fontStyle; GLuint pathParameterTemplate; GLfloat emScale; GLuint *baseAndCount;, (call->fontTarget, call->fontName, call->fontStyle, call->pathParameterTemplate, call->emScale, call->baseAndCount))
+GL_PROC_ASYNC(1798, glBindTransformFeedbackNV, (GLenum target, GLuint id), (target, id), GLenum target; GLuint id;, (call->target, call->id))
+GL_PROC_ASYNC(1799, glCoverFillPathNV, (GLuint path, GLenum coverMode), (path, coverMode), GLuint path; GLenum coverMode;, (call->path, call->coverMode))
+GL_PROC_ASYNC(1800, glMultiTexCoord2xOES, (GLenum texture, GLfixed s, GLfixed t), (texture, s, t), GLenum texture; GLfixed s; GLfixed t;, (call->texture, call->s, call->t))
+GL_PROC_SYNC_VOID(1801, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val), GLenum pname; GLuint index; GLfloat *val;, (call->pname, call->index, call->val))
+GL_PROC_ASYNC(1802, glInterpolatePathsNV, (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight), (resultPath, pathA, pathB, weight), GLuint resultPath; GLuint pathA; GLuint pathB; GLfloat weight;, (call->resultPath, call->pathA, call->pathB, call->weight))
+GL_PROC_SYNC_VOID(1803, glGetUniformuivEXT, (GLuint program, GLint location, GLuint *params), (program, location, params), GLuint program; GLint location; GLuint *params;, (call->program, call->location, call->params))
+GL_PROC_ASYNC(1804, glPixelZoom, (GLfloat xfactor, GLfloat yfactor), (xfactor, yfactor), GLfloat xfactor; GLfloat yfactor;, (call->xfactor, call->yfactor))
+GL_PROC_SYNC_VOID(1805, glVertexAttribL2i64vNV, (GLuint index, const GLint64EXT *v), (index, v), GLuint index; const GLint64EXT *v;, (call->index, call->v))
+GL_PROC_ASYNC(1806, glBinormal3fEXT, (GLfloat bx, GLfloat by, GLfloat bz), (bx, by, bz), GLfloat bx; GLfloat by; GLfloat bz;, (call->bx, call->by, call->bz))
+GL_PROC_SYNC_VOID(1807, glWindowPos2fvARB, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(1808, glSwizzleEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW), GLuint res; GLuint in; GLenum outX; GLenum outY; GLenum outZ; GLenum outW;, (call->res, call->in, call->outX, call->outY, call->outZ, call->outW))
+GL_PROC_ASYNC(1809, glRasterPos4s, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w), GLshort x; GLshort y; GLshort z; GLshort w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(1810, glBlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha), GLuint buf; GLenum srcRGB; GLenum dstRGB; GLenum srcAlpha; GLenum dstAlpha;, (call->buf, call->srcRGB, call->dstRGB, call->srcAlpha, call->dstAlpha))
+GL_PROC_SYNC_VOID(1811, glProgramUniformMatrix3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1812, glFinishFenceAPPLE, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_ASYNC(1813, glTexCoord3xOES, (GLfixed s, GLfixed t, GLfixed r), (s, t, r), GLfixed s; GLfixed t; GLfixed r;, (call->s, call->t, call->r))
+GL_PROC_SYNC_CLIENT_ARRAY(1814, glEdgeFlagPointerListIBM, (GLint stride, const GLboolean **pointer, GLint ptrstride), (stride, pointer, ptrstride), GLint stride; const GLboolean **pointer; GLint ptrstride;, (call->stride, call->pointer, call->ptrstride))
+GL_PROC_SYNC_VOID(1815, glVertexAttribs1fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v), GLuint index; GLsizei count; const GLfloat *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(1816, glMultiTexCoord1dvARB, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_ASYNC(1817, glConvolutionParameterfEXT, (GLenum target, GLenum pname, GLfloat params), (target, pname, params), GLenum target; GLenum pname; GLfloat params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1818, glSelectBuffer, (GLsizei size, GLuint *buffer), (size, buffer), GLsizei size; GLuint *buffer;, (call->size, call->buffer))
+GL_PROC_ASYNC(1819, glTextureColorMaskSGIS, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), GLboolean red; GLboolean green; GLboolean blue; GLboolean alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(1820, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_CLIENT_ARRAY(1821, glElementPointerAPPLE, (GLenum type, const void *pointer), (type, pointer), GLenum type; const void *pointer;, (call->type, call->pointer))
+GL_PROC_SYNC_VOID(1822, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLsizei n; GLuint *renderbuffers;, (call->n, call->renderbuffers))
+GL_PROC_SYNC(1823, GLint, glGetVaryingLocationNV, (GLuint program, const GLchar *name), (program, name), GLuint program; const GLchar *name;, (call->program, call->name))
+GL_PROC_ASYNC(1824, glBlendEquationSeparateEXT, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), GLenum modeRGB; GLenum modeAlpha;, (call->modeRGB, call->modeAlpha))
+GL_PROC_ASYNC(1825, glProgramLocalParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w), GLenum target; GLuint index; GLuint x; GLuint y; GLuint z; GLuint w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(1826, glVertexStream3svATI, (GLenum stream, const GLshort *coords), (stream, coords), GLenum stream; const GLshort *coords;, (call->stream, call->coords))
+GL_PROC_SYNC(1827, GLboolean, glIsTransformFeedbackNV, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(1828, glConvolutionParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(1829, glVertexAttribLPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLuint index; GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(1830, glAlphaFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod), GLenum op; GLuint dst; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod;, (call->op, call->dst, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod))
+GL_PROC_SYNC_VOID(1831, glNamedProgramLocalParametersI4uivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params), (program, target, index, count, params), GLuint program; GLenum target; GLuint index; GLsizei count; const GLuint *params;, (call->program, call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(1832, glGetTexEnviv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(1833, glInterleavedArrays, (GLenum format, GLsizei stride, const GLvoid *pointer), (format, stride, pointer), GLenum format; GLsizei stride; const GLvoid *pointer;, (call->format, call->stride, call->pointer))
+GL_PROC_ASYNC(1834, glDetachShader, (GLuint program, GLuint shader), (program, shader), GLuint program; GLuint shader;, (call->program, call->shader))
+GL_PROC_ASYNC(1835, glNamedBufferPageCommitmentARB, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit), GLuint buffer; GLintptr offset; GLsizeiptr size; GLboolean commit;, (call->buffer, call->offset, call->size, call->commit))
+GL_PROC_ASYNC(1836, glVertexAttrib1sARB, (GLuint index, GLshort x), (index, x), GLuint index; GLshort x;, (call->index, call->x))
+GL_PROC_SYNC(1837, GLint, glGetUniformLocationARB, (GLhandleARB programObj, const GLcharARB *name), (programObj, name), GLhandleARB programObj; const GLcharARB *name;, (call->programObj, call->name))
+GL_PROC_SYNC_VOID(1838, glTexCoord2dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(1839, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length), GLuint program; GLenum binaryFormat; const void *binary; GLsizei length;, (call->program, call->binaryFormat, call->binary, call->length))
+GL_PROC_SYNC_VOID(1840, glGetNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data), GLuint buffer; GLintptr offset; GLsizeiptr size; void *data;, (call->buffer, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(1841, glGetTexLevelParameterxvOES, (GLenum target, GLint level, GLenum pname, GLfixed *params), (target, level, pname, params), GLenum target; GLint level; GLenum pname; GLfixed *params;, (call->target, call->level, call->pname, call->params))
+GL_PROC_SYNC_VOID(1842, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), GLenum source; GLenum type; GLuint id; GLenum severity; GLsizei length; const GLchar *buf;, (call->source, call->type, call->id, call->severity, call->length, call->buf))
+GL_PROC_SYNC_VOID(1843, glVertexAttrib2dvARB, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1844, glGetPolygonStipple, (GLubyte *mask), (mask), GLubyte *mask;, (call->mask))
+GL_PROC_SYNC_VOID(1845, glGetVertexAttribLui64vNV, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params), GLuint index; GLenum pname; GLuint64EXT *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(1846, glUniform3ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1847, glGetTransformFeedbackVaryingNV, (GLuint program, GLuint index, GLint *location), (program, index, location), GLuint program; GLuint index; GLint *location;, (call->program, call->index, call->location))
+GL_PROC_SYNC(1848, GLbitfield, glQueryMatrixxOES, (GLfixed *mantissa, GLint *exponent), (mantissa, exponent), GLfixed *mantissa; GLint *exponent;, (call->mantissa, call->exponent))
+GL_PROC_SYNC_VOID(1849, glDeleteRenderbuffersEXT, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers), GLsizei n; const GLuint *renderbuffers;, (call->n, call->renderbuffers))
+GL_PROC_SYNC_VOID(1850, glVertexAttrib2svNV, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1851, glPointParameterfvARB, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(1852, glProgramUniform2fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), GLuint program; GLint location; GLfloat v0; GLfloat v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_ASYNC(1853, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer), GLenum target; GLuint buffer;, (call->target, call->buffer))
+GL_PROC_SYNC(1854, void *, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), GLenum target; GLintptr offset; GLsizeiptr length; GLbitfield access;, (call->target, call->offset, call->length, call->access))
+GL_PROC_ASYNC(1855, glEndQueryIndexed, (GLenum target, GLuint index), (target, index), GLenum target; GLuint index;, (call->target, call->index))
+GL_PROC_ASYNC(1856, glUniform1i64ARB, (GLint location, GLint64 x), (location, x), GLint location; GLint64 x;, (call->location, call->x))
+GL_PROC_ASYNC(1857, glGlobalAlphaFactoruiSUN, (GLuint factor), (factor), GLuint factor;, (call->factor))
+GL_PROC_ASYNC(1858, glTexParameterxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param), GLenum target; GLenum pname; GLfixed param;, (call->target, call->pname, call->param))
+GL_PROC_ASYNC(1859, glIndexFormatNV, (GLenum type, GLsizei stride), (type, stride), GLenum type; GLsizei stride;, (call->type, call->stride))
+GL_PROC_SYNC_VOID(1860, glNormal3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(1861, glProgramUniform4iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLint v0; GLint v1; GLint v2; GLint v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_ASYNC(1862, glMultiTexCoord3xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r), (texture, s, t, r), GLenum texture; GLfixed s; GLfixed t; GLfixed r;, (call->texture, call->s, call->t, call->r))
+GL_PROC_ASYNC(1863, glVertexAttribI1i, (GLuint index, GLint x), (index, x), GLuint index; GLint x;, (call->index, call->x))
+GL_PROC_ASYNC(1864, glWindowPos3s, (GLshort x, GLshort y, GLshort z), (x, y, z), GLshort x; GLshort y; GLshort z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1865, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params), GLuint index; GLenum pname; GLuint *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(1866, glWindowPos3fMESA, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1867, glMultiTexCoord4hvNV, (GLenum target, const GLhalfNV *v), (target, v), GLenum target; const GLhalfNV *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1868, glCreateTextures, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures), GLenum target; GLsizei n; GLuint *textures;, (call->target, call->n, call->textures))
+GL_PROC_SYNC_VOID(1869, glProgramUniformMatrix3x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1870, glGetPointervEXT, (GLenum pname, void **params), (pname, params), GLenum pname; void **params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(1871, glProgramUniform1dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1872, glGenerateMipmap, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(1873, glGetVertexAttribdvARB, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLuint index; GLenum pname; GLdouble *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(1874, glMultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLenum texture; GLenum type; GLuint coords;, (call->texture, call->type, call->coords))
+GL_PROC_SYNC_VOID(1875, glDeleteTexturesEXT, (GLsizei n, const GLuint *textures), (n, textures), GLsizei n; const GLuint *textures;, (call->n, call->textures))
+GL_PROC_SYNC_VOID(1876, glProgramUniform4iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1877, glGetNamedFramebufferAttachmentParameterivEXT, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params), GLuint framebuffer; GLenum attachment; GLenum pname; GLint *params;, (call->framebuffer, call->attachment, call->pname, call->params))
+GL_PROC_ASYNC(1878, glEndConditionalRender, (void), (), , ())
+GL_PROC_ASYNC(1879, glSyncTextureINTEL, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_ASYNC(1880, glDisableVertexArrayEXT, (GLuint vaobj, GLenum array), (vaobj, array), GLuint vaobj; GLenum array;, (call->vaobj, call->array))
+GL_PROC_SYNC_VOID(1881, glVariantivEXT, (GLuint id, const GLint *addr), (id, addr), GLuint id; const GLint *addr;, (call->id, call->addr))
+GL_PROC_SYNC_VOID(1882, glProgramLocalParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params), (target, index, params), GLenum target; GLuint index; const GLdouble *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(1883, glColorTableParameterfvSGI, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1884, glHistogramEXT, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink), GLenum target; GLsizei width; GLenum internalformat; GLboolean sink;, (call->target, call->width, call->internalformat, call->sink))
+GL_PROC_ASYNC(1885, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), GLenum target; GLenum attachment; GLuint texture; GLint level; GLint layer;, (call->target, call->attachment, call->texture, call->level, call->layer))
+GL_PROC_ASYNC(1886, glBlendFuncSeparateINGR, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), GLenum sfactorRGB; GLenum dfactorRGB; GLenum sfactorAlpha; GLenum dfactorAlpha;, (call->sfactorRGB, call->dfactorRGB, call->sfactorAlpha, call->dfactorAlpha))
+GL_PROC_ASYNC(1887, glNamedRenderbufferStorageMultisampleAdvancedAMD, (GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, storageSamples, internalformat, width, height), GLuint renderbuffer; GLsizei samples; GLsizei storageSamples; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->samples, call->storageSamples, call->internalformat, call->width, call->height))
+GL_PROC_SYNC(1888, GLboolean, glIsProgramNV, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(1889, glMultiTexCoord3sARB, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r), GLenum target; GLshort s; GLshort t; GLshort r;, (call->target, call->s, call->t, call->r))
+GL_PROC_SYNC(1890, GLboolean, glIsImageHandleResidentNV, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_SYNC_VOID(1891, glBindSamplers, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers), GLuint first; GLsizei count; const GLuint *samplers;, (call->first, call->count, call->samplers))
+GL_PROC_ASYNC(1892, glTextureRenderbufferEXT, (GLuint texture, GLenum target, GLuint renderbuffer), (texture, target, renderbuffer), GLuint texture; GLenum target; GLuint renderbuffer;, (call->texture, call->target, call->renderbuffer))
+GL_PROC_ASYNC(1893, glNamedBufferPageCommitmentEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit), GLuint buffer; GLintptr offset; GLsizeiptr size; GLboolean commit;, (call->buffer, call->offset, call->size, call->commit))
+GL_PROC_ASYNC(1894, glBindTextureEXT, (GLenum target, GLuint texture), (target, texture), GLenum target; GLuint texture;, (call->target, call->texture))
+GL_PROC_ASYNC(1895, glRenderbufferStorageMultisampleAdvancedAMD, (GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, storageSamples, internalformat, width, height), GLenum target; GLsizei samples; GLsizei storageSamples; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->samples, call->storageSamples, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(1896, glDrawElementsInstancedEXT, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei primcount;, (call->mode, call->count, call->type, call->indices, call->primcount))
+GL_PROC_SYNC_VOID(1897, glProgramUniform1ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(1898, glVertexStream3sATI, (GLenum stream, GLshort x, GLshort y, GLshort z), (stream, x, y, z), GLenum stream; GLshort x; GLshort y; GLshort z;, (call->stream, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1899, glMultiTexCoord2fv, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(1900, glVertexArrayColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->size, call->type, call->stride, call->offset))
+GL_PROC_ASYNC(1901, glSampleMaskEXT, (GLclampf value, GLboolean invert), (value, invert), GLclampf value; GLboolean invert;, (call->value, call->invert))
+GL_PROC_SYNC_VOID(1902, glGetVertexAttribLi64vNV, (GLuint index, GLenum pname, GLint64EXT *params), (index, pname, params), GLuint index; GLenum pname; GLint64EXT *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(1903, glGetPerfQueryInfoINTEL, (GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask), (queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask), GLuint queryId; GLuint queryNameLength; GLchar *queryName; GLuint *dataSize; GLuint *noCounters; GLuint *noInstances; GLuint *capsMask;, (call->queryId, call->queryNameLength, call->queryName, call->dataSize, call->noCounters, call->noInstances, call->capsMask))
+GL_PROC_ASYNC(1904, glProgramUniform1f, (GLuint program, GLint location, GLfloat v0), (program, location, v0), GLuint program; GLint location; GLfloat v0;, (call->program, call->location, call->v0))
+GL_PROC_ASYNC(1905, glProgramUniform4ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLuint v0; GLuint v1; GLuint v2; GLuint v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(1906, glGetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1907, glUniform3dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLint location; GLsizei count; const GLdouble *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(1908, GLuint, glBindParameterEXT, (GLenum value), (value), GLenum value;, (call->value))
+GL_PROC_ASYNC(1909, glMultiTexCoord4d, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q), GLenum target; GLdouble s; GLdouble t; GLdouble r; GLdouble q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(1910, glHint, (GLenum target, GLenum mode), (target, mode), GLenum target; GLenum mode;, (call->target, call->mode))
+GL_PROC_ASYNC(1911, glStencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), GLenum fail; GLenum zfail; GLenum zpass;, (call->fail, call->zfail, call->zpass))
+GL_PROC_ASYNC(1912, glVertexAttribL3dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLuint index; GLdouble x; GLdouble y; GLdouble z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1913, glUniform4fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(1914, glTangent3fvEXT, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(1915, glColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue), GLhalfNV red; GLhalfNV green; GLhalfNV blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1916, glMatrixIndexuivARB, (GLint size, const GLuint *indices), (size, indices), GLint size; const GLuint *indices;, (call->size, call->indices))
+GL_PROC_ASYNC(1917, glBeginTransformFeedbackEXT, (GLenum primitiveMode), (primitiveMode), GLenum primitiveMode;, (call->primitiveMode))
+GL_PROC_SYNC_VOID(1918, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary), GLuint program; GLsizei bufSize; GLsizei *length; GLenum *binaryFormat; void *binary;, (call->program, call->bufSize, call->length, call->binaryFormat, call->binary))
+GL_PROC_SYNC(1919, GLboolean, glIsAsyncMarkerSGIX, (GLuint marker), (marker), GLuint marker;, (call->marker))
+GL_PROC_SYNC_VOID(1920, glMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, border, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint internalformat; GLsizei width; GLsizei height; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->height, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(1921, glGetColorTableSGI, (GLenum target, GLenum format, GLenum type, void *table), (target, format, type, table), GLenum target; GLenum format; GLenum type; void *table;, (call->target, call->format, call->type, call->table))
+GL_PROC_SYNC_VOID(1922, glSeparableFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *row, const GLvoid *column), (target, internalformat, width, height, format, type, row, column), GLenum target; GLenum internalformat; GLsizei width; GLsizei height; GLenum format; GLenum type; const GLvoid *row; const GLvoid *column;, (call->target, call->internalformat, call->width, call->height, call->format, call->type, call->row, call->column))
+GL_PROC_SYNC_VOID(1923, glGetDoubleIndexedvEXT, (GLenum target, GLuint index, GLdouble *data), (target, index, data), GLenum target; GLuint index; GLdouble *data;, (call->target, call->index, call->data))
+GL_PROC_ASYNC(1924, glVertexArrayVertexAttribLFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_SYNC_VOID(1925, glProgramUniformMatrix3x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1926, glVertex3xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(1927, glTranslated, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1928, glTransformFeedbackStreamAttribsNV, (GLsizei count, const GLint *attribs, GLsizei nbuffers, const GLint *bufstreams, GLenum bufferMode), (count, attribs, nbuffers, bufstreams, bufferMode), GLsizei count; const GLint *attribs; GLsizei nbuffers; const GLint *bufstreams; GLenum bufferMode;, (call->count, call->attribs, call->nbuffers, call->bufstreams, call->bufferMode))
+GL_PROC_SYNC(1929, GLuint, glGetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName), GLuint program; const GLchar *uniformBlockName;, (call->program, call->uniformBlockName))
+GL_PROC_ASYNC(1930, glConvolutionParameterf, (GLenum target, GLenum pname, GLfloat params), (target, pname, params), GLenum target; GLenum pname; GLfloat params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1931, glGetHistogramParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(1932, glElementPointerATI, (GLenum type, const void *pointer), (type, pointer), GLenum type; const void *pointer;, (call->type, call->pointer))
+GL_PROC_SYNC_VOID(1933, glMatrixIndexusvARB, (GLint size, const GLushort *indices), (size, indices), GLint size; const GLushort *indices;, (call->size, call->indices))
+GL_PROC_SYNC_CLIENT_ARRAY(1934, glVertexPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride), GLint size; GLenum type; GLint stride; const void **pointer; GLint ptrstride;, (call->size, call->type, call->stride, call->pointer, call->ptrstride))
+GL_PROC_ASYNC(1935, glUniform3i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (location, x, y, z), GLint location; GLint64EXT x; GLint64EXT y; GLint64EXT z;, (call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(1936, glCopyPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum type), (x, y, width, height, type), GLint x; GLint y; GLsizei width; GLsizei height; GLenum type;, (call->x, call->y, call->width, call->height, call->type))
+GL_PROC_ASYNC(1937, glWindowPos2sMESA, (GLshort x, GLshort y), (x, y), GLshort x; GLshort y;, (call->x, call->y))
+GL_PROC_SYNC(1938, GLboolean, glIsTextureHandleResidentARB, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_SYNC_VOID(1939, glMultiTexCoord4iv, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1940, glGetProgramParameterdvNV, (GLenum target, GLuint index, GLenum pname, GLdouble *params), (target, index, pname, params), GLenum target; GLuint index; GLenum pname; GLdouble *params;, (call->target, call->index, call->pname, call->params))
+GL_PROC_ASYNC(1941, glExtractComponentEXT, (GLuint res, GLuint src, GLuint num), (res, src, num), GLuint res; GLuint src; GLuint num;, (call->res, call->src, call->num))
+GL_PROC_SYNC(1942, GLint, glGetAttribLocationARB, (GLhandleARB programObj, const GLcharARB *name), (programObj, name), GLhandleARB programObj; const GLcharARB *name;, (call->programObj, call->name))
+GL_PROC_ASYNC(1943, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLenum target; GLenum pname; GLfloat param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(1944, glDeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers), GLsizei count; const GLuint *samplers;, (call->count, call->samplers))
+GL_PROC_SYNC_VOID(1945, glProgramUniformMatrix4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(1946, glGetnMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLenum target; GLboolean reset; GLenum format; GLenum type; GLsizei bufSize; void *values;, (call->target, call->reset, call->format, call->type, call->bufSize, call->values))
+GL_PROC_ASYNC(1947, glConservativeRasterParameterfNV, (GLenum pname, GLfloat value), (pname, value), GLenum pname; GLfloat value;, (call->pname, call->value))
+GL_PROC_SYNC_VOID(1948, glWeightivARB, (GLint size, const GLint *weights), (size, weights), GLint size; const GLint *weights;, (call->size, call->weights))
+GL_PROC_SYNC_VOID(1949, glGetNamedProgramLocalParameterfvEXT, (GLuint program, GLenum target, GLuint index, GLfloat *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; GLfloat *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(1950, glIndexubv, (const GLubyte *c), (c), const GLubyte *c;, (call->c))
+GL_PROC_ASYNC(1951, glBeginConditionalRender, (GLuint id, GLenum mode), (id, mode), GLuint id; GLenum mode;, (call->id, call->mode))
+GL_PROC_SYNC_VOID(1952, glProgramLocalParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params), (target, index, params), GLenum target; GLuint index; const GLuint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(1953, glGetCompressedTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLsizei bufSize; void *pixels;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->bufSize, call->pixels))
+GL_PROC_SYNC_VOID(1954, glGetDoublei_v, (GLenum target, GLuint index, GLdouble *data), (target, index, data), GLenum target; GLuint index; GLdouble *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(1955, glGetnUniformdvARB, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLdouble *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(1956, glNamedProgramLocalParameters4fvEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params), (program, target, index, count, params), GLuint program; GLenum target; GLuint index; GLsizei count; const GLfloat *params;, (call->program, call->target, call->index, call->count, call->params))
+GL_PROC_SYNC(1957, GLboolean, glUnmapBufferARB, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(1958, glGetVertexArrayIndexediv, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param), GLuint vaobj; GLuint index; GLenum pname; GLint *param;, (call->vaobj, call->index, call->pname, call->param))
+GL_PROC_SYNC_VOID(1959, glVertexAttrib4NuivARB, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(1960, glGetVertexArrayPointervEXT, (GLuint vaobj, GLenum pname, void **param), (vaobj, pname, param), GLuint vaobj; GLenum pname; void **param;, (call->vaobj, call->pname, call->param))
+GL_PROC_SYNC_VOID(1961, glConvolutionParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1962, glMulticastGetQueryObjectivNV, (GLuint gpu, GLuint id, GLenum pname, GLint *params), (gpu, id, pname, params), GLuint gpu; GLuint id; GLenum pname; GLint *params;, (call->gpu, call->id, call->pname, call->params))
+GL_PROC_ASYNC(1963, glVertexAttrib4dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_CLIENT_ARRAY(1964, glReplacementCodePointerSUN, (GLenum type, GLsizei stride, const void **pointer), (type, stride, pointer), GLenum type; GLsizei stride; const void **pointer;, (call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(1965, glMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1966, glVertexAttrib1hNV, (GLuint index, GLhalfNV x), (index, x), GLuint index; GLhalfNV x;, (call->index, call->x))
+GL_PROC_ASYNC(1967, glColor3b, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue), GLbyte red; GLbyte green; GLbyte blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(1968, glTexParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params), GLenum target; GLenum pname; const GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(1969, glGetMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1970, glCombinerInputNV, (GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (stage, portion, variable, input, mapping, componentUsage), GLenum stage; GLenum portion; GLenum variable; GLenum input; GLenum mapping; GLenum componentUsage;, (call->stage, call->portion, call->variable, call->input, call->mapping, call->componentUsage))
+GL_PROC_SYNC_VOID(1971, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params), GLenum target; GLenum pname; GLint64 *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(1972, glUniform3ui64ARB, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (location, x, y, z), GLint location; GLuint64 x; GLuint64 y; GLuint64 z;, (call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(1973, glConvolutionParameterxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param), GLenum target; GLenum pname; GLfixed param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(1974, glMatrixMultTranspose3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_ASYNC(1975, glVertex2bOES, (GLbyte x, GLbyte y), (x, y), GLbyte x; GLbyte y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(1976, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(1977, glTexBufferRange, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size), GLenum target; GLenum internalformat; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->target, call->internalformat, call->buffer, call->offset, call->size))
+GL_PROC_SYNC_VOID(1978, glLightfv, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params), GLenum light; GLenum pname; const GLfloat *params;, (call->light, call->pname, call->params))
+GL_PROC_ASYNC(1979, glTextureStorage2DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, target, levels, internalformat, width, height), GLuint texture; GLenum target; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height;, (call->texture, call->target, call->levels, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(1980, glGetNamedFramebufferParameterfvAMD, (GLuint framebuffer, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (framebuffer, pname, numsamples, pixelindex, size, values), GLuint framebuffer; GLenum pname; GLuint numsamples; GLuint pixelindex; GLsizei size; GLfloat *values;, (call->framebuffer, call->pname, call->numsamples, call->pixelindex, call->size, call->values))
+GL_PROC_SYNC_VOID(1981, glPathSubCommandsNV, (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords), GLuint path; GLsizei commandStart; GLsizei commandsToDelete; GLsizei numCommands; const GLubyte *commands; GLsizei numCoords; GLenum coordType; const void *coords;, (call->path, call->commandStart, call->commandsToDelete, call->numCommands, call->commands, call->numCoords, call->coordType, call->coords))
+GL_PROC_ASYNC(1982, glWindowPos3iARB, (GLint x, GLint y, GLint z), (x, y, z), GLint x; GLint y; GLint z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(1983, glMultiTexCoord3fvARB, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(1984, glTexCoord3hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_SYNC_VOID(1985, glGetCompressedMultiTexImageEXT, (GLenum texunit, GLenum target, GLint lod, void *img), (texunit, target, lod, img), GLenum texunit; GLenum target; GLint lod; void *img;, (call->texunit, call->target, call->lod, call->img))
+GL_PROC_ASYNC(1986, glBindVideoCaptureStreamBufferNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset), (video_capture_slot, stream, frame_region, offset), GLuint video_capture_slot; GLuint stream; GLenum frame_region; GLintptrARB offset;, (call->video_capture_slot, call->stream, call->frame_region, call->offset))
+GL_PROC_SYNC_VOID(1987, glVertexStream1svATI, (GLenum stream, const GLshort *coords), (stream, coords), GLenum stream; const GLshort *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(1988, glBeginPerfMonitorAMD, (GLuint monitor), (monitor), GLuint monitor;, (call->monitor))
+GL_PROC_ASYNC(1989, glTbufferMask3DFX, (GLuint mask), (mask), GLuint mask;, (call->mask))
+GL_PROC_SYNC(1990, GLint, glQueryResourceNV, (GLenum queryType, GLint tagId, GLuint bufSize, GLint *buffer), (queryType, tagId, bufSize, buffer), GLenum queryType; GLint tagId; GLuint bufSize; GLint *buffer;, (call->queryType, call->tagId, call->bufSize, call->buffer))
+GL_PROC_SYNC_VOID(1991, glDeleteCommandListsNV, (GLsizei n, const GLuint *lists), (n, lists), GLsizei n; const GLuint *lists;, (call->n, call->lists))
+GL_PROC_ASYNC(1992, glMakeBufferResidentNV, (GLenum target, GLenum access), (target, access), GLenum target; GLenum access;, (call->target, call->access))
+GL_PROC_SYNC_VOID(1993, glGetFinalCombinerInputParameterfvNV, (GLenum variable, GLenum pname, GLfloat *params), (variable, pname, params), GLenum variable; GLenum pname; GLfloat *params;, (call->variable, call->pname, call->params))
+GL_PROC_ASYNC(1994, glTexStorage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLboolean fixedsamplelocations;, (call->target, call->samples, call->internalformat, call->width, call->height, call->fixedsamplelocations))
+GL_PROC_ASYNC(1995, glUseProgram, (GLuint program), (program), GLuint program;, (call->program))
+GL_PROC_SYNC_VOID(1996, glMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; const GLfloat *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(1997, glAsyncMarkerSGIX, (GLuint marker), (marker), GLuint marker;, (call->marker))
+GL_PROC_ASYNC(1998, glBindSampler, (GLuint unit, GLuint sampler), (unit, sampler), GLuint unit; GLuint sampler;, (call->unit, call->sampler))
+GL_PROC_ASYNC(1999, glUniform4ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (location, x, y, z, w), GLint location; GLuint64EXT x; GLuint64EXT y; GLuint64EXT z; GLuint64EXT w;, (call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2000, glStencilStrokePathNV, (GLuint path, GLint reference, GLuint mask), (path, reference, mask), GLuint path; GLint reference; GLuint mask;, (call->path, call->reference, call->mask))
+GL_PROC_ASYNC(2001, glEndPerfQueryINTEL, (GLuint queryHandle), (queryHandle), GLuint queryHandle;, (call->queryHandle))
+GL_PROC_ASYNC(2002, glFramebufferReadBufferEXT, (GLuint framebuffer, GLenum mode), (framebuffer, mode), GLuint framebuffer; GLenum mode;, (call->framebuffer, call->mode))
+GL_PROC_ASYNC(2003, glVertexAttrib4NubARB, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), GLuint index; GLubyte x; GLubyte y; GLubyte z; GLubyte w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2004, glPathStringNV, (GLuint path, GLenum format, GLsizei length, const void *pathString), (path, format, length, pathString), GLuint path; GLenum format; GLsizei length; const void *pathString;, (call->path, call->format, call->length, call->pathString))
+GL_PROC_SYNC_VOID(2005, glTexImage3D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, height, depth, border, format, type, pixels), GLenum target; GLint level; GLint internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->internalFormat, call->width, call->height, call->depth, call->border, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2006, glFinishTextureSUNX, (void), (), , ())
+GL_PROC_ASYNC(2007, glSecondaryColorFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride), GLint size; GLenum type; GLsizei stride;, (call->size, call->type, call->stride))
+GL_PROC_SYNC_VOID(2008, glNamedProgramLocalParameterI4ivEXT, (GLuint program, GLenum target, GLuint index, const GLint *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; const GLint *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(2009, glVertexStream2ivATI, (GLenum stream, const GLint *coords), (stream, coords), GLenum stream; const GLint *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2010, glTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, depth, border, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2011, glGetColorTableParameterivSGI, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2012, glNamedRenderbufferStorageMultisampleCoverageEXT, (GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, coverageSamples, colorSamples, internalformat, width, height), GLuint renderbuffer; GLsizei coverageSamples; GLsizei colorSamples; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->coverageSamples, call->colorSamples, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(2013, glSignalVkFenceNV, (GLuint64 vkFence), (vkFence), GLuint64 vkFence;, (call->vkFence))
+GL_PROC_SYNC_VOID(2014, glLightModelfv, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2015, glVertexAttrib3svARB, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2016, glGetFloatIndexedvEXT, (GLenum target, GLuint index, GLfloat *data), (target, index, data), GLenum target; GLuint index; GLfloat *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(2017, glBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data), (target, offset, size, data), GLenum target; GLintptrARB offset; GLsizeiptrARB size; const void *data;, (call->target, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(2018, glSetLocalConstantEXT, (GLuint id, GLenum type, const void *addr), (id, type, addr), GLuint id; GLenum type; const void *addr;, (call->id, call->type, call->addr))
+GL_PROC_SYNC_VOID(2019, glFragmentLightivSGIX, (GLenum light, GLenum pname, const GLint *params), (light, pname, params), GLenum light; GLenum pname; const GLint *params;, (call->light, call->pname, call->params))
+GL_PROC_SYNC_VOID(2020, glGetProgramLocalParameterfvARB, (GLenum target, GLuint index, GLfloat *params), (target, index, params), GLenum target; GLuint index; GLfloat *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(2021, glVertexAttribL4dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2022, glDeleteTransformFeedbacks, (GLsizei n, const GLuint *ids), (n, ids), GLsizei n; const GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(2023, glReplacementCodeuiColor4ubVertex3fvSUN, (const GLuint *rc, const GLubyte *c, const GLfloat *v), (rc, c, v), const GLuint *rc; const GLubyte *c; const GLfloat *v;, (call->rc, call->c, call->v))
+GL_PROC_ASYNC(2024, glPointParameteriNV, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_ASYNC(2025, glMultiTexCoord2hNV, (GLenum target, GLhalfNV s, GLhalfNV t), (target, s, t), GLenum target; GLhalfNV s; GLhalfNV t;, (call->target, call->s, call->t))
+GL_PROC_ASYNC(2026, glProgramUniform4d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLdouble v0; GLdouble v1; GLdouble v2; GLdouble v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(2027, glGetLocalConstantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data), GLuint id; GLenum value; GLboolean *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(2028, glVertex2sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(2029, glGlobalAlphaFactorfSUN, (GLfloat factor), (factor), GLfloat factor;, (call->factor))
+GL_PROC_SYNC_VOID(2030, glWeightubvARB, (GLint size, const GLubyte *weights), (size, weights), GLint size; const GLubyte *weights;, (call->size, call->weights))
+GL_PROC_SYNC_VOID(2031, glGetVideoCaptureStreamdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; GLdouble *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_SYNC_VOID(2032, glGetConvolutionParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params), GLenum target; GLenum pname; GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2033, glVertexStream1fATI, (GLenum stream, GLfloat x), (stream, x), GLenum stream; GLfloat x;, (call->stream, call->x))
+GL_PROC_ASYNC(2034, glPauseTransformFeedbackNV, (void), (), , ())
+GL_PROC_ASYNC(2035, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y), GLuint index; GLfloat x; GLfloat y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(2036, glGetColorTableParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2037, glGetTexGenxvOES, (GLenum coord, GLenum pname, GLfixed *params), (coord, pname, params), GLenum coord; GLenum pname; GLfixed *params;, (call->coord, call->pname, call->params))
+GL_PROC_ASYNC(2038, glStencilMask, (GLuint mask), (mask), GLuint mask;, (call->mask))
+GL_PROC_ASYNC(2039, glSampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), GLuint maskNumber; GLbitfield mask;, (call->maskNumber, call->mask))
+GL_PROC_SYNC_VOID(2040, glGenOcclusionQueriesNV, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(2041, glLGPUNamedBufferSubDataNVX, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data), GLbitfield gpuMask; GLuint buffer; GLintptr offset; GLsizeiptr size; const void *data;, (call->gpuMask, call->buffer, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(2042, glUniformHandleui64vNV, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2043, glCopyTexImage2DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height; GLint border;, (call->target, call->level, call->internalformat, call->x, call->y, call->width, call->height, call->border))
+GL_PROC_SYNC_VOID(2044, glVertex3hvNV, (const GLhalfNV *v), (v), const GLhalfNV *v;, (call->v))
+GL_PROC_SYNC_VOID(2045, glWeightuivARB, (GLint size, const GLuint *weights), (size, weights), GLint size; const GLuint *weights;, (call->size, call->weights))
+GL_PROC_ASYNC(2046, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), GLint location; GLfloat v0; GLfloat v1; GLfloat v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_SYNC(2047, GLenum, glCheckFramebufferStatus, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(2048, glVDPAUMapSurfacesNV, (GLsizei numSurfaces, const GLvdpauSurfaceNV *surfaces), (numSurfaces, surfaces), GLsizei numSurfaces; const GLvdpauSurfaceNV *surfaces;, (call->numSurfaces, call->surfaces))
+GL_PROC_ASYNC(2049, glVertexAttrib3hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z), (index, x, y, z), GLuint index; GLhalfNV x; GLhalfNV y; GLhalfNV z;, (call->index, call->x, call->y, call->z))
+GL_PROC_ASYNC(2050, glVertexAttribL4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2051, glFlushMappedNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLuint buffer; GLintptr offset; GLsizeiptr length;, (call->buffer, call->offset, call->length))
+GL_PROC_ASYNC(2052, glArrayObjectATI, (GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (array, size, type, stride, buffer, offset), GLenum array; GLint size; GLenum type; GLsizei stride; GLuint buffer; GLuint offset;, (call->array, call->size, call->type, call->stride, call->buffer, call->offset))
+GL_PROC_SYNC_VOID(2053, glUniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2054, glStencilStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLint reference; GLuint mask; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->reference, call->mask, call->transformType, call->transformValues))
+GL_PROC_SYNC_VOID(2055, glGetIntegerIndexedvEXT, (GLenum target, GLuint index, GLint *data), (target, index, data), GLenum target; GLuint index; GLint *data;, (call->target, call->index, call->data))
+GL_PROC_ASYNC(2056, glTexCoord3bOES, (GLbyte s, GLbyte t, GLbyte r), (s, t, r), GLbyte s; GLbyte t; GLbyte r;, (call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(2057, glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers), GLsizei n; const GLuint *buffers;, (call->n, call->buffers))
+GL_PROC_ASYNC(2058, glTexStorage1D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width), GLenum target; GLsizei levels; GLenum internalformat; GLsizei width;, (call->target, call->levels, call->internalformat, call->width))
+GL_PROC_SYNC_VOID(2059, glGetTexBumpParameterivATI, (GLenum pname, GLint *param), (pname, param), GLenum pname; GLint *param;, (call->pname, call->param))
+GL_PROC_SYNC(2060, GLVULKANPROCNV, glGetVkProcAddrNV, (const GLchar *name), (name), const GLchar *name;, (call->name))
+GL_PROC_ASYNC(2061, glDepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f), (index, n, f), GLuint index; GLdouble n; GLdouble f;, (call->index, call->n, call->f))
+GL_PROC_ASYNC(2062, glFogCoorddEXT, (GLdouble coord), (coord), GLdouble coord;, (call->coord))
+GL_PROC_ASYNC(2063, glVertex3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(2064, glVertexArrayTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->size, call->type, call->stride, call->offset))
+GL_PROC_SYNC_VOID(2065, glMatrixLoadTranspose3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_SYNC_VOID(2066, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLint border; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->internalformat, call->width, call->border, call->imageSize, call->data))
+GL_PROC_ASYNC(2067, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), GLuint sampler; GLenum pname; GLint param;, (call->sampler, call->pname, call->param))
+GL_PROC_ASYNC(2068, glNormal3i, (GLint nx, GLint ny, GLint nz), (nx, ny, nz), GLint nx; GLint ny; GLint nz;, (call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(2069, glGetUnsignedBytevEXT, (GLenum pname, GLubyte *data), (pname, data), GLenum pname; GLubyte *data;, (call->pname, call->data))
+GL_PROC_ASYNC(2070, glNormalStream3iATI, (GLenum stream, GLint nx, GLint ny, GLint nz), (stream, nx, ny, nz), GLenum stream; GLint nx; GLint ny; GLint nz;, (call->stream, call->nx, call->ny, call->nz))
+GL_PROC_ASYNC(2071, glSecondaryColor3s, (GLshort red, GLshort green, GLshort blue), (red, green, blue), GLshort red; GLshort green; GLshort blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2072, glLightModelf, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_ASYNC(2073, glVertexArrayVertexOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->size, call->type, call->stride, call->offset))
+GL_PROC_ASYNC(2074, glPNTrianglesiATI, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2075, glConvolutionParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2076, glUniform1i, (GLint location, GLint v0), (location, v0), GLint location; GLint v0;, (call->location, call->v0))
+GL_PROC_SYNC_VOID(2077, glIndexdv, (const GLdouble *c), (c), const GLdouble *c;, (call->c))
+GL_PROC_ASYNC(2078, glProgramUniform3ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (program, location, x, y, z), GLuint program; GLint location; GLuint64 x; GLuint64 y; GLuint64 z;, (call->program, call->location, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2079, glGetTextureParameterIuiv, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params), GLuint texture; GLenum pname; GLuint *params;, (call->texture, call->pname, call->params))
+GL_PROC_ASYNC(2080, glShaderStorageBlockBinding, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding), GLuint program; GLuint storageBlockIndex; GLuint storageBlockBinding;, (call->program, call->storageBlockIndex, call->storageBlockBinding))
+GL_PROC_SYNC_VOID(2081, glUniform2i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(2082, GLint, glRenderMode, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(2083, glVertexArrayMultiTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, texunit, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLenum texunit; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->texunit, call->size, call->type, call->stride, call->offset))
+GL_PROC_SYNC_VOID(2084, glCompressedTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data), GLuint texture; GLint level; GLint xoffset; GLsizei width; GLenum format; GLsizei imageSize; const void *data;, (call->texture, call->level, call->xoffset, call->width, call->format, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(2085, glVertexAttrib4fvNV, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2086, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog), GLuint program; GLsizei bufSize; GLsizei *length; GLchar *infoLog;, (call->program, call->bufSize, call->length, call->infoLog))
+GL_PROC_SYNC(2087, GLboolean, glIsNamedBufferResidentNV, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC(2088, GLboolean, glIsRenderbufferEXT, (GLuint renderbuffer), (renderbuffer), GLuint renderbuffer;, (call->renderbuffer))
+GL_PROC_ASYNC(2089, glDeleteObjectARB, (GLhandleARB obj), (obj), GLhandleARB obj;, (call->obj))
+GL_PROC_SYNC_VOID(2090, glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride), GLenum mode; GLenum type; const void *indirect; GLsizei drawcount; GLsizei stride;, (call->mode, call->type, call->indirect, call->drawcount, call->stride))
+GL_PROC_SYNC_VOID(2091, glMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, border, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint internalformat; GLsizei width; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->border, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2092, glTextureView, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers), GLuint texture; GLenum target; GLuint origtexture; GLenum internalformat; GLuint minlevel; GLuint numlevels; GLuint minlayer; GLuint numlayers;, (call->texture, call->target, call->origtexture, call->internalformat, call->minlevel, call->numlevels, call->minlayer, call->numlayers))
+GL_PROC_ASYNC(2093, glClientAttribDefaultEXT, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_ASYNC(2094, glEGLImageTargetRenderbufferStorageOES, (GLenum target, GLeglImageOES image), (target, image), GLenum target; GLeglImageOES image;, (call->target, call->image))
+GL_PROC_ASYNC(2095, glTexCoord2fColor4ubVertex3fSUN, (GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, x, y, z), GLfloat s; GLfloat t; GLubyte r; GLubyte g; GLubyte b; GLubyte a; GLfloat x; GLfloat y; GLfloat z;, (call->s, call->t, call->r, call->g, call->b, call->a, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2096, glCreateRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLsizei n; GLuint *renderbuffers;, (call->n, call->renderbuffers))
+GL_PROC_ASYNC(2097, glTexCoord2s, (GLshort s, GLshort t), (s, t), GLshort s; GLshort t;, (call->s, call->t))
+GL_PROC_ASYNC(2098, glBindRenderbufferEXT, (GLenum target, GLuint renderbuffer), (target, renderbuffer), GLenum target; GLuint renderbuffer;, (call->target, call->renderbuffer))
+GL_PROC_SYNC_VOID(2099, glGetFragmentMaterialfvSGIX, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params), GLenum face; GLenum pname; GLfloat *params;, (call->face, call->pname, call->params))
+GL_PROC_ASYNC(2100, glVertexArrayBindVertexBufferEXT, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride), GLuint vaobj; GLuint bindingindex; GLuint buffer; GLintptr offset; GLsizei stride;, (call->vaobj, call->bindingindex, call->buffer, call->offset, call->stride))
+GL_PROC_ASYNC(2101, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->target, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_SYNC_VOID(2102, glVertexAttribL4ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v), GLuint index; const GLuint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2103, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name), GLuint program; GLuint colorNumber; GLuint index; const GLchar *name;, (call->program, call->colorNumber, call->index, call->name))
+GL_PROC_SYNC_VOID(2104, glGetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data), GLenum target; GLuint index; GLboolean *data;, (call->target, call->index, call->data))
+GL_PROC_ASYNC(2105, glProgramUniformHandleui64NV, (GLuint program, GLint location, GLuint64 value), (program, location, value), GLuint program; GLint location; GLuint64 value;, (call->program, call->location, call->value))
+GL_PROC_SYNC_VOID(2106, glMultTransposeMatrixfARB, (const GLfloat *m), (m), const GLfloat *m;, (call->m))
+GL_PROC_SYNC_CLIENT_ARRAY(2107, glVertexPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer), GLint size; GLenum type; GLsizei stride; GLsizei count; const void *pointer;, (call->size, call->type, call->stride, call->count, call->pointer))
+GL_PROC_SYNC_VOID(2108, glCreateCommandListsNV, (GLsizei n, GLuint *lists), (n, lists), GLsizei n; GLuint *lists;, (call->n, call->lists))
+GL_PROC_SYNC_VOID(2109, glDeleteOcclusionQueriesNV, (GLsizei n, const GLuint *ids), (n, ids), GLsizei n; const GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(2110, glVDPAUUnmapSurfacesNV, (GLsizei numSurface, const GLvdpauSurfaceNV *surfaces), (numSurface, surfaces), GLsizei numSurface; const GLvdpauSurfaceNV *surfaces;, (call->numSurface, call->surfaces))
+GL_PROC_SYNC_VOID(2111, glMultiTexCoord4fv, (GLenum target, const GLfloat *v), (target, v), GLenum target; const GLfloat *v;, (call->target, call->v))
+GL_PROC_ASYNC(2112, glCombinerParameteriNV, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2113, glCullParameterdvEXT, (GLenum pname, GLdouble *params), (pname, params), GLenum pname; GLdouble *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2114, glMatrixLoadTransposedEXT, (GLenum mode, const GLdouble *m), (mode, m), GLenum mode; const GLdouble *m;, (call->mode, call->m))
+GL_PROC_ASYNC(2115, glImageTransformParameteriHP, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_ASYNC(2116, glDrawArraysInstancedEXT, (GLenum mode, GLint start, GLsizei count, GLsizei primcount), (mode, start, count, primcount), GLenum mode; GLint start; GLsizei count; GLsizei primcount;, (call->mode, call->start, call->count, call->primcount))
+GL_PROC_ASYNC(2117, glEvalPoint1, (GLint i), (i), GLint i;, (call->i))
+GL_PROC_SYNC_VOID(2118, glNamedFramebufferSampleLocationsfvARB, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v), GLuint framebuffer; GLuint start; GLsizei count; const GLfloat *v;, (call->framebuffer, call->start, call->count, call->v))
+GL_PROC_SYNC_VOID(2119, glTransformPathNV, (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues), (resultPath, srcPath, transformType, transformValues), GLuint resultPath; GLuint srcPath; GLenum transformType; const GLfloat *transformValues;, (call->resultPath, call->srcPath, call->transformType, call->transformValues))
+GL_PROC_ASYNC(2120, glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance), GLenum mode; GLint first; GLsizei count; GLsizei instancecount; GLuint baseinstance;, (call->mode, call->first, call->count, call->instancecount, call->baseinstance))
+GL_PROC_ASYNC(2121, glIndexd, (GLdouble c), (c), GLdouble c;, (call->c))
+GL_PROC_SYNC_VOID(2122, glStencilFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLenum fillMode; GLuint mask; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->fillMode, call->mask, call->transformType, call->transformValues))
+GL_PROC_SYNC_VOID(2123, glVertexStream4fvATI, (GLenum stream, const GLfloat *coords), (stream, coords), GLenum stream; const GLfloat *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2124, glGetFloati_v, (GLenum target, GLuint index, GLfloat *data), (target, index, data), GLenum target; GLuint index; GLfloat *data;, (call->target, call->index, call->data))
+GL_PROC_SYNC_VOID(2125, glVertexAttrib1svARB, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(2126, glVertexAttrib2fARB, (GLuint index, GLfloat x, GLfloat y), (index, x, y), GLuint index; GLfloat x; GLfloat y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(2127, glGetShadingRateSampleLocationivNV, (GLenum rate, GLuint samples, GLuint index, GLint *location), (rate, samples, index, location), GLenum rate; GLuint samples; GLuint index; GLint *location;, (call->rate, call->samples, call->index, call->location))
+GL_PROC_SYNC_VOID(2128, glGetVariantArrayObjectivATI, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLuint id; GLenum pname; GLint *params;, (call->id, call->pname, call->params))
+GL_PROC_ASYNC(2129, glProgramUniform2ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y), (program, location, x, y), GLuint program; GLint location; GLuint64EXT x; GLuint64EXT y;, (call->program, call->location, call->x, call->y))
+GL_PROC_SYNC_VOID(2130, glBitmapxOES, (GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap), GLsizei width; GLsizei height; GLfixed xorig; GLfixed yorig; GLfixed xmove; GLfixed ymove; const GLubyte *bitmap;, (call->width, call->height, call->xorig, call->yorig, call->xmove, call->ymove, call->bitmap))
+GL_PROC_SYNC_VOID(2131, glMatrixLoad3x2fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_SYNC_VOID(2132, glColor3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2133, glWindowPos2dARB, (GLdouble x, GLdouble y), (x, y), GLdouble x; GLdouble y;, (call->x, call->y))
+GL_PROC_ASYNC(2134, glUseProgramObjectARB, (GLhandleARB programObj), (programObj), GLhandleARB programObj;, (call->programObj))
+GL_PROC_SYNC_VOID(2135, glMapVertexAttrib2dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLuint index; GLuint size; GLdouble u1; GLdouble u2; GLint ustride; GLint uorder; GLdouble v1; GLdouble v2; GLint vstride; GLint vorder; const GLdouble *points;, (call->index, call->size, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->points))
+GL_PROC_SYNC_VOID(2136, glGetObjectLabelEXT, (GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label), (type, object, bufSize, length, label), GLenum type; GLuint object; GLsizei bufSize; GLsizei *length; GLchar *label;, (call->type, call->object, call->bufSize, call->length, call->label))
+GL_PROC_SYNC_VOID(2137, glWeightdvARB, (GLint size, const GLdouble *weights), (size, weights), GLint size; const GLdouble *weights;, (call->size, call->weights))
+GL_PROC_SYNC_VOID(2138, glSecondaryColor3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(2139, glTexCoord3bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_SYNC_VOID(2140, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLuint index; GLenum pname; GLfloat *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(2141, glVertexAttribL1ui64vARB, (GLuint index, const GLuint64EXT *v), (index, v), GLuint index; const GLuint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2142, glDeletePerfMonitorsAMD, (GLsizei n, GLuint *monitors), (n, monitors), GLsizei n; GLuint *monitors;, (call->n, call->monitors))
+GL_PROC_ASYNC(2143, glBindBufferOffsetEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset), GLenum target; GLuint index; GLuint buffer; GLintptr offset;, (call->target, call->index, call->buffer, call->offset))
+GL_PROC_ASYNC(2144, glProgramUniform3fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLfloat v0; GLfloat v1; GLfloat v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_SYNC_VOID(2145, glProgramUniform2iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(2146, glLineStipple, (GLint factor, GLushort pattern), (factor, pattern), GLint factor; GLushort pattern;, (call->factor, call->pattern))
+GL_PROC_ASYNC(2147, glDrawTransformFeedbackNV, (GLenum mode, GLuint id), (mode, id), GLenum mode; GLuint id;, (call->mode, call->id))
+GL_PROC_SYNC_VOID(2148, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2149, glMultiTexCoord4sv, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2150, glMatrixLoad3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m), GLenum matrixMode; const GLfloat *m;, (call->matrixMode, call->m))
+GL_PROC_SYNC_VOID(2151, glGetMapParameterivNV, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2152, glGetMultiTexLevelParameterivEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params), (texunit, target, level, pname, params), GLenum texunit; GLenum target; GLint level; GLenum pname; GLint *params;, (call->texunit, call->target, call->level, call->pname, call->params))
+GL_PROC_ASYNC(2153, glUniform4i64ARB, (GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (location, x, y, z, w), GLint location; GLint64 x; GLint64 y; GLint64 z; GLint64 w;, (call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2154, glLightxOES, (GLenum light, GLenum pname, GLfixed param), (light, pname, param), GLenum light; GLenum pname; GLfixed param;, (call->light, call->pname, call->param))
+GL_PROC_SYNC_VOID(2155, glGetVertexArrayPointeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, void **param), (vaobj, index, pname, param), GLuint vaobj; GLuint index; GLenum pname; void **param;, (call->vaobj, call->index, call->pname, call->param))
+GL_PROC_ASYNC(2156, glNamedRenderbufferStorage, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height), GLuint renderbuffer; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(2157, glEvalCoord1xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(2158, glBinormal3dEXT, (GLdouble bx, GLdouble by, GLdouble bz), (bx, by, bz), GLdouble bx; GLdouble by; GLdouble bz;, (call->bx, call->by, call->bz))
+GL_PROC_ASYNC(2159, glGetQueryBufferObjectuiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLuint id; GLuint buffer; GLenum pname; GLintptr offset;, (call->id, call->buffer, call->pname, call->offset))
+GL_PROC_ASYNC(2160, glArrayElementEXT, (GLint i), (i), GLint i;, (call->i))
+GL_PROC_SYNC_VOID(2161, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params), GLenum target; GLenum pname; const GLuint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2162, glReplacementCodeuivSUN, (const GLuint *code), (code), const GLuint *code;, (call->code))
+GL_PROC_SYNC_VOID(2163, glGetPerfQueryDataINTEL, (GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten), (queryHandle, flags, dataSize, data, bytesWritten), GLuint queryHandle; GLuint flags; GLsizei dataSize; void *data; GLuint *bytesWritten;, (call->queryHandle, call->flags, call->dataSize, call->data, call->bytesWritten))
+GL_PROC_SYNC_VOID(2164, glTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2165, glGetPathCommandsNV, (GLuint path, GLubyte *commands), (path, commands), GLuint path; GLubyte *commands;, (call->path, call->commands))
+GL_PROC_ASYNC(2166, glCopyTexImage1DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLint border;, (call->target, call->level, call->internalformat, call->x, call->y, call->width, call->border))
+GL_PROC_SYNC_VOID(2167, glGetImageTransformParameterfvHP, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2168, glRasterPos3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(2169, glUniformHandleui64ARB, (GLint location, GLuint64 value), (location, value), GLint location; GLuint64 value;, (call->location, call->value))
+GL_PROC_ASYNC(2170, glVertexAttribI1ui, (GLuint index, GLuint x), (index, x), GLuint index; GLuint x;, (call->index, call->x))
+GL_PROC_ASYNC(2171, glDeleteFragmentShaderATI, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_ASYNC(2172, glPointParameteri, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2173, glSecondaryColor3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2174, glProgramLocalParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w), GLenum target; GLuint index; GLint x; GLint y; GLint z; GLint w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2175, glDisableClientState, (GLenum cap), (cap), GLenum cap;, (call->cap))
+GL_PROC_SYNC_VOID(2176, glGetVertexAttribfvNV, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLuint index; GLenum pname; GLfloat *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(2177, glDrawBuffer, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(2178, glWindowPos3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2179, glVertexStream3dvATI, (GLenum stream, const GLdouble *coords), (stream, coords), GLenum stream; const GLdouble *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(2180, glColor4s, (GLshort red, GLshort green, GLshort blue, GLshort alpha), (red, green, blue, alpha), GLshort red; GLshort green; GLshort blue; GLshort alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(2181, glVertexStream2svATI, (GLenum stream, const GLshort *coords), (stream, coords), GLenum stream; const GLshort *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2182, glGetTexParameterIivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2183, glColor4dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(2184, glCombinerParameterfNV, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2185, glMultiTexCoord1iv, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2186, glVertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2187, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLuint index; GLdouble x; GLdouble y; GLdouble z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2188, glMultiDrawArraysIndirectCount, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride), GLenum mode; const void *indirect; GLintptr drawcount; GLsizei maxdrawcount; GLsizei stride;, (call->mode, call->indirect, call->drawcount, call->maxdrawcount, call->stride))
+GL_PROC_SYNC_VOID(2189, glGetBufferParameterivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2190, glAlphaFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod), GLenum op; GLuint dst; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod; GLuint arg2; GLuint arg2Rep; GLuint arg2Mod;, (call->op, call->dst, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod, call->arg2, call->arg2Rep, call->arg2Mod))
+GL_PROC_SYNC_VOID(2191, glMapVertexAttrib2fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLuint index; GLuint size; GLfloat u1; GLfloat u2; GLint ustride; GLint uorder; GLfloat v1; GLfloat v2; GLint vstride; GLint vorder; const GLfloat *points;, (call->index, call->size, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->points))
+GL_PROC_SYNC_VOID(2192, glVertexAttrib4ubvARB, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2193, glTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; const GLint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2194, glGetPerfMonitorGroupStringAMD, (GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString), (group, bufSize, length, groupString), GLuint group; GLsizei bufSize; GLsizei *length; GLchar *groupString;, (call->group, call->bufSize, call->length, call->groupString))
+GL_PROC_ASYNC(2195, glPathStencilDepthOffsetNV, (GLfloat factor, GLfloat units), (factor, units), GLfloat factor; GLfloat units;, (call->factor, call->units))
+GL_PROC_SYNC_VOID(2196, glGetVideoivNV, (GLuint video_slot, GLenum pname, GLint *params), (video_slot, pname, params), GLuint video_slot; GLenum pname; GLint *params;, (call->video_slot, call->pname, call->params))
+GL_PROC_SYNC_VOID(2197, glGetVertexAttribIivEXT, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(2198, glTexBufferEXT, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), GLenum target; GLenum internalformat; GLuint buffer;, (call->target, call->internalformat, call->buffer))
+GL_PROC_ASYNC(2199, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), GLuint index; GLboolean r; GLboolean g; GLboolean b; GLboolean a;, (call->index, call->r, call->g, call->b, call->a))
+GL_PROC_SYNC_VOID(2200, glUniform4i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2201, glReplacementCodeuiColor4ubVertex3fSUN, (GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, x, y, z), GLuint rc; GLubyte r; GLubyte g; GLubyte b; GLubyte a; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->r, call->g, call->b, call->a, call->x, call->y, call->z))
+GL_PROC_SYNC(2202, GLuint64, glGetTextureSamplerHandleARB, (GLuint texture, GLuint sampler), (texture, sampler), GLuint texture; GLuint sampler;, (call->texture, call->sampler))
+GL_PROC_SYNC_VOID(2203, glDeleteQueries, (GLsizei n, const GLuint *ids), (n, ids), GLsizei n; const GLuint *ids;, (call->n, call->ids))
+GL_PROC_SYNC_VOID(2204, glVertexAttrib4ivARB, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2205, glVertexStream4svATI, (GLenum stream, const GLshort *coords), (stream, coords), GLenum stream; const GLshort *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2206, glMatrixMultdEXT, (GLenum mode, const GLdouble *m), (mode, m), GLenum mode; const GLdouble *m;, (call->mode, call->m))
+GL_PROC_SYNC_VOID(2207, glMatrixLoadTransposefEXT, (GLenum mode, const GLfloat *m), (mode, m), GLenum mode; const GLfloat *m;, (call->mode, call->m))
+GL_PROC_ASYNC(2208, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer), GLenum target; GLuint renderbuffer;, (call->target, call->renderbuffer))
+GL_PROC_SYNC_VOID(2209, glVertexAttrib4NivARB, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2210, glEvalCoord2xOES, (GLfixed u, GLfixed v), (u, v), GLfixed u; GLfixed v;, (call->u, call->v))
+GL_PROC_ASYNC(2211, glRasterPos2i, (GLint x, GLint y), (x, y), GLint x; GLint y;, (call->x, call->y))
+GL_PROC_ASYNC(2212, glProgramUniform1ui64NV, (GLuint program, GLint location, GLuint64EXT x), (program, location, x), GLuint program; GLint location; GLuint64EXT x;, (call->program, call->location, call->x))
+GL_PROC_SYNC_VOID(2213, glVertexAttribL2ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v), GLuint index; const GLuint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2214, glScissorIndexedv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2215, glUniform2iARB, (GLint location, GLint v0, GLint v1), (location, v0, v1), GLint location; GLint v0; GLint v1;, (call->location, call->v0, call->v1))
+GL_PROC_ASYNC(2216, glTextureStorageMem1DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, memory, offset), GLuint texture; GLsizei levels; GLenum internalFormat; GLsizei width; GLuint memory; GLuint64 offset;, (call->texture, call->levels, call->internalFormat, call->width, call->memory, call->offset))
+GL_PROC_SYNC_VOID(2217, glMultiTexCoord2dv, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2218, glWindowPos4fvMESA, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(2219, glColor3ubv, (const GLubyte *v), (v), const GLubyte *v;, (call->v))
+GL_PROC_SYNC_VOID(2220, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode), GLuint program; GLsizei count; const GLchar *const*varyings; GLenum bufferMode;, (call->program, call->count, call->varyings, call->bufferMode))
+GL_PROC_SYNC_CLIENT_ARRAY(2221, glVertexPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer), GLint size; GLenum type; const void **pointer;, (call->size, call->type, call->pointer))
+GL_PROC_SYNC_VOID(2222, glNormal3fVertex3fvSUN, (const GLfloat *n, const GLfloat *v), (n, v), const GLfloat *n; const GLfloat *v;, (call->n, call->v))
+GL_PROC_ASYNC(2223, glCopyConvolutionFilter2D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->internalformat, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(2224, glTexStorage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLenum target; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedsamplelocations;, (call->target, call->samples, call->internalformat, call->width, call->height, call->depth, call->fixedsamplelocations))
+GL_PROC_SYNC_VOID(2225, glGetMapAttribParameterivNV, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params), GLenum target; GLuint index; GLenum pname; GLint *params;, (call->target, call->index, call->pname, call->params))
+GL_PROC_ASYNC(2226, glMatrixPushEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(2227, glVertex4fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(2228, glVertexAttribL1dEXT, (GLuint index, GLdouble x), (index, x), GLuint index; GLdouble x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(2229, glGetProgramEnvParameterIuivNV, (GLenum target, GLuint index, GLuint *params), (target, index, params), GLenum target; GLuint index; GLuint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(2230, glNormalP3uiv, (GLenum type, const GLuint *coords), (type, coords), GLenum type; const GLuint *coords;, (call->type, call->coords))
+GL_PROC_ASYNC(2231, glVertexAttrib3dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLuint index; GLdouble x; GLdouble y; GLdouble z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2232, glConvolutionParameterivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2233, glVertexAttrib2dARB, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLuint index; GLdouble x; GLdouble y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_CLIENT_ARRAY(2234, glBinormalPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLenum type; GLsizei stride; const void *pointer;, (call->type, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(2235, glFramebufferSampleLocationsfvARB, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v), GLenum target; GLuint start; GLsizei count; const GLfloat *v;, (call->target, call->start, call->count, call->v))
+GL_PROC_ASYNC(2236, glUniformBufferEXT, (GLuint program, GLint location, GLuint buffer), (program, location, buffer), GLuint program; GLint location; GLuint buffer;, (call->program, call->location, call->buffer))
+GL_PROC_SYNC_VOID(2237, glVertexAttrib3sv, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2238, glClipPlanefOES, (GLenum plane, const GLfloat *equation), (plane, equation), GLenum plane; const GLfloat *equation;, (call->plane, call->equation))
+GL_PROC_SYNC_VOID(2239, glGetInteger64v, (GLenum pname, GLint64 *data), (pname, data), GLenum pname; GLint64 *data;, (call->pname, call->data))
+GL_PROC_SYNC_VOID(2240, glLoadTransposeMatrixxOES, (const GLfixed *m), (m), const GLfixed *m;, (call->m))
+GL_PROC_SYNC_VOID(2241, glMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, width, height, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2242, glMultiTexCoord2iv, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2243, glNamedFramebufferSamplePositionsfvAMD, (GLuint framebuffer, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (framebuffer, numsamples, pixelindex, values), GLuint framebuffer; GLuint numsamples; GLuint pixelindex; const GLfloat *values;, (call->framebuffer, call->numsamples, call->pixelindex, call->values))
+GL_PROC_ASYNC(2244, glVertex2f, (GLfloat x, GLfloat y), (x, y), GLfloat x; GLfloat y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(2245, glVertexAttribs3svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v), GLuint index; GLsizei count; const GLshort *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(2246, glGetRenderbufferParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2247, glProgramUniformMatrix3x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2248, glCompressedMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, border, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLint border; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->border, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(2249, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params), GLenum target; GLenum pname; GLuint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2250, glTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v), const GLfloat *tc; const GLfloat *c; const GLfloat *n; const GLfloat *v;, (call->tc, call->c, call->n, call->v))
+GL_PROC_SYNC(2251, GLboolean, glAreProgramsResidentNV, (GLsizei n, const GLuint *programs, GLboolean *residences), (n, programs, residences), GLsizei n; const GLuint *programs; GLboolean *residences;, (call->n, call->programs, call->residences))
+GL_PROC_ASYNC(2252, glMultiTexCoord1s, (GLenum target, GLshort s), (target, s), GLenum target; GLshort s;, (call->target, call->s))
+GL_PROC_ASYNC(2253, glTexPageCommitmentARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (target, level, xoffset, yoffset, zoffset, width, height, depth, commit), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLboolean commit;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->commit))
+GL_PROC_SYNC_VOID(2254, glGenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays), GLsizei n; GLuint *arrays;, (call->n, call->arrays))
+GL_PROC_SYNC_VOID(2255, glGetImageTransformParameterivHP, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2256, glTexBumpParameterfvATI, (GLenum pname, const GLfloat *param), (pname, param), GLenum pname; const GLfloat *param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2257, glClearNamedBufferData, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data), GLuint buffer; GLenum internalformat; GLenum format; GLenum type; const void *data;, (call->buffer, call->internalformat, call->format, call->type, call->data))
+GL_PROC_ASYNC(2258, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), GLuint index; GLint x; GLint y; GLint z; GLint w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2259, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor), GLuint index; GLuint divisor;, (call->index, call->divisor))
+GL_PROC_ASYNC(2260, glTextureParameteriEXT, (GLuint texture, GLenum target, GLenum pname, GLint param), (texture, target, pname, param), GLuint texture; GLenum target; GLenum pname; GLint param;, (call->texture, call->target, call->pname, call->param))
+GL_PROC_SYNC(2261, GLboolean, glIsTransformFeedback, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(2262, glGetMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, GLuint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLuint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_ASYNC(2263, glUniform3i64ARB, (GLint location, GLint64 x, GLint64 y, GLint64 z), (location, x, y, z), GLint location; GLint64 x; GLint64 y; GLint64 z;, (call->location, call->x, call->y, call->z))
+GL_PROC_ASYNC(2264, glSecondaryColor3sEXT, (GLshort red, GLshort green, GLshort blue), (red, green, blue), GLshort red; GLshort green; GLshort blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2265, glMultiDrawMeshTasksIndirectNV, (GLintptr indirect, GLsizei drawcount, GLsizei stride), (indirect, drawcount, stride), GLintptr indirect; GLsizei drawcount; GLsizei stride;, (call->indirect, call->drawcount, call->stride))
+GL_PROC_SYNC_VOID(2266, glGetMultiTexLevelParameterfvEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params), (texunit, target, level, pname, params), GLenum texunit; GLenum target; GLint level; GLenum pname; GLfloat *params;, (call->texunit, call->target, call->level, call->pname, call->params))
+GL_PROC_ASYNC(2267, glRectxOES, (GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2), (x1, y1, x2, y2), GLfixed x1; GLfixed y1; GLfixed x2; GLfixed y2;, (call->x1, call->y1, call->x2, call->y2))
+GL_PROC_SYNC_VOID(2268, glWindowPos3iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2269, glDeletePerfQueryINTEL, (GLuint queryHandle), (queryHandle), GLuint queryHandle;, (call->queryHandle))
+GL_PROC_SYNC_VOID(2270, glGetnUniformuivARB, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLuint *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(2271, glGetnColorTableARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table), GLenum target; GLenum format; GLenum type; GLsizei bufSize; void *table;, (call->target, call->format, call->type, call->bufSize, call->table))
+GL_PROC_SYNC_VOID(2272, glPathParameterfvNV, (GLuint path, GLenum pname, const GLfloat *value), (path, pname, value), GLuint path; GLenum pname; const GLfloat *value;, (call->path, call->pname, call->value))
+GL_PROC_SYNC_VOID(2273, glPixelMapx, (GLenum map, GLint size, const GLfixed *values), (map, size, values), GLenum map; GLint size; const GLfixed *values;, (call->map, call->size, call->values))
+GL_PROC_SYNC_VOID(2274, glUniformHandleui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2275, glCopyMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texunit, target, level, internalformat, x, y, width, height, border), GLenum texunit; GLenum target; GLint level; GLenum internalformat; GLint x; GLint y; GLsizei width; GLsizei height; GLint border;, (call->texunit, call->target, call->level, call->internalformat, call->x, call->y, call->width, call->height, call->border))
+GL_PROC_SYNC_VOID(2276, glWindowPos2fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC(2277, GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames), const void *vdpSurface; GLenum target; GLsizei numTextureNames; const GLuint *textureNames;, (call->vdpSurface, call->target, call->numTextureNames, call->textureNames))
+GL_PROC_ASYNC(2278, glFlushRasterSGIX, (void), (), , ())
+GL_PROC_ASYNC(2279, glMultiTexCoord2sARB, (GLenum target, GLshort s, GLshort t), (target, s, t), GLenum target; GLshort s; GLshort t;, (call->target, call->s, call->t))
+GL_PROC_ASYNC(2280, glUniform4uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), GLint location; GLuint v0; GLuint v1; GLuint v2; GLuint v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_ASYNC(2281, glColor3d, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue), GLdouble red; GLdouble green; GLdouble blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2282, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), GLenum target; GLuint index; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->target, call->index, call->buffer, call->offset, call->size))
+GL_PROC_SYNC_VOID(2283, glSecondaryColor3bvEXT, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_SYNC_VOID(2284, glVertexAttrib4fvARB, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2285, glProgramUniform4uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2286, glShaderBinary, (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length), (count, shaders, binaryformat, binary, length), GLsizei count; const GLuint *shaders; GLenum binaryformat; const void *binary; GLsizei length;, (call->count, call->shaders, call->binaryformat, call->binary, call->length))
+GL_PROC_SYNC_VOID(2287, glGetVideoCaptureivNV, (GLuint video_capture_slot, GLenum pname, GLint *params), (video_capture_slot, pname, params), GLuint video_capture_slot; GLenum pname; GLint *params;, (call->video_capture_slot, call->pname, call->params))
+GL_PROC_SYNC_VOID(2288, glGetMinmaxParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2289, glGenSemaphoresEXT, (GLsizei n, GLuint *semaphores), (n, semaphores), GLsizei n; GLuint *semaphores;, (call->n, call->semaphores))
+GL_PROC_SYNC_CLIENT_ARRAY(2290, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer), GLuint index; GLint size; GLenum type; GLboolean normalized; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->normalized, call->stride, call->pointer))
+GL_PROC_SYNC_VOID(2291, glProgramUniform2ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2292, glTexCoord4fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(2293, glGlobalAlphaFactorbSUN, (GLbyte factor), (factor), GLbyte factor;, (call->factor))
+GL_PROC_SYNC_VOID(2294, glFragmentMaterialfvSGIX, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params), GLenum face; GLenum pname; const GLfloat *params;, (call->face, call->pname, call->params))
+GL_PROC_SYNC_VOID(2295, glGetOcclusionQueryivNV, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLuint id; GLenum pname; GLint *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(2296, glProgramUniform2fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(2297, glBindMultiTextureEXT, (GLenum texunit, GLenum target, GLuint texture), (texunit, target, texture), GLenum texunit; GLenum target; GLuint texture;, (call->texunit, call->target, call->texture))
+GL_PROC_SYNC_VOID(2298, glTexCoord2iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2299, glUniform2ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y), (location, x, y), GLint location; GLuint64EXT x; GLuint64EXT y;, (call->location, call->x, call->y))
+GL_PROC_ASYNC(2300, glNamedRenderbufferStorageEXT, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height), GLuint renderbuffer; GLenum internalformat; GLsizei width; GLsizei height;, (call->renderbuffer, call->internalformat, call->width, call->height))
+GL_PROC_SYNC_VOID(2301, glProgramUniform3uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2302, glCompressedTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLsizei imageSize; const void *data;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->imageSize, call->data))
+GL_PROC_ASYNC(2303, glSecondaryColor3ui, (GLuint red, GLuint green, GLuint blue), (red, green, blue), GLuint red; GLuint green; GLuint blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(2304, glGetHistogramParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2305, glVertexAttribIFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_ASYNC(2306, glRects, (GLshort x1, GLshort y1, GLshort x2, GLshort y2), (x1, y1, x2, y2), GLshort x1; GLshort y1; GLshort x2; GLshort y2;, (call->x1, call->y1, call->x2, call->y2))
+GL_PROC_SYNC_VOID(2307, glVertexAttribL2dvEXT, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(2308, glMultiTexCoord3dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r), GLenum target; GLdouble s; GLdouble t; GLdouble r;, (call->target, call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(2309, glVertexAttrib4bvARB, (GLuint index, const GLbyte *v), (index, v), GLuint index; const GLbyte *v;, (call->index, call->v))
+GL_PROC_ASYNC(2310, glReadInstrumentsSGIX, (GLint marker), (marker), GLint marker;, (call->marker))
+GL_PROC_ASYNC(2311, glProgramUniform1i64ARB, (GLuint program, GLint location, GLint64 x), (program, location, x), GLuint program; GLint location; GLint64 x;, (call->program, call->location, call->x))
+GL_PROC_ASYNC(2312, glWaitVkSemaphoreNV, (GLuint64 vkSemaphore), (vkSemaphore), GLuint64 vkSemaphore;, (call->vkSemaphore))
+GL_PROC_SYNC_VOID(2313, glVertexAttribI4uivEXT, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2314, glBufferStorageMemEXT, (GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset), (target, size, memory, offset), GLenum target; GLsizeiptr size; GLuint memory; GLuint64 offset;, (call->target, call->size, call->memory, call->offset))
+GL_PROC_SYNC_VOID(2315, glGetPerfCounterInfoINTEL, (GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue), (queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue), GLuint queryId; GLuint counterId; GLuint counterNameLength; GLchar *counterName; GLuint counterDescLength; GLchar *counterDesc; GLuint *counterOffset; GLuint *counterDataSize; GLuint *counterTypeEnum; GLuint *counterDataTypeEnum; GLuint64 *rawCounterMaxValue;, (call->queryId, call->counterId, call->counterNameLength, call->counterName, call->counterDescLength, call->counterDesc, call->counterOffset, call->counterDataSize, call->counterTypeEnum, call->counterDataTypeEnum, call->rawCounterMaxValue))
+GL_PROC_SYNC_VOID(2316, glNormalStream3bvATI, (GLenum stream, const GLbyte *coords), (stream, coords), GLenum stream; const GLbyte *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2317, glGetPixelMapfv, (GLenum map, GLfloat *values), (map, values), GLenum map; GLfloat *values;, (call->map, call->values))
+GL_PROC_SYNC_VOID(2318, glClearNamedFramebufferfv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value), GLuint framebuffer; GLenum buffer; GLint drawbuffer; const GLfloat *value;, (call->framebuffer, call->buffer, call->drawbuffer, call->value))
+GL_PROC_SYNC_VOID(2319, glProgramEnvParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params), (target, index, params), GLenum target; GLuint index; const GLdouble *params;, (call->target, call->index, call->params))
+GL_PROC_ASYNC(2320, glPNTrianglesfATI, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2321, glGetColorTableParameterfvSGI, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2322, glNamedBufferAttachMemoryNV, (GLuint buffer, GLuint memory, GLuint64 offset), (buffer, memory, offset), GLuint buffer; GLuint memory; GLuint64 offset;, (call->buffer, call->memory, call->offset))
+GL_PROC_SYNC_VOID(2323, glEvalCoord1dv, (const GLdouble *u), (u), const GLdouble *u;, (call->u))
+GL_PROC_SYNC_CLIENT_ARRAY(2324, glFogCoordPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLenum type; GLsizei stride; const void *pointer;, (call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(2325, glUploadGpuMaskNVX, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_ASYNC(2326, glBindProgramPipeline, (GLuint pipeline), (pipeline), GLuint pipeline;, (call->pipeline))
+GL_PROC_SYNC_VOID(2327, glPointParameterfvEXT, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(2328, glEnableClientStateIndexedEXT, (GLenum array, GLuint index), (array, index), GLenum array; GLuint index;, (call->array, call->index))
+GL_PROC_SYNC_VOID(2329, glProgramUniformMatrix4x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2330, glTransformFeedbackBufferRange, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size), GLuint xfb; GLuint index; GLuint buffer; GLintptr offset; GLsizeiptr size;, (call->xfb, call->index, call->buffer, call->offset, call->size))
+GL_PROC_ASYNC(2331, glImportSemaphoreFdEXT, (GLuint semaphore, GLenum handleType, GLint fd), (semaphore, handleType, fd), GLuint semaphore; GLenum handleType; GLint fd;, (call->semaphore, call->handleType, call->fd))
+GL_PROC_ASYNC(2332, glTextureStorage3DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, target, levels, internalformat, width, height, depth), GLuint texture; GLenum target; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth;, (call->texture, call->target, call->levels, call->internalformat, call->width, call->height, call->depth))
+GL_PROC_ASYNC(2333, glMultiTexCoord4f, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q), GLenum target; GLfloat s; GLfloat t; GLfloat r; GLfloat q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(2334, glUniform3fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), GLint location; GLfloat v0; GLfloat v1; GLfloat v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_ASYNC(2335, glVertexStream3iATI, (GLenum stream, GLint x, GLint y, GLint z), (stream, x, y, z), GLenum stream; GLint x; GLint y; GLint z;, (call->stream, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2336, glDeformationMap3dSGIX, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points), GLenum target; GLdouble u1; GLdouble u2; GLint ustride; GLint uorder; GLdouble v1; GLdouble v2; GLint vstride; GLint vorder; GLdouble w1; GLdouble w2; GLint wstride; GLint worder; const GLdouble *points;, (call->target, call->u1, call->u2, call->ustride, call->uorder, call->v1, call->v2, call->vstride, call->vorder, call->w1, call->w2, call->wstride, call->worder, call->points))
+GL_PROC_ASYNC(2337, glBindTextureUnit, (GLuint unit, GLuint texture), (unit, texture), GLuint unit; GLuint texture;, (call->unit, call->texture))
+GL_PROC_SYNC_VOID(2338, glVertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2339, glUniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2340, glFramebufferTextureFaceARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face), GLenum target; GLenum attachment; GLuint texture; GLint level; GLenum face;, (call->target, call->attachment, call->texture, call->level, call->face))
+GL_PROC_ASYNC(2341, glAttachShader, (GLuint program, GLuint shader), (program, shader), GLuint program; GLuint shader;, (call->program, call->shader))
+GL_PROC_SYNC_VOID(2342, glDeleteBuffersARB, (GLsizei n, const GLuint *buffers), (n, buffers), GLsizei n; const GLuint *buffers;, (call->n, call->buffers))
+GL_PROC_SYNC_VOID(2343, glGetMapParameterfvNV, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2344, glTexCoord4xOES, (GLfixed s, GLfixed t, GLfixed r, GLfixed q), (s, t, r, q), GLfixed s; GLfixed t; GLfixed r; GLfixed q;, (call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(2345, glTexBufferARB, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), GLenum target; GLenum internalformat; GLuint buffer;, (call->target, call->internalformat, call->buffer))
+GL_PROC_ASYNC(2346, glVertex2hNV, (GLhalfNV x, GLhalfNV y), (x, y), GLhalfNV x; GLhalfNV y;, (call->x, call->y))
+GL_PROC_ASYNC(2347, glProgramParameter4fNV, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w), GLenum target; GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2348, glUniform4ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2349, glDisable, (GLenum cap), (cap), GLenum cap;, (call->cap))
+GL_PROC_ASYNC(2350, glFrameTerminatorGREMEDY, (void), (), , ())
+GL_PROC_SYNC_VOID(2351, glMatrixLoaddEXT, (GLenum mode, const GLdouble *m), (mode, m), GLenum mode; const GLdouble *m;, (call->mode, call->m))
+GL_PROC_SYNC_VOID(2352, glUniform2fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2353, glVertexAttribL1i64vNV, (GLuint index, const GLint64EXT *v), (index, v), GLuint index; const GLint64EXT *v;, (call->index, call->v))
+GL_PROC_ASYNC(2354, glWindowPos3fARB, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLfloat x; GLfloat y; GLfloat z;, (call->x, call->y, call->z))
+GL_PROC_SYNC(2355, GLboolean, glIsPointInFillPathNV, (GLuint path, GLuint mask, GLfloat x, GLfloat y), (path, mask, x, y), GLuint path; GLuint mask; GLfloat x; GLfloat y;, (call->path, call->mask, call->x, call->y))
+GL_PROC_ASYNC(2356, glBindProgramNV, (GLenum target, GLuint id), (target, id), GLenum target; GLuint id;, (call->target, call->id))
+GL_PROC_ASYNC(2357, glCullFace, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(2358, glColor3s, (GLshort red, GLshort green, GLshort blue), (red, green, blue), GLshort red; GLshort green; GLshort blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(2359, glGetTextureParameterIiv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), GLuint texture; GLenum pname; GLint *params;, (call->texture, call->pname, call->params))
+GL_PROC_ASYNC(2360, glEnableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index), GLuint vaobj; GLuint index;, (call->vaobj, call->index))
+GL_PROC_ASYNC(2361, glApplyFramebufferAttachmentCMAAINTEL, (void), (), , ())
+GL_PROC_SYNC_VOID(2362, glGetTexGeniv, (GLenum coord, GLenum pname, GLint *params), (coord, pname, params), GLenum coord; GLenum pname; GLint *params;, (call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(2363, glProgramUniformMatrix3x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2364, glLoadMatrixf, (const GLfloat *m), (m), const GLfloat *m;, (call->m))
+GL_PROC_SYNC_VOID(2365, glTexFilterFuncSGIS, (GLenum target, GLenum filter, GLsizei n, const GLfloat *weights), (target, filter, n, weights), GLenum target; GLenum filter; GLsizei n; const GLfloat *weights;, (call->target, call->filter, call->n, call->weights))
+GL_PROC_SYNC_VOID(2366, glVertexAttribI3iv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2367, glVertexWeightfvEXT, (const GLfloat *weight), (weight), const GLfloat *weight;, (call->weight))
+GL_PROC_ASYNC(2368, glProgramUniform1uiEXT, (GLuint program, GLint location, GLuint v0), (program, location, v0), GLuint program; GLint location; GLuint v0;, (call->program, call->location, call->v0))
+GL_PROC_SYNC_VOID(2369, glProgramPathFragmentInputGenNV, (GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs), (program, location, genMode, components, coeffs), GLuint program; GLint location; GLenum genMode; GLint components; const GLfloat *coeffs;, (call->program, call->location, call->genMode, call->components, call->coeffs))
+GL_PROC_ASYNC(2370, glVertexAttribI4iEXT, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), GLuint index; GLint x; GLint y; GLint z; GLint w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2371, glEnableClientStateiEXT, (GLenum array, GLuint index), (array, index), GLenum array; GLuint index;, (call->array, call->index))
+GL_PROC_ASYNC(2372, glProgramUniform4i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), GLuint program; GLint location; GLint v0; GLint v1; GLint v2; GLint v3;, (call->program, call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_ASYNC(2373, glClearColorIuiEXT, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha), GLuint red; GLuint green; GLuint blue; GLuint alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(2374, glProgramUniformMatrix4x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2375, glConvolutionParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params), GLenum target; GLenum pname; const GLfixed *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2376, glProgramBufferParametersIivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint *params), (target, bindingIndex, wordIndex, count, params), GLenum target; GLuint bindingIndex; GLuint wordIndex; GLsizei count; const GLint *params;, (call->target, call->bindingIndex, call->wordIndex, call->count, call->params))
+GL_PROC_SYNC(2377, GLintptr, glGetUniformOffsetEXT, (GLuint program, GLint location), (program, location), GLuint program; GLint location;, (call->program, call->location))
+GL_PROC_ASYNC(2378, glTextureBufferEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer), (texture, target, internalformat, buffer), GLuint texture; GLenum target; GLenum internalformat; GLuint buffer;, (call->texture, call->target, call->internalformat, call->buffer))
+GL_PROC_ASYNC(2379, glBeginTransformFeedbackNV, (GLenum primitiveMode), (primitiveMode), GLenum primitiveMode;, (call->primitiveMode))
+GL_PROC_ASYNC(2380, glNamedFramebufferTextureLayerEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer), GLuint framebuffer; GLenum attachment; GLuint texture; GLint level; GLint layer;, (call->framebuffer, call->attachment, call->texture, call->level, call->layer))
+GL_PROC_SYNC_CLIENT_ARRAY(2381, glSecondaryColorPointer, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->size, call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(2382, glCopyColorSubTable, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width), GLenum target; GLsizei start; GLint x; GLint y; GLsizei width;, (call->target, call->start, call->x, call->y, call->width))
+GL_PROC_ASYNC(2383, glCopyTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(2384, glTextureParameterfEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat param), (texture, target, pname, param), GLuint texture; GLenum target; GLenum pname; GLfloat param;, (call->texture, call->target, call->pname, call->param))
+GL_PROC_ASYNC(2385, glFragmentMaterialiSGIX, (GLenum face, GLenum pname, GLint param), (face, pname, param), GLenum face; GLenum pname; GLint param;, (call->face, call->pname, call->param))
+GL_PROC_SYNC(2386, GLuint, glGenVertexShadersEXT, (GLuint range), (range), GLuint range;, (call->range))
+GL_PROC_ASYNC(2387, glBeginQuery, (GLenum target, GLuint id), (target, id), GLenum target; GLuint id;, (call->target, call->id))
+GL_PROC_SYNC_VOID(2388, glMultiTexCoord3sv, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_ASYNC(2389, glScalexOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z), GLfixed x; GLfixed y; GLfixed z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2390, glTangent3ivEXT, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2391, glValidateProgramPipeline, (GLuint pipeline), (pipeline), GLuint pipeline;, (call->pipeline))
+GL_PROC_ASYNC(2392, glLightModelxOES, (GLenum pname, GLfixed param), (pname, param), GLenum pname; GLfixed param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2393, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam), GLDEBUGPROC callback; const void *userParam;, (call->callback, call->userParam))
+GL_PROC_SYNC_VOID(2394, glFragmentLightfvSGIX, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params), GLenum light; GLenum pname; const GLfloat *params;, (call->light, call->pname, call->params))
+GL_PROC_ASYNC(2395, glLightModeli, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2396, glIglooInterfaceSGIX, (GLenum pname, const void *params), (pname, params), GLenum pname; const void *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2397, glSecondaryColor3dvEXT, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(2398, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex), GLenum mode; const GLsizei *count; GLenum type; const void *const*indices; GLsizei drawcount; const GLint *basevertex;, (call->mode, call->count, call->type, call->indices, call->drawcount, call->basevertex))
+GL_PROC_ASYNC(2399, glTexCoord2d, (GLdouble s, GLdouble t), (s, t), GLdouble s; GLdouble t;, (call->s, call->t))
+GL_PROC_ASYNC(2400, glPrimitiveBoundingBoxARB, (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW), (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW), GLfloat minX; GLfloat minY; GLfloat minZ; GLfloat minW; GLfloat maxX; GLfloat maxY; GLfloat maxZ; GLfloat maxW;, (call->minX, call->minY, call->minZ, call->minW, call->maxX, call->maxY, call->maxZ, call->maxW))
+GL_PROC_SYNC_VOID(2401, glMatrixLoadfEXT, (GLenum mode, const GLfloat *m), (mode, m), GLenum mode; const GLfloat *m;, (call->mode, call->m))
+GL_PROC_SYNC_VOID(2402, glSpriteParameterfvSGIX, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2403, glIndexsv, (const GLshort *c), (c), const GLshort *c;, (call->c))
+GL_PROC_ASYNC(2404, glVertexP4ui, (GLenum type, GLuint value), (type, value), GLenum type; GLuint value;, (call->type, call->value))
+GL_PROC_SYNC_VOID(2405, glProgramUniform1ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2406, glGetDoublei_vEXT, (GLenum pname, GLuint index, GLdouble *params), (pname, index, params), GLenum pname; GLuint index; GLdouble *params;, (call->pname, call->index, call->params))
+GL_PROC_SYNC_VOID(2407, glCoverStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLenum coverMode; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->coverMode, call->transformType, call->transformValues))
+GL_PROC_SYNC_VOID(2408, glColor4ubVertex3fvSUN, (const GLubyte *c, const GLfloat *v), (c, v), const GLubyte *c; const GLfloat *v;, (call->c, call->v))
+GL_PROC_SYNC_VOID(2409, glDrawCommandsStatesAddressNV, (const GLuint64 *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (indirects, sizes, states, fbos, count), const GLuint64 *indirects; const GLsizei *sizes; const GLuint *states; const GLuint *fbos; GLuint count;, (call->indirects, call->sizes, call->states, call->fbos, call->count))
+GL_PROC_ASYNC(2410, glDispatchComputeGroupSizeARB, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z), (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z), GLuint num_groups_x; GLuint num_groups_y; GLuint num_groups_z; GLuint group_size_x; GLuint group_size_y; GLuint group_size_z;, (call->num_groups_x, call->num_groups_y, call->num_groups_z, call->group_size_x, call->group_size_y, call->group_size_z))
+GL_PROC_SYNC_VOID(2411, glPixelTransformParameterivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2412, glBufferStorageExternalEXT, (GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (target, offset, size, clientBuffer, flags), GLenum target; GLintptr offset; GLsizeiptr size; GLeglClientBufferEXT clientBuffer; GLbitfield flags;, (call->target, call->offset, call->size, call->clientBuffer, call->flags))
+GL_PROC_SYNC_VOID(2413, glVertexAttribL3i64vNV, (GLuint index, const GLint64EXT *v), (index, v), GLuint index; const GLint64EXT *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2414, glProgramUniform3i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64 *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2415, glGenNamesAMD, (GLenum identifier, GLuint num, GLuint *names), (identifier, num, names), GLenum identifier; GLuint num; GLuint *names;, (call->identifier, call->num, call->names))
+GL_PROC_SYNC_VOID(2416, glGetNamedFramebufferParameteriv, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param), GLuint framebuffer; GLenum pname; GLint *param;, (call->framebuffer, call->pname, call->param))
+GL_PROC_SYNC_VOID(2417, glProgramUniform2ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2418, glGetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data), GLenum target; GLuint index; GLint64 *data;, (call->target, call->index, call->data))
+GL_PROC_ASYNC(2419, glVertexArrayVertexAttribOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, normalized, stride, offset), GLuint vaobj; GLuint buffer; GLuint index; GLint size; GLenum type; GLboolean normalized; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->index, call->size, call->type, call->normalized, call->stride, call->offset))
+GL_PROC_ASYNC(2420, glBlendParameteriNV, (GLenum pname, GLint value), (pname, value), GLenum pname; GLint value;, (call->pname, call->value))
+GL_PROC_SYNC(2421, GLboolean, glIsTextureEXT, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_SYNC_VOID(2422, glNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data), GLuint buffer; GLintptr offset; GLsizeiptr size; const void *data;, (call->buffer, call->offset, call->size, call->data))
+GL_PROC_ASYNC(2423, glTexGend, (GLenum coord, GLenum pname, GLdouble param), (coord, pname, param), GLenum coord; GLenum pname; GLdouble param;, (call->coord, call->pname, call->param))
+GL_PROC_SYNC_VOID(2424, glGetnCompressedTexImageARB, (GLenum target, GLint lod, GLsizei bufSize, void *img), (target, lod, bufSize, img), GLenum target; GLint lod; GLsizei bufSize; void *img;, (call->target, call->lod, call->bufSize, call->img))
+GL_PROC_SYNC_VOID(2425, glGetProgramEnvParameterfvARB, (GLenum target, GLuint index, GLfloat *params), (target, index, params), GLenum target; GLuint index; GLfloat *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(2426, glVariantsvEXT, (GLuint id, const GLshort *addr), (id, addr), GLuint id; const GLshort *addr;, (call->id, call->addr))
+GL_PROC_ASYNC(2427, glDrawMeshTasksIndirectNV, (GLintptr indirect), (indirect), GLintptr indirect;, (call->indirect))
+GL_PROC_SYNC_VOID(2428, glReplacementCodeuiColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, c, n, v), const GLuint *rc; const GLfloat *c; const GLfloat *n; const GLfloat *v;, (call->rc, call->c, call->n, call->v))
+GL_PROC_ASYNC(2429, glNormal3b, (GLbyte nx, GLbyte ny, GLbyte nz), (nx, ny, nz), GLbyte nx; GLbyte ny; GLbyte nz;, (call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(2430, glMaterialiv, (GLenum face, GLenum pname, const GLint *params), (face, pname, params), GLenum face; GLenum pname; const GLint *params;, (call->face, call->pname, call->params))
+GL_PROC_ASYNC(2431, glPixelTransferxOES, (GLenum pname, GLfixed param), (pname, param), GLenum pname; GLfixed param;, (call->pname, call->param))
+GL_PROC_ASYNC(2432, glColor3ui, (GLuint red, GLuint green, GLuint blue), (red, green, blue), GLuint red; GLuint green; GLuint blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2433, glMultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLenum texture; GLenum type; GLuint coords;, (call->texture, call->type, call->coords))
+GL_PROC_SYNC_VOID(2434, glColor4bv, (const GLbyte *v), (v), const GLbyte *v;, (call->v))
+GL_PROC_SYNC_VOID(2435, glClearTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const void *data;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->data))
+GL_PROC_SYNC(2436, GLboolean, glTestFenceAPPLE, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(2437, glBufferDataARB, (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage), (target, size, data, usage), GLenum target; GLsizeiptrARB size; const void *data; GLenum usage;, (call->target, call->size, call->data, call->usage))
+GL_PROC_ASYNC(2438, glLoadIdentityDeformationMapSGIX, (GLbitfield mask), (mask), GLbitfield mask;, (call->mask))
+GL_PROC_ASYNC(2439, glMemoryBarrierEXT, (GLbitfield barriers), (barriers), GLbitfield barriers;, (call->barriers))
+GL_PROC_ASYNC(2440, glVertexArrayVertexAttribIFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->relativeoffset))
+GL_PROC_ASYNC(2441, glCopyTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint x; GLint y; GLsizei width; GLsizei height;, (call->texture, call->level, call->xoffset, call->yoffset, call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(2442, glUniform1ui64NV, (GLint location, GLuint64EXT x), (location, x), GLint location; GLuint64EXT x;, (call->location, call->x))
+GL_PROC_SYNC_VOID(2443, glVertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2444, glWindowPos4dvMESA, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(2445, glGetMemoryObjectDetachedResourcesuivNV, (GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params), (memory, pname, first, count, params), GLuint memory; GLenum pname; GLint first; GLsizei count; GLuint *params;, (call->memory, call->pname, call->first, call->count, call->params))
+GL_PROC_SYNC_VOID(2446, glGetObjectBufferfvATI, (GLuint buffer, GLenum pname, GLfloat *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLfloat *params;, (call->buffer, call->pname, call->params))
+GL_PROC_SYNC_VOID(2447, glMultiTexCoord3bvOES, (GLenum texture, const GLbyte *coords), (texture, coords), GLenum texture; const GLbyte *coords;, (call->texture, call->coords))
+GL_PROC_ASYNC(2448, glMultiTexGenfEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat param), (texunit, coord, pname, param), GLenum texunit; GLenum coord; GLenum pname; GLfloat param;, (call->texunit, call->coord, call->pname, call->param))
+GL_PROC_ASYNC(2449, glWindowPos3dMESA, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLdouble x; GLdouble y; GLdouble z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(2450, glMultiTexCoord1xOES, (GLenum texture, GLfixed s), (texture, s), GLenum texture; GLfixed s;, (call->texture, call->s))
+GL_PROC_ASYNC(2451, glNamedFramebufferRenderbufferEXT, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer), GLuint framebuffer; GLenum attachment; GLenum renderbuffertarget; GLuint renderbuffer;, (call->framebuffer, call->attachment, call->renderbuffertarget, call->renderbuffer))
+GL_PROC_SYNC_VOID(2452, glWeightbvARB, (GLint size, const GLbyte *weights), (size, weights), GLint size; const GLbyte *weights;, (call->size, call->weights))
+GL_PROC_ASYNC(2453, glPrimitiveRestartIndexNV, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_ASYNC(2454, glClearAccum, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLfloat red; GLfloat green; GLfloat blue; GLfloat alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(2455, glFramebufferTexture3DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level; GLint zoffset;, (call->target, call->attachment, call->textarget, call->texture, call->level, call->zoffset))
+GL_PROC_ASYNC(2456, glNormal3xOES, (GLfixed nx, GLfixed ny, GLfixed nz), (nx, ny, nz), GLfixed nx; GLfixed ny; GLfixed nz;, (call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(2457, glUniform1uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLint location; GLsizei count; const GLuint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2458, glGetnMapdv, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v), GLenum target; GLenum query; GLsizei bufSize; GLdouble *v;, (call->target, call->query, call->bufSize, call->v))
+GL_PROC_ASYNC(2459, glRasterSamplesEXT, (GLuint samples, GLboolean fixedsamplelocations), (samples, fixedsamplelocations), GLuint samples; GLboolean fixedsamplelocations;, (call->samples, call->fixedsamplelocations))
+GL_PROC_ASYNC(2460, glPixelTransformParameteriEXT, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(2461, glProgramUniformMatrix2x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2462, glRasterPos2iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2463, glNamedFramebufferTexture, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level), GLuint framebuffer; GLenum attachment; GLuint texture; GLint level;, (call->framebuffer, call->attachment, call->texture, call->level))
+GL_PROC_ASYNC(2464, glTextureStorageMem3DMultisampleEXT, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset), GLuint texture; GLsizei samples; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedSampleLocations; GLuint memory; GLuint64 offset;, (call->texture, call->samples, call->internalFormat, call->width, call->height, call->depth, call->fixedSampleLocations, call->memory, call->offset))
+GL_PROC_ASYNC(2465, glRasterPos4d, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w), GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2466, glBlendEquationiARB, (GLuint buf, GLenum mode), (buf, mode), GLuint buf; GLenum mode;, (call->buf, call->mode))
+GL_PROC_ASYNC(2467, glUniform1d, (GLint location, GLdouble x), (location, x), GLint location; GLdouble x;, (call->location, call->x))
+GL_PROC_ASYNC(2468, glMatrixRotatedEXT, (GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (mode, angle, x, y, z), GLenum mode; GLdouble angle; GLdouble x; GLdouble y; GLdouble z;, (call->mode, call->angle, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2469, glLightiv, (GLenum light, GLenum pname, const GLint *params), (light, pname, params), GLenum light; GLenum pname; const GLint *params;, (call->light, call->pname, call->params))
+GL_PROC_ASYNC(2470, glEnableVertexAttribArray, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_ASYNC(2471, glUniform4iARB, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), GLint location; GLint v0; GLint v1; GLint v2; GLint v3;, (call->location, call->v0, call->v1, call->v2, call->v3))
+GL_PROC_SYNC_VOID(2472, glFramebufferSamplePositionsfvAMD, (GLenum target, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (target, numsamples, pixelindex, values), GLenum target; GLuint numsamples; GLuint pixelindex; const GLfloat *values;, (call->target, call->numsamples, call->pixelindex, call->values))
+GL_PROC_ASYNC(2473, glDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count), (mode, start, end, first, count), GLenum mode; GLuint start; GLuint end; GLint first; GLsizei count;, (call->mode, call->start, call->end, call->first, call->count))
+GL_PROC_SYNC_VOID(2474, glGetSeparableFilterEXT, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span), (target, format, type, row, column, span), GLenum target; GLenum format; GLenum type; void *row; void *column; void *span;, (call->target, call->format, call->type, call->row, call->column, call->span))
+GL_PROC_SYNC_VOID(2475, glTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params), GLuint texture; GLenum target; GLenum pname; const GLint *params;, (call->texture, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2476, glInsertEventMarkerEXT, (GLsizei length, const GLchar *marker), (length, marker), GLsizei length; const GLchar *marker;, (call->length, call->marker))
+GL_PROC_SYNC_VOID(2477, glGetnConvolutionFilter, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image), GLenum target; GLenum format; GLenum type; GLsizei bufSize; void *image;, (call->target, call->format, call->type, call->bufSize, call->image))
+GL_PROC_SYNC_VOID(2478, glGetLocalConstantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data), GLuint id; GLenum value; GLfloat *data;, (call->id, call->value, call->data))
+GL_PROC_ASYNC(2479, glVertexAttribI1iEXT, (GLuint index, GLint x), (index, x), GLuint index; GLint x;, (call->index, call->x))
+GL_PROC_SYNC_VOID(2480, glNormal3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC(2481, GLboolean, glTestObjectAPPLE, (GLenum object, GLuint name), (object, name), GLenum object; GLuint name;, (call->object, call->name))
+GL_PROC_SYNC_VOID(2482, glGetTextureLevelParameterfvEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params), (texture, target, level, pname, params), GLuint texture; GLenum target; GLint level; GLenum pname; GLfloat *params;, (call->texture, call->target, call->level, call->pname, call->params))
+GL_PROC_ASYNC(2483, glVertexAttrib1sNV, (GLuint index, GLshort x), (index, x), GLuint index; GLshort x;, (call->index, call->x))
+GL_PROC_ASYNC(2484, glFogf, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2485, glMulticastFramebufferSampleLocationsfvNV, (GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (gpu, framebuffer, start, count, v), GLuint gpu; GLuint framebuffer; GLuint start; GLsizei count; const GLfloat *v;, (call->gpu, call->framebuffer, call->start, call->count, call->v))
+GL_PROC_ASYNC(2486, glVertexStream4dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (stream, x, y, z, w), GLenum stream; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->stream, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2487, glVideoCaptureStreamParameterdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; const GLdouble *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_ASYNC(2488, glVertex3hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z), (x, y, z), GLhalfNV x; GLhalfNV y; GLhalfNV z;, (call->x, call->y, call->z))
+GL_PROC_ASYNC(2489, glColor4i, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha), GLint red; GLint green; GLint blue; GLint alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(2490, glShaderSourceARB, (GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length), (shaderObj, count, string, length), GLhandleARB shaderObj; GLsizei count; const GLcharARB **string; const GLint *length;, (call->shaderObj, call->count, call->string, call->length))
+GL_PROC_SYNC_VOID(2491, glProgramUniformMatrix3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2492, glUniform2dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLint location; GLsizei count; const GLdouble *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(2493, GLuint, glGenLists, (GLsizei range), (range), GLsizei range;, (call->range))
+GL_PROC_SYNC_VOID(2494, glVertexAttrib4svNV, (GLuint index, const GLshort *v), (index, v), GLuint index; const GLshort *v;, (call->index, call->v))
+GL_PROC_ASYNC(2495, glVDPAUFiniNV, (void), (), , ())
+GL_PROC_SYNC_VOID(2496, glPointParameterivNV, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2497, glGenTextures, (GLsizei n, GLuint *textures), (n, textures), GLsizei n; GLuint *textures;, (call->n, call->textures))
+GL_PROC_SYNC_VOID(2498, glGetNamedBufferPointervEXT, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params), GLuint buffer; GLenum pname; void **params;, (call->buffer, call->pname, call->params))
+GL_PROC_ASYNC(2499, glClientActiveVertexStreamATI, (GLenum stream), (stream), GLenum stream;, (call->stream))
+GL_PROC_SYNC_VOID(2500, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params), GLuint sampler; GLenum pname; GLfloat *params;, (call->sampler, call->pname, call->params))
+GL_PROC_SYNC_VOID(2501, glWindowPos3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(2502, glProgramNamedParameter4fvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v), (id, len, name, v), GLuint id; GLsizei len; const GLubyte *name; const GLfloat *v;, (call->id, call->len, call->name, call->v))
+GL_PROC_SYNC_VOID(2503, glRectfv, (const GLfloat *v1, const GLfloat *v2), (v1, v2), const GLfloat *v1; const GLfloat *v2;, (call->v1, call->v2))
+GL_PROC_SYNC_VOID(2504, glFragmentMaterialivSGIX, (GLenum face, GLenum pname, const GLint *params), (face, pname, params), GLenum face; GLenum pname; const GLint *params;, (call->face, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(2505, glColorPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer), GLint size; GLenum type; const void **pointer;, (call->size, call->type, call->pointer))
+GL_PROC_ASYNC(2506, glBeginTransformFeedback, (GLenum primitiveMode), (primitiveMode), GLenum primitiveMode;, (call->primitiveMode))
+GL_PROC_SYNC_VOID(2507, glVertexAttribs3fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v), GLuint index; GLsizei count; const GLfloat *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(2508, glFogCoordf, (GLfloat coord), (coord), GLfloat coord;, (call->coord))
+GL_PROC_ASYNC(2509, glEnableVariantClientStateEXT, (GLuint id), (id), GLuint id;, (call->id))
+GL_PROC_SYNC_VOID(2510, glSignalSemaphoreui64NVX, (GLuint signalGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (signalGpu, fenceObjectCount, semaphoreArray, fenceValueArray), GLuint signalGpu; GLsizei fenceObjectCount; const GLuint *semaphoreArray; const GLuint64 *fenceValueArray;, (call->signalGpu, call->fenceObjectCount, call->semaphoreArray, call->fenceValueArray))
+GL_PROC_SYNC_VOID(2511, glBindBuffersRange, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes), GLenum target; GLuint first; GLsizei count; const GLuint *buffers; const GLintptr *offsets; const GLsizeiptr *sizes;, (call->target, call->first, call->count, call->buffers, call->offsets, call->sizes))
+GL_PROC_SYNC_VOID(2512, glLightModeliv, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2513, glVertex4dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(2514, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2515, glUniform2ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value), GLint location; GLsizei count; const GLuint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2516, glMatrixFrustumEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar), GLenum mode; GLdouble left; GLdouble right; GLdouble bottom; GLdouble top; GLdouble zNear; GLdouble zFar;, (call->mode, call->left, call->right, call->bottom, call->top, call->zNear, call->zFar))
+GL_PROC_ASYNC(2517, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), GLenum target; GLintptr offset; GLsizeiptr length;, (call->target, call->offset, call->length))
+GL_PROC_SYNC_VOID(2518, glProgramUniformMatrix2x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2519, glCallList, (GLuint list), (list), GLuint list;, (call->list))
+GL_PROC_SYNC_VOID(2520, glTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLenum type; const void *pixels;, (call->texture, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2521, glProgramLocalParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params), GLenum target; GLuint index; GLsizei count; const GLfloat *params;, (call->target, call->index, call->count, call->params))
+GL_PROC_SYNC_VOID(2522, glInvalidateNamedFramebufferSubData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height), GLuint framebuffer; GLsizei numAttachments; const GLenum *attachments; GLint x; GLint y; GLsizei width; GLsizei height;, (call->framebuffer, call->numAttachments, call->attachments, call->x, call->y, call->width, call->height))
+GL_PROC_SYNC_VOID(2523, glProgramUniform3uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2524, glRasterPos3xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(2525, glUniform1i64NV, (GLint location, GLint64EXT x), (location, x), GLint location; GLint64EXT x;, (call->location, call->x))
+GL_PROC_SYNC_VOID(2526, glRasterPos2fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(2527, glCompressedMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, border, imageSize, bits), GLenum texunit; GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLint border; GLsizei imageSize; const void *bits;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->height, call->border, call->imageSize, call->bits))
+GL_PROC_ASYNC(2528, glMulticastViewportPositionWScaleNVX, (GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff), (gpu, index, xcoeff, ycoeff), GLuint gpu; GLuint index; GLfloat xcoeff; GLfloat ycoeff;, (call->gpu, call->index, call->xcoeff, call->ycoeff))
+GL_PROC_SYNC_VOID(2529, glNamedProgramLocalParameterI4uivEXT, (GLuint program, GLenum target, GLuint index, const GLuint *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; const GLuint *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_ASYNC(2530, glFragmentCoverageColorNV, (GLuint color), (color), GLuint color;, (call->color))
+GL_PROC_SYNC_VOID(2531, glGetNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data), GLuint buffer; GLintptr offset; GLsizeiptr size; void *data;, (call->buffer, call->offset, call->size, call->data))
+GL_PROC_SYNC_VOID(2532, glVertex2xvOES, (const GLfixed *coords), (coords), const GLfixed *coords;, (call->coords))
+GL_PROC_ASYNC(2533, glUniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1), GLint location; GLint v0; GLint v1;, (call->location, call->v0, call->v1))
+GL_PROC_ASYNC(2534, glBindShadingRateImageNV, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_ASYNC(2535, glNamedFramebufferRenderbuffer, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer), GLuint framebuffer; GLenum attachment; GLenum renderbuffertarget; GLuint renderbuffer;, (call->framebuffer, call->attachment, call->renderbuffertarget, call->renderbuffer))
+GL_PROC_SYNC(2536, GLuint, glCreateShaderProgramEXT, (GLenum type, const GLchar *string), (type, string), GLenum type; const GLchar *string;, (call->type, call->string))
+GL_PROC_ASYNC(2537, glPassTexCoordATI, (GLuint dst, GLuint coord, GLenum swizzle), (dst, coord, swizzle), GLuint dst; GLuint coord; GLenum swizzle;, (call->dst, call->coord, call->swizzle))
+GL_PROC_SYNC(2538, void *, glMapObjectBufferATI, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC_VOID(2539, glLoadMatrixxOES, (const GLfixed *m), (m), const GLfixed *m;, (call->m))
+GL_PROC_ASYNC(2540, glFrustumfOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f), GLfloat l; GLfloat r; GLfloat b; GLfloat t; GLfloat n; GLfloat f;, (call->l, call->r, call->b, call->t, call->n, call->f))
+GL_PROC_ASYNC(2541, glVDPAUUnregisterSurfaceNV, (GLvdpauSurfaceNV surface), (surface), GLvdpauSurfaceNV surface;, (call->surface))
+GL_PROC_SYNC(2542, GLuint, glGenSymbolsEXT, (GLenum datatype, GLenum storagetype, GLenum range, GLuint components), (datatype, storagetype, range, components), GLenum datatype; GLenum storagetype; GLenum range; GLuint components;, (call->datatype, call->storagetype, call->range, call->components))
+GL_PROC_ASYNC(2543, glMultiTexCoord3bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r), (texture, s, t, r), GLenum texture; GLbyte s; GLbyte t; GLbyte r;, (call->texture, call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(2544, glGetLocalConstantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data), GLuint id; GLenum value; GLint *data;, (call->id, call->value, call->data))
+GL_PROC_ASYNC(2545, glVertex4f, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w), GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2546, glRasterPos3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(2547, glVertexStream1dvATI, (GLenum stream, const GLdouble *coords), (stream, coords), GLenum stream; const GLdouble *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2548, glMultiDrawArraysIndirectBindlessCountNV, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, maxDrawCount, stride, vertexBufferCount), GLenum mode; const void *indirect; GLsizei drawCount; GLsizei maxDrawCount; GLsizei stride; GLint vertexBufferCount;, (call->mode, call->indirect, call->drawCount, call->maxDrawCount, call->stride, call->vertexBufferCount))
+GL_PROC_ASYNC(2549, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), GLenum sfactor; GLenum dfactor;, (call->sfactor, call->dfactor))
+GL_PROC_ASYNC(2550, glMemoryBarrierByRegion, (GLbitfield barriers), (barriers), GLbitfield barriers;, (call->barriers))
+GL_PROC_SYNC(2551, const GLubyte *, glGetStringi, (GLenum name, GLuint index), (name, index), GLenum name; GLuint index;, (call->name, call->index))
+GL_PROC_SYNC_VOID(2552, glGetPathColorGenfvNV, (GLenum color, GLenum pname, GLfloat *value), (color, pname, value), GLenum color; GLenum pname; GLfloat *value;, (call->color, call->pname, call->value))
+GL_PROC_ASYNC(2553, glSecondaryColor3uiEXT, (GLuint red, GLuint green, GLuint blue), (red, green, blue), GLuint red; GLuint green; GLuint blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(2554, glPathTexGenNV, (GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat *coeffs), (texCoordSet, genMode, components, coeffs), GLenum texCoordSet; GLenum genMode; GLint components; const GLfloat *coeffs;, (call->texCoordSet, call->genMode, call->components, call->coeffs))
+GL_PROC_SYNC_VOID(2555, glVideoCaptureStreamParameterfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat *params), (video_capture_slot, stream, pname, params), GLuint video_capture_slot; GLuint stream; GLenum pname; const GLfloat *params;, (call->video_capture_slot, call->stream, call->pname, call->params))
+GL_PROC_SYNC_VOID(2556, glProgramUniformMatrix2x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2557, glProgramUniform2d, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1), GLuint program; GLint location; GLdouble v0; GLdouble v1;, (call->program, call->location, call->v0, call->v1))
+GL_PROC_SYNC_VOID(2558, glProgramUniform2i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(2559, glCopyTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), GLenum target; GLint level; GLint xoffset; GLint x; GLint y; GLsizei width;, (call->target, call->level, call->xoffset, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(2560, glProgramUniformMatrix4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2561, glProgramUniform1dEXT, (GLuint program, GLint location, GLdouble x), (program, location, x), GLuint program; GLint location; GLdouble x;, (call->program, call->location, call->x))
+GL_PROC_ASYNC(2562, glMultiTexCoord4xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q), (texture, s, t, r, q), GLenum texture; GLfixed s; GLfixed t; GLfixed r; GLfixed q;, (call->texture, call->s, call->t, call->r, call->q))
+GL_PROC_ASYNC(2563, glVertex2s, (GLshort x, GLshort y), (x, y), GLshort x; GLshort y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(2564, glVertex4iv, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(2565, glObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label), const void *ptr; GLsizei length; const GLchar *label;, (call->ptr, call->length, call->label))
+GL_PROC_SYNC_VOID(2566, glVertex2bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_SYNC_VOID(2567, glMultiTexCoord4dv, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2568, glMaterialfv, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params), GLenum face; GLenum pname; const GLfloat *params;, (call->face, call->pname, call->params))
+GL_PROC_SYNC_VOID(2569, glVertexAttribs2svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v), GLuint index; GLsizei count; const GLshort *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(2570, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), GLenum source; GLenum type; GLenum severity; GLsizei count; const GLuint *ids; GLboolean enabled;, (call->source, call->type, call->severity, call->count, call->ids, call->enabled))
+GL_PROC_ASYNC(2571, glVertexArrayBindingDivisor, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor), GLuint vaobj; GLuint bindingindex; GLuint divisor;, (call->vaobj, call->bindingindex, call->divisor))
+GL_PROC_SYNC_VOID(2572, glVertexAttribs1svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v), GLuint index; GLsizei count; const GLshort *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(2573, glBeginVideoCaptureNV, (GLuint video_capture_slot), (video_capture_slot), GLuint video_capture_slot;, (call->video_capture_slot))
+GL_PROC_ASYNC(2574, glColorFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod), GLenum op; GLuint dst; GLuint dstMask; GLuint dstMod; GLuint arg1; GLuint arg1Rep; GLuint arg1Mod; GLuint arg2; GLuint arg2Rep; GLuint arg2Mod;, (call->op, call->dst, call->dstMask, call->dstMod, call->arg1, call->arg1Rep, call->arg1Mod, call->arg2, call->arg2Rep, call->arg2Mod))
+GL_PROC_ASYNC(2575, glTagSampleBufferSGIX, (void), (), , ())
+GL_PROC_ASYNC(2576, glVertex4hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (x, y, z, w), GLhalfNV x; GLhalfNV y; GLhalfNV z; GLhalfNV w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC(2577, GLint, glGetInstrumentsSGIX, (void), (), , ())
+GL_PROC_ASYNC(2578, glVertexAttrib2sARB, (GLuint index, GLshort x, GLshort y), (index, x, y), GLuint index; GLshort x; GLshort y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(2579, glGetPerfQueryIdByNameINTEL, (GLchar *queryName, GLuint *queryId), (queryName, queryId), GLchar *queryName; GLuint *queryId;, (call->queryName, call->queryId))
+GL_PROC_SYNC_VOID(2580, glGetNextPerfQueryIdINTEL, (GLuint queryId, GLuint *nextQueryId), (queryId, nextQueryId), GLuint queryId; GLuint *nextQueryId;, (call->queryId, call->nextQueryId))
+GL_PROC_SYNC_VOID(2581, glDrawElementsInstancedARB, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei primcount;, (call->mode, call->count, call->type, call->indices, call->primcount))
+GL_PROC_ASYNC(2582, glScissorIndexed, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height), GLuint index; GLint left; GLint bottom; GLsizei width; GLsizei height;, (call->index, call->left, call->bottom, call->width, call->height))
+GL_PROC_SYNC(2583, GLenum, glPathMemoryGlyphIndexArrayNV, (GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale), GLuint firstPathName; GLenum fontTarget; GLsizeiptr fontSize; const void *fontData; GLsizei faceIndex; GLuint firstGlyphIndex; GLsizei numGlyphs; GLuint pathParameterTemplate; GLfloat emScale;, (call->firstPathName, call->fontTarget, call->fontSize, call->fontData, call->faceIndex, call->firstGlyphIndex, call->numGlyphs, call->pathParameterTemplate, call->emScale))
+GL_PROC_ASYNC(2584, glStencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), GLenum func; GLint ref; GLuint mask;, (call->func, call->ref, call->mask))
+GL_PROC_SYNC_VOID(2585, glTexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords), GLenum type; const GLuint *coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(2586, glTexCoord2fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(2587, glMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; const GLdouble *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(2588, glImageTransformParameterfvHP, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC(2589, GLboolean, glReleaseKeyedMutexWin32EXT, (GLuint memory, GLuint64 key), (memory, key), GLuint memory; GLuint64 key;, (call->memory, call->key))
+GL_PROC_ASYNC(2590, glPointParameterfEXT, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_ASYNC(2591, glVertexArrayVertexAttribLOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset), GLuint vaobj; GLuint buffer; GLuint index; GLint size; GLenum type; GLsizei stride; GLintptr offset;, (call->vaobj, call->buffer, call->index, call->size, call->type, call->stride, call->offset))
+GL_PROC_SYNC(2592, GLuint, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), GLuint count; GLsizei bufSize; GLenum *sources; GLenum *types; GLuint *ids; GLenum *severities; GLsizei *lengths; GLchar *messageLog;, (call->count, call->bufSize, call->sources, call->types, call->ids, call->severities, call->lengths, call->messageLog))
+GL_PROC_SYNC_VOID(2593, glCompressedTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(2594, glRasterPos3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_VOID(2595, glUniform1i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), GLint location; GLsizei count; const GLint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2596, glTexCoord3f, (GLfloat s, GLfloat t, GLfloat r), (s, t, r), GLfloat s; GLfloat t; GLfloat r;, (call->s, call->t, call->r))
+GL_PROC_SYNC_VOID(2597, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLuint sampler; GLenum pname; const GLint *param;, (call->sampler, call->pname, call->param))
+GL_PROC_SYNC(2598, GLboolean, glIsNameAMD, (GLenum identifier, GLuint name), (identifier, name), GLenum identifier; GLuint name;, (call->identifier, call->name))
+GL_PROC_SYNC_VOID(2599, glInvalidateFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments), GLenum target; GLsizei numAttachments; const GLenum *attachments;, (call->target, call->numAttachments, call->attachments))
+GL_PROC_ASYNC(2600, glVertexAttribL4dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLuint index; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2601, glNamedFramebufferDrawBuffer, (GLuint framebuffer, GLenum buf), (framebuffer, buf), GLuint framebuffer; GLenum buf;, (call->framebuffer, call->buf))
+GL_PROC_SYNC_VOID(2602, glDrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei instancecount; GLuint baseinstance;, (call->mode, call->count, call->type, call->indices, call->instancecount, call->baseinstance))
+GL_PROC_SYNC_VOID(2603, glColor4uiv, (const GLuint *v), (v), const GLuint *v;, (call->v))
+GL_PROC_ASYNC(2604, glNamedProgramLocalParameterI4uiEXT, (GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (program, target, index, x, y, z, w), GLuint program; GLenum target; GLuint index; GLuint x; GLuint y; GLuint z; GLuint w;, (call->program, call->target, call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2605, glGenTexturesEXT, (GLsizei n, GLuint *textures), (n, textures), GLsizei n; GLuint *textures;, (call->n, call->textures))
+GL_PROC_ASYNC(2606, glUniform1ui, (GLint location, GLuint v0), (location, v0), GLint location; GLuint v0;, (call->location, call->v0))
+GL_PROC_ASYNC(2607, glPauseTransformFeedback, (void), (), , ())
+GL_PROC_SYNC_VOID(2608, glMultTransposeMatrixxOES, (const GLfixed *m), (m), const GLfixed *m;, (call->m))
+GL_PROC_SYNC_VOID(2609, glTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const void *pixels;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2610, glWindowPos2d, (GLdouble x, GLdouble y), (x, y), GLdouble x; GLdouble y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(2611, glBindFragDataLocationEXT, (GLuint program, GLuint color, const GLchar *name), (program, color, name), GLuint program; GLuint color; const GLchar *name;, (call->program, call->color, call->name))
+GL_PROC_SYNC_VOID(2612, glDebugMessageCallbackAMD, (GLDEBUGPROCAMD callback, void *userParam), (callback, userParam), GLDEBUGPROCAMD callback; void *userParam;, (call->callback, call->userParam))
+GL_PROC_SYNC_VOID(2613, glTexImage3DEXT, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLenum format; GLenum type; const void *pixels;, (call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2614, glGetArrayObjectivATI, (GLenum array, GLenum pname, GLint *params), (array, pname, params), GLenum array; GLenum pname; GLint *params;, (call->array, call->pname, call->params))
+GL_PROC_SYNC_VOID(2615, glGetVariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data), GLuint id; GLenum value; GLfloat *data;, (call->id, call->value, call->data))
+GL_PROC_SYNC_VOID(2616, glVertexAttribI4iv, (GLuint index, const GLint *v), (index, v), GLuint index; const GLint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2617, glDisableVertexAttribArray, (GLuint index), (index), GLuint index;, (call->index))
+GL_PROC_ASYNC(2618, glSetFenceAPPLE, (GLuint fence), (fence), GLuint fence;, (call->fence))
+GL_PROC_SYNC_VOID(2619, glGetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params), GLuint program; GLenum pname; GLint *params;, (call->program, call->pname, call->params))
+GL_PROC_SYNC_VOID(2620, glGetNamedBufferParameterui64vNV, (GLuint buffer, GLenum pname, GLuint64EXT *params), (buffer, pname, params), GLuint buffer; GLenum pname; GLuint64EXT *params;, (call->buffer, call->pname, call->params))
+GL_PROC_ASYNC(2621, glSecondaryColor3fEXT, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue), GLfloat red; GLfloat green; GLfloat blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2622, glSecondaryColor3b, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue), GLbyte red; GLbyte green; GLbyte blue;, (call->red, call->green, call->blue))
+GL_PROC_ASYNC(2623, glProgramUniform4dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, location, x, y, z, w), GLuint program; GLint location; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->program, call->location, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2624, glGetObjectParameterivARB, (GLhandleARB obj, GLenum pname, GLint *params), (obj, pname, params), GLhandleARB obj; GLenum pname; GLint *params;, (call->obj, call->pname, call->params))
+GL_PROC_ASYNC(2625, glReplacementCodeuiTexCoord2fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, x, y, z), GLuint rc; GLfloat s; GLfloat t; GLfloat x; GLfloat y; GLfloat z;, (call->rc, call->s, call->t, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2626, glVertexAttrib1fvARB, (GLuint index, const GLfloat *v), (index, v), GLuint index; const GLfloat *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2627, glProgramUniform3i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(2628, glTextureImage2DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, fixedSampleLocations), GLuint texture; GLenum target; GLsizei samples; GLint internalFormat; GLsizei width; GLsizei height; GLboolean fixedSampleLocations;, (call->texture, call->target, call->samples, call->internalFormat, call->width, call->height, call->fixedSampleLocations))
+GL_PROC_SYNC(2629, GLenum, glObjectUnpurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option), GLenum objectType; GLuint name; GLenum option;, (call->objectType, call->name, call->option))
+GL_PROC_ASYNC(2630, glRectd, (GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2), (x1, y1, x2, y2), GLdouble x1; GLdouble y1; GLdouble x2; GLdouble y2;, (call->x1, call->y1, call->x2, call->y2))
+GL_PROC_SYNC_VOID(2631, glGetTextureLevelParameteriv, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params), GLuint texture; GLint level; GLenum pname; GLint *params;, (call->texture, call->level, call->pname, call->params))
+GL_PROC_SYNC_VOID(2632, glGetFramebufferParameterfvAMD, (GLenum target, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (target, pname, numsamples, pixelindex, size, values), GLenum target; GLenum pname; GLuint numsamples; GLuint pixelindex; GLsizei size; GLfloat *values;, (call->target, call->pname, call->numsamples, call->pixelindex, call->size, call->values))
+GL_PROC_SYNC_VOID(2633, glWindowPos3ivMESA, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(2634, glSecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color), GLenum type; const GLuint *color;, (call->type, call->color))
+GL_PROC_SYNC_VOID(2635, glVertexAttrib4usv, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2636, glMultiTexCoord2hvNV, (GLenum target, const GLhalfNV *v), (target, v), GLenum target; const GLhalfNV *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2637, glTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, width, format, type, pixels), GLuint texture; GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLenum type; const void *pixels;, (call->texture, call->target, call->level, call->xoffset, call->width, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2638, glUniformui64NV, (GLint location, GLuint64EXT value), (location, value), GLint location; GLuint64EXT value;, (call->location, call->value))
+GL_PROC_ASYNC(2639, glRecti, (GLint x1, GLint y1, GLint x2, GLint y2), (x1, y1, x2, y2), GLint x1; GLint y1; GLint x2; GLint y2;, (call->x1, call->y1, call->x2, call->y2))
+GL_PROC_SYNC_VOID(2640, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const GLvoid *indices), (mode, count, type, indices), GLenum mode; GLsizei count; GLenum type; const GLvoid *indices;, (call->mode, call->count, call->type, call->indices))
+GL_PROC_SYNC_VOID(2641, glProgramUniform4dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2642, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, height, border, imageSize, data), GLenum target; GLint level; GLenum internalformat; GLsizei width; GLsizei height; GLint border; GLsizei imageSize; const GLvoid *data;, (call->target, call->level, call->internalformat, call->width, call->height, call->border, call->imageSize, call->data))
+GL_PROC_ASYNC(2643, glMultiTexEnviEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param), GLenum texunit; GLenum target; GLenum pname; GLint param;, (call->texunit, call->target, call->pname, call->param))
+GL_PROC_ASYNC(2644, glMulticastBlitFramebufferNV, (GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLuint srcGpu; GLuint dstGpu; GLint srcX0; GLint srcY0; GLint srcX1; GLint srcY1; GLint dstX0; GLint dstY0; GLint dstX1; GLint dstY1; GLbitfield mask; GLenum filter;, (call->srcGpu, call->dstGpu, call->srcX0, call->srcY0, call->srcX1, call->srcY1, call->dstX0, call->dstY0, call->dstX1, call->dstY1, call->mask, call->filter))
+GL_PROC_ASYNC(2645, glTextureParameteri, (GLuint texture, GLenum pname, GLint param), (texture, pname, param), GLuint texture; GLenum pname; GLint param;, (call->texture, call->pname, call->param))
+GL_PROC_SYNC_VOID(2646, glStencilThenCoverFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues), GLsizei numPaths; GLenum pathNameType; const void *paths; GLuint pathBase; GLenum fillMode; GLuint mask; GLenum coverMode; GLenum transformType; const GLfloat *transformValues;, (call->numPaths, call->pathNameType, call->paths, call->pathBase, call->fillMode, call->mask, call->coverMode, call->transformType, call->transformValues))
+GL_PROC_SYNC_VOID(2647, glUniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLint location; GLsizei count; const GLfloat *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2648, glPathCoordsNV, (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCoords, coordType, coords), GLuint path; GLsizei numCoords; GLenum coordType; const void *coords;, (call->path, call->numCoords, call->coordType, call->coords))
+GL_PROC_ASYNC(2649, glTextureParameterf, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param), GLuint texture; GLenum pname; GLfloat param;, (call->texture, call->pname, call->param))
+GL_PROC_ASYNC(2650, glPolygonOffsetClampEXT, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp), GLfloat factor; GLfloat units; GLfloat clamp;, (call->factor, call->units, call->clamp))
+GL_PROC_SYNC_VOID(2651, glMultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount), GLenum mode; const GLint *first; const GLsizei *count; GLsizei drawcount;, (call->mode, call->first, call->count, call->drawcount))
+GL_PROC_SYNC(2652, GLboolean, glIsTexture, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_SYNC_VOID(2653, glVertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_ASYNC(2654, glProgramUniform1ui, (GLuint program, GLint location, GLuint v0), (program, location, v0), GLuint program; GLint location; GLuint v0;, (call->program, call->location, call->v0))
+GL_PROC_SYNC_VOID(2655, glVertexAttribs1dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v), GLuint index; GLsizei count; const GLdouble *v;, (call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(2656, glVertexAttribI4usv, (GLuint index, const GLushort *v), (index, v), GLuint index; const GLushort *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2657, glGetVertexAttribArrayObjectfvATI, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLuint index; GLenum pname; GLfloat *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(2658, glProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2659, glGetMaterialfv, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params), GLenum face; GLenum pname; GLfloat *params;, (call->face, call->pname, call->params))
+GL_PROC_ASYNC(2660, glUnmapTexture2DINTEL, (GLuint texture, GLint level), (texture, level), GLuint texture; GLint level;, (call->texture, call->level))
+GL_PROC_SYNC_VOID(2661, glMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, width, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint xoffset; GLsizei width; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->xoffset, call->width, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2662, glOrthofOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f), GLfloat l; GLfloat r; GLfloat b; GLfloat t; GLfloat n; GLfloat f;, (call->l, call->r, call->b, call->t, call->n, call->f))
+GL_PROC_SYNC_VOID(2663, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2664, glMultiDrawArraysIndirectCountARB, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride), GLenum mode; const void *indirect; GLintptr drawcount; GLsizei maxdrawcount; GLsizei stride;, (call->mode, call->indirect, call->drawcount, call->maxdrawcount, call->stride))
+GL_PROC_SYNC_VOID(2665, glQueryResourceTagNV, (GLint tagId, const GLchar *tagString), (tagId, tagString), GLint tagId; const GLchar *tagString;, (call->tagId, call->tagString))
+GL_PROC_SYNC_VOID(2666, glCompressedTexSubImage2DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLsizei width; GLsizei height; GLenum format; GLsizei imageSize; const void *data;, (call->target, call->level, call->xoffset, call->yoffset, call->width, call->height, call->format, call->imageSize, call->data))
+GL_PROC_SYNC_VOID(2667, glGenQueries, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_ASYNC(2668, glMulticastWaitSyncNV, (GLuint signalGpu, GLbitfield waitGpuMask), (signalGpu, waitGpuMask), GLuint signalGpu; GLbitfield waitGpuMask;, (call->signalGpu, call->waitGpuMask))
+GL_PROC_SYNC_VOID(2669, glWindowPos3svARB, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(2670, glVertexAttribs2fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v), GLuint index; GLsizei count; const GLfloat *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(2671, glColor4us, (GLushort red, GLushort green, GLushort blue, GLushort alpha), (red, green, blue, alpha), GLushort red; GLushort green; GLushort blue; GLushort alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(2672, glBeginPerfQueryINTEL, (GLuint queryHandle), (queryHandle), GLuint queryHandle;, (call->queryHandle))
+GL_PROC_SYNC_VOID(2673, glWeightusvARB, (GLint size, const GLushort *weights), (size, weights), GLint size; const GLushort *weights;, (call->size, call->weights))
+GL_PROC_SYNC_VOID(2674, glDeleteStatesNV, (GLsizei n, const GLuint *states), (n, states), GLsizei n; const GLuint *states;, (call->n, call->states))
+GL_PROC_ASYNC(2675, glStencilThenCoverFillPathNV, (GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode), (path, fillMode, mask, coverMode), GLuint path; GLenum fillMode; GLuint mask; GLenum coverMode;, (call->path, call->fillMode, call->mask, call->coverMode))
+GL_PROC_ASYNC(2676, glProgramUniform1d, (GLuint program, GLint location, GLdouble v0), (program, location, v0), GLuint program; GLint location; GLdouble v0;, (call->program, call->location, call->v0))
+GL_PROC_SYNC_VOID(2677, glGetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2678, glClearDepthxOES, (GLfixed depth), (depth), GLfixed depth;, (call->depth))
+GL_PROC_ASYNC(2679, glTexCoord2fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (s, t, x, y, z), GLfloat s; GLfloat t; GLfloat x; GLfloat y; GLfloat z;, (call->s, call->t, call->x, call->y, call->z))
+GL_PROC_ASYNC(2680, glNamedFramebufferParameteriEXT, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param), GLuint framebuffer; GLenum pname; GLint param;, (call->framebuffer, call->pname, call->param))
+GL_PROC_ASYNC(2681, glNormalStream3dATI, (GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz), (stream, nx, ny, nz), GLenum stream; GLdouble nx; GLdouble ny; GLdouble nz;, (call->stream, call->nx, call->ny, call->nz))
+GL_PROC_SYNC_VOID(2682, glWindowPos3ivARB, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(2683, glImportSemaphoreWin32NameEXT, (GLuint semaphore, GLenum handleType, const void *name), (semaphore, handleType, name), GLuint semaphore; GLenum handleType; const void *name;, (call->semaphore, call->handleType, call->name))
+GL_PROC_ASYNC(2684, glStencilMaskSeparate, (GLenum face, GLuint mask), (face, mask), GLenum face; GLuint mask;, (call->face, call->mask))
+GL_PROC_ASYNC(2685, glClearStencil, (GLint s), (s), GLint s;, (call->s))
+GL_PROC_SYNC_VOID(2686, glWindowPos2svMESA, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(2687, glAlphaFunc, (GLenum func, GLclampf ref), (func, ref), GLenum func; GLclampf ref;, (call->func, call->ref))
+GL_PROC_SYNC_VOID(2688, glLoadTransposeMatrixf, (const GLfloat m[16]), (m), const GLfloat *m;, (call->m))
+GL_PROC_SYNC_VOID(2689, glUniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2690, glScissorExclusiveNV, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLint x; GLint y; GLsizei width; GLsizei height;, (call->x, call->y, call->width, call->height))
+GL_PROC_ASYNC(2691, glLoadIdentity, (void), (), , ())
+GL_PROC_SYNC_VOID(2692, glVariantfvEXT, (GLuint id, const GLfloat *addr), (id, addr), GLuint id; const GLfloat *addr;, (call->id, call->addr))
+GL_PROC_SYNC_VOID(2693, glGetHistogramEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values), GLenum target; GLboolean reset; GLenum format; GLenum type; void *values;, (call->target, call->reset, call->format, call->type, call->values))
+GL_PROC_ASYNC(2694, glBlendFuncSeparateiARB, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha), GLuint buf; GLenum srcRGB; GLenum dstRGB; GLenum srcAlpha; GLenum dstAlpha;, (call->buf, call->srcRGB, call->dstRGB, call->srcAlpha, call->dstAlpha))
+GL_PROC_SYNC(2695, GLuint, glCreateProgram, (void), (), , ())
+GL_PROC_SYNC_VOID(2696, glMultiDrawElementsIndirectAMD, (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride), (mode, type, indirect, primcount, stride), GLenum mode; GLenum type; const void *indirect; GLsizei primcount; GLsizei stride;, (call->mode, call->type, call->indirect, call->primcount, call->stride))
+GL_PROC_SYNC_VOID(2697, glBinormal3svEXT, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(2698, glMulticastGetQueryObjectui64vNV, (GLuint gpu, GLuint id, GLenum pname, GLuint64 *params), (gpu, id, pname, params), GLuint gpu; GLuint id; GLenum pname; GLuint64 *params;, (call->gpu, call->id, call->pname, call->params))
+GL_PROC_ASYNC(2699, glPushName, (GLuint name), (name), GLuint name;, (call->name))
+GL_PROC_SYNC_VOID(2700, glIndexiv, (const GLint *c), (c), const GLint *c;, (call->c))
+GL_PROC_ASYNC(2701, glLGPUCopyImageSubDataNVX, (GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth), GLuint sourceGpu; GLbitfield destinationGpuMask; GLuint srcName; GLenum srcTarget; GLint srcLevel; GLint srcX; GLint srxY; GLint srcZ; GLuint dstName; GLenum dstTarget; GLint dstLevel; GLint dstX; GLint dstY; GLint dstZ; GLsizei width; GLsizei height; GLsizei depth;, (call->sourceGpu, call->destinationGpuMask, call->srcName, call->srcTarget, call->srcLevel, call->srcX, call->srxY, call->srcZ, call->dstName, call->dstTarget, call->dstLevel, call->dstX, call->dstY, call->dstZ, call->width, call->height, call->depth))
+GL_PROC_SYNC_VOID(2702, glMultiDrawElementsEXT, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount), (mode, count, type, indices, primcount), GLenum mode; const GLsizei *count; GLenum type; const void *const*indices; GLsizei primcount;, (call->mode, call->count, call->type, call->indices, call->primcount))
+GL_PROC_SYNC_VOID(2703, glGetVideoi64vNV, (GLuint video_slot, GLenum pname, GLint64EXT *params), (video_slot, pname, params), GLuint video_slot; GLenum pname; GLint64EXT *params;, (call->video_slot, call->pname, call->params))
+GL_PROC_SYNC_VOID(2704, glGetQueryObjectivARB, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLuint id; GLenum pname; GLint *params;, (call->id, call->pname, call->params))
+GL_PROC_ASYNC(2705, glVertexArrayAttribFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset), GLuint vaobj; GLuint attribindex; GLint size; GLenum type; GLboolean normalized; GLuint relativeoffset;, (call->vaobj, call->attribindex, call->size, call->type, call->normalized, call->relativeoffset))
+GL_PROC_SYNC_VOID(2706, glVertexStream4ivATI, (GLenum stream, const GLint *coords), (stream, coords), GLenum stream; const GLint *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2707, glGetNamedProgramivEXT, (GLuint program, GLenum target, GLenum pname, GLint *params), (program, target, pname, params), GLuint program; GLenum target; GLenum pname; GLint *params;, (call->program, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2708, glVariantdvEXT, (GLuint id, const GLdouble *addr), (id, addr), GLuint id; const GLdouble *addr;, (call->id, call->addr))
+GL_PROC_ASYNC(2709, glDepthRange, (GLclampd near_val, GLclampd far_val), (near_val, far_val), GLclampd near_val; GLclampd far_val;, (call->near_val, call->far_val))
+GL_PROC_SYNC_VOID(2710, glGetFinalCombinerInputParameterivNV, (GLenum variable, GLenum pname, GLint *params), (variable, pname, params), GLenum variable; GLenum pname; GLint *params;, (call->variable, call->pname, call->params))
+GL_PROC_SYNC_VOID(2711, glSignalSemaphoreEXT, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts), GLuint semaphore; GLuint numBufferBarriers; const GLuint *buffers; GLuint numTextureBarriers; const GLuint *textures; const GLenum *dstLayouts;, (call->semaphore, call->numBufferBarriers, call->buffers, call->numTextureBarriers, call->textures, call->dstLayouts))
+GL_PROC_SYNC_VOID(2712, glVertexStream3ivATI, (GLenum stream, const GLint *coords), (stream, coords), GLenum stream; const GLint *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2713, glTextureParameterfv, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param), GLuint texture; GLenum pname; const GLfloat *param;, (call->texture, call->pname, call->param))
+GL_PROC_SYNC_VOID(2714, glGetCombinerInputParameterivNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params), (stage, portion, variable, pname, params), GLenum stage; GLenum portion; GLenum variable; GLenum pname; GLint *params;, (call->stage, call->portion, call->variable, call->pname, call->params))
+GL_PROC_SYNC_VOID(2715, glGetMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat *params), (texunit, coord, pname, params), GLenum texunit; GLenum coord; GLenum pname; GLfloat *params;, (call->texunit, call->coord, call->pname, call->params))
+GL_PROC_SYNC_VOID(2716, glUniformui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLuint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2717, glApplyTextureEXT, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_SYNC_VOID(2718, glVertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2719, glEvalCoord1fv, (const GLfloat *u), (u), const GLfloat *u;, (call->u))
+GL_PROC_SYNC_VOID(2720, glGetUniformi64vNV, (GLuint program, GLint location, GLint64EXT *params), (program, location, params), GLuint program; GLint location; GLint64EXT *params;, (call->program, call->location, call->params))
+GL_PROC_SYNC_VOID(2721, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLuint sampler; GLenum pname; GLint *params;, (call->sampler, call->pname, call->params))
+GL_PROC_ASYNC(2722, glUniform3uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), GLint location; GLuint v0; GLuint v1; GLuint v2;, (call->location, call->v0, call->v1, call->v2))
+GL_PROC_SYNC_VOID(2723, glGetProgramLocalParameterdvARB, (GLenum target, GLuint index, GLdouble *params), (target, index, params), GLenum target; GLuint index; GLdouble *params;, (call->target, call->index, call->params))
+GL_PROC_ASYNC(2724, glWindowPos2dMESA, (GLdouble x, GLdouble y), (x, y), GLdouble x; GLdouble y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(2725, glMultiTexCoord2ivARB, (GLenum target, const GLint *v), (target, v), GLenum target; const GLint *v;, (call->target, call->v))
+GL_PROC_ASYNC(2726, glRasterPos4f, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w), GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2727, glMatrixMode, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(2728, glLightEnviSGIX, (GLenum pname, GLint param), (pname, param), GLenum pname; GLint param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2729, glClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data), GLenum target; GLenum internalformat; GLintptr offset; GLsizeiptr size; GLenum format; GLenum type; const void *data;, (call->target, call->internalformat, call->offset, call->size, call->format, call->type, call->data))
+GL_PROC_ASYNC(2730, glFogCoordd, (GLdouble coord), (coord), GLdouble coord;, (call->coord))
+GL_PROC_ASYNC(2731, glMakeTextureHandleNonResidentARB, (GLuint64 handle), (handle), GLuint64 handle;, (call->handle))
+GL_PROC_ASYNC(2732, glEnableVertexAttribAPPLE, (GLuint index, GLenum pname), (index, pname), GLuint index; GLenum pname;, (call->index, call->pname))
+GL_PROC_ASYNC(2733, glPopName, (void), (), , ())
+GL_PROC_SYNC(2734, GLboolean, glUnmapNamedBuffer, (GLuint buffer), (buffer), GLuint buffer;, (call->buffer))
+GL_PROC_SYNC(2735, GLenum, glVideoCaptureNV, (GLuint video_capture_slot, GLuint *sequence_num, GLuint64EXT *capture_time), (video_capture_slot, sequence_num, capture_time), GLuint video_capture_slot; GLuint *sequence_num; GLuint64EXT *capture_time;, (call->video_capture_slot, call->sequence_num, call->capture_time))
+GL_PROC_ASYNC(2736, glWindowPos2iARB, (GLint x, GLint y), (x, y), GLint x; GLint y;, (call->x, call->y))
+GL_PROC_SYNC_VOID(2737, glSecondaryColor3ubv, (const GLubyte *v), (v), const GLubyte *v;, (call->v))
+GL_PROC_ASYNC(2738, glGetQueryBufferObjectui64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), GLuint id; GLuint buffer; GLenum pname; GLintptr offset;, (call->id, call->buffer, call->pname, call->offset))
+GL_PROC_SYNC_VOID(2739, glMultiTexCoord2xvOES, (GLenum texture, const GLfixed *coords), (texture, coords), GLenum texture; const GLfixed *coords;, (call->texture, call->coords))
+GL_PROC_ASYNC(2740, glFragmentMaterialfSGIX, (GLenum face, GLenum pname, GLfloat param), (face, pname, param), GLenum face; GLenum pname; GLfloat param;, (call->face, call->pname, call->param))
+GL_PROC_SYNC_VOID(2741, glProgramUniform2uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC(2742, GLboolean, glUnmapBuffer, (GLenum target), (target), GLenum target;, (call->target))
+GL_PROC_SYNC_VOID(2743, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLuint index; GLenum pname; GLdouble *params;, (call->index, call->pname, call->params))
+GL_PROC_SYNC_VOID(2744, glGetOcclusionQueryuivNV, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), GLuint id; GLenum pname; GLuint *params;, (call->id, call->pname, call->params))
+GL_PROC_SYNC_VOID(2745, glGetActiveAttribARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name), GLhandleARB programObj; GLuint index; GLsizei maxLength; GLsizei *length; GLint *size; GLenum *type; GLcharARB *name;, (call->programObj, call->index, call->maxLength, call->length, call->size, call->type, call->name))
+GL_PROC_SYNC_VOID(2746, glFragmentLightModelfvSGIX, (GLenum pname, const GLfloat *params), (pname, params), GLenum pname; const GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(2747, glTexCoordP4ui, (GLenum type, GLuint coords), (type, coords), GLenum type; GLuint coords;, (call->type, call->coords))
+GL_PROC_SYNC_VOID(2748, glProgramUniformMatrix2x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2749, glClearColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha), GLfixed red; GLfixed green; GLfixed blue; GLfixed alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_ASYNC(2750, glMapGrid2xOES, (GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2), (n, u1, u2, v1, v2), GLint n; GLfixed u1; GLfixed u2; GLfixed v1; GLfixed v2;, (call->n, call->u1, call->u2, call->v1, call->v2))
+GL_PROC_ASYNC(2751, glUniform2ui64ARB, (GLint location, GLuint64 x, GLuint64 y), (location, x, y), GLint location; GLuint64 x; GLuint64 y;, (call->location, call->x, call->y))
+GL_PROC_SYNC_VOID(2752, glUniform2ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLint location; GLsizei count; const GLint *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2753, glUniformMatrix4fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2754, glVertexAttribL1dvEXT, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2755, glSecondaryColor3ivEXT, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(2756, glVertexAttrib4NubvARB, (GLuint index, const GLubyte *v), (index, v), GLuint index; const GLubyte *v;, (call->index, call->v))
+GL_PROC_SYNC_VOID(2757, glEvalCoord2dv, (const GLdouble *u), (u), const GLdouble *u;, (call->u))
+GL_PROC_SYNC_VOID(2758, glGetnHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values), GLenum target; GLboolean reset; GLenum format; GLenum type; GLsizei bufSize; void *values;, (call->target, call->reset, call->format, call->type, call->bufSize, call->values))
+GL_PROC_SYNC_VOID(2759, glGetMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params), GLenum texunit; GLenum target; GLenum pname; GLint *params;, (call->texunit, call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2760, glTexCoord1sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(2761, glUniform2i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value), GLint location; GLsizei count; const GLint64 *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2762, glProgramUniform1iEXT, (GLuint program, GLint location, GLint v0), (program, location, v0), GLuint program; GLint location; GLint v0;, (call->program, call->location, call->v0))
+GL_PROC_SYNC(2763, GLboolean, glIsEnabled, (GLenum cap), (cap), GLenum cap;, (call->cap))
+GL_PROC_ASYNC(2764, glVertexAttribDivisorARB, (GLuint index, GLuint divisor), (index, divisor), GLuint index; GLuint divisor;, (call->index, call->divisor))
+GL_PROC_SYNC_VOID(2765, glProgramUniform2dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_ASYNC(2766, glVertexStream2fATI, (GLenum stream, GLfloat x, GLfloat y), (stream, x, y), GLenum stream; GLfloat x; GLfloat y;, (call->stream, call->x, call->y))
+GL_PROC_SYNC_VOID(2767, glCoverageModulationTableNV, (GLsizei n, const GLfloat *v), (n, v), GLsizei n; const GLfloat *v;, (call->n, call->v))
+GL_PROC_SYNC_VOID(2768, glLightxvOES, (GLenum light, GLenum pname, const GLfixed *params), (light, pname, params), GLenum light; GLenum pname; const GLfixed *params;, (call->light, call->pname, call->params))
+GL_PROC_ASYNC(2769, glNormalP3ui, (GLenum type, GLuint coords), (type, coords), GLenum type; GLuint coords;, (call->type, call->coords))
+GL_PROC_ASYNC(2770, glMatrixTranslatedEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z), GLenum mode; GLdouble x; GLdouble y; GLdouble z;, (call->mode, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2771, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param), GLuint sampler; GLenum pname; const GLfloat *param;, (call->sampler, call->pname, call->param))
+GL_PROC_ASYNC(2772, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLuint index; GLdouble x; GLdouble y;, (call->index, call->x, call->y))
+GL_PROC_SYNC_VOID(2773, glGetPointerv, (GLenum pname, GLvoid **params), (pname, params), GLenum pname; GLvoid **params;, (call->pname, call->params))
+GL_PROC_SYNC_VOID(2774, glClientWaitSemaphoreui64NVX, (GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (fenceObjectCount, semaphoreArray, fenceValueArray), GLsizei fenceObjectCount; const GLuint *semaphoreArray; const GLuint64 *fenceValueArray;, (call->fenceObjectCount, call->semaphoreArray, call->fenceValueArray))
+GL_PROC_SYNC_VOID(2775, glUniform1ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLuint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_ASYNC(2776, glTexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height), GLenum target; GLsizei levels; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->levels, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(2777, glMultiTexCoord3iARB, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r), GLenum target; GLint s; GLint t; GLint r;, (call->target, call->s, call->t, call->r))
+GL_PROC_ASYNC(2778, glBufferParameteriAPPLE, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLenum target; GLenum pname; GLint param;, (call->target, call->pname, call->param))
+GL_PROC_SYNC_VOID(2779, glTexCoord2fVertex3fvSUN, (const GLfloat *tc, const GLfloat *v), (tc, v), const GLfloat *tc; const GLfloat *v;, (call->tc, call->v))
+GL_PROC_SYNC(2780, void *, glMapNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access), GLuint buffer; GLintptr offset; GLsizeiptr length; GLbitfield access;, (call->buffer, call->offset, call->length, call->access))
+GL_PROC_SYNC_VOID(2781, glTexCoord4sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(2782, glFramebufferTextureFaceEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face), GLenum target; GLenum attachment; GLuint texture; GLint level; GLenum face;, (call->target, call->attachment, call->texture, call->level, call->face))
+GL_PROC_SYNC_VOID(2783, glColor3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(2784, glMultiTexCoord4bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q), (texture, s, t, r, q), GLenum texture; GLbyte s; GLbyte t; GLbyte r; GLbyte q;, (call->texture, call->s, call->t, call->r, call->q))
+GL_PROC_SYNC_VOID(2785, glGetFenceivNV, (GLuint fence, GLenum pname, GLint *params), (fence, pname, params), GLuint fence; GLenum pname; GLint *params;, (call->fence, call->pname, call->params))
+GL_PROC_ASYNC(2786, glSampleMapATI, (GLuint dst, GLuint interp, GLenum swizzle), (dst, interp, swizzle), GLuint dst; GLuint interp; GLenum swizzle;, (call->dst, call->interp, call->swizzle))
+GL_PROC_SYNC_VOID(2787, glProgramUniform4ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLuint64EXT *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2788, glPrioritizeTexturesEXT, (GLsizei n, const GLuint *textures, const GLclampf *priorities), (n, textures, priorities), GLsizei n; const GLuint *textures; const GLclampf *priorities;, (call->n, call->textures, call->priorities))
+GL_PROC_ASYNC(2789, glEnd, (void), (), , ())
+GL_PROC_SYNC_VOID(2790, glPixelTexGenParameterivSGIS, (GLenum pname, const GLint *params), (pname, params), GLenum pname; const GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(2791, glBindTransformFeedback, (GLenum target, GLuint id), (target, id), GLenum target; GLuint id;, (call->target, call->id))
+GL_PROC_ASYNC(2792, glNamedFramebufferTexture1DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level), GLuint framebuffer; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->framebuffer, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_SYNC_VOID(2793, glWindowPos3fvMESA, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_SYNC_CLIENT_ARRAY(2794, glMultiTexCoordPointerEXT, (GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer), (texunit, size, type, stride, pointer), GLenum texunit; GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->texunit, call->size, call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(2795, glTangent3iEXT, (GLint tx, GLint ty, GLint tz), (tx, ty, tz), GLint tx; GLint ty; GLint tz;, (call->tx, call->ty, call->tz))
+GL_PROC_SYNC_VOID(2796, glClearNamedBufferSubData, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data), GLuint buffer; GLenum internalformat; GLintptr offset; GLsizeiptr size; GLenum format; GLenum type; const void *data;, (call->buffer, call->internalformat, call->offset, call->size, call->format, call->type, call->data))
+GL_PROC_SYNC_VOID(2797, glSemaphoreParameterui64vEXT, (GLuint semaphore, GLenum pname, const GLuint64 *params), (semaphore, pname, params), GLuint semaphore; GLenum pname; const GLuint64 *params;, (call->semaphore, call->pname, call->params))
+GL_PROC_SYNC_VOID(2798, glPixelTransformParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLenum target; GLenum pname; const GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2799, glGetnUniformivARB, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLint *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(2800, glWindowPos2sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_SYNC_VOID(2801, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLenum type; const GLvoid *pixels;, (call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->type, call->pixels))
+GL_PROC_SYNC_VOID(2802, glGetFloatv, (GLenum pname, GLfloat *params), (pname, params), GLenum pname; GLfloat *params;, (call->pname, call->params))
+GL_PROC_ASYNC(2803, glClearNamedFramebufferfi, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil), GLuint framebuffer; GLenum buffer; GLint drawbuffer; GLfloat depth; GLint stencil;, (call->framebuffer, call->buffer, call->drawbuffer, call->depth, call->stencil))
+GL_PROC_ASYNC(2804, glTextureStorage1DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (texture, target, levels, internalformat, width), GLuint texture; GLenum target; GLsizei levels; GLenum internalformat; GLsizei width;, (call->texture, call->target, call->levels, call->internalformat, call->width))
+GL_PROC_SYNC_VOID(2805, glVertexAttribs2dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v), GLuint index; GLsizei count; const GLdouble *v;, (call->index, call->count, call->v))
+GL_PROC_ASYNC(2806, glMultiTexParameterfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param), GLenum texunit; GLenum target; GLenum pname; GLfloat param;, (call->texunit, call->target, call->pname, call->param))
+GL_PROC_SYNC(2807, GLboolean, glIsVertexArrayAPPLE, (GLuint array), (array), GLuint array;, (call->array))
+GL_PROC_SYNC_VOID(2808, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLfloat *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2809, glProgramUniform2dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y), (program, location, x, y), GLuint program; GLint location; GLdouble x; GLdouble y;, (call->program, call->location, call->x, call->y))
+GL_PROC_SYNC_VOID(2810, glBindImageTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLuint first; GLsizei count; const GLuint *textures;, (call->first, call->count, call->textures))
+GL_PROC_ASYNC(2811, glDisableVertexAttribAPPLE, (GLuint index, GLenum pname), (index, pname), GLuint index; GLenum pname;, (call->index, call->pname))
+GL_PROC_ASYNC(2812, glFogCoordhNV, (GLhalfNV fog), (fog), GLhalfNV fog;, (call->fog))
+GL_PROC_SYNC_VOID(2813, glGetVertexArrayIntegervEXT, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param), GLuint vaobj; GLenum pname; GLint *param;, (call->vaobj, call->pname, call->param))
+GL_PROC_ASYNC(2814, glPresentFrameKeyedNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1), GLuint video_slot; GLuint64EXT minPresentTime; GLuint beginPresentTimeId; GLuint presentDurationId; GLenum type; GLenum target0; GLuint fill0; GLuint key0; GLenum target1; GLuint fill1; GLuint key1;, (call->video_slot, call->minPresentTime, call->beginPresentTimeId, call->presentDurationId, call->type, call->target0, call->fill0, call->key0, call->target1, call->fill1, call->key1))
+GL_PROC_ASYNC(2815, glPopDebugGroup, (void), (), , ())
+GL_PROC_SYNC_VOID(2816, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label), GLenum identifier; GLuint name; GLsizei bufSize; GLsizei *length; GLchar *label;, (call->identifier, call->name, call->bufSize, call->length, call->label))
+GL_PROC_SYNC_VOID(2817, glGetVertexAttribivARB, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLuint index; GLenum pname; GLint *params;, (call->index, call->pname, call->params))
+GL_PROC_ASYNC(2818, glDepthMask, (GLboolean flag), (flag), GLboolean flag;, (call->flag))
+GL_PROC_ASYNC(2819, glMultiTexCoord4fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q), GLenum target; GLfloat s; GLfloat t; GLfloat r; GLfloat q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_SYNC(2820, GLenum, glGetError, (void), (), , ())
+GL_PROC_SYNC_VOID(2821, glCompileShaderIncludeARB, (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length), (shader, count, path, length), GLuint shader; GLsizei count; const GLchar *const*path; const GLint *length;, (call->shader, call->count, call->path, call->length))
+GL_PROC_ASYNC(2822, glBindFramebufferEXT, (GLenum target, GLuint framebuffer), (target, framebuffer), GLenum target; GLuint framebuffer;, (call->target, call->framebuffer))
+GL_PROC_SYNC_VOID(2823, glVertexAttribI1uivEXT, (GLuint index, const GLuint *v), (index, v), GLuint index; const GLuint *v;, (call->index, call->v))
+GL_PROC_ASYNC(2824, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), GLuint index; GLuint x; GLuint y; GLuint z;, (call->index, call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2825, glLightModelxvOES, (GLenum pname, const GLfixed *param), (pname, param), GLenum pname; const GLfixed *param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2826, glTangent3svEXT, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(2827, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level; GLint zoffset;, (call->target, call->attachment, call->textarget, call->texture, call->level, call->zoffset))
+GL_PROC_SYNC_VOID(2828, glProgramUniform3dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLdouble *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2829, glUniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC(2830, GLuint, glGetDebugMessageLogAMD, (GLuint count, GLsizei bufsize, GLenum *categories, GLuint *severities, GLuint *ids, GLsizei *lengths, GLchar *message), (count, bufsize, categories, severities, ids, lengths, message), GLuint count; GLsizei bufsize; GLenum *categories; GLuint *severities; GLuint *ids; GLsizei *lengths; GLchar *message;, (call->count, call->bufsize, call->categories, call->severities, call->ids, call->lengths, call->message))
+GL_PROC_SYNC_VOID(2831, glTransformFeedbackAttribsNV, (GLsizei count, const GLint *attribs, GLenum bufferMode), (count, attribs, bufferMode), GLsizei count; const GLint *attribs; GLenum bufferMode;, (call->count, call->attribs, call->bufferMode))
+GL_PROC_SYNC_VOID(2832, glGetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name), GLuint program; GLenum shadertype; GLuint index; GLsizei bufsize; GLsizei *length; GLchar *name;, (call->program, call->shadertype, call->index, call->bufsize, call->length, call->name))
+GL_PROC_ASYNC(2833, glTexStorageMem3DMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset), GLenum target; GLsizei samples; GLenum internalFormat; GLsizei width; GLsizei height; GLsizei depth; GLboolean fixedSampleLocations; GLuint memory; GLuint64 offset;, (call->target, call->samples, call->internalFormat, call->width, call->height, call->depth, call->fixedSampleLocations, call->memory, call->offset))
+GL_PROC_SYNC(2834, GLuint, glGetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLuint program; GLenum shadertype; const GLchar *name;, (call->program, call->shadertype, call->name))
+GL_PROC_SYNC_VOID(2835, glGetnUniformuiv, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params), GLuint program; GLint location; GLsizei bufSize; GLuint *params;, (call->program, call->location, call->bufSize, call->params))
+GL_PROC_SYNC_VOID(2836, glVertex3fv, (const GLfloat *v), (v), const GLfloat *v;, (call->v))
+GL_PROC_ASYNC(2837, glMultiTexCoord4iARB, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q), GLenum target; GLint s; GLint t; GLint r; GLint q;, (call->target, call->s, call->t, call->r, call->q))
+GL_PROC_SYNC(2838, GLint, glGetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLuint program; GLenum shadertype; const GLchar *name;, (call->program, call->shadertype, call->name))
+GL_PROC_ASYNC(2839, glWindowPos4fMESA, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w), GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2840, glGetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog), GLuint pipeline; GLsizei bufSize; GLsizei *length; GLchar *infoLog;, (call->pipeline, call->bufSize, call->length, call->infoLog))
+GL_PROC_SYNC_VOID(2841, glProgramBufferParametersfvNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat *params), (target, bindingIndex, wordIndex, count, params), GLenum target; GLuint bindingIndex; GLuint wordIndex; GLsizei count; const GLfloat *params;, (call->target, call->bindingIndex, call->wordIndex, call->count, call->params))
+GL_PROC_SYNC_VOID(2842, glWeightsvARB, (GLint size, const GLshort *weights), (size, weights), GLint size; const GLshort *weights;, (call->size, call->weights))
+GL_PROC_ASYNC(2843, glVariantArrayObjectATI, (GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (id, type, stride, buffer, offset), GLuint id; GLenum type; GLsizei stride; GLuint buffer; GLuint offset;, (call->id, call->type, call->stride, call->buffer, call->offset))
+GL_PROC_ASYNC(2844, glUniform2i64ARB, (GLint location, GLint64 x, GLint64 y), (location, x, y), GLint location; GLint64 x; GLint64 y;, (call->location, call->x, call->y))
+GL_PROC_SYNC_VOID(2845, glProgramParameters4dvNV, (GLenum target, GLuint index, GLsizei count, const GLdouble *v), (target, index, count, v), GLenum target; GLuint index; GLsizei count; const GLdouble *v;, (call->target, call->index, call->count, call->v))
+GL_PROC_SYNC_VOID(2846, glNormalStream3svATI, (GLenum stream, const GLshort *coords), (stream, coords), GLenum stream; const GLshort *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2847, glProgramUniformMatrix3x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_ASYNC(2848, glPixelStoref, (GLenum pname, GLfloat param), (pname, param), GLenum pname; GLfloat param;, (call->pname, call->param))
+GL_PROC_SYNC_VOID(2849, glDrawBuffersATI, (GLsizei n, const GLenum *bufs), (n, bufs), GLsizei n; const GLenum *bufs;, (call->n, call->bufs))
+GL_PROC_SYNC_VOID(2850, glPolygonStipple, (const GLubyte *mask), (mask), const GLubyte *mask;, (call->mask))
+GL_PROC_ASYNC(2851, glDisableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index), GLuint vaobj; GLuint index;, (call->vaobj, call->index))
+GL_PROC_ASYNC(2852, glLGPUInterlockNVX, (void), (), , ())
+GL_PROC_SYNC_VOID(2853, glUniform3ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value), GLint location; GLsizei count; const GLuint64EXT *value;, (call->location, call->count, call->value))
+GL_PROC_SYNC(2854, GLfloat, glGetPathLengthNV, (GLuint path, GLsizei startSegment, GLsizei numSegments), (path, startSegment, numSegments), GLuint path; GLsizei startSegment; GLsizei numSegments;, (call->path, call->startSegment, call->numSegments))
+GL_PROC_SYNC_VOID(2855, glWindowPos2ivMESA, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_SYNC_VOID(2856, glGetIntegerv, (GLenum pname, GLint *params), (pname, params), GLenum pname; GLint *params;, (call->pname, call->params))
+GL_PROC_ASYNC(2857, glMultiTexCoord1hNV, (GLenum target, GLhalfNV s), (target, s), GLenum target; GLhalfNV s;, (call->target, call->s))
+GL_PROC_SYNC_VOID(2858, glTexCoord3dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_ASYNC(2859, glFramebufferTexture1DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLenum target; GLenum attachment; GLenum textarget; GLuint texture; GLint level;, (call->target, call->attachment, call->textarget, call->texture, call->level))
+GL_PROC_SYNC_VOID(2860, glCallLists, (GLsizei n, GLenum type, const GLvoid *lists), (n, type, lists), GLsizei n; GLenum type; const GLvoid *lists;, (call->n, call->type, call->lists))
+GL_PROC_SYNC_VOID(2861, glPixelMapuiv, (GLenum map, GLsizei mapsize, const GLuint *values), (map, mapsize, values), GLenum map; GLsizei mapsize; const GLuint *values;, (call->map, call->mapsize, call->values))
+GL_PROC_ASYNC(2862, glPassThroughxOES, (GLfixed token), (token), GLfixed token;, (call->token))
+GL_PROC_ASYNC(2863, glStartInstrumentsSGIX, (void), (), , ())
+GL_PROC_SYNC_VOID(2864, glTexCoord3sv, (const GLshort *v), (v), const GLshort *v;, (call->v))
+GL_PROC_ASYNC(2865, glCopyTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, target, level, xoffset, x, y, width), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint x; GLint y; GLsizei width;, (call->texture, call->target, call->level, call->xoffset, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(2866, glVertexAttribL2dv, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(2867, glMakeImageHandleResidentNV, (GLuint64 handle, GLenum access), (handle, access), GLuint64 handle; GLenum access;, (call->handle, call->access))
+GL_PROC_ASYNC(2868, glUniform2uiEXT, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), GLint location; GLuint v0; GLuint v1;, (call->location, call->v0, call->v1))
+GL_PROC_ASYNC(2869, glProgramUniform2i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y), (program, location, x, y), GLuint program; GLint location; GLint64EXT x; GLint64EXT y;, (call->program, call->location, call->x, call->y))
+GL_PROC_ASYNC(2870, glColor3ub, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue), GLubyte red; GLubyte green; GLubyte blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(2871, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices), GLuint program; GLsizei uniformCount; const GLchar *const*uniformNames; GLuint *uniformIndices;, (call->program, call->uniformCount, call->uniformNames, call->uniformIndices))
+GL_PROC_SYNC_VOID(2872, glVariantusvEXT, (GLuint id, const GLushort *addr), (id, addr), GLuint id; const GLushort *addr;, (call->id, call->addr))
+GL_PROC_SYNC_VOID(2873, glListParameterivSGIX, (GLuint list, GLenum pname, const GLint *params), (list, pname, params), GLuint list; GLenum pname; const GLint *params;, (call->list, call->pname, call->params))
+GL_PROC_ASYNC(2874, glGlobalAlphaFactorusSUN, (GLushort factor), (factor), GLushort factor;, (call->factor))
+GL_PROC_SYNC_VOID(2875, glVertex4bvOES, (const GLbyte *coords), (coords), const GLbyte *coords;, (call->coords))
+GL_PROC_ASYNC(2876, glEnableVertexArrayEXT, (GLuint vaobj, GLenum array), (vaobj, array), GLuint vaobj; GLenum array;, (call->vaobj, call->array))
+GL_PROC_SYNC_VOID(2877, glReadnPixelsARB, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data), GLint x; GLint y; GLsizei width; GLsizei height; GLenum format; GLenum type; GLsizei bufSize; void *data;, (call->x, call->y, call->width, call->height, call->format, call->type, call->bufSize, call->data))
+GL_PROC_SYNC_CLIENT_ARRAY(2878, glTexCoordPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr), GLint size; GLenum type; GLsizei stride; const GLvoid *ptr;, (call->size, call->type, call->stride, call->ptr))
+GL_PROC_SYNC_VOID(2879, glVertexStream2dvATI, (GLenum stream, const GLdouble *coords), (stream, coords), GLenum stream; const GLdouble *coords;, (call->stream, call->coords))
+GL_PROC_SYNC_VOID(2880, glVertex2dv, (const GLdouble *v), (v), const GLdouble *v;, (call->v))
+GL_PROC_SYNC_VOID(2881, glMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, depth, border, format, type, pixels), GLenum texunit; GLenum target; GLint level; GLint internalformat; GLsizei width; GLsizei height; GLsizei depth; GLint border; GLenum format; GLenum type; const void *pixels;, (call->texunit, call->target, call->level, call->internalformat, call->width, call->height, call->depth, call->border, call->format, call->type, call->pixels))
+GL_PROC_ASYNC(2882, glNamedFramebufferReadBuffer, (GLuint framebuffer, GLenum src), (framebuffer, src), GLuint framebuffer; GLenum src;, (call->framebuffer, call->src))
+GL_PROC_ASYNC(2883, glMapGrid2f, (GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2), (un, u1, u2, vn, v1, v2), GLint un; GLfloat u1; GLfloat u2; GLint vn; GLfloat v1; GLfloat v2;, (call->un, call->u1, call->u2, call->vn, call->v1, call->v2))
+GL_PROC_ASYNC(2884, glProgramUniform3d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2), GLuint program; GLint location; GLdouble v0; GLdouble v1; GLdouble v2;, (call->program, call->location, call->v0, call->v1, call->v2))
+GL_PROC_SYNC_VOID(2885, glProgramUniformMatrix2x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), GLuint program; GLint location; GLsizei count; GLboolean transpose; const GLdouble *value;, (call->program, call->location, call->count, call->transpose, call->value))
+GL_PROC_SYNC_VOID(2886, glGetProgramStringNV, (GLuint id, GLenum pname, GLubyte *program), (id, pname, program), GLuint id; GLenum pname; GLubyte *program;, (call->id, call->pname, call->program))
+GL_PROC_ASYNC(2887, glPathFogGenNV, (GLenum genMode), (genMode), GLenum genMode;, (call->genMode))
+GL_PROC_ASYNC(2888, glMulticastCopyBufferSubDataNV, (GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size), GLuint readGpu; GLbitfield writeGpuMask; GLuint readBuffer; GLuint writeBuffer; GLintptr readOffset; GLintptr writeOffset; GLsizeiptr size;, (call->readGpu, call->writeGpuMask, call->readBuffer, call->writeBuffer, call->readOffset, call->writeOffset, call->size))
+GL_PROC_ASYNC(2889, glTessellationModeAMD, (GLenum mode), (mode), GLenum mode;, (call->mode))
+GL_PROC_ASYNC(2890, glNamedFramebufferTextureFaceEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face), (framebuffer, attachment, texture, level, face), GLuint framebuffer; GLenum attachment; GLuint texture; GLint level; GLenum face;, (call->framebuffer, call->attachment, call->texture, call->level, call->face))
+GL_PROC_ASYNC(2891, glVertex4s, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w), GLshort x; GLshort y; GLshort z; GLshort w;, (call->x, call->y, call->z, call->w))
+GL_PROC_SYNC_VOID(2892, glDebugMessageControlARB, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), GLenum source; GLenum type; GLenum severity; GLsizei count; const GLuint *ids; GLboolean enabled;, (call->source, call->type, call->severity, call->count, call->ids, call->enabled))
+GL_PROC_SYNC_VOID(2893, glProgramUniform4fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), GLuint program; GLint location; GLsizei count; const GLfloat *value;, (call->program, call->location, call->count, call->value))
+GL_PROC_SYNC_VOID(2894, glGetConvolutionParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLenum target; GLenum pname; GLfloat *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_CLIENT_ARRAY(2895, glVertexAttribIPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLuint index; GLint size; GLenum type; GLsizei stride; const void *pointer;, (call->index, call->size, call->type, call->stride, call->pointer))
+GL_PROC_ASYNC(2896, glVertexBlendARB, (GLint count), (count), GLint count;, (call->count))
+GL_PROC_ASYNC(2897, glDisableVertexArrayAttribEXT, (GLuint vaobj, GLuint index), (vaobj, index), GLuint vaobj; GLuint index;, (call->vaobj, call->index))
+GL_PROC_SYNC(2898, GLuint, glCreateShader, (GLenum type), (type), GLenum type;, (call->type))
+GL_PROC_ASYNC(2899, glSampleCoverageARB, (GLfloat value, GLboolean invert), (value, invert), GLfloat value; GLboolean invert;, (call->value, call->invert))
+GL_PROC_SYNC_VOID(2900, glGetNamedProgramLocalParameterIivEXT, (GLuint program, GLenum target, GLuint index, GLint *params), (program, target, index, params), GLuint program; GLenum target; GLuint index; GLint *params;, (call->program, call->target, call->index, call->params))
+GL_PROC_ASYNC(2901, glTexCoordP1ui, (GLenum type, GLuint coords), (type, coords), GLenum type; GLuint coords;, (call->type, call->coords))
+GL_PROC_ASYNC(2902, glVertexAttribLFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride), GLuint index; GLint size; GLenum type; GLsizei stride;, (call->index, call->size, call->type, call->stride))
+GL_PROC_ASYNC(2903, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), GLenum target; GLenum internalformat; GLsizei width; GLsizei height;, (call->target, call->internalformat, call->width, call->height))
+GL_PROC_ASYNC(2904, glIndexf, (GLfloat c), (c), GLfloat c;, (call->c))
+GL_PROC_SYNC_VOID(2905, glMulticastViewportArrayvNVX, (GLuint gpu, GLuint first, GLsizei count, const GLfloat *v), (gpu, first, count, v), GLuint gpu; GLuint first; GLsizei count; const GLfloat *v;, (call->gpu, call->first, call->count, call->v))
+GL_PROC_SYNC_VOID(2906, glGetNamedStringARB, (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string), (namelen, name, bufSize, stringlen, string), GLint namelen; const GLchar *name; GLsizei bufSize; GLint *stringlen; GLchar *string;, (call->namelen, call->name, call->bufSize, call->stringlen, call->string))
+GL_PROC_SYNC_CLIENT_ARRAY(2907, glVertexPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr), GLint size; GLenum type; GLsizei stride; const GLvoid *ptr;, (call->size, call->type, call->stride, call->ptr))
+GL_PROC_SYNC_VOID(2908, glGetTexParameterPointervAPPLE, (GLenum target, GLenum pname, void **params), (target, pname, params), GLenum target; GLenum pname; void **params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2909, glVertexAttrib4sARB, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), GLuint index; GLshort x; GLshort y; GLshort z; GLshort w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2910, glVertexAttrib2sNV, (GLuint index, GLshort x, GLshort y), (index, x, y), GLuint index; GLshort x; GLshort y;, (call->index, call->x, call->y))
+GL_PROC_ASYNC(2911, glTexturePageCommitmentEXT, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (texture, level, xoffset, yoffset, zoffset, width, height, depth, commit), GLuint texture; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLboolean commit;, (call->texture, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->commit))
+GL_PROC_SYNC_VOID(2912, glGenTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids), GLsizei n; GLuint *ids;, (call->n, call->ids))
+GL_PROC_ASYNC(2913, glClipControl, (GLenum origin, GLenum depth), (origin, depth), GLenum origin; GLenum depth;, (call->origin, call->depth))
+GL_PROC_ASYNC(2914, glColor3xOES, (GLfixed red, GLfixed green, GLfixed blue), (red, green, blue), GLfixed red; GLfixed green; GLfixed blue;, (call->red, call->green, call->blue))
+GL_PROC_SYNC_VOID(2915, glGetnPixelMapuiv, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values), GLenum map; GLsizei bufSize; GLuint *values;, (call->map, call->bufSize, call->values))
+GL_PROC_ASYNC(2916, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), GLuint index; GLfloat x; GLfloat y; GLfloat z; GLfloat w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2917, glFinalCombinerInputNV, (GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (variable, input, mapping, componentUsage), GLenum variable; GLenum input; GLenum mapping; GLenum componentUsage;, (call->variable, call->input, call->mapping, call->componentUsage))
+GL_PROC_ASYNC(2918, glFramebufferTextureMultiviewOVR, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews), (target, attachment, texture, level, baseViewIndex, numViews), GLenum target; GLenum attachment; GLuint texture; GLint level; GLint baseViewIndex; GLsizei numViews;, (call->target, call->attachment, call->texture, call->level, call->baseViewIndex, call->numViews))
+GL_PROC_SYNC_VOID(2919, glListParameterfvSGIX, (GLuint list, GLenum pname, const GLfloat *params), (list, pname, params), GLuint list; GLenum pname; const GLfloat *params;, (call->list, call->pname, call->params))
+GL_PROC_ASYNC(2920, glTranslatexOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z), GLfixed x; GLfixed y; GLfixed z;, (call->x, call->y, call->z))
+GL_PROC_SYNC_VOID(2921, glSetInvariantEXT, (GLuint id, GLenum type, const void *addr), (id, type, addr), GLuint id; GLenum type; const void *addr;, (call->id, call->type, call->addr))
+GL_PROC_SYNC_VOID(2922, glBitmap, (GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap), GLsizei width; GLsizei height; GLfloat xorig; GLfloat yorig; GLfloat xmove; GLfloat ymove; const GLubyte *bitmap;, (call->width, call->height, call->xorig, call->yorig, call->xmove, call->ymove, call->bitmap))
+GL_PROC_SYNC_VOID(2923, glMultiTexCoord4bvOES, (GLenum texture, const GLbyte *coords), (texture, coords), GLenum texture; const GLbyte *coords;, (call->texture, call->coords))
+GL_PROC_SYNC_VOID(2924, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; const GLuint *value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_ASYNC(2925, glVertexAttribL4i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (index, x, y, z, w), GLuint index; GLint64EXT x; GLint64EXT y; GLint64EXT z; GLint64EXT w;, (call->index, call->x, call->y, call->z, call->w))
+GL_PROC_SYNC(2926, void *, glMapTexture2DINTEL, (GLuint texture, GLint level, GLbitfield access, GLint *stride, GLenum *layout), (texture, level, access, stride, layout), GLuint texture; GLint level; GLbitfield access; GLint *stride; GLenum *layout;, (call->texture, call->level, call->access, call->stride, call->layout))
+GL_PROC_SYNC_VOID(2927, glVertexAttrib3dvNV, (GLuint index, const GLdouble *v), (index, v), GLuint index; const GLdouble *v;, (call->index, call->v))
+GL_PROC_ASYNC(2928, glMultiTexCoord2s, (GLenum target, GLshort s, GLshort t), (target, s, t), GLenum target; GLshort s; GLshort t;, (call->target, call->s, call->t))
+GL_PROC_SYNC_VOID(2929, glWindowPos2ivARB, (const GLint *v), (v), const GLint *v;, (call->v))
+GL_PROC_ASYNC(2930, glColorMaskIndexedEXT, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), GLuint index; GLboolean r; GLboolean g; GLboolean b; GLboolean a;, (call->index, call->r, call->g, call->b, call->a))
+GL_PROC_SYNC_VOID(2931, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params), GLenum target; GLenum attachment; GLenum pname; GLint *params;, (call->target, call->attachment, call->pname, call->params))
+GL_PROC_SYNC_VOID(2932, glMultMatrixd, (const GLdouble *m), (m), const GLdouble *m;, (call->m))
+GL_PROC_SYNC_VOID(2933, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLuint program; GLuint index; GLsizei bufSize; GLsizei *length; GLsizei *size; GLenum *type; GLchar *name;, (call->program, call->index, call->bufSize, call->length, call->size, call->type, call->name))
+GL_PROC_ASYNC(2934, glUniform4i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (location, x, y, z, w), GLint location; GLint64EXT x; GLint64EXT y; GLint64EXT z; GLint64EXT w;, (call->location, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2935, glBlendEquationIndexedAMD, (GLuint buf, GLenum mode), (buf, mode), GLuint buf; GLenum mode;, (call->buf, call->mode))
+GL_PROC_SYNC_VOID(2936, glProgramNamedParameter4dNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (id, len, name, x, y, z, w), GLuint id; GLsizei len; const GLubyte *name; GLdouble x; GLdouble y; GLdouble z; GLdouble w;, (call->id, call->len, call->name, call->x, call->y, call->z, call->w))
+GL_PROC_ASYNC(2937, glTextureStorage2DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations), GLuint texture; GLsizei samples; GLenum internalformat; GLsizei width; GLsizei height; GLboolean fixedsamplelocations;, (call->texture, call->samples, call->internalformat, call->width, call->height, call->fixedsamplelocations))
+GL_PROC_SYNC_VOID(2938, glClearTexImage, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data), GLuint texture; GLint level; GLenum format; GLenum type; const void *data;, (call->texture, call->level, call->format, call->type, call->data))
+GL_PROC_ASYNC(2939, glFragmentLightfSGIX, (GLenum light, GLenum pname, GLfloat param), (light, pname, param), GLenum light; GLenum pname; GLfloat param;, (call->light, call->pname, call->param))
+GL_PROC_SYNC_VOID(2940, glGetProgramLocalParameterIuivNV, (GLenum target, GLuint index, GLuint *params), (target, index, params), GLenum target; GLuint index; GLuint *params;, (call->target, call->index, call->params))
+GL_PROC_SYNC_VOID(2941, glMultiTexCoord2sv, (GLenum target, const GLshort *v), (target, v), GLenum target; const GLshort *v;, (call->target, call->v))
+GL_PROC_ASYNC(2942, glCopyConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width), GLenum target; GLenum internalformat; GLint x; GLint y; GLsizei width;, (call->target, call->internalformat, call->x, call->y, call->width))
+GL_PROC_SYNC_VOID(2943, glDeleteMemoryObjectsEXT, (GLsizei n, const GLuint *memoryObjects), (n, memoryObjects), GLsizei n; const GLuint *memoryObjects;, (call->n, call->memoryObjects))
+GL_PROC_SYNC_VOID(2944, glVertexStream3fvATI, (GLenum stream, const GLfloat *coords), (stream, coords), GLenum stream; const GLfloat *coords;, (call->stream, call->coords))
+GL_PROC_ASYNC(2945, glIndexMaterialEXT, (GLenum face, GLenum mode), (face, mode), GLenum face; GLenum mode;, (call->face, call->mode))
+GL_PROC_SYNC_VOID(2946, glDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect), GLenum mode; GLenum type; const void *indirect;, (call->mode, call->type, call->indirect))
+GL_PROC_ASYNC(2947, glImportMemoryFdEXT, (GLuint memory, GLuint64 size, GLenum handleType, GLint fd), (memory, size, handleType, fd), GLuint memory; GLuint64 size; GLenum handleType; GLint fd;, (call->memory, call->size, call->handleType, call->fd))
+GL_PROC_SYNC_VOID(2948, glMultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLenum texture; GLenum type; const GLuint *coords;, (call->texture, call->type, call->coords))
+GL_PROC_SYNC_VOID(2949, glMultiTexCoord1dv, (GLenum target, const GLdouble *v), (target, v), GLenum target; const GLdouble *v;, (call->target, call->v))
+GL_PROC_SYNC_VOID(2950, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLuint index; GLenum type; GLboolean normalized; const GLuint *value;, (call->index, call->type, call->normalized, call->value))
+GL_PROC_SYNC_VOID(2951, glCompressedTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits), GLuint texture; GLenum target; GLint level; GLint xoffset; GLint yoffset; GLint zoffset; GLsizei width; GLsizei height; GLsizei depth; GLenum format; GLsizei imageSize; const void *bits;, (call->texture, call->target, call->level, call->xoffset, call->yoffset, call->zoffset, call->width, call->height, call->depth, call->format, call->imageSize, call->bits))
+GL_PROC_SYNC_VOID(2952, glDrawCommandsStatesNV, (GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (buffer, indirects, sizes, states, fbos, count), GLuint buffer; const GLintptr *indirects; const GLsizei *sizes; const GLuint *states; const GLuint *fbos; GLuint count;, (call->buffer, call->indirects, call->sizes, call->states, call->fbos, call->count))
+GL_PROC_SYNC_VOID(2953, glGenFencesAPPLE, (GLsizei n, GLuint *fences), (n, fences), GLsizei n; GLuint *fences;, (call->n, call->fences))
+GL_PROC_ASYNC(2954, glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), GLboolean red; GLboolean green; GLboolean blue; GLboolean alpha;, (call->red, call->green, call->blue, call->alpha))
+GL_PROC_SYNC_VOID(2955, glGetConvolutionParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLenum target; GLenum pname; GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_ASYNC(2956, glPatchParameteri, (GLenum pname, GLint value), (pname, value), GLenum pname; GLint value;, (call->pname, call->value))
+GL_PROC_SYNC_VOID(2957, glColorTableParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLenum target; GLenum pname; const GLint *params;, (call->target, call->pname, call->params))
+GL_PROC_SYNC_VOID(2958, glMulticastGetQueryObjectuivNV, (GLuint gpu, GLuint id, GLenum pname, GLuint *params), (gpu, id, pname, params), GLuint gpu; GLuint id; GLenum pname; GLuint *params;, (call->gpu, call->id, call->pname, call->params))
+GL_PROC_ASYNC(2959, glLineWidthxOES, (GLfixed width), (width), GLfixed width;, (call->width))
+GL_PROC_SYNC(2960, GLuint64, glGetTextureHandleARB, (GLuint texture), (texture), GLuint texture;, (call->texture))
+GL_PROC_SYNC_VOID(2961, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), GLenum mode; GLsizei count; GLenum type; const void *indices; GLsizei instancecount; GLint basevertex;, (call->mode, call->count, call->type, call->indices, call->instancecount, call->basevertex))
+GL_PROC_ASYNC(2962, glColor4ubVertex3fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, x, y, z), GLubyte r; GLubyte g; GLubyte b; GLubyte a; GLfloat x; GLfloat y; GLfloat z;, (call->r, call->g, call->b, call->a, call->x, call->y, call->z))
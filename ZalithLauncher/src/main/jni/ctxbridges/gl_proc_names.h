@@ -0,0 +1,3229 @@
+//
+// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.
+//
+
+#ifndef POJAVLAUNCHER_GL_PROC_NAMES_H
+#define POJAVLAUNCHER_GL_PROC_NAMES_H
+
+#include <stdint.h>
+
+#define GL_PROC_COUNT 2963
+#define GL_PROC_TABLE_HASH 0x7fb1a193u
+
+static const int32_t gl_proc_displacements[GL_PROC_COUNT] = {
+    1, -2961, 0, -2960, 0, 1, 0, 0, -2946, 0, -2943, -2940,
+    -2938, 1, 0, -2936, -2934, 2, -2933, -2931, -2930, -2927, 1, 0,
+    -2926, -2924, -2923, -2920, 1, 0, 0, 0, -2918, -2910, -2907, -2902,
+    1, -2900, 0, -2889, 0, 0, 3, -2885, 0, 3, -2877, -2876,
+    -2873, -2871, 0, 0, 2, -2864, 0, 0, -2863, 1, 0, 1,
+    0, -2862, 0, 1, -2861, 0, -2860, 0, 0, 0, 0, 1,
+    2, 0, -2854, 2, -2852, -2851, 0, 0, -2850, 1, -2838, 3,
+    1, -2837, -2836, 1, 0, -2834, 0, -2833, 0, 0, 0, 0,
+    0, 0, -2820, 0, 0, 1, -2819, 0, -2817, -2815, 1, -2813,
+    1, 0, 1, -2811, 1, 0, 0, 1, -2807, 1, 1, -2801,
+    -2798, -2797, 0, -2791, -2789, 1, -2788, 1, 0, -2785, 0, -2784,
+    -2782, -2778, -2775, -2770, -2767, -2766, 1, -2765, -2764, -2763, 0, -2756,
+    -2753, -2750, 0, 0, 2, 6, 0, 2, 0, -2748, 1, -2745,
+    0, 0, -2740, 0, 0, -2739, 0, 1, 0, -2737, -2735, 3,
+    1, 1, 1, -2732, 2, 3, -2730, -2728, 0, 0, -2724, -2723,
+    3, 1, -2722, 1, -2718, -2710, 7, 0, 0, 0, 0, -2709,
+    -2708, 0, -2704, 1, 0, 0, -2703, 0, -2701, 0, 2, -2700,
+    0, 1, -2694, 0, 2, -2693, 1, 2, -2691, 1, -2686, 3,
+    0, -2682, -2680, 1, 2, -2674, -2670, -2663, 0, -2660, -2654, 1,
+    -2638, 0, -2637, -2635, -2632, 0, 5, 0, -2631, 0, 1, -2626,
+    2, 0, 0, 0, 1, -2625, -2622, 0, 2, 0, 0, 0,
+    0, -2621, -2619, -2617, -2616, -2612, 0, -2609, 0, 1, 0, -2600,
+    -2596, -2593, -2591, -2586, 2, -2585, -2584, -2580, -2576, -2575, -2568, 0,
+    -2567, 0, -2565, 1, 0, 2, -2564, -2563, 0, -2561, -2558, 0,
+    0, 1, 0, -2557, 0, 0, 0, 0, -2556, 0, -2550, 0,
+    0, 0, 4, 1, -2549, -2547, -2544, 3, 2, 1, -2542, -2539,
+    -2533, -2531, 0, 2, 2, 1, 0, -2529, 1, -2528, 0, -2526,
+    2, 3, -2525, 1, -2517, 1, 0, 0, 0, 0, 0, 0,
+    -2515, 0, 0, 0, -2511, 0, 1, 1, 1, 1, 0, 1,
+    -2510, 0, -2508, 0, 0, 0, -2506, 1, -2503, -2501, 0, 0,
+    1, 0, -2499, 0, 0, 1, 1, 2, 2, -2493, 1, -2492,
+    2, 0, 0, 2, 0, 0, -2481, -2480, -2477, 0, 1, 0,
+    1, -2475, 0, -2472, -2463, 2, 0, 1, 0, 0, -2462, -2461,
+    -2457, 0, 0, -2456, -2455, -2454, 0, 0, 0, 0, 1, -2453,
+    0, -2450, 0, 0, 0, -2449, 1, 1, 0, 0, -2445, -2442,
+    -2441, 2, 3, -2438, 4, -2435, 0, 0, -2431, 0, -2427, 0,
+    0, -2421, 1, -2420, 0, -2417, 0, -2416, -2415, -2414, 1, 0,
+    0, 0, 0, -2412, 0, 1, 0, 8, -2411, 0, -2410, 0,
+    6, -2403, 0, 5, 0, 1, 0, -2400, 0, -2399, 0, 0,
+    2, -2398, 2, -2397, 1, 0, 1, -2396, 1, 1, 1, -2392,
+    0, 1, -2391, 0, -2389, 0, 2, -2387, 2, 1, -2386, -2379,
+    0, -2378, 0, 3, 0, 1, 0, 0, 2, 1, 4, -2373,
+    -2364, 0, 0, 1, 1, 1, 0, 0, -2360, 4, -2358, 0,
+    -2357, -2350, 0, 0, -2349, 0, 0, -2345, 0, 2, -2341, -2337,
+    -2336, -2335, 2, 0, 0, -2333, -2329, -2320, 1, 0, 1, -2318,
+    -2309, 3, 2, 0, -2308, -2306, -2304, 0, 2, 0, 0, 0,
+    1, 0, 3, -2303, 1, -2302, 0, -2301, 0, 0, -2298, 2,
+    4, 0, 0, -2296, -2294, -2291, 0, -2290, 2, 1, 0, 1,
+    0, 0, 1, -2287, 0, -2285, 0, -2283, -2279, 0, -2278, 1,
+    1, 0, 0, 0, 2, 0, 0, 2, -2277, -2276, -2273, 0,
+    2, 0, 2, 0, 1, -2272, 1, 2, 3, 1, -2271, 2,
+    1, -2270, -2267, 0, -2265, -2264, -2262, -2255, 0, 0, 0, -2251,
+    1, -2250, 1, -2247, -2245, -2242, -2239, 0, 0, 0, 2, 0,
+    2, -2235, 0, -2234, 0, -2232, 0, 0, -2231, 0, 0, 0,
+    0, 0, -2230, 2, 0, 1, 0, 2, -2229, 0, -2223, 0,
+    1, 0, 0, -2218, -2211, 1, 0, -2210, -2209, 1, 2, 0,
+    0, 1, 0, 2, -2207, -2203, 0, 0, -2201, 0, 0, 2,
+    0, -2200, -2197, 2, 1, 1, 1, 1, 0, 1, 0, 0,
+    5, -2195, 5, 0, 0, 0, 1, 0, 0, -2193, -2192, 0,
+    -2190, 0, 1, 3, -2189, 1, -2188, 3, 2, -2186, 1, -2179,
+    -2178, 2, -2176, -2175, 0, 1, 0, 0, 0, 1, 0, 0,
+    0, 0, -2172, -2168, 1, -2167, -2166, 0, 1, -2164, -2160, 0,
+    2, -2159, 4, 0, 0, -2158, 0, 0, -2156, -2151, 1, 0,
+    0, -2150, -2149, -2144, -2143, 0, -2142, 1, 1, -2139, 1, -2135,
+    2, 1, -2131, 3, -2124, 0, -2123, 2, -2122, 0, 1, -2121,
+    1, -2120, 0, 2, 0, -2119, 0, -2117, 0, 0, 1, 0,
+    1, -2115, 0, 0, -2110, -2108, 3, 6, -2107, 5, -2101, -2100,
+    0, 0, 0, 0, 1, -2098, -2096, -2095, 0, 0, 0, 0,
+    -2085, 0, 1, 1, -2084, 1, -2079, -2078, -2076, 1, 1, 0,
+    -2075, -2074, 1, 0, 0, 0, 0, -2068, 0, 2, 0, 2,
+    1, -2065, -2064, 0, 3, 0, -2063, 0, -2062, -2061, 0, 5,
+    -2058, 0, 0, 2, -2056, 1, -2054, -2052, 1, 1, 0, 1,
+    1, 0, -2051, 1, 2, -2049, -2048, 4, 2, -2046, 0, 1,
+    5, -2045, 0, 0, 0, 0, -2042, -2039, 4, -2034, 0, 1,
+    1, 2, -2032, 4, -2030, 8, -2027, -2025, 3, -2024, 5, -2022,
+    -2021, -2018, 0, 0, -2014, 0, -2011, 0, -2009, -2005, 0, 1,
+    1, 1, -2004, -2000, 1, 1, -1995, -1990, 4, -1989, 0, 0,
+    -1988, 0, -1986, 1, 0, 0, -1984, 1, 0, -1982, -1978, 0,
+    -1975, 0, 0, 0, 1, -1971, 1, 2, -1970, -1964, -1962, 0,
+    0, -1961, 1, -1952, 2, 1, 3, -1949, 0, 0, 3, -1948,
+    2, 0, 2, -1936, 0, 1, 0, 1, 0, 1, 0, -1930,
+    0, 0, 0, -1928, 0, 0, 1, -1926, 2, 0, 0, 0,
+    0, 1, -1923, -1918, -1917, -1913, 1, -1911, -1910, 0, 0, 0,
+    0, 0, 0, 3, -1908, 1, 1, -1906, 1, 0, -1905, -1901,
+    0, -1900, 2, -1897, -1896, 0, -1894, -1891, 1, 0, 0, -1889,
+    -1888, 0, 8, -1887, 1, 1, 3, 0, 0, 0, -1886, 1,
+    3, 0, -1882, -1881, -1880, 0, 1, 0, 0, -1879, 0, -1878,
+    -1877, 1, 2, -1874, 0, -1870, -1865, -1863, 0, -1861, -1859, 0,
+    0, -1851, 1, 0, 0, 0, 0, 1, -1850, 0, 0, 2,
+    -1849, -1844, -1841, 1, 0, 0, -1833, 0, 0, 0, -1824, 0,
+    0, -1820, 0, -1818, -1817, 1, -1815, 2, 4, 4, -1814, -1807,
+    -1802, 0, -1801, 1, 2, 1, 1, -1794, -1793, 0, 0, 1,
+    2, 4, 0, 0, 0, 0, 1, -1788, 3, 2, -1781, 1,
+    0, 1, 0, -1779, 2, 2, 0, -1774, 2, -1763, -1762, 2,
+    -1760, 1, 2, -1759, 0, 2, 1, -1758, -1755, 2, 0, 0,
+    -1752, -1750, 0, 0, 0, -1748, -1747, 1, 11, 4, 1, -1745,
+    1, 0, 3, 0, 0, -1744, -1743, -1740, 0, 0, 1, 0,
+    3, -1739, 0, -1737, 1, 0, -1735, 1, 0, -1734, 3, 0,
+    0, -1732, 6, -1729, -1727, -1726, 0, 1, -1724, -1715, 1, 0,
+    -1712, 1, 0, 0, 0, 1, 1, 0, -1711, 0, 0, 0,
+    5, 2, 4, 0, 0, -1708, 0, -1707, 0, -1706, -1705, -1703,
+    -1701, 0, 4, 0, 0, 0, 0, -1700, 0, 0, 1, 1,
+    -1688, 0, 0, -1687, -1685, 0, 0, -1683, -1682, 1, 3, -1681,
+    -1680, -1677, -1675, -1673, 4, 2, 0, 0, 0, 0, 0, 1,
+    -1671, 3, -1670, 0, 2, -1669, 1, 1, 0, 1, 0, 0,
+    -1666, 2, 0, -1665, -1662, 2, 2, 4, 2, 0, 1, -1660,
+    4, 0, 0, 1, -1658, -1656, 3, 5, -1655, 0, 0, 0,
+    -1652, -1648, -1647, -1646, -1644, -1642, 3, 0, -1641, -1638, 0, -1635,
+    0, -1634, -1633, 0, -1630, -1626, 0, 2, 0, 2, 0, 3,
+    -1624, 4, -1622, 2, 0, 0, 1, -1620, -1619, 5, -1618, -1616,
+    -1615, -1612, -1610, 2, 0, 0, 0, 2, -1607, -1605, 0, 0,
+    0, 1, 1, 0, 1, 0, 1, 0, -1604, 5, 1, -1600,
+    -1595, -1593, -1591, -1588, -1582, -1581, -1580, 4, 0, 0, -1573, 1,
+    2, 3, 1, 1, -1569, 0, 0, 2, 1, 1, 2, 0,
+    1, 0, -1567, 2, -1565, 0, 0, -1559, 0, 4, -1555, -1554,
+    0, 1, 0, 1, -1552, -1550, 0, 0, 0, 4, -1549, 5,
+    1, -1548, -1545, -1543, -1541, 1, 0, -1538, 0, -1537, -1536, -1529,
+    0, 3, 6, -1527, 2, 4, 0, -1526, -1525, 0, -1523, 5,
+    0, 0, 1, -1519, -1518, 0, -1514, 0, 2, 0, 0, 1,
+    1, 1, 3, -1510, 0, 0, 0, -1504, -1498, 0, -1497, 0,
+    0, -1494, 0, -1493, -1490, -1481, 6, 0, 2, 0, 0, 6,
+    -1479, -1478, -1475, 1, 3, 1, -1471, -1468, 0, 2, -1463, -1462,
+    -1457, 0, 0, 16, 0, 0, 5, 0, 0, 1, 0, -1455,
+    -1453, 1, 0, -1452, 0, 0, -1450, -1448, -1447, -1444, 0, 0,
+    0, 0, 0, 1, 0, -1439, 1, 0, 0, -1436, 0, -1434,
+    0, 2, -1431, 1, -1429, -1426, 0, -1425, -1422, -1419, 2, -1416,
+    0, 1, 0, 0, -1415, 0, -1414, -1412, 0, 0, 0, -1408,
+    0, 0, -1402, -1400, -1399, 0, 1, -1396, 0, 2, -1394, -1391,
+    1, -1387, 0, 1, 7, 3, -1381, 3, 0, 0, -1380, -1378,
+    -1376, 1, 0, 0, -1371, 5, -1369, 0, 5, 0, -1366, 0,
+    4, 5, 2, 0, -1365, -1359, -1357, 1, -1351, -1346, 0, -1345,
+    3, -1342, -1340, 15, 3, -1339, 3, 1, 3, 7, -1338, -1336,
+    -1333, 0, 6, 0, -1326, 0, 0, 1, 0, 0, 0, 0,
+    0, -1325, -1323, -1316, 0, 0, -1314, 2, -1310, 1, -1307, 1,
+    -1301, -1299, -1297, 2, 0, 0, 0, 0, 4, 0, -1296, 0,
+    0, -1295, -1293, -1292, 1, 1, 0, -1290, -1289, -1287, 2, 1,
+    2, 0, 0, 0, -1281, 0, 0, 4, -1277, 0, 0, 1,
+    0, 0, 0, 5, 12, 2, -1276, 0, -1269, 0, -1268, -1264,
+    3, -1262, 0, 17, 0, -1260, 0, -1257, 2, 1, 0, -1252,
+    0, 0, 0, 1, 3, -1246, 0, -1245, 0, -1244, -1240, 1,
+    3, 1, 0, 6, 0, 1, -1239, -1237, 1, 0, 0, 0,
+    2, 1, 2, -1236, -1233, -1232, -1231, 0, 0, -1221, -1220, -1219,
+    0, 0, -1214, -1212, 0, 0, -1205, -1204, 1, -1203, 0, 0,
+    5, 1, -1202, 6, 0, 0, 0, -1197, -1193, 0, -1192, -1190,
+    -1189, 1, -1185, 1, 0, 0, 3, 0, 0, -1179, -1177, 5,
+    0, -1174, -1168, 3, 3, 2, 0, 3, 0, 4, 0, 0,
+    1, -1164, -1163, 0, -1162, 1, 1, 1, -1159, -1153, -1152, -1151,
+    -1150, -1149, 0, 0, -1145, 2, -1144, 0, 0, -1142, -1130, -1126,
+    -1124, -1123, -1120, -1119, -1118, 2, 2, -1114, 0, -1111, -1109, 0,
+    8, 0, 5, 0, 0, 5, 0, 1, 0, 0, 0, -1107,
+    6, -1103, -1091, 0, 1, 1, -1090, 2, 0, -1089, -1088, -1086,
+    0, 0, 0, -1083, 0, 8, 7, -1081, -1080, 2, -1074, 2,
+    0, -1072, 0, 0, 0, -1063, 0, 4, 1, 0, -1062, 2,
+    1, 0, 0, -1060, 0, 2, 0, -1057, 3, 1, 0, 0,
+    -1056, 2, 0, 0, 0, 0, 0, 6, -1053, 0, -1050, 1,
+    2, 1, 1, 0, -1046, 0, 0, 0, 3, 3, -1045, 5,
+    0, -1042, 0, -1041, 0, 1, -1039, 0, -1037, 0, -1035, 0,
+    -1033, 1, -1032, 0, 0, 0, -1031, 1, 0, -1025, -1017, -1009,
+    0, -1006, 0, 0, 1, 0, -1005, 1, 1, 11, 0, 2,
+    0, -1004, -1002, 7, -1001, 0, -998, 0, 0, 0, 0, 0,
+    -996, -995, 0, 15, 0, -988, -987, 0, -983, 0, 9, 0,
+    -981, 1, 0, -978, 0, 0, -975, 0, -974, 0, 0, 1,
+    -972, 0, 1, 0, 0, 1, 2, 0, 3, 2, 1, 0,
+    -971, 2, 4, 2, 0, -967, 0, 0, -963, -960, 1, 0,
+    -958, 0, 1, 2, -957, -953, -952, -947, -938, 0, -936, 0,
+    0, -935, 0, -929, -924, 3, 0, 2, 5, -921, -918, 0,
+    0, 0, -916, -915, 0, -913, 4, 1, 0, -911, -896, 1,
+    0, 0, 5, 1, 0, -894, 2, 2, 1, -892, 6, 0,
+    -890, -889, 1, 3, 3, -886, -883, -880, 0, -874, 0, 0,
+    0, -872, -871, 2, 3, -869, 4, 0, 0, 1, -868, 1,
+    0, -865, 8, 5, 0, 2, 0, -863, 0, 0, -861, -860,
+    -859, 1, 11, 1, -858, 4, -857, 1, -856, 0, 4, 8,
+    -855, 6, -854, 0, -853, 0, -852, 11, 2, 2, 4, -849,
+    0, -847, 5, 0, 16, 1, 3, -845, -844, -842, -841, 0,
+    -835, 0, 0, -833, 0, -828, 0, 3, 0, -825, 2, -824,
+    2, 0, -822, -821, 4, -816, 0, -811, 1, 0, -808, 0,
+    8, 0, -807, 1, -805, 1, -798, -797, -793, 9, -790, -786,
+    6, 0, 1, -784, 0, -783, 0, 1, 0, -781, 6, 1,
+    0, 1, 0, -780, 0, 0, 0, 0, -779, 0, 8, 0,
+    6, 0, -778, 0, -776, 0, 10, -775, 0, 0, -767, 0,
+    -766, 7, -765, -761, -760, -757, 0, -755, 6, 0, 0, 1,
+    -753, 0, 3, -751, 0, 1, 5, -749, 0, 0, -747, 0,
+    -744, 0, 0, 0, 0, 5, -742, 1, -740, -737, 0, -735,
+    -733, 3, 6, -731, 0, 0, -726, 6, 0, -724, 0, -722,
+    0, -716, -714, -710, 0, 7, 0, 1, 4, -708, 0, -706,
+    0, 0, 1, 0, 0, -705, 0, -703, -702, 6, 1, 1,
+    0, -701, -699, -698, 0, 0, -697, 1, -696, -687, -683, 0,
+    3, 0, -679, -677, 0, -674, 0, 0, 0, 1, 0, 1,
+    0, -673, 0, 4, -672, 4, -670, 0, -668, -667, 0, -665,
+    4, -663, -662, 7, 0, -661, 0, 0, -657, 4, -653, 0,
+    -652, -651, -650, 0, -648, -647, -644, 0, 0, 9, 0, -642,
+    0, 0, 1, -638, -636, 4, -635, 0, 0, 0, -632, 0,
+    1, 0, 0, 0, -625, 0, -624, -619, 0, -617, -612, 10,
+    -605, 7, 0, 0, 0, -604, -601, 0, 0, -597, 0, 3,
+    6, -592, 0, -591, -590, 0, 0, 0, -586, 0, 0, 4,
+    3, 2, -585, -584, 10, -582, 2, 2, 5, 0, 0, -581,
+    -579, 4, -578, 0, 0, -577, 3, 1, -575, -574, -572, -569,
+    0, 3, 0, -567, 0, 0, -566, -564, 0, 0, 0, 0,
+    0, -563, 0, 0, -558, 5, 0, -557, -556, 0, 0, 0,
+    3, 2, 11, -545, 0, 0, 14, -544, 2, -541, 0, -540,
+    1, 0, 0, 0, 0, -539, 0, -537, 0, 0, -534, 1,
+    -532, 11, 0, 1, 0, -531, 0, -528, 0, -526, 0, 0,
+    -520, -515, 0, 0, 0, 0, 0, 4, -514, 3, -512, 16,
+    0, 10, 0, 0, -509, 0, 21, -508, 7, -505, 0, -504,
+    6, 0, 0, 1, 8, -502, -501, 0, -499, -496, 2, 0,
+    -495, 1, -484, -481, 0, 0, 1, 0, -478, 0, 1, 2,
+    -477, 0, -471, -468, 5, -467, -463, 0, 0, 4, 3, -462,
+    2, -461, 3, -457, 3, 0, 1, 0, 0, 0, -454, -453,
+    0, -452, -450, 0, -448, 2, 1, 0, 3, 0, 0, -445,
+    -444, -443, 0, 0, -442, 2, -439, -437, 6, -434, -432, -424,
+    1, 0, -422, 0, 0, -419, 0, 0, 0, 7, 0, 0,
+    -418, -413, -411, 3, 0, 0, 0, -409, 3, 2, -408, 0,
+    -405, 2, -404, 0, -403, 3, 0, 3, 4, 0, -402, -401,
+    5, 1, -396, 0, 0, -393, 1, 0, 14, 0, 2, 0,
+    -390, -386, 2, 2, -385, 0, -382, 1, 0, -381, 1, -377,
+    -376, -375, 0, 0, 1, -372, 0, -367, 3, 0, 0, 0,
+    -363, -356, -353, 5, -351, -350, -349, -346, 2, 0, -333, -332,
+    -330, -329, -328, 1, 6, 0, 0, -325, -316, -313, 0, 0,
+    -310, -308, -305, -301, 0, 9, 1, 0, -298, -294, 0, -291,
+    -290, -288, 0, 0, 0, 0, 19, 5, -284, 0, 3, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -282, 0,
+    -281, 9, 0, -277, 0, 0, 0, 2, 0, 0, -267, 2,
+    -265, -262, -258, 8, 0, 0, 0, -255, 0, 0, 0, 7,
+    0, -254, 0, 4, 4, -252, 4, -249, 0, 0, 2, 0,
+    -247, 0, 0, -245, 0, 0, 9, 1, 3, 10, 2, 0,
+    -243, -241, -237, 0, 8, 0, 9, 12, 2, 2, -235, 0,
+    -231, -228, 0, 6, 10, 3, -227, 0, -226, 0, 3, -225,
+    0, -224, -215, -211, 4, 0, 1, -210, -206, 0, 0, -199,
+    -196, -195, 0, 4, -192, -189, 3, -187, -186, 5, 16, 4,
+    -184, -177, 0, -176, 0, -172, 3, 1, 0, 1, -170, 0,
+    3, 0, -168, 0, 0, 0, 0, -166, 0, 3, 0, 0,
+    21, 2, 0, 0, -159, 0, 0, 0, 1, 0, -153, -152,
+    0, 0, 2, 0, -148, 1, 0, 0, 0, 0, -138, -137,
+    0, 0, 0, 0, -135, 1, -132, 0, 1, 0, 0, 0,
+    0, 0, -130, 0, 6, 0, 0, 0, -127, 0, 0, 4,
+    -125, 0, -121, 2, 0, 0, 0, 3, 1, 0, -119, 0,
+    2, -118, 0, -115, -113, 0, 0, -110, -104, 6, 15, 0,
+    -100, -97, 1, 2, 4, -96, 8, 0, 0, 0, 2, -95,
+    0, -89, 1, -88, 5, 0, -86, -81, 0, 0, -79, 20,
+    0, -76, 1, -73, 2, 5, -72, 13, -71, 2, 7, -70,
+    0, 5, 0, 0, 0, -62, 5, -58, -57, 0, -55, -53,
+    0, -46, 0, 0, 1, 10, 1, 0, 0, 0, 0, 0,
+    7, -45, 0, 6, -41, 0, 0, 1, -38, 0, 5, 0,
+    1, -37, 0, 1, 0, 9, 10, 1, 0, -36, 0, -35,
+    3, -34, 0, 0, 1, 0, 0, 22, 5, -32, -30, 0,
+    2, 0, 2, 0, 0, -23, -22, 4, 0, 0, -13, 2,
+    -12, 7, -11, -9, -8, 0, -7, 0, -5, 3, 4,
+};
+
+static const char* const gl_proc_names[GL_PROC_COUNT] = {
+    "glVertexAttribL1i64NV",
+    "glTransformFeedbackVaryingsEXT",
+    "glVDPAUGetSurfaceivNV",
+    "glNormalPointerListIBM",
+    "glGenFramebuffers",
+    "glMapParameterfvNV",
+    "glGetActiveUniformsiv",
+    "glCombinerStageParameterfvNV",
+    "glVertexAttrib1fARB",
+    "glIsFenceNV",
+    "glVertexAttrib4dvNV",
+    "glVertexAttribArrayObjectATI",
+    "glTexSubImage1D",
+    "glProgramParameteriEXT",
+    "glGetnColorTable",
+    "glVertexAttrib3fv",
+    "glGetTexImage",
+    "glTextureStorage2D",
+    "glPassThrough",
+    "glGetQueryObjecti64vEXT",
+    "glSecondaryColorPointerListIBM",
+    "glGetClipPlane",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+    "glMultTransposeMatrixd",
+    "glCopyColorTableSGI",
+    "glVertexAttrib4fNV",
+    "glGetVertexAttribPointervARB",
+    "glDrawRangeElementsEXT",
+    "glRectiv",
+    "glCompressedTextureImage2DEXT",
+    "glClearAccumxOES",
+    "glVertexAttrib3svNV",
+    "glGetProgramResourceIndex",
+    "glSecondaryColor3sv",
+    "glEdgeFlagv",
+    "glTexCoord1iv",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+    "glImportMemoryWin32HandleEXT",
+    "glWindowPos2i",
+    "glBindImageTexture",
+    "glVertexAttribs1hvNV",
+    "glVertexAttrib4NusvARB",
+    "glMemoryBarrier",
+    "glMultiTexCoord2f",
+    "glTexImage4DSGIS",
+    "glGetIntegerui64vNV",
+    "glFeedbackBuffer",
+    "glReplacementCodeusSUN",
+    "glFramebufferRenderbufferEXT",
+    "glStopInstrumentsSGIX",
+    "glGetGraphicsResetStatusARB",
+    "glProgramEnvParameter4fARB",
+    "glCopyTexImage1D",
+    "glBindTextures",
+    "glGetActiveUniformARB",
+    "glVertex2hvNV",
+    "glSecondaryColor3ubvEXT",
+    "glTexRenderbufferNV",
+    "glVertexAttribL1dv",
+    "glMultiTexCoord1bvOES",
+    "glTexImage1D",
+    "glGetMemoryObjectParameterivEXT",
+    "glVertexAttribs4svNV",
+    "glVertexAttrib4sv",
+    "glGetHistogram",
+    "glValidateProgram",
+    "glGetPathSpacingNV",
+    "glTransformFeedbackVaryingsNV",
+    "glVertexArrayAttribBinding",
+    "glProgramUniform4ui64vARB",
+    "glEnableClientState",
+    "glMultiDrawElementArrayAPPLE",
+    "glRasterPos4sv",
+    "glVertexAttrib1dvARB",
+    "glDepthRangef",
+    "glMultiDrawArraysEXT",
+    "glTangent3sEXT",
+    "glGetColorTable",
+    "glGetVertexArrayIntegeri_vEXT",
+    "glPathParameterfNV",
+    "glGetActiveSubroutineUniformName",
+    "glCreateVertexArrays",
+    "glCopyColorSubTableEXT",
+    "glTexParameterIivEXT",
+    "glStencilFuncSeparateATI",
+    "glRasterPos3dv",
+    "glTexSubImage2D",
+    "glColorFormatNV",
+    "glProgramUniformHandleui64ARB",
+    "glGetImageHandleNV",
+    "glBeginConditionalRenderNV",
+    "glRasterPos4fv",
+    "glGetFragDataIndex",
+    "glShaderOp3EXT",
+    "glDeleteFramebuffersEXT",
+    "glDrawElementsBaseVertex",
+    "glNamedBufferStorageExternalEXT",
+    "glFrontFace",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glTexParameterIuivEXT",
+    "glVertexAttribs2hvNV",
+    "glCreateProgressFenceNVX",
+    "glProgramUniformMatrix4x3fv",
+    "glVertexAttrib3sNV",
+    "glCreateProgramPipelines",
+    "glGetLightxOES",
+    "glTexCoord2xvOES",
+    "glRasterPos2f",
+    "glNormalPointervINTEL",
+    "glRasterPos2s",
+    "glTexEnvi",
+    "glDeleteRenderbuffers",
+    "glGetUniformSubroutineuiv",
+    "glVertexAttrib3sARB",
+    "glGetPerfMonitorCounterInfoAMD",
+    "glGetQueryObjectuiv",
+    "glExecuteProgramNV",
+    "glMultiDrawElementsIndirectCount",
+    "glUniform3d",
+    "glListParameterfSGIX",
+    "glInvalidateTexImage",
+    "glClientActiveTexture",
+    "glListDrawCommandsStatesClientNV",
+    "glBinormal3ivEXT",
+    "glTexCoord4d",
+    "glPrimitiveRestartIndex",
+    "glRotatexOES",
+    "glVertexAttribs3hvNV",
+    "glGenFencesNV",
+    "glGetFramebufferParameteriv",
+    "glSamplePatternSGIS",
+    "glLoadTransposeMatrixd",
+    "glVertexAttribI4uiEXT",
+    "glFramebufferTextureLayerEXT",
+    "glIndexub",
+    "glTexCoord2bvOES",
+    "glBindBufferRangeNV",
+    "glVertexAttribP3uiv",
+    "glTangent3fEXT",
+    "glWindowPos2f",
+    "glColor4fv",
+    "glStencilOpValueAMD",
+    "glLoadProgramNV",
+    "glGetFloati_vEXT",
+    "glShadingRateImageBarrierNV",
+    "glProgramUniform3ui64vNV",
+    "glWindowPos2iMESA",
+    "glTexCoord3fv",
+    "glGetMultiTexGenivEXT",
+    "glGetQueryBufferObjecti64v",
+    "glVertexAttribI1uiv",
+    "glProgramEnvParameter4fvARB",
+    "glVertexAttribL3ui64vNV",
+    "glClipPlanexOES",
+    "glGetShaderInfoLog",
+    "glAttachObjectARB",
+    "glColor4hNV",
+    "glMatrixScaledEXT",
+    "glNamedFramebufferSampleLocationsfvNV",
+    "glColorP4ui",
+    "glScissorExclusiveArrayvNV",
+    "glClearBufferuiv",
+    "glVertex4i",
+    "glCompressedTextureImage3DEXT",
+    "glUniform4uiv",
+    "glGetProgramResourceLocationIndex",
+    "glGetTextureParameteriv",
+    "glDeleteTransformFeedbacksNV",
+    "glGetVertexAttribfvARB",
+    "glVDPAURegisterOutputSurfaceNV",
+    "glMatrixMultTransposefEXT",
+    "glPushMatrix",
+    "glMultiTexCoord4fvARB",
+    "glDeleteProgram",
+    "glAreTexturesResident",
+    "glBufferAttachMemoryNV",
+    "glCreateProgramObjectARB",
+    "glGetPathColorGenivNV",
+    "glWindowPos3fvARB",
+    "glInsertComponentEXT",
+    "glVertexAttrib2hvNV",
+    "glColorTableSGI",
+    "glGetUniformui64vNV",
+    "glProgramUniformMatrix4x3dv",
+    "glProgramUniformMatrix4x2dvEXT",
+    "glTexSubImage3DEXT",
+    "glEvalCoord1d",
+    "glGetInternalformatSampleivNV",
+    "glSharpenTexFuncSGIS",
+    "glGetLightiv",
+    "glBinormal3fvEXT",
+    "glCreateFramebuffers",
+    "glDepthRangefOES",
+    "glVertexAttrib4NsvARB",
+    "glResetMinmax",
+    "glDepthFunc",
+    "glShaderSource",
+    "glBinormal3sEXT",
+    "glVertexAttrib2sv",
+    "glIsList",
+    "glGetAttribLocation",
+    "glWindowPos3i",
+    "glUniform4ui64ARB",
+    "glProgramUniform4uiEXT",
+    "glLabelObjectEXT",
+    "glTexCoord3s",
+    "glReadPixels",
+    "glHintPGI",
+    "glGetUniformLocation",
+    "glGetPixelMapxv",
+    "glNamedStringARB",
+    "glTexCoord4s",
+    "glGetTrackMatrixivNV",
+    "glProvokingVertex",
+    "glSpriteParameterfSGIX",
+    "glTexGenf",
+    "glWindowPos3sMESA",
+    "glVertex2xOES",
+    "glPathDashArrayNV",
+    "glClearColorIiEXT",
+    "glProgramUniform3ui64vARB",
+    "glGetActiveAtomicCounterBufferiv",
+    "glVertexAttrib3fvARB",
+    "glVertexAttribI2i",
+    "glGetProgramEnvParameterdvARB",
+    "glVertexAttribL1ui64ARB",
+    "glGetPathTexGenfvNV",
+    "glViewport",
+    "glColor3us",
+    "glDrawRangeElementArrayATI",
+    "glConvolutionFilter2D",
+    "glPollInstrumentsSGIX",
+    "glSecondaryColor3usv",
+    "glColor4fNormal3fVertex3fSUN",
+    "glVertexStream2sATI",
+    "glDrawArraysEXT",
+    "glColorSubTableEXT",
+    "glSecondaryColor3bv",
+    "glEndTransformFeedbackNV",
+    "glBindBufferRangeEXT",
+    "glPushGroupMarkerEXT",
+    "glNamedRenderbufferStorageMultisample",
+    "glSamplerParameterf",
+    "glTexCoordP3uiv",
+    "glMultiTexCoord4ivARB",
+    "glConvolutionFilter2DEXT",
+    "glGetConvolutionFilter",
+    "glGetProgramLocalParameterIivNV",
+    "glUniform3uiv",
+    "glVertexAttrib3fvNV",
+    "glColor3fVertex3fSUN",
+    "glColorMaterial",
+    "glIsRenderbuffer",
+    "glColor4ub",
+    "glDepthRangexOES",
+    "glDeleteTextures",
+    "glCompressedMultiTexSubImage2DEXT",
+    "glPrimitiveRestartNV",
+    "glUniform1uiv",
+    "glNamedProgramLocalParameter4fvEXT",
+    "glGetVertexAttribIuivEXT",
+    "glAsyncCopyBufferSubDataNVX",
+    "glPathColorGenNV",
+    "glGetTextureParameterfvEXT",
+    "glVertexAttribI4bvEXT",
+    "glVertex3sv",
+    "glGetnPolygonStippleARB",
+    "glProgramUniform1fvEXT",
+    "glStencilOpSeparate",
+    "glGetSynciv",
+    "glCheckNamedFramebufferStatusEXT",
+    "glUniform2i64NV",
+    "glVertexAttrib4sNV",
+    "glUniform3fv",
+    "glProgramUniform3f",
+    "glUniform3uivEXT",
+    "glDeleteQueriesARB",
+    "glMultiTexCoord4svARB",
+    "glReplacementCodeuiNormal3fVertex3fSUN",
+    "glProgramUniformHandleui64vNV",
+    "glGetDoublev",
+    "glTexCoord1xOES",
+    "glMultiTexCoord1sv",
+    "glLogicOp",
+    "glVertexAttrib1s",
+    "glLinkProgram",
+    "glIndexxOES",
+    "glProgramUniformMatrix3fvEXT",
+    "glIsSync",
+    "glTexEnviv",
+    "glUniformMatrix3fv",
+    "glVertexAttrib2fvNV",
+    "glPushClientAttribDefaultEXT",
+    "glGetVariantPointervEXT",
+    "glPolygonMode",
+    "glMultiTexCoord3s",
+    "glMatrixScalefEXT",
+    "glProgramEnvParametersI4ivNV",
+    "glGetnTexImageARB",
+    "glVertexAttrib1svNV",
+    "glProgramUniformMatrix4x3dvEXT",
+    "glVertexArrayVertexBuffer",
+    "glStencilFuncSeparate",
+    "glMapNamedBufferRange",
+    "glAccumxOES",
+    "glMultiTexCoordP4uiv",
+    "glMatrixMultTransposedEXT",
+    "glBeginQueryIndexed",
+    "glVertexP3ui",
+    "glTexCoord3iv",
+    "glVertexStream3dATI",
+    "glMultiTexCoord4dARB",
+    "glCheckNamedFramebufferStatus",
+    "glCompressedTexImage3DARB",
+    "glMapVertexAttrib1fAPPLE",
+    "glGetColorTableParameterfvEXT",
+    "glIsOcclusionQueryNV",
+    "glVertexAttrib3hvNV",
+    "glSetMultisamplefvAMD",
+    "glResolveDepthValuesNV",
+    "glMultiDrawMeshTasksIndirectCountNV",
+    "glVertexAttrib4Nsv",
+    "glCompressedMultiTexImage3DEXT",
+    "glIsBufferResidentNV",
+    "glMultiTexCoord2bvOES",
+    "glTexCoord1s",
+    "glTexCoord2bOES",
+    "glGetQueryivARB",
+    "glVertexAttribL2ui64NV",
+    "glVertexAttrib2hNV",
+    "glMulticastScissorArrayvNVX",
+    "glVDPAURegisterVideoSurfaceWithPictureStructureNV",
+    "glProgramUniform4i64vARB",
+    "glMultiTexCoord3iv",
+    "glFramebufferTextureEXT",
+    "glUniform1uiEXT",
+    "glImportMemoryWin32NameEXT",
+    "glClearColor",
+    "glGenProgramsNV",
+    "glTexSubImage1DEXT",
+    "glUniform4d",
+    "glCopyMultiTexSubImage2DEXT",
+    "glGenBuffers",
+    "glClientActiveTextureARB",
+    "glVertexAttrib4s",
+    "glTexGendv",
+    "glDrawElementArrayATI",
+    "glColor3fVertex3fvSUN",
+    "glUniformMatrix2x3dv",
+    "glResetHistogram",
+    "glProgramParameters4fvNV",
+    "glEndList",
+    "glTexCoord1hNV",
+    "glFragmentColorMaterialSGIX",
+    "glClearBufferfv",
+    "glColor4xvOES",
+    "glEndQuery",
+    "glVertexAttribL3d",
+    "glBufferPageCommitmentARB",
+    "glVariantubvEXT",
+    "glScissor",
+    "glGetnPixelMapusvARB",
+    "glImageTransformParameterfHP",
+    "glProgramUniformMatrix2dv",
+    "glVertexAttribs4dvNV",
+    "glCompressedTexSubImage3D",
+    "glGetGraphicsResetStatus",
+    "glWindowPos2dv",
+    "glVertex3bOES",
+    "glMatrixRotatefEXT",
+    "glMultiTexCoord4sARB",
+    "glColorTableEXT",
+    "glVertexAttribI4usvEXT",
+    "glVertexAttrib4Niv",
+    "glGetProgramParameterfvNV",
+    "glMultiTexCoord3f",
+    "glProgramUniform4ui64NV",
+    "glEvalCoord1f",
+    "glProgramUniform3fv",
+    "glProgramSubroutineParametersuivNV",
+    "glUniform1fvARB",
+    "glCommandListSegmentsNV",
+    "glReplacementCodeubSUN",
+    "glEnableIndexedEXT",
+    "glProgramUniformui64NV",
+    "glVertexAttrib3dvARB",
+    "glBlitFramebufferEXT",
+    "glUniform3ui64vARB",
+    "glReplacementCodeuiVertex3fvSUN",
+    "glUniformMatrix3x2dv",
+    "glWindowPos3svMESA",
+    "glNamedProgramLocalParameterI4iEXT",
+    "glWindowPos2sARB",
+    "glCreateQueries",
+    "glGetVertexAttribLdvEXT",
+    "glVertexP3uiv",
+    "glDrawArraysIndirect",
+    "glDebugMessageCallbackARB",
+    "glPopMatrix",
+    "glGetHandleARB",
+    "glDeleteNamedStringARB",
+    "glEvalCoord1xOES",
+    "glProvokingVertexEXT",
+    "glMultiTexCoord1dARB",
+    "glGetListParameterfvSGIX",
+    "glDrawElementsInstanced",
+    "glColorFragmentOp1ATI",
+    "glVariantbvEXT",
+    "glVertexAttribI2uiv",
+    "glPixelMapusv",
+    "glBindVertexBuffer",
+    "glWeightPathsNV",
+    "glEndVertexShaderEXT",
+    "glSpecializeShaderARB",
+    "glDepthRangedNV",
+    "glPixelTransferf",
+    "glBindAttribLocationARB",
+    "glGetnUniformfv",
+    "glMultiTexCoord4xvOES",
+    "glShaderOp2EXT",
+    "glVertexAttribI2ui",
+    "glCopyBufferSubData",
+    "glWindowPos3sv",
+    "glTexEnvf",
+    "glVertexAttrib3fNV",
+    "glGetPerfMonitorGroupsAMD",
+    "glIsMemoryObjectEXT",
+    "glBindMaterialParameterEXT",
+    "glColor4iv",
+    "glGetPathCoordsNV",
+    "glRasterPos4dv",
+    "glGetIntegerui64i_vNV",
+    "glPrioritizeTextures",
+    "glVertexAttribI3uiv",
+    "glVertexStream2fvATI",
+    "glTrackMatrixNV",
+    "glGetnMapfv",
+    "glMakeNamedBufferNonResidentNV",
+    "glPixelTexGenSGIX",
+    "glVertex4bOES",
+    "glGetQueryObjectiv",
+    "glProgramUniform2f",
+    "glIndexPointer",
+    "glGetInvariantFloatvEXT",
+    "glGetMapxvOES",
+    "glDeleteShader",
+    "glBlendEquationSeparateATI",
+    "glClearIndex",
+    "glMultiTexParameteriEXT",
+    "glGetBufferSubDataARB",
+    "glDeleteAsyncMarkersSGIX",
+    "glUniform1fv",
+    "glGetSamplerParameteriv",
+    "glFlushPixelDataRangeNV",
+    "glMultiTexCoord1svARB",
+    "glProgramUniformMatrix3x4dv",
+    "glGetVertexAttribdvNV",
+    "glGetBufferParameterui64vNV",
+    "glVertexAttribP1uiv",
+    "glTexCoord2sv",
+    "glMultiTexCoordP1uiv",
+    "glQueryObjectParameteruiAMD",
+    "glProgramEnvParameterI4uiNV",
+    "glDrawCommandsAddressNV",
+    "glMultiDrawElementsIndirectBindlessNV",
+    "glReferencePlaneSGIX",
+    "glBeginFragmentShaderATI",
+    "glGetMultiTexParameterfvEXT",
+    "glProgramParameter4fvNV",
+    "glCopyConvolutionFilter1D",
+    "glGetTransformFeedbackiv",
+    "glCreateTransformFeedbacks",
+    "glMapBuffer",
+    "glVertexStream1ivATI",
+    "glGetMultiTexGendvEXT",
+    "glGetnUniformdv",
+    "glWindowPos4dMESA",
+    "glGlobalAlphaFactordSUN",
+    "glTextureLightEXT",
+    "glNormalStream3bATI",
+    "glVertex2i",
+    "glLoadTransposeMatrixdARB",
+    "glDeleteSync",
+    "glRectf",
+    "glClampColor",
+    "glVertexWeighthNV",
+    "glTexCoord2fNormal3fVertex3fvSUN",
+    "glIsBuffer",
+    "glVertexArrayVertexAttribDivisorEXT",
+    "glGetQueryObjectui64vEXT",
+    "glVertexAttrib4dv",
+    "glNewObjectBufferATI",
+    "glMultiTexParameterivEXT",
+    "glGetUniformui64vARB",
+    "glMultiDrawArraysIndirect",
+    "glProgramUniform2ui64ARB",
+    "glSecondaryColor3d",
+    "glGetPerfMonitorCountersAMD",
+    "glDepthBoundsEXT",
+    "glWindowPos3d",
+    "glGetFragmentMaterialivSGIX",
+    "glFeedbackBufferxOES",
+    "glProgramUniform2i",
+    "glMapBufferARB",
+    "glVertexWeighthvNV",
+    "glCopyConvolutionFilter2DEXT",
+    "glInstrumentsBufferSGIX",
+    "glGetVertexAttribArrayObjectivATI",
+    "glVertexArrayElementBuffer",
+    "glGenFramebuffersEXT",
+    "glColor4b",
+    "glMultiTexCoord1d",
+    "glSecondaryColorP3ui",
+    "glGetPathMetricsNV",
+    "glGetTexGenfv",
+    "glGenerateMipmapEXT",
+    "glDrawTransformFeedbackStream",
+    "glColorP4uiv",
+    "glVertexAttrib4iv",
+    "glVertexStream3fATI",
+    "glListParameteriSGIX",
+    "glTexCoord4i",
+    "glCreateSamplers",
+    "glMultiTexCoord1fvARB",
+    "glSeparableFilter2DEXT",
+    "glBlendFuncSeparateIndexedAMD",
+    "glRenderbufferStorageMultisampleEXT",
+    "glDispatchCompute",
+    "glBindProgramARB",
+    "glGetTextureImageEXT",
+    "glMatrixMultfEXT",
+    "glEndConditionalRenderNVX",
+    "glProgramUniform4f",
+    "glUniformMatrix4fv",
+    "glResumeTransformFeedback",
+    "glProgramUniformMatrix2x4fv",
+    "glFramebufferTexture",
+    "glFlush",
+    "glSecondaryColor3usvEXT",
+    "glGetObjectParameterivAPPLE",
+    "glUniform3i64vNV",
+    "glCreateBuffers",
+    "glGetColorTableEXT",
+    "glIndexMask",
+    "glColor4hvNV",
+    "glFinishFenceNV",
+    "glTexGenfv",
+    "glGetTextureSamplerHandleNV",
+    "glFogCoordhvNV",
+    "glDeleteQueryResourceTagNV",
+    "glVertexAttribLPointerEXT",
+    "glColor3xvOES",
+    "glMemoryObjectParameterivEXT",
+    "glGetCompressedTextureImageEXT",
+    "glPolygonOffsetxOES",
+    "glNormalPointer",
+    "glVertexAttribI4ivEXT",
+    "glMultiTexCoord2fARB",
+    "glGetFragDataLocation",
+    "glVertexArrayRangeAPPLE",
+    "glImportSyncEXT",
+    "glUniform3iv",
+    "glAccum",
+    "glEnableVertexAttribArrayARB",
+    "glGetTextureSubImage",
+    "glTessellationFactorAMD",
+    "glGetMinmax",
+    "glUniform4dv",
+    "glPathGlyphsNV",
+    "glGetTexGendv",
+    "glProgramUniform2iEXT",
+    "glVertexAttrib1dv",
+    "glScissorArrayv",
+    "glColor3sv",
+    "glTexCoord1dv",
+    "glGetVariantArrayObjectfvATI",
+    "glVertexAttribI4ubvEXT",
+    "glTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glConvolutionFilter1DEXT",
+    "glMultiTexGendEXT",
+    "glVertexAttribI3i",
+    "glVertexAttribIPointer",
+    "glGetProgramResourcefvNV",
+    "glGetMapdv",
+    "glProgramUniform3ui64NV",
+    "glUniform2f",
+    "glCopyTextureSubImage3DEXT",
+    "glGetFragDataLocationEXT",
+    "glPolygonOffsetClamp",
+    "glGetVertexAttribivNV",
+    "glNamedBufferSubDataEXT",
+    "glMultiTexCoord4hNV",
+    "glLinkProgramARB",
+    "glTexCoordPointerEXT",
+    "glVertexAttrib3dv",
+    "glGetCoverageModulationTableNV",
+    "glVertexAttribs4ubvNV",
+    "glVertexAttrib4Nuiv",
+    "glUniform3ui",
+    "glBindBufferBaseNV",
+    "glVertexAttribL4i64vNV",
+    "glWindowRectanglesEXT",
+    "glVertexAttribI1uiEXT",
+    "glVertexAttrib1hvNV",
+    "glVertexAttrib3fARB",
+    "glUnmapObjectBufferATI",
+    "glShadingRateImagePaletteNV",
+    "glGetInternalformativ",
+    "glBlendColorEXT",
+    "glTexSubImage4DSGIS",
+    "glMakeImageHandleNonResidentARB",
+    "glTexCoord4fVertex4fvSUN",
+    "glCreateShaderProgramv",
+    "glPresentFrameDualFillNV",
+    "glCopyTextureSubImage2DEXT",
+    "glGetNamedRenderbufferParameterivEXT",
+    "glColorPointer",
+    "glGetCompressedTexImage",
+    "glUniformMatrix3dv",
+    "glProgramUniform3i64NV",
+    "glReplacementCodeuiColor3fVertex3fvSUN",
+    "glNormalStream3fATI",
+    "glBindTexGenParameterEXT",
+    "glTextureBarrier",
+    "glVertexAttrib1sv",
+    "glStencilThenCoverStrokePathNV",
+    "glProgramLocalParameter4fARB",
+    "glSecondaryColor3dv",
+    "glBufferStorage",
+    "glGlobalAlphaFactorsSUN",
+    "glFogFuncSGIS",
+    "glTangent3bvEXT",
+    "glGetVideoCaptureStreamivNV",
+    "glGetDebugMessageLogARB",
+    "glVertexStream1iATI",
+    "glWindowPos4svMESA",
+    "glMaterialxvOES",
+    "glTexCoord4fVertex4fSUN",
+    "glIsFramebuffer",
+    "glCreatePerfQueryINTEL",
+    "glSecondaryColor3usEXT",
+    "glGetUniformfv",
+    "glTexCoord4hNV",
+    "glGetActiveUniformName",
+    "glVertex2d",
+    "glFlushVertexArrayRangeNV",
+    "glCompressedTexImage3D",
+    "glMultiTexGenfvEXT",
+    "glMultiTexCoord3svARB",
+    "glMultiTexCoord3fv",
+    "glProgramUniform3i64ARB",
+    "glGetNamedBufferParameterivEXT",
+    "glGetConvolutionParameterivEXT",
+    "glBlendFuncIndexedAMD",
+    "glColor3usv",
+    "glColor3uiv",
+    "glVertexAttribI3iEXT",
+    "glVertexAttrib4ubv",
+    "glGetNamedBufferPointerv",
+    "glTextureNormalEXT",
+    "glCompressedTextureSubImage2D",
+    "glVertexAttrib4hvNV",
+    "glMultiTexCoord3fARB",
+    "glDebugMessageInsertAMD",
+    "glClearDepthf",
+    "glGetConvolutionFilterEXT",
+    "glGetBufferPointerv",
+    "glNormal3hNV",
+    "glNamedFramebufferParameteri",
+    "glPushDebugGroup",
+    "glGetUniformfvARB",
+    "glGetVertexAttribPointerv",
+    "glProgramVertexLimitNV",
+    "glSecondaryColorPointerEXT",
+    "glTexCoord3i",
+    "glMultiTexCoord1ivARB",
+    "glGetActiveAttrib",
+    "glProgramParameteriARB",
+    "glBlendEquationSeparateIndexedAMD",
+    "glOrtho",
+    "glGetMultisamplefvNV",
+    "glGenVertexArraysAPPLE",
+    "glNamedProgramStringEXT",
+    "glGetVideoCaptureStreamfvNV",
+    "glEvalMesh2",
+    "glGetLightfv",
+    "glColor3fv",
+    "glVertexAttribL2i64NV",
+    "glProgramUniformMatrix3x2fv",
+    "glMulticastCopyImageSubDataNV",
+    "glBindFramebuffer",
+    "glObjectLabel",
+    "glTexGenxvOES",
+    "glViewportArrayv",
+    "glTexAttachMemoryNV",
+    "glResetMinmaxEXT",
+    "glVertexArraySecondaryColorOffsetEXT",
+    "glMultiTexCoord3xvOES",
+    "glRasterPos2sv",
+    "glProgramEnvParameterI4ivNV",
+    "glVertexAttribs4fvNV",
+    "glDisableVertexAttribArrayARB",
+    "glBlendFuncSeparate",
+    "glTexGenxOES",
+    "glVertex3dv",
+    "glProgramUniformMatrix2x3dvEXT",
+    "glEGLImageTargetTextureStorageEXT",
+    "glGetSamplerParameterIuiv",
+    "glPointParameterfv",
+    "glUniform1dv",
+    "glBlendFunciARB",
+    "glVertex3d",
+    "glVertexAttrib1dvNV",
+    "glLoadName",
+    "glIsStateNV",
+    "glUniform1iv",
+    "glTexCoord1d",
+    "glDeleteProgramsARB",
+    "glGetUniformdv",
+    "glProgramUniform1fEXT",
+    "glVertexAttribL2d",
+    "glGetFramebufferAttachmentParameterivEXT",
+    "glWindowPos2iv",
+    "glIsVariantEnabledEXT",
+    "glBeginVertexShaderEXT",
+    "glTextureImage1DEXT",
+    "glGetBufferPointervARB",
+    "glMapNamedBuffer",
+    "glGetFirstPerfQueryIdINTEL",
+    "glMinmax",
+    "glTexCoordPointerListIBM",
+    "glUniform4i",
+    "glTextureImage3DMultisampleNV",
+    "glPathSubCoordsNV",
+    "glVertexAttrib4Nbv",
+    "glEdgeFlagPointerEXT",
+    "glVertexP2ui",
+    "glRenderbufferStorageEXT",
+    "glClearNamedFramebufferuiv",
+    "glAlphaFragmentOp3ATI",
+    "glSecondaryColor3us",
+    "glCallCommandListNV",
+    "glFogCoordFormatNV",
+    "glDeleteFencesAPPLE",
+    "glGetInfoLogARB",
+    "glDisablei",
+    "glProgramUniform2i64vARB",
+    "glArrayElement",
+    "glClearNamedBufferDataEXT",
+    "glProgramUniform2ui",
+    "glUniform2ui64vNV",
+    "glWindowPos3dvARB",
+    "glGetHistogramParameteriv",
+    "glGetBufferSubData",
+    "glTextureParameteriv",
+    "glGetCompressedTexImageARB",
+    "glMultiTexCoord2iARB",
+    "glGenSamplers",
+    "glMinSampleShadingARB",
+    "glColor4f",
+    "glGetUniformuiv",
+    "glGetTextureImage",
+    "glUniform2fv",
+    "glMakeBufferNonResidentNV",
+    "glGetTransformFeedbacki_v",
+    "glGetCommandHeaderNV",
+    "glGetTextureLevelParameterfv",
+    "glFramebufferTexture2D",
+    "glVertexAttrib4usvARB",
+    "glWindowPos3dvMESA",
+    "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+    "glCopyMultiTexSubImage3DEXT",
+    "glGetTexFilterFuncSGIS",
+    "glVertexAttrib3f",
+    "glBufferSubData",
+    "glTexCoord4dv",
+    "glFogCoordPointer",
+    "glWindowPos2s",
+    "glGetPixelTransformParameterivEXT",
+    "glClear",
+    "glGetCombinerOutputParameterivNV",
+    "glClearDepthfOES",
+    "glSecondaryColor3svEXT",
+    "glSampleMaskSGIS",
+    "glMap1d",
+    "glPixelStorex",
+    "glSpriteParameterivSGIX",
+    "glCoverageModulationNV",
+    "glNormal3hvNV",
+    "glEdgeFlagFormatNV",
+    "glClearBufferiv",
+    "glInvalidateSubFramebuffer",
+    "glProgramUniform1i64NV",
+    "glGenFragmentShadersATI",
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glUniform1fARB",
+    "glProgramUniform1i",
+    "glGetQueryBufferObjectiv",
+    "glGetTextureHandleNV",
+    "glCreateShaderObjectARB",
+    "glVertex2fv",
+    "glGetListParameterivSGIX",
+    "glFramebufferParameteri",
+    "glUniform4ui64vNV",
+    "glPointAlongPathNV",
+    "glGetnSeparableFilterARB",
+    "glNormal3s",
+    "glVertexArrayEdgeFlagOffsetEXT",
+    "glSpriteParameteriSGIX",
+    "glProgramUniform3dvEXT",
+    "glFogCoorddv",
+    "glProgramUniform1ui64vARB",
+    "glGetMultiTexImageEXT",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glMultiDrawElements",
+    "glShadingRateSampleOrderCustomNV",
+    "glColor4ui",
+    "glCompressedTextureSubImage1DEXT",
+    "glProgramUniform1uiv",
+    "glStencilOpSeparateATI",
+    "glProgramUniform1fv",
+    "glTextureParameterIiv",
+    "glUniform4i64vARB",
+    "glIsObjectBufferATI",
+    "glVertexArrayParameteriAPPLE",
+    "glProgramUniform4fv",
+    "glDeletePathsNV",
+    "glGetActiveUniformBlockiv",
+    "glVertexAttribI2iEXT",
+    "glGetTexParameteriv",
+    "glGetTextureLevelParameterivEXT",
+    "glIsImageHandleResidentARB",
+    "glVertexAttrib2dNV",
+    "glProgramUniform2uiEXT",
+    "glFenceSync",
+    "glNormalStream3dvATI",
+    "glPathCoverDepthFuncNV",
+    "glGetMaterialxOES",
+    "glTextureStorageMem2DMultisampleEXT",
+    "glTexCoordP4uiv",
+    "glDeleteProgramPipelines",
+    "glEvalMesh1",
+    "glWeightPointerARB",
+    "glIsVertexArray",
+    "glTexCoord4f",
+    "glBindTextureUnitParameterEXT",
+    "glNamedBufferStorage",
+    "glTexCoord3xvOES",
+    "glGetnPixelMapuivARB",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glVertexArrayFogCoordOffsetEXT",
+    "glNormal3fVertex3fSUN",
+    "glShadingRateSampleOrderNV",
+    "glRasterPos2xvOES",
+    "glTextureAttachMemoryNV",
+    "glMultiTexCoord4s",
+    "glMultiTexCoord1i",
+    "glEGLImageTargetTexture2DOES",
+    "glNormalPointerEXT",
+    "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+    "glColor3i",
+    "glIsEnabledi",
+    "glMultiTexRenderbufferEXT",
+    "glGetString",
+    "glColor4sv",
+    "glRectdv",
+    "glProgramUniform1i64vARB",
+    "glProgramParameteri",
+    "glBindTexture",
+    "glWindowPos3fv",
+    "glVertexAttrib2svARB",
+    "glNewList",
+    "glMultiTexEnvivEXT",
+    "glVertexStream4sATI",
+    "glGenTransformFeedbacksNV",
+    "glGetMapAttribParameterfvNV",
+    "glGetTextureParameterivEXT",
+    "glReadnPixels",
+    "glUniform1i64vNV",
+    "glCombinerParameterfvNV",
+    "glPointParameteriv",
+    "glGetSeparableFilter",
+    "glTexCoordP2ui",
+    "glRasterPos2dv",
+    "glVertexP4uiv",
+    "glLoadTransposeMatrixfARB",
+    "glProgramLocalParameter4fvARB",
+    "glTexCoord4xvOES",
+    "glMatrixPopEXT",
+    "glVertexAttribI2uiEXT",
+    "glCopyTextureImage2DEXT",
+    "glDrawElementArrayAPPLE",
+    "glGetProgramEnvParameterIivNV",
+    "glTexCoord4bvOES",
+    "glPixelTexGenParameteriSGIS",
+    "glGenProgramPipelines",
+    "glProgramUniformMatrix2x3fv",
+    "glVertexAttrib4Nub",
+    "glGetFramebufferParameterivMESA",
+    "glPathStencilFuncNV",
+    "glTexCoord2xOES",
+    "glVertexAttrib4Nubv",
+    "glInvalidateBufferData",
+    "glTextureParameterIuiv",
+    "glMakeImageHandleNonResidentNV",
+    "glVertexAttribLFormat",
+    "glViewportPositionWScaleNV",
+    "glFragmentLightiSGIX",
+    "glRenderGpuMaskNV",
+    "glVariantuivEXT",
+    "glNamedFramebufferTextureEXT",
+    "glTextureImage2DMultisampleCoverageNV",
+    "glCopyTexSubImage3D",
+    "glMulticastGetQueryObjecti64vNV",
+    "glMap1xOES",
+    "glNormal3bv",
+    "glColorFragmentOp3ATI",
+    "glGetClipPlanexOES",
+    "glVertexAttrib1fvNV",
+    "glIsEnabledIndexedEXT",
+    "glProgramUniform1i64vNV",
+    "glTextureStorageMem2DEXT",
+    "glCopyTextureImage1DEXT",
+    "glGetVariantBooleanvEXT",
+    "glBlendEquationEXT",
+    "glIsProgramARB",
+    "glBlendFuncSeparateEXT",
+    "glGetProgramStageiv",
+    "glConvolutionFilter1D",
+    "glGetCombinerOutputParameterfvNV",
+    "glPopClientAttrib",
+    "glWaitSemaphoreEXT",
+    "glEnable",
+    "glUniform3i",
+    "glFrustumxOES",
+    "glMultiTexEnvfEXT",
+    "glEvalCoord2xvOES",
+    "glProgramUniform3uiEXT",
+    "glHistogram",
+    "glFinishObjectAPPLE",
+    "glProgramUniform4i64NV",
+    "glNormalStream3fvATI",
+    "glGetBufferParameteriv",
+    "glNamedProgramLocalParameter4dEXT",
+    "glMultiTexCoord2d",
+    "glFogCoorddvEXT",
+    "glAcquireKeyedMutexWin32EXT",
+    "glIsBufferARB",
+    "glTextureBuffer",
+    "glDeleteVertexArrays",
+    "glGetBooleanIndexedvEXT",
+    "glBindVertexBuffers",
+    "glMap2f",
+    "glGetPerfMonitorCounterStringAMD",
+    "glOrthoxOES",
+    "glNormal3f",
+    "glGetTexParameterIiv",
+    "glGetVertexAttribiv",
+    "glProgramUniformMatrix3fv",
+    "glResumeTransformFeedbackNV",
+    "glGetUniformivARB",
+    "glUniform2d",
+    "glRenderbufferStorageMultisampleCoverageNV",
+    "glTextureStorage3DMultisample",
+    "glSampleMaskIndexedNV",
+    "glFramebufferSampleLocationsfvNV",
+    "glMatrixMult3x2fNV",
+    "glGetnHistogramARB",
+    "glGetTexLevelParameteriv",
+    "glProgramUniform3i",
+    "glCopyImageSubDataNV",
+    "glUniformHandleui64NV",
+    "glRasterPos3i",
+    "glVertex3i",
+    "glWaitSync",
+    "glTexImage3DMultisample",
+    "glTextureMaterialEXT",
+    "glUniform2fARB",
+    "glGetFogFuncSGIS",
+    "glIndexPointerListIBM",
+    "glVertex3bvOES",
+    "glUniform3fvARB",
+    "glClearBufferData",
+    "glDrawRangeElements",
+    "glGetMultiTexEnvfvEXT",
+    "glTexEnvfv",
+    "glFogxOES",
+    "glCopyTextureSubImage1D",
+    "glFramebufferFetchBarrierEXT",
+    "glVertex2iv",
+    "glGetNamedProgramLocalParameterdvEXT",
+    "glBeginOcclusionQueryNV",
+    "glColor4fNormal3fVertex3fvSUN",
+    "glStateCaptureNV",
+    "glProgramUniform2dv",
+    "glGetInvariantIntegervEXT",
+    "glUpdateObjectBufferATI",
+    "glDeformSGIX",
+    "glColorPointerEXT",
+    "glGetActiveSubroutineUniformiv",
+    "glGetClipPlanefOES",
+    "glTexImage2D",
+    "glScalef",
+    "glTextureBufferRangeEXT",
+    "glTexBuffer",
+    "glGenAsyncMarkersSGIX",
+    "glGetShaderSourceARB",
+    "glMapGrid2d",
+    "glConvolutionParameteri",
+    "glGetVertexAttribIiv",
+    "glGetTransformFeedbackVaryingEXT",
+    "glGetPathDashArrayNV",
+    "glGetProgramivARB",
+    "glPixelStorei",
+    "glMultiDrawArraysIndirectAMD",
+    "glColor3f",
+    "glEvalCoord2d",
+    "glTexCoord1bvOES",
+    "glClearNamedBufferSubDataEXT",
+    "glMultiTexBufferEXT",
+    "glTexParameterfv",
+    "glCompressedTextureImage1DEXT",
+    "glDrawTransformFeedbackInstanced",
+    "glProgramUniform1ui64ARB",
+    "glVertexAttribIFormatNV",
+    "glSecondaryColor3hvNV",
+    "glActiveTextureARB",
+    "glRasterPos4i",
+    "glGetnMapivARB",
+    "glVDPAUInitNV",
+    "glMulticastBufferSubDataNV",
+    "glUniform3i64vARB",
+    "glResetHistogramEXT",
+    "glPathCommandsNV",
+    "glBlendColor",
+    "glIndexFuncEXT",
+    "glReplacementCodeubvSUN",
+    "glBindFragmentShaderATI",
+    "glVariantPointerEXT",
+    "glCompressedMultiTexSubImage3DEXT",
+    "glVertexAttribPointerNV",
+    "glVertexAttrib2dvNV",
+    "glCurrentPaletteMatrixARB",
+    "glFragmentLightModelivSGIX",
+    "glTextureStorage3DMultisampleEXT",
+    "glScaled",
+    "glGetShadingRateImagePaletteNV",
+    "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+    "glTexCoord2i",
+    "glFragmentLightModelfSGIX",
+    "glColorTableParameterfv",
+    "glFogfv",
+    "glMultiTexCoord2i",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glEvaluateDepthValuesARB",
+    "glMultiDrawArraysIndirectBindlessNV",
+    "glMultiTexCoord3d",
+    "glMultiTexCoord1iARB",
+    "glGetInvariantBooleanvEXT",
+    "glDeleteProgramsNV",
+    "glVertexWeightPointerEXT",
+    "glGetPathTexGenivNV",
+    "glGetnPolygonStipple",
+    "glVertexAttrib4fARB",
+    "glGlobalAlphaFactorubSUN",
+    "glTexCoord3d",
+    "glActiveProgramEXT",
+    "glTexCoord4hvNV",
+    "glProgramUniformMatrix2fvEXT",
+    "glIndexi",
+    "glClipPlane",
+    "glBlendEquationSeparate",
+    "glGetProgramResourceiv",
+    "glMaxShaderCompilerThreadsKHR",
+    "glTexSubImage2DEXT",
+    "glPixelTexGenParameterfvSGIS",
+    "glTexEnvxvOES",
+    "glUniform4f",
+    "glPrioritizeTexturesxOES",
+    "glCompressedTexSubImage1DARB",
+    "glMultiModeDrawElementsIBM",
+    "glUniformSubroutinesuiv",
+    "glProgramUniform1iv",
+    "glNamedFramebufferTexture3DEXT",
+    "glCopyMultiTexSubImage1DEXT",
+    "glVertexStream4dvATI",
+    "glVertexStream1dATI",
+    "glGetTextureParameterIivEXT",
+    "glUniform3iARB",
+    "glWindowPos2fARB",
+    "glBindFragDataLocation",
+    "glGetSemaphoreParameterui64vEXT",
+    "glUniform2uivEXT",
+    "glGetColorTableParameterivEXT",
+    "glMakeNamedBufferResidentNV",
+    "glVertexAttribL3i64NV",
+    "glGetTexParameterxvOES",
+    "glDetachObjectARB",
+    "glUnlockArraysEXT",
+    "glObjectPurgeableAPPLE",
+    "glGetNamedProgramLocalParameterIuivEXT",
+    "glBlendBarrierNV",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glVertexAttribs4hvNV",
+    "glGetSharpenTexFuncSGIS",
+    "glGetMapControlPointsNV",
+    "glMaxShaderCompilerThreadsARB",
+    "glUniform1iARB",
+    "glMultiTexCoord3ivARB",
+    "glNormal3iv",
+    "glVertexAttrib2fNV",
+    "glNamedBufferStorageEXT",
+    "glGetDetailTexFuncSGIS",
+    "glNormal3d",
+    "glFragmentLightModeliSGIX",
+    "glRectsv",
+    "glGetInternalformati64v",
+    "glGenProgramsARB",
+    "glViewportIndexedfv",
+    "glProgramStringARB",
+    "glWindowPos3dARB",
+    "glFramebufferTexture2DEXT",
+    "glCompileShaderARB",
+    "glIsPointInStrokePathNV",
+    "glCopyNamedBufferSubData",
+    "glTexCoord3hNV",
+    "glSubpixelPrecisionBiasNV",
+    "glDetailTexFuncSGIS",
+    "glBlendBarrierKHR",
+    "glSecondaryColor3dEXT",
+    "glVertexAttrib2fvARB",
+    "glSetFenceNV",
+    "glGetVideouivNV",
+    "glGetnConvolutionFilterARB",
+    "glCreateStatesNV",
+    "glVertexAttrib1fv",
+    "glGetProgramNamedParameterdvNV",
+    "glDepthBoundsdNV",
+    "glDrawRangeElementsBaseVertex",
+    "glCopyMultiTexImage1DEXT",
+    "glQueryCounter",
+    "glMaterialxOES",
+    "glGetMinmaxEXT",
+    "glCombinerOutputNV",
+    "glGetConvolutionParameterfvEXT",
+    "glUseProgramStages",
+    "glVertexAttrib4ubNV",
+    "glDispatchComputeIndirect",
+    "glColor4usv",
+    "glNamedCopyBufferSubDataEXT",
+    "glDrawArraysInstancedARB",
+    "glUniformBlockBinding",
+    "glVertexAttribL3dvEXT",
+    "glIsProgram",
+    "glCompressedTexImage2DARB",
+    "glGetStageIndexNV",
+    "glDrawVkImageNV",
+    "glActiveStencilFaceEXT",
+    "glCompileCommandListNV",
+    "glPushClientAttrib",
+    "glGetnUniformi64vARB",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glCopyTexSubImage2D",
+    "glClearDepth",
+    "glVertexAttribL3dv",
+    "glTextureRangeAPPLE",
+    "glEvalCoord2fv",
+    "glVertexStream1sATI",
+    "glReplacementCodeuiVertex3fSUN",
+    "glProgramUniform4uivEXT",
+    "glRasterPos4xOES",
+    "glProgramNamedParameter4dvNV",
+    "glLighti",
+    "glTexCoordPointervINTEL",
+    "glClampColorARB",
+    "glVertex4xvOES",
+    "glRotated",
+    "glBindBufferOffsetNV",
+    "glWindowPos2dvARB",
+    "glVertexAttrib3s",
+    "glGetPathMetricRangeNV",
+    "glMultiTexGeniEXT",
+    "glGetMapfv",
+    "glTexImage3DMultisampleCoverageNV",
+    "glTangent3dEXT",
+    "glMapGrid1d",
+    "glIsQueryARB",
+    "glMultiTexCoord1fARB",
+    "glProgramLocalParametersI4ivNV",
+    "glDebugMessageEnableAMD",
+    "glEndConditionalRenderNV",
+    "glGetMinmaxParameterfv",
+    "glDeleteFencesNV",
+    "glVertexAttribL2dEXT",
+    "glViewportSwizzleNV",
+    "glRasterPos3iv",
+    "glProgramUniform2fvEXT",
+    "glWindowPos4ivMESA",
+    "glMultiTexCoord1xvOES",
+    "glGetQueryObjectui64v",
+    "glGenQueriesARB",
+    "glCompressedTexImage1DARB",
+    "glUniformMatrix2x4dv",
+    "glDisableVariantClientStateEXT",
+    "glTexCoord4bOES",
+    "glMultiTexCoord4i",
+    "glInvalidateTexSubImage",
+    "glGetnMinmaxARB",
+    "glEvalMapsNV",
+    "glGenBuffersARB",
+    "glVertexAttribP1ui",
+    "glMultiTexCoord2dvARB",
+    "glPopAttrib",
+    "glBindLightParameterEXT",
+    "glVertexAttribL3ui64NV",
+    "glUniform2uiv",
+    "glProgramUniformMatrix2fv",
+    "glFramebufferTextureARB",
+    "glProgramUniform4dvEXT",
+    "glVertexAttribI2iv",
+    "glActiveTexture",
+    "glBindVertexArrayAPPLE",
+    "glPixelDataRangeNV",
+    "glLockArraysEXT",
+    "glTexGeniv",
+    "glMap2xOES",
+    "glColorP3ui",
+    "glFinish",
+    "glGetTexLevelParameterfv",
+    "glGetQueryObjectuivARB",
+    "glEndVideoCaptureNV",
+    "glMultiTexCoord1f",
+    "glRasterPos2d",
+    "glSecondaryColor3f",
+    "glProgramUniform1uivEXT",
+    "glUniform3ui64NV",
+    "glPixelZoomxOES",
+    "glGenPerfMonitorsAMD",
+    "glGetVertexAttribPointervNV",
+    "glIsVertexAttribEnabledAPPLE",
+    "glMakeTextureHandleNonResidentNV",
+    "glTextureStorage2DMultisampleEXT",
+    "glBlendEquationSeparatei",
+    "glNamedBufferStorageMemEXT",
+    "glEndPerfMonitorAMD",
+    "glTangentPointerEXT",
+    "glTangent3dvEXT",
+    "glColor4d",
+    "glMultiTexSubImage3DEXT",
+    "glReplacementCodeuiSUN",
+    "glGetUniformi64vARB",
+    "glVertexAttribP3ui",
+    "glNamedProgramLocalParameter4dvEXT",
+    "glWriteMaskEXT",
+    "glGetVariantIntegervEXT",
+    "glTextureParameterIuivEXT",
+    "glProgramUniform4i64ARB",
+    "glGetQueryIndexediv",
+    "glProgramUniformHandleui64vARB",
+    "glPolygonOffsetEXT",
+    "glMapVertexAttrib1dAPPLE",
+    "glMatrixTranslatefEXT",
+    "glIsShader",
+    "glVertexP2uiv",
+    "glUniform1ivARB",
+    "glGetUniformiv",
+    "glPixelTransformParameterfEXT",
+    "glVertexAttribI4bv",
+    "glMultiTexGenivEXT",
+    "glProgramUniform2uivEXT",
+    "glFogCoordfvEXT",
+    "glVertexAttribL1d",
+    "glCreateSyncFromCLeventARB",
+    "glIsPathNV",
+    "glBindVertexArray",
+    "glMultiTexCoord1bOES",
+    "glProgramEnvParameters4fvEXT",
+    "glSecondaryColor3bEXT",
+    "glTexCoord2hvNV",
+    "glBlendFunci",
+    "glTextureStorageMem3DEXT",
+    "glVertexAttrib3dARB",
+    "glReleaseShaderCompiler",
+    "glVertexStream2dATI",
+    "glInitNames",
+    "glWindowPos4sMESA",
+    "glImportSemaphoreWin32HandleEXT",
+    "glColor3bv",
+    "glAlphaToCoverageDitherControlNV",
+    "glProgramUniform3iEXT",
+    "glBlitNamedFramebuffer",
+    "glActiveShaderProgram",
+    "glVertexAttribPointerARB",
+    "glTransformFeedbackBufferBase",
+    "glMapParameterivNV",
+    "glReplacementCodeusvSUN",
+    "glGenPathsNV",
+    "glGetProgramResourceName",
+    "glPatchParameterfv",
+    "glNamedProgramLocalParametersI4ivEXT",
+    "glVertexAttrib4dvARB",
+    "glProgramUniform2ivEXT",
+    "glNamedFramebufferTextureLayer",
+    "glProgramUniformMatrix2dvEXT",
+    "glTexCoord1fv",
+    "glDeleteFramebuffers",
+    "glGetRenderbufferParameteriv",
+    "glVertexWeightfEXT",
+    "glMultiModeDrawArraysIBM",
+    "glGetnUniformui64vARB",
+    "glTexCoord1i",
+    "glVertexAttrib4svARB",
+    "glGetTexBumpParameterfvATI",
+    "glGetnCompressedTexImage",
+    "glGetProgramResourceLocation",
+    "glMultiTexParameterIuivEXT",
+    "glProgramUniform1dvEXT",
+    "glGetShaderPrecisionFormat",
+    "glCompressedTexSubImage2D",
+    "glSecondaryColor3i",
+    "glMultiTexCoord3hvNV",
+    "glDrawBuffersARB",
+    "glSpecializeShader",
+    "glProgramUniform2i64ARB",
+    "glGetMinmaxParameterfvEXT",
+    "glMultiDrawRangeElementArrayAPPLE",
+    "glCompileShader",
+    "glIsNamedStringARB",
+    "glPushAttrib",
+    "glSamplePatternEXT",
+    "glGetPixelTexGenParameterfvSGIS",
+    "glDrawArrays",
+    "glTextureSubImage1D",
+    "glMultiTexCoord2fvARB",
+    "glVertexArrayVertexAttribFormatEXT",
+    "glSelectPerfMonitorCountersAMD",
+    "glIsTextureHandleResidentNV",
+    "glPointSize",
+    "glGetVertexAttribLdv",
+    "glBindVideoCaptureStreamTextureNV",
+    "glFlushMappedNamedBufferRangeEXT",
+    "glPathParameteriNV",
+    "glCombinerParameterivNV",
+    "glVertexBindingDivisor",
+    "glGetnPixelMapfv",
+    "glGenRenderbuffersEXT",
+    "glMultiTexCoord2bOES",
+    "glTexCoord4fColor4fNormal3fVertex4fSUN",
+    "glGenerateTextureMipmap",
+    "glSecondaryColor3uiv",
+    "glMultiTexCoord1fv",
+    "glBlitFramebuffer",
+    "glTextureBufferRange",
+    "glMultiTexCoord2dARB",
+    "glGetMapiv",
+    "glProgramUniform3dEXT",
+    "glVertexAttribFormat",
+    "glTextureStorage1D",
+    "glGetNamedBufferParameteri64v",
+    "glCopyImageSubData",
+    "glVertex3iv",
+    "glGetnMapiv",
+    "glProgramEnvParameterI4iNV",
+    "glSignalVkSemaphoreNV",
+    "glTextureStorage3D",
+    "glGetQueryObjecti64v",
+    "glFogiv",
+    "glColorSubTable",
+    "glBufferAddressRangeNV",
+    "glConvolutionParameteriEXT",
+    "glDisableClientStateiEXT",
+    "glVertexAttribL4ui64NV",
+    "glProgramUniform4fEXT",
+    "glSetFragmentShaderConstantATI",
+    "glVertexAttrib4hNV",
+    "glTexCoord2fColor4ubVertex3fvSUN",
+    "glFreeObjectBufferATI",
+    "glProgramLocalParameterI4ivNV",
+    "glProgramUniformMatrix4x2dv",
+    "glDeleteNamesAMD",
+    "glTexStorageMem3DEXT",
+    "glNamedProgramLocalParameter4fEXT",
+    "glGetPixelMapusv",
+    "glMatrixMult3x3fNV",
+    "glUnmapNamedBufferEXT",
+    "glVertexStream2iATI",
+    "glVertexArrayRangeNV",
+    "glIndexPointerEXT",
+    "glGetProgramNamedParameterfvNV",
+    "glIsFenceAPPLE",
+    "glCullParameterfvEXT",
+    "glTexCoord1bOES",
+    "glUniform4ui",
+    "glPointParameterfvSGIS",
+    "glEndOcclusionQueryNV",
+    "glVertexArrayNormalOffsetEXT",
+    "glVertexAttribI3uivEXT",
+    "glNormal3fv",
+    "glBlendEquationi",
+    "glUniformMatrix4dv",
+    "glVertex4hvNV",
+    "glCopyTexSubImage1D",
+    "glAsyncCopyImageSubDataNVX",
+    "glPopGroupMarkerEXT",
+    "glNamedBufferData",
+    "glRotatef",
+    "glGetCompressedTextureImage",
+    "glProgramLocalParameter4dARB",
+    "glVertexArrayAttribIFormat",
+    "glClearNamedFramebufferiv",
+    "glMultiTexCoordP2uiv",
+    "glTextureBarrierNV",
+    "glUniformMatrix4x3dv",
+    "glGetUniformBufferSizeEXT",
+    "glCheckFramebufferStatusEXT",
+    "glGetPixelTexGenParameterivSGIS",
+    "glMateriali",
+    "glUniform2ui",
+    "glFramebufferTextureLayerARB",
+    "glSecondaryColor3fvEXT",
+    "glProgramUniform4ui64ARB",
+    "glRasterPos4xvOES",
+    "glDrawMeshTasksNV",
+    "glInvalidateNamedFramebufferData",
+    "glFramebufferRenderbuffer",
+    "glGetnUniformiv",
+    "glVertexBlendEnvfATI",
+    "glGetFragmentLightivSGIX",
+    "glGetTextureParameterfv",
+    "glEnableVertexArrayAttribEXT",
+    "glDebugMessageInsertARB",
+    "glVertexAttrib4bv",
+    "glGetActiveVaryingNV",
+    "glFramebufferDrawBuffersEXT",
+    "glFramebufferParameteriMESA",
+    "glBinormal3dvEXT",
+    "glColor3hvNV",
+    "glMultiTexCoordP2ui",
+    "glGetnTexImage",
+    "glDrawPixels",
+    "glDeleteLists",
+    "glAreTexturesResidentEXT",
+    "glGetFragmentLightfvSGIX",
+    "glMultMatrixxOES",
+    "glTexCoord4iv",
+    "glGetVideoui64vNV",
+    "glMultiTexCoord1sARB",
+    "glGetTexEnvxvOES",
+    "glFogCoordfEXT",
+    "glMultiTexCoord3i",
+    "glGetPointerIndexedvEXT",
+    "glMultTransposeMatrixdARB",
+    "glNormalFormatNV",
+    "glTexParameteri",
+    "glNormalStream3ivATI",
+    "glEnablei",
+    "glVertexAttrib4NbvARB",
+    "glFinishAsyncSGIX",
+    "glTexCoord2fColor3fVertex3fSUN",
+    "glTexCoord2fColor3fVertex3fvSUN",
+    "glIsSampler",
+    "glTexCoord2fNormal3fVertex3fSUN",
+    "glProgramUniformMatrix4dvEXT",
+    "glRasterPos3xOES",
+    "glUniformMatrix3x4fv",
+    "glGetProgramSubroutineParameteruivNV",
+    "glTextureImage3DMultisampleCoverageNV",
+    "glVertexArrayVertexAttribIOffsetEXT",
+    "glVertexArrayIndexOffsetEXT",
+    "glGetActiveUniformBlockName",
+    "glTexCoord1f",
+    "glTranslatef",
+    "glMapGrid1f",
+    "glGetVertexArrayiv",
+    "glGetnUniformfvARB",
+    "glGetUnsignedBytei_vEXT",
+    "glGetProgramStringARB",
+    "glCopyPathNV",
+    "glMultiTexCoord2svARB",
+    "glTextureSubImage2DEXT",
+    "glColor4xOES",
+    "glPointParameterf",
+    "glCoverFillPathInstancedNV",
+    "glEndTransformFeedbackEXT",
+    "glNormal3xvOES",
+    "glMultiTexCoord4dvARB",
+    "glNamedBufferDataEXT",
+    "glWindowPos2fvMESA",
+    "glPathGlyphIndexArrayNV",
+    "glBindBufferBaseEXT",
+    "glSampleCoverage",
+    "glEvalPoint2",
+    "glMakeTextureHandleResidentNV",
+    "glNormalStream3sATI",
+    "glIndexxvOES",
+    "glVideoCaptureStreamParameterivNV",
+    "glUniform4iv",
+    "glColor4ubVertex2fSUN",
+    "glStencilFillPathNV",
+    "glWindowPos2svARB",
+    "glGetShaderiv",
+    "glDrawMeshArraysSUN",
+    "glWeightfvARB",
+    "glIsQuery",
+    "glVertexFormatNV",
+    "glProgramUniform4i64vNV",
+    "glViewportIndexedf",
+    "glGetNamedFramebufferParameterivEXT",
+    "glMapNamedBufferEXT",
+    "glGetArrayObjectfvATI",
+    "glDeformationMap3fSGIX",
+    "glTextureStorageSparseAMD",
+    "glProgramParameter4dNV",
+    "glCoverStrokePathNV",
+    "glVertexAttribI4ui",
+    "glResizeBuffersMESA",
+    "glMapControlPointsNV",
+    "glProgramNamedParameter4fNV",
+    "glReplacementCodeuiNormal3fVertex3fvSUN",
+    "glValidateProgramARB",
+    "glVertexAttribL1ui64vNV",
+    "glMap1f",
+    "glCreateMemoryObjectsEXT",
+    "glGetCombinerInputParameterfvNV",
+    "glCompressedMultiTexSubImage1DEXT",
+    "glGetTexEnvfv",
+    "glTangent3bEXT",
+    "glTextureImage2DEXT",
+    "glReadBuffer",
+    "glVertexAttribL4dvEXT",
+    "glVertex3xOES",
+    "glFlushStaticDataIBM",
+    "glShadeModel",
+    "glDeleteVertexArraysAPPLE",
+    "glGetNamedStringivARB",
+    "glTexStorageSparseAMD",
+    "glTexGeni",
+    "glUseShaderProgramEXT",
+    "glGetNamedRenderbufferParameteriv",
+    "glColorP3uiv",
+    "glVertexBlendEnviATI",
+    "glBinormal3bvEXT",
+    "glMatrixIndexubvARB",
+    "glPixelTransferi",
+    "glVertexAttrib2dv",
+    "glColorTable",
+    "glTexCoord2hNV",
+    "glVertexStream1fvATI",
+    "glUniformMatrix4x3fv",
+    "glCopyTexImage2D",
+    "glDrawArraysInstanced",
+    "glTexCoord1xvOES",
+    "glVertexAttribI2ivEXT",
+    "glGetVertexArrayIndexed64iv",
+    "glPointSizexOES",
+    "glGetnPixelMapusv",
+    "glGenQueryResourceTagNV",
+    "glVertex4xOES",
+    "glBindAttribLocation",
+    "glColor4ubv",
+    "glGetVertexAttribLui64vARB",
+    "glVertexArrayVertexBindingDivisorEXT",
+    "glProgramUniform3ui",
+    "glEndFragmentShaderATI",
+    "glUniformMatrix3fvARB",
+    "glGetPixelTransformParameterfvEXT",
+    "glBindBuffersBase",
+    "glTexCoordP1uiv",
+    "glUniform1ui64vARB",
+    "glGetTransformFeedbacki64_v",
+    "glVertexStream4iATI",
+    "glGetPerfMonitorCounterDataAMD",
+    "glGetMultiTexParameterivEXT",
+    "glDeleteSemaphoresEXT",
+    "glDisableIndexedEXT",
+    "glGlobalAlphaFactoriSUN",
+    "glCompressedTexSubImage1D",
+    "glGetProgramivNV",
+    "glVertexAttrib1fNV",
+    "glProgramBufferParametersIuivNV",
+    "glVertex4d",
+    "glVertexAttrib2s",
+    "glProgramParameter4dvNV",
+    "glVertexArrayAttribLFormat",
+    "glBindVertexShaderEXT",
+    "glCopyColorTable",
+    "glStencilClearTagEXT",
+    "glFogCoordPointerListIBM",
+    "glDrawTransformFeedback",
+    "glGetnMapdvARB",
+    "glMultTransposeMatrixf",
+    "glBeginConditionalRenderNVX",
+    "glBindBufferBase",
+    "glRenderbufferStorageMultisample",
+    "glGetProgramPipelineiv",
+    "glGetObjectPtrLabel",
+    "glEdgeFlag",
+    "glGetMaterialiv",
+    "glMatrixOrthoEXT",
+    "glIsProgramPipeline",
+    "glMatrixLoadIdentityEXT",
+    "glEGLImageTargetTexStorageEXT",
+    "glPixelTexGenParameterfSGIS",
+    "glVertexAttribP4ui",
+    "glNamedFramebufferDrawBuffers",
+    "glFlushVertexArrayRangeAPPLE",
+    "glReplacementCodeuiColor3fVertex3fSUN",
+    "glStringMarkerGREMEDY",
+    "glMinmaxEXT",
+    "glRasterPos3f",
+    "glWindowPos2fMESA",
+    "glVertexAttribI1ivEXT",
+    "glUniform1ui64ARB",
+    "glSecondaryColor3ub",
+    "glVertexAttrib1d",
+    "glGetnSeparableFilter",
+    "glVertexAttribI3ivEXT",
+    "glTestFenceNV",
+    "glGetAttachedShaders",
+    "glIsCommandListNV",
+    "glIsSemaphoreEXT",
+    "glVDPAUIsSurfaceNV",
+    "glRasterPos4iv",
+    "glMapGrid1xOES",
+    "glBlendColorxOES",
+    "glUniform4fARB",
+    "glTexCoord2f",
+    "glLoadMatrixd",
+    "glWindowPos4iMESA",
+    "glSecondaryColor3hNV",
+    "glClientWaitSync",
+    "glInvalidateBufferSubData",
+    "glTexParameteriv",
+    "glGetNamedProgramStringEXT",
+    "glMultiTexCoord1hvNV",
+    "glGetAttachedObjectsARB",
+    "glBeginQueryARB",
+    "glGetShaderSource",
+    "glRequestResidentProgramsNV",
+    "glVertexAttrib1dARB",
+    "glGetBooleanv",
+    "glProgramUniformui64vNV",
+    "glPointParameterfARB",
+    "glMultiDrawElementsIndirectBindlessCountNV",
+    "glLightf",
+    "glProgramUniform3iv",
+    "glGetnPixelMapfvARB",
+    "glVertexAttrib4fv",
+    "glGetPointeri_vEXT",
+    "glDeleteVertexShaderEXT",
+    "glMultMatrixf",
+    "glResetMemoryObjectParameterNV",
+    "glBegin",
+    "glVertexAttribP2ui",
+    "glActiveVaryingNV",
+    "glGetIntegeri_v",
+    "glProgramUniform3ivEXT",
+    "glUniform4uivEXT",
+    "glSecondaryColor3iEXT",
+    "glGetnMapfvARB",
+    "glTexStorageMem2DEXT",
+    "glProgramUniformMatrix3x2fvEXT",
+    "glTexCoordP3ui",
+    "glBinormal3iEXT",
+    "glGetHistogramParameterfv",
+    "glGetPathParameterivNV",
+    "glMultiTexCoordP4ui",
+    "glGenerateMultiTexMipmapEXT",
+    "glTexImage2DMultisample",
+    "glDepthRangeArrayv",
+    "glPollAsyncSGIX",
+    "glSamplerParameterIuiv",
+    "glGetProgramInterfaceiv",
+    "glVertexAttribI3uiEXT",
+    "glMakeImageHandleResidentARB",
+    "glGetTexParameterIuivEXT",
+    "glEdgeFlagPointer",
+    "glGetObjectBufferivATI",
+    "glPathParameterivNV",
+    "glMap2d",
+    "glPointParameterfSGIS",
+    "glMultiTexCoord3dvARB",
+    "glCompressedTexSubImage3DARB",
+    "glProgramEnvParameter4dARB",
+    "glVertexArrayVertexAttribBindingEXT",
+    "glBlendEquation",
+    "glBinormal3bEXT",
+    "glFogCoordfv",
+    "glTexCoordFormatNV",
+    "glPointParameterxvOES",
+    "glConservativeRasterParameteriNV",
+    "glWaitSemaphoreui64NVX",
+    "glMaterialf",
+    "glDisableClientStateIndexedEXT",
+    "glMakeTextureHandleResidentARB",
+    "glVertexAttribParameteriAMD",
+    "glClearDepthdNV",
+    "glGetObjectParameterfvARB",
+    "glProgramLocalParametersI4uivNV",
+    "glVertex4sv",
+    "glVertexArrayVertexBuffers",
+    "glFramebufferDrawBufferEXT",
+    "glVertexAttrib4dNV",
+    "glVertexAttrib1f",
+    "glVertexAttribI1iv",
+    "glRectxvOES",
+    "glEndQueryARB",
+    "glVertexStream4fATI",
+    "glTexCoord1hvNV",
+    "glMinSampleShading",
+    "glVertexAttribI4sv",
+    "glVertex3s",
+    "glGenerateTextureMipmapEXT",
+    "glVertexAttribI2uivEXT",
+    "glSecondaryColor3uivEXT",
+    "glVertexAttribs3dvNV",
+    "glTexEnvxOES",
+    "glFrameZoomSGIX",
+    "glSecondaryColor3ubEXT",
+    "glTextureParameterfvEXT",
+    "glPathGlyphRangeNV",
+    "glBufferData",
+    "glIndexfv",
+    "glPolygonOffset",
+    "glVDPAUSurfaceAccessNV",
+    "glMultiTexParameterfvEXT",
+    "glDrawTextureNV",
+    "glMatrixIndexPointerARB",
+    "glGetActiveUniform",
+    "glWindowPos2dvMESA",
+    "glUniform1f",
+    "glGetNamedBufferParameteriv",
+    "glGetFramebufferParameterivEXT",
+    "glAlphaFuncxOES",
+    "glFrustum",
+    "glBindBufferARB",
+    "glIndexs",
+    "glIsFramebufferEXT",
+    "glPixelMapfv",
+    "glMultiTexCoord3dv",
+    "glColorPointerListIBM",
+    "glLineWidth",
+    "glUniform4ui64vARB",
+    "glEvalCoord2f",
+    "glDrawBuffers",
+    "glProgramEnvParametersI4uivNV",
+    "glCopyTexSubImage2DEXT",
+    "glVertexAttribBinding",
+    "glGetMinmaxParameteriv",
+    "glTexImage2DMultisampleCoverageNV",
+    "glColorTableParameterivSGI",
+    "glGetPixelMapuiv",
+    "glVertexAttribI4svEXT",
+    "glMultiTexCoord3hNV",
+    "glNamedRenderbufferStorageMultisampleEXT",
+    "glVertexAttrib1dNV",
+    "glGetImageHandleARB",
+    "glListBase",
+    "glVertexAttribFormatNV",
+    "glMulticastBarrierNV",
+    "glTexStorageMem2DMultisampleEXT",
+    "glClearBufferfi",
+    "glVertexAttribL1ui64NV",
+    "glGetPathParameterfvNV",
+    "glBindImageTextureEXT",
+    "glGetFixedvOES",
+    "glTexStorageMem1DEXT",
+    "glSamplerParameterIiv",
+    "glGetCombinerStageParameterfvNV",
+    "glProgramUniform4ivEXT",
+    "glCopyTextureSubImage3D",
+    "glRasterPos2xOES",
+    "glNamedFramebufferTexture2DEXT",
+    "glImageTransformParameterivHP",
+    "glVertexAttrib4uivARB",
+    "glBlendEquationSeparateiARB",
+    "glFlushMappedBufferRangeAPPLE",
+    "glRasterPos3s",
+    "glGetColorTableParameterfv",
+    "glColor4ubVertex2fvSUN",
+    "glMultiDrawElementsIndirectCountARB",
+    "glTexStorage3D",
+    "glWindowPos3iMESA",
+    "glVertexAttrib4ubvNV",
+    "glTexBumpParameterivATI",
+    "glProgramEnvParameterI4uivNV",
+    "glProgramUniform3fvEXT",
+    "glFogi",
+    "glShaderOp1EXT",
+    "glWindowPos3sARB",
+    "glGetHistogramParameterxvOES",
+    "glEndTransformFeedback",
+    "glDrawCommandsNV",
+    "glTexParameterIiv",
+    "glFogxvOES",
+    "glUniformMatrix2fvARB",
+    "glGetTextureParameterIuivEXT",
+    "glPathGlyphIndexRangeNV",
+    "glBindTransformFeedbackNV",
+    "glCoverFillPathNV",
+    "glMultiTexCoord2xOES",
+    "glGetMultisamplefv",
+    "glInterpolatePathsNV",
+    "glGetUniformuivEXT",
+    "glPixelZoom",
+    "glVertexAttribL2i64vNV",
+    "glBinormal3fEXT",
+    "glWindowPos2fvARB",
+    "glSwizzleEXT",
+    "glRasterPos4s",
+    "glBlendFuncSeparatei",
+    "glProgramUniformMatrix3dv",
+    "glFinishFenceAPPLE",
+    "glTexCoord3xOES",
+    "glEdgeFlagPointerListIBM",
+    "glVertexAttribs1fvNV",
+    "glMultiTexCoord1dvARB",
+    "glConvolutionParameterfEXT",
+    "glSelectBuffer",
+    "glTextureColorMaskSGIS",
+    "glUniformMatrix2x4fv",
+    "glElementPointerAPPLE",
+    "glGenRenderbuffers",
+    "glGetVaryingLocationNV",
+    "glBlendEquationSeparateEXT",
+    "glProgramLocalParameterI4uiNV",
+    "glVertexStream3svATI",
+    "glIsTransformFeedbackNV",
+    "glConvolutionParameterfv",
+    "glVertexAttribLPointer",
+    "glAlphaFragmentOp1ATI",
+    "glNamedProgramLocalParametersI4uivEXT",
+    "glGetTexEnviv",
+    "glInterleavedArrays",
+    "glDetachShader",
+    "glNamedBufferPageCommitmentARB",
+    "glVertexAttrib1sARB",
+    "glGetUniformLocationARB",
+    "glTexCoord2dv",
+    "glProgramBinary",
+    "glGetNamedBufferSubDataEXT",
+    "glGetTexLevelParameterxvOES",
+    "glDebugMessageInsert",
+    "glVertexAttrib2dvARB",
+    "glGetPolygonStipple",
+    "glGetVertexAttribLui64vNV",
+    "glUniform3ivARB",
+    "glGetTransformFeedbackVaryingNV",
+    "glQueryMatrixxOES",
+    "glDeleteRenderbuffersEXT",
+    "glVertexAttrib2svNV",
+    "glPointParameterfvARB",
+    "glProgramUniform2fEXT",
+    "glBindBuffer",
+    "glMapBufferRange",
+    "glEndQueryIndexed",
+    "glUniform1i64ARB",
+    "glGlobalAlphaFactoruiSUN",
+    "glTexParameterxOES",
+    "glIndexFormatNV",
+    "glNormal3dv",
+    "glProgramUniform4iEXT",
+    "glMultiTexCoord3xOES",
+    "glVertexAttribI1i",
+    "glWindowPos3s",
+    "glGetVertexAttribIuiv",
+    "glWindowPos3fMESA",
+    "glMultiTexCoord4hvNV",
+    "glCreateTextures",
+    "glProgramUniformMatrix3x4dvEXT",
+    "glGetPointervEXT",
+    "glProgramUniform1dv",
+    "glGenerateMipmap",
+    "glGetVertexAttribdvARB",
+    "glMultiTexCoordP3ui",
+    "glDeleteTexturesEXT",
+    "glProgramUniform4iv",
+    "glGetNamedFramebufferAttachmentParameterivEXT",
+    "glEndConditionalRender",
+    "glSyncTextureINTEL",
+    "glDisableVertexArrayEXT",
+    "glVariantivEXT",
+    "glProgramLocalParameter4dvARB",
+    "glColorTableParameterfvSGI",
+    "glHistogramEXT",
+    "glFramebufferTextureLayer",
+    "glBlendFuncSeparateINGR",
+    "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+    "glIsProgramNV",
+    "glMultiTexCoord3sARB",
+    "glIsImageHandleResidentNV",
+    "glBindSamplers",
+    "glTextureRenderbufferEXT",
+    "glNamedBufferPageCommitmentEXT",
+    "glBindTextureEXT",
+    "glRenderbufferStorageMultisampleAdvancedAMD",
+    "glDrawElementsInstancedEXT",
+    "glProgramUniform1ivEXT",
+    "glVertexStream3sATI",
+    "glMultiTexCoord2fv",
+    "glVertexArrayColorOffsetEXT",
+    "glSampleMaskEXT",
+    "glGetVertexAttribLi64vNV",
+    "glGetPerfQueryInfoINTEL",
+    "glProgramUniform1f",
+    "glProgramUniform4ui",
+    "glGetQueryiv",
+    "glUniform3dv",
+    "glBindParameterEXT",
+    "glMultiTexCoord4d",
+    "glHint",
+    "glStencilOp",
+    "glVertexAttribL3dEXT",
+    "glUniform4fvARB",
+    "glTangent3fvEXT",
+    "glColor3hNV",
+    "glMatrixIndexuivARB",
+    "glBeginTransformFeedbackEXT",
+    "glGetProgramBinary",
+    "glIsAsyncMarkerSGIX",
+    "glMultiTexImage2DEXT",
+    "glGetColorTableSGI",
+    "glSeparableFilter2D",
+    "glGetDoubleIndexedvEXT",
+    "glVertexArrayVertexAttribLFormatEXT",
+    "glProgramUniformMatrix3x2dvEXT",
+    "glVertex3xvOES",
+    "glTranslated",
+    "glTransformFeedbackStreamAttribsNV",
+    "glGetUniformBlockIndex",
+    "glConvolutionParameterf",
+    "glGetHistogramParameterivEXT",
+    "glElementPointerATI",
+    "glMatrixIndexusvARB",
+    "glVertexPointerListIBM",
+    "glUniform3i64NV",
+    "glCopyPixels",
+    "glWindowPos2sMESA",
+    "glIsTextureHandleResidentARB",
+    "glMultiTexCoord4iv",
+    "glGetProgramParameterdvNV",
+    "glExtractComponentEXT",
+    "glGetAttribLocationARB",
+    "glTexParameterf",
+    "glDeleteSamplers",
+    "glProgramUniformMatrix4fvEXT",
+    "glGetnMinmax",
+    "glConservativeRasterParameterfNV",
+    "glWeightivARB",
+    "glGetNamedProgramLocalParameterfvEXT",
+    "glIndexubv",
+    "glBeginConditionalRender",
+    "glProgramLocalParameterI4uivNV",
+    "glGetCompressedTextureSubImage",
+    "glGetDoublei_v",
+    "glGetnUniformdvARB",
+    "glNamedProgramLocalParameters4fvEXT",
+    "glUnmapBufferARB",
+    "glGetVertexArrayIndexediv",
+    "glVertexAttrib4NuivARB",
+    "glGetVertexArrayPointervEXT",
+    "glConvolutionParameterfvEXT",
+    "glMulticastGetQueryObjectivNV",
+    "glVertexAttrib4dARB",
+    "glReplacementCodePointerSUN",
+    "glMultiTexParameterIivEXT",
+    "glVertexAttrib1hNV",
+    "glColor3b",
+    "glTexParameterxvOES",
+    "glGetMultiTexEnvivEXT",
+    "glCombinerInputNV",
+    "glGetBufferParameteri64v",
+    "glUniform3ui64ARB",
+    "glConvolutionParameterxOES",
+    "glMatrixMultTranspose3x3fNV",
+    "glVertex2bOES",
+    "glUniformMatrix2fv",
+    "glTexBufferRange",
+    "glLightfv",
+    "glTextureStorage2DEXT",
+    "glGetNamedFramebufferParameterfvAMD",
+    "glPathSubCommandsNV",
+    "glWindowPos3iARB",
+    "glMultiTexCoord3fvARB",
+    "glTexCoord3hvNV",
+    "glGetCompressedMultiTexImageEXT",
+    "glBindVideoCaptureStreamBufferNV",
+    "glVertexStream1svATI",
+    "glBeginPerfMonitorAMD",
+    "glTbufferMask3DFX",
+    "glQueryResourceNV",
+    "glDeleteCommandListsNV",
+    "glMakeBufferResidentNV",
+    "glGetFinalCombinerInputParameterfvNV",
+    "glTexStorage2DMultisample",
+    "glUseProgram",
+    "glMultiTexEnvfvEXT",
+    "glAsyncMarkerSGIX",
+    "glBindSampler",
+    "glUniform4ui64NV",
+    "glStencilStrokePathNV",
+    "glEndPerfQueryINTEL",
+    "glFramebufferReadBufferEXT",
+    "glVertexAttrib4NubARB",
+    "glPathStringNV",
+    "glTexImage3D",
+    "glFinishTextureSUNX",
+    "glSecondaryColorFormatNV",
+    "glNamedProgramLocalParameterI4ivEXT",
+    "glVertexStream2ivATI",
+    "glTextureImage3DEXT",
+    "glGetColorTableParameterivSGI",
+    "glNamedRenderbufferStorageMultisampleCoverageEXT",
+    "glSignalVkFenceNV",
+    "glLightModelfv",
+    "glVertexAttrib3svARB",
+    "glGetFloatIndexedvEXT",
+    "glBufferSubDataARB",
+    "glSetLocalConstantEXT",
+    "glFragmentLightivSGIX",
+    "glGetProgramLocalParameterfvARB",
+    "glVertexAttribL4dv",
+    "glDeleteTransformFeedbacks",
+    "glReplacementCodeuiColor4ubVertex3fvSUN",
+    "glPointParameteriNV",
+    "glMultiTexCoord2hNV",
+    "glProgramUniform4d",
+    "glGetLocalConstantBooleanvEXT",
+    "glVertex2sv",
+    "glGlobalAlphaFactorfSUN",
+    "glWeightubvARB",
+    "glGetVideoCaptureStreamdvNV",
+    "glGetConvolutionParameterxvOES",
+    "glVertexStream1fATI",
+    "glPauseTransformFeedbackNV",
+    "glVertexAttrib2f",
+    "glGetColorTableParameteriv",
+    "glGetTexGenxvOES",
+    "glStencilMask",
+    "glSampleMaski",
+    "glGenOcclusionQueriesNV",
+    "glLGPUNamedBufferSubDataNVX",
+    "glUniformHandleui64vNV",
+    "glCopyTexImage2DEXT",
+    "glVertex3hvNV",
+    "glWeightuivARB",
+    "glUniform3f",
+    "glCheckFramebufferStatus",
+    "glVDPAUMapSurfacesNV",
+    "glVertexAttrib3hNV",
+    "glVertexAttribL4d",
+    "glFlushMappedNamedBufferRange",
+    "glArrayObjectATI",
+    "glUniformMatrix4x2dv",
+    "glStencilStrokePathInstancedNV",
+    "glGetIntegerIndexedvEXT",
+    "glTexCoord3bOES",
+    "glDeleteBuffers",
+    "glTexStorage1D",
+    "glGetTexBumpParameterivATI",
+    "glGetVkProcAddrNV",
+    "glDepthRangeIndexed",
+    "glFogCoorddEXT",
+    "glVertex3f",
+    "glVertexArrayTexCoordOffsetEXT",
+    "glMatrixLoadTranspose3x3fNV",
+    "glCompressedTexImage1D",
+    "glSamplerParameteri",
+    "glNormal3i",
+    "glGetUnsignedBytevEXT",
+    "glNormalStream3iATI",
+    "glSecondaryColor3s",
+    "glLightModelf",
+    "glVertexArrayVertexOffsetEXT",
+    "glPNTrianglesiATI",
+    "glConvolutionParameteriv",
+    "glUniform1i",
+    "glIndexdv",
+    "glProgramUniform3ui64ARB",
+    "glGetTextureParameterIuiv",
+    "glShaderStorageBlockBinding",
+    "glUniform2i64vNV",
+    "glRenderMode",
+    "glVertexArrayMultiTexCoordOffsetEXT",
+    "glCompressedTextureSubImage1D",
+    "glVertexAttrib4fvNV",
+    "glGetProgramInfoLog",
+    "glIsNamedBufferResidentNV",
+    "glIsRenderbufferEXT",
+    "glDeleteObjectARB",
+    "glMultiDrawElementsIndirect",
+    "glMultiTexImage1DEXT",
+    "glTextureView",
+    "glClientAttribDefaultEXT",
+    "glEGLImageTargetRenderbufferStorageOES",
+    "glTexCoord2fColor4ubVertex3fSUN",
+    "glCreateRenderbuffers",
+    "glTexCoord2s",
+    "glBindRenderbufferEXT",
+    "glGetFragmentMaterialfvSGIX",
+    "glVertexArrayBindVertexBufferEXT",
+    "glFramebufferTexture1D",
+    "glVertexAttribL4ui64vNV",
+    "glBindFragDataLocationIndexed",
+    "glGetBooleani_v",
+    "glProgramUniformHandleui64NV",
+    "glMultTransposeMatrixfARB",
+    "glVertexPointerEXT",
+    "glCreateCommandListsNV",
+    "glDeleteOcclusionQueriesNV",
+    "glVDPAUUnmapSurfacesNV",
+    "glMultiTexCoord4fv",
+    "glCombinerParameteriNV",
+    "glCullParameterdvEXT",
+    "glMatrixLoadTransposedEXT",
+    "glImageTransformParameteriHP",
+    "glDrawArraysInstancedEXT",
+    "glEvalPoint1",
+    "glNamedFramebufferSampleLocationsfvARB",
+    "glTransformPathNV",
+    "glDrawArraysInstancedBaseInstance",
+    "glIndexd",
+    "glStencilFillPathInstancedNV",
+    "glVertexStream4fvATI",
+    "glGetFloati_v",
+    "glVertexAttrib1svARB",
+    "glVertexAttrib2fARB",
+    "glGetShadingRateSampleLocationivNV",
+    "glGetVariantArrayObjectivATI",
+    "glProgramUniform2ui64NV",
+    "glBitmapxOES",
+    "glMatrixLoad3x2fNV",
+    "glColor3iv",
+    "glWindowPos2dARB",
+    "glUseProgramObjectARB",
+    "glMapVertexAttrib2dAPPLE",
+    "glGetObjectLabelEXT",
+    "glWeightdvARB",
+    "glSecondaryColor3fv",
+    "glTexCoord3bvOES",
+    "glGetVertexAttribfv",
+    "glVertexAttribL1ui64vARB",
+    "glDeletePerfMonitorsAMD",
+    "glBindBufferOffsetEXT",
+    "glProgramUniform3fEXT",
+    "glProgramUniform2iv",
+    "glLineStipple",
+    "glDrawTransformFeedbackNV",
+    "glUniformMatrix2x3fv",
+    "glMultiTexCoord4sv",
+    "glMatrixLoad3x3fNV",
+    "glGetMapParameterivNV",
+    "glGetMultiTexLevelParameterivEXT",
+    "glUniform4i64ARB",
+    "glLightxOES",
+    "glGetVertexArrayPointeri_vEXT",
+    "glNamedRenderbufferStorage",
+    "glEvalCoord1xvOES",
+    "glBinormal3dEXT",
+    "glGetQueryBufferObjectuiv",
+    "glArrayElementEXT",
+    "glTexParameterIuiv",
+    "glReplacementCodeuivSUN",
+    "glGetPerfQueryDataINTEL",
+    "glTextureSubImage3DEXT",
+    "glGetPathCommandsNV",
+    "glCopyTexImage1DEXT",
+    "glGetImageTransformParameterfvHP",
+    "glRasterPos3d",
+    "glUniformHandleui64ARB",
+    "glVertexAttribI1ui",
+    "glDeleteFragmentShaderATI",
+    "glPointParameteri",
+    "glSecondaryColor3iv",
+    "glProgramLocalParameterI4iNV",
+    "glDisableClientState",
+    "glGetVertexAttribfvNV",
+    "glDrawBuffer",
+    "glWindowPos3f",
+    "glVertexStream3dvATI",
+    "glColor4s",
+    "glVertexStream2svATI",
+    "glGetTexParameterIivEXT",
+    "glColor4dv",
+    "glCombinerParameterfNV",
+    "glMultiTexCoord1iv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib3d",
+    "glMultiDrawArraysIndirectCount",
+    "glGetBufferParameterivARB",
+    "glAlphaFragmentOp2ATI",
+    "glMapVertexAttrib2fAPPLE",
+    "glVertexAttrib4ubvARB",
+    "glTextureParameterIivEXT",
+    "glGetPerfMonitorGroupStringAMD",
+    "glPathStencilDepthOffsetNV",
+    "glGetVideoivNV",
+    "glGetVertexAttribIivEXT",
+    "glTexBufferEXT",
+    "glColorMaski",
+    "glUniform4i64vNV",
+    "glReplacementCodeuiColor4ubVertex3fSUN",
+    "glGetTextureSamplerHandleARB",
+    "glDeleteQueries",
+    "glVertexAttrib4ivARB",
+    "glVertexStream4svATI",
+    "glMatrixMultdEXT",
+    "glMatrixLoadTransposefEXT",
+    "glBindRenderbuffer",
+    "glVertexAttrib4NivARB",
+    "glEvalCoord2xOES",
+    "glRasterPos2i",
+    "glProgramUniform1ui64NV",
+    "glVertexAttribL2ui64vNV",
+    "glScissorIndexedv",
+    "glUniform2iARB",
+    "glTextureStorageMem1DEXT",
+    "glMultiTexCoord2dv",
+    "glWindowPos4fvMESA",
+    "glColor3ubv",
+    "glTransformFeedbackVaryings",
+    "glVertexPointervINTEL",
+    "glNormal3fVertex3fvSUN",
+    "glCopyConvolutionFilter2D",
+    "glTexStorage3DMultisample",
+    "glGetMapAttribParameterivNV",
+    "glMatrixPushEXT",
+    "glVertex4fv",
+    "glVertexAttribL1dEXT",
+    "glGetProgramEnvParameterIuivNV",
+    "glNormalP3uiv",
+    "glVertexAttrib3dNV",
+    "glConvolutionParameterivEXT",
+    "glVertexAttrib2dARB",
+    "glBinormalPointerEXT",
+    "glFramebufferSampleLocationsfvARB",
+    "glUniformBufferEXT",
+    "glVertexAttrib3sv",
+    "glClipPlanefOES",
+    "glGetInteger64v",
+    "glLoadTransposeMatrixxOES",
+    "glMultiTexSubImage2DEXT",
+    "glMultiTexCoord2iv",
+    "glNamedFramebufferSamplePositionsfvAMD",
+    "glVertex2f",
+    "glVertexAttribs3svNV",
+    "glGetRenderbufferParameterivEXT",
+    "glProgramUniformMatrix3x4fvEXT",
+    "glCompressedMultiTexImage1DEXT",
+    "glGetTexParameterIuiv",
+    "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glAreProgramsResidentNV",
+    "glMultiTexCoord1s",
+    "glTexPageCommitmentARB",
+    "glGenVertexArrays",
+    "glGetImageTransformParameterivHP",
+    "glTexBumpParameterfvATI",
+    "glClearNamedBufferData",
+    "glVertexAttribI4i",
+    "glVertexAttribDivisor",
+    "glTextureParameteriEXT",
+    "glIsTransformFeedback",
+    "glGetMultiTexParameterIuivEXT",
+    "glUniform3i64ARB",
+    "glSecondaryColor3sEXT",
+    "glMultiDrawMeshTasksIndirectNV",
+    "glGetMultiTexLevelParameterfvEXT",
+    "glRectxOES",
+    "glWindowPos3iv",
+    "glDeletePerfQueryINTEL",
+    "glGetnUniformuivARB",
+    "glGetnColorTableARB",
+    "glPathParameterfvNV",
+    "glPixelMapx",
+    "glUniformHandleui64vARB",
+    "glCopyMultiTexImage2DEXT",
+    "glWindowPos2fv",
+    "glVDPAURegisterVideoSurfaceNV",
+    "glFlushRasterSGIX",
+    "glMultiTexCoord2sARB",
+    "glUniform4uiEXT",
+    "glColor3d",
+    "glBindBufferRange",
+    "glSecondaryColor3bvEXT",
+    "glVertexAttrib4fvARB",
+    "glProgramUniform4uiv",
+    "glShaderBinary",
+    "glGetVideoCaptureivNV",
+    "glGetMinmaxParameterivEXT",
+    "glGenSemaphoresEXT",
+    "glVertexAttribPointer",
+    "glProgramUniform2ui64vARB",
+    "glTexCoord4fv",
+    "glGlobalAlphaFactorbSUN",
+    "glFragmentMaterialfvSGIX",
+    "glGetOcclusionQueryivNV",
+    "glProgramUniform2fv",
+    "glBindMultiTextureEXT",
+    "glTexCoord2iv",
+    "glUniform2ui64NV",
+    "glNamedRenderbufferStorageEXT",
+    "glProgramUniform3uivEXT",
+    "glCompressedTextureSubImage3D",
+    "glSecondaryColor3ui",
+    "glGetHistogramParameterfvEXT",
+    "glVertexAttribIFormat",
+    "glRects",
+    "glVertexAttribL2dvEXT",
+    "glMultiTexCoord3dARB",
+    "glVertexAttrib4bvARB",
+    "glReadInstrumentsSGIX",
+    "glProgramUniform1i64ARB",
+    "glWaitVkSemaphoreNV",
+    "glVertexAttribI4uivEXT",
+    "glBufferStorageMemEXT",
+    "glGetPerfCounterInfoINTEL",
+    "glNormalStream3bvATI",
+    "glGetPixelMapfv",
+    "glClearNamedFramebufferfv",
+    "glProgramEnvParameter4dvARB",
+    "glPNTrianglesfATI",
+    "glGetColorTableParameterfvSGI",
+    "glNamedBufferAttachMemoryNV",
+    "glEvalCoord1dv",
+    "glFogCoordPointerEXT",
+    "glUploadGpuMaskNVX",
+    "glBindProgramPipeline",
+    "glPointParameterfvEXT",
+    "glEnableClientStateIndexedEXT",
+    "glProgramUniformMatrix4x2fv",
+    "glTransformFeedbackBufferRange",
+    "glImportSemaphoreFdEXT",
+    "glTextureStorage3DEXT",
+    "glMultiTexCoord4f",
+    "glUniform3fARB",
+    "glVertexStream3iATI",
+    "glDeformationMap3dSGIX",
+    "glBindTextureUnit",
+    "glVertexAttrib2fv",
+    "glUniform2iv",
+    "glFramebufferTextureFaceARB",
+    "glAttachShader",
+    "glDeleteBuffersARB",
+    "glGetMapParameterfvNV",
+    "glTexCoord4xOES",
+    "glTexBufferARB",
+    "glVertex2hNV",
+    "glProgramParameter4fNV",
+    "glUniform4ivARB",
+    "glDisable",
+    "glFrameTerminatorGREMEDY",
+    "glMatrixLoaddEXT",
+    "glUniform2fvARB",
+    "glVertexAttribL1i64vNV",
+    "glWindowPos3fARB",
+    "glIsPointInFillPathNV",
+    "glBindProgramNV",
+    "glCullFace",
+    "glColor3s",
+    "glGetTextureParameterIiv",
+    "glEnableVertexArrayAttrib",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    "glGetTexGeniv",
+    "glProgramUniformMatrix3x4fv",
+    "glLoadMatrixf",
+    "glTexFilterFuncSGIS",
+    "glVertexAttribI3iv",
+    "glVertexWeightfvEXT",
+    "glProgramUniform1uiEXT",
+    "glProgramPathFragmentInputGenNV",
+    "glVertexAttribI4iEXT",
+    "glEnableClientStateiEXT",
+    "glProgramUniform4i",
+    "glClearColorIuiEXT",
+    "glProgramUniformMatrix4x2fvEXT",
+    "glConvolutionParameterxvOES",
+    "glProgramBufferParametersIivNV",
+    "glGetUniformOffsetEXT",
+    "glTextureBufferEXT",
+    "glBeginTransformFeedbackNV",
+    "glNamedFramebufferTextureLayerEXT",
+    "glSecondaryColorPointer",
+    "glCopyColorSubTable",
+    "glCopyTexSubImage3DEXT",
+    "glTextureParameterfEXT",
+    "glFragmentMaterialiSGIX",
+    "glGenVertexShadersEXT",
+    "glBeginQuery",
+    "glMultiTexCoord3sv",
+    "glScalexOES",
+    "glTangent3ivEXT",
+    "glValidateProgramPipeline",
+    "glLightModelxOES",
+    "glDebugMessageCallback",
+    "glFragmentLightfvSGIX",
+    "glLightModeli",
+    "glIglooInterfaceSGIX",
+    "glSecondaryColor3dvEXT",
+    "glMultiDrawElementsBaseVertex",
+    "glTexCoord2d",
+    "glPrimitiveBoundingBoxARB",
+    "glMatrixLoadfEXT",
+    "glSpriteParameterfvSGIX",
+    "glIndexsv",
+    "glVertexP4ui",
+    "glProgramUniform1ui64vNV",
+    "glGetDoublei_vEXT",
+    "glCoverStrokePathInstancedNV",
+    "glColor4ubVertex3fvSUN",
+    "glDrawCommandsStatesAddressNV",
+    "glDispatchComputeGroupSizeARB",
+    "glPixelTransformParameterivEXT",
+    "glBufferStorageExternalEXT",
+    "glVertexAttribL3i64vNV",
+    "glProgramUniform3i64vARB",
+    "glGenNamesAMD",
+    "glGetNamedFramebufferParameteriv",
+    "glProgramUniform2ui64vNV",
+    "glGetInteger64i_v",
+    "glVertexArrayVertexAttribOffsetEXT",
+    "glBlendParameteriNV",
+    "glIsTextureEXT",
+    "glNamedBufferSubData",
+    "glTexGend",
+    "glGetnCompressedTexImageARB",
+    "glGetProgramEnvParameterfvARB",
+    "glVariantsvEXT",
+    "glDrawMeshTasksIndirectNV",
+    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+    "glNormal3b",
+    "glMaterialiv",
+    "glPixelTransferxOES",
+    "glColor3ui",
+    "glMultiTexCoordP1ui",
+    "glColor4bv",
+    "glClearTexSubImage",
+    "glTestFenceAPPLE",
+    "glBufferDataARB",
+    "glLoadIdentityDeformationMapSGIX",
+    "glMemoryBarrierEXT",
+    "glVertexArrayVertexAttribIFormatEXT",
+    "glCopyTextureSubImage2D",
+    "glUniform1ui64NV",
+    "glVertexAttrib4Nusv",
+    "glWindowPos4dvMESA",
+    "glGetMemoryObjectDetachedResourcesuivNV",
+    "glGetObjectBufferfvATI",
+    "glMultiTexCoord3bvOES",
+    "glMultiTexGenfEXT",
+    "glWindowPos3dMESA",
+    "glMultiTexCoord1xOES",
+    "glNamedFramebufferRenderbufferEXT",
+    "glWeightbvARB",
+    "glPrimitiveRestartIndexNV",
+    "glClearAccum",
+    "glFramebufferTexture3DEXT",
+    "glNormal3xOES",
+    "glUniform1uivEXT",
+    "glGetnMapdv",
+    "glRasterSamplesEXT",
+    "glPixelTransformParameteriEXT",
+    "glProgramUniformMatrix2x4dv",
+    "glRasterPos2iv",
+    "glNamedFramebufferTexture",
+    "glTextureStorageMem3DMultisampleEXT",
+    "glRasterPos4d",
+    "glBlendEquationiARB",
+    "glUniform1d",
+    "glMatrixRotatedEXT",
+    "glLightiv",
+    "glEnableVertexAttribArray",
+    "glUniform4iARB",
+    "glFramebufferSamplePositionsfvAMD",
+    "glDrawRangeElementArrayAPPLE",
+    "glGetSeparableFilterEXT",
+    "glTextureParameterivEXT",
+    "glInsertEventMarkerEXT",
+    "glGetnConvolutionFilter",
+    "glGetLocalConstantFloatvEXT",
+    "glVertexAttribI1iEXT",
+    "glNormal3sv",
+    "glTestObjectAPPLE",
+    "glGetTextureLevelParameterfvEXT",
+    "glVertexAttrib1sNV",
+    "glFogf",
+    "glMulticastFramebufferSampleLocationsfvNV",
+    "glVertexStream4dATI",
+    "glVideoCaptureStreamParameterdvNV",
+    "glVertex3hNV",
+    "glColor4i",
+    "glShaderSourceARB",
+    "glProgramUniformMatrix3dvEXT",
+    "glUniform2dv",
+    "glGenLists",
+    "glVertexAttrib4svNV",
+    "glVDPAUFiniNV",
+    "glPointParameterivNV",
+    "glGenTextures",
+    "glGetNamedBufferPointervEXT",
+    "glClientActiveVertexStreamATI",
+    "glGetSamplerParameterfv",
+    "glWindowPos3dv",
+    "glProgramNamedParameter4fvNV",
+    "glRectfv",
+    "glFragmentMaterialivSGIX",
+    "glColorPointervINTEL",
+    "glBeginTransformFeedback",
+    "glVertexAttribs3fvNV",
+    "glFogCoordf",
+    "glEnableVariantClientStateEXT",
+    "glSignalSemaphoreui64NVX",
+    "glBindBuffersRange",
+    "glLightModeliv",
+    "glVertex4dv",
+    "glVertexAttrib4d",
+    "glUniform2ui64vARB",
+    "glMatrixFrustumEXT",
+    "glFlushMappedBufferRange",
+    "glProgramUniformMatrix2x3fvEXT",
+    "glCallList",
+    "glTextureSubImage2D",
+    "glProgramLocalParameters4fvEXT",
+    "glInvalidateNamedFramebufferSubData",
+    "glProgramUniform3uiv",
+    "glRasterPos3xvOES",
+    "glUniform1i64NV",
+    "glRasterPos2fv",
+    "glCompressedMultiTexImage2DEXT",
+    "glMulticastViewportPositionWScaleNVX",
+    "glNamedProgramLocalParameterI4uivEXT",
+    "glFragmentCoverageColorNV",
+    "glGetNamedBufferSubData",
+    "glVertex2xvOES",
+    "glUniform2i",
+    "glBindShadingRateImageNV",
+    "glNamedFramebufferRenderbuffer",
+    "glCreateShaderProgramEXT",
+    "glPassTexCoordATI",
+    "glMapObjectBufferATI",
+    "glLoadMatrixxOES",
+    "glFrustumfOES",
+    "glVDPAUUnregisterSurfaceNV",
+    "glGenSymbolsEXT",
+    "glMultiTexCoord3bOES",
+    "glGetLocalConstantIntegervEXT",
+    "glVertex4f",
+    "glRasterPos3sv",
+    "glVertexStream1dvATI",
+    "glMultiDrawArraysIndirectBindlessCountNV",
+    "glBlendFunc",
+    "glMemoryBarrierByRegion",
+    "glGetStringi",
+    "glGetPathColorGenfvNV",
+    "glSecondaryColor3uiEXT",
+    "glPathTexGenNV",
+    "glVideoCaptureStreamParameterfvNV",
+    "glProgramUniformMatrix2x4fvEXT",
+    "glProgramUniform2d",
+    "glProgramUniform2i64vNV",
+    "glCopyTexSubImage1DEXT",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniform1dEXT",
+    "glMultiTexCoord4xOES",
+    "glVertex2s",
+    "glVertex4iv",
+    "glObjectPtrLabel",
+    "glVertex2bvOES",
+    "glMultiTexCoord4dv",
+    "glMaterialfv",
+    "glVertexAttribs2svNV",
+    "glDebugMessageControl",
+    "glVertexArrayBindingDivisor",
+    "glVertexAttribs1svNV",
+    "glBeginVideoCaptureNV",
+    "glColorFragmentOp2ATI",
+    "glTagSampleBufferSGIX",
+    "glVertex4hNV",
+    "glGetInstrumentsSGIX",
+    "glVertexAttrib2sARB",
+    "glGetPerfQueryIdByNameINTEL",
+    "glGetNextPerfQueryIdINTEL",
+    "glDrawElementsInstancedARB",
+    "glScissorIndexed",
+    "glPathMemoryGlyphIndexArrayNV",
+    "glStencilFunc",
+    "glTexCoordP2uiv",
+    "glTexCoord2fv",
+    "glMultiTexGendvEXT",
+    "glImageTransformParameterfvHP",
+    "glReleaseKeyedMutexWin32EXT",
+    "glPointParameterfEXT",
+    "glVertexArrayVertexAttribLOffsetEXT",
+    "glGetDebugMessageLog",
+    "glCompressedTextureSubImage2DEXT",
+    "glRasterPos3fv",
+    "glUniform1i64vARB",
+    "glTexCoord3f",
+    "glSamplerParameteriv",
+    "glIsNameAMD",
+    "glInvalidateFramebuffer",
+    "glVertexAttribL4dEXT",
+    "glNamedFramebufferDrawBuffer",
+    "glDrawElementsInstancedBaseInstance",
+    "glColor4uiv",
+    "glNamedProgramLocalParameterI4uiEXT",
+    "glGenTexturesEXT",
+    "glUniform1ui",
+    "glPauseTransformFeedback",
+    "glMultTransposeMatrixxOES",
+    "glTextureSubImage3D",
+    "glWindowPos2d",
+    "glBindFragDataLocationEXT",
+    "glDebugMessageCallbackAMD",
+    "glTexImage3DEXT",
+    "glGetArrayObjectivATI",
+    "glGetVariantFloatvEXT",
+    "glVertexAttribI4iv",
+    "glDisableVertexAttribArray",
+    "glSetFenceAPPLE",
+    "glGetProgramiv",
+    "glGetNamedBufferParameterui64vNV",
+    "glSecondaryColor3fEXT",
+    "glSecondaryColor3b",
+    "glProgramUniform4dEXT",
+    "glGetObjectParameterivARB",
+    "glReplacementCodeuiTexCoord2fVertex3fSUN",
+    "glVertexAttrib1fvARB",
+    "glProgramUniform3i64vNV",
+    "glTextureImage2DMultisampleNV",
+    "glObjectUnpurgeableAPPLE",
+    "glRectd",
+    "glGetTextureLevelParameteriv",
+    "glGetFramebufferParameterfvAMD",
+    "glWindowPos3ivMESA",
+    "glSecondaryColorP3uiv",
+    "glVertexAttrib4usv",
+    "glMultiTexCoord2hvNV",
+    "glTextureSubImage1DEXT",
+    "glUniformui64NV",
+    "glRecti",
+    "glDrawElements",
+    "glProgramUniform4dv",
+    "glCompressedTexImage2D",
+    "glMultiTexEnviEXT",
+    "glMulticastBlitFramebufferNV",
+    "glTextureParameteri",
+    "glStencilThenCoverFillPathInstancedNV",
+    "glUniform4fv",
+    "glPathCoordsNV",
+    "glTextureParameterf",
+    "glPolygonOffsetClampEXT",
+    "glMultiDrawArrays",
+    "glIsTexture",
+    "glVertexAttribI4ubv",
+    "glProgramUniform1ui",
+    "glVertexAttribs1dvNV",
+    "glVertexAttribI4usv",
+    "glGetVertexAttribArrayObjectfvATI",
+    "glProgramUniformMatrix4fv",
+    "glGetMaterialfv",
+    "glUnmapTexture2DINTEL",
+    "glMultiTexSubImage1DEXT",
+    "glOrthofOES",
+    "glUniformMatrix3x2fv",
+    "glMultiDrawArraysIndirectCountARB",
+    "glQueryResourceTagNV",
+    "glCompressedTexSubImage2DARB",
+    "glGenQueries",
+    "glMulticastWaitSyncNV",
+    "glWindowPos3svARB",
+    "glVertexAttribs2fvNV",
+    "glColor4us",
+    "glBeginPerfQueryINTEL",
+    "glWeightusvARB",
+    "glDeleteStatesNV",
+    "glStencilThenCoverFillPathNV",
+    "glProgramUniform1d",
+    "glGetTexParameterfv",
+    "glClearDepthxOES",
+    "glTexCoord2fVertex3fSUN",
+    "glNamedFramebufferParameteriEXT",
+    "glNormalStream3dATI",
+    "glWindowPos3ivARB",
+    "glImportSemaphoreWin32NameEXT",
+    "glStencilMaskSeparate",
+    "glClearStencil",
+    "glWindowPos2svMESA",
+    "glAlphaFunc",
+    "glLoadTransposeMatrixf",
+    "glUniformMatrix3x4dv",
+    "glScissorExclusiveNV",
+    "glLoadIdentity",
+    "glVariantfvEXT",
+    "glGetHistogramEXT",
+    "glBlendFuncSeparateiARB",
+    "glCreateProgram",
+    "glMultiDrawElementsIndirectAMD",
+    "glBinormal3svEXT",
+    "glMulticastGetQueryObjectui64vNV",
+    "glPushName",
+    "glIndexiv",
+    "glLGPUCopyImageSubDataNVX",
+    "glMultiDrawElementsEXT",
+    "glGetVideoi64vNV",
+    "glGetQueryObjectivARB",
+    "glVertexArrayAttribFormat",
+    "glVertexStream4ivATI",
+    "glGetNamedProgramivEXT",
+    "glVariantdvEXT",
+    "glDepthRange",
+    "glGetFinalCombinerInputParameterivNV",
+    "glSignalSemaphoreEXT",
+    "glVertexStream3ivATI",
+    "glTextureParameterfv",
+    "glGetCombinerInputParameterivNV",
+    "glGetMultiTexGenfvEXT",
+    "glUniformui64vNV",
+    "glApplyTextureEXT",
+    "glVertexAttribI4uiv",
+    "glEvalCoord1fv",
+    "glGetUniformi64vNV",
+    "glGetSamplerParameterIiv",
+    "glUniform3uiEXT",
+    "glGetProgramLocalParameterdvARB",
+    "glWindowPos2dMESA",
+    "glMultiTexCoord2ivARB",
+    "glRasterPos4f",
+    "glMatrixMode",
+    "glLightEnviSGIX",
+    "glClearBufferSubData",
+    "glFogCoordd",
+    "glMakeTextureHandleNonResidentARB",
+    "glEnableVertexAttribAPPLE",
+    "glPopName",
+    "glUnmapNamedBuffer",
+    "glVideoCaptureNV",
+    "glWindowPos2iARB",
+    "glSecondaryColor3ubv",
+    "glGetQueryBufferObjectui64v",
+    "glMultiTexCoord2xvOES",
+    "glFragmentMaterialfSGIX",
+    "glProgramUniform2uiv",
+    "glUnmapBuffer",
+    "glGetVertexAttribdv",
+    "glGetOcclusionQueryuivNV",
+    "glGetActiveAttribARB",
+    "glFragmentLightModelfvSGIX",
+    "glTexCoordP4ui",
+    "glProgramUniformMatrix2x4dvEXT",
+    "glClearColorxOES",
+    "glMapGrid2xOES",
+    "glUniform2ui64ARB",
+    "glUniform2ivARB",
+    "glUniformMatrix4fvARB",
+    "glVertexAttribL1dvEXT",
+    "glSecondaryColor3ivEXT",
+    "glVertexAttrib4NubvARB",
+    "glEvalCoord2dv",
+    "glGetnHistogram",
+    "glGetMultiTexParameterIivEXT",
+    "glTexCoord1sv",
+    "glUniform2i64vARB",
+    "glProgramUniform1iEXT",
+    "glIsEnabled",
+    "glVertexAttribDivisorARB",
+    "glProgramUniform2dvEXT",
+    "glVertexStream2fATI",
+    "glCoverageModulationTableNV",
+    "glLightxvOES",
+    "glNormalP3ui",
+    "glMatrixTranslatedEXT",
+    "glSamplerParameterfv",
+    "glVertexAttrib2d",
+    "glGetPointerv",
+    "glClientWaitSemaphoreui64NVX",
+    "glUniform1ui64vNV",
+    "glTexStorage2D",
+    "glMultiTexCoord3iARB",
+    "glBufferParameteriAPPLE",
+    "glTexCoord2fVertex3fvSUN",
+    "glMapNamedBufferRangeEXT",
+    "glTexCoord4sv",
+    "glFramebufferTextureFaceEXT",
+    "glColor3dv",
+    "glMultiTexCoord4bOES",
+    "glGetFenceivNV",
+    "glSampleMapATI",
+    "glProgramUniform4ui64vNV",
+    "glPrioritizeTexturesEXT",
+    "glEnd",
+    "glPixelTexGenParameterivSGIS",
+    "glBindTransformFeedback",
+    "glNamedFramebufferTexture1DEXT",
+    "glWindowPos3fvMESA",
+    "glMultiTexCoordPointerEXT",
+    "glTangent3iEXT",
+    "glClearNamedBufferSubData",
+    "glSemaphoreParameterui64vEXT",
+    "glPixelTransformParameterfvEXT",
+    "glGetnUniformivARB",
+    "glWindowPos2sv",
+    "glTexSubImage3D",
+    "glGetFloatv",
+    "glClearNamedFramebufferfi",
+    "glTextureStorage1DEXT",
+    "glVertexAttribs2dvNV",
+    "glMultiTexParameterfEXT",
+    "glIsVertexArrayAPPLE",
+    "glUniformMatrix4x2fv",
+    "glProgramUniform2dEXT",
+    "glBindImageTextures",
+    "glDisableVertexAttribAPPLE",
+    "glFogCoordhNV",
+    "glGetVertexArrayIntegervEXT",
+    "glPresentFrameKeyedNV",
+    "glPopDebugGroup",
+    "glGetObjectLabel",
+    "glGetVertexAttribivARB",
+    "glDepthMask",
+    "glMultiTexCoord4fARB",
+    "glGetError",
+    "glCompileShaderIncludeARB",
+    "glBindFramebufferEXT",
+    "glVertexAttribI1uivEXT",
+    "glVertexAttribI3ui",
+    "glLightModelxvOES",
+    "glTangent3svEXT",
+    "glFramebufferTexture3D",
+    "glProgramUniform3dv",
+    "glUniformMatrix2dv",
+    "glGetDebugMessageLogAMD",
+    "glTransformFeedbackAttribsNV",
+    "glGetActiveSubroutineName",
+    "glTexStorageMem3DMultisampleEXT",
+    "glGetSubroutineIndex",
+    "glGetnUniformuiv",
+    "glVertex3fv",
+    "glMultiTexCoord4iARB",
+    "glGetSubroutineUniformLocation",
+    "glWindowPos4fMESA",
+    "glGetProgramPipelineInfoLog",
+    "glProgramBufferParametersfvNV",
+    "glWeightsvARB",
+    "glVariantArrayObjectATI",
+    "glUniform2i64ARB",
+    "glProgramParameters4dvNV",
+    "glNormalStream3svATI",
+    "glProgramUniformMatrix3x2dv",
+    "glPixelStoref",
+    "glDrawBuffersATI",
+    "glPolygonStipple",
+    "glDisableVertexArrayAttrib",
+    "glLGPUInterlockNVX",
+    "glUniform3ui64vNV",
+    "glGetPathLengthNV",
+    "glWindowPos2ivMESA",
+    "glGetIntegerv",
+    "glMultiTexCoord1hNV",
+    "glTexCoord3dv",
+    "glFramebufferTexture1DEXT",
+    "glCallLists",
+    "glPixelMapuiv",
+    "glPassThroughxOES",
+    "glStartInstrumentsSGIX",
+    "glTexCoord3sv",
+    "glCopyTextureSubImage1DEXT",
+    "glVertexAttribL2dv",
+    "glMakeImageHandleResidentNV",
+    "glUniform2uiEXT",
+    "glProgramUniform2i64NV",
+    "glColor3ub",
+    "glGetUniformIndices",
+    "glVariantusvEXT",
+    "glListParameterivSGIX",
+    "glGlobalAlphaFactorusSUN",
+    "glVertex4bvOES",
+    "glEnableVertexArrayEXT",
+    "glReadnPixelsARB",
+    "glTexCoordPointer",
+    "glVertexStream2dvATI",
+    "glVertex2dv",
+    "glMultiTexImage3DEXT",
+    "glNamedFramebufferReadBuffer",
+    "glMapGrid2f",
+    "glProgramUniform3d",
+    "glProgramUniformMatrix2x3dv",
+    "glGetProgramStringNV",
+    "glPathFogGenNV",
+    "glMulticastCopyBufferSubDataNV",
+    "glTessellationModeAMD",
+    "glNamedFramebufferTextureFaceEXT",
+    "glVertex4s",
+    "glDebugMessageControlARB",
+    "glProgramUniform4fvEXT",
+    "glGetConvolutionParameterfv",
+    "glVertexAttribIPointerEXT",
+    "glVertexBlendARB",
+    "glDisableVertexArrayAttribEXT",
+    "glCreateShader",
+    "glSampleCoverageARB",
+    "glGetNamedProgramLocalParameterIivEXT",
+    "glTexCoordP1ui",
+    "glVertexAttribLFormatNV",
+    "glRenderbufferStorage",
+    "glIndexf",
+    "glMulticastViewportArrayvNVX",
+    "glGetNamedStringARB",
+    "glVertexPointer",
+    "glGetTexParameterPointervAPPLE",
+    "glVertexAttrib4sARB",
+    "glVertexAttrib2sNV",
+    "glTexturePageCommitmentEXT",
+    "glGenTransformFeedbacks",
+    "glClipControl",
+    "glColor3xOES",
+    "glGetnPixelMapuiv",
+    "glVertexAttrib4f",
+    "glFinalCombinerInputNV",
+    "glFramebufferTextureMultiviewOVR",
+    "glListParameterfvSGIX",
+    "glTranslatexOES",
+    "glSetInvariantEXT",
+    "glBitmap",
+    "glMultiTexCoord4bvOES",
+    "glVertexAttribP4uiv",
+    "glVertexAttribL4i64NV",
+    "glMapTexture2DINTEL",
+    "glVertexAttrib3dvNV",
+    "glMultiTexCoord2s",
+    "glWindowPos2ivARB",
+    "glColorMaskIndexedEXT",
+    "glGetFramebufferAttachmentParameteriv",
+    "glMultMatrixd",
+    "glGetTransformFeedbackVarying",
+    "glUniform4i64NV",
+    "glBlendEquationIndexedAMD",
+    "glProgramNamedParameter4dNV",
+    "glTextureStorage2DMultisample",
+    "glClearTexImage",
+    "glFragmentLightfSGIX",
+    "glGetProgramLocalParameterIuivNV",
+    "glMultiTexCoord2sv",
+    "glCopyConvolutionFilter1DEXT",
+    "glDeleteMemoryObjectsEXT",
+    "glVertexStream3fvATI",
+    "glIndexMaterialEXT",
+    "glDrawElementsIndirect",
+    "glImportMemoryFdEXT",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoord1dv",
+    "glVertexAttribP2uiv",
+    "glCompressedTextureSubImage3DEXT",
+    "glDrawCommandsStatesNV",
+    "glGenFencesAPPLE",
+    "glColorMask",
+    "glGetConvolutionParameteriv",
+    "glPatchParameteri",
+    "glColorTableParameteriv",
+    "glMulticastGetQueryObjectuivNV",
+    "glLineWidthxOES",
+    "glGetTextureHandleARB",
+    "glDrawElementsInstancedBaseVertex",
+    "glColor4ubVertex3fSUN",
+};
+
+#endif //POJAVLAUNCHER_GL_PROC_NAMES_H
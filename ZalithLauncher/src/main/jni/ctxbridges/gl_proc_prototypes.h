@@ -0,0 +1,2971 @@
+//
+// Generated by gen_gl_proc_names.py from GL/gl.h and GL/glext.h, do not edit.
+//
+// Every entry point of gl_proc_names.h with its slot, include it after defining
+//   GL_PROC_VOID(slot, name, parameters, arguments)
+//   GL_PROC(slot, result, name, parameters, arguments)
+//
+
+GL_PROC_VOID(0, glVertexAttribL1i64NV, (GLuint index, GLint64EXT x), (index, x))
+GL_PROC_VOID(1, glTransformFeedbackVaryingsEXT, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GL_PROC_VOID(2, glVDPAUGetSurfaceivNV, (GLvdpauSurfaceNV surface, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (surface, pname, bufSize, length, values))
+GL_PROC_VOID(3, glNormalPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GL_PROC_VOID(4, glGenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GL_PROC_VOID(5, glMapParameterfvNV, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(6, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GL_PROC_VOID(7, glCombinerStageParameterfvNV, (GLenum stage, GLenum pname, const GLfloat *params), (stage, pname, params))
+GL_PROC_VOID(8, glVertexAttrib1fARB, (GLuint index, GLfloat x), (index, x))
+GL_PROC(9, GLboolean, glIsFenceNV, (GLuint fence), (fence))
+GL_PROC_VOID(10, glVertexAttrib4dvNV, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(11, glVertexAttribArrayObjectATI, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset), (index, size, type, normalized, stride, buffer, offset))
+GL_PROC_VOID(12, glTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, width, format, type, pixels))
+GL_PROC_VOID(13, glProgramParameteriEXT, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GL_PROC_VOID(14, glGetnColorTable, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GL_PROC_VOID(15, glVertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(16, glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels), (target, level, format, type, pixels))
+GL_PROC_VOID(17, glTextureStorage2D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+GL_PROC_VOID(18, glPassThrough, (GLfloat token), (token))
+GL_PROC_VOID(19, glGetQueryObjecti64vEXT, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GL_PROC_VOID(20, glSecondaryColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GL_PROC_VOID(21, glGetClipPlane, (GLenum plane, GLdouble *equation), (plane, equation))
+GL_PROC_VOID(22, glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v), (rc, tc, n, v))
+GL_PROC_VOID(23, glMultTransposeMatrixd, (const GLdouble m[16]), (m))
+GL_PROC_VOID(24, glCopyColorTableSGI, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GL_PROC_VOID(25, glVertexAttrib4fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GL_PROC_VOID(26, glGetVertexAttribPointervARB, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GL_PROC_VOID(27, glDrawRangeElementsEXT, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GL_PROC_VOID(28, glRectiv, (const GLint *v1, const GLint *v2), (v1, v2))
+GL_PROC_VOID(29, glCompressedTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, border, imageSize, bits))
+GL_PROC_VOID(30, glClearAccumxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GL_PROC_VOID(31, glVertexAttrib3svNV, (GLuint index, const GLshort *v), (index, v))
+GL_PROC(32, GLuint, glGetProgramResourceIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GL_PROC_VOID(33, glSecondaryColor3sv, (const GLshort *v), (v))
+GL_PROC_VOID(34, glEdgeFlagv, (const GLboolean *flag), (flag))
+GL_PROC_VOID(35, glTexCoord1iv, (const GLint *v), (v))
+GL_PROC_VOID(36, glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, nx, ny, nz, x, y, z))
+GL_PROC_VOID(37, glImportMemoryWin32HandleEXT, (GLuint memory, GLuint64 size, GLenum handleType, void *handle), (memory, size, handleType, handle))
+GL_PROC_VOID(38, glWindowPos2i, (GLint x, GLint y), (x, y))
+GL_PROC_VOID(39, glBindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+GL_PROC_VOID(40, glVertexAttribs1hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GL_PROC_VOID(41, glVertexAttrib4NusvARB, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(42, glMemoryBarrier, (GLbitfield barriers), (barriers))
+GL_PROC_VOID(43, glMultiTexCoord2f, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GL_PROC_VOID(44, glTexImage4DSGIS, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, size4d, border, format, type, pixels))
+GL_PROC_VOID(45, glGetIntegerui64vNV, (GLenum value, GLuint64EXT *result), (value, result))
+GL_PROC_VOID(46, glFeedbackBuffer, (GLsizei size, GLenum type, GLfloat *buffer), (size, type, buffer))
+GL_PROC_VOID(47, glReplacementCodeusSUN, (GLushort code), (code))
+GL_PROC_VOID(48, glFramebufferRenderbufferEXT, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GL_PROC_VOID(49, glStopInstrumentsSGIX, (GLint marker), (marker))
+GL_PROC(50, GLenum, glGetGraphicsResetStatusARB, (void), ())
+GL_PROC_VOID(51, glProgramEnvParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GL_PROC_VOID(52, glCopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GL_PROC_VOID(53, glBindTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GL_PROC_VOID(54, glGetActiveUniformARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GL_PROC_VOID(55, glVertex2hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(56, glSecondaryColor3ubvEXT, (const GLubyte *v), (v))
+GL_PROC_VOID(57, glTexRenderbufferNV, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GL_PROC_VOID(58, glVertexAttribL1dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(59, glMultiTexCoord1bvOES, (GLenum texture, const GLbyte *coords), (texture, coords))
+GL_PROC_VOID(60, glTexImage1D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, border, format, type, pixels))
+GL_PROC_VOID(61, glGetMemoryObjectParameterivEXT, (GLuint memoryObject, GLenum pname, GLint *params), (memoryObject, pname, params))
+GL_PROC_VOID(62, glVertexAttribs4svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GL_PROC_VOID(63, glVertexAttrib4sv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(64, glGetHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values), (target, reset, format, type, values))
+GL_PROC_VOID(65, glValidateProgram, (GLuint program), (program))
+GL_PROC_VOID(66, glGetPathSpacingNV, (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing), (pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing))
+GL_PROC_VOID(67, glTransformFeedbackVaryingsNV, (GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode), (program, count, locations, bufferMode))
+GL_PROC_VOID(68, glVertexArrayAttribBinding, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GL_PROC_VOID(69, glProgramUniform4ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GL_PROC_VOID(70, glEnableClientState, (GLenum cap), (cap))
+GL_PROC_VOID(71, glMultiDrawElementArrayAPPLE, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount))
+GL_PROC_VOID(72, glRasterPos4sv, (const GLshort *v), (v))
+GL_PROC_VOID(73, glVertexAttrib1dvARB, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(74, glDepthRangef, (GLfloat n, GLfloat f), (n, f))
+GL_PROC_VOID(75, glMultiDrawArraysEXT, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, first, count, primcount))
+GL_PROC_VOID(76, glTangent3sEXT, (GLshort tx, GLshort ty, GLshort tz), (tx, ty, tz))
+GL_PROC_VOID(77, glGetColorTable, (GLenum target, GLenum format, GLenum type, GLvoid *table), (target, format, type, table))
+GL_PROC_VOID(78, glGetVertexArrayIntegeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GL_PROC_VOID(79, glPathParameterfNV, (GLuint path, GLenum pname, GLfloat value), (path, pname, value))
+GL_PROC_VOID(80, glGetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name))
+GL_PROC_VOID(81, glCreateVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GL_PROC_VOID(82, glCopyColorSubTableEXT, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width))
+GL_PROC_VOID(83, glTexParameterIivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(84, glStencilFuncSeparateATI, (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask), (frontfunc, backfunc, ref, mask))
+GL_PROC_VOID(85, glRasterPos3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(86, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROC_VOID(87, glColorFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GL_PROC_VOID(88, glProgramUniformHandleui64ARB, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+GL_PROC(89, GLuint64, glGetImageHandleNV, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format))
+GL_PROC_VOID(90, glBeginConditionalRenderNV, (GLuint id, GLenum mode), (id, mode))
+GL_PROC_VOID(91, glRasterPos4fv, (const GLfloat *v), (v))
+GL_PROC(92, GLint, glGetFragDataIndex, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(93, glShaderOp3EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3), (op, res, arg1, arg2, arg3))
+GL_PROC_VOID(94, glDeleteFramebuffersEXT, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GL_PROC_VOID(95, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GL_PROC_VOID(96, glNamedBufferStorageExternalEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (buffer, offset, size, clientBuffer, flags))
+GL_PROC_VOID(97, glFrontFace, (GLenum mode), (mode))
+GL_PROC_VOID(98, glProgramUniformMatrix4x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(99, glTexParameterIuivEXT, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GL_PROC_VOID(100, glVertexAttribs2hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GL_PROC(101, GLuint, glCreateProgressFenceNVX, (void), ())
+GL_PROC_VOID(102, glProgramUniformMatrix4x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(103, glVertexAttrib3sNV, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GL_PROC_VOID(104, glCreateProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GL_PROC_VOID(105, glGetLightxOES, (GLenum light, GLenum pname, GLfixed *params), (light, pname, params))
+GL_PROC_VOID(106, glTexCoord2xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(107, glRasterPos2f, (GLfloat x, GLfloat y), (x, y))
+GL_PROC_VOID(108, glNormalPointervINTEL, (GLenum type, const void **pointer), (type, pointer))
+GL_PROC_VOID(109, glRasterPos2s, (GLshort x, GLshort y), (x, y))
+GL_PROC_VOID(110, glTexEnvi, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(111, glDeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GL_PROC_VOID(112, glGetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params))
+GL_PROC_VOID(113, glVertexAttrib3sARB, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GL_PROC_VOID(114, glGetPerfMonitorCounterInfoAMD, (GLuint group, GLuint counter, GLenum pname, void *data), (group, counter, pname, data))
+GL_PROC_VOID(115, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GL_PROC_VOID(116, glExecuteProgramNV, (GLenum target, GLuint id, const GLfloat *params), (target, id, params))
+GL_PROC_VOID(117, glMultiDrawElementsIndirectCount, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GL_PROC_VOID(118, glUniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+GL_PROC_VOID(119, glListParameterfSGIX, (GLuint list, GLenum pname, GLfloat param), (list, pname, param))
+GL_PROC_VOID(120, glInvalidateTexImage, (GLuint texture, GLint level), (texture, level))
+GL_PROC_VOID(121, glClientActiveTexture, (GLenum texture), (texture))
+GL_PROC_VOID(122, glListDrawCommandsStatesClientNV, (GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (list, segment, indirects, sizes, states, fbos, count))
+GL_PROC_VOID(123, glBinormal3ivEXT, (const GLint *v), (v))
+GL_PROC_VOID(124, glTexCoord4d, (GLdouble s, GLdouble t, GLdouble r, GLdouble q), (s, t, r, q))
+GL_PROC_VOID(125, glPrimitiveRestartIndex, (GLuint index), (index))
+GL_PROC_VOID(126, glRotatexOES, (GLfixed angle, GLfixed x, GLfixed y, GLfixed z), (angle, x, y, z))
+GL_PROC_VOID(127, glVertexAttribs3hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GL_PROC_VOID(128, glGenFencesNV, (GLsizei n, GLuint *fences), (n, fences))
+GL_PROC_VOID(129, glGetFramebufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(130, glSamplePatternSGIS, (GLenum pattern), (pattern))
+GL_PROC_VOID(131, glLoadTransposeMatrixd, (const GLdouble m[16]), (m))
+GL_PROC_VOID(132, glVertexAttribI4uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GL_PROC_VOID(133, glFramebufferTextureLayerEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GL_PROC_VOID(134, glIndexub, (GLubyte c), (c))
+GL_PROC_VOID(135, glTexCoord2bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(136, glBindBufferRangeNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GL_PROC_VOID(137, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_PROC_VOID(138, glTangent3fEXT, (GLfloat tx, GLfloat ty, GLfloat tz), (tx, ty, tz))
+GL_PROC_VOID(139, glWindowPos2f, (GLfloat x, GLfloat y), (x, y))
+GL_PROC_VOID(140, glColor4fv, (const GLfloat *v), (v))
+GL_PROC_VOID(141, glStencilOpValueAMD, (GLenum face, GLuint value), (face, value))
+GL_PROC_VOID(142, glLoadProgramNV, (GLenum target, GLuint id, GLsizei len, const GLubyte *program), (target, id, len, program))
+GL_PROC_VOID(143, glGetFloati_vEXT, (GLenum pname, GLuint index, GLfloat *params), (pname, index, params))
+GL_PROC_VOID(144, glShadingRateImageBarrierNV, (GLboolean synchronize), (synchronize))
+GL_PROC_VOID(145, glProgramUniform3ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(146, glWindowPos2iMESA, (GLint x, GLint y), (x, y))
+GL_PROC_VOID(147, glTexCoord3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(148, glGetMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint *params), (texunit, coord, pname, params))
+GL_PROC_VOID(149, glGetQueryBufferObjecti64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GL_PROC_VOID(150, glVertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(151, glProgramEnvParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GL_PROC_VOID(152, glVertexAttribL3ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v))
+GL_PROC_VOID(153, glClipPlanexOES, (GLenum plane, const GLfixed *equation), (plane, equation))
+GL_PROC_VOID(154, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GL_PROC_VOID(155, glAttachObjectARB, (GLhandleARB containerObj, GLhandleARB obj), (containerObj, obj))
+GL_PROC_VOID(156, glColor4hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha), (red, green, blue, alpha))
+GL_PROC_VOID(157, glMatrixScaledEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z))
+GL_PROC_VOID(158, glNamedFramebufferSampleLocationsfvNV, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v))
+GL_PROC_VOID(159, glColorP4ui, (GLenum type, GLuint color), (type, color))
+GL_PROC_VOID(160, glScissorExclusiveArrayvNV, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GL_PROC_VOID(161, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GL_PROC_VOID(162, glVertex4i, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GL_PROC_VOID(163, glCompressedTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, height, depth, border, imageSize, bits))
+GL_PROC_VOID(164, glUniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC(165, GLint, glGetProgramResourceLocationIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GL_PROC_VOID(166, glGetTextureParameteriv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GL_PROC_VOID(167, glDeleteTransformFeedbacksNV, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROC_VOID(168, glGetVertexAttribfvARB, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_PROC(169, GLvdpauSurfaceNV, glVDPAURegisterOutputSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames))
+GL_PROC_VOID(170, glMatrixMultTransposefEXT, (GLenum mode, const GLfloat *m), (mode, m))
+GL_PROC_VOID(171, glPushMatrix, (void), ())
+GL_PROC_VOID(172, glMultiTexCoord4fvARB, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(173, glDeleteProgram, (GLuint program), (program))
+GL_PROC(174, GLboolean, glAreTexturesResident, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences))
+GL_PROC_VOID(175, glBufferAttachMemoryNV, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset))
+GL_PROC(176, GLhandleARB, glCreateProgramObjectARB, (void), ())
+GL_PROC_VOID(177, glGetPathColorGenivNV, (GLenum color, GLenum pname, GLint *value), (color, pname, value))
+GL_PROC_VOID(178, glWindowPos3fvARB, (const GLfloat *v), (v))
+GL_PROC_VOID(179, glInsertComponentEXT, (GLuint res, GLuint src, GLuint num), (res, src, num))
+GL_PROC_VOID(180, glVertexAttrib2hvNV, (GLuint index, const GLhalfNV *v), (index, v))
+GL_PROC_VOID(181, glColorTableSGI, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalformat, width, format, type, table))
+GL_PROC_VOID(182, glGetUniformui64vNV, (GLuint program, GLint location, GLuint64EXT *params), (program, location, params))
+GL_PROC_VOID(183, glProgramUniformMatrix4x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(184, glProgramUniformMatrix4x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(185, glTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROC_VOID(186, glEvalCoord1d, (GLdouble u), (u))
+GL_PROC_VOID(187, glGetInternalformatSampleivNV, (GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei bufSize, GLint *params), (target, internalformat, samples, pname, bufSize, params))
+GL_PROC_VOID(188, glSharpenTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points))
+GL_PROC_VOID(189, glGetLightiv, (GLenum light, GLenum pname, GLint *params), (light, pname, params))
+GL_PROC_VOID(190, glBinormal3fvEXT, (const GLfloat *v), (v))
+GL_PROC_VOID(191, glCreateFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GL_PROC_VOID(192, glDepthRangefOES, (GLclampf n, GLclampf f), (n, f))
+GL_PROC_VOID(193, glVertexAttrib4NsvARB, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(194, glResetMinmax, (GLenum target), (target))
+GL_PROC_VOID(195, glDepthFunc, (GLenum func), (func))
+GL_PROC_VOID(196, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GL_PROC_VOID(197, glBinormal3sEXT, (GLshort bx, GLshort by, GLshort bz), (bx, by, bz))
+GL_PROC_VOID(198, glVertexAttrib2sv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC(199, GLboolean, glIsList, (GLuint list), (list))
+GL_PROC(200, GLint, glGetAttribLocation, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(201, glWindowPos3i, (GLint x, GLint y, GLint z), (x, y, z))
+GL_PROC_VOID(202, glUniform4ui64ARB, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (location, x, y, z, w))
+GL_PROC_VOID(203, glProgramUniform4uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(204, glLabelObjectEXT, (GLenum type, GLuint object, GLsizei length, const GLchar *label), (type, object, length, label))
+GL_PROC_VOID(205, glTexCoord3s, (GLshort s, GLshort t, GLshort r), (s, t, r))
+GL_PROC_VOID(206, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels), (x, y, width, height, format, type, pixels))
+GL_PROC_VOID(207, glHintPGI, (GLenum target, GLint mode), (target, mode))
+GL_PROC(208, GLint, glGetUniformLocation, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(209, glGetPixelMapxv, (GLenum map, GLint size, GLfixed *values), (map, size, values))
+GL_PROC_VOID(210, glNamedStringARB, (GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string), (type, namelen, name, stringlen, string))
+GL_PROC_VOID(211, glTexCoord4s, (GLshort s, GLshort t, GLshort r, GLshort q), (s, t, r, q))
+GL_PROC_VOID(212, glGetTrackMatrixivNV, (GLenum target, GLuint address, GLenum pname, GLint *params), (target, address, pname, params))
+GL_PROC_VOID(213, glProvokingVertex, (GLenum mode), (mode))
+GL_PROC_VOID(214, glSpriteParameterfSGIX, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(215, glTexGenf, (GLenum coord, GLenum pname, GLfloat param), (coord, pname, param))
+GL_PROC_VOID(216, glWindowPos3sMESA, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GL_PROC_VOID(217, glVertex2xOES, (GLfixed x), (x))
+GL_PROC_VOID(218, glPathDashArrayNV, (GLuint path, GLsizei dashCount, const GLfloat *dashArray), (path, dashCount, dashArray))
+GL_PROC_VOID(219, glClearColorIiEXT, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha))
+GL_PROC_VOID(220, glProgramUniform3ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GL_PROC_VOID(221, glGetActiveAtomicCounterBufferiv, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params))
+GL_PROC_VOID(222, glVertexAttrib3fvARB, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(223, glVertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y))
+GL_PROC_VOID(224, glGetProgramEnvParameterdvARB, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GL_PROC_VOID(225, glVertexAttribL1ui64ARB, (GLuint index, GLuint64EXT x), (index, x))
+GL_PROC_VOID(226, glGetPathTexGenfvNV, (GLenum texCoordSet, GLenum pname, GLfloat *value), (texCoordSet, pname, value))
+GL_PROC_VOID(227, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_PROC_VOID(228, glColor3us, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GL_PROC_VOID(229, glDrawRangeElementArrayATI, (GLenum mode, GLuint start, GLuint end, GLsizei count), (mode, start, end, count))
+GL_PROC_VOID(230, glConvolutionFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *image), (target, internalformat, width, height, format, type, image))
+GL_PROC(231, GLint, glPollInstrumentsSGIX, (GLint *marker_p), (marker_p))
+GL_PROC_VOID(232, glSecondaryColor3usv, (const GLushort *v), (v))
+GL_PROC_VOID(233, glColor4fNormal3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, nx, ny, nz, x, y, z))
+GL_PROC_VOID(234, glVertexStream2sATI, (GLenum stream, GLshort x, GLshort y), (stream, x, y))
+GL_PROC_VOID(235, glDrawArraysEXT, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GL_PROC_VOID(236, glColorSubTableEXT, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data), (target, start, count, format, type, data))
+GL_PROC_VOID(237, glSecondaryColor3bv, (const GLbyte *v), (v))
+GL_PROC_VOID(238, glEndTransformFeedbackNV, (void), ())
+GL_PROC_VOID(239, glBindBufferRangeEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GL_PROC_VOID(240, glPushGroupMarkerEXT, (GLsizei length, const GLchar *marker), (length, marker))
+GL_PROC_VOID(241, glNamedRenderbufferStorageMultisample, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GL_PROC_VOID(242, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GL_PROC_VOID(243, glTexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GL_PROC_VOID(244, glMultiTexCoord4ivARB, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(245, glConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image), (target, internalformat, width, height, format, type, image))
+GL_PROC_VOID(246, glGetConvolutionFilter, (GLenum target, GLenum format, GLenum type, GLvoid *image), (target, format, type, image))
+GL_PROC_VOID(247, glGetProgramLocalParameterIivNV, (GLenum target, GLuint index, GLint *params), (target, index, params))
+GL_PROC_VOID(248, glUniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(249, glVertexAttrib3fvNV, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(250, glColor3fVertex3fSUN, (GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (r, g, b, x, y, z))
+GL_PROC_VOID(251, glColorMaterial, (GLenum face, GLenum mode), (face, mode))
+GL_PROC(252, GLboolean, glIsRenderbuffer, (GLuint renderbuffer), (renderbuffer))
+GL_PROC_VOID(253, glColor4ub, (GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha), (red, green, blue, alpha))
+GL_PROC_VOID(254, glDepthRangexOES, (GLfixed n, GLfixed f), (n, f))
+GL_PROC_VOID(255, glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures))
+GL_PROC_VOID(256, glCompressedMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits))
+GL_PROC_VOID(257, glPrimitiveRestartNV, (void), ())
+GL_PROC_VOID(258, glUniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(259, glNamedProgramLocalParameter4fvEXT, (GLuint program, GLenum target, GLuint index, const GLfloat *params), (program, target, index, params))
+GL_PROC_VOID(260, glGetVertexAttribIuivEXT, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GL_PROC(261, GLuint, glAsyncCopyBufferSubDataNVX, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, fenceValueArray, readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size, signalSemaphoreCount, signalSemaphoreArray, signalValueArray))
+GL_PROC_VOID(262, glPathColorGenNV, (GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs), (color, genMode, colorFormat, coeffs))
+GL_PROC_VOID(263, glGetTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat *params), (texture, target, pname, params))
+GL_PROC_VOID(264, glVertexAttribI4bvEXT, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC_VOID(265, glVertex3sv, (const GLshort *v), (v))
+GL_PROC_VOID(266, glGetnPolygonStippleARB, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GL_PROC_VOID(267, glProgramUniform1fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(268, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GL_PROC_VOID(269, glGetSynciv, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (sync, pname, bufSize, length, values))
+GL_PROC(270, GLenum, glCheckNamedFramebufferStatusEXT, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GL_PROC_VOID(271, glUniform2i64NV, (GLint location, GLint64EXT x, GLint64EXT y), (location, x, y))
+GL_PROC_VOID(272, glVertexAttrib4sNV, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GL_PROC_VOID(273, glUniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(274, glProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(275, glUniform3uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(276, glDeleteQueriesARB, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROC_VOID(277, glMultiTexCoord4svARB, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(278, glReplacementCodeuiNormal3fVertex3fSUN, (GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, nx, ny, nz, x, y, z))
+GL_PROC_VOID(279, glProgramUniformHandleui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values))
+GL_PROC_VOID(280, glGetDoublev, (GLenum pname, GLdouble *params), (pname, params))
+GL_PROC_VOID(281, glTexCoord1xOES, (GLfixed s), (s))
+GL_PROC_VOID(282, glMultiTexCoord1sv, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(283, glLogicOp, (GLenum opcode), (opcode))
+GL_PROC_VOID(284, glVertexAttrib1s, (GLuint index, GLshort x), (index, x))
+GL_PROC_VOID(285, glLinkProgram, (GLuint program), (program))
+GL_PROC_VOID(286, glIndexxOES, (GLfixed component), (component))
+GL_PROC_VOID(287, glProgramUniformMatrix3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC(288, GLboolean, glIsSync, (GLsync sync), (sync))
+GL_PROC_VOID(289, glTexEnviv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(290, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(291, glVertexAttrib2fvNV, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(292, glPushClientAttribDefaultEXT, (GLbitfield mask), (mask))
+GL_PROC_VOID(293, glGetVariantPointervEXT, (GLuint id, GLenum value, void **data), (id, value, data))
+GL_PROC_VOID(294, glPolygonMode, (GLenum face, GLenum mode), (face, mode))
+GL_PROC_VOID(295, glMultiTexCoord3s, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GL_PROC_VOID(296, glMatrixScalefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z))
+GL_PROC_VOID(297, glProgramEnvParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params))
+GL_PROC_VOID(298, glGetnTexImageARB, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img), (target, level, format, type, bufSize, img))
+GL_PROC_VOID(299, glVertexAttrib1svNV, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(300, glProgramUniformMatrix4x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(301, glVertexArrayVertexBuffer, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GL_PROC_VOID(302, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GL_PROC(303, void *, glMapNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GL_PROC_VOID(304, glAccumxOES, (GLenum op, GLfixed value), (op, value))
+GL_PROC_VOID(305, glMultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GL_PROC_VOID(306, glMatrixMultTransposedEXT, (GLenum mode, const GLdouble *m), (mode, m))
+GL_PROC_VOID(307, glBeginQueryIndexed, (GLenum target, GLuint index, GLuint id), (target, index, id))
+GL_PROC_VOID(308, glVertexP3ui, (GLenum type, GLuint value), (type, value))
+GL_PROC_VOID(309, glTexCoord3iv, (const GLint *v), (v))
+GL_PROC_VOID(310, glVertexStream3dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z), (stream, x, y, z))
+GL_PROC_VOID(311, glMultiTexCoord4dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GL_PROC(312, GLenum, glCheckNamedFramebufferStatus, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GL_PROC_VOID(313, glCompressedTexImage3DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GL_PROC_VOID(314, glMapVertexAttrib1fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (index, size, u1, u2, stride, order, points))
+GL_PROC_VOID(315, glGetColorTableParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC(316, GLboolean, glIsOcclusionQueryNV, (GLuint id), (id))
+GL_PROC_VOID(317, glVertexAttrib3hvNV, (GLuint index, const GLhalfNV *v), (index, v))
+GL_PROC_VOID(318, glSetMultisamplefvAMD, (GLenum pname, GLuint index, const GLfloat *val), (pname, index, val))
+GL_PROC_VOID(319, glResolveDepthValuesNV, (void), ())
+GL_PROC_VOID(320, glMultiDrawMeshTasksIndirectCountNV, (GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (indirect, drawcount, maxdrawcount, stride))
+GL_PROC_VOID(321, glVertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(322, glCompressedMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, depth, border, imageSize, bits))
+GL_PROC(323, GLboolean, glIsBufferResidentNV, (GLenum target), (target))
+GL_PROC_VOID(324, glMultiTexCoord2bvOES, (GLenum texture, const GLbyte *coords), (texture, coords))
+GL_PROC_VOID(325, glTexCoord1s, (GLshort s), (s))
+GL_PROC_VOID(326, glTexCoord2bOES, (GLbyte s, GLbyte t), (s, t))
+GL_PROC_VOID(327, glGetQueryivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(328, glVertexAttribL2ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y), (index, x, y))
+GL_PROC_VOID(329, glVertexAttrib2hNV, (GLuint index, GLhalfNV x, GLhalfNV y), (index, x, y))
+GL_PROC_VOID(330, glMulticastScissorArrayvNVX, (GLuint gpu, GLuint first, GLsizei count, const GLint *v), (gpu, first, count, v))
+GL_PROC(331, GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceWithPictureStructureNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames, GLboolean isFrameStructure), (vdpSurface, target, numTextureNames, textureNames, isFrameStructure))
+GL_PROC_VOID(332, glProgramUniform4i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GL_PROC_VOID(333, glMultiTexCoord3iv, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(334, glFramebufferTextureEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GL_PROC_VOID(335, glUniform1uiEXT, (GLint location, GLuint v0), (location, v0))
+GL_PROC_VOID(336, glImportMemoryWin32NameEXT, (GLuint memory, GLuint64 size, GLenum handleType, const void *name), (memory, size, handleType, name))
+GL_PROC_VOID(337, glClearColor, (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha), (red, green, blue, alpha))
+GL_PROC_VOID(338, glGenProgramsNV, (GLsizei n, GLuint *programs), (n, programs))
+GL_PROC_VOID(339, glTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GL_PROC_VOID(340, glUniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+GL_PROC_VOID(341, glCopyMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, x, y, width, height))
+GL_PROC_VOID(342, glGenBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GL_PROC_VOID(343, glClientActiveTextureARB, (GLenum texture), (texture))
+GL_PROC_VOID(344, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GL_PROC_VOID(345, glTexGendv, (GLenum coord, GLenum pname, const GLdouble *params), (coord, pname, params))
+GL_PROC_VOID(346, glDrawElementArrayATI, (GLenum mode, GLsizei count), (mode, count))
+GL_PROC_VOID(347, glColor3fVertex3fvSUN, (const GLfloat *c, const GLfloat *v), (c, v))
+GL_PROC_VOID(348, glUniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(349, glResetHistogram, (GLenum target), (target))
+GL_PROC_VOID(350, glProgramParameters4fvNV, (GLenum target, GLuint index, GLsizei count, const GLfloat *v), (target, index, count, v))
+GL_PROC_VOID(351, glEndList, (void), ())
+GL_PROC_VOID(352, glTexCoord1hNV, (GLhalfNV s), (s))
+GL_PROC_VOID(353, glFragmentColorMaterialSGIX, (GLenum face, GLenum mode), (face, mode))
+GL_PROC_VOID(354, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GL_PROC_VOID(355, glColor4xvOES, (const GLfixed *components), (components))
+GL_PROC_VOID(356, glEndQuery, (GLenum target), (target))
+GL_PROC_VOID(357, glVertexAttribL3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_PROC_VOID(358, glBufferPageCommitmentARB, (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit), (target, offset, size, commit))
+GL_PROC_VOID(359, glVariantubvEXT, (GLuint id, const GLubyte *addr), (id, addr))
+GL_PROC_VOID(360, glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_PROC_VOID(361, glGetnPixelMapusvARB, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GL_PROC_VOID(362, glImageTransformParameterfHP, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_PROC_VOID(363, glProgramUniformMatrix2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(364, glVertexAttribs4dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GL_PROC_VOID(365, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GL_PROC(366, GLenum, glGetGraphicsResetStatus, (void), ())
+GL_PROC_VOID(367, glWindowPos2dv, (const GLdouble *v), (v))
+GL_PROC_VOID(368, glVertex3bOES, (GLbyte x, GLbyte y, GLbyte z), (x, y, z))
+GL_PROC_VOID(369, glMatrixRotatefEXT, (GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (mode, angle, x, y, z))
+GL_PROC_VOID(370, glMultiTexCoord4sARB, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GL_PROC_VOID(371, glColorTableEXT, (GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *table), (target, internalFormat, width, format, type, table))
+GL_PROC_VOID(372, glVertexAttribI4usvEXT, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(373, glVertexAttrib4Niv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(374, glGetProgramParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params))
+GL_PROC_VOID(375, glMultiTexCoord3f, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GL_PROC_VOID(376, glProgramUniform4ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (program, location, x, y, z, w))
+GL_PROC_VOID(377, glEvalCoord1f, (GLfloat u), (u))
+GL_PROC_VOID(378, glProgramUniform3fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(379, glProgramSubroutineParametersuivNV, (GLenum target, GLsizei count, const GLuint *params), (target, count, params))
+GL_PROC_VOID(380, glUniform1fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(381, glCommandListSegmentsNV, (GLuint list, GLuint segments), (list, segments))
+GL_PROC_VOID(382, glReplacementCodeubSUN, (GLubyte code), (code))
+GL_PROC_VOID(383, glEnableIndexedEXT, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(384, glProgramUniformui64NV, (GLuint program, GLint location, GLuint64EXT value), (program, location, value))
+GL_PROC_VOID(385, glVertexAttrib3dvARB, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(386, glBlitFramebufferEXT, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_PROC_VOID(387, glUniform3ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(388, glReplacementCodeuiVertex3fvSUN, (const GLuint *rc, const GLfloat *v), (rc, v))
+GL_PROC_VOID(389, glUniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(390, glWindowPos3svMESA, (const GLshort *v), (v))
+GL_PROC_VOID(391, glNamedProgramLocalParameterI4iEXT, (GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (program, target, index, x, y, z, w))
+GL_PROC_VOID(392, glWindowPos2sARB, (GLshort x, GLshort y), (x, y))
+GL_PROC_VOID(393, glCreateQueries, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids))
+GL_PROC_VOID(394, glGetVertexAttribLdvEXT, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_PROC_VOID(395, glVertexP3uiv, (GLenum type, const GLuint *value), (type, value))
+GL_PROC_VOID(396, glDrawArraysIndirect, (GLenum mode, const void *indirect), (mode, indirect))
+GL_PROC_VOID(397, glDebugMessageCallbackARB, (GLDEBUGPROCARB callback, const void *userParam), (callback, userParam))
+GL_PROC_VOID(398, glPopMatrix, (void), ())
+GL_PROC(399, GLhandleARB, glGetHandleARB, (GLenum pname), (pname))
+GL_PROC_VOID(400, glDeleteNamedStringARB, (GLint namelen, const GLchar *name), (namelen, name))
+GL_PROC_VOID(401, glEvalCoord1xOES, (GLfixed u), (u))
+GL_PROC_VOID(402, glProvokingVertexEXT, (GLenum mode), (mode))
+GL_PROC_VOID(403, glMultiTexCoord1dARB, (GLenum target, GLdouble s), (target, s))
+GL_PROC_VOID(404, glGetListParameterfvSGIX, (GLuint list, GLenum pname, GLfloat *params), (list, pname, params))
+GL_PROC_VOID(405, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GL_PROC_VOID(406, glColorFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod))
+GL_PROC_VOID(407, glVariantbvEXT, (GLuint id, const GLbyte *addr), (id, addr))
+GL_PROC_VOID(408, glVertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(409, glPixelMapusv, (GLenum map, GLsizei mapsize, const GLushort *values), (map, mapsize, values))
+GL_PROC_VOID(410, glBindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+GL_PROC_VOID(411, glWeightPathsNV, (GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights), (resultPath, numPaths, paths, weights))
+GL_PROC_VOID(412, glEndVertexShaderEXT, (void), ())
+GL_PROC_VOID(413, glSpecializeShaderARB, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GL_PROC_VOID(414, glDepthRangedNV, (GLdouble zNear, GLdouble zFar), (zNear, zFar))
+GL_PROC_VOID(415, glPixelTransferf, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(416, glBindAttribLocationARB, (GLhandleARB programObj, GLuint index, const GLcharARB *name), (programObj, index, name))
+GL_PROC_VOID(417, glGetnUniformfv, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GL_PROC_VOID(418, glMultiTexCoord4xvOES, (GLenum texture, const GLfixed *coords), (texture, coords))
+GL_PROC_VOID(419, glShaderOp2EXT, (GLenum op, GLuint res, GLuint arg1, GLuint arg2), (op, res, arg1, arg2))
+GL_PROC_VOID(420, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GL_PROC_VOID(421, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GL_PROC_VOID(422, glWindowPos3sv, (const GLshort *v), (v))
+GL_PROC_VOID(423, glTexEnvf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_PROC_VOID(424, glVertexAttrib3fNV, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GL_PROC_VOID(425, glGetPerfMonitorGroupsAMD, (GLint *numGroups, GLsizei groupsSize, GLuint *groups), (numGroups, groupsSize, groups))
+GL_PROC(426, GLboolean, glIsMemoryObjectEXT, (GLuint memoryObject), (memoryObject))
+GL_PROC(427, GLuint, glBindMaterialParameterEXT, (GLenum face, GLenum value), (face, value))
+GL_PROC_VOID(428, glColor4iv, (const GLint *v), (v))
+GL_PROC_VOID(429, glGetPathCoordsNV, (GLuint path, GLfloat *coords), (path, coords))
+GL_PROC_VOID(430, glRasterPos4dv, (const GLdouble *v), (v))
+GL_PROC_VOID(431, glGetIntegerui64i_vNV, (GLenum value, GLuint index, GLuint64EXT *result), (value, index, result))
+GL_PROC_VOID(432, glPrioritizeTextures, (GLsizei n, const GLuint *textures, const GLclampf *priorities), (n, textures, priorities))
+GL_PROC_VOID(433, glVertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(434, glVertexStream2fvATI, (GLenum stream, const GLfloat *coords), (stream, coords))
+GL_PROC_VOID(435, glTrackMatrixNV, (GLenum target, GLuint address, GLenum matrix, GLenum transform), (target, address, matrix, transform))
+GL_PROC_VOID(436, glGetnMapfv, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GL_PROC_VOID(437, glMakeNamedBufferNonResidentNV, (GLuint buffer), (buffer))
+GL_PROC_VOID(438, glPixelTexGenSGIX, (GLenum mode), (mode))
+GL_PROC_VOID(439, glVertex4bOES, (GLbyte x, GLbyte y, GLbyte z, GLbyte w), (x, y, z, w))
+GL_PROC_VOID(440, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_PROC_VOID(441, glProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GL_PROC_VOID(442, glIndexPointer, (GLenum type, GLsizei stride, const GLvoid *ptr), (type, stride, ptr))
+GL_PROC_VOID(443, glGetInvariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GL_PROC_VOID(444, glGetMapxvOES, (GLenum target, GLenum query, GLfixed *v), (target, query, v))
+GL_PROC_VOID(445, glDeleteShader, (GLuint shader), (shader))
+GL_PROC_VOID(446, glBlendEquationSeparateATI, (GLenum modeRGB, GLenum modeA), (modeRGB, modeA))
+GL_PROC_VOID(447, glClearIndex, (GLfloat c), (c))
+GL_PROC_VOID(448, glMultiTexParameteriEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param))
+GL_PROC_VOID(449, glGetBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data), (target, offset, size, data))
+GL_PROC_VOID(450, glDeleteAsyncMarkersSGIX, (GLuint marker, GLsizei range), (marker, range))
+GL_PROC_VOID(451, glUniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(452, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GL_PROC_VOID(453, glFlushPixelDataRangeNV, (GLenum target), (target))
+GL_PROC_VOID(454, glMultiTexCoord1svARB, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(455, glProgramUniformMatrix3x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(456, glGetVertexAttribdvNV, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_PROC_VOID(457, glGetBufferParameterui64vNV, (GLenum target, GLenum pname, GLuint64EXT *params), (target, pname, params))
+GL_PROC_VOID(458, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_PROC_VOID(459, glTexCoord2sv, (const GLshort *v), (v))
+GL_PROC_VOID(460, glMultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GL_PROC_VOID(461, glQueryObjectParameteruiAMD, (GLenum target, GLuint id, GLenum pname, GLuint param), (target, id, pname, param))
+GL_PROC_VOID(462, glProgramEnvParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w))
+GL_PROC_VOID(463, glDrawCommandsAddressNV, (GLenum primitiveMode, const GLuint64 *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, indirects, sizes, count))
+GL_PROC_VOID(464, glMultiDrawElementsIndirectBindlessNV, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, stride, vertexBufferCount))
+GL_PROC_VOID(465, glReferencePlaneSGIX, (const GLdouble *equation), (equation))
+GL_PROC_VOID(466, glBeginFragmentShaderATI, (void), ())
+GL_PROC_VOID(467, glGetMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params))
+GL_PROC_VOID(468, glProgramParameter4fvNV, (GLenum target, GLuint index, const GLfloat *v), (target, index, v))
+GL_PROC_VOID(469, glCopyConvolutionFilter1D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GL_PROC_VOID(470, glGetTransformFeedbackiv, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param))
+GL_PROC_VOID(471, glCreateTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC(472, void *, glMapBuffer, (GLenum target, GLenum access), (target, access))
+GL_PROC_VOID(473, glVertexStream1ivATI, (GLenum stream, const GLint *coords), (stream, coords))
+GL_PROC_VOID(474, glGetMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble *params), (texunit, coord, pname, params))
+GL_PROC_VOID(475, glGetnUniformdv, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GL_PROC_VOID(476, glWindowPos4dMESA, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GL_PROC_VOID(477, glGlobalAlphaFactordSUN, (GLdouble factor), (factor))
+GL_PROC_VOID(478, glTextureLightEXT, (GLenum pname), (pname))
+GL_PROC_VOID(479, glNormalStream3bATI, (GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz), (stream, nx, ny, nz))
+GL_PROC_VOID(480, glVertex2i, (GLint x, GLint y), (x, y))
+GL_PROC_VOID(481, glLoadTransposeMatrixdARB, (const GLdouble *m), (m))
+GL_PROC_VOID(482, glDeleteSync, (GLsync sync), (sync))
+GL_PROC_VOID(483, glRectf, (GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2), (x1, y1, x2, y2))
+GL_PROC_VOID(484, glClampColor, (GLenum target, GLenum clamp), (target, clamp))
+GL_PROC_VOID(485, glVertexWeighthNV, (GLhalfNV weight), (weight))
+GL_PROC_VOID(486, glTexCoord2fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *n, const GLfloat *v), (tc, n, v))
+GL_PROC(487, GLboolean, glIsBuffer, (GLuint buffer), (buffer))
+GL_PROC_VOID(488, glVertexArrayVertexAttribDivisorEXT, (GLuint vaobj, GLuint index, GLuint divisor), (vaobj, index, divisor))
+GL_PROC_VOID(489, glGetQueryObjectui64vEXT, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GL_PROC_VOID(490, glVertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC(491, GLuint, glNewObjectBufferATI, (GLsizei size, const void *pointer, GLenum usage), (size, pointer, usage))
+GL_PROC_VOID(492, glMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(493, glGetUniformui64vARB, (GLuint program, GLint location, GLuint64 *params), (program, location, params))
+GL_PROC_VOID(494, glMultiDrawArraysIndirect, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+GL_PROC_VOID(495, glProgramUniform2ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y), (program, location, x, y))
+GL_PROC_VOID(496, glSecondaryColor3d, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GL_PROC_VOID(497, glGetPerfMonitorCountersAMD, (GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters), (group, numCounters, maxActiveCounters, counterSize, counters))
+GL_PROC_VOID(498, glDepthBoundsEXT, (GLclampd zmin, GLclampd zmax), (zmin, zmax))
+GL_PROC_VOID(499, glWindowPos3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(500, glGetFragmentMaterialivSGIX, (GLenum face, GLenum pname, GLint *params), (face, pname, params))
+GL_PROC_VOID(501, glFeedbackBufferxOES, (GLsizei n, GLenum type, const GLfixed *buffer), (n, type, buffer))
+GL_PROC_VOID(502, glProgramUniform2i, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GL_PROC(503, void *, glMapBufferARB, (GLenum target, GLenum access), (target, access))
+GL_PROC_VOID(504, glVertexWeighthvNV, (const GLhalfNV *weight), (weight))
+GL_PROC_VOID(505, glCopyConvolutionFilter2DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height))
+GL_PROC_VOID(506, glInstrumentsBufferSGIX, (GLsizei size, GLint *buffer), (size, buffer))
+GL_PROC_VOID(507, glGetVertexAttribArrayObjectivATI, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(508, glVertexArrayElementBuffer, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+GL_PROC_VOID(509, glGenFramebuffersEXT, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GL_PROC_VOID(510, glColor4b, (GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha), (red, green, blue, alpha))
+GL_PROC_VOID(511, glMultiTexCoord1d, (GLenum target, GLdouble s), (target, s))
+GL_PROC_VOID(512, glSecondaryColorP3ui, (GLenum type, GLuint color), (type, color))
+GL_PROC_VOID(513, glGetPathMetricsNV, (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics), (metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics))
+GL_PROC_VOID(514, glGetTexGenfv, (GLenum coord, GLenum pname, GLfloat *params), (coord, pname, params))
+GL_PROC_VOID(515, glGenerateMipmapEXT, (GLenum target), (target))
+GL_PROC_VOID(516, glDrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+GL_PROC_VOID(517, glColorP4uiv, (GLenum type, const GLuint *color), (type, color))
+GL_PROC_VOID(518, glVertexAttrib4iv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(519, glVertexStream3fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z), (stream, x, y, z))
+GL_PROC_VOID(520, glListParameteriSGIX, (GLuint list, GLenum pname, GLint param), (list, pname, param))
+GL_PROC_VOID(521, glTexCoord4i, (GLint s, GLint t, GLint r, GLint q), (s, t, r, q))
+GL_PROC_VOID(522, glCreateSamplers, (GLsizei n, GLuint *samplers), (n, samplers))
+GL_PROC_VOID(523, glMultiTexCoord1fvARB, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(524, glSeparableFilter2DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column), (target, internalformat, width, height, format, type, row, column))
+GL_PROC_VOID(525, glBlendFuncSeparateIndexedAMD, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GL_PROC_VOID(526, glRenderbufferStorageMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GL_PROC_VOID(527, glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GL_PROC_VOID(528, glBindProgramARB, (GLenum target, GLuint program), (target, program))
+GL_PROC_VOID(529, glGetTextureImageEXT, (GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texture, target, level, format, type, pixels))
+GL_PROC_VOID(530, glMatrixMultfEXT, (GLenum mode, const GLfloat *m), (mode, m))
+GL_PROC_VOID(531, glEndConditionalRenderNVX, (void), ())
+GL_PROC_VOID(532, glProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(533, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(534, glResumeTransformFeedback, (void), ())
+GL_PROC_VOID(535, glProgramUniformMatrix2x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(536, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GL_PROC_VOID(537, glFlush, (void), ())
+GL_PROC_VOID(538, glSecondaryColor3usvEXT, (const GLushort *v), (v))
+GL_PROC_VOID(539, glGetObjectParameterivAPPLE, (GLenum objectType, GLuint name, GLenum pname, GLint *params), (objectType, name, pname, params))
+GL_PROC_VOID(540, glUniform3i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GL_PROC_VOID(541, glCreateBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GL_PROC_VOID(542, glGetColorTableEXT, (GLenum target, GLenum format, GLenum type, void *data), (target, format, type, data))
+GL_PROC_VOID(543, glIndexMask, (GLuint mask), (mask))
+GL_PROC_VOID(544, glColor4hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(545, glFinishFenceNV, (GLuint fence), (fence))
+GL_PROC_VOID(546, glTexGenfv, (GLenum coord, GLenum pname, const GLfloat *params), (coord, pname, params))
+GL_PROC(547, GLuint64, glGetTextureSamplerHandleNV, (GLuint texture, GLuint sampler), (texture, sampler))
+GL_PROC_VOID(548, glFogCoordhvNV, (const GLhalfNV *fog), (fog))
+GL_PROC_VOID(549, glDeleteQueryResourceTagNV, (GLsizei n, const GLint *tagIds), (n, tagIds))
+GL_PROC_VOID(550, glVertexAttribLPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_PROC_VOID(551, glColor3xvOES, (const GLfixed *components), (components))
+GL_PROC_VOID(552, glMemoryObjectParameterivEXT, (GLuint memoryObject, GLenum pname, const GLint *params), (memoryObject, pname, params))
+GL_PROC_VOID(553, glGetCompressedTextureImageEXT, (GLuint texture, GLenum target, GLint lod, void *img), (texture, target, lod, img))
+GL_PROC_VOID(554, glPolygonOffsetxOES, (GLfixed factor, GLfixed units), (factor, units))
+GL_PROC_VOID(555, glNormalPointer, (GLenum type, GLsizei stride, const GLvoid *ptr), (type, stride, ptr))
+GL_PROC_VOID(556, glVertexAttribI4ivEXT, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(557, glMultiTexCoord2fARB, (GLenum target, GLfloat s, GLfloat t), (target, s, t))
+GL_PROC(558, GLint, glGetFragDataLocation, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(559, glVertexArrayRangeAPPLE, (GLsizei length, void *pointer), (length, pointer))
+GL_PROC(560, GLsync, glImportSyncEXT, (GLenum external_sync_type, GLintptr external_sync, GLbitfield flags), (external_sync_type, external_sync, flags))
+GL_PROC_VOID(561, glUniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(562, glAccum, (GLenum op, GLfloat value), (op, value))
+GL_PROC_VOID(563, glEnableVertexAttribArrayARB, (GLuint index), (index))
+GL_PROC_VOID(564, glGetTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+GL_PROC_VOID(565, glTessellationFactorAMD, (GLfloat factor), (factor))
+GL_PROC_VOID(566, glGetMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum types, GLvoid *values), (target, reset, format, types, values))
+GL_PROC_VOID(567, glUniform4dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GL_PROC_VOID(568, glPathGlyphsNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale))
+GL_PROC_VOID(569, glGetTexGendv, (GLenum coord, GLenum pname, GLdouble *params), (coord, pname, params))
+GL_PROC_VOID(570, glProgramUniform2iEXT, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GL_PROC_VOID(571, glVertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(572, glScissorArrayv, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GL_PROC_VOID(573, glColor3sv, (const GLshort *v), (v))
+GL_PROC_VOID(574, glTexCoord1dv, (const GLdouble *v), (v))
+GL_PROC_VOID(575, glGetVariantArrayObjectfvATI, (GLuint id, GLenum pname, GLfloat *params), (id, pname, params))
+GL_PROC_VOID(576, glVertexAttribI4ubvEXT, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(577, glTexCoord2fColor4fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, nx, ny, nz, x, y, z))
+GL_PROC_VOID(578, glConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image), (target, internalformat, width, format, type, image))
+GL_PROC_VOID(579, glMultiTexGendEXT, (GLenum texunit, GLenum coord, GLenum pname, GLdouble param), (texunit, coord, pname, param))
+GL_PROC_VOID(580, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GL_PROC_VOID(581, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_PROC_VOID(582, glGetProgramResourcefvNV, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLfloat *params), (program, programInterface, index, propCount, props, bufSize, length, params))
+GL_PROC_VOID(583, glGetMapdv, (GLenum target, GLenum query, GLdouble *v), (target, query, v))
+GL_PROC_VOID(584, glProgramUniform3ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (program, location, x, y, z))
+GL_PROC_VOID(585, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GL_PROC_VOID(586, glCopyTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROC(587, GLint, glGetFragDataLocationEXT, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(588, glPolygonOffsetClamp, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GL_PROC_VOID(589, glGetVertexAttribivNV, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(590, glNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GL_PROC_VOID(591, glMultiTexCoord4hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (target, s, t, r, q))
+GL_PROC_VOID(592, glLinkProgramARB, (GLhandleARB programObj), (programObj))
+GL_PROC_VOID(593, glTexCoordPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GL_PROC_VOID(594, glVertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(595, glGetCoverageModulationTableNV, (GLsizei bufsize, GLfloat *v), (bufsize, v))
+GL_PROC_VOID(596, glVertexAttribs4ubvNV, (GLuint index, GLsizei count, const GLubyte *v), (index, count, v))
+GL_PROC_VOID(597, glVertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(598, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GL_PROC_VOID(599, glBindBufferBaseNV, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GL_PROC_VOID(600, glVertexAttribL4i64vNV, (GLuint index, const GLint64EXT *v), (index, v))
+GL_PROC_VOID(601, glWindowRectanglesEXT, (GLenum mode, GLsizei count, const GLint *box), (mode, count, box))
+GL_PROC_VOID(602, glVertexAttribI1uiEXT, (GLuint index, GLuint x), (index, x))
+GL_PROC_VOID(603, glVertexAttrib1hvNV, (GLuint index, const GLhalfNV *v), (index, v))
+GL_PROC_VOID(604, glVertexAttrib3fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GL_PROC_VOID(605, glUnmapObjectBufferATI, (GLuint buffer), (buffer))
+GL_PROC_VOID(606, glShadingRateImagePaletteNV, (GLuint viewport, GLuint first, GLsizei count, const GLenum *rates), (viewport, first, count, rates))
+GL_PROC_VOID(607, glGetInternalformativ, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params), (target, internalformat, pname, bufSize, params))
+GL_PROC_VOID(608, glBlendColorEXT, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_PROC_VOID(609, glTexSubImage4DSGIS, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels))
+GL_PROC_VOID(610, glMakeImageHandleNonResidentARB, (GLuint64 handle), (handle))
+GL_PROC_VOID(611, glTexCoord4fVertex4fvSUN, (const GLfloat *tc, const GLfloat *v), (tc, v))
+GL_PROC(612, GLuint, glCreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GL_PROC_VOID(613, glPresentFrameDualFillNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3))
+GL_PROC_VOID(614, glCopyTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, target, level, xoffset, yoffset, x, y, width, height))
+GL_PROC_VOID(615, glGetNamedRenderbufferParameterivEXT, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GL_PROC_VOID(616, glColorPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr))
+GL_PROC_VOID(617, glGetCompressedTexImage, (GLenum target, GLint lod, GLvoid *img), (target, lod, img))
+GL_PROC_VOID(618, glUniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(619, glProgramUniform3i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (program, location, x, y, z))
+GL_PROC_VOID(620, glReplacementCodeuiColor3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *v), (rc, c, v))
+GL_PROC_VOID(621, glNormalStream3fATI, (GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz), (stream, nx, ny, nz))
+GL_PROC(622, GLuint, glBindTexGenParameterEXT, (GLenum unit, GLenum coord, GLenum value), (unit, coord, value))
+GL_PROC_VOID(623, glTextureBarrier, (void), ())
+GL_PROC_VOID(624, glVertexAttrib1sv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(625, glStencilThenCoverStrokePathNV, (GLuint path, GLint reference, GLuint mask, GLenum coverMode), (path, reference, mask, coverMode))
+GL_PROC_VOID(626, glProgramLocalParameter4fARB, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GL_PROC_VOID(627, glSecondaryColor3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(628, glBufferStorage, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GL_PROC_VOID(629, glGlobalAlphaFactorsSUN, (GLshort factor), (factor))
+GL_PROC_VOID(630, glFogFuncSGIS, (GLsizei n, const GLfloat *points), (n, points))
+GL_PROC_VOID(631, glTangent3bvEXT, (const GLbyte *v), (v))
+GL_PROC_VOID(632, glGetVideoCaptureStreamivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLint *params), (video_capture_slot, stream, pname, params))
+GL_PROC(633, GLuint, glGetDebugMessageLogARB, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GL_PROC_VOID(634, glVertexStream1iATI, (GLenum stream, GLint x), (stream, x))
+GL_PROC_VOID(635, glWindowPos4svMESA, (const GLshort *v), (v))
+GL_PROC_VOID(636, glMaterialxvOES, (GLenum face, GLenum pname, const GLfixed *param), (face, pname, param))
+GL_PROC_VOID(637, glTexCoord4fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, x, y, z, w))
+GL_PROC(638, GLboolean, glIsFramebuffer, (GLuint framebuffer), (framebuffer))
+GL_PROC_VOID(639, glCreatePerfQueryINTEL, (GLuint queryId, GLuint *queryHandle), (queryId, queryHandle))
+GL_PROC_VOID(640, glSecondaryColor3usEXT, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GL_PROC_VOID(641, glGetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GL_PROC_VOID(642, glTexCoord4hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q), (s, t, r, q))
+GL_PROC_VOID(643, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GL_PROC_VOID(644, glVertex2d, (GLdouble x, GLdouble y), (x, y))
+GL_PROC_VOID(645, glFlushVertexArrayRangeNV, (void), ())
+GL_PROC_VOID(646, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GL_PROC_VOID(647, glMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params), (texunit, coord, pname, params))
+GL_PROC_VOID(648, glMultiTexCoord3svARB, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(649, glMultiTexCoord3fv, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(650, glProgramUniform3i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z), (program, location, x, y, z))
+GL_PROC_VOID(651, glGetNamedBufferParameterivEXT, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GL_PROC_VOID(652, glGetConvolutionParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(653, glBlendFuncIndexedAMD, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GL_PROC_VOID(654, glColor3usv, (const GLushort *v), (v))
+GL_PROC_VOID(655, glColor3uiv, (const GLuint *v), (v))
+GL_PROC_VOID(656, glVertexAttribI3iEXT, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GL_PROC_VOID(657, glVertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(658, glGetNamedBufferPointerv, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GL_PROC_VOID(659, glTextureNormalEXT, (GLenum mode), (mode))
+GL_PROC_VOID(660, glCompressedTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+GL_PROC_VOID(661, glVertexAttrib4hvNV, (GLuint index, const GLhalfNV *v), (index, v))
+GL_PROC_VOID(662, glMultiTexCoord3fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r))
+GL_PROC_VOID(663, glDebugMessageInsertAMD, (GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar *buf), (category, severity, id, length, buf))
+GL_PROC_VOID(664, glClearDepthf, (GLfloat d), (d))
+GL_PROC_VOID(665, glGetConvolutionFilterEXT, (GLenum target, GLenum format, GLenum type, void *image), (target, format, type, image))
+GL_PROC_VOID(666, glGetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GL_PROC_VOID(667, glNormal3hNV, (GLhalfNV nx, GLhalfNV ny, GLhalfNV nz), (nx, ny, nz))
+GL_PROC_VOID(668, glNamedFramebufferParameteri, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GL_PROC_VOID(669, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GL_PROC_VOID(670, glGetUniformfvARB, (GLhandleARB programObj, GLint location, GLfloat *params), (programObj, location, params))
+GL_PROC_VOID(671, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GL_PROC_VOID(672, glProgramVertexLimitNV, (GLenum target, GLint limit), (target, limit))
+GL_PROC_VOID(673, glSecondaryColorPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GL_PROC_VOID(674, glTexCoord3i, (GLint s, GLint t, GLint r), (s, t, r))
+GL_PROC_VOID(675, glMultiTexCoord1ivARB, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(676, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROC_VOID(677, glProgramParameteriARB, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GL_PROC_VOID(678, glBlendEquationSeparateIndexedAMD, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GL_PROC_VOID(679, glOrtho, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val), (left, right, bottom, top, near_val, far_val))
+GL_PROC_VOID(680, glGetMultisamplefvNV, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GL_PROC_VOID(681, glGenVertexArraysAPPLE, (GLsizei n, GLuint *arrays), (n, arrays))
+GL_PROC_VOID(682, glNamedProgramStringEXT, (GLuint program, GLenum target, GLenum format, GLsizei len, const void *string), (program, target, format, len, string))
+GL_PROC_VOID(683, glGetVideoCaptureStreamfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat *params), (video_capture_slot, stream, pname, params))
+GL_PROC_VOID(684, glEvalMesh2, (GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2), (mode, i1, i2, j1, j2))
+GL_PROC_VOID(685, glGetLightfv, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params))
+GL_PROC_VOID(686, glColor3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(687, glVertexAttribL2i64NV, (GLuint index, GLint64EXT x, GLint64EXT y), (index, x, y))
+GL_PROC_VOID(688, glProgramUniformMatrix3x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(689, glMulticastCopyImageSubDataNV, (GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GL_PROC_VOID(690, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GL_PROC_VOID(691, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GL_PROC_VOID(692, glTexGenxvOES, (GLenum coord, GLenum pname, const GLfixed *params), (coord, pname, params))
+GL_PROC_VOID(693, glViewportArrayv, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v))
+GL_PROC_VOID(694, glTexAttachMemoryNV, (GLenum target, GLuint memory, GLuint64 offset), (target, memory, offset))
+GL_PROC_VOID(695, glResetMinmaxEXT, (GLenum target), (target))
+GL_PROC_VOID(696, glVertexArraySecondaryColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GL_PROC_VOID(697, glMultiTexCoord3xvOES, (GLenum texture, const GLfixed *coords), (texture, coords))
+GL_PROC_VOID(698, glRasterPos2sv, (const GLshort *v), (v))
+GL_PROC_VOID(699, glProgramEnvParameterI4ivNV, (GLenum target, GLuint index, const GLint *params), (target, index, params))
+GL_PROC_VOID(700, glVertexAttribs4fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GL_PROC_VOID(701, glDisableVertexAttribArrayARB, (GLuint index), (index))
+GL_PROC_VOID(702, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GL_PROC_VOID(703, glTexGenxOES, (GLenum coord, GLenum pname, GLfixed param), (coord, pname, param))
+GL_PROC_VOID(704, glVertex3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(705, glProgramUniformMatrix2x3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(706, glEGLImageTargetTextureStorageEXT, (GLuint texture, GLeglImageOES image, const GLint* attrib_list), (texture, image, attrib_list))
+GL_PROC_VOID(707, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GL_PROC_VOID(708, glPointParameterfv, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(709, glUniform1dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GL_PROC_VOID(710, glBlendFunciARB, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GL_PROC_VOID(711, glVertex3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(712, glVertexAttrib1dvNV, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(713, glLoadName, (GLuint name), (name))
+GL_PROC(714, GLboolean, glIsStateNV, (GLuint state), (state))
+GL_PROC_VOID(715, glUniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(716, glTexCoord1d, (GLdouble s), (s))
+GL_PROC_VOID(717, glDeleteProgramsARB, (GLsizei n, const GLuint *programs), (n, programs))
+GL_PROC_VOID(718, glGetUniformdv, (GLuint program, GLint location, GLdouble *params), (program, location, params))
+GL_PROC_VOID(719, glProgramUniform1fEXT, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GL_PROC_VOID(720, glVertexAttribL2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_PROC_VOID(721, glGetFramebufferAttachmentParameterivEXT, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GL_PROC_VOID(722, glWindowPos2iv, (const GLint *v), (v))
+GL_PROC(723, GLboolean, glIsVariantEnabledEXT, (GLuint id, GLenum cap), (id, cap))
+GL_PROC_VOID(724, glBeginVertexShaderEXT, (void), ())
+GL_PROC_VOID(725, glTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, border, format, type, pixels))
+GL_PROC_VOID(726, glGetBufferPointervARB, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GL_PROC(727, void *, glMapNamedBuffer, (GLuint buffer, GLenum access), (buffer, access))
+GL_PROC_VOID(728, glGetFirstPerfQueryIdINTEL, (GLuint *queryId), (queryId))
+GL_PROC_VOID(729, glMinmax, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink))
+GL_PROC_VOID(730, glTexCoordPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GL_PROC_VOID(731, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(732, glTextureImage3DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations))
+GL_PROC_VOID(733, glPathSubCoordsNV, (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords), (path, coordStart, numCoords, coordType, coords))
+GL_PROC_VOID(734, glVertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC_VOID(735, glEdgeFlagPointerEXT, (GLsizei stride, GLsizei count, const GLboolean *pointer), (stride, count, pointer))
+GL_PROC_VOID(736, glVertexP2ui, (GLenum type, GLuint value), (type, value))
+GL_PROC_VOID(737, glRenderbufferStorageEXT, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GL_PROC_VOID(738, glClearNamedFramebufferuiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value))
+GL_PROC_VOID(739, glAlphaFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod))
+GL_PROC_VOID(740, glSecondaryColor3us, (GLushort red, GLushort green, GLushort blue), (red, green, blue))
+GL_PROC_VOID(741, glCallCommandListNV, (GLuint list), (list))
+GL_PROC_VOID(742, glFogCoordFormatNV, (GLenum type, GLsizei stride), (type, stride))
+GL_PROC_VOID(743, glDeleteFencesAPPLE, (GLsizei n, const GLuint *fences), (n, fences))
+GL_PROC_VOID(744, glGetInfoLogARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog), (obj, maxLength, length, infoLog))
+GL_PROC_VOID(745, glDisablei, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(746, glProgramUniform2i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GL_PROC_VOID(747, glArrayElement, (GLint i), (i))
+GL_PROC_VOID(748, glClearNamedBufferDataEXT, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GL_PROC_VOID(749, glProgramUniform2ui, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GL_PROC_VOID(750, glUniform2ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GL_PROC_VOID(751, glWindowPos3dvARB, (const GLdouble *v), (v))
+GL_PROC_VOID(752, glGetHistogramParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(753, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GL_PROC_VOID(754, glTextureParameteriv, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param))
+GL_PROC_VOID(755, glGetCompressedTexImageARB, (GLenum target, GLint level, void *img), (target, level, img))
+GL_PROC_VOID(756, glMultiTexCoord2iARB, (GLenum target, GLint s, GLint t), (target, s, t))
+GL_PROC_VOID(757, glGenSamplers, (GLsizei count, GLuint *samplers), (count, samplers))
+GL_PROC_VOID(758, glMinSampleShadingARB, (GLfloat value), (value))
+GL_PROC_VOID(759, glColor4f, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_PROC_VOID(760, glGetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GL_PROC_VOID(761, glGetTextureImage, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels))
+GL_PROC_VOID(762, glUniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(763, glMakeBufferNonResidentNV, (GLenum target), (target))
+GL_PROC_VOID(764, glGetTransformFeedbacki_v, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param))
+GL_PROC(765, GLuint, glGetCommandHeaderNV, (GLenum tokenID, GLuint size), (tokenID, size))
+GL_PROC_VOID(766, glGetTextureLevelParameterfv, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params))
+GL_PROC_VOID(767, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_PROC_VOID(768, glVertexAttrib4usvARB, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(769, glWindowPos3dvMESA, (const GLdouble *v), (v))
+GL_PROC_VOID(770, glReplacementCodeuiColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, nx, ny, nz, x, y, z))
+GL_PROC_VOID(771, glCopyMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROC_VOID(772, glGetTexFilterFuncSGIS, (GLenum target, GLenum filter, GLfloat *weights), (target, filter, weights))
+GL_PROC_VOID(773, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GL_PROC_VOID(774, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GL_PROC_VOID(775, glTexCoord4dv, (const GLdouble *v), (v))
+GL_PROC_VOID(776, glFogCoordPointer, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GL_PROC_VOID(777, glWindowPos2s, (GLshort x, GLshort y), (x, y))
+GL_PROC_VOID(778, glGetPixelTransformParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(779, glClear, (GLbitfield mask), (mask))
+GL_PROC_VOID(780, glGetCombinerOutputParameterivNV, (GLenum stage, GLenum portion, GLenum pname, GLint *params), (stage, portion, pname, params))
+GL_PROC_VOID(781, glClearDepthfOES, (GLclampf depth), (depth))
+GL_PROC_VOID(782, glSecondaryColor3svEXT, (const GLshort *v), (v))
+GL_PROC_VOID(783, glSampleMaskSGIS, (GLclampf value, GLboolean invert), (value, invert))
+GL_PROC_VOID(784, glMap1d, (GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (target, u1, u2, stride, order, points))
+GL_PROC_VOID(785, glPixelStorex, (GLenum pname, GLfixed param), (pname, param))
+GL_PROC_VOID(786, glSpriteParameterivSGIX, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(787, glCoverageModulationNV, (GLenum components), (components))
+GL_PROC_VOID(788, glNormal3hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(789, glEdgeFlagFormatNV, (GLsizei stride), (stride))
+GL_PROC_VOID(790, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GL_PROC_VOID(791, glInvalidateSubFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GL_PROC_VOID(792, glProgramUniform1i64NV, (GLuint program, GLint location, GLint64EXT x), (program, location, x))
+GL_PROC(793, GLuint, glGenFragmentShadersATI, (GLuint range), (range))
+GL_PROC_VOID(794, glStencilThenCoverStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues))
+GL_PROC_VOID(795, glUniform1fARB, (GLint location, GLfloat v0), (location, v0))
+GL_PROC_VOID(796, glProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GL_PROC_VOID(797, glGetQueryBufferObjectiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GL_PROC(798, GLuint64, glGetTextureHandleNV, (GLuint texture), (texture))
+GL_PROC(799, GLhandleARB, glCreateShaderObjectARB, (GLenum shaderType), (shaderType))
+GL_PROC_VOID(800, glVertex2fv, (const GLfloat *v), (v))
+GL_PROC_VOID(801, glGetListParameterivSGIX, (GLuint list, GLenum pname, GLint *params), (list, pname, params))
+GL_PROC_VOID(802, glFramebufferParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(803, glUniform4ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GL_PROC(804, GLboolean, glPointAlongPathNV, (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY), (path, startSegment, numSegments, distance, x, y, tangentX, tangentY))
+GL_PROC_VOID(805, glGetnSeparableFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GL_PROC_VOID(806, glNormal3s, (GLshort nx, GLshort ny, GLshort nz), (nx, ny, nz))
+GL_PROC_VOID(807, glVertexArrayEdgeFlagOffsetEXT, (GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset), (vaobj, buffer, stride, offset))
+GL_PROC_VOID(808, glSpriteParameteriSGIX, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(809, glProgramUniform3dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(810, glFogCoorddv, (const GLdouble *coord), (coord))
+GL_PROC_VOID(811, glProgramUniform1ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GL_PROC_VOID(812, glGetMultiTexImageEXT, (GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (texunit, target, level, format, type, pixels))
+GL_PROC_VOID(813, glGetNamedFramebufferAttachmentParameteriv, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GL_PROC_VOID(814, glMultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GL_PROC_VOID(815, glShadingRateSampleOrderCustomNV, (GLenum rate, GLuint samples, const GLint *locations), (rate, samples, locations))
+GL_PROC_VOID(816, glColor4ui, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha))
+GL_PROC_VOID(817, glCompressedTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, width, format, imageSize, bits))
+GL_PROC_VOID(818, glProgramUniform1uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(819, glStencilOpSeparateATI, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GL_PROC_VOID(820, glProgramUniform1fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(821, glTextureParameterIiv, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params))
+GL_PROC_VOID(822, glUniform4i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GL_PROC(823, GLboolean, glIsObjectBufferATI, (GLuint buffer), (buffer))
+GL_PROC_VOID(824, glVertexArrayParameteriAPPLE, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(825, glProgramUniform4fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(826, glDeletePathsNV, (GLuint path, GLsizei range), (path, range))
+GL_PROC_VOID(827, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GL_PROC_VOID(828, glVertexAttribI2iEXT, (GLuint index, GLint x, GLint y), (index, x, y))
+GL_PROC_VOID(829, glGetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(830, glGetTextureLevelParameterivEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params), (texture, target, level, pname, params))
+GL_PROC(831, GLboolean, glIsImageHandleResidentARB, (GLuint64 handle), (handle))
+GL_PROC_VOID(832, glVertexAttrib2dNV, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_PROC_VOID(833, glProgramUniform2uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GL_PROC(834, GLsync, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags))
+GL_PROC_VOID(835, glNormalStream3dvATI, (GLenum stream, const GLdouble *coords), (stream, coords))
+GL_PROC_VOID(836, glPathCoverDepthFuncNV, (GLenum func), (func))
+GL_PROC_VOID(837, glGetMaterialxOES, (GLenum face, GLenum pname, GLfixed param), (face, pname, param))
+GL_PROC_VOID(838, glTextureStorageMem2DMultisampleEXT, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset))
+GL_PROC_VOID(839, glTexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords))
+GL_PROC_VOID(840, glDeleteProgramPipelines, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GL_PROC_VOID(841, glEvalMesh1, (GLenum mode, GLint i1, GLint i2), (mode, i1, i2))
+GL_PROC_VOID(842, glWeightPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GL_PROC(843, GLboolean, glIsVertexArray, (GLuint array), (array))
+GL_PROC_VOID(844, glTexCoord4f, (GLfloat s, GLfloat t, GLfloat r, GLfloat q), (s, t, r, q))
+GL_PROC(845, GLuint, glBindTextureUnitParameterEXT, (GLenum unit, GLenum value), (unit, value))
+GL_PROC_VOID(846, glNamedBufferStorage, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GL_PROC_VOID(847, glTexCoord3xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(848, glGetnPixelMapuivARB, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GL_PROC_VOID(849, glDrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+GL_PROC_VOID(850, glVertexArrayFogCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GL_PROC_VOID(851, glNormal3fVertex3fSUN, (GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (nx, ny, nz, x, y, z))
+GL_PROC_VOID(852, glShadingRateSampleOrderNV, (GLenum order), (order))
+GL_PROC_VOID(853, glRasterPos2xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(854, glTextureAttachMemoryNV, (GLuint texture, GLuint memory, GLuint64 offset), (texture, memory, offset))
+GL_PROC_VOID(855, glMultiTexCoord4s, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q))
+GL_PROC_VOID(856, glMultiTexCoord1i, (GLenum target, GLint s), (target, s))
+GL_PROC_VOID(857, glEGLImageTargetTexture2DOES, (GLenum target, GLeglImageOES image), (target, image))
+GL_PROC_VOID(858, glNormalPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer))
+GL_PROC_VOID(859, glReplacementCodeuiTexCoord2fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *v), (rc, tc, v))
+GL_PROC_VOID(860, glColor3i, (GLint red, GLint green, GLint blue), (red, green, blue))
+GL_PROC(861, GLboolean, glIsEnabledi, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(862, glMultiTexRenderbufferEXT, (GLenum texunit, GLenum target, GLuint renderbuffer), (texunit, target, renderbuffer))
+GL_PROC(863, const GLubyte *, glGetString, (GLenum name), (name))
+GL_PROC_VOID(864, glColor4sv, (const GLshort *v), (v))
+GL_PROC_VOID(865, glRectdv, (const GLdouble *v1, const GLdouble *v2), (v1, v2))
+GL_PROC_VOID(866, glProgramUniform1i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GL_PROC_VOID(867, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GL_PROC_VOID(868, glBindTexture, (GLenum target, GLuint texture), (target, texture))
+GL_PROC_VOID(869, glWindowPos3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(870, glVertexAttrib2svARB, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(871, glNewList, (GLuint list, GLenum mode), (list, mode))
+GL_PROC_VOID(872, glMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(873, glVertexStream4sATI, (GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w), (stream, x, y, z, w))
+GL_PROC_VOID(874, glGenTransformFeedbacksNV, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC_VOID(875, glGetMapAttribParameterfvNV, (GLenum target, GLuint index, GLenum pname, GLfloat *params), (target, index, pname, params))
+GL_PROC_VOID(876, glGetTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params))
+GL_PROC_VOID(877, glReadnPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GL_PROC_VOID(878, glUniform1i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GL_PROC_VOID(879, glCombinerParameterfvNV, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(880, glPointParameteriv, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(881, glGetSeparableFilter, (GLenum target, GLenum format, GLenum type, GLvoid *row, GLvoid *column, GLvoid *span), (target, format, type, row, column, span))
+GL_PROC_VOID(882, glTexCoordP2ui, (GLenum type, GLuint coords), (type, coords))
+GL_PROC_VOID(883, glRasterPos2dv, (const GLdouble *v), (v))
+GL_PROC_VOID(884, glVertexP4uiv, (GLenum type, const GLuint *value), (type, value))
+GL_PROC_VOID(885, glLoadTransposeMatrixfARB, (const GLfloat *m), (m))
+GL_PROC_VOID(886, glProgramLocalParameter4fvARB, (GLenum target, GLuint index, const GLfloat *params), (target, index, params))
+GL_PROC_VOID(887, glTexCoord4xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(888, glMatrixPopEXT, (GLenum mode), (mode))
+GL_PROC_VOID(889, glVertexAttribI2uiEXT, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GL_PROC_VOID(890, glCopyTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texture, target, level, internalformat, x, y, width, height, border))
+GL_PROC_VOID(891, glDrawElementArrayAPPLE, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GL_PROC_VOID(892, glGetProgramEnvParameterIivNV, (GLenum target, GLuint index, GLint *params), (target, index, params))
+GL_PROC_VOID(893, glTexCoord4bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(894, glPixelTexGenParameteriSGIS, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(895, glGenProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GL_PROC_VOID(896, glProgramUniformMatrix2x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(897, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GL_PROC_VOID(898, glGetFramebufferParameterivMESA, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(899, glPathStencilFuncNV, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GL_PROC_VOID(900, glTexCoord2xOES, (GLfixed s, GLfixed t), (s, t))
+GL_PROC_VOID(901, glVertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(902, glInvalidateBufferData, (GLuint buffer), (buffer))
+GL_PROC_VOID(903, glTextureParameterIuiv, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params))
+GL_PROC_VOID(904, glMakeImageHandleNonResidentNV, (GLuint64 handle), (handle))
+GL_PROC_VOID(905, glVertexAttribLFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GL_PROC_VOID(906, glViewportPositionWScaleNV, (GLuint index, GLfloat xcoeff, GLfloat ycoeff), (index, xcoeff, ycoeff))
+GL_PROC_VOID(907, glFragmentLightiSGIX, (GLenum light, GLenum pname, GLint param), (light, pname, param))
+GL_PROC_VOID(908, glRenderGpuMaskNV, (GLbitfield mask), (mask))
+GL_PROC_VOID(909, glVariantuivEXT, (GLuint id, const GLuint *addr), (id, addr))
+GL_PROC_VOID(910, glNamedFramebufferTextureEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GL_PROC_VOID(911, glTextureImage2DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations))
+GL_PROC_VOID(912, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROC_VOID(913, glMulticastGetQueryObjecti64vNV, (GLuint gpu, GLuint id, GLenum pname, GLint64 *params), (gpu, id, pname, params))
+GL_PROC_VOID(914, glMap1xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points), (target, u1, u2, stride, order, points))
+GL_PROC_VOID(915, glNormal3bv, (const GLbyte *v), (v))
+GL_PROC_VOID(916, glColorFragmentOp3ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod))
+GL_PROC_VOID(917, glGetClipPlanexOES, (GLenum plane, GLfixed *equation), (plane, equation))
+GL_PROC_VOID(918, glVertexAttrib1fvNV, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC(919, GLboolean, glIsEnabledIndexedEXT, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(920, glProgramUniform1i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(921, glTextureStorageMem2DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, memory, offset))
+GL_PROC_VOID(922, glCopyTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texture, target, level, internalformat, x, y, width, border))
+GL_PROC_VOID(923, glGetVariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GL_PROC_VOID(924, glBlendEquationEXT, (GLenum mode), (mode))
+GL_PROC(925, GLboolean, glIsProgramARB, (GLuint program), (program))
+GL_PROC_VOID(926, glBlendFuncSeparateEXT, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GL_PROC_VOID(927, glGetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values))
+GL_PROC_VOID(928, glConvolutionFilter1D, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *image), (target, internalformat, width, format, type, image))
+GL_PROC_VOID(929, glGetCombinerOutputParameterfvNV, (GLenum stage, GLenum portion, GLenum pname, GLfloat *params), (stage, portion, pname, params))
+GL_PROC_VOID(930, glPopClientAttrib, (void), ())
+GL_PROC_VOID(931, glWaitSemaphoreEXT, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts))
+GL_PROC_VOID(932, glEnable, (GLenum cap), (cap))
+GL_PROC_VOID(933, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GL_PROC_VOID(934, glFrustumxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f))
+GL_PROC_VOID(935, glMultiTexEnvfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param))
+GL_PROC_VOID(936, glEvalCoord2xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(937, glProgramUniform3uiEXT, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(938, glHistogram, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink))
+GL_PROC_VOID(939, glFinishObjectAPPLE, (GLenum object, GLint name), (object, name))
+GL_PROC_VOID(940, glProgramUniform4i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (program, location, x, y, z, w))
+GL_PROC_VOID(941, glNormalStream3fvATI, (GLenum stream, const GLfloat *coords), (stream, coords))
+GL_PROC_VOID(942, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(943, glNamedProgramLocalParameter4dEXT, (GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, target, index, x, y, z, w))
+GL_PROC_VOID(944, glMultiTexCoord2d, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GL_PROC_VOID(945, glFogCoorddvEXT, (const GLdouble *coord), (coord))
+GL_PROC(946, GLboolean, glAcquireKeyedMutexWin32EXT, (GLuint memory, GLuint64 key, GLuint timeout), (memory, key, timeout))
+GL_PROC(947, GLboolean, glIsBufferARB, (GLuint buffer), (buffer))
+GL_PROC_VOID(948, glTextureBuffer, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+GL_PROC_VOID(949, glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays))
+GL_PROC_VOID(950, glGetBooleanIndexedvEXT, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GL_PROC_VOID(951, glBindVertexBuffers, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+GL_PROC_VOID(952, glMap2f, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GL_PROC_VOID(953, glGetPerfMonitorCounterStringAMD, (GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString), (group, counter, bufSize, length, counterString))
+GL_PROC_VOID(954, glOrthoxOES, (GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f), (l, r, b, t, n, f))
+GL_PROC_VOID(955, glNormal3f, (GLfloat nx, GLfloat ny, GLfloat nz), (nx, ny, nz))
+GL_PROC_VOID(956, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(957, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(958, glProgramUniformMatrix3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(959, glResumeTransformFeedbackNV, (void), ())
+GL_PROC_VOID(960, glGetUniformivARB, (GLhandleARB programObj, GLint location, GLint *params), (programObj, location, params))
+GL_PROC_VOID(961, glUniform2d, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+GL_PROC_VOID(962, glRenderbufferStorageMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, coverageSamples, colorSamples, internalformat, width, height))
+GL_PROC_VOID(963, glTextureStorage3DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+GL_PROC_VOID(964, glSampleMaskIndexedNV, (GLuint index, GLbitfield mask), (index, mask))
+GL_PROC_VOID(965, glFramebufferSampleLocationsfvNV, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v))
+GL_PROC_VOID(966, glMatrixMult3x2fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC_VOID(967, glGetnHistogramARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GL_PROC_VOID(968, glGetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GL_PROC_VOID(969, glProgramUniform3i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(970, glCopyImageSubDataNV, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth))
+GL_PROC_VOID(971, glUniformHandleui64NV, (GLint location, GLuint64 value), (location, value))
+GL_PROC_VOID(972, glRasterPos3i, (GLint x, GLint y, GLint z), (x, y, z))
+GL_PROC_VOID(973, glVertex3i, (GLint x, GLint y, GLint z), (x, y, z))
+GL_PROC_VOID(974, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_PROC_VOID(975, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GL_PROC_VOID(976, glTextureMaterialEXT, (GLenum face, GLenum mode), (face, mode))
+GL_PROC_VOID(977, glUniform2fARB, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GL_PROC_VOID(978, glGetFogFuncSGIS, (GLfloat *points), (points))
+GL_PROC_VOID(979, glIndexPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GL_PROC_VOID(980, glVertex3bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(981, glUniform3fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(982, glClearBufferData, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data))
+GL_PROC_VOID(983, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices), (mode, start, end, count, type, indices))
+GL_PROC_VOID(984, glGetMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat *params), (texunit, target, pname, params))
+GL_PROC_VOID(985, glTexEnvfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(986, glFogxOES, (GLenum pname, GLfixed param), (pname, param))
+GL_PROC_VOID(987, glCopyTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+GL_PROC_VOID(988, glFramebufferFetchBarrierEXT, (void), ())
+GL_PROC_VOID(989, glVertex2iv, (const GLint *v), (v))
+GL_PROC_VOID(990, glGetNamedProgramLocalParameterdvEXT, (GLuint program, GLenum target, GLuint index, GLdouble *params), (program, target, index, params))
+GL_PROC_VOID(991, glBeginOcclusionQueryNV, (GLuint id), (id))
+GL_PROC_VOID(992, glColor4fNormal3fVertex3fvSUN, (const GLfloat *c, const GLfloat *n, const GLfloat *v), (c, n, v))
+GL_PROC_VOID(993, glStateCaptureNV, (GLuint state, GLenum mode), (state, mode))
+GL_PROC_VOID(994, glProgramUniform2dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(995, glGetInvariantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GL_PROC_VOID(996, glUpdateObjectBufferATI, (GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve), (buffer, offset, size, pointer, preserve))
+GL_PROC_VOID(997, glDeformSGIX, (GLbitfield mask), (mask))
+GL_PROC_VOID(998, glColorPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GL_PROC_VOID(999, glGetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values))
+GL_PROC_VOID(1000, glGetClipPlanefOES, (GLenum plane, GLfloat *equation), (plane, equation))
+GL_PROC_VOID(1001, glTexImage2D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, height, border, format, type, pixels))
+GL_PROC_VOID(1002, glScalef, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(1003, glTextureBufferRangeEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, target, internalformat, buffer, offset, size))
+GL_PROC_VOID(1004, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GL_PROC(1005, GLuint, glGenAsyncMarkersSGIX, (GLsizei range), (range))
+GL_PROC_VOID(1006, glGetShaderSourceARB, (GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source), (obj, maxLength, length, source))
+GL_PROC_VOID(1007, glMapGrid2d, (GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2), (un, u1, u2, vn, v1, v2))
+GL_PROC_VOID(1008, glConvolutionParameteri, (GLenum target, GLenum pname, GLint params), (target, pname, params))
+GL_PROC_VOID(1009, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(1010, glGetTransformFeedbackVaryingEXT, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROC_VOID(1011, glGetPathDashArrayNV, (GLuint path, GLfloat *dashArray), (path, dashArray))
+GL_PROC_VOID(1012, glGetProgramivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1013, glPixelStorei, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1014, glMultiDrawArraysIndirectAMD, (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride), (mode, indirect, primcount, stride))
+GL_PROC_VOID(1015, glColor3f, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GL_PROC_VOID(1016, glEvalCoord2d, (GLdouble u, GLdouble v), (u, v))
+GL_PROC_VOID(1017, glTexCoord1bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(1018, glClearNamedBufferSubDataEXT, (GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GL_PROC_VOID(1019, glMultiTexBufferEXT, (GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer), (texunit, target, internalformat, buffer))
+GL_PROC_VOID(1020, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1021, glCompressedTextureImage1DEXT, (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texture, target, level, internalformat, width, border, imageSize, bits))
+GL_PROC_VOID(1022, glDrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+GL_PROC_VOID(1023, glProgramUniform1ui64ARB, (GLuint program, GLint location, GLuint64 x), (program, location, x))
+GL_PROC_VOID(1024, glVertexAttribIFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride))
+GL_PROC_VOID(1025, glSecondaryColor3hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1026, glActiveTextureARB, (GLenum texture), (texture))
+GL_PROC_VOID(1027, glRasterPos4i, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GL_PROC_VOID(1028, glGetnMapivARB, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GL_PROC_VOID(1029, glVDPAUInitNV, (const void *vdpDevice, const void *getProcAddress), (vdpDevice, getProcAddress))
+GL_PROC_VOID(1030, glMulticastBufferSubDataNV, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data))
+GL_PROC_VOID(1031, glUniform3i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GL_PROC_VOID(1032, glResetHistogramEXT, (GLenum target), (target))
+GL_PROC_VOID(1033, glPathCommandsNV, (GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCommands, commands, numCoords, coordType, coords))
+GL_PROC_VOID(1034, glBlendColor, (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha), (red, green, blue, alpha))
+GL_PROC_VOID(1035, glIndexFuncEXT, (GLenum func, GLclampf ref), (func, ref))
+GL_PROC_VOID(1036, glReplacementCodeubvSUN, (const GLubyte *code), (code))
+GL_PROC_VOID(1037, glBindFragmentShaderATI, (GLuint id), (id))
+GL_PROC_VOID(1038, glVariantPointerEXT, (GLuint id, GLenum type, GLuint stride, const void *addr), (id, type, stride, addr))
+GL_PROC_VOID(1039, glCompressedMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits))
+GL_PROC_VOID(1040, glVertexAttribPointerNV, (GLuint index, GLint fsize, GLenum type, GLsizei stride, const void *pointer), (index, fsize, type, stride, pointer))
+GL_PROC_VOID(1041, glVertexAttrib2dvNV, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1042, glCurrentPaletteMatrixARB, (GLint index), (index))
+GL_PROC_VOID(1043, glFragmentLightModelivSGIX, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(1044, glTextureStorage3DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GL_PROC_VOID(1045, glScaled, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(1046, glGetShadingRateImagePaletteNV, (GLuint viewport, GLuint entry, GLenum *rate), (viewport, entry, rate))
+GL_PROC_VOID(1047, glTexCoord4fColor4fNormal3fVertex4fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v))
+GL_PROC_VOID(1048, glTexCoord2i, (GLint s, GLint t), (s, t))
+GL_PROC_VOID(1049, glFragmentLightModelfSGIX, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1050, glColorTableParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1051, glFogfv, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(1052, glMultiTexCoord2i, (GLenum target, GLint s, GLint t), (target, s, t))
+GL_PROC_VOID(1053, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, r, g, b, a, nx, ny, nz, x, y, z))
+GL_PROC_VOID(1054, glEvaluateDepthValuesARB, (void), ())
+GL_PROC_VOID(1055, glMultiDrawArraysIndirectBindlessNV, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, stride, vertexBufferCount))
+GL_PROC_VOID(1056, glMultiTexCoord3d, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GL_PROC_VOID(1057, glMultiTexCoord1iARB, (GLenum target, GLint s), (target, s))
+GL_PROC_VOID(1058, glGetInvariantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GL_PROC_VOID(1059, glDeleteProgramsNV, (GLsizei n, const GLuint *programs), (n, programs))
+GL_PROC_VOID(1060, glVertexWeightPointerEXT, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GL_PROC_VOID(1061, glGetPathTexGenivNV, (GLenum texCoordSet, GLenum pname, GLint *value), (texCoordSet, pname, value))
+GL_PROC_VOID(1062, glGetnPolygonStipple, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GL_PROC_VOID(1063, glVertexAttrib4fARB, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GL_PROC_VOID(1064, glGlobalAlphaFactorubSUN, (GLubyte factor), (factor))
+GL_PROC_VOID(1065, glTexCoord3d, (GLdouble s, GLdouble t, GLdouble r), (s, t, r))
+GL_PROC_VOID(1066, glActiveProgramEXT, (GLuint program), (program))
+GL_PROC_VOID(1067, glTexCoord4hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1068, glProgramUniformMatrix2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1069, glIndexi, (GLint c), (c))
+GL_PROC_VOID(1070, glClipPlane, (GLenum plane, const GLdouble *equation), (plane, equation))
+GL_PROC_VOID(1071, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GL_PROC_VOID(1072, glGetProgramResourceiv, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, bufSize, length, params))
+GL_PROC_VOID(1073, glMaxShaderCompilerThreadsKHR, (GLuint count), (count))
+GL_PROC_VOID(1074, glTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROC_VOID(1075, glPixelTexGenParameterfvSGIS, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(1076, glTexEnvxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GL_PROC_VOID(1077, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(1078, glPrioritizeTexturesxOES, (GLsizei n, const GLuint *textures, const GLfixed *priorities), (n, textures, priorities))
+GL_PROC_VOID(1079, glCompressedTexSubImage1DARB, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GL_PROC_VOID(1080, glMultiModeDrawElementsIBM, (const GLenum *mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, GLint modestride), (mode, count, type, indices, primcount, modestride))
+GL_PROC_VOID(1081, glUniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices))
+GL_PROC_VOID(1082, glProgramUniform1iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1083, glNamedFramebufferTexture3DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (framebuffer, attachment, textarget, texture, level, zoffset))
+GL_PROC_VOID(1084, glCopyMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texunit, target, level, xoffset, x, y, width))
+GL_PROC_VOID(1085, glVertexStream4dvATI, (GLenum stream, const GLdouble *coords), (stream, coords))
+GL_PROC_VOID(1086, glVertexStream1dATI, (GLenum stream, GLdouble x), (stream, x))
+GL_PROC_VOID(1087, glGetTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, GLint *params), (texture, target, pname, params))
+GL_PROC_VOID(1088, glUniform3iARB, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GL_PROC_VOID(1089, glWindowPos2fARB, (GLfloat x, GLfloat y), (x, y))
+GL_PROC_VOID(1090, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GL_PROC_VOID(1091, glGetSemaphoreParameterui64vEXT, (GLuint semaphore, GLenum pname, GLuint64 *params), (semaphore, pname, params))
+GL_PROC_VOID(1092, glUniform2uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(1093, glGetColorTableParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1094, glMakeNamedBufferResidentNV, (GLuint buffer, GLenum access), (buffer, access))
+GL_PROC_VOID(1095, glVertexAttribL3i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z), (index, x, y, z))
+GL_PROC_VOID(1096, glGetTexParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GL_PROC_VOID(1097, glDetachObjectARB, (GLhandleARB containerObj, GLhandleARB attachedObj), (containerObj, attachedObj))
+GL_PROC_VOID(1098, glUnlockArraysEXT, (void), ())
+GL_PROC(1099, GLenum, glObjectPurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option))
+GL_PROC_VOID(1100, glGetNamedProgramLocalParameterIuivEXT, (GLuint program, GLenum target, GLuint index, GLuint *params), (program, target, index, params))
+GL_PROC_VOID(1101, glBlendBarrierNV, (void), ())
+GL_PROC_VOID(1102, glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, tc, c, n, v))
+GL_PROC_VOID(1103, glVertexAttribs4hvNV, (GLuint index, GLsizei n, const GLhalfNV *v), (index, n, v))
+GL_PROC_VOID(1104, glGetSharpenTexFuncSGIS, (GLenum target, GLfloat *points), (target, points))
+GL_PROC_VOID(1105, glGetMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points), (target, index, type, ustride, vstride, packed, points))
+GL_PROC_VOID(1106, glMaxShaderCompilerThreadsARB, (GLuint count), (count))
+GL_PROC_VOID(1107, glUniform1iARB, (GLint location, GLint v0), (location, v0))
+GL_PROC_VOID(1108, glMultiTexCoord3ivARB, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(1109, glNormal3iv, (const GLint *v), (v))
+GL_PROC_VOID(1110, glVertexAttrib2fNV, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GL_PROC_VOID(1111, glNamedBufferStorageEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GL_PROC_VOID(1112, glGetDetailTexFuncSGIS, (GLenum target, GLfloat *points), (target, points))
+GL_PROC_VOID(1113, glNormal3d, (GLdouble nx, GLdouble ny, GLdouble nz), (nx, ny, nz))
+GL_PROC_VOID(1114, glFragmentLightModeliSGIX, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1115, glRectsv, (const GLshort *v1, const GLshort *v2), (v1, v2))
+GL_PROC_VOID(1116, glGetInternalformati64v, (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params), (target, internalformat, pname, bufSize, params))
+GL_PROC_VOID(1117, glGenProgramsARB, (GLsizei n, GLuint *programs), (n, programs))
+GL_PROC_VOID(1118, glViewportIndexedfv, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(1119, glProgramStringARB, (GLenum target, GLenum format, GLsizei len, const void *string), (target, format, len, string))
+GL_PROC_VOID(1120, glWindowPos3dARB, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(1121, glFramebufferTexture2DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_PROC_VOID(1122, glCompileShaderARB, (GLhandleARB shaderObj), (shaderObj))
+GL_PROC(1123, GLboolean, glIsPointInStrokePathNV, (GLuint path, GLfloat x, GLfloat y), (path, x, y))
+GL_PROC_VOID(1124, glCopyNamedBufferSubData, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GL_PROC_VOID(1125, glTexCoord3hNV, (GLhalfNV s, GLhalfNV t, GLhalfNV r), (s, t, r))
+GL_PROC_VOID(1126, glSubpixelPrecisionBiasNV, (GLuint xbits, GLuint ybits), (xbits, ybits))
+GL_PROC_VOID(1127, glDetailTexFuncSGIS, (GLenum target, GLsizei n, const GLfloat *points), (target, n, points))
+GL_PROC_VOID(1128, glBlendBarrierKHR, (void), ())
+GL_PROC_VOID(1129, glSecondaryColor3dEXT, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GL_PROC_VOID(1130, glVertexAttrib2fvARB, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(1131, glSetFenceNV, (GLuint fence, GLenum condition), (fence, condition))
+GL_PROC_VOID(1132, glGetVideouivNV, (GLuint video_slot, GLenum pname, GLuint *params), (video_slot, pname, params))
+GL_PROC_VOID(1133, glGetnConvolutionFilterARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GL_PROC_VOID(1134, glCreateStatesNV, (GLsizei n, GLuint *states), (n, states))
+GL_PROC_VOID(1135, glVertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(1136, glGetProgramNamedParameterdvNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble *params), (id, len, name, params))
+GL_PROC_VOID(1137, glDepthBoundsdNV, (GLdouble zmin, GLdouble zmax), (zmin, zmax))
+GL_PROC_VOID(1138, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GL_PROC_VOID(1139, glCopyMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (texunit, target, level, internalformat, x, y, width, border))
+GL_PROC_VOID(1140, glQueryCounter, (GLuint id, GLenum target), (id, target))
+GL_PROC_VOID(1141, glMaterialxOES, (GLenum face, GLenum pname, GLfixed param), (face, pname, param))
+GL_PROC_VOID(1142, glGetMinmaxEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GL_PROC_VOID(1143, glCombinerOutputNV, (GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum), (stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum))
+GL_PROC_VOID(1144, glGetConvolutionParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1145, glUseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GL_PROC_VOID(1146, glVertexAttrib4ubNV, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GL_PROC_VOID(1147, glDispatchComputeIndirect, (GLintptr indirect), (indirect))
+GL_PROC_VOID(1148, glColor4usv, (const GLushort *v), (v))
+GL_PROC_VOID(1149, glNamedCopyBufferSubDataEXT, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GL_PROC_VOID(1150, glDrawArraysInstancedARB, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount))
+GL_PROC_VOID(1151, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GL_PROC_VOID(1152, glVertexAttribL3dvEXT, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC(1153, GLboolean, glIsProgram, (GLuint program), (program))
+GL_PROC_VOID(1154, glCompressedTexImage2DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GL_PROC(1155, GLushort, glGetStageIndexNV, (GLenum shadertype), (shadertype))
+GL_PROC_VOID(1156, glDrawVkImageNV, (GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (vkImage, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1))
+GL_PROC_VOID(1157, glActiveStencilFaceEXT, (GLenum face), (face))
+GL_PROC_VOID(1158, glCompileCommandListNV, (GLuint list), (list))
+GL_PROC_VOID(1159, glPushClientAttrib, (GLbitfield mask), (mask))
+GL_PROC_VOID(1160, glGetnUniformi64vARB, (GLuint program, GLint location, GLsizei bufSize, GLint64 *params), (program, location, bufSize, params))
+GL_PROC_VOID(1161, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+GL_PROC_VOID(1162, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GL_PROC_VOID(1163, glClearDepth, (GLclampd depth), (depth))
+GL_PROC_VOID(1164, glVertexAttribL3dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1165, glTextureRangeAPPLE, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer))
+GL_PROC_VOID(1166, glEvalCoord2fv, (const GLfloat *u), (u))
+GL_PROC_VOID(1167, glVertexStream1sATI, (GLenum stream, GLshort x), (stream, x))
+GL_PROC_VOID(1168, glReplacementCodeuiVertex3fSUN, (GLuint rc, GLfloat x, GLfloat y, GLfloat z), (rc, x, y, z))
+GL_PROC_VOID(1169, glProgramUniform4uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(1170, glRasterPos4xOES, (GLfixed x, GLfixed y, GLfixed z, GLfixed w), (x, y, z, w))
+GL_PROC_VOID(1171, glProgramNamedParameter4dvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v), (id, len, name, v))
+GL_PROC_VOID(1172, glLighti, (GLenum light, GLenum pname, GLint param), (light, pname, param))
+GL_PROC_VOID(1173, glTexCoordPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GL_PROC_VOID(1174, glClampColorARB, (GLenum target, GLenum clamp), (target, clamp))
+GL_PROC_VOID(1175, glVertex4xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(1176, glRotated, (GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (angle, x, y, z))
+GL_PROC_VOID(1177, glBindBufferOffsetNV, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset))
+GL_PROC_VOID(1178, glWindowPos2dvARB, (const GLdouble *v), (v))
+GL_PROC_VOID(1179, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GL_PROC_VOID(1180, glGetPathMetricRangeNV, (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics), (metricQueryMask, firstPathName, numPaths, stride, metrics))
+GL_PROC_VOID(1181, glMultiTexGeniEXT, (GLenum texunit, GLenum coord, GLenum pname, GLint param), (texunit, coord, pname, param))
+GL_PROC_VOID(1182, glGetMapfv, (GLenum target, GLenum query, GLfloat *v), (target, query, v))
+GL_PROC_VOID(1183, glTexImage3DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations))
+GL_PROC_VOID(1184, glTangent3dEXT, (GLdouble tx, GLdouble ty, GLdouble tz), (tx, ty, tz))
+GL_PROC_VOID(1185, glMapGrid1d, (GLint un, GLdouble u1, GLdouble u2), (un, u1, u2))
+GL_PROC(1186, GLboolean, glIsQueryARB, (GLuint id), (id))
+GL_PROC_VOID(1187, glMultiTexCoord1fARB, (GLenum target, GLfloat s), (target, s))
+GL_PROC_VOID(1188, glProgramLocalParametersI4ivNV, (GLenum target, GLuint index, GLsizei count, const GLint *params), (target, index, count, params))
+GL_PROC_VOID(1189, glDebugMessageEnableAMD, (GLenum category, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (category, severity, count, ids, enabled))
+GL_PROC_VOID(1190, glEndConditionalRenderNV, (void), ())
+GL_PROC_VOID(1191, glGetMinmaxParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1192, glDeleteFencesNV, (GLsizei n, const GLuint *fences), (n, fences))
+GL_PROC_VOID(1193, glVertexAttribL2dEXT, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_PROC_VOID(1194, glViewportSwizzleNV, (GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew), (index, swizzlex, swizzley, swizzlez, swizzlew))
+GL_PROC_VOID(1195, glRasterPos3iv, (const GLint *v), (v))
+GL_PROC_VOID(1196, glProgramUniform2fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(1197, glWindowPos4ivMESA, (const GLint *v), (v))
+GL_PROC_VOID(1198, glMultiTexCoord1xvOES, (GLenum texture, const GLfixed *coords), (texture, coords))
+GL_PROC_VOID(1199, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GL_PROC_VOID(1200, glGenQueriesARB, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC_VOID(1201, glCompressedTexImage1DARB, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GL_PROC_VOID(1202, glUniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(1203, glDisableVariantClientStateEXT, (GLuint id), (id))
+GL_PROC_VOID(1204, glTexCoord4bOES, (GLbyte s, GLbyte t, GLbyte r, GLbyte q), (s, t, r, q))
+GL_PROC_VOID(1205, glMultiTexCoord4i, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GL_PROC_VOID(1206, glInvalidateTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+GL_PROC_VOID(1207, glGetnMinmaxARB, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GL_PROC_VOID(1208, glEvalMapsNV, (GLenum target, GLenum mode), (target, mode))
+GL_PROC_VOID(1209, glGenBuffersARB, (GLsizei n, GLuint *buffers), (n, buffers))
+GL_PROC_VOID(1210, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_PROC_VOID(1211, glMultiTexCoord2dvARB, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(1212, glPopAttrib, (void), ())
+GL_PROC(1213, GLuint, glBindLightParameterEXT, (GLenum light, GLenum value), (light, value))
+GL_PROC_VOID(1214, glVertexAttribL3ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (index, x, y, z))
+GL_PROC_VOID(1215, glUniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(1216, glProgramUniformMatrix2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1217, glFramebufferTextureARB, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GL_PROC_VOID(1218, glProgramUniform4dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(1219, glVertexAttribI2iv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(1220, glActiveTexture, (GLenum texture), (texture))
+GL_PROC_VOID(1221, glBindVertexArrayAPPLE, (GLuint array), (array))
+GL_PROC_VOID(1222, glPixelDataRangeNV, (GLenum target, GLsizei length, const void *pointer), (target, length, pointer))
+GL_PROC_VOID(1223, glLockArraysEXT, (GLint first, GLsizei count), (first, count))
+GL_PROC_VOID(1224, glTexGeniv, (GLenum coord, GLenum pname, const GLint *params), (coord, pname, params))
+GL_PROC_VOID(1225, glMap2xOES, (GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GL_PROC_VOID(1226, glColorP3ui, (GLenum type, GLuint color), (type, color))
+GL_PROC_VOID(1227, glFinish, (void), ())
+GL_PROC_VOID(1228, glGetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GL_PROC_VOID(1229, glGetQueryObjectuivARB, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GL_PROC_VOID(1230, glEndVideoCaptureNV, (GLuint video_capture_slot), (video_capture_slot))
+GL_PROC_VOID(1231, glMultiTexCoord1f, (GLenum target, GLfloat s), (target, s))
+GL_PROC_VOID(1232, glRasterPos2d, (GLdouble x, GLdouble y), (x, y))
+GL_PROC_VOID(1233, glSecondaryColor3f, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GL_PROC_VOID(1234, glProgramUniform1uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(1235, glUniform3ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z), (location, x, y, z))
+GL_PROC_VOID(1236, glPixelZoomxOES, (GLfixed xfactor, GLfixed yfactor), (xfactor, yfactor))
+GL_PROC_VOID(1237, glGenPerfMonitorsAMD, (GLsizei n, GLuint *monitors), (n, monitors))
+GL_PROC_VOID(1238, glGetVertexAttribPointervNV, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GL_PROC(1239, GLboolean, glIsVertexAttribEnabledAPPLE, (GLuint index, GLenum pname), (index, pname))
+GL_PROC_VOID(1240, glMakeTextureHandleNonResidentNV, (GLuint64 handle), (handle))
+GL_PROC_VOID(1241, glTextureStorage2DMultisampleEXT, (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, target, samples, internalformat, width, height, fixedsamplelocations))
+GL_PROC_VOID(1242, glBlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GL_PROC_VOID(1243, glNamedBufferStorageMemEXT, (GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset), (buffer, size, memory, offset))
+GL_PROC_VOID(1244, glEndPerfMonitorAMD, (GLuint monitor), (monitor))
+GL_PROC_VOID(1245, glTangentPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GL_PROC_VOID(1246, glTangent3dvEXT, (const GLdouble *v), (v))
+GL_PROC_VOID(1247, glColor4d, (GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha), (red, green, blue, alpha))
+GL_PROC_VOID(1248, glMultiTexSubImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROC_VOID(1249, glReplacementCodeuiSUN, (GLuint code), (code))
+GL_PROC_VOID(1250, glGetUniformi64vARB, (GLuint program, GLint location, GLint64 *params), (program, location, params))
+GL_PROC_VOID(1251, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_PROC_VOID(1252, glNamedProgramLocalParameter4dvEXT, (GLuint program, GLenum target, GLuint index, const GLdouble *params), (program, target, index, params))
+GL_PROC_VOID(1253, glWriteMaskEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW))
+GL_PROC_VOID(1254, glGetVariantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GL_PROC_VOID(1255, glTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, const GLuint *params), (texture, target, pname, params))
+GL_PROC_VOID(1256, glProgramUniform4i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (program, location, x, y, z, w))
+GL_PROC_VOID(1257, glGetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GL_PROC_VOID(1258, glProgramUniformHandleui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *values), (program, location, count, values))
+GL_PROC_VOID(1259, glPolygonOffsetEXT, (GLfloat factor, GLfloat bias), (factor, bias))
+GL_PROC_VOID(1260, glMapVertexAttrib1dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (index, size, u1, u2, stride, order, points))
+GL_PROC_VOID(1261, glMatrixTranslatefEXT, (GLenum mode, GLfloat x, GLfloat y, GLfloat z), (mode, x, y, z))
+GL_PROC(1262, GLboolean, glIsShader, (GLuint shader), (shader))
+GL_PROC_VOID(1263, glVertexP2uiv, (GLenum type, const GLuint *value), (type, value))
+GL_PROC_VOID(1264, glUniform1ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(1265, glGetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params))
+GL_PROC_VOID(1266, glPixelTransformParameterfEXT, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_PROC_VOID(1267, glVertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC_VOID(1268, glMultiTexGenivEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLint *params), (texunit, coord, pname, params))
+GL_PROC_VOID(1269, glProgramUniform2uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(1270, glFogCoordfvEXT, (const GLfloat *coord), (coord))
+GL_PROC_VOID(1271, glVertexAttribL1d, (GLuint index, GLdouble x), (index, x))
+GL_PROC(1272, GLsync, glCreateSyncFromCLeventARB, (struct _cl_context *context, struct _cl_event *event, GLbitfield flags), (context, event, flags))
+GL_PROC(1273, GLboolean, glIsPathNV, (GLuint path), (path))
+GL_PROC_VOID(1274, glBindVertexArray, (GLuint array), (array))
+GL_PROC_VOID(1275, glMultiTexCoord1bOES, (GLenum texture, GLbyte s), (texture, s))
+GL_PROC_VOID(1276, glProgramEnvParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params))
+GL_PROC_VOID(1277, glSecondaryColor3bEXT, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GL_PROC_VOID(1278, glTexCoord2hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1279, glBlendFunci, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GL_PROC_VOID(1280, glTextureStorageMem3DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, height, depth, memory, offset))
+GL_PROC_VOID(1281, glVertexAttrib3dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_PROC_VOID(1282, glReleaseShaderCompiler, (void), ())
+GL_PROC_VOID(1283, glVertexStream2dATI, (GLenum stream, GLdouble x, GLdouble y), (stream, x, y))
+GL_PROC_VOID(1284, glInitNames, (void), ())
+GL_PROC_VOID(1285, glWindowPos4sMESA, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GL_PROC_VOID(1286, glImportSemaphoreWin32HandleEXT, (GLuint semaphore, GLenum handleType, void *handle), (semaphore, handleType, handle))
+GL_PROC_VOID(1287, glColor3bv, (const GLbyte *v), (v))
+GL_PROC_VOID(1288, glAlphaToCoverageDitherControlNV, (GLenum mode), (mode))
+GL_PROC_VOID(1289, glProgramUniform3iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(1290, glBlitNamedFramebuffer, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_PROC_VOID(1291, glActiveShaderProgram, (GLuint pipeline, GLuint program), (pipeline, program))
+GL_PROC_VOID(1292, glVertexAttribPointerARB, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GL_PROC_VOID(1293, glTransformFeedbackBufferBase, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+GL_PROC_VOID(1294, glMapParameterivNV, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(1295, glReplacementCodeusvSUN, (const GLushort *code), (code))
+GL_PROC(1296, GLuint, glGenPathsNV, (GLsizei range), (range))
+GL_PROC_VOID(1297, glGetProgramResourceName, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name))
+GL_PROC_VOID(1298, glPatchParameterfv, (GLenum pname, const GLfloat *values), (pname, values))
+GL_PROC_VOID(1299, glNamedProgramLocalParametersI4ivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params), (program, target, index, count, params))
+GL_PROC_VOID(1300, glVertexAttrib4dvARB, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1301, glProgramUniform2ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1302, glNamedFramebufferTextureLayer, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GL_PROC_VOID(1303, glProgramUniformMatrix2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1304, glTexCoord1fv, (const GLfloat *v), (v))
+GL_PROC_VOID(1305, glDeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GL_PROC_VOID(1306, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1307, glVertexWeightfEXT, (GLfloat weight), (weight))
+GL_PROC_VOID(1308, glMultiModeDrawArraysIBM, (const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride), (mode, first, count, primcount, modestride))
+GL_PROC_VOID(1309, glGetnUniformui64vARB, (GLuint program, GLint location, GLsizei bufSize, GLuint64 *params), (program, location, bufSize, params))
+GL_PROC_VOID(1310, glTexCoord1i, (GLint s), (s))
+GL_PROC_VOID(1311, glVertexAttrib4svARB, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(1312, glGetTexBumpParameterfvATI, (GLenum pname, GLfloat *param), (pname, param))
+GL_PROC_VOID(1313, glGetnCompressedTexImage, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels))
+GL_PROC(1314, GLint, glGetProgramResourceLocation, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GL_PROC_VOID(1315, glMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLuint *params), (texunit, target, pname, params))
+GL_PROC_VOID(1316, glProgramUniform1dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(1317, glGetShaderPrecisionFormat, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GL_PROC_VOID(1318, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GL_PROC_VOID(1319, glSecondaryColor3i, (GLint red, GLint green, GLint blue), (red, green, blue))
+GL_PROC_VOID(1320, glMultiTexCoord3hvNV, (GLenum target, const GLhalfNV *v), (target, v))
+GL_PROC_VOID(1321, glDrawBuffersARB, (GLsizei n, const GLenum *bufs), (n, bufs))
+GL_PROC_VOID(1322, glSpecializeShader, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GL_PROC_VOID(1323, glProgramUniform2i64ARB, (GLuint program, GLint location, GLint64 x, GLint64 y), (program, location, x, y))
+GL_PROC_VOID(1324, glGetMinmaxParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1325, glMultiDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, const GLint *first, const GLsizei *count, GLsizei primcount), (mode, start, end, first, count, primcount))
+GL_PROC_VOID(1326, glCompileShader, (GLuint shader), (shader))
+GL_PROC(1327, GLboolean, glIsNamedStringARB, (GLint namelen, const GLchar *name), (namelen, name))
+GL_PROC_VOID(1328, glPushAttrib, (GLbitfield mask), (mask))
+GL_PROC_VOID(1329, glSamplePatternEXT, (GLenum pattern), (pattern))
+GL_PROC_VOID(1330, glGetPixelTexGenParameterfvSGIS, (GLenum pname, GLfloat *params), (pname, params))
+GL_PROC_VOID(1331, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GL_PROC_VOID(1332, glTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels))
+GL_PROC_VOID(1333, glMultiTexCoord2fvARB, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(1334, glVertexArrayVertexAttribFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GL_PROC_VOID(1335, glSelectPerfMonitorCountersAMD, (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList), (monitor, enable, group, numCounters, counterList))
+GL_PROC(1336, GLboolean, glIsTextureHandleResidentNV, (GLuint64 handle), (handle))
+GL_PROC_VOID(1337, glPointSize, (GLfloat size), (size))
+GL_PROC_VOID(1338, glGetVertexAttribLdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_PROC_VOID(1339, glBindVideoCaptureStreamTextureNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture), (video_capture_slot, stream, frame_region, target, texture))
+GL_PROC_VOID(1340, glFlushMappedNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GL_PROC_VOID(1341, glPathParameteriNV, (GLuint path, GLenum pname, GLint value), (path, pname, value))
+GL_PROC_VOID(1342, glCombinerParameterivNV, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(1343, glVertexBindingDivisor, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+GL_PROC_VOID(1344, glGetnPixelMapfv, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GL_PROC_VOID(1345, glGenRenderbuffersEXT, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GL_PROC_VOID(1346, glMultiTexCoord2bOES, (GLenum texture, GLbyte s, GLbyte t), (texture, s, t))
+GL_PROC_VOID(1347, glTexCoord4fColor4fNormal3fVertex4fSUN, (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w))
+GL_PROC_VOID(1348, glGenerateTextureMipmap, (GLuint texture), (texture))
+GL_PROC_VOID(1349, glSecondaryColor3uiv, (const GLuint *v), (v))
+GL_PROC_VOID(1350, glMultiTexCoord1fv, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(1351, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_PROC_VOID(1352, glTextureBufferRange, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+GL_PROC_VOID(1353, glMultiTexCoord2dARB, (GLenum target, GLdouble s, GLdouble t), (target, s, t))
+GL_PROC_VOID(1354, glGetMapiv, (GLenum target, GLenum query, GLint *v), (target, query, v))
+GL_PROC_VOID(1355, glProgramUniform3dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z), (program, location, x, y, z))
+GL_PROC_VOID(1356, glVertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+GL_PROC_VOID(1357, glTextureStorage1D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+GL_PROC_VOID(1358, glGetNamedBufferParameteri64v, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params))
+GL_PROC_VOID(1359, glCopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GL_PROC_VOID(1360, glVertex3iv, (const GLint *v), (v))
+GL_PROC_VOID(1361, glGetnMapiv, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GL_PROC_VOID(1362, glProgramEnvParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w))
+GL_PROC_VOID(1363, glSignalVkSemaphoreNV, (GLuint64 vkSemaphore), (vkSemaphore))
+GL_PROC_VOID(1364, glTextureStorage3D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+GL_PROC_VOID(1365, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GL_PROC_VOID(1366, glFogiv, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(1367, glColorSubTable, (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid *data), (target, start, count, format, type, data))
+GL_PROC_VOID(1368, glBufferAddressRangeNV, (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length), (pname, index, address, length))
+GL_PROC_VOID(1369, glConvolutionParameteriEXT, (GLenum target, GLenum pname, GLint params), (target, pname, params))
+GL_PROC_VOID(1370, glDisableClientStateiEXT, (GLenum array, GLuint index), (array, index))
+GL_PROC_VOID(1371, glVertexAttribL4ui64NV, (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (index, x, y, z, w))
+GL_PROC_VOID(1372, glProgramUniform4fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(1373, glSetFragmentShaderConstantATI, (GLuint dst, const GLfloat *value), (dst, value))
+GL_PROC_VOID(1374, glVertexAttrib4hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (index, x, y, z, w))
+GL_PROC_VOID(1375, glTexCoord2fColor4ubVertex3fvSUN, (const GLfloat *tc, const GLubyte *c, const GLfloat *v), (tc, c, v))
+GL_PROC_VOID(1376, glFreeObjectBufferATI, (GLuint buffer), (buffer))
+GL_PROC_VOID(1377, glProgramLocalParameterI4ivNV, (GLenum target, GLuint index, const GLint *params), (target, index, params))
+GL_PROC_VOID(1378, glProgramUniformMatrix4x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1379, glDeleteNamesAMD, (GLenum identifier, GLuint num, const GLuint *names), (identifier, num, names))
+GL_PROC_VOID(1380, glTexStorageMem3DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, depth, memory, offset))
+GL_PROC_VOID(1381, glNamedProgramLocalParameter4fEXT, (GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (program, target, index, x, y, z, w))
+GL_PROC_VOID(1382, glGetPixelMapusv, (GLenum map, GLushort *values), (map, values))
+GL_PROC_VOID(1383, glMatrixMult3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC(1384, GLboolean, glUnmapNamedBufferEXT, (GLuint buffer), (buffer))
+GL_PROC_VOID(1385, glVertexStream2iATI, (GLenum stream, GLint x, GLint y), (stream, x, y))
+GL_PROC_VOID(1386, glVertexArrayRangeNV, (GLsizei length, const void *pointer), (length, pointer))
+GL_PROC_VOID(1387, glIndexPointerEXT, (GLenum type, GLsizei stride, GLsizei count, const void *pointer), (type, stride, count, pointer))
+GL_PROC_VOID(1388, glGetProgramNamedParameterfvNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat *params), (id, len, name, params))
+GL_PROC(1389, GLboolean, glIsFenceAPPLE, (GLuint fence), (fence))
+GL_PROC_VOID(1390, glCullParameterfvEXT, (GLenum pname, GLfloat *params), (pname, params))
+GL_PROC_VOID(1391, glTexCoord1bOES, (GLbyte s), (s))
+GL_PROC_VOID(1392, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(1393, glPointParameterfvSGIS, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(1394, glEndOcclusionQueryNV, (void), ())
+GL_PROC_VOID(1395, glVertexArrayNormalOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GL_PROC_VOID(1396, glVertexAttribI3uivEXT, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(1397, glNormal3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(1398, glBlendEquationi, (GLuint buf, GLenum mode), (buf, mode))
+GL_PROC_VOID(1399, glUniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(1400, glVertex4hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1401, glCopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GL_PROC(1402, GLuint, glAsyncCopyImageSubDataNVX, (GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *waitValueArray, GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray), (waitSemaphoreCount, waitSemaphoreArray, waitValueArray, srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth, signalSemaphoreCount, signalSemaphoreArray, signalValueArray))
+GL_PROC_VOID(1403, glPopGroupMarkerEXT, (void), ())
+GL_PROC_VOID(1404, glNamedBufferData, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GL_PROC_VOID(1405, glRotatef, (GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (angle, x, y, z))
+GL_PROC_VOID(1406, glGetCompressedTextureImage, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels))
+GL_PROC_VOID(1407, glProgramLocalParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GL_PROC_VOID(1408, glVertexArrayAttribIFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GL_PROC_VOID(1409, glClearNamedFramebufferiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value))
+GL_PROC_VOID(1410, glMultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GL_PROC_VOID(1411, glTextureBarrierNV, (void), ())
+GL_PROC_VOID(1412, glUniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC(1413, GLint, glGetUniformBufferSizeEXT, (GLuint program, GLint location), (program, location))
+GL_PROC(1414, GLenum, glCheckFramebufferStatusEXT, (GLenum target), (target))
+GL_PROC_VOID(1415, glGetPixelTexGenParameterivSGIS, (GLenum pname, GLint *params), (pname, params))
+GL_PROC_VOID(1416, glMateriali, (GLenum face, GLenum pname, GLint param), (face, pname, param))
+GL_PROC_VOID(1417, glUniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GL_PROC_VOID(1418, glFramebufferTextureLayerARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GL_PROC_VOID(1419, glSecondaryColor3fvEXT, (const GLfloat *v), (v))
+GL_PROC_VOID(1420, glProgramUniform4ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w), (program, location, x, y, z, w))
+GL_PROC_VOID(1421, glRasterPos4xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(1422, glDrawMeshTasksNV, (GLuint first, GLuint count), (first, count))
+GL_PROC_VOID(1423, glInvalidateNamedFramebufferData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments))
+GL_PROC_VOID(1424, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GL_PROC_VOID(1425, glGetnUniformiv, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GL_PROC_VOID(1426, glVertexBlendEnvfATI, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1427, glGetFragmentLightivSGIX, (GLenum light, GLenum pname, GLint *params), (light, pname, params))
+GL_PROC_VOID(1428, glGetTextureParameterfv, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params))
+GL_PROC_VOID(1429, glEnableVertexArrayAttribEXT, (GLuint vaobj, GLuint index), (vaobj, index))
+GL_PROC_VOID(1430, glDebugMessageInsertARB, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GL_PROC_VOID(1431, glVertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC_VOID(1432, glGetActiveVaryingNV, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROC_VOID(1433, glFramebufferDrawBuffersEXT, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GL_PROC_VOID(1434, glFramebufferParameteriMESA, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(1435, glBinormal3dvEXT, (const GLdouble *v), (v))
+GL_PROC_VOID(1436, glColor3hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1437, glMultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GL_PROC_VOID(1438, glGetnTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels))
+GL_PROC_VOID(1439, glDrawPixels, (GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels), (width, height, format, type, pixels))
+GL_PROC_VOID(1440, glDeleteLists, (GLuint list, GLsizei range), (list, range))
+GL_PROC(1441, GLboolean, glAreTexturesResidentEXT, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences))
+GL_PROC_VOID(1442, glGetFragmentLightfvSGIX, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params))
+GL_PROC_VOID(1443, glMultMatrixxOES, (const GLfixed *m), (m))
+GL_PROC_VOID(1444, glTexCoord4iv, (const GLint *v), (v))
+GL_PROC_VOID(1445, glGetVideoui64vNV, (GLuint video_slot, GLenum pname, GLuint64EXT *params), (video_slot, pname, params))
+GL_PROC_VOID(1446, glMultiTexCoord1sARB, (GLenum target, GLshort s), (target, s))
+GL_PROC_VOID(1447, glGetTexEnvxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GL_PROC_VOID(1448, glFogCoordfEXT, (GLfloat coord), (coord))
+GL_PROC_VOID(1449, glMultiTexCoord3i, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GL_PROC_VOID(1450, glGetPointerIndexedvEXT, (GLenum target, GLuint index, void **data), (target, index, data))
+GL_PROC_VOID(1451, glMultTransposeMatrixdARB, (const GLdouble *m), (m))
+GL_PROC_VOID(1452, glNormalFormatNV, (GLenum type, GLsizei stride), (type, stride))
+GL_PROC_VOID(1453, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(1454, glNormalStream3ivATI, (GLenum stream, const GLint *coords), (stream, coords))
+GL_PROC_VOID(1455, glEnablei, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(1456, glVertexAttrib4NbvARB, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC(1457, GLint, glFinishAsyncSGIX, (GLuint *markerp), (markerp))
+GL_PROC_VOID(1458, glTexCoord2fColor3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, x, y, z))
+GL_PROC_VOID(1459, glTexCoord2fColor3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *v), (tc, c, v))
+GL_PROC(1460, GLboolean, glIsSampler, (GLuint sampler), (sampler))
+GL_PROC_VOID(1461, glTexCoord2fNormal3fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z), (s, t, nx, ny, nz, x, y, z))
+GL_PROC_VOID(1462, glProgramUniformMatrix4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1463, glRasterPos3xOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GL_PROC_VOID(1464, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1465, glGetProgramSubroutineParameteruivNV, (GLenum target, GLuint index, GLuint *param), (target, index, param))
+GL_PROC_VOID(1466, glTextureImage3DMultisampleCoverageNV, (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations), (texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations))
+GL_PROC_VOID(1467, glVertexArrayVertexAttribIOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset))
+GL_PROC_VOID(1468, glVertexArrayIndexOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, type, stride, offset))
+GL_PROC_VOID(1469, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GL_PROC_VOID(1470, glTexCoord1f, (GLfloat s), (s))
+GL_PROC_VOID(1471, glTranslatef, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(1472, glMapGrid1f, (GLint un, GLfloat u1, GLfloat u2), (un, u1, u2))
+GL_PROC_VOID(1473, glGetVertexArrayiv, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GL_PROC_VOID(1474, glGetnUniformfvARB, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GL_PROC_VOID(1475, glGetUnsignedBytei_vEXT, (GLenum target, GLuint index, GLubyte *data), (target, index, data))
+GL_PROC_VOID(1476, glGetProgramStringARB, (GLenum target, GLenum pname, void *string), (target, pname, string))
+GL_PROC_VOID(1477, glCopyPathNV, (GLuint resultPath, GLuint srcPath), (resultPath, srcPath))
+GL_PROC_VOID(1478, glMultiTexCoord2svARB, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(1479, glTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROC_VOID(1480, glColor4xOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GL_PROC_VOID(1481, glPointParameterf, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1482, glCoverFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues))
+GL_PROC_VOID(1483, glEndTransformFeedbackEXT, (void), ())
+GL_PROC_VOID(1484, glNormal3xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(1485, glMultiTexCoord4dvARB, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(1486, glNamedBufferDataEXT, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GL_PROC_VOID(1487, glWindowPos2fvMESA, (const GLfloat *v), (v))
+GL_PROC(1488, GLenum, glPathGlyphIndexArrayNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale))
+GL_PROC_VOID(1489, glBindBufferBaseEXT, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GL_PROC_VOID(1490, glSampleCoverage, (GLclampf value, GLboolean invert), (value, invert))
+GL_PROC_VOID(1491, glEvalPoint2, (GLint i, GLint j), (i, j))
+GL_PROC_VOID(1492, glMakeTextureHandleResidentNV, (GLuint64 handle), (handle))
+GL_PROC_VOID(1493, glNormalStream3sATI, (GLenum stream, GLshort nx, GLshort ny, GLshort nz), (stream, nx, ny, nz))
+GL_PROC_VOID(1494, glIndexxvOES, (const GLfixed *component), (component))
+GL_PROC_VOID(1495, glVideoCaptureStreamParameterivNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint *params), (video_capture_slot, stream, pname, params))
+GL_PROC_VOID(1496, glUniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(1497, glColor4ubVertex2fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y), (r, g, b, a, x, y))
+GL_PROC_VOID(1498, glStencilFillPathNV, (GLuint path, GLenum fillMode, GLuint mask), (path, fillMode, mask))
+GL_PROC_VOID(1499, glWindowPos2svARB, (const GLshort *v), (v))
+GL_PROC_VOID(1500, glGetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GL_PROC_VOID(1501, glDrawMeshArraysSUN, (GLenum mode, GLint first, GLsizei count, GLsizei width), (mode, first, count, width))
+GL_PROC_VOID(1502, glWeightfvARB, (GLint size, const GLfloat *weights), (size, weights))
+GL_PROC(1503, GLboolean, glIsQuery, (GLuint id), (id))
+GL_PROC_VOID(1504, glVertexFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GL_PROC_VOID(1505, glProgramUniform4i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(1506, glViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+GL_PROC_VOID(1507, glGetNamedFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params))
+GL_PROC(1508, void *, glMapNamedBufferEXT, (GLuint buffer, GLenum access), (buffer, access))
+GL_PROC_VOID(1509, glGetArrayObjectfvATI, (GLenum array, GLenum pname, GLfloat *params), (array, pname, params))
+GL_PROC_VOID(1510, glDeformationMap3fSGIX, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points))
+GL_PROC_VOID(1511, glTextureStorageSparseAMD, (GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (texture, target, internalFormat, width, height, depth, layers, flags))
+GL_PROC_VOID(1512, glProgramParameter4dNV, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GL_PROC_VOID(1513, glCoverStrokePathNV, (GLuint path, GLenum coverMode), (path, coverMode))
+GL_PROC_VOID(1514, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GL_PROC_VOID(1515, glResizeBuffersMESA, (void), ())
+GL_PROC_VOID(1516, glMapControlPointsNV, (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points), (target, index, type, ustride, vstride, uorder, vorder, packed, points))
+GL_PROC_VOID(1517, glProgramNamedParameter4fNV, (GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (id, len, name, x, y, z, w))
+GL_PROC_VOID(1518, glReplacementCodeuiNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *n, const GLfloat *v), (rc, n, v))
+GL_PROC_VOID(1519, glValidateProgramARB, (GLhandleARB programObj), (programObj))
+GL_PROC_VOID(1520, glVertexAttribL1ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v))
+GL_PROC_VOID(1521, glMap1f, (GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (target, u1, u2, stride, order, points))
+GL_PROC_VOID(1522, glCreateMemoryObjectsEXT, (GLsizei n, GLuint *memoryObjects), (n, memoryObjects))
+GL_PROC_VOID(1523, glGetCombinerInputParameterfvNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params), (stage, portion, variable, pname, params))
+GL_PROC_VOID(1524, glCompressedMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits), (texunit, target, level, xoffset, width, format, imageSize, bits))
+GL_PROC_VOID(1525, glGetTexEnvfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1526, glTangent3bEXT, (GLbyte tx, GLbyte ty, GLbyte tz), (tx, ty, tz))
+GL_PROC_VOID(1527, glTextureImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, border, format, type, pixels))
+GL_PROC_VOID(1528, glReadBuffer, (GLenum mode), (mode))
+GL_PROC_VOID(1529, glVertexAttribL4dvEXT, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1530, glVertex3xOES, (GLfixed x, GLfixed y), (x, y))
+GL_PROC_VOID(1531, glFlushStaticDataIBM, (GLenum target), (target))
+GL_PROC_VOID(1532, glShadeModel, (GLenum mode), (mode))
+GL_PROC_VOID(1533, glDeleteVertexArraysAPPLE, (GLsizei n, const GLuint *arrays), (n, arrays))
+GL_PROC_VOID(1534, glGetNamedStringivARB, (GLint namelen, const GLchar *name, GLenum pname, GLint *params), (namelen, name, pname, params))
+GL_PROC_VOID(1535, glTexStorageSparseAMD, (GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags), (target, internalFormat, width, height, depth, layers, flags))
+GL_PROC_VOID(1536, glTexGeni, (GLenum coord, GLenum pname, GLint param), (coord, pname, param))
+GL_PROC_VOID(1537, glUseShaderProgramEXT, (GLenum type, GLuint program), (type, program))
+GL_PROC_VOID(1538, glGetNamedRenderbufferParameteriv, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GL_PROC_VOID(1539, glColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GL_PROC_VOID(1540, glVertexBlendEnviATI, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1541, glBinormal3bvEXT, (const GLbyte *v), (v))
+GL_PROC_VOID(1542, glMatrixIndexubvARB, (GLint size, const GLubyte *indices), (size, indices))
+GL_PROC_VOID(1543, glPixelTransferi, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1544, glVertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1545, glColorTable, (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *table), (target, internalformat, width, format, type, table))
+GL_PROC_VOID(1546, glTexCoord2hNV, (GLhalfNV s, GLhalfNV t), (s, t))
+GL_PROC_VOID(1547, glVertexStream1fvATI, (GLenum stream, const GLfloat *coords), (stream, coords))
+GL_PROC_VOID(1548, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1549, glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GL_PROC_VOID(1550, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GL_PROC_VOID(1551, glTexCoord1xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(1552, glVertexAttribI2ivEXT, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(1553, glGetVertexArrayIndexed64iv, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param))
+GL_PROC_VOID(1554, glPointSizexOES, (GLfixed size), (size))
+GL_PROC_VOID(1555, glGetnPixelMapusv, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GL_PROC_VOID(1556, glGenQueryResourceTagNV, (GLsizei n, GLint *tagIds), (n, tagIds))
+GL_PROC_VOID(1557, glVertex4xOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GL_PROC_VOID(1558, glBindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GL_PROC_VOID(1559, glColor4ubv, (const GLubyte *v), (v))
+GL_PROC_VOID(1560, glGetVertexAttribLui64vARB, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params))
+GL_PROC_VOID(1561, glVertexArrayVertexBindingDivisorEXT, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GL_PROC_VOID(1562, glProgramUniform3ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(1563, glEndFragmentShaderATI, (void), ())
+GL_PROC_VOID(1564, glUniformMatrix3fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1565, glGetPixelTransformParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1566, glBindBuffersBase, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+GL_PROC_VOID(1567, glTexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords))
+GL_PROC_VOID(1568, glUniform1ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(1569, glGetTransformFeedbacki64_v, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param))
+GL_PROC_VOID(1570, glVertexStream4iATI, (GLenum stream, GLint x, GLint y, GLint z, GLint w), (stream, x, y, z, w))
+GL_PROC_VOID(1571, glGetPerfMonitorCounterDataAMD, (GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten), (monitor, pname, dataSize, data, bytesWritten))
+GL_PROC_VOID(1572, glGetMultiTexParameterivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(1573, glDeleteSemaphoresEXT, (GLsizei n, const GLuint *semaphores), (n, semaphores))
+GL_PROC_VOID(1574, glDisableIndexedEXT, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(1575, glGlobalAlphaFactoriSUN, (GLint factor), (factor))
+GL_PROC_VOID(1576, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data), (target, level, xoffset, width, format, imageSize, data))
+GL_PROC_VOID(1577, glGetProgramivNV, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_PROC_VOID(1578, glVertexAttrib1fNV, (GLuint index, GLfloat x), (index, x))
+GL_PROC_VOID(1579, glProgramBufferParametersIuivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint *params), (target, bindingIndex, wordIndex, count, params))
+GL_PROC_VOID(1580, glVertex4d, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GL_PROC_VOID(1581, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GL_PROC_VOID(1582, glProgramParameter4dvNV, (GLenum target, GLuint index, const GLdouble *v), (target, index, v))
+GL_PROC_VOID(1583, glVertexArrayAttribLFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GL_PROC_VOID(1584, glBindVertexShaderEXT, (GLuint id), (id))
+GL_PROC_VOID(1585, glCopyColorTable, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GL_PROC_VOID(1586, glStencilClearTagEXT, (GLsizei stencilTagBits, GLuint stencilClearTag), (stencilTagBits, stencilClearTag))
+GL_PROC_VOID(1587, glFogCoordPointerListIBM, (GLenum type, GLint stride, const void **pointer, GLint ptrstride), (type, stride, pointer, ptrstride))
+GL_PROC_VOID(1588, glDrawTransformFeedback, (GLenum mode, GLuint id), (mode, id))
+GL_PROC_VOID(1589, glGetnMapdvARB, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GL_PROC_VOID(1590, glMultTransposeMatrixf, (const GLfloat m[16]), (m))
+GL_PROC_VOID(1591, glBeginConditionalRenderNVX, (GLuint id), (id))
+GL_PROC_VOID(1592, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GL_PROC_VOID(1593, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GL_PROC_VOID(1594, glGetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GL_PROC_VOID(1595, glGetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GL_PROC_VOID(1596, glEdgeFlag, (GLboolean flag), (flag))
+GL_PROC_VOID(1597, glGetMaterialiv, (GLenum face, GLenum pname, GLint *params), (face, pname, params))
+GL_PROC_VOID(1598, glMatrixOrthoEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar))
+GL_PROC(1599, GLboolean, glIsProgramPipeline, (GLuint pipeline), (pipeline))
+GL_PROC_VOID(1600, glMatrixLoadIdentityEXT, (GLenum mode), (mode))
+GL_PROC_VOID(1601, glEGLImageTargetTexStorageEXT, (GLenum target, GLeglImageOES image, const GLint* attrib_list), (target, image, attrib_list))
+GL_PROC_VOID(1602, glPixelTexGenParameterfSGIS, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1603, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_PROC_VOID(1604, glNamedFramebufferDrawBuffers, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GL_PROC_VOID(1605, glFlushVertexArrayRangeAPPLE, (GLsizei length, void *pointer), (length, pointer))
+GL_PROC_VOID(1606, glReplacementCodeuiColor3fVertex3fSUN, (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, x, y, z))
+GL_PROC_VOID(1607, glStringMarkerGREMEDY, (GLsizei len, const void *string), (len, string))
+GL_PROC_VOID(1608, glMinmaxEXT, (GLenum target, GLenum internalformat, GLboolean sink), (target, internalformat, sink))
+GL_PROC_VOID(1609, glRasterPos3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(1610, glWindowPos2fMESA, (GLfloat x, GLfloat y), (x, y))
+GL_PROC_VOID(1611, glVertexAttribI1ivEXT, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(1612, glUniform1ui64ARB, (GLint location, GLuint64 x), (location, x))
+GL_PROC_VOID(1613, glSecondaryColor3ub, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GL_PROC_VOID(1614, glVertexAttrib1d, (GLuint index, GLdouble x), (index, x))
+GL_PROC_VOID(1615, glGetnSeparableFilter, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GL_PROC_VOID(1616, glVertexAttribI3ivEXT, (GLuint index, const GLint *v), (index, v))
+GL_PROC(1617, GLboolean, glTestFenceNV, (GLuint fence), (fence))
+GL_PROC_VOID(1618, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GL_PROC(1619, GLboolean, glIsCommandListNV, (GLuint list), (list))
+GL_PROC(1620, GLboolean, glIsSemaphoreEXT, (GLuint semaphore), (semaphore))
+GL_PROC(1621, GLboolean, glVDPAUIsSurfaceNV, (GLvdpauSurfaceNV surface), (surface))
+GL_PROC_VOID(1622, glRasterPos4iv, (const GLint *v), (v))
+GL_PROC_VOID(1623, glMapGrid1xOES, (GLint n, GLfixed u1, GLfixed u2), (n, u1, u2))
+GL_PROC_VOID(1624, glBlendColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GL_PROC_VOID(1625, glUniform4fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(1626, glTexCoord2f, (GLfloat s, GLfloat t), (s, t))
+GL_PROC_VOID(1627, glLoadMatrixd, (const GLdouble *m), (m))
+GL_PROC_VOID(1628, glWindowPos4iMESA, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w))
+GL_PROC_VOID(1629, glSecondaryColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue))
+GL_PROC(1630, GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_PROC_VOID(1631, glInvalidateBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GL_PROC_VOID(1632, glTexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(1633, glGetNamedProgramStringEXT, (GLuint program, GLenum target, GLenum pname, void *string), (program, target, pname, string))
+GL_PROC_VOID(1634, glMultiTexCoord1hvNV, (GLenum target, const GLhalfNV *v), (target, v))
+GL_PROC_VOID(1635, glGetAttachedObjectsARB, (GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj), (containerObj, maxCount, count, obj))
+GL_PROC_VOID(1636, glBeginQueryARB, (GLenum target, GLuint id), (target, id))
+GL_PROC_VOID(1637, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GL_PROC_VOID(1638, glRequestResidentProgramsNV, (GLsizei n, const GLuint *programs), (n, programs))
+GL_PROC_VOID(1639, glVertexAttrib1dARB, (GLuint index, GLdouble x), (index, x))
+GL_PROC_VOID(1640, glGetBooleanv, (GLenum pname, GLboolean *params), (pname, params))
+GL_PROC_VOID(1641, glProgramUniformui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(1642, glPointParameterfARB, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1643, glMultiDrawElementsIndirectBindlessCountNV, (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, type, indirect, drawCount, maxDrawCount, stride, vertexBufferCount))
+GL_PROC_VOID(1644, glLightf, (GLenum light, GLenum pname, GLfloat param), (light, pname, param))
+GL_PROC_VOID(1645, glProgramUniform3iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1646, glGetnPixelMapfvARB, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GL_PROC_VOID(1647, glVertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(1648, glGetPointeri_vEXT, (GLenum pname, GLuint index, void **params), (pname, index, params))
+GL_PROC_VOID(1649, glDeleteVertexShaderEXT, (GLuint id), (id))
+GL_PROC_VOID(1650, glMultMatrixf, (const GLfloat *m), (m))
+GL_PROC_VOID(1651, glResetMemoryObjectParameterNV, (GLuint memory, GLenum pname), (memory, pname))
+GL_PROC_VOID(1652, glBegin, (GLenum mode), (mode))
+GL_PROC_VOID(1653, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_PROC_VOID(1654, glActiveVaryingNV, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(1655, glGetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GL_PROC_VOID(1656, glProgramUniform3ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1657, glUniform4uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(1658, glSecondaryColor3iEXT, (GLint red, GLint green, GLint blue), (red, green, blue))
+GL_PROC_VOID(1659, glGetnMapfvARB, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GL_PROC_VOID(1660, glTexStorageMem2DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, height, memory, offset))
+GL_PROC_VOID(1661, glProgramUniformMatrix3x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1662, glTexCoordP3ui, (GLenum type, GLuint coords), (type, coords))
+GL_PROC_VOID(1663, glBinormal3iEXT, (GLint bx, GLint by, GLint bz), (bx, by, bz))
+GL_PROC_VOID(1664, glGetHistogramParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1665, glGetPathParameterivNV, (GLuint path, GLenum pname, GLint *value), (path, pname, value))
+GL_PROC_VOID(1666, glMultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GL_PROC_VOID(1667, glGenerateMultiTexMipmapEXT, (GLenum texunit, GLenum target), (texunit, target))
+GL_PROC_VOID(1668, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GL_PROC_VOID(1669, glDepthRangeArrayv, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GL_PROC(1670, GLint, glPollAsyncSGIX, (GLuint *markerp), (markerp))
+GL_PROC_VOID(1671, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GL_PROC_VOID(1672, glGetProgramInterfaceiv, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params))
+GL_PROC_VOID(1673, glVertexAttribI3uiEXT, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GL_PROC_VOID(1674, glMakeImageHandleResidentARB, (GLuint64 handle, GLenum access), (handle, access))
+GL_PROC_VOID(1675, glGetTexParameterIuivEXT, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GL_PROC_VOID(1676, glEdgeFlagPointer, (GLsizei stride, const GLvoid *ptr), (stride, ptr))
+GL_PROC_VOID(1677, glGetObjectBufferivATI, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GL_PROC_VOID(1678, glPathParameterivNV, (GLuint path, GLenum pname, const GLint *value), (path, pname, value))
+GL_PROC_VOID(1679, glMap2d, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GL_PROC_VOID(1680, glPointParameterfSGIS, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(1681, glMultiTexCoord3dvARB, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(1682, glCompressedTexSubImage3DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GL_PROC_VOID(1683, glProgramEnvParameter4dARB, (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (target, index, x, y, z, w))
+GL_PROC_VOID(1684, glVertexArrayVertexAttribBindingEXT, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GL_PROC_VOID(1685, glBlendEquation, (GLenum mode), (mode))
+GL_PROC_VOID(1686, glBinormal3bEXT, (GLbyte bx, GLbyte by, GLbyte bz), (bx, by, bz))
+GL_PROC_VOID(1687, glFogCoordfv, (const GLfloat *coord), (coord))
+GL_PROC_VOID(1688, glTexCoordFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GL_PROC_VOID(1689, glPointParameterxvOES, (GLenum pname, const GLfixed *params), (pname, params))
+GL_PROC_VOID(1690, glConservativeRasterParameteriNV, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1691, glWaitSemaphoreui64NVX, (GLuint waitGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (waitGpu, fenceObjectCount, semaphoreArray, fenceValueArray))
+GL_PROC_VOID(1692, glMaterialf, (GLenum face, GLenum pname, GLfloat param), (face, pname, param))
+GL_PROC_VOID(1693, glDisableClientStateIndexedEXT, (GLenum array, GLuint index), (array, index))
+GL_PROC_VOID(1694, glMakeTextureHandleResidentARB, (GLuint64 handle), (handle))
+GL_PROC_VOID(1695, glVertexAttribParameteriAMD, (GLuint index, GLenum pname, GLint param), (index, pname, param))
+GL_PROC_VOID(1696, glClearDepthdNV, (GLdouble depth), (depth))
+GL_PROC_VOID(1697, glGetObjectParameterfvARB, (GLhandleARB obj, GLenum pname, GLfloat *params), (obj, pname, params))
+GL_PROC_VOID(1698, glProgramLocalParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params))
+GL_PROC_VOID(1699, glVertex4sv, (const GLshort *v), (v))
+GL_PROC_VOID(1700, glVertexArrayVertexBuffers, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+GL_PROC_VOID(1701, glFramebufferDrawBufferEXT, (GLuint framebuffer, GLenum mode), (framebuffer, mode))
+GL_PROC_VOID(1702, glVertexAttrib4dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_PROC_VOID(1703, glVertexAttrib1f, (GLuint index, GLfloat x), (index, x))
+GL_PROC_VOID(1704, glVertexAttribI1iv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(1705, glRectxvOES, (const GLfixed *v1, const GLfixed *v2), (v1, v2))
+GL_PROC_VOID(1706, glEndQueryARB, (GLenum target), (target))
+GL_PROC_VOID(1707, glVertexStream4fATI, (GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (stream, x, y, z, w))
+GL_PROC_VOID(1708, glTexCoord1hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1709, glMinSampleShading, (GLfloat value), (value))
+GL_PROC_VOID(1710, glVertexAttribI4sv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(1711, glVertex3s, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GL_PROC_VOID(1712, glGenerateTextureMipmapEXT, (GLuint texture, GLenum target), (texture, target))
+GL_PROC_VOID(1713, glVertexAttribI2uivEXT, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(1714, glSecondaryColor3uivEXT, (const GLuint *v), (v))
+GL_PROC_VOID(1715, glVertexAttribs3dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GL_PROC_VOID(1716, glTexEnvxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GL_PROC_VOID(1717, glFrameZoomSGIX, (GLint factor), (factor))
+GL_PROC_VOID(1718, glSecondaryColor3ubEXT, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GL_PROC_VOID(1719, glTextureParameterfvEXT, (GLuint texture, GLenum target, GLenum pname, const GLfloat *params), (texture, target, pname, params))
+GL_PROC_VOID(1720, glPathGlyphRangeNV, (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale))
+GL_PROC_VOID(1721, glBufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GL_PROC_VOID(1722, glIndexfv, (const GLfloat *c), (c))
+GL_PROC_VOID(1723, glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+GL_PROC_VOID(1724, glVDPAUSurfaceAccessNV, (GLvdpauSurfaceNV surface, GLenum access), (surface, access))
+GL_PROC_VOID(1725, glMultiTexParameterfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params))
+GL_PROC_VOID(1726, glDrawTextureNV, (GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1), (texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1))
+GL_PROC_VOID(1727, glMatrixIndexPointerARB, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GL_PROC_VOID(1728, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROC_VOID(1729, glWindowPos2dvMESA, (const GLdouble *v), (v))
+GL_PROC_VOID(1730, glUniform1f, (GLint location, GLfloat v0), (location, v0))
+GL_PROC_VOID(1731, glGetNamedBufferParameteriv, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GL_PROC_VOID(1732, glGetFramebufferParameterivEXT, (GLuint framebuffer, GLenum pname, GLint *params), (framebuffer, pname, params))
+GL_PROC_VOID(1733, glAlphaFuncxOES, (GLenum func, GLfixed ref), (func, ref))
+GL_PROC_VOID(1734, glFrustum, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val), (left, right, bottom, top, near_val, far_val))
+GL_PROC_VOID(1735, glBindBufferARB, (GLenum target, GLuint buffer), (target, buffer))
+GL_PROC_VOID(1736, glIndexs, (GLshort c), (c))
+GL_PROC(1737, GLboolean, glIsFramebufferEXT, (GLuint framebuffer), (framebuffer))
+GL_PROC_VOID(1738, glPixelMapfv, (GLenum map, GLsizei mapsize, const GLfloat *values), (map, mapsize, values))
+GL_PROC_VOID(1739, glMultiTexCoord3dv, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(1740, glColorPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GL_PROC_VOID(1741, glLineWidth, (GLfloat width), (width))
+GL_PROC_VOID(1742, glUniform4ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(1743, glEvalCoord2f, (GLfloat u, GLfloat v), (u, v))
+GL_PROC_VOID(1744, glDrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs))
+GL_PROC_VOID(1745, glProgramEnvParametersI4uivNV, (GLenum target, GLuint index, GLsizei count, const GLuint *params), (target, index, count, params))
+GL_PROC_VOID(1746, glCopyTexSubImage2DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GL_PROC_VOID(1747, glVertexAttribBinding, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+GL_PROC_VOID(1748, glGetMinmaxParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1749, glTexImage2DMultisampleCoverageNV, (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations))
+GL_PROC_VOID(1750, glColorTableParameterivSGI, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(1751, glGetPixelMapuiv, (GLenum map, GLuint *values), (map, values))
+GL_PROC_VOID(1752, glVertexAttribI4svEXT, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(1753, glMultiTexCoord3hNV, (GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r), (target, s, t, r))
+GL_PROC_VOID(1754, glNamedRenderbufferStorageMultisampleEXT, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GL_PROC_VOID(1755, glVertexAttrib1dNV, (GLuint index, GLdouble x), (index, x))
+GL_PROC(1756, GLuint64, glGetImageHandleARB, (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format), (texture, level, layered, layer, format))
+GL_PROC_VOID(1757, glListBase, (GLuint base), (base))
+GL_PROC_VOID(1758, glVertexAttribFormatNV, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride), (index, size, type, normalized, stride))
+GL_PROC_VOID(1759, glMulticastBarrierNV, (void), ())
+GL_PROC_VOID(1760, glTexStorageMem2DMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset))
+GL_PROC_VOID(1761, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GL_PROC_VOID(1762, glVertexAttribL1ui64NV, (GLuint index, GLuint64EXT x), (index, x))
+GL_PROC_VOID(1763, glGetPathParameterfvNV, (GLuint path, GLenum pname, GLfloat *value), (path, pname, value))
+GL_PROC_VOID(1764, glBindImageTextureEXT, (GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format), (index, texture, level, layered, layer, access, format))
+GL_PROC_VOID(1765, glGetFixedvOES, (GLenum pname, GLfixed *params), (pname, params))
+GL_PROC_VOID(1766, glTexStorageMem1DEXT, (GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (target, levels, internalFormat, width, memory, offset))
+GL_PROC_VOID(1767, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GL_PROC_VOID(1768, glGetCombinerStageParameterfvNV, (GLenum stage, GLenum pname, GLfloat *params), (stage, pname, params))
+GL_PROC_VOID(1769, glProgramUniform4ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1770, glCopyTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROC_VOID(1771, glRasterPos2xOES, (GLfixed x, GLfixed y), (x, y))
+GL_PROC_VOID(1772, glNamedFramebufferTexture2DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level))
+GL_PROC_VOID(1773, glImageTransformParameterivHP, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(1774, glVertexAttrib4uivARB, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(1775, glBlendEquationSeparateiARB, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GL_PROC_VOID(1776, glFlushMappedBufferRangeAPPLE, (GLenum target, GLintptr offset, GLsizeiptr size), (target, offset, size))
+GL_PROC_VOID(1777, glRasterPos3s, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GL_PROC_VOID(1778, glGetColorTableParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1779, glColor4ubVertex2fvSUN, (const GLubyte *c, const GLfloat *v), (c, v))
+GL_PROC_VOID(1780, glMultiDrawElementsIndirectCountARB, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GL_PROC_VOID(1781, glTexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GL_PROC_VOID(1782, glWindowPos3iMESA, (GLint x, GLint y, GLint z), (x, y, z))
+GL_PROC_VOID(1783, glVertexAttrib4ubvNV, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(1784, glTexBumpParameterivATI, (GLenum pname, const GLint *param), (pname, param))
+GL_PROC_VOID(1785, glProgramEnvParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params), (target, index, params))
+GL_PROC_VOID(1786, glProgramUniform3fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(1787, glFogi, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(1788, glShaderOp1EXT, (GLenum op, GLuint res, GLuint arg1), (op, res, arg1))
+GL_PROC_VOID(1789, glWindowPos3sARB, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GL_PROC_VOID(1790, glGetHistogramParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GL_PROC_VOID(1791, glEndTransformFeedback, (void), ())
+GL_PROC_VOID(1792, glDrawCommandsNV, (GLenum primitiveMode, GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, GLuint count), (primitiveMode, buffer, indirects, sizes, count))
+GL_PROC_VOID(1793, glTexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(1794, glFogxvOES, (GLenum pname, const GLfixed *param), (pname, param))
+GL_PROC_VOID(1795, glUniformMatrix2fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1796, glGetTextureParameterIuivEXT, (GLuint texture, GLenum target, GLenum pname, GLuint *params), (texture, target, pname, params))
+GL_PROC(1797, GLenum, glPathGlyphIndexRangeNV, (GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount[2]), (fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount))
+GL_PROC_VOID(1798, glBindTransformFeedbackNV, (GLenum target, GLuint id), (target, id))
+GL_PROC_VOID(1799, glCoverFillPathNV, (GLuint path, GLenum coverMode), (path, coverMode))
+GL_PROC_VOID(1800, glMultiTexCoord2xOES, (GLenum texture, GLfixed s, GLfixed t), (texture, s, t))
+GL_PROC_VOID(1801, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GL_PROC_VOID(1802, glInterpolatePathsNV, (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight), (resultPath, pathA, pathB, weight))
+GL_PROC_VOID(1803, glGetUniformuivEXT, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GL_PROC_VOID(1804, glPixelZoom, (GLfloat xfactor, GLfloat yfactor), (xfactor, yfactor))
+GL_PROC_VOID(1805, glVertexAttribL2i64vNV, (GLuint index, const GLint64EXT *v), (index, v))
+GL_PROC_VOID(1806, glBinormal3fEXT, (GLfloat bx, GLfloat by, GLfloat bz), (bx, by, bz))
+GL_PROC_VOID(1807, glWindowPos2fvARB, (const GLfloat *v), (v))
+GL_PROC_VOID(1808, glSwizzleEXT, (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW), (res, in, outX, outY, outZ, outW))
+GL_PROC_VOID(1809, glRasterPos4s, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GL_PROC_VOID(1810, glBlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GL_PROC_VOID(1811, glProgramUniformMatrix3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1812, glFinishFenceAPPLE, (GLuint fence), (fence))
+GL_PROC_VOID(1813, glTexCoord3xOES, (GLfixed s, GLfixed t, GLfixed r), (s, t, r))
+GL_PROC_VOID(1814, glEdgeFlagPointerListIBM, (GLint stride, const GLboolean **pointer, GLint ptrstride), (stride, pointer, ptrstride))
+GL_PROC_VOID(1815, glVertexAttribs1fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GL_PROC_VOID(1816, glMultiTexCoord1dvARB, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(1817, glConvolutionParameterfEXT, (GLenum target, GLenum pname, GLfloat params), (target, pname, params))
+GL_PROC_VOID(1818, glSelectBuffer, (GLsizei size, GLuint *buffer), (size, buffer))
+GL_PROC_VOID(1819, glTextureColorMaskSGIS, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GL_PROC_VOID(1820, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1821, glElementPointerAPPLE, (GLenum type, const void *pointer), (type, pointer))
+GL_PROC_VOID(1822, glGenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GL_PROC(1823, GLint, glGetVaryingLocationNV, (GLuint program, const GLchar *name), (program, name))
+GL_PROC_VOID(1824, glBlendEquationSeparateEXT, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GL_PROC_VOID(1825, glProgramLocalParameterI4uiNV, (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (target, index, x, y, z, w))
+GL_PROC_VOID(1826, glVertexStream3svATI, (GLenum stream, const GLshort *coords), (stream, coords))
+GL_PROC(1827, GLboolean, glIsTransformFeedbackNV, (GLuint id), (id))
+GL_PROC_VOID(1828, glConvolutionParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1829, glVertexAttribLPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_PROC_VOID(1830, glAlphaFragmentOp1ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod))
+GL_PROC_VOID(1831, glNamedProgramLocalParametersI4uivEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params), (program, target, index, count, params))
+GL_PROC_VOID(1832, glGetTexEnviv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1833, glInterleavedArrays, (GLenum format, GLsizei stride, const GLvoid *pointer), (format, stride, pointer))
+GL_PROC_VOID(1834, glDetachShader, (GLuint program, GLuint shader), (program, shader))
+GL_PROC_VOID(1835, glNamedBufferPageCommitmentARB, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GL_PROC_VOID(1836, glVertexAttrib1sARB, (GLuint index, GLshort x), (index, x))
+GL_PROC(1837, GLint, glGetUniformLocationARB, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GL_PROC_VOID(1838, glTexCoord2dv, (const GLdouble *v), (v))
+GL_PROC_VOID(1839, glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GL_PROC_VOID(1840, glGetNamedBufferSubDataEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GL_PROC_VOID(1841, glGetTexLevelParameterxvOES, (GLenum target, GLint level, GLenum pname, GLfixed *params), (target, level, pname, params))
+GL_PROC_VOID(1842, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GL_PROC_VOID(1843, glVertexAttrib2dvARB, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(1844, glGetPolygonStipple, (GLubyte *mask), (mask))
+GL_PROC_VOID(1845, glGetVertexAttribLui64vNV, (GLuint index, GLenum pname, GLuint64EXT *params), (index, pname, params))
+GL_PROC_VOID(1846, glUniform3ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(1847, glGetTransformFeedbackVaryingNV, (GLuint program, GLuint index, GLint *location), (program, index, location))
+GL_PROC(1848, GLbitfield, glQueryMatrixxOES, (GLfixed *mantissa, GLint *exponent), (mantissa, exponent))
+GL_PROC_VOID(1849, glDeleteRenderbuffersEXT, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GL_PROC_VOID(1850, glVertexAttrib2svNV, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(1851, glPointParameterfvARB, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(1852, glProgramUniform2fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GL_PROC_VOID(1853, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer))
+GL_PROC(1854, void *, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GL_PROC_VOID(1855, glEndQueryIndexed, (GLenum target, GLuint index), (target, index))
+GL_PROC_VOID(1856, glUniform1i64ARB, (GLint location, GLint64 x), (location, x))
+GL_PROC_VOID(1857, glGlobalAlphaFactoruiSUN, (GLuint factor), (factor))
+GL_PROC_VOID(1858, glTexParameterxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GL_PROC_VOID(1859, glIndexFormatNV, (GLenum type, GLsizei stride), (type, stride))
+GL_PROC_VOID(1860, glNormal3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(1861, glProgramUniform4iEXT, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(1862, glMultiTexCoord3xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r), (texture, s, t, r))
+GL_PROC_VOID(1863, glVertexAttribI1i, (GLuint index, GLint x), (index, x))
+GL_PROC_VOID(1864, glWindowPos3s, (GLshort x, GLshort y, GLshort z), (x, y, z))
+GL_PROC_VOID(1865, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GL_PROC_VOID(1866, glWindowPos3fMESA, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(1867, glMultiTexCoord4hvNV, (GLenum target, const GLhalfNV *v), (target, v))
+GL_PROC_VOID(1868, glCreateTextures, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures))
+GL_PROC_VOID(1869, glProgramUniformMatrix3x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1870, glGetPointervEXT, (GLenum pname, void **params), (pname, params))
+GL_PROC_VOID(1871, glProgramUniform1dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(1872, glGenerateMipmap, (GLenum target), (target))
+GL_PROC_VOID(1873, glGetVertexAttribdvARB, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_PROC_VOID(1874, glMultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GL_PROC_VOID(1875, glDeleteTexturesEXT, (GLsizei n, const GLuint *textures), (n, textures))
+GL_PROC_VOID(1876, glProgramUniform4iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1877, glGetNamedFramebufferAttachmentParameterivEXT, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GL_PROC_VOID(1878, glEndConditionalRender, (void), ())
+GL_PROC_VOID(1879, glSyncTextureINTEL, (GLuint texture), (texture))
+GL_PROC_VOID(1880, glDisableVertexArrayEXT, (GLuint vaobj, GLenum array), (vaobj, array))
+GL_PROC_VOID(1881, glVariantivEXT, (GLuint id, const GLint *addr), (id, addr))
+GL_PROC_VOID(1882, glProgramLocalParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GL_PROC_VOID(1883, glColorTableParameterfvSGI, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1884, glHistogramEXT, (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink), (target, width, internalformat, sink))
+GL_PROC_VOID(1885, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GL_PROC_VOID(1886, glBlendFuncSeparateINGR, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GL_PROC_VOID(1887, glNamedRenderbufferStorageMultisampleAdvancedAMD, (GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, storageSamples, internalformat, width, height))
+GL_PROC(1888, GLboolean, glIsProgramNV, (GLuint id), (id))
+GL_PROC_VOID(1889, glMultiTexCoord3sARB, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r))
+GL_PROC(1890, GLboolean, glIsImageHandleResidentNV, (GLuint64 handle), (handle))
+GL_PROC_VOID(1891, glBindSamplers, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+GL_PROC_VOID(1892, glTextureRenderbufferEXT, (GLuint texture, GLenum target, GLuint renderbuffer), (texture, target, renderbuffer))
+GL_PROC_VOID(1893, glNamedBufferPageCommitmentEXT, (GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit), (buffer, offset, size, commit))
+GL_PROC_VOID(1894, glBindTextureEXT, (GLenum target, GLuint texture), (target, texture))
+GL_PROC_VOID(1895, glRenderbufferStorageMultisampleAdvancedAMD, (GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, storageSamples, internalformat, width, height))
+GL_PROC_VOID(1896, glDrawElementsInstancedEXT, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GL_PROC_VOID(1897, glProgramUniform1ivEXT, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(1898, glVertexStream3sATI, (GLenum stream, GLshort x, GLshort y, GLshort z), (stream, x, y, z))
+GL_PROC_VOID(1899, glMultiTexCoord2fv, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(1900, glVertexArrayColorOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GL_PROC_VOID(1901, glSampleMaskEXT, (GLclampf value, GLboolean invert), (value, invert))
+GL_PROC_VOID(1902, glGetVertexAttribLi64vNV, (GLuint index, GLenum pname, GLint64EXT *params), (index, pname, params))
+GL_PROC_VOID(1903, glGetPerfQueryInfoINTEL, (GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask), (queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask))
+GL_PROC_VOID(1904, glProgramUniform1f, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GL_PROC_VOID(1905, glProgramUniform4ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(1906, glGetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1907, glUniform3dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GL_PROC(1908, GLuint, glBindParameterEXT, (GLenum value), (value))
+GL_PROC_VOID(1909, glMultiTexCoord4d, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q))
+GL_PROC_VOID(1910, glHint, (GLenum target, GLenum mode), (target, mode))
+GL_PROC_VOID(1911, glStencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GL_PROC_VOID(1912, glVertexAttribL3dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_PROC_VOID(1913, glUniform4fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(1914, glTangent3fvEXT, (const GLfloat *v), (v))
+GL_PROC_VOID(1915, glColor3hNV, (GLhalfNV red, GLhalfNV green, GLhalfNV blue), (red, green, blue))
+GL_PROC_VOID(1916, glMatrixIndexuivARB, (GLint size, const GLuint *indices), (size, indices))
+GL_PROC_VOID(1917, glBeginTransformFeedbackEXT, (GLenum primitiveMode), (primitiveMode))
+GL_PROC_VOID(1918, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GL_PROC(1919, GLboolean, glIsAsyncMarkerSGIX, (GLuint marker), (marker))
+GL_PROC_VOID(1920, glMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, border, format, type, pixels))
+GL_PROC_VOID(1921, glGetColorTableSGI, (GLenum target, GLenum format, GLenum type, void *table), (target, format, type, table))
+GL_PROC_VOID(1922, glSeparableFilter2D, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *row, const GLvoid *column), (target, internalformat, width, height, format, type, row, column))
+GL_PROC_VOID(1923, glGetDoubleIndexedvEXT, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GL_PROC_VOID(1924, glVertexArrayVertexAttribLFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GL_PROC_VOID(1925, glProgramUniformMatrix3x2dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1926, glVertex3xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(1927, glTranslated, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(1928, glTransformFeedbackStreamAttribsNV, (GLsizei count, const GLint *attribs, GLsizei nbuffers, const GLint *bufstreams, GLenum bufferMode), (count, attribs, nbuffers, bufstreams, bufferMode))
+GL_PROC(1929, GLuint, glGetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GL_PROC_VOID(1930, glConvolutionParameterf, (GLenum target, GLenum pname, GLfloat params), (target, pname, params))
+GL_PROC_VOID(1931, glGetHistogramParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(1932, glElementPointerATI, (GLenum type, const void *pointer), (type, pointer))
+GL_PROC_VOID(1933, glMatrixIndexusvARB, (GLint size, const GLushort *indices), (size, indices))
+GL_PROC_VOID(1934, glVertexPointerListIBM, (GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride), (size, type, stride, pointer, ptrstride))
+GL_PROC_VOID(1935, glUniform3i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z), (location, x, y, z))
+GL_PROC_VOID(1936, glCopyPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum type), (x, y, width, height, type))
+GL_PROC_VOID(1937, glWindowPos2sMESA, (GLshort x, GLshort y), (x, y))
+GL_PROC(1938, GLboolean, glIsTextureHandleResidentARB, (GLuint64 handle), (handle))
+GL_PROC_VOID(1939, glMultiTexCoord4iv, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(1940, glGetProgramParameterdvNV, (GLenum target, GLuint index, GLenum pname, GLdouble *params), (target, index, pname, params))
+GL_PROC_VOID(1941, glExtractComponentEXT, (GLuint res, GLuint src, GLuint num), (res, src, num))
+GL_PROC(1942, GLint, glGetAttribLocationARB, (GLhandleARB programObj, const GLcharARB *name), (programObj, name))
+GL_PROC_VOID(1943, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_PROC_VOID(1944, glDeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers))
+GL_PROC_VOID(1945, glProgramUniformMatrix4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(1946, glGetnMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GL_PROC_VOID(1947, glConservativeRasterParameterfNV, (GLenum pname, GLfloat value), (pname, value))
+GL_PROC_VOID(1948, glWeightivARB, (GLint size, const GLint *weights), (size, weights))
+GL_PROC_VOID(1949, glGetNamedProgramLocalParameterfvEXT, (GLuint program, GLenum target, GLuint index, GLfloat *params), (program, target, index, params))
+GL_PROC_VOID(1950, glIndexubv, (const GLubyte *c), (c))
+GL_PROC_VOID(1951, glBeginConditionalRender, (GLuint id, GLenum mode), (id, mode))
+GL_PROC_VOID(1952, glProgramLocalParameterI4uivNV, (GLenum target, GLuint index, const GLuint *params), (target, index, params))
+GL_PROC_VOID(1953, glGetCompressedTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+GL_PROC_VOID(1954, glGetDoublei_v, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GL_PROC_VOID(1955, glGetnUniformdvARB, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GL_PROC_VOID(1956, glNamedProgramLocalParameters4fvEXT, (GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params), (program, target, index, count, params))
+GL_PROC(1957, GLboolean, glUnmapBufferARB, (GLenum target), (target))
+GL_PROC_VOID(1958, glGetVertexArrayIndexediv, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GL_PROC_VOID(1959, glVertexAttrib4NuivARB, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(1960, glGetVertexArrayPointervEXT, (GLuint vaobj, GLenum pname, void **param), (vaobj, pname, param))
+GL_PROC_VOID(1961, glConvolutionParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(1962, glMulticastGetQueryObjectivNV, (GLuint gpu, GLuint id, GLenum pname, GLint *params), (gpu, id, pname, params))
+GL_PROC_VOID(1963, glVertexAttrib4dARB, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_PROC_VOID(1964, glReplacementCodePointerSUN, (GLenum type, GLsizei stride, const void **pointer), (type, stride, pointer))
+GL_PROC_VOID(1965, glMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, const GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(1966, glVertexAttrib1hNV, (GLuint index, GLhalfNV x), (index, x))
+GL_PROC_VOID(1967, glColor3b, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GL_PROC_VOID(1968, glTexParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GL_PROC_VOID(1969, glGetMultiTexEnvivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(1970, glCombinerInputNV, (GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (stage, portion, variable, input, mapping, componentUsage))
+GL_PROC_VOID(1971, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GL_PROC_VOID(1972, glUniform3ui64ARB, (GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (location, x, y, z))
+GL_PROC_VOID(1973, glConvolutionParameterxOES, (GLenum target, GLenum pname, GLfixed param), (target, pname, param))
+GL_PROC_VOID(1974, glMatrixMultTranspose3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC_VOID(1975, glVertex2bOES, (GLbyte x, GLbyte y), (x, y))
+GL_PROC_VOID(1976, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(1977, glTexBufferRange, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+GL_PROC_VOID(1978, glLightfv, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params))
+GL_PROC_VOID(1979, glTextureStorage2DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, target, levels, internalformat, width, height))
+GL_PROC_VOID(1980, glGetNamedFramebufferParameterfvAMD, (GLuint framebuffer, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (framebuffer, pname, numsamples, pixelindex, size, values))
+GL_PROC_VOID(1981, glPathSubCommandsNV, (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords), (path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords))
+GL_PROC_VOID(1982, glWindowPos3iARB, (GLint x, GLint y, GLint z), (x, y, z))
+GL_PROC_VOID(1983, glMultiTexCoord3fvARB, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(1984, glTexCoord3hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(1985, glGetCompressedMultiTexImageEXT, (GLenum texunit, GLenum target, GLint lod, void *img), (texunit, target, lod, img))
+GL_PROC_VOID(1986, glBindVideoCaptureStreamBufferNV, (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset), (video_capture_slot, stream, frame_region, offset))
+GL_PROC_VOID(1987, glVertexStream1svATI, (GLenum stream, const GLshort *coords), (stream, coords))
+GL_PROC_VOID(1988, glBeginPerfMonitorAMD, (GLuint monitor), (monitor))
+GL_PROC_VOID(1989, glTbufferMask3DFX, (GLuint mask), (mask))
+GL_PROC(1990, GLint, glQueryResourceNV, (GLenum queryType, GLint tagId, GLuint bufSize, GLint *buffer), (queryType, tagId, bufSize, buffer))
+GL_PROC_VOID(1991, glDeleteCommandListsNV, (GLsizei n, const GLuint *lists), (n, lists))
+GL_PROC_VOID(1992, glMakeBufferResidentNV, (GLenum target, GLenum access), (target, access))
+GL_PROC_VOID(1993, glGetFinalCombinerInputParameterfvNV, (GLenum variable, GLenum pname, GLfloat *params), (variable, pname, params))
+GL_PROC_VOID(1994, glTexStorage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GL_PROC_VOID(1995, glUseProgram, (GLuint program), (program))
+GL_PROC_VOID(1996, glMultiTexEnvfvEXT, (GLenum texunit, GLenum target, GLenum pname, const GLfloat *params), (texunit, target, pname, params))
+GL_PROC_VOID(1997, glAsyncMarkerSGIX, (GLuint marker), (marker))
+GL_PROC_VOID(1998, glBindSampler, (GLuint unit, GLuint sampler), (unit, sampler))
+GL_PROC_VOID(1999, glUniform4ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w), (location, x, y, z, w))
+GL_PROC_VOID(2000, glStencilStrokePathNV, (GLuint path, GLint reference, GLuint mask), (path, reference, mask))
+GL_PROC_VOID(2001, glEndPerfQueryINTEL, (GLuint queryHandle), (queryHandle))
+GL_PROC_VOID(2002, glFramebufferReadBufferEXT, (GLuint framebuffer, GLenum mode), (framebuffer, mode))
+GL_PROC_VOID(2003, glVertexAttrib4NubARB, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GL_PROC_VOID(2004, glPathStringNV, (GLuint path, GLenum format, GLsizei length, const void *pathString), (path, format, length, pathString))
+GL_PROC_VOID(2005, glTexImage3D, (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels), (target, level, internalFormat, width, height, depth, border, format, type, pixels))
+GL_PROC_VOID(2006, glFinishTextureSUNX, (void), ())
+GL_PROC_VOID(2007, glSecondaryColorFormatNV, (GLint size, GLenum type, GLsizei stride), (size, type, stride))
+GL_PROC_VOID(2008, glNamedProgramLocalParameterI4ivEXT, (GLuint program, GLenum target, GLuint index, const GLint *params), (program, target, index, params))
+GL_PROC_VOID(2009, glVertexStream2ivATI, (GLenum stream, const GLint *coords), (stream, coords))
+GL_PROC_VOID(2010, glTextureImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texture, target, level, internalformat, width, height, depth, border, format, type, pixels))
+GL_PROC_VOID(2011, glGetColorTableParameterivSGI, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2012, glNamedRenderbufferStorageMultisampleCoverageEXT, (GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, coverageSamples, colorSamples, internalformat, width, height))
+GL_PROC_VOID(2013, glSignalVkFenceNV, (GLuint64 vkFence), (vkFence))
+GL_PROC_VOID(2014, glLightModelfv, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(2015, glVertexAttrib3svARB, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(2016, glGetFloatIndexedvEXT, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GL_PROC_VOID(2017, glBufferSubDataARB, (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data), (target, offset, size, data))
+GL_PROC_VOID(2018, glSetLocalConstantEXT, (GLuint id, GLenum type, const void *addr), (id, type, addr))
+GL_PROC_VOID(2019, glFragmentLightivSGIX, (GLenum light, GLenum pname, const GLint *params), (light, pname, params))
+GL_PROC_VOID(2020, glGetProgramLocalParameterfvARB, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GL_PROC_VOID(2021, glVertexAttribL4dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(2022, glDeleteTransformFeedbacks, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROC_VOID(2023, glReplacementCodeuiColor4ubVertex3fvSUN, (const GLuint *rc, const GLubyte *c, const GLfloat *v), (rc, c, v))
+GL_PROC_VOID(2024, glPointParameteriNV, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2025, glMultiTexCoord2hNV, (GLenum target, GLhalfNV s, GLhalfNV t), (target, s, t))
+GL_PROC_VOID(2026, glProgramUniform4d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(2027, glGetLocalConstantBooleanvEXT, (GLuint id, GLenum value, GLboolean *data), (id, value, data))
+GL_PROC_VOID(2028, glVertex2sv, (const GLshort *v), (v))
+GL_PROC_VOID(2029, glGlobalAlphaFactorfSUN, (GLfloat factor), (factor))
+GL_PROC_VOID(2030, glWeightubvARB, (GLint size, const GLubyte *weights), (size, weights))
+GL_PROC_VOID(2031, glGetVideoCaptureStreamdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble *params), (video_capture_slot, stream, pname, params))
+GL_PROC_VOID(2032, glGetConvolutionParameterxvOES, (GLenum target, GLenum pname, GLfixed *params), (target, pname, params))
+GL_PROC_VOID(2033, glVertexStream1fATI, (GLenum stream, GLfloat x), (stream, x))
+GL_PROC_VOID(2034, glPauseTransformFeedbackNV, (void), ())
+GL_PROC_VOID(2035, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GL_PROC_VOID(2036, glGetColorTableParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2037, glGetTexGenxvOES, (GLenum coord, GLenum pname, GLfixed *params), (coord, pname, params))
+GL_PROC_VOID(2038, glStencilMask, (GLuint mask), (mask))
+GL_PROC_VOID(2039, glSampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GL_PROC_VOID(2040, glGenOcclusionQueriesNV, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC_VOID(2041, glLGPUNamedBufferSubDataNVX, (GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (gpuMask, buffer, offset, size, data))
+GL_PROC_VOID(2042, glUniformHandleui64vNV, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(2043, glCopyTexImage2DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GL_PROC_VOID(2044, glVertex3hvNV, (const GLhalfNV *v), (v))
+GL_PROC_VOID(2045, glWeightuivARB, (GLint size, const GLuint *weights), (size, weights))
+GL_PROC_VOID(2046, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GL_PROC(2047, GLenum, glCheckFramebufferStatus, (GLenum target), (target))
+GL_PROC_VOID(2048, glVDPAUMapSurfacesNV, (GLsizei numSurfaces, const GLvdpauSurfaceNV *surfaces), (numSurfaces, surfaces))
+GL_PROC_VOID(2049, glVertexAttrib3hNV, (GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z), (index, x, y, z))
+GL_PROC_VOID(2050, glVertexAttribL4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_PROC_VOID(2051, glFlushMappedNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GL_PROC_VOID(2052, glArrayObjectATI, (GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (array, size, type, stride, buffer, offset))
+GL_PROC_VOID(2053, glUniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(2054, glStencilStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues))
+GL_PROC_VOID(2055, glGetIntegerIndexedvEXT, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GL_PROC_VOID(2056, glTexCoord3bOES, (GLbyte s, GLbyte t, GLbyte r), (s, t, r))
+GL_PROC_VOID(2057, glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers))
+GL_PROC_VOID(2058, glTexStorage1D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GL_PROC_VOID(2059, glGetTexBumpParameterivATI, (GLenum pname, GLint *param), (pname, param))
+GL_PROC(2060, GLVULKANPROCNV, glGetVkProcAddrNV, (const GLchar *name), (name))
+GL_PROC_VOID(2061, glDepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GL_PROC_VOID(2062, glFogCoorddEXT, (GLdouble coord), (coord))
+GL_PROC_VOID(2063, glVertex3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(2064, glVertexArrayTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GL_PROC_VOID(2065, glMatrixLoadTranspose3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC_VOID(2066, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, border, imageSize, data))
+GL_PROC_VOID(2067, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GL_PROC_VOID(2068, glNormal3i, (GLint nx, GLint ny, GLint nz), (nx, ny, nz))
+GL_PROC_VOID(2069, glGetUnsignedBytevEXT, (GLenum pname, GLubyte *data), (pname, data))
+GL_PROC_VOID(2070, glNormalStream3iATI, (GLenum stream, GLint nx, GLint ny, GLint nz), (stream, nx, ny, nz))
+GL_PROC_VOID(2071, glSecondaryColor3s, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GL_PROC_VOID(2072, glLightModelf, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2073, glVertexArrayVertexOffsetEXT, (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, size, type, stride, offset))
+GL_PROC_VOID(2074, glPNTrianglesiATI, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2075, glConvolutionParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(2076, glUniform1i, (GLint location, GLint v0), (location, v0))
+GL_PROC_VOID(2077, glIndexdv, (const GLdouble *c), (c))
+GL_PROC_VOID(2078, glProgramUniform3ui64ARB, (GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z), (program, location, x, y, z))
+GL_PROC_VOID(2079, glGetTextureParameterIuiv, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params))
+GL_PROC_VOID(2080, glShaderStorageBlockBinding, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+GL_PROC_VOID(2081, glUniform2i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GL_PROC(2082, GLint, glRenderMode, (GLenum mode), (mode))
+GL_PROC_VOID(2083, glVertexArrayMultiTexCoordOffsetEXT, (GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, texunit, size, type, stride, offset))
+GL_PROC_VOID(2084, glCompressedTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data))
+GL_PROC_VOID(2085, glVertexAttrib4fvNV, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(2086, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GL_PROC(2087, GLboolean, glIsNamedBufferResidentNV, (GLuint buffer), (buffer))
+GL_PROC(2088, GLboolean, glIsRenderbufferEXT, (GLuint renderbuffer), (renderbuffer))
+GL_PROC_VOID(2089, glDeleteObjectARB, (GLhandleARB obj), (obj))
+GL_PROC_VOID(2090, glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+GL_PROC_VOID(2091, glMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, border, format, type, pixels))
+GL_PROC_VOID(2092, glTextureView, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+GL_PROC_VOID(2093, glClientAttribDefaultEXT, (GLbitfield mask), (mask))
+GL_PROC_VOID(2094, glEGLImageTargetRenderbufferStorageOES, (GLenum target, GLeglImageOES image), (target, image))
+GL_PROC_VOID(2095, glTexCoord2fColor4ubVertex3fSUN, (GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (s, t, r, g, b, a, x, y, z))
+GL_PROC_VOID(2096, glCreateRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GL_PROC_VOID(2097, glTexCoord2s, (GLshort s, GLshort t), (s, t))
+GL_PROC_VOID(2098, glBindRenderbufferEXT, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GL_PROC_VOID(2099, glGetFragmentMaterialfvSGIX, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params))
+GL_PROC_VOID(2100, glVertexArrayBindVertexBufferEXT, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GL_PROC_VOID(2101, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_PROC_VOID(2102, glVertexAttribL4ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v))
+GL_PROC_VOID(2103, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GL_PROC_VOID(2104, glGetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GL_PROC_VOID(2105, glProgramUniformHandleui64NV, (GLuint program, GLint location, GLuint64 value), (program, location, value))
+GL_PROC_VOID(2106, glMultTransposeMatrixfARB, (const GLfloat *m), (m))
+GL_PROC_VOID(2107, glVertexPointerEXT, (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer), (size, type, stride, count, pointer))
+GL_PROC_VOID(2108, glCreateCommandListsNV, (GLsizei n, GLuint *lists), (n, lists))
+GL_PROC_VOID(2109, glDeleteOcclusionQueriesNV, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROC_VOID(2110, glVDPAUUnmapSurfacesNV, (GLsizei numSurface, const GLvdpauSurfaceNV *surfaces), (numSurface, surfaces))
+GL_PROC_VOID(2111, glMultiTexCoord4fv, (GLenum target, const GLfloat *v), (target, v))
+GL_PROC_VOID(2112, glCombinerParameteriNV, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2113, glCullParameterdvEXT, (GLenum pname, GLdouble *params), (pname, params))
+GL_PROC_VOID(2114, glMatrixLoadTransposedEXT, (GLenum mode, const GLdouble *m), (mode, m))
+GL_PROC_VOID(2115, glImageTransformParameteriHP, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(2116, glDrawArraysInstancedEXT, (GLenum mode, GLint start, GLsizei count, GLsizei primcount), (mode, start, count, primcount))
+GL_PROC_VOID(2117, glEvalPoint1, (GLint i), (i))
+GL_PROC_VOID(2118, glNamedFramebufferSampleLocationsfvARB, (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (framebuffer, start, count, v))
+GL_PROC_VOID(2119, glTransformPathNV, (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues), (resultPath, srcPath, transformType, transformValues))
+GL_PROC_VOID(2120, glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+GL_PROC_VOID(2121, glIndexd, (GLdouble c), (c))
+GL_PROC_VOID(2122, glStencilFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues))
+GL_PROC_VOID(2123, glVertexStream4fvATI, (GLenum stream, const GLfloat *coords), (stream, coords))
+GL_PROC_VOID(2124, glGetFloati_v, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GL_PROC_VOID(2125, glVertexAttrib1svARB, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(2126, glVertexAttrib2fARB, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GL_PROC_VOID(2127, glGetShadingRateSampleLocationivNV, (GLenum rate, GLuint samples, GLuint index, GLint *location), (rate, samples, index, location))
+GL_PROC_VOID(2128, glGetVariantArrayObjectivATI, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_PROC_VOID(2129, glProgramUniform2ui64NV, (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y), (program, location, x, y))
+GL_PROC_VOID(2130, glBitmapxOES, (GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap))
+GL_PROC_VOID(2131, glMatrixLoad3x2fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC_VOID(2132, glColor3iv, (const GLint *v), (v))
+GL_PROC_VOID(2133, glWindowPos2dARB, (GLdouble x, GLdouble y), (x, y))
+GL_PROC_VOID(2134, glUseProgramObjectARB, (GLhandleARB programObj), (programObj))
+GL_PROC_VOID(2135, glMapVertexAttrib2dAPPLE, (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GL_PROC_VOID(2136, glGetObjectLabelEXT, (GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label), (type, object, bufSize, length, label))
+GL_PROC_VOID(2137, glWeightdvARB, (GLint size, const GLdouble *weights), (size, weights))
+GL_PROC_VOID(2138, glSecondaryColor3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2139, glTexCoord3bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(2140, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_PROC_VOID(2141, glVertexAttribL1ui64vARB, (GLuint index, const GLuint64EXT *v), (index, v))
+GL_PROC_VOID(2142, glDeletePerfMonitorsAMD, (GLsizei n, GLuint *monitors), (n, monitors))
+GL_PROC_VOID(2143, glBindBufferOffsetEXT, (GLenum target, GLuint index, GLuint buffer, GLintptr offset), (target, index, buffer, offset))
+GL_PROC_VOID(2144, glProgramUniform3fEXT, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(2145, glProgramUniform2iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GL_PROC_VOID(2146, glLineStipple, (GLint factor, GLushort pattern), (factor, pattern))
+GL_PROC_VOID(2147, glDrawTransformFeedbackNV, (GLenum mode, GLuint id), (mode, id))
+GL_PROC_VOID(2148, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(2149, glMultiTexCoord4sv, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(2150, glMatrixLoad3x3fNV, (GLenum matrixMode, const GLfloat *m), (matrixMode, m))
+GL_PROC_VOID(2151, glGetMapParameterivNV, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2152, glGetMultiTexLevelParameterivEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params), (texunit, target, level, pname, params))
+GL_PROC_VOID(2153, glUniform4i64ARB, (GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w), (location, x, y, z, w))
+GL_PROC_VOID(2154, glLightxOES, (GLenum light, GLenum pname, GLfixed param), (light, pname, param))
+GL_PROC_VOID(2155, glGetVertexArrayPointeri_vEXT, (GLuint vaobj, GLuint index, GLenum pname, void **param), (vaobj, index, pname, param))
+GL_PROC_VOID(2156, glNamedRenderbufferStorage, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GL_PROC_VOID(2157, glEvalCoord1xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(2158, glBinormal3dEXT, (GLdouble bx, GLdouble by, GLdouble bz), (bx, by, bz))
+GL_PROC_VOID(2159, glGetQueryBufferObjectuiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GL_PROC_VOID(2160, glArrayElementEXT, (GLint i), (i))
+GL_PROC_VOID(2161, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GL_PROC_VOID(2162, glReplacementCodeuivSUN, (const GLuint *code), (code))
+GL_PROC_VOID(2163, glGetPerfQueryDataINTEL, (GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten), (queryHandle, flags, dataSize, data, bytesWritten))
+GL_PROC_VOID(2164, glTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROC_VOID(2165, glGetPathCommandsNV, (GLuint path, GLubyte *commands), (path, commands))
+GL_PROC_VOID(2166, glCopyTexImage1DEXT, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GL_PROC_VOID(2167, glGetImageTransformParameterfvHP, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2168, glRasterPos3d, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(2169, glUniformHandleui64ARB, (GLint location, GLuint64 value), (location, value))
+GL_PROC_VOID(2170, glVertexAttribI1ui, (GLuint index, GLuint x), (index, x))
+GL_PROC_VOID(2171, glDeleteFragmentShaderATI, (GLuint id), (id))
+GL_PROC_VOID(2172, glPointParameteri, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2173, glSecondaryColor3iv, (const GLint *v), (v))
+GL_PROC_VOID(2174, glProgramLocalParameterI4iNV, (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w), (target, index, x, y, z, w))
+GL_PROC_VOID(2175, glDisableClientState, (GLenum cap), (cap))
+GL_PROC_VOID(2176, glGetVertexAttribfvNV, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_PROC_VOID(2177, glDrawBuffer, (GLenum mode), (mode))
+GL_PROC_VOID(2178, glWindowPos3f, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC_VOID(2179, glVertexStream3dvATI, (GLenum stream, const GLdouble *coords), (stream, coords))
+GL_PROC_VOID(2180, glColor4s, (GLshort red, GLshort green, GLshort blue, GLshort alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2181, glVertexStream2svATI, (GLenum stream, const GLshort *coords), (stream, coords))
+GL_PROC_VOID(2182, glGetTexParameterIivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2183, glColor4dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2184, glCombinerParameterfNV, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2185, glMultiTexCoord1iv, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(2186, glVertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(2187, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_PROC_VOID(2188, glMultiDrawArraysIndirectCount, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GL_PROC_VOID(2189, glGetBufferParameterivARB, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2190, glAlphaFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod))
+GL_PROC_VOID(2191, glMapVertexAttrib2fAPPLE, (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points))
+GL_PROC_VOID(2192, glVertexAttrib4ubvARB, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(2193, glTextureParameterIivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params))
+GL_PROC_VOID(2194, glGetPerfMonitorGroupStringAMD, (GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString), (group, bufSize, length, groupString))
+GL_PROC_VOID(2195, glPathStencilDepthOffsetNV, (GLfloat factor, GLfloat units), (factor, units))
+GL_PROC_VOID(2196, glGetVideoivNV, (GLuint video_slot, GLenum pname, GLint *params), (video_slot, pname, params))
+GL_PROC_VOID(2197, glGetVertexAttribIivEXT, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(2198, glTexBufferEXT, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GL_PROC_VOID(2199, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GL_PROC_VOID(2200, glUniform4i64vNV, (GLint location, GLsizei count, const GLint64EXT *value), (location, count, value))
+GL_PROC_VOID(2201, glReplacementCodeuiColor4ubVertex3fSUN, (GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (rc, r, g, b, a, x, y, z))
+GL_PROC(2202, GLuint64, glGetTextureSamplerHandleARB, (GLuint texture, GLuint sampler), (texture, sampler))
+GL_PROC_VOID(2203, glDeleteQueries, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROC_VOID(2204, glVertexAttrib4ivARB, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(2205, glVertexStream4svATI, (GLenum stream, const GLshort *coords), (stream, coords))
+GL_PROC_VOID(2206, glMatrixMultdEXT, (GLenum mode, const GLdouble *m), (mode, m))
+GL_PROC_VOID(2207, glMatrixLoadTransposefEXT, (GLenum mode, const GLfloat *m), (mode, m))
+GL_PROC_VOID(2208, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GL_PROC_VOID(2209, glVertexAttrib4NivARB, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(2210, glEvalCoord2xOES, (GLfixed u, GLfixed v), (u, v))
+GL_PROC_VOID(2211, glRasterPos2i, (GLint x, GLint y), (x, y))
+GL_PROC_VOID(2212, glProgramUniform1ui64NV, (GLuint program, GLint location, GLuint64EXT x), (program, location, x))
+GL_PROC_VOID(2213, glVertexAttribL2ui64vNV, (GLuint index, const GLuint64EXT *v), (index, v))
+GL_PROC_VOID(2214, glScissorIndexedv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(2215, glUniform2iARB, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GL_PROC_VOID(2216, glTextureStorageMem1DEXT, (GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset), (texture, levels, internalFormat, width, memory, offset))
+GL_PROC_VOID(2217, glMultiTexCoord2dv, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(2218, glWindowPos4fvMESA, (const GLfloat *v), (v))
+GL_PROC_VOID(2219, glColor3ubv, (const GLubyte *v), (v))
+GL_PROC_VOID(2220, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GL_PROC_VOID(2221, glVertexPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GL_PROC_VOID(2222, glNormal3fVertex3fvSUN, (const GLfloat *n, const GLfloat *v), (n, v))
+GL_PROC_VOID(2223, glCopyConvolutionFilter2D, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height), (target, internalformat, x, y, width, height))
+GL_PROC_VOID(2224, glTexStorage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GL_PROC_VOID(2225, glGetMapAttribParameterivNV, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GL_PROC_VOID(2226, glMatrixPushEXT, (GLenum mode), (mode))
+GL_PROC_VOID(2227, glVertex4fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2228, glVertexAttribL1dEXT, (GLuint index, GLdouble x), (index, x))
+GL_PROC_VOID(2229, glGetProgramEnvParameterIuivNV, (GLenum target, GLuint index, GLuint *params), (target, index, params))
+GL_PROC_VOID(2230, glNormalP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GL_PROC_VOID(2231, glVertexAttrib3dNV, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_PROC_VOID(2232, glConvolutionParameterivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(2233, glVertexAttrib2dARB, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_PROC_VOID(2234, glBinormalPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GL_PROC_VOID(2235, glFramebufferSampleLocationsfvARB, (GLenum target, GLuint start, GLsizei count, const GLfloat *v), (target, start, count, v))
+GL_PROC_VOID(2236, glUniformBufferEXT, (GLuint program, GLint location, GLuint buffer), (program, location, buffer))
+GL_PROC_VOID(2237, glVertexAttrib3sv, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(2238, glClipPlanefOES, (GLenum plane, const GLfloat *equation), (plane, equation))
+GL_PROC_VOID(2239, glGetInteger64v, (GLenum pname, GLint64 *data), (pname, data))
+GL_PROC_VOID(2240, glLoadTransposeMatrixxOES, (const GLfixed *m), (m))
+GL_PROC_VOID(2241, glMultiTexSubImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROC_VOID(2242, glMultiTexCoord2iv, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(2243, glNamedFramebufferSamplePositionsfvAMD, (GLuint framebuffer, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (framebuffer, numsamples, pixelindex, values))
+GL_PROC_VOID(2244, glVertex2f, (GLfloat x, GLfloat y), (x, y))
+GL_PROC_VOID(2245, glVertexAttribs3svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GL_PROC_VOID(2246, glGetRenderbufferParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2247, glProgramUniformMatrix3x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2248, glCompressedMultiTexImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, border, imageSize, bits))
+GL_PROC_VOID(2249, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GL_PROC_VOID(2250, glTexCoord2fColor4fNormal3fVertex3fvSUN, (const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (tc, c, n, v))
+GL_PROC(2251, GLboolean, glAreProgramsResidentNV, (GLsizei n, const GLuint *programs, GLboolean *residences), (n, programs, residences))
+GL_PROC_VOID(2252, glMultiTexCoord1s, (GLenum target, GLshort s), (target, s))
+GL_PROC_VOID(2253, glTexPageCommitmentARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (target, level, xoffset, yoffset, zoffset, width, height, depth, commit))
+GL_PROC_VOID(2254, glGenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GL_PROC_VOID(2255, glGetImageTransformParameterivHP, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2256, glTexBumpParameterfvATI, (GLenum pname, const GLfloat *param), (pname, param))
+GL_PROC_VOID(2257, glClearNamedBufferData, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GL_PROC_VOID(2258, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GL_PROC_VOID(2259, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+GL_PROC_VOID(2260, glTextureParameteriEXT, (GLuint texture, GLenum target, GLenum pname, GLint param), (texture, target, pname, param))
+GL_PROC(2261, GLboolean, glIsTransformFeedback, (GLuint id), (id))
+GL_PROC_VOID(2262, glGetMultiTexParameterIuivEXT, (GLenum texunit, GLenum target, GLenum pname, GLuint *params), (texunit, target, pname, params))
+GL_PROC_VOID(2263, glUniform3i64ARB, (GLint location, GLint64 x, GLint64 y, GLint64 z), (location, x, y, z))
+GL_PROC_VOID(2264, glSecondaryColor3sEXT, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GL_PROC_VOID(2265, glMultiDrawMeshTasksIndirectNV, (GLintptr indirect, GLsizei drawcount, GLsizei stride), (indirect, drawcount, stride))
+GL_PROC_VOID(2266, glGetMultiTexLevelParameterfvEXT, (GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params), (texunit, target, level, pname, params))
+GL_PROC_VOID(2267, glRectxOES, (GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2), (x1, y1, x2, y2))
+GL_PROC_VOID(2268, glWindowPos3iv, (const GLint *v), (v))
+GL_PROC_VOID(2269, glDeletePerfQueryINTEL, (GLuint queryHandle), (queryHandle))
+GL_PROC_VOID(2270, glGetnUniformuivARB, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GL_PROC_VOID(2271, glGetnColorTableARB, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GL_PROC_VOID(2272, glPathParameterfvNV, (GLuint path, GLenum pname, const GLfloat *value), (path, pname, value))
+GL_PROC_VOID(2273, glPixelMapx, (GLenum map, GLint size, const GLfixed *values), (map, size, values))
+GL_PROC_VOID(2274, glUniformHandleui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(2275, glCopyMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (texunit, target, level, internalformat, x, y, width, height, border))
+GL_PROC_VOID(2276, glWindowPos2fv, (const GLfloat *v), (v))
+GL_PROC(2277, GLvdpauSurfaceNV, glVDPAURegisterVideoSurfaceNV, (const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames), (vdpSurface, target, numTextureNames, textureNames))
+GL_PROC_VOID(2278, glFlushRasterSGIX, (void), ())
+GL_PROC_VOID(2279, glMultiTexCoord2sARB, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GL_PROC_VOID(2280, glUniform4uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(2281, glColor3d, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue))
+GL_PROC_VOID(2282, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GL_PROC_VOID(2283, glSecondaryColor3bvEXT, (const GLbyte *v), (v))
+GL_PROC_VOID(2284, glVertexAttrib4fvARB, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(2285, glProgramUniform4uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(2286, glShaderBinary, (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length), (count, shaders, binaryformat, binary, length))
+GL_PROC_VOID(2287, glGetVideoCaptureivNV, (GLuint video_capture_slot, GLenum pname, GLint *params), (video_capture_slot, pname, params))
+GL_PROC_VOID(2288, glGetMinmaxParameterivEXT, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2289, glGenSemaphoresEXT, (GLsizei n, GLuint *semaphores), (n, semaphores))
+GL_PROC_VOID(2290, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GL_PROC_VOID(2291, glProgramUniform2ui64vARB, (GLuint program, GLint location, GLsizei count, const GLuint64 *value), (program, location, count, value))
+GL_PROC_VOID(2292, glTexCoord4fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2293, glGlobalAlphaFactorbSUN, (GLbyte factor), (factor))
+GL_PROC_VOID(2294, glFragmentMaterialfvSGIX, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params))
+GL_PROC_VOID(2295, glGetOcclusionQueryivNV, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_PROC_VOID(2296, glProgramUniform2fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(2297, glBindMultiTextureEXT, (GLenum texunit, GLenum target, GLuint texture), (texunit, target, texture))
+GL_PROC_VOID(2298, glTexCoord2iv, (const GLint *v), (v))
+GL_PROC_VOID(2299, glUniform2ui64NV, (GLint location, GLuint64EXT x, GLuint64EXT y), (location, x, y))
+GL_PROC_VOID(2300, glNamedRenderbufferStorageEXT, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GL_PROC_VOID(2301, glProgramUniform3uivEXT, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(2302, glCompressedTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GL_PROC_VOID(2303, glSecondaryColor3ui, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GL_PROC_VOID(2304, glGetHistogramParameterfvEXT, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2305, glVertexAttribIFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GL_PROC_VOID(2306, glRects, (GLshort x1, GLshort y1, GLshort x2, GLshort y2), (x1, y1, x2, y2))
+GL_PROC_VOID(2307, glVertexAttribL2dvEXT, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(2308, glMultiTexCoord3dARB, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r))
+GL_PROC_VOID(2309, glVertexAttrib4bvARB, (GLuint index, const GLbyte *v), (index, v))
+GL_PROC_VOID(2310, glReadInstrumentsSGIX, (GLint marker), (marker))
+GL_PROC_VOID(2311, glProgramUniform1i64ARB, (GLuint program, GLint location, GLint64 x), (program, location, x))
+GL_PROC_VOID(2312, glWaitVkSemaphoreNV, (GLuint64 vkSemaphore), (vkSemaphore))
+GL_PROC_VOID(2313, glVertexAttribI4uivEXT, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(2314, glBufferStorageMemEXT, (GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset), (target, size, memory, offset))
+GL_PROC_VOID(2315, glGetPerfCounterInfoINTEL, (GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue), (queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue))
+GL_PROC_VOID(2316, glNormalStream3bvATI, (GLenum stream, const GLbyte *coords), (stream, coords))
+GL_PROC_VOID(2317, glGetPixelMapfv, (GLenum map, GLfloat *values), (map, values))
+GL_PROC_VOID(2318, glClearNamedFramebufferfv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value))
+GL_PROC_VOID(2319, glProgramEnvParameter4dvARB, (GLenum target, GLuint index, const GLdouble *params), (target, index, params))
+GL_PROC_VOID(2320, glPNTrianglesfATI, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2321, glGetColorTableParameterfvSGI, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2322, glNamedBufferAttachMemoryNV, (GLuint buffer, GLuint memory, GLuint64 offset), (buffer, memory, offset))
+GL_PROC_VOID(2323, glEvalCoord1dv, (const GLdouble *u), (u))
+GL_PROC_VOID(2324, glFogCoordPointerEXT, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer))
+GL_PROC_VOID(2325, glUploadGpuMaskNVX, (GLbitfield mask), (mask))
+GL_PROC_VOID(2326, glBindProgramPipeline, (GLuint pipeline), (pipeline))
+GL_PROC_VOID(2327, glPointParameterfvEXT, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(2328, glEnableClientStateIndexedEXT, (GLenum array, GLuint index), (array, index))
+GL_PROC_VOID(2329, glProgramUniformMatrix4x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2330, glTransformFeedbackBufferRange, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+GL_PROC_VOID(2331, glImportSemaphoreFdEXT, (GLuint semaphore, GLenum handleType, GLint fd), (semaphore, handleType, fd))
+GL_PROC_VOID(2332, glTextureStorage3DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, target, levels, internalformat, width, height, depth))
+GL_PROC_VOID(2333, glMultiTexCoord4f, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GL_PROC_VOID(2334, glUniform3fARB, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GL_PROC_VOID(2335, glVertexStream3iATI, (GLenum stream, GLint x, GLint y, GLint z), (stream, x, y, z))
+GL_PROC_VOID(2336, glDeformationMap3dSGIX, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points))
+GL_PROC_VOID(2337, glBindTextureUnit, (GLuint unit, GLuint texture), (unit, texture))
+GL_PROC_VOID(2338, glVertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(2339, glUniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(2340, glFramebufferTextureFaceARB, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face))
+GL_PROC_VOID(2341, glAttachShader, (GLuint program, GLuint shader), (program, shader))
+GL_PROC_VOID(2342, glDeleteBuffersARB, (GLsizei n, const GLuint *buffers), (n, buffers))
+GL_PROC_VOID(2343, glGetMapParameterfvNV, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2344, glTexCoord4xOES, (GLfixed s, GLfixed t, GLfixed r, GLfixed q), (s, t, r, q))
+GL_PROC_VOID(2345, glTexBufferARB, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GL_PROC_VOID(2346, glVertex2hNV, (GLhalfNV x, GLhalfNV y), (x, y))
+GL_PROC_VOID(2347, glProgramParameter4fNV, (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (target, index, x, y, z, w))
+GL_PROC_VOID(2348, glUniform4ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(2349, glDisable, (GLenum cap), (cap))
+GL_PROC_VOID(2350, glFrameTerminatorGREMEDY, (void), ())
+GL_PROC_VOID(2351, glMatrixLoaddEXT, (GLenum mode, const GLdouble *m), (mode, m))
+GL_PROC_VOID(2352, glUniform2fvARB, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(2353, glVertexAttribL1i64vNV, (GLuint index, const GLint64EXT *v), (index, v))
+GL_PROC_VOID(2354, glWindowPos3fARB, (GLfloat x, GLfloat y, GLfloat z), (x, y, z))
+GL_PROC(2355, GLboolean, glIsPointInFillPathNV, (GLuint path, GLuint mask, GLfloat x, GLfloat y), (path, mask, x, y))
+GL_PROC_VOID(2356, glBindProgramNV, (GLenum target, GLuint id), (target, id))
+GL_PROC_VOID(2357, glCullFace, (GLenum mode), (mode))
+GL_PROC_VOID(2358, glColor3s, (GLshort red, GLshort green, GLshort blue), (red, green, blue))
+GL_PROC_VOID(2359, glGetTextureParameterIiv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GL_PROC_VOID(2360, glEnableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+GL_PROC_VOID(2361, glApplyFramebufferAttachmentCMAAINTEL, (void), ())
+GL_PROC_VOID(2362, glGetTexGeniv, (GLenum coord, GLenum pname, GLint *params), (coord, pname, params))
+GL_PROC_VOID(2363, glProgramUniformMatrix3x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2364, glLoadMatrixf, (const GLfloat *m), (m))
+GL_PROC_VOID(2365, glTexFilterFuncSGIS, (GLenum target, GLenum filter, GLsizei n, const GLfloat *weights), (target, filter, n, weights))
+GL_PROC_VOID(2366, glVertexAttribI3iv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(2367, glVertexWeightfvEXT, (const GLfloat *weight), (weight))
+GL_PROC_VOID(2368, glProgramUniform1uiEXT, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GL_PROC_VOID(2369, glProgramPathFragmentInputGenNV, (GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs), (program, location, genMode, components, coeffs))
+GL_PROC_VOID(2370, glVertexAttribI4iEXT, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GL_PROC_VOID(2371, glEnableClientStateiEXT, (GLenum array, GLuint index), (array, index))
+GL_PROC_VOID(2372, glProgramUniform4i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GL_PROC_VOID(2373, glClearColorIuiEXT, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2374, glProgramUniformMatrix4x2fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2375, glConvolutionParameterxvOES, (GLenum target, GLenum pname, const GLfixed *params), (target, pname, params))
+GL_PROC_VOID(2376, glProgramBufferParametersIivNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint *params), (target, bindingIndex, wordIndex, count, params))
+GL_PROC(2377, GLintptr, glGetUniformOffsetEXT, (GLuint program, GLint location), (program, location))
+GL_PROC_VOID(2378, glTextureBufferEXT, (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer), (texture, target, internalformat, buffer))
+GL_PROC_VOID(2379, glBeginTransformFeedbackNV, (GLenum primitiveMode), (primitiveMode))
+GL_PROC_VOID(2380, glNamedFramebufferTextureLayerEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GL_PROC_VOID(2381, glSecondaryColorPointer, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer))
+GL_PROC_VOID(2382, glCopyColorSubTable, (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width), (target, start, x, y, width))
+GL_PROC_VOID(2383, glCopyTexSubImage3DEXT, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROC_VOID(2384, glTextureParameterfEXT, (GLuint texture, GLenum target, GLenum pname, GLfloat param), (texture, target, pname, param))
+GL_PROC_VOID(2385, glFragmentMaterialiSGIX, (GLenum face, GLenum pname, GLint param), (face, pname, param))
+GL_PROC(2386, GLuint, glGenVertexShadersEXT, (GLuint range), (range))
+GL_PROC_VOID(2387, glBeginQuery, (GLenum target, GLuint id), (target, id))
+GL_PROC_VOID(2388, glMultiTexCoord3sv, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(2389, glScalexOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GL_PROC_VOID(2390, glTangent3ivEXT, (const GLint *v), (v))
+GL_PROC_VOID(2391, glValidateProgramPipeline, (GLuint pipeline), (pipeline))
+GL_PROC_VOID(2392, glLightModelxOES, (GLenum pname, GLfixed param), (pname, param))
+GL_PROC_VOID(2393, glDebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+GL_PROC_VOID(2394, glFragmentLightfvSGIX, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params))
+GL_PROC_VOID(2395, glLightModeli, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2396, glIglooInterfaceSGIX, (GLenum pname, const void *params), (pname, params))
+GL_PROC_VOID(2397, glSecondaryColor3dvEXT, (const GLdouble *v), (v))
+GL_PROC_VOID(2398, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GL_PROC_VOID(2399, glTexCoord2d, (GLdouble s, GLdouble t), (s, t))
+GL_PROC_VOID(2400, glPrimitiveBoundingBoxARB, (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW), (minX, minY, minZ, minW, maxX, maxY, maxZ, maxW))
+GL_PROC_VOID(2401, glMatrixLoadfEXT, (GLenum mode, const GLfloat *m), (mode, m))
+GL_PROC_VOID(2402, glSpriteParameterfvSGIX, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(2403, glIndexsv, (const GLshort *c), (c))
+GL_PROC_VOID(2404, glVertexP4ui, (GLenum type, GLuint value), (type, value))
+GL_PROC_VOID(2405, glProgramUniform1ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(2406, glGetDoublei_vEXT, (GLenum pname, GLuint index, GLdouble *params), (pname, index, params))
+GL_PROC_VOID(2407, glCoverStrokePathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues))
+GL_PROC_VOID(2408, glColor4ubVertex3fvSUN, (const GLubyte *c, const GLfloat *v), (c, v))
+GL_PROC_VOID(2409, glDrawCommandsStatesAddressNV, (const GLuint64 *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (indirects, sizes, states, fbos, count))
+GL_PROC_VOID(2410, glDispatchComputeGroupSizeARB, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z), (num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z))
+GL_PROC_VOID(2411, glPixelTransformParameterivEXT, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(2412, glBufferStorageExternalEXT, (GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags), (target, offset, size, clientBuffer, flags))
+GL_PROC_VOID(2413, glVertexAttribL3i64vNV, (GLuint index, const GLint64EXT *v), (index, v))
+GL_PROC_VOID(2414, glProgramUniform3i64vARB, (GLuint program, GLint location, GLsizei count, const GLint64 *value), (program, location, count, value))
+GL_PROC_VOID(2415, glGenNamesAMD, (GLenum identifier, GLuint num, GLuint *names), (identifier, num, names))
+GL_PROC_VOID(2416, glGetNamedFramebufferParameteriv, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param))
+GL_PROC_VOID(2417, glProgramUniform2ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(2418, glGetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GL_PROC_VOID(2419, glVertexArrayVertexAttribOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, normalized, stride, offset))
+GL_PROC_VOID(2420, glBlendParameteriNV, (GLenum pname, GLint value), (pname, value))
+GL_PROC(2421, GLboolean, glIsTextureEXT, (GLuint texture), (texture))
+GL_PROC_VOID(2422, glNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GL_PROC_VOID(2423, glTexGend, (GLenum coord, GLenum pname, GLdouble param), (coord, pname, param))
+GL_PROC_VOID(2424, glGetnCompressedTexImageARB, (GLenum target, GLint lod, GLsizei bufSize, void *img), (target, lod, bufSize, img))
+GL_PROC_VOID(2425, glGetProgramEnvParameterfvARB, (GLenum target, GLuint index, GLfloat *params), (target, index, params))
+GL_PROC_VOID(2426, glVariantsvEXT, (GLuint id, const GLshort *addr), (id, addr))
+GL_PROC_VOID(2427, glDrawMeshTasksIndirectNV, (GLintptr indirect), (indirect))
+GL_PROC_VOID(2428, glReplacementCodeuiColor4fNormal3fVertex3fvSUN, (const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v), (rc, c, n, v))
+GL_PROC_VOID(2429, glNormal3b, (GLbyte nx, GLbyte ny, GLbyte nz), (nx, ny, nz))
+GL_PROC_VOID(2430, glMaterialiv, (GLenum face, GLenum pname, const GLint *params), (face, pname, params))
+GL_PROC_VOID(2431, glPixelTransferxOES, (GLenum pname, GLfixed param), (pname, param))
+GL_PROC_VOID(2432, glColor3ui, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GL_PROC_VOID(2433, glMultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GL_PROC_VOID(2434, glColor4bv, (const GLbyte *v), (v))
+GL_PROC_VOID(2435, glClearTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+GL_PROC(2436, GLboolean, glTestFenceAPPLE, (GLuint fence), (fence))
+GL_PROC_VOID(2437, glBufferDataARB, (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage), (target, size, data, usage))
+GL_PROC_VOID(2438, glLoadIdentityDeformationMapSGIX, (GLbitfield mask), (mask))
+GL_PROC_VOID(2439, glMemoryBarrierEXT, (GLbitfield barriers), (barriers))
+GL_PROC_VOID(2440, glVertexArrayVertexAttribIFormatEXT, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GL_PROC_VOID(2441, glCopyTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+GL_PROC_VOID(2442, glUniform1ui64NV, (GLint location, GLuint64EXT x), (location, x))
+GL_PROC_VOID(2443, glVertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(2444, glWindowPos4dvMESA, (const GLdouble *v), (v))
+GL_PROC_VOID(2445, glGetMemoryObjectDetachedResourcesuivNV, (GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params), (memory, pname, first, count, params))
+GL_PROC_VOID(2446, glGetObjectBufferfvATI, (GLuint buffer, GLenum pname, GLfloat *params), (buffer, pname, params))
+GL_PROC_VOID(2447, glMultiTexCoord3bvOES, (GLenum texture, const GLbyte *coords), (texture, coords))
+GL_PROC_VOID(2448, glMultiTexGenfEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat param), (texunit, coord, pname, param))
+GL_PROC_VOID(2449, glWindowPos3dMESA, (GLdouble x, GLdouble y, GLdouble z), (x, y, z))
+GL_PROC_VOID(2450, glMultiTexCoord1xOES, (GLenum texture, GLfixed s), (texture, s))
+GL_PROC_VOID(2451, glNamedFramebufferRenderbufferEXT, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GL_PROC_VOID(2452, glWeightbvARB, (GLint size, const GLbyte *weights), (size, weights))
+GL_PROC_VOID(2453, glPrimitiveRestartIndexNV, (GLuint index), (index))
+GL_PROC_VOID(2454, glClearAccum, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2455, glFramebufferTexture3DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GL_PROC_VOID(2456, glNormal3xOES, (GLfixed nx, GLfixed ny, GLfixed nz), (nx, ny, nz))
+GL_PROC_VOID(2457, glUniform1uivEXT, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROC_VOID(2458, glGetnMapdv, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GL_PROC_VOID(2459, glRasterSamplesEXT, (GLuint samples, GLboolean fixedsamplelocations), (samples, fixedsamplelocations))
+GL_PROC_VOID(2460, glPixelTransformParameteriEXT, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(2461, glProgramUniformMatrix2x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2462, glRasterPos2iv, (const GLint *v), (v))
+GL_PROC_VOID(2463, glNamedFramebufferTexture, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GL_PROC_VOID(2464, glTextureStorageMem3DMultisampleEXT, (GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset))
+GL_PROC_VOID(2465, glRasterPos4d, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w))
+GL_PROC_VOID(2466, glBlendEquationiARB, (GLuint buf, GLenum mode), (buf, mode))
+GL_PROC_VOID(2467, glUniform1d, (GLint location, GLdouble x), (location, x))
+GL_PROC_VOID(2468, glMatrixRotatedEXT, (GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (mode, angle, x, y, z))
+GL_PROC_VOID(2469, glLightiv, (GLenum light, GLenum pname, const GLint *params), (light, pname, params))
+GL_PROC_VOID(2470, glEnableVertexAttribArray, (GLuint index), (index))
+GL_PROC_VOID(2471, glUniform4iARB, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GL_PROC_VOID(2472, glFramebufferSamplePositionsfvAMD, (GLenum target, GLuint numsamples, GLuint pixelindex, const GLfloat *values), (target, numsamples, pixelindex, values))
+GL_PROC_VOID(2473, glDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count), (mode, start, end, first, count))
+GL_PROC_VOID(2474, glGetSeparableFilterEXT, (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span), (target, format, type, row, column, span))
+GL_PROC_VOID(2475, glTextureParameterivEXT, (GLuint texture, GLenum target, GLenum pname, const GLint *params), (texture, target, pname, params))
+GL_PROC_VOID(2476, glInsertEventMarkerEXT, (GLsizei length, const GLchar *marker), (length, marker))
+GL_PROC_VOID(2477, glGetnConvolutionFilter, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GL_PROC_VOID(2478, glGetLocalConstantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GL_PROC_VOID(2479, glVertexAttribI1iEXT, (GLuint index, GLint x), (index, x))
+GL_PROC_VOID(2480, glNormal3sv, (const GLshort *v), (v))
+GL_PROC(2481, GLboolean, glTestObjectAPPLE, (GLenum object, GLuint name), (object, name))
+GL_PROC_VOID(2482, glGetTextureLevelParameterfvEXT, (GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params), (texture, target, level, pname, params))
+GL_PROC_VOID(2483, glVertexAttrib1sNV, (GLuint index, GLshort x), (index, x))
+GL_PROC_VOID(2484, glFogf, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2485, glMulticastFramebufferSampleLocationsfvNV, (GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v), (gpu, framebuffer, start, count, v))
+GL_PROC_VOID(2486, glVertexStream4dATI, (GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (stream, x, y, z, w))
+GL_PROC_VOID(2487, glVideoCaptureStreamParameterdvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble *params), (video_capture_slot, stream, pname, params))
+GL_PROC_VOID(2488, glVertex3hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z), (x, y, z))
+GL_PROC_VOID(2489, glColor4i, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2490, glShaderSourceARB, (GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length), (shaderObj, count, string, length))
+GL_PROC_VOID(2491, glProgramUniformMatrix3dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2492, glUniform2dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GL_PROC(2493, GLuint, glGenLists, (GLsizei range), (range))
+GL_PROC_VOID(2494, glVertexAttrib4svNV, (GLuint index, const GLshort *v), (index, v))
+GL_PROC_VOID(2495, glVDPAUFiniNV, (void), ())
+GL_PROC_VOID(2496, glPointParameterivNV, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(2497, glGenTextures, (GLsizei n, GLuint *textures), (n, textures))
+GL_PROC_VOID(2498, glGetNamedBufferPointervEXT, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GL_PROC_VOID(2499, glClientActiveVertexStreamATI, (GLenum stream), (stream))
+GL_PROC_VOID(2500, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GL_PROC_VOID(2501, glWindowPos3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2502, glProgramNamedParameter4fvNV, (GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v), (id, len, name, v))
+GL_PROC_VOID(2503, glRectfv, (const GLfloat *v1, const GLfloat *v2), (v1, v2))
+GL_PROC_VOID(2504, glFragmentMaterialivSGIX, (GLenum face, GLenum pname, const GLint *params), (face, pname, params))
+GL_PROC_VOID(2505, glColorPointervINTEL, (GLint size, GLenum type, const void **pointer), (size, type, pointer))
+GL_PROC_VOID(2506, glBeginTransformFeedback, (GLenum primitiveMode), (primitiveMode))
+GL_PROC_VOID(2507, glVertexAttribs3fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GL_PROC_VOID(2508, glFogCoordf, (GLfloat coord), (coord))
+GL_PROC_VOID(2509, glEnableVariantClientStateEXT, (GLuint id), (id))
+GL_PROC_VOID(2510, glSignalSemaphoreui64NVX, (GLuint signalGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (signalGpu, fenceObjectCount, semaphoreArray, fenceValueArray))
+GL_PROC_VOID(2511, glBindBuffersRange, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+GL_PROC_VOID(2512, glLightModeliv, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(2513, glVertex4dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2514, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_PROC_VOID(2515, glUniform2ui64vARB, (GLint location, GLsizei count, const GLuint64 *value), (location, count, value))
+GL_PROC_VOID(2516, glMatrixFrustumEXT, (GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (mode, left, right, bottom, top, zNear, zFar))
+GL_PROC_VOID(2517, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GL_PROC_VOID(2518, glProgramUniformMatrix2x3fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2519, glCallList, (GLuint list), (list))
+GL_PROC_VOID(2520, glTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROC_VOID(2521, glProgramLocalParameters4fvEXT, (GLenum target, GLuint index, GLsizei count, const GLfloat *params), (target, index, count, params))
+GL_PROC_VOID(2522, glInvalidateNamedFramebufferSubData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+GL_PROC_VOID(2523, glProgramUniform3uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC_VOID(2524, glRasterPos3xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(2525, glUniform1i64NV, (GLint location, GLint64EXT x), (location, x))
+GL_PROC_VOID(2526, glRasterPos2fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2527, glCompressedMultiTexImage2DEXT, (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits), (texunit, target, level, internalformat, width, height, border, imageSize, bits))
+GL_PROC_VOID(2528, glMulticastViewportPositionWScaleNVX, (GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff), (gpu, index, xcoeff, ycoeff))
+GL_PROC_VOID(2529, glNamedProgramLocalParameterI4uivEXT, (GLuint program, GLenum target, GLuint index, const GLuint *params), (program, target, index, params))
+GL_PROC_VOID(2530, glFragmentCoverageColorNV, (GLuint color), (color))
+GL_PROC_VOID(2531, glGetNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GL_PROC_VOID(2532, glVertex2xvOES, (const GLfixed *coords), (coords))
+GL_PROC_VOID(2533, glUniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GL_PROC_VOID(2534, glBindShadingRateImageNV, (GLuint texture), (texture))
+GL_PROC_VOID(2535, glNamedFramebufferRenderbuffer, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GL_PROC(2536, GLuint, glCreateShaderProgramEXT, (GLenum type, const GLchar *string), (type, string))
+GL_PROC_VOID(2537, glPassTexCoordATI, (GLuint dst, GLuint coord, GLenum swizzle), (dst, coord, swizzle))
+GL_PROC(2538, void *, glMapObjectBufferATI, (GLuint buffer), (buffer))
+GL_PROC_VOID(2539, glLoadMatrixxOES, (const GLfixed *m), (m))
+GL_PROC_VOID(2540, glFrustumfOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f))
+GL_PROC_VOID(2541, glVDPAUUnregisterSurfaceNV, (GLvdpauSurfaceNV surface), (surface))
+GL_PROC(2542, GLuint, glGenSymbolsEXT, (GLenum datatype, GLenum storagetype, GLenum range, GLuint components), (datatype, storagetype, range, components))
+GL_PROC_VOID(2543, glMultiTexCoord3bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r), (texture, s, t, r))
+GL_PROC_VOID(2544, glGetLocalConstantIntegervEXT, (GLuint id, GLenum value, GLint *data), (id, value, data))
+GL_PROC_VOID(2545, glVertex4f, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GL_PROC_VOID(2546, glRasterPos3sv, (const GLshort *v), (v))
+GL_PROC_VOID(2547, glVertexStream1dvATI, (GLenum stream, const GLdouble *coords), (stream, coords))
+GL_PROC_VOID(2548, glMultiDrawArraysIndirectBindlessCountNV, (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount), (mode, indirect, drawCount, maxDrawCount, stride, vertexBufferCount))
+GL_PROC_VOID(2549, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GL_PROC_VOID(2550, glMemoryBarrierByRegion, (GLbitfield barriers), (barriers))
+GL_PROC(2551, const GLubyte *, glGetStringi, (GLenum name, GLuint index), (name, index))
+GL_PROC_VOID(2552, glGetPathColorGenfvNV, (GLenum color, GLenum pname, GLfloat *value), (color, pname, value))
+GL_PROC_VOID(2553, glSecondaryColor3uiEXT, (GLuint red, GLuint green, GLuint blue), (red, green, blue))
+GL_PROC_VOID(2554, glPathTexGenNV, (GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat *coeffs), (texCoordSet, genMode, components, coeffs))
+GL_PROC_VOID(2555, glVideoCaptureStreamParameterfvNV, (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat *params), (video_capture_slot, stream, pname, params))
+GL_PROC_VOID(2556, glProgramUniformMatrix2x4fvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2557, glProgramUniform2d, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+GL_PROC_VOID(2558, glProgramUniform2i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(2559, glCopyTexSubImage1DEXT, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GL_PROC_VOID(2560, glProgramUniformMatrix4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2561, glProgramUniform1dEXT, (GLuint program, GLint location, GLdouble x), (program, location, x))
+GL_PROC_VOID(2562, glMultiTexCoord4xOES, (GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q), (texture, s, t, r, q))
+GL_PROC_VOID(2563, glVertex2s, (GLshort x, GLshort y), (x, y))
+GL_PROC_VOID(2564, glVertex4iv, (const GLint *v), (v))
+GL_PROC_VOID(2565, glObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GL_PROC_VOID(2566, glVertex2bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(2567, glMultiTexCoord4dv, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(2568, glMaterialfv, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params))
+GL_PROC_VOID(2569, glVertexAttribs2svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GL_PROC_VOID(2570, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GL_PROC_VOID(2571, glVertexArrayBindingDivisor, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GL_PROC_VOID(2572, glVertexAttribs1svNV, (GLuint index, GLsizei count, const GLshort *v), (index, count, v))
+GL_PROC_VOID(2573, glBeginVideoCaptureNV, (GLuint video_capture_slot), (video_capture_slot))
+GL_PROC_VOID(2574, glColorFragmentOp2ATI, (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod), (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod))
+GL_PROC_VOID(2575, glTagSampleBufferSGIX, (void), ())
+GL_PROC_VOID(2576, glVertex4hNV, (GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w), (x, y, z, w))
+GL_PROC(2577, GLint, glGetInstrumentsSGIX, (void), ())
+GL_PROC_VOID(2578, glVertexAttrib2sARB, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GL_PROC_VOID(2579, glGetPerfQueryIdByNameINTEL, (GLchar *queryName, GLuint *queryId), (queryName, queryId))
+GL_PROC_VOID(2580, glGetNextPerfQueryIdINTEL, (GLuint queryId, GLuint *nextQueryId), (queryId, nextQueryId))
+GL_PROC_VOID(2581, glDrawElementsInstancedARB, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GL_PROC_VOID(2582, glScissorIndexed, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+GL_PROC(2583, GLenum, glPathMemoryGlyphIndexArrayNV, (GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale), (firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale))
+GL_PROC_VOID(2584, glStencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GL_PROC_VOID(2585, glTexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords))
+GL_PROC_VOID(2586, glTexCoord2fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2587, glMultiTexGendvEXT, (GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params), (texunit, coord, pname, params))
+GL_PROC_VOID(2588, glImageTransformParameterfvHP, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC(2589, GLboolean, glReleaseKeyedMutexWin32EXT, (GLuint memory, GLuint64 key), (memory, key))
+GL_PROC_VOID(2590, glPointParameterfEXT, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2591, glVertexArrayVertexAttribLOffsetEXT, (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset), (vaobj, buffer, index, size, type, stride, offset))
+GL_PROC(2592, GLuint, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GL_PROC_VOID(2593, glCompressedTextureSubImage2DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits))
+GL_PROC_VOID(2594, glRasterPos3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2595, glUniform1i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GL_PROC_VOID(2596, glTexCoord3f, (GLfloat s, GLfloat t, GLfloat r), (s, t, r))
+GL_PROC_VOID(2597, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GL_PROC(2598, GLboolean, glIsNameAMD, (GLenum identifier, GLuint name), (identifier, name))
+GL_PROC_VOID(2599, glInvalidateFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GL_PROC_VOID(2600, glVertexAttribL4dEXT, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_PROC_VOID(2601, glNamedFramebufferDrawBuffer, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+GL_PROC_VOID(2602, glDrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+GL_PROC_VOID(2603, glColor4uiv, (const GLuint *v), (v))
+GL_PROC_VOID(2604, glNamedProgramLocalParameterI4uiEXT, (GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (program, target, index, x, y, z, w))
+GL_PROC_VOID(2605, glGenTexturesEXT, (GLsizei n, GLuint *textures), (n, textures))
+GL_PROC_VOID(2606, glUniform1ui, (GLint location, GLuint v0), (location, v0))
+GL_PROC_VOID(2607, glPauseTransformFeedback, (void), ())
+GL_PROC_VOID(2608, glMultTransposeMatrixxOES, (const GLfixed *m), (m))
+GL_PROC_VOID(2609, glTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROC_VOID(2610, glWindowPos2d, (GLdouble x, GLdouble y), (x, y))
+GL_PROC_VOID(2611, glBindFragDataLocationEXT, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GL_PROC_VOID(2612, glDebugMessageCallbackAMD, (GLDEBUGPROCAMD callback, void *userParam), (callback, userParam))
+GL_PROC_VOID(2613, glTexImage3DEXT, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GL_PROC_VOID(2614, glGetArrayObjectivATI, (GLenum array, GLenum pname, GLint *params), (array, pname, params))
+GL_PROC_VOID(2615, glGetVariantFloatvEXT, (GLuint id, GLenum value, GLfloat *data), (id, value, data))
+GL_PROC_VOID(2616, glVertexAttribI4iv, (GLuint index, const GLint *v), (index, v))
+GL_PROC_VOID(2617, glDisableVertexAttribArray, (GLuint index), (index))
+GL_PROC_VOID(2618, glSetFenceAPPLE, (GLuint fence), (fence))
+GL_PROC_VOID(2619, glGetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GL_PROC_VOID(2620, glGetNamedBufferParameterui64vNV, (GLuint buffer, GLenum pname, GLuint64EXT *params), (buffer, pname, params))
+GL_PROC_VOID(2621, glSecondaryColor3fEXT, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue))
+GL_PROC_VOID(2622, glSecondaryColor3b, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue))
+GL_PROC_VOID(2623, glProgramUniform4dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (program, location, x, y, z, w))
+GL_PROC_VOID(2624, glGetObjectParameterivARB, (GLhandleARB obj, GLenum pname, GLint *params), (obj, pname, params))
+GL_PROC_VOID(2625, glReplacementCodeuiTexCoord2fVertex3fSUN, (GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (rc, s, t, x, y, z))
+GL_PROC_VOID(2626, glVertexAttrib1fvARB, (GLuint index, const GLfloat *v), (index, v))
+GL_PROC_VOID(2627, glProgramUniform3i64vNV, (GLuint program, GLint location, GLsizei count, const GLint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(2628, glTextureImage2DMultisampleNV, (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations), (texture, target, samples, internalFormat, width, height, fixedSampleLocations))
+GL_PROC(2629, GLenum, glObjectUnpurgeableAPPLE, (GLenum objectType, GLuint name, GLenum option), (objectType, name, option))
+GL_PROC_VOID(2630, glRectd, (GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2), (x1, y1, x2, y2))
+GL_PROC_VOID(2631, glGetTextureLevelParameteriv, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params))
+GL_PROC_VOID(2632, glGetFramebufferParameterfvAMD, (GLenum target, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values), (target, pname, numsamples, pixelindex, size, values))
+GL_PROC_VOID(2633, glWindowPos3ivMESA, (const GLint *v), (v))
+GL_PROC_VOID(2634, glSecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GL_PROC_VOID(2635, glVertexAttrib4usv, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(2636, glMultiTexCoord2hvNV, (GLenum target, const GLhalfNV *v), (target, v))
+GL_PROC_VOID(2637, glTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, target, level, xoffset, width, format, type, pixels))
+GL_PROC_VOID(2638, glUniformui64NV, (GLint location, GLuint64EXT value), (location, value))
+GL_PROC_VOID(2639, glRecti, (GLint x1, GLint y1, GLint x2, GLint y2), (x1, y1, x2, y2))
+GL_PROC_VOID(2640, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const GLvoid *indices), (mode, count, type, indices))
+GL_PROC_VOID(2641, glProgramUniform4dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(2642, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data), (target, level, internalformat, width, height, border, imageSize, data))
+GL_PROC_VOID(2643, glMultiTexEnviEXT, (GLenum texunit, GLenum target, GLenum pname, GLint param), (texunit, target, pname, param))
+GL_PROC_VOID(2644, glMulticastBlitFramebufferNV, (GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_PROC_VOID(2645, glTextureParameteri, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+GL_PROC_VOID(2646, glStencilThenCoverFillPathInstancedNV, (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues), (numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues))
+GL_PROC_VOID(2647, glUniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROC_VOID(2648, glPathCoordsNV, (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords), (path, numCoords, coordType, coords))
+GL_PROC_VOID(2649, glTextureParameterf, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+GL_PROC_VOID(2650, glPolygonOffsetClampEXT, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+GL_PROC_VOID(2651, glMultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GL_PROC(2652, GLboolean, glIsTexture, (GLuint texture), (texture))
+GL_PROC_VOID(2653, glVertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(2654, glProgramUniform1ui, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GL_PROC_VOID(2655, glVertexAttribs1dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GL_PROC_VOID(2656, glVertexAttribI4usv, (GLuint index, const GLushort *v), (index, v))
+GL_PROC_VOID(2657, glGetVertexAttribArrayObjectfvATI, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_PROC_VOID(2658, glProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2659, glGetMaterialfv, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params))
+GL_PROC_VOID(2660, glUnmapTexture2DINTEL, (GLuint texture, GLint level), (texture, level))
+GL_PROC_VOID(2661, glMultiTexSubImage1DEXT, (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texunit, target, level, xoffset, width, format, type, pixels))
+GL_PROC_VOID(2662, glOrthofOES, (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f), (l, r, b, t, n, f))
+GL_PROC_VOID(2663, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(2664, glMultiDrawArraysIndirectCountARB, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GL_PROC_VOID(2665, glQueryResourceTagNV, (GLint tagId, const GLchar *tagString), (tagId, tagString))
+GL_PROC_VOID(2666, glCompressedTexSubImage2DARB, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GL_PROC_VOID(2667, glGenQueries, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC_VOID(2668, glMulticastWaitSyncNV, (GLuint signalGpu, GLbitfield waitGpuMask), (signalGpu, waitGpuMask))
+GL_PROC_VOID(2669, glWindowPos3svARB, (const GLshort *v), (v))
+GL_PROC_VOID(2670, glVertexAttribs2fvNV, (GLuint index, GLsizei count, const GLfloat *v), (index, count, v))
+GL_PROC_VOID(2671, glColor4us, (GLushort red, GLushort green, GLushort blue, GLushort alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2672, glBeginPerfQueryINTEL, (GLuint queryHandle), (queryHandle))
+GL_PROC_VOID(2673, glWeightusvARB, (GLint size, const GLushort *weights), (size, weights))
+GL_PROC_VOID(2674, glDeleteStatesNV, (GLsizei n, const GLuint *states), (n, states))
+GL_PROC_VOID(2675, glStencilThenCoverFillPathNV, (GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode), (path, fillMode, mask, coverMode))
+GL_PROC_VOID(2676, glProgramUniform1d, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+GL_PROC_VOID(2677, glGetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2678, glClearDepthxOES, (GLfixed depth), (depth))
+GL_PROC_VOID(2679, glTexCoord2fVertex3fSUN, (GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z), (s, t, x, y, z))
+GL_PROC_VOID(2680, glNamedFramebufferParameteriEXT, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GL_PROC_VOID(2681, glNormalStream3dATI, (GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz), (stream, nx, ny, nz))
+GL_PROC_VOID(2682, glWindowPos3ivARB, (const GLint *v), (v))
+GL_PROC_VOID(2683, glImportSemaphoreWin32NameEXT, (GLuint semaphore, GLenum handleType, const void *name), (semaphore, handleType, name))
+GL_PROC_VOID(2684, glStencilMaskSeparate, (GLenum face, GLuint mask), (face, mask))
+GL_PROC_VOID(2685, glClearStencil, (GLint s), (s))
+GL_PROC_VOID(2686, glWindowPos2svMESA, (const GLshort *v), (v))
+GL_PROC_VOID(2687, glAlphaFunc, (GLenum func, GLclampf ref), (func, ref))
+GL_PROC_VOID(2688, glLoadTransposeMatrixf, (const GLfloat m[16]), (m))
+GL_PROC_VOID(2689, glUniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC_VOID(2690, glScissorExclusiveNV, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_PROC_VOID(2691, glLoadIdentity, (void), ())
+GL_PROC_VOID(2692, glVariantfvEXT, (GLuint id, const GLfloat *addr), (id, addr))
+GL_PROC_VOID(2693, glGetHistogramEXT, (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values), (target, reset, format, type, values))
+GL_PROC_VOID(2694, glBlendFuncSeparateiARB, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GL_PROC(2695, GLuint, glCreateProgram, (void), ())
+GL_PROC_VOID(2696, glMultiDrawElementsIndirectAMD, (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride), (mode, type, indirect, primcount, stride))
+GL_PROC_VOID(2697, glBinormal3svEXT, (const GLshort *v), (v))
+GL_PROC_VOID(2698, glMulticastGetQueryObjectui64vNV, (GLuint gpu, GLuint id, GLenum pname, GLuint64 *params), (gpu, id, pname, params))
+GL_PROC_VOID(2699, glPushName, (GLuint name), (name))
+GL_PROC_VOID(2700, glIndexiv, (const GLint *c), (c))
+GL_PROC_VOID(2701, glLGPUCopyImageSubDataNVX, (GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth), (sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth))
+GL_PROC_VOID(2702, glMultiDrawElementsEXT, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount), (mode, count, type, indices, primcount))
+GL_PROC_VOID(2703, glGetVideoi64vNV, (GLuint video_slot, GLenum pname, GLint64EXT *params), (video_slot, pname, params))
+GL_PROC_VOID(2704, glGetQueryObjectivARB, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_PROC_VOID(2705, glVertexArrayAttribFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GL_PROC_VOID(2706, glVertexStream4ivATI, (GLenum stream, const GLint *coords), (stream, coords))
+GL_PROC_VOID(2707, glGetNamedProgramivEXT, (GLuint program, GLenum target, GLenum pname, GLint *params), (program, target, pname, params))
+GL_PROC_VOID(2708, glVariantdvEXT, (GLuint id, const GLdouble *addr), (id, addr))
+GL_PROC_VOID(2709, glDepthRange, (GLclampd near_val, GLclampd far_val), (near_val, far_val))
+GL_PROC_VOID(2710, glGetFinalCombinerInputParameterivNV, (GLenum variable, GLenum pname, GLint *params), (variable, pname, params))
+GL_PROC_VOID(2711, glSignalSemaphoreEXT, (GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts), (semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts))
+GL_PROC_VOID(2712, glVertexStream3ivATI, (GLenum stream, const GLint *coords), (stream, coords))
+GL_PROC_VOID(2713, glTextureParameterfv, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param))
+GL_PROC_VOID(2714, glGetCombinerInputParameterivNV, (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params), (stage, portion, variable, pname, params))
+GL_PROC_VOID(2715, glGetMultiTexGenfvEXT, (GLenum texunit, GLenum coord, GLenum pname, GLfloat *params), (texunit, coord, pname, params))
+GL_PROC_VOID(2716, glUniformui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GL_PROC_VOID(2717, glApplyTextureEXT, (GLenum mode), (mode))
+GL_PROC_VOID(2718, glVertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(2719, glEvalCoord1fv, (const GLfloat *u), (u))
+GL_PROC_VOID(2720, glGetUniformi64vNV, (GLuint program, GLint location, GLint64EXT *params), (program, location, params))
+GL_PROC_VOID(2721, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GL_PROC_VOID(2722, glUniform3uiEXT, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GL_PROC_VOID(2723, glGetProgramLocalParameterdvARB, (GLenum target, GLuint index, GLdouble *params), (target, index, params))
+GL_PROC_VOID(2724, glWindowPos2dMESA, (GLdouble x, GLdouble y), (x, y))
+GL_PROC_VOID(2725, glMultiTexCoord2ivARB, (GLenum target, const GLint *v), (target, v))
+GL_PROC_VOID(2726, glRasterPos4f, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GL_PROC_VOID(2727, glMatrixMode, (GLenum mode), (mode))
+GL_PROC_VOID(2728, glLightEnviSGIX, (GLenum pname, GLint param), (pname, param))
+GL_PROC_VOID(2729, glClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data))
+GL_PROC_VOID(2730, glFogCoordd, (GLdouble coord), (coord))
+GL_PROC_VOID(2731, glMakeTextureHandleNonResidentARB, (GLuint64 handle), (handle))
+GL_PROC_VOID(2732, glEnableVertexAttribAPPLE, (GLuint index, GLenum pname), (index, pname))
+GL_PROC_VOID(2733, glPopName, (void), ())
+GL_PROC(2734, GLboolean, glUnmapNamedBuffer, (GLuint buffer), (buffer))
+GL_PROC(2735, GLenum, glVideoCaptureNV, (GLuint video_capture_slot, GLuint *sequence_num, GLuint64EXT *capture_time), (video_capture_slot, sequence_num, capture_time))
+GL_PROC_VOID(2736, glWindowPos2iARB, (GLint x, GLint y), (x, y))
+GL_PROC_VOID(2737, glSecondaryColor3ubv, (const GLubyte *v), (v))
+GL_PROC_VOID(2738, glGetQueryBufferObjectui64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GL_PROC_VOID(2739, glMultiTexCoord2xvOES, (GLenum texture, const GLfixed *coords), (texture, coords))
+GL_PROC_VOID(2740, glFragmentMaterialfSGIX, (GLenum face, GLenum pname, GLfloat param), (face, pname, param))
+GL_PROC_VOID(2741, glProgramUniform2uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GL_PROC(2742, GLboolean, glUnmapBuffer, (GLenum target), (target))
+GL_PROC_VOID(2743, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_PROC_VOID(2744, glGetOcclusionQueryuivNV, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GL_PROC_VOID(2745, glGetActiveAttribARB, (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name), (programObj, index, maxLength, length, size, type, name))
+GL_PROC_VOID(2746, glFragmentLightModelfvSGIX, (GLenum pname, const GLfloat *params), (pname, params))
+GL_PROC_VOID(2747, glTexCoordP4ui, (GLenum type, GLuint coords), (type, coords))
+GL_PROC_VOID(2748, glProgramUniformMatrix2x4dvEXT, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2749, glClearColorxOES, (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2750, glMapGrid2xOES, (GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2), (n, u1, u2, v1, v2))
+GL_PROC_VOID(2751, glUniform2ui64ARB, (GLint location, GLuint64 x, GLuint64 y), (location, x, y))
+GL_PROC_VOID(2752, glUniform2ivARB, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROC_VOID(2753, glUniformMatrix4fvARB, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(2754, glVertexAttribL1dvEXT, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(2755, glSecondaryColor3ivEXT, (const GLint *v), (v))
+GL_PROC_VOID(2756, glVertexAttrib4NubvARB, (GLuint index, const GLubyte *v), (index, v))
+GL_PROC_VOID(2757, glEvalCoord2dv, (const GLdouble *u), (u))
+GL_PROC_VOID(2758, glGetnHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GL_PROC_VOID(2759, glGetMultiTexParameterIivEXT, (GLenum texunit, GLenum target, GLenum pname, GLint *params), (texunit, target, pname, params))
+GL_PROC_VOID(2760, glTexCoord1sv, (const GLshort *v), (v))
+GL_PROC_VOID(2761, glUniform2i64vARB, (GLint location, GLsizei count, const GLint64 *value), (location, count, value))
+GL_PROC_VOID(2762, glProgramUniform1iEXT, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GL_PROC(2763, GLboolean, glIsEnabled, (GLenum cap), (cap))
+GL_PROC_VOID(2764, glVertexAttribDivisorARB, (GLuint index, GLuint divisor), (index, divisor))
+GL_PROC_VOID(2765, glProgramUniform2dvEXT, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(2766, glVertexStream2fATI, (GLenum stream, GLfloat x, GLfloat y), (stream, x, y))
+GL_PROC_VOID(2767, glCoverageModulationTableNV, (GLsizei n, const GLfloat *v), (n, v))
+GL_PROC_VOID(2768, glLightxvOES, (GLenum light, GLenum pname, const GLfixed *params), (light, pname, params))
+GL_PROC_VOID(2769, glNormalP3ui, (GLenum type, GLuint coords), (type, coords))
+GL_PROC_VOID(2770, glMatrixTranslatedEXT, (GLenum mode, GLdouble x, GLdouble y, GLdouble z), (mode, x, y, z))
+GL_PROC_VOID(2771, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GL_PROC_VOID(2772, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_PROC_VOID(2773, glGetPointerv, (GLenum pname, GLvoid **params), (pname, params))
+GL_PROC_VOID(2774, glClientWaitSemaphoreui64NVX, (GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray), (fenceObjectCount, semaphoreArray, fenceValueArray))
+GL_PROC_VOID(2775, glUniform1ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GL_PROC_VOID(2776, glTexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GL_PROC_VOID(2777, glMultiTexCoord3iARB, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r))
+GL_PROC_VOID(2778, glBufferParameteriAPPLE, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROC_VOID(2779, glTexCoord2fVertex3fvSUN, (const GLfloat *tc, const GLfloat *v), (tc, v))
+GL_PROC(2780, void *, glMapNamedBufferRangeEXT, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GL_PROC_VOID(2781, glTexCoord4sv, (const GLshort *v), (v))
+GL_PROC_VOID(2782, glFramebufferTextureFaceEXT, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face), (target, attachment, texture, level, face))
+GL_PROC_VOID(2783, glColor3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2784, glMultiTexCoord4bOES, (GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q), (texture, s, t, r, q))
+GL_PROC_VOID(2785, glGetFenceivNV, (GLuint fence, GLenum pname, GLint *params), (fence, pname, params))
+GL_PROC_VOID(2786, glSampleMapATI, (GLuint dst, GLuint interp, GLenum swizzle), (dst, interp, swizzle))
+GL_PROC_VOID(2787, glProgramUniform4ui64vNV, (GLuint program, GLint location, GLsizei count, const GLuint64EXT *value), (program, location, count, value))
+GL_PROC_VOID(2788, glPrioritizeTexturesEXT, (GLsizei n, const GLuint *textures, const GLclampf *priorities), (n, textures, priorities))
+GL_PROC_VOID(2789, glEnd, (void), ())
+GL_PROC_VOID(2790, glPixelTexGenParameterivSGIS, (GLenum pname, const GLint *params), (pname, params))
+GL_PROC_VOID(2791, glBindTransformFeedback, (GLenum target, GLuint id), (target, id))
+GL_PROC_VOID(2792, glNamedFramebufferTexture1DEXT, (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (framebuffer, attachment, textarget, texture, level))
+GL_PROC_VOID(2793, glWindowPos3fvMESA, (const GLfloat *v), (v))
+GL_PROC_VOID(2794, glMultiTexCoordPointerEXT, (GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer), (texunit, size, type, stride, pointer))
+GL_PROC_VOID(2795, glTangent3iEXT, (GLint tx, GLint ty, GLint tz), (tx, ty, tz))
+GL_PROC_VOID(2796, glClearNamedBufferSubData, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GL_PROC_VOID(2797, glSemaphoreParameterui64vEXT, (GLuint semaphore, GLenum pname, const GLuint64 *params), (semaphore, pname, params))
+GL_PROC_VOID(2798, glPixelTransformParameterfvEXT, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2799, glGetnUniformivARB, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GL_PROC_VOID(2800, glWindowPos2sv, (const GLshort *v), (v))
+GL_PROC_VOID(2801, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROC_VOID(2802, glGetFloatv, (GLenum pname, GLfloat *params), (pname, params))
+GL_PROC_VOID(2803, glClearNamedFramebufferfi, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+GL_PROC_VOID(2804, glTextureStorage1DEXT, (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (texture, target, levels, internalformat, width))
+GL_PROC_VOID(2805, glVertexAttribs2dvNV, (GLuint index, GLsizei count, const GLdouble *v), (index, count, v))
+GL_PROC_VOID(2806, glMultiTexParameterfEXT, (GLenum texunit, GLenum target, GLenum pname, GLfloat param), (texunit, target, pname, param))
+GL_PROC(2807, GLboolean, glIsVertexArrayAPPLE, (GLuint array), (array))
+GL_PROC_VOID(2808, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROC_VOID(2809, glProgramUniform2dEXT, (GLuint program, GLint location, GLdouble x, GLdouble y), (program, location, x, y))
+GL_PROC_VOID(2810, glBindImageTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GL_PROC_VOID(2811, glDisableVertexAttribAPPLE, (GLuint index, GLenum pname), (index, pname))
+GL_PROC_VOID(2812, glFogCoordhNV, (GLhalfNV fog), (fog))
+GL_PROC_VOID(2813, glGetVertexArrayIntegervEXT, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GL_PROC_VOID(2814, glPresentFrameKeyedNV, (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1), (video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1))
+GL_PROC_VOID(2815, glPopDebugGroup, (void), ())
+GL_PROC_VOID(2816, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GL_PROC_VOID(2817, glGetVertexAttribivARB, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROC_VOID(2818, glDepthMask, (GLboolean flag), (flag))
+GL_PROC_VOID(2819, glMultiTexCoord4fARB, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q))
+GL_PROC(2820, GLenum, glGetError, (void), ())
+GL_PROC_VOID(2821, glCompileShaderIncludeARB, (GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length), (shader, count, path, length))
+GL_PROC_VOID(2822, glBindFramebufferEXT, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GL_PROC_VOID(2823, glVertexAttribI1uivEXT, (GLuint index, const GLuint *v), (index, v))
+GL_PROC_VOID(2824, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GL_PROC_VOID(2825, glLightModelxvOES, (GLenum pname, const GLfixed *param), (pname, param))
+GL_PROC_VOID(2826, glTangent3svEXT, (const GLshort *v), (v))
+GL_PROC_VOID(2827, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GL_PROC_VOID(2828, glProgramUniform3dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GL_PROC_VOID(2829, glUniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GL_PROC(2830, GLuint, glGetDebugMessageLogAMD, (GLuint count, GLsizei bufsize, GLenum *categories, GLuint *severities, GLuint *ids, GLsizei *lengths, GLchar *message), (count, bufsize, categories, severities, ids, lengths, message))
+GL_PROC_VOID(2831, glTransformFeedbackAttribsNV, (GLsizei count, const GLint *attribs, GLenum bufferMode), (count, attribs, bufferMode))
+GL_PROC_VOID(2832, glGetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name))
+GL_PROC_VOID(2833, glTexStorageMem3DMultisampleEXT, (GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset), (target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset))
+GL_PROC(2834, GLuint, glGetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GL_PROC_VOID(2835, glGetnUniformuiv, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GL_PROC_VOID(2836, glVertex3fv, (const GLfloat *v), (v))
+GL_PROC_VOID(2837, glMultiTexCoord4iARB, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q))
+GL_PROC(2838, GLint, glGetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GL_PROC_VOID(2839, glWindowPos4fMESA, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w))
+GL_PROC_VOID(2840, glGetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GL_PROC_VOID(2841, glProgramBufferParametersfvNV, (GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat *params), (target, bindingIndex, wordIndex, count, params))
+GL_PROC_VOID(2842, glWeightsvARB, (GLint size, const GLshort *weights), (size, weights))
+GL_PROC_VOID(2843, glVariantArrayObjectATI, (GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset), (id, type, stride, buffer, offset))
+GL_PROC_VOID(2844, glUniform2i64ARB, (GLint location, GLint64 x, GLint64 y), (location, x, y))
+GL_PROC_VOID(2845, glProgramParameters4dvNV, (GLenum target, GLuint index, GLsizei count, const GLdouble *v), (target, index, count, v))
+GL_PROC_VOID(2846, glNormalStream3svATI, (GLenum stream, const GLshort *coords), (stream, coords))
+GL_PROC_VOID(2847, glProgramUniformMatrix3x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2848, glPixelStoref, (GLenum pname, GLfloat param), (pname, param))
+GL_PROC_VOID(2849, glDrawBuffersATI, (GLsizei n, const GLenum *bufs), (n, bufs))
+GL_PROC_VOID(2850, glPolygonStipple, (const GLubyte *mask), (mask))
+GL_PROC_VOID(2851, glDisableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+GL_PROC_VOID(2852, glLGPUInterlockNVX, (void), ())
+GL_PROC_VOID(2853, glUniform3ui64vNV, (GLint location, GLsizei count, const GLuint64EXT *value), (location, count, value))
+GL_PROC(2854, GLfloat, glGetPathLengthNV, (GLuint path, GLsizei startSegment, GLsizei numSegments), (path, startSegment, numSegments))
+GL_PROC_VOID(2855, glWindowPos2ivMESA, (const GLint *v), (v))
+GL_PROC_VOID(2856, glGetIntegerv, (GLenum pname, GLint *params), (pname, params))
+GL_PROC_VOID(2857, glMultiTexCoord1hNV, (GLenum target, GLhalfNV s), (target, s))
+GL_PROC_VOID(2858, glTexCoord3dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2859, glFramebufferTexture1DEXT, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_PROC_VOID(2860, glCallLists, (GLsizei n, GLenum type, const GLvoid *lists), (n, type, lists))
+GL_PROC_VOID(2861, glPixelMapuiv, (GLenum map, GLsizei mapsize, const GLuint *values), (map, mapsize, values))
+GL_PROC_VOID(2862, glPassThroughxOES, (GLfixed token), (token))
+GL_PROC_VOID(2863, glStartInstrumentsSGIX, (void), ())
+GL_PROC_VOID(2864, glTexCoord3sv, (const GLshort *v), (v))
+GL_PROC_VOID(2865, glCopyTextureSubImage1DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, target, level, xoffset, x, y, width))
+GL_PROC_VOID(2866, glVertexAttribL2dv, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(2867, glMakeImageHandleResidentNV, (GLuint64 handle, GLenum access), (handle, access))
+GL_PROC_VOID(2868, glUniform2uiEXT, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GL_PROC_VOID(2869, glProgramUniform2i64NV, (GLuint program, GLint location, GLint64EXT x, GLint64EXT y), (program, location, x, y))
+GL_PROC_VOID(2870, glColor3ub, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue))
+GL_PROC_VOID(2871, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GL_PROC_VOID(2872, glVariantusvEXT, (GLuint id, const GLushort *addr), (id, addr))
+GL_PROC_VOID(2873, glListParameterivSGIX, (GLuint list, GLenum pname, const GLint *params), (list, pname, params))
+GL_PROC_VOID(2874, glGlobalAlphaFactorusSUN, (GLushort factor), (factor))
+GL_PROC_VOID(2875, glVertex4bvOES, (const GLbyte *coords), (coords))
+GL_PROC_VOID(2876, glEnableVertexArrayEXT, (GLuint vaobj, GLenum array), (vaobj, array))
+GL_PROC_VOID(2877, glReadnPixelsARB, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GL_PROC_VOID(2878, glTexCoordPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr))
+GL_PROC_VOID(2879, glVertexStream2dvATI, (GLenum stream, const GLdouble *coords), (stream, coords))
+GL_PROC_VOID(2880, glVertex2dv, (const GLdouble *v), (v))
+GL_PROC_VOID(2881, glMultiTexImage3DEXT, (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (texunit, target, level, internalformat, width, height, depth, border, format, type, pixels))
+GL_PROC_VOID(2882, glNamedFramebufferReadBuffer, (GLuint framebuffer, GLenum src), (framebuffer, src))
+GL_PROC_VOID(2883, glMapGrid2f, (GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2), (un, u1, u2, vn, v1, v2))
+GL_PROC_VOID(2884, glProgramUniform3d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+GL_PROC_VOID(2885, glProgramUniformMatrix2x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GL_PROC_VOID(2886, glGetProgramStringNV, (GLuint id, GLenum pname, GLubyte *program), (id, pname, program))
+GL_PROC_VOID(2887, glPathFogGenNV, (GLenum genMode), (genMode))
+GL_PROC_VOID(2888, glMulticastCopyBufferSubDataNV, (GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size))
+GL_PROC_VOID(2889, glTessellationModeAMD, (GLenum mode), (mode))
+GL_PROC_VOID(2890, glNamedFramebufferTextureFaceEXT, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face), (framebuffer, attachment, texture, level, face))
+GL_PROC_VOID(2891, glVertex4s, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w))
+GL_PROC_VOID(2892, glDebugMessageControlARB, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GL_PROC_VOID(2893, glProgramUniform4fvEXT, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GL_PROC_VOID(2894, glGetConvolutionParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROC_VOID(2895, glVertexAttribIPointerEXT, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_PROC_VOID(2896, glVertexBlendARB, (GLint count), (count))
+GL_PROC_VOID(2897, glDisableVertexArrayAttribEXT, (GLuint vaobj, GLuint index), (vaobj, index))
+GL_PROC(2898, GLuint, glCreateShader, (GLenum type), (type))
+GL_PROC_VOID(2899, glSampleCoverageARB, (GLfloat value, GLboolean invert), (value, invert))
+GL_PROC_VOID(2900, glGetNamedProgramLocalParameterIivEXT, (GLuint program, GLenum target, GLuint index, GLint *params), (program, target, index, params))
+GL_PROC_VOID(2901, glTexCoordP1ui, (GLenum type, GLuint coords), (type, coords))
+GL_PROC_VOID(2902, glVertexAttribLFormatNV, (GLuint index, GLint size, GLenum type, GLsizei stride), (index, size, type, stride))
+GL_PROC_VOID(2903, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GL_PROC_VOID(2904, glIndexf, (GLfloat c), (c))
+GL_PROC_VOID(2905, glMulticastViewportArrayvNVX, (GLuint gpu, GLuint first, GLsizei count, const GLfloat *v), (gpu, first, count, v))
+GL_PROC_VOID(2906, glGetNamedStringARB, (GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string), (namelen, name, bufSize, stringlen, string))
+GL_PROC_VOID(2907, glVertexPointer, (GLint size, GLenum type, GLsizei stride, const GLvoid *ptr), (size, type, stride, ptr))
+GL_PROC_VOID(2908, glGetTexParameterPointervAPPLE, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GL_PROC_VOID(2909, glVertexAttrib4sARB, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GL_PROC_VOID(2910, glVertexAttrib2sNV, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GL_PROC_VOID(2911, glTexturePageCommitmentEXT, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit), (texture, level, xoffset, yoffset, zoffset, width, height, depth, commit))
+GL_PROC_VOID(2912, glGenTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROC_VOID(2913, glClipControl, (GLenum origin, GLenum depth), (origin, depth))
+GL_PROC_VOID(2914, glColor3xOES, (GLfixed red, GLfixed green, GLfixed blue), (red, green, blue))
+GL_PROC_VOID(2915, glGetnPixelMapuiv, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GL_PROC_VOID(2916, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GL_PROC_VOID(2917, glFinalCombinerInputNV, (GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage), (variable, input, mapping, componentUsage))
+GL_PROC_VOID(2918, glFramebufferTextureMultiviewOVR, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews), (target, attachment, texture, level, baseViewIndex, numViews))
+GL_PROC_VOID(2919, glListParameterfvSGIX, (GLuint list, GLenum pname, const GLfloat *params), (list, pname, params))
+GL_PROC_VOID(2920, glTranslatexOES, (GLfixed x, GLfixed y, GLfixed z), (x, y, z))
+GL_PROC_VOID(2921, glSetInvariantEXT, (GLuint id, GLenum type, const void *addr), (id, type, addr))
+GL_PROC_VOID(2922, glBitmap, (GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap))
+GL_PROC_VOID(2923, glMultiTexCoord4bvOES, (GLenum texture, const GLbyte *coords), (texture, coords))
+GL_PROC_VOID(2924, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_PROC_VOID(2925, glVertexAttribL4i64NV, (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (index, x, y, z, w))
+GL_PROC(2926, void *, glMapTexture2DINTEL, (GLuint texture, GLint level, GLbitfield access, GLint *stride, GLenum *layout), (texture, level, access, stride, layout))
+GL_PROC_VOID(2927, glVertexAttrib3dvNV, (GLuint index, const GLdouble *v), (index, v))
+GL_PROC_VOID(2928, glMultiTexCoord2s, (GLenum target, GLshort s, GLshort t), (target, s, t))
+GL_PROC_VOID(2929, glWindowPos2ivARB, (const GLint *v), (v))
+GL_PROC_VOID(2930, glColorMaskIndexedEXT, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GL_PROC_VOID(2931, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GL_PROC_VOID(2932, glMultMatrixd, (const GLdouble *m), (m))
+GL_PROC_VOID(2933, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROC_VOID(2934, glUniform4i64NV, (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w), (location, x, y, z, w))
+GL_PROC_VOID(2935, glBlendEquationIndexedAMD, (GLuint buf, GLenum mode), (buf, mode))
+GL_PROC_VOID(2936, glProgramNamedParameter4dNV, (GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (id, len, name, x, y, z, w))
+GL_PROC_VOID(2937, glTextureStorage2DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+GL_PROC_VOID(2938, glClearTexImage, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data))
+GL_PROC_VOID(2939, glFragmentLightfSGIX, (GLenum light, GLenum pname, GLfloat param), (light, pname, param))
+GL_PROC_VOID(2940, glGetProgramLocalParameterIuivNV, (GLenum target, GLuint index, GLuint *params), (target, index, params))
+GL_PROC_VOID(2941, glMultiTexCoord2sv, (GLenum target, const GLshort *v), (target, v))
+GL_PROC_VOID(2942, glCopyConvolutionFilter1DEXT, (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width), (target, internalformat, x, y, width))
+GL_PROC_VOID(2943, glDeleteMemoryObjectsEXT, (GLsizei n, const GLuint *memoryObjects), (n, memoryObjects))
+GL_PROC_VOID(2944, glVertexStream3fvATI, (GLenum stream, const GLfloat *coords), (stream, coords))
+GL_PROC_VOID(2945, glIndexMaterialEXT, (GLenum face, GLenum mode), (face, mode))
+GL_PROC_VOID(2946, glDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+GL_PROC_VOID(2947, glImportMemoryFdEXT, (GLuint memory, GLuint64 size, GLenum handleType, GLint fd), (memory, size, handleType, fd))
+GL_PROC_VOID(2948, glMultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GL_PROC_VOID(2949, glMultiTexCoord1dv, (GLenum target, const GLdouble *v), (target, v))
+GL_PROC_VOID(2950, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_PROC_VOID(2951, glCompressedTextureSubImage3DEXT, (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits), (texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits))
+GL_PROC_VOID(2952, glDrawCommandsStatesNV, (GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count), (buffer, indirects, sizes, states, fbos, count))
+GL_PROC_VOID(2953, glGenFencesAPPLE, (GLsizei n, GLuint *fences), (n, fences))
+GL_PROC_VOID(2954, glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GL_PROC_VOID(2955, glGetConvolutionParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROC_VOID(2956, glPatchParameteri, (GLenum pname, GLint value), (pname, value))
+GL_PROC_VOID(2957, glColorTableParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROC_VOID(2958, glMulticastGetQueryObjectuivNV, (GLuint gpu, GLuint id, GLenum pname, GLuint *params), (gpu, id, pname, params))
+GL_PROC_VOID(2959, glLineWidthxOES, (GLfixed width), (width))
+GL_PROC(2960, GLuint64, glGetTextureHandleARB, (GLuint texture), (texture))
+GL_PROC_VOID(2961, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GL_PROC_VOID(2962, glColor4ubVertex3fSUN, (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z), (r, g, b, a, x, y, z))
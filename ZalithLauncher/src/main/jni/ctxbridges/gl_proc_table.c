@@ -0,0 +1,69 @@
+//
+// Perfect hash lookup of GL entry points, see gl_proc_table.h
+//
+
+#include <android/log.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "gl_proc_table.h"
+#include "gl_proc_cache.h"
+#include "gl_proc_names.h"
+
+static const char* g_LogTag = "GLProcTable";
+void* gl_proc_addresses[GL_PROC_COUNT];
+static pthread_once_t g_ResolveOnce = PTHREAD_ONCE_INIT;
+static gl_proc_resolver_t g_Resolver;
+
+// FNV-1a, must match hash_name() in gen_gl_proc_names.py
+static uint32_t gl_proc_hash(const char* name, uint32_t seed) {
+    uint32_t hash = 0x811c9dc5u ^ seed;
+    for (const unsigned char* c = (const unsigned char*) name; *c; c++) hash = (hash ^ *c) * 0x01000193u;
+    return hash;
+}
+
+int gl_proc_table_count() {
+    return GL_PROC_COUNT;
+}
+
+const char* gl_proc_table_name(int slot) {
+    return gl_proc_names[slot];
+}
+
+int gl_proc_table_slot(const char* name) {
+    int32_t displacement = gl_proc_displacements[gl_proc_hash(name, 0) % GL_PROC_COUNT];
+    uint32_t slot = displacement < 0 ? (uint32_t) (-displacement - 1)
+                                     : gl_proc_hash(name, (uint32_t) displacement) % GL_PROC_COUNT;
+    // Names that aren't in the table land on some slot too
+    return strcmp(gl_proc_names[slot], name) == 0 ? (int) slot : -1;
+}
+
+static void gl_proc_table_resolve() {
+    struct timespec start, end;
+    int resolved = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    // Offsets are relative to the library glGetString() comes from
+    gl_proc_cache_t cache;
+    bool hasCache = gl_proc_cache_open(&cache, g_Resolver("glGetString"));
+    if (hasCache && gl_proc_cache_load(&cache, gl_proc_names, gl_proc_addresses, GL_PROC_COUNT, GL_PROC_TABLE_HASH, g_Resolver)) {
+        hasCache = false;
+    } else {
+        for (int slot = 0; slot < GL_PROC_COUNT; slot++) gl_proc_addresses[slot] = g_Resolver(gl_proc_names[slot]);
+    }
+    for (int slot = 0; slot < GL_PROC_COUNT; slot++) if (gl_proc_addresses[slot]) resolved++;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Resolved %d of %d GL entry points in %ld us", resolved, GL_PROC_COUNT,
+                        (long) ((end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000));
+    // Only written after a full resolution, a loaded cache is up to date already
+    if (hasCache) gl_proc_cache_store(&cache, gl_proc_addresses, GL_PROC_COUNT, GL_PROC_TABLE_HASH);
+}
+
+void* gl_proc_table_get(const char* name, gl_proc_resolver_t resolver, int* slot) {
+    *slot = gl_proc_table_slot(name);
+    if (*slot < 0) return NULL;
+    g_Resolver = resolver;
+    pthread_once(&g_ResolveOnce, gl_proc_table_resolve);
+    return gl_proc_addresses[*slot];
+}
@@ -0,0 +1,31 @@
+//
+// Table of every GL entry point from GL/gl.h and GL/glext.h, resolved in one pass.
+//
+// LWJGL asks pojavGetProcAddress() for thousands of names when it creates GLCapabilities.
+// Instead of going through the dynamic linker for each of them, the whole table is resolved the
+// first time it is used, and names are found with a perfect hash (see gen_gl_proc_names.py).
+//
+
+#ifndef POJAVLAUNCHER_GL_PROC_TABLE_H
+#define POJAVLAUNCHER_GL_PROC_TABLE_H
+
+#include <stdbool.h>
+
+typedef void* (*gl_proc_resolver_t)(const char* name);
+
+/* Resolved entry points by slot, filled by the first gl_proc_table_get() */
+extern void* gl_proc_addresses[];
+
+int gl_proc_table_count();
+const char* gl_proc_table_name(int slot);
+
+/** @return the slot of `name` in the table, -1 if it isn't a GL entry point from the headers */
+int gl_proc_table_slot(const char* name);
+
+/**
+ * Look `name` up, resolving the whole table with `resolver` on the first call.
+ * @param slot set to the slot of `name`, -1 if it isn't in the table: the caller has to resolve it itself then
+ */
+void* gl_proc_table_get(const char* name, gl_proc_resolver_t resolver, int* slot);
+
+#endif //POJAVLAUNCHER_GL_PROC_TABLE_H
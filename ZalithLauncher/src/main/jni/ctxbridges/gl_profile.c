@@ -0,0 +1,195 @@
+//
+// GL call profiling wrappers, see gl_profile.h
+//
+
+#include <android/log.h>
+#include <jni.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GL/gl.h>
+
+#include "gl_profile.h"
+#include "gl_proc_table.h"
+
+#define DEFAULT_SUMMARY_FRAMES 60
+#define SUMMARY_TOP 3
+
+static const char* g_LogTag = "GLProfile";
+
+/* Counters of one thread, only ever written by that thread */
+typedef struct gl_profile_thread_s {
+    struct gl_profile_thread_s* next;
+    uint64_t* calls;
+    uint64_t* ns;
+    uint64_t* summaryNs; // ns as of the last frame summary
+    uint64_t totalCalls, totalNs;
+    uint64_t summaryCalls, summaryTotalNs, summaryTime;
+    unsigned frames;
+} gl_profile_thread_t;
+
+static bool g_Enabled;
+static unsigned g_SummaryFrames;
+static _Atomic(gl_profile_thread_t*) g_Threads;
+static __thread gl_profile_thread_t* t_Thread;
+
+// Both this and gl_profile_count() are kept out of line, they would be copied into thousands of wrappers otherwise
+static __attribute__((noinline)) uint64_t gl_profile_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+static gl_profile_thread_t* gl_profile_thread() {
+    if (t_Thread) return t_Thread;
+    int count = gl_proc_table_count();
+    gl_profile_thread_t* thread = calloc(1, sizeof(gl_profile_thread_t));
+    uint64_t* counters = calloc(3 * (size_t) count, sizeof(uint64_t));
+    if (thread == NULL || counters == NULL) abort();
+    thread->calls = counters;
+    thread->ns = counters + count;
+    thread->summaryNs = counters + 2 * count;
+    thread->summaryTime = gl_profile_now();
+    // Threads are never unlinked, the list only grows by the few threads that use GL
+    thread->next = atomic_load_explicit(&g_Threads, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&g_Threads, &thread->next, thread, memory_order_release, memory_order_relaxed));
+    t_Thread = thread;
+    return thread;
+}
+
+static __attribute__((noinline)) void gl_profile_count(int slot, uint64_t start) {
+    uint64_t elapsed = gl_profile_now() - start;
+    gl_profile_thread_t* thread = gl_profile_thread();
+    thread->calls[slot]++;
+    thread->ns[slot] += elapsed;
+    thread->totalCalls++;
+    thread->totalNs += elapsed;
+}
+
+// The locals have a prefix, as some entry points have parameters named start or result
+#define GL_PROC_VOID(slot, name, parameters, arguments) \
+    static void GLAPIENTRY gl_profile_##name parameters { \
+        uint64_t profileStart = gl_profile_now(); \
+        ((void (GLAPIENTRY*) parameters) gl_proc_addresses[slot]) arguments; \
+        gl_profile_count(slot, profileStart); \
+    }
+#define GL_PROC(slot, type, name, parameters, arguments) \
+    static type GLAPIENTRY gl_profile_##name parameters { \
+        uint64_t profileStart = gl_profile_now(); \
+        type profileResult = ((type (GLAPIENTRY*) parameters) gl_proc_addresses[slot]) arguments; \
+        gl_profile_count(slot, profileStart); \
+        return profileResult; \
+    }
+#include "gl_proc_prototypes.h"
+#undef GL_PROC_VOID
+#undef GL_PROC
+
+#define GL_PROC_VOID(slot, name, parameters, arguments) [slot] = (void*) gl_profile_##name,
+#define GL_PROC(slot, type, name, parameters, arguments) [slot] = (void*) gl_profile_##name,
+static void* const g_Wrappers[] = {
+#include "gl_proc_prototypes.h"
+};
+#undef GL_PROC_VOID
+#undef GL_PROC
+
+void gl_profile_init(const char* setting) {
+    if (setting == NULL) return;
+    int frames = atoi(setting);
+    g_SummaryFrames = frames > 0 ? (unsigned) frames : DEFAULT_SUMMARY_FRAMES;
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "GL calls are profiled, summary every %u frames", g_SummaryFrames);
+}
+
+bool gl_profile_enabled() {
+    return g_Enabled;
+}
+
+void* gl_profile_wrap(int slot) {
+    return g_Wrappers[slot];
+}
+
+/** Indices of the `top` largest values of `values`, largest first. @return how many were found */
+static int gl_profile_top(const uint64_t* values, int count, int* top, int topCount) {
+    int found = 0;
+    for (int slot = 0; slot < count; slot++) {
+        if (values[slot] == 0) continue;
+        if (found == topCount && values[slot] <= values[top[topCount - 1]]) continue;
+        int position = found < topCount ? found++ : topCount - 1;
+        while (position > 0 && values[top[position - 1]] < values[slot]) {
+            top[position] = top[position - 1];
+            position--;
+        }
+        top[position] = slot;
+    }
+    return found;
+}
+
+void gl_profile_frame() {
+    gl_profile_thread_t* thread = gl_profile_thread();
+    if (++thread->frames < g_SummaryFrames) return;
+
+    int count = gl_proc_table_count();
+    uint64_t now = gl_profile_now();
+    double frames = thread->frames;
+    for (int slot = 0; slot < count; slot++) thread->summaryNs[slot] = thread->ns[slot] - thread->summaryNs[slot];
+    int top[SUMMARY_TOP];
+    int found = gl_profile_top(thread->summaryNs, count, top, SUMMARY_TOP);
+
+    char topText[256] = "";
+    size_t length = 0;
+    for (int i = 0; i < found && length < sizeof(topText); i++)
+        length += snprintf(topText + length, sizeof(topText) - length, "%s %s %.3f ms", i ? "," : "",
+                           gl_proc_table_name(top[i]), (double) thread->summaryNs[top[i]] / frames / 1e6);
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "%.2f ms/frame, %.0f GL calls taking %.2f ms per frame, top:%s",
+                        (double) (now - thread->summaryTime) / frames / 1e6,
+                        (double) (thread->totalCalls - thread->summaryCalls) / frames,
+                        (double) (thread->totalNs - thread->summaryTotalNs) / frames / 1e6, topText);
+
+    memcpy(thread->summaryNs, thread->ns, count * sizeof(uint64_t));
+    thread->summaryCalls = thread->totalCalls;
+    thread->summaryTotalNs = thread->totalNs;
+    thread->summaryTime = now;
+    thread->frames = 0;
+}
+
+void gl_profile_log_top(int top) {
+    if (!g_Enabled) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Profiling is disabled, set POJAV_GL_PROFILE to enable it");
+        return;
+    }
+    int count = gl_proc_table_count();
+    if (top > count) top = count;
+    if (top <= 0) return;
+    uint64_t* calls = calloc(2 * (size_t) count, sizeof(uint64_t));
+    int* order = calloc((size_t) top, sizeof(int));
+    if (calls == NULL || order == NULL) goto done;
+    uint64_t* ns = calls + count;
+    uint64_t totalNs = 0;
+    // Other threads keep counting meanwhile, the report doesn't have to be exact
+    for (gl_profile_thread_t* thread = atomic_load_explicit(&g_Threads, memory_order_acquire); thread; thread = thread->next) {
+        for (int slot = 0; slot < count; slot++) {
+            calls[slot] += thread->calls[slot];
+            ns[slot] += thread->ns[slot];
+        }
+        totalNs += thread->totalNs;
+    }
+    int found = gl_profile_top(ns, count, order, top);
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Top %d of %.1f ms spent in GL:", found, (double) totalNs / 1e6);
+    for (int i = 0; i < found; i++) {
+        int slot = order[i];
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "%3d. %-40s %10llu calls %10.3f ms %8.3f us/call", i + 1,
+                            gl_proc_table_name(slot), (unsigned long long) calls[slot], (double) ns[slot] / 1e6,
+                            (double) ns[slot] / (double) calls[slot] / 1e3);
+    }
+    done:
+    free(calls);
+    free(order);
+}
+
+JNIEXPORT void JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeLogGLProfile(__attribute__((unused)) JNIEnv* env, __attribute__((unused)) jclass clazz, jint top) {
+    gl_profile_log_top(top);
+}
@@ -0,0 +1,30 @@
+//
+// GL call profiling, enabled with POJAV_GL_PROFILE.
+//
+// pojavGetProcAddress() hands out wrappers (generated from gl_proc_prototypes.h) instead of the
+// driver entry points. Each wrapper counts its calls and the time spent in the driver, in
+// counters that belong to the calling thread. Every POJAV_GL_PROFILE frames (60 if it isn't a
+// number), pojavSwapBuffers() logs a per-frame summary of the swapping thread, and
+// CallbackBridge.nativeLogGLProfile() logs the entry points that took the most time overall.
+//
+
+#ifndef POJAVLAUNCHER_GL_PROFILE_H
+#define POJAVLAUNCHER_GL_PROFILE_H
+
+#include <stdbool.h>
+
+/** Call once, before the first pojavGetProcAddress(). `setting` is the value of POJAV_GL_PROFILE. */
+void gl_profile_init(const char* setting);
+
+bool gl_profile_enabled();
+
+/** @return the profiling wrapper of the entry point in table slot `slot`, it calls gl_proc_addresses[slot] */
+void* gl_profile_wrap(int slot);
+
+/** From pojavSwapBuffers(), before the swap. */
+void gl_profile_frame();
+
+/** Log the `top` entry points that took the most time, summed up over every thread. */
+void gl_profile_log_top(int top);
+
+#endif //POJAVLAUNCHER_GL_PROFILE_H
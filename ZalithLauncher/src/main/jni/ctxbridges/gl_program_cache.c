@@ -0,0 +1,557 @@
+//
+// Program binary cache, see gl_program_cache.h
+//
+
+#include <android/log.h>
+#include <fcntl.h>
+#include <jni.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <GL/gl.h>
+
+#include "gl_program_cache.h"
+
+#define GL_PROGRAM_CACHE_MAGIC 0x42504C47 // "GLPB"
+#define GL_PROGRAM_CACHE_VERSION 1
+#define GL_PROGRAM_CACHE_FILE "gl_program_binaries.bin"
+// Binaries aren't stored anymore once the file is this large
+#define GL_PROGRAM_CACHE_MAX_SIZE (64 << 20)
+#define MAX_SHADERS 8
+#define HASH_SEED 0xCBF29CE484222325ull
+/* Low bit of the values of the shader and program maps, the rest is a hash */
+#define SHADER_DEFERRED 1
+#define PROGRAM_UNCACHEABLE 1
+/* Kinds of bindings that go into the key of a program */
+#define BINDING_ATTRIBUTE 1
+#define BINDING_FRAG_DATA 2
+
+static const char* g_LogTag = "GLProgramCache";
+
+typedef struct {
+    uint32_t magic, version;
+    uint64_t driverHash;
+} gl_program_cache_header_t;
+
+/* Followed by `shaderCount` uint64_t shader hashes, then `length` bytes of binary padded to 8 bytes */
+typedef struct {
+    uint64_t key;
+    uint32_t format, length, checksum, shaderCount;
+} gl_program_record_t;
+
+/* Open addressing, key 0 is a free entry */
+typedef struct {
+    struct { uint64_t key, value; }* entries;
+    uint32_t capacity, count;
+} gl_program_map_t;
+
+typedef struct gl_program_group_s {
+    struct gl_program_group_s* next;
+    const void* shareGroup;
+    gl_program_map_t shaders;  // name -> source hash << 1 | SHADER_DEFERRED, 0 if the source is unknown
+    gl_program_map_t programs; // name -> binding hash << 1 | PROGRAM_UNCACHEABLE
+} gl_program_group_t;
+
+enum { CACHE_UNLOADED, CACHE_READY, CACHE_UNUSABLE };
+
+static bool g_Enabled;
+static char g_Path[PATH_MAX];
+static gl_proc_resolver_t g_Resolver;
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_State = CACHE_UNLOADED;
+static int g_Fd = -1;
+static size_t g_FileSize;
+static gl_program_map_t g_Records;      // program key -> gl_program_record_t*
+static gl_program_map_t g_KnownShaders; // hash of a source that compiled -> 1
+static gl_program_group_t* g_Groups;
+static __thread gl_program_group_t* t_Group;
+static atomic_ulong g_Hits, g_Misses, g_Rejected, g_Stored, g_Deferred;
+
+/* What the wrappers call */
+static PFNGLCREATESHADERPROC g_CreateShader;
+static PFNGLSHADERSOURCEPROC g_ShaderSource;
+static PFNGLCOMPILESHADERPROC g_CompileShader;
+static PFNGLGETSHADERIVPROC g_GetShaderiv;
+static PFNGLCREATEPROGRAMPROC g_CreateProgram;
+static PFNGLBINDATTRIBLOCATIONPROC g_BindAttribLocation;
+static PFNGLBINDFRAGDATALOCATIONPROC g_BindFragDataLocation;
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC g_TransformFeedbackVaryings;
+static PFNGLPROGRAMPARAMETERIPROC g_ProgramParameteri;
+static PFNGLLINKPROGRAMPROC g_LinkProgram;
+/* What the cache calls by itself, from the resolver */
+static const GLubyte* (GLAPIENTRY* g_GetString)(GLenum name);
+static void (GLAPIENTRY* g_GetIntegerv)(GLenum pname, GLint* data);
+static PFNGLGETPROGRAMIVPROC g_GetProgramiv;
+static PFNGLGETATTACHEDSHADERSPROC g_GetAttachedShaders;
+static PFNGLGETPROGRAMBINARYPROC g_GetProgramBinary;
+static PFNGLPROGRAMBINARYPROC g_ProgramBinary;
+static PFNGLPROGRAMPARAMETERIPROC g_SetProgramParameter;
+
+static uint64_t gl_program_hash(uint64_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < length; i++) hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    return hash;
+}
+
+/** @return where the value of `key` is, NULL if it isn't there and `insert` is false (or the map can't grow) */
+static uint64_t* gl_program_map_find(gl_program_map_t* map, uint64_t key, bool insert) {
+    if (insert && (map->count + 1) * 2 > map->capacity) {
+        uint32_t capacity = map->capacity ? map->capacity * 2 : 64;
+        gl_program_map_t grown = { calloc(capacity, sizeof(map->entries[0])), capacity, 0 };
+        if (grown.entries == NULL) return NULL;
+        for (uint32_t i = 0; i < map->capacity; i++)
+            if (map->entries[i].key != 0) *gl_program_map_find(&grown, map->entries[i].key, true) = map->entries[i].value;
+        free(map->entries);
+        *map = grown;
+    }
+    if (map->capacity == 0) return NULL;
+    uint32_t mask = map->capacity - 1;
+    for (uint32_t i = (uint32_t) ((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;; i = (i + 1) & mask) {
+        if (map->entries[i].key == key) return &map->entries[i].value;
+        if (map->entries[i].key != 0) continue;
+        if (!insert) return NULL;
+        map->entries[i].key = key;
+        map->entries[i].value = 0;
+        map->count++;
+        return &map->entries[i].value;
+    }
+}
+
+static size_t gl_program_record_size(uint32_t shaderCount, uint32_t length) {
+    return sizeof(gl_program_record_t) + shaderCount * sizeof(uint64_t) + (((size_t) length + 7) & ~(size_t) 7);
+}
+
+static const uint8_t* gl_program_record_binary(const gl_program_record_t* record) {
+    return (const uint8_t*) (record + 1) + record->shaderCount * sizeof(uint64_t);
+}
+
+/* The lock is held */
+static void gl_program_cache_index(const gl_program_record_t* record) {
+    uint64_t* value = gl_program_map_find(&g_Records, record->key, true);
+    if (value != NULL) *value = (uintptr_t) record;
+    const uint64_t* shaders = (const uint64_t*) (record + 1);
+    for (uint32_t i = 0; i < record->shaderCount; i++) {
+        value = gl_program_map_find(&g_KnownShaders, shaders[i], true);
+        if (value != NULL) *value = 1;
+    }
+}
+
+static bool gl_program_cache_resolve() {
+    g_GetString = g_Resolver("glGetString");
+    g_GetIntegerv = g_Resolver("glGetIntegerv");
+    g_GetProgramiv = g_Resolver("glGetProgramiv");
+    g_GetAttachedShaders = g_Resolver("glGetAttachedShaders");
+    g_GetProgramBinary = g_Resolver("glGetProgramBinary");
+    g_ProgramBinary = g_Resolver("glProgramBinary");
+    g_SetProgramParameter = g_Resolver("glProgramParameteri");
+    return g_GetString && g_GetIntegerv && g_GetProgramiv && g_GetAttachedShaders && g_GetProgramBinary && g_ProgramBinary;
+}
+
+/* The lock is held, and a context is current */
+static int gl_program_cache_load() {
+    if (!gl_program_cache_resolve()) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "No program binary entry points, the cache is disabled");
+        return CACHE_UNUSABLE;
+    }
+    GLint formats = 0;
+    g_GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "No program binary formats, the cache is disabled");
+        return CACHE_UNUSABLE;
+    }
+    uint64_t driverHash = HASH_SEED;
+    const GLenum strings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    for (size_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        const char* string = (const char*) g_GetString(strings[i]);
+        if (string != NULL) driverHash = gl_program_hash(driverHash, string, strlen(string) + 1);
+    }
+
+    int fd = open(g_Path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    struct stat file;
+    if (fd < 0 || fstat(fd, &file) != 0) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't open %s, the cache is disabled", g_Path);
+        if (fd >= 0) close(fd);
+        return CACHE_UNUSABLE;
+    }
+
+    size_t size = (size_t) file.st_size, valid = 0;
+    gl_program_cache_header_t header;
+    if (size >= sizeof(header) && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+        header.magic == GL_PROGRAM_CACHE_MAGIC && header.version == GL_PROGRAM_CACHE_VERSION &&
+        header.driverHash == driverHash) {
+        // Never unmapped, the index points into it
+        const uint8_t* mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        valid = sizeof(header);
+        while (mapping != MAP_FAILED && valid + sizeof(gl_program_record_t) <= size) {
+            const gl_program_record_t* record = (const gl_program_record_t*) (mapping + valid);
+            // Checked first, so that a corrupt length can't make the size of the record wrap around
+            if (record->shaderCount > MAX_SHADERS || record->length > size - valid) break;
+            size_t recordSize = gl_program_record_size(record->shaderCount, record->length);
+            if (recordSize > size - valid) break;
+            gl_program_cache_index(record);
+            valid += recordSize;
+        }
+        if (valid != size)
+            __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Dropping %zu bytes of an incomplete record", size - valid);
+    } else if (size > 0) {
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Cache invalidated: driver changed");
+    }
+    if (valid == 0) {
+        header = (gl_program_cache_header_t) { GL_PROGRAM_CACHE_MAGIC, GL_PROGRAM_CACHE_VERSION, driverHash };
+        if (ftruncate(fd, 0) != 0 || pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+            __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't write %s, the cache is disabled", g_Path);
+            close(fd);
+            return CACHE_UNUSABLE;
+        }
+        valid = sizeof(header);
+    } else if (valid != size && ftruncate(fd, (off_t) valid) != 0) {
+        close(fd);
+        return CACHE_UNUSABLE;
+    }
+    g_Fd = fd;
+    g_FileSize = valid;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "%u programs cached in %s", g_Records.count, g_Path);
+    return CACHE_READY;
+}
+
+/** @return whether the cache can be used, it is loaded on first use */
+static bool gl_program_cache_ready() {
+    pthread_mutex_lock(&g_Lock);
+    if (g_State == CACHE_UNLOADED) g_State = gl_program_cache_load();
+    bool ready = g_State == CACHE_READY;
+    pthread_mutex_unlock(&g_Lock);
+    return ready;
+}
+
+static void gl_program_cache_store(uint64_t key, const uint64_t* shaders, GLsizei shaderCount, GLuint program) {
+    GLint length = 0;
+    g_GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+    gl_program_record_t* record = calloc(1, gl_program_record_size(shaderCount, length));
+    if (record == NULL) return;
+    memcpy(record + 1, shaders, shaderCount * sizeof(uint64_t));
+    record->shaderCount = shaderCount;
+    uint8_t* binary = (uint8_t*) gl_program_record_binary(record);
+    GLsizei written = 0;
+    GLenum format = 0;
+    g_GetProgramBinary(program, length, &written, &format, binary);
+    if (written <= 0) {
+        free(record);
+        return;
+    }
+    record->key = key;
+    record->format = format;
+    record->length = written;
+    record->checksum = (uint32_t) gl_program_hash(HASH_SEED, binary, written);
+
+    size_t size = gl_program_record_size(shaderCount, written);
+    pthread_mutex_lock(&g_Lock);
+    if (g_FileSize + size <= GL_PROGRAM_CACHE_MAX_SIZE) {
+        if (pwrite(g_Fd, record, size, (off_t) g_FileSize) == (ssize_t) size) {
+            g_FileSize += size;
+            atomic_fetch_add_explicit(&g_Stored, 1, memory_order_relaxed);
+        } else {
+            // Don't leave a partial record for the next ones to be appended to
+            ftruncate(g_Fd, (off_t) g_FileSize);
+        }
+    }
+    // Kept in memory even when the file is full, for the programs relinked in this session
+    gl_program_cache_index(record);
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static bool gl_program_cache_restore(GLuint program, const gl_program_record_t* record) {
+    const uint8_t* binary = gl_program_record_binary(record);
+    if ((uint32_t) gl_program_hash(HASH_SEED, binary, record->length) != record->checksum) return false;
+    g_ProgramBinary(program, record->format, binary, (GLsizei) record->length);
+    GLint linked = GL_FALSE;
+    g_GetProgramiv(program, GL_LINK_STATUS, &linked);
+    return linked == GL_TRUE;
+}
+
+/** @return the key of `program` with `shaders` attached, 0 if it can't be cached. `hashes` gets the sorted shader hashes. */
+static uint64_t gl_program_key(gl_program_group_t* group, GLuint program, const GLuint* shaders, GLsizei count, uint64_t* hashes) {
+    uint64_t bindings = 0;
+    pthread_mutex_lock(&g_Lock);
+    uint64_t* value = gl_program_map_find(&group->programs, program, false);
+    if (value != NULL) bindings = *value;
+    for (GLsizei i = 0; i < count && !(bindings & PROGRAM_UNCACHEABLE); i++) {
+        value = gl_program_map_find(&group->shaders, shaders[i], false);
+        // A shader whose source didn't go through glShaderSource() here
+        if (value == NULL || *value == 0) bindings |= PROGRAM_UNCACHEABLE;
+        else hashes[i] = *value >> 1;
+    }
+    pthread_mutex_unlock(&g_Lock);
+    if (count == 0 || (bindings & PROGRAM_UNCACHEABLE)) return 0;
+
+    // glGetAttachedShaders() has no particular order
+    for (GLsizei i = 1; i < count; i++)
+        for (GLsizei j = i; j > 0 && hashes[j - 1] > hashes[j]; j--) {
+            uint64_t swap = hashes[j];
+            hashes[j] = hashes[j - 1];
+            hashes[j - 1] = swap;
+        }
+    uint64_t key = gl_program_hash(HASH_SEED, hashes, count * sizeof(uint64_t));
+    key = gl_program_hash(key, &bindings, sizeof(bindings));
+    return key != 0 ? key : 1;
+}
+
+static void gl_program_cache_compile_deferred(gl_program_group_t* group, const GLuint* shaders, GLsizei count) {
+    for (GLsizei i = 0; i < count; i++) {
+        pthread_mutex_lock(&g_Lock);
+        uint64_t* value = gl_program_map_find(&group->shaders, shaders[i], false);
+        bool deferred = value != NULL && (*value & SHADER_DEFERRED);
+        if (deferred) *value &= ~(uint64_t) SHADER_DEFERRED;
+        pthread_mutex_unlock(&g_Lock);
+        if (deferred) g_CompileShader(shaders[i]);
+    }
+}
+
+/** Forget what is known about `name` in `map`. */
+static void gl_program_cache_reset(gl_program_map_t* map, GLuint name) {
+    pthread_mutex_lock(&g_Lock);
+    uint64_t* value = gl_program_map_find(map, name, true);
+    if (value != NULL) *value = 0;
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static void gl_program_cache_bind(GLuint program, uint32_t kind, GLuint index, const GLchar* name) {
+    gl_program_group_t* group = t_Group;
+    if (group == NULL || name == NULL) return;
+    pthread_mutex_lock(&g_Lock);
+    uint64_t* value = gl_program_map_find(&group->programs, program, true);
+    if (value != NULL) {
+        uint64_t hash = gl_program_hash(HASH_SEED ^ *value, &kind, sizeof(kind));
+        hash = gl_program_hash(hash, &index, sizeof(index));
+        hash = gl_program_hash(hash, name, strlen(name));
+        *value = (hash << 1) | (*value & PROGRAM_UNCACHEABLE);
+    }
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static void gl_program_cache_exclude(GLuint program) {
+    gl_program_group_t* group = t_Group;
+    if (group == NULL) return;
+    pthread_mutex_lock(&g_Lock);
+    uint64_t* value = gl_program_map_find(&group->programs, program, true);
+    if (value != NULL) *value |= PROGRAM_UNCACHEABLE;
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static GLuint GLAPIENTRY gl_program_cache_glCreateShader(GLenum type) {
+    GLuint shader = g_CreateShader(type);
+    gl_program_group_t* group = t_Group;
+    // Names are reused, whatever was known about the last shader with this one is gone
+    if (group != NULL && shader != 0) gl_program_cache_reset(&group->shaders, shader);
+    return shader;
+}
+
+static void GLAPIENTRY gl_program_cache_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
+    gl_program_group_t* group = t_Group;
+    // A new source doesn't change what the last compile produced, a deferred one has to happen with the old source
+    if (group != NULL) gl_program_cache_compile_deferred(group, &shader, 1);
+    g_ShaderSource(shader, count, string, length);
+    if (group == NULL || string == NULL || !gl_program_cache_ready()) return;
+    uint64_t hash = HASH_SEED;
+    for (GLsizei i = 0; i < count; i++) {
+        if (string[i] == NULL) continue;
+        size_t size = length != NULL && length[i] >= 0 ? (size_t) length[i] : strlen(string[i]);
+        hash = gl_program_hash(hash, string[i], size);
+    }
+    pthread_mutex_lock(&g_Lock);
+    uint64_t* value = gl_program_map_find(&group->shaders, shader, true);
+    // Never 0, which stands for an unknown source
+    if (value != NULL) *value = ((hash >> 1) | 1) << 1;
+    pthread_mutex_unlock(&g_Lock);
+}
+
+static void GLAPIENTRY gl_program_cache_glCompileShader(GLuint shader) {
+    gl_program_group_t* group = t_Group;
+    bool defer = false;
+    if (group != NULL) {
+        pthread_mutex_lock(&g_Lock);
+        uint64_t* value = gl_program_map_find(&group->shaders, shader, false);
+        if (value != NULL && *value != 0) {
+            defer = gl_program_map_find(&g_KnownShaders, *value >> 1, false) != NULL;
+            *value = defer ? *value | SHADER_DEFERRED : *value & ~(uint64_t) SHADER_DEFERRED;
+        }
+        pthread_mutex_unlock(&g_Lock);
+    }
+    if (defer) atomic_fetch_add_explicit(&g_Deferred, 1, memory_order_relaxed);
+    else g_CompileShader(shader);
+}
+
+static void GLAPIENTRY gl_program_cache_glGetShaderiv(GLuint shader, GLenum pname, GLint* params) {
+    gl_program_group_t* group = t_Group;
+    if (group != NULL && pname == GL_COMPILE_STATUS) {
+        pthread_mutex_lock(&g_Lock);
+        uint64_t* value = gl_program_map_find(&group->shaders, shader, false);
+        bool deferred = value != NULL && (*value & SHADER_DEFERRED);
+        pthread_mutex_unlock(&g_Lock);
+        // The source compiled when a program that uses it was cached
+        if (deferred) {
+            *params = GL_TRUE;
+            return;
+        }
+    }
+    g_GetShaderiv(shader, pname, params);
+}
+
+static GLuint GLAPIENTRY gl_program_cache_glCreateProgram() {
+    GLuint program = g_CreateProgram();
+    gl_program_group_t* group = t_Group;
+    if (group != NULL && program != 0) gl_program_cache_reset(&group->programs, program);
+    return program;
+}
+
+static void GLAPIENTRY gl_program_cache_glBindAttribLocation(GLuint program, GLuint index, const GLchar* name) {
+    g_BindAttribLocation(program, index, name);
+    gl_program_cache_bind(program, BINDING_ATTRIBUTE, index, name);
+}
+
+static void GLAPIENTRY gl_program_cache_glBindFragDataLocation(GLuint program, GLuint color, const GLchar* name) {
+    g_BindFragDataLocation(program, color, name);
+    gl_program_cache_bind(program, BINDING_FRAG_DATA, color, name);
+}
+
+static void GLAPIENTRY gl_program_cache_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode) {
+    g_TransformFeedbackVaryings(program, count, varyings, bufferMode);
+    gl_program_cache_exclude(program);
+}
+
+static void GLAPIENTRY gl_program_cache_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    g_ProgramParameteri(program, pname, value);
+    if (pname != GL_PROGRAM_BINARY_RETRIEVABLE_HINT) gl_program_cache_exclude(program);
+}
+
+static void GLAPIENTRY gl_program_cache_glLinkProgram(GLuint program) {
+    gl_program_group_t* group = t_Group;
+    GLuint buffer[MAX_SHADERS];
+    GLuint* shaders = buffer;
+    uint64_t hashes[MAX_SHADERS];
+    GLsizei count = 0;
+    uint64_t key = 0;
+    if (group != NULL && gl_program_cache_ready()) {
+        GLint attached = 0;
+        g_GetProgramiv(program, GL_ATTACHED_SHADERS, &attached);
+        // Too many to be cached, but the deferred ones among them still have to be compiled
+        if (attached > MAX_SHADERS && (shaders = malloc(attached * sizeof(GLuint))) == NULL) shaders = buffer;
+        g_GetAttachedShaders(program, shaders == buffer ? MAX_SHADERS : attached, &count, shaders);
+        if (count <= MAX_SHADERS) key = gl_program_key(group, program, shaders, count, hashes);
+    }
+
+    if (key != 0) {
+        pthread_mutex_lock(&g_Lock);
+        uint64_t* value = gl_program_map_find(&g_Records, key, false);
+        const gl_program_record_t* record = value != NULL ? (const gl_program_record_t*) (uintptr_t) *value : NULL;
+        pthread_mutex_unlock(&g_Lock);
+        if (record != NULL) {
+            if (gl_program_cache_restore(program, record)) {
+                atomic_fetch_add_explicit(&g_Hits, 1, memory_order_relaxed);
+                return;
+            }
+            atomic_fetch_add_explicit(&g_Rejected, 1, memory_order_relaxed);
+        }
+        atomic_fetch_add_explicit(&g_Misses, 1, memory_order_relaxed);
+        if (g_SetProgramParameter != NULL) g_SetProgramParameter(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    if (group != NULL) gl_program_cache_compile_deferred(group, shaders, count);
+    if (shaders != buffer) free(shaders);
+    g_LinkProgram(program);
+    if (key == 0) return;
+    GLint linked = GL_FALSE;
+    g_GetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked == GL_TRUE) gl_program_cache_store(key, hashes, count, program);
+}
+
+typedef struct {
+    const char* name;
+    void* wrapper;
+    void** next;
+    int slot;
+} gl_program_cache_entry_t;
+
+#define GL_PROGRAM_CACHE_ENTRY(name, next) { #name, (void*) gl_program_cache_##name, (void**) &next, -1 }
+static gl_program_cache_entry_t g_Entries[] = {
+        GL_PROGRAM_CACHE_ENTRY(glCreateShader, g_CreateShader),
+        GL_PROGRAM_CACHE_ENTRY(glShaderSource, g_ShaderSource),
+        GL_PROGRAM_CACHE_ENTRY(glCompileShader, g_CompileShader),
+        GL_PROGRAM_CACHE_ENTRY(glGetShaderiv, g_GetShaderiv),
+        GL_PROGRAM_CACHE_ENTRY(glCreateProgram, g_CreateProgram),
+        GL_PROGRAM_CACHE_ENTRY(glBindAttribLocation, g_BindAttribLocation),
+        GL_PROGRAM_CACHE_ENTRY(glBindFragDataLocation, g_BindFragDataLocation),
+        GL_PROGRAM_CACHE_ENTRY(glTransformFeedbackVaryings, g_TransformFeedbackVaryings),
+        GL_PROGRAM_CACHE_ENTRY(glProgramParameteri, g_ProgramParameteri),
+        GL_PROGRAM_CACHE_ENTRY(glLinkProgram, g_LinkProgram),
+};
+#undef GL_PROGRAM_CACHE_ENTRY
+#define ENTRY_COUNT (sizeof(g_Entries) / sizeof(g_Entries[0]))
+
+void gl_program_cache_init(const char* setting, gl_proc_resolver_t resolver) {
+    if (setting == NULL) return;
+    const char* directory = setting[0] == '/' ? setting : getenv("TMPDIR");
+    if (directory == NULL ||
+        snprintf(g_Path, sizeof(g_Path), "%s/%s", directory, GL_PROGRAM_CACHE_FILE) >= (int) sizeof(g_Path)) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "No usable cache directory, program binaries aren't cached");
+        return;
+    }
+    mkdir(directory, 0700);
+    g_Resolver = resolver;
+    for (size_t i = 0; i < ENTRY_COUNT; i++) g_Entries[i].slot = gl_proc_table_slot(g_Entries[i].name);
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Program binaries are cached in %s", g_Path);
+}
+
+bool gl_program_cache_enabled() {
+    return g_Enabled;
+}
+
+void* gl_program_cache_wrap(int slot, void* next) {
+    for (size_t i = 0; i < ENTRY_COUNT; i++) {
+        if (g_Entries[i].slot != slot) continue;
+        *g_Entries[i].next = next;
+        return g_Entries[i].wrapper;
+    }
+    return NULL;
+}
+
+void gl_program_cache_make_current(const void* shareGroup) {
+    if (!g_Enabled) return;
+    gl_program_group_t* group = NULL;
+    if (shareGroup != NULL) {
+        pthread_mutex_lock(&g_Lock);
+        group = g_Groups;
+        while (group != NULL && group->shareGroup != shareGroup) group = group->next;
+        if (group == NULL && (group = calloc(1, sizeof(gl_program_group_t))) != NULL) {
+            group->shareGroup = shareGroup;
+            group->next = g_Groups;
+            g_Groups = group;
+        }
+        pthread_mutex_unlock(&g_Lock);
+    }
+    t_Group = group;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeGetProgramCacheStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!g_Enabled) return JNI_FALSE;
+    jlong values[] = {
+            (jlong) atomic_load_explicit(&g_Hits, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Misses, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Rejected, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Stored, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Deferred, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
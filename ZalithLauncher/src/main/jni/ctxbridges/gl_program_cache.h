@@ -0,0 +1,42 @@
+//
+// Program binary cache, enabled with POJAV_GL_PROGRAM_CACHE (the cache directory, $TMPDIR if it isn't
+// an absolute path).
+//
+// pojavGetProcAddress() hands out wrappers of the shader and program entry points. Shader sources
+// are hashed, and a program's key is made of the hashes of its shaders and of its attribute and
+// fragment data bindings. After a successful link, the glGetProgramBinary() output is appended to
+// the cache file, whose header is keyed by GL_VENDOR, GL_RENDERER and GL_VERSION.
+//
+// On later launches, glLinkProgram() restores known programs with glProgramBinary(). Compilation of
+// shaders whose source is part of a cached program is deferred as well (their compile status is
+// reported as successful, as it was when they were cached), and only happens if the driver refuses
+// the binary, the link then goes through the driver as usual.
+//
+// Only contexts made current through gl_make_current() use the cache, each share group on its own.
+//
+
+#ifndef POJAVLAUNCHER_GL_PROGRAM_CACHE_H
+#define POJAVLAUNCHER_GL_PROGRAM_CACHE_H
+
+#include <stdbool.h>
+
+#include "gl_proc_table.h"
+
+/**
+ * Call once, before the first pojavGetProcAddress(). `setting` is the value of POJAV_GL_PROGRAM_CACHE.
+ * @param resolver resolves the entry points the cache calls itself, as the game would
+ */
+void gl_program_cache_init(const char* setting, gl_proc_resolver_t resolver);
+
+bool gl_program_cache_enabled();
+
+/**
+ * @param next what the wrapper of the entry point in table slot `slot` calls
+ * @return the wrapper, NULL if the entry point isn't wrapped
+ */
+void* gl_program_cache_wrap(int slot, void* next);
+
+/** From gl_make_current(): `shareGroup` identifies the share group of the new current context, NULL if there is none. */
+void gl_program_cache_make_current(const void* shareGroup);
+
+#endif //POJAVLAUNCHER_GL_PROGRAM_CACHE_H
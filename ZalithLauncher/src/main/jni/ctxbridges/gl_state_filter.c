@@ -0,0 +1,324 @@
+//
+// Redundant GL state change filter, see gl_state_filter.h
+//
+
+#include <android/log.h>
+#include <jni.h>
+#include <string.h>
+#include <GL/gl.h>
+
+#include "gl_state_filter.h"
+#include "gl_proc_table.h"
+
+#define GL_STATE_UNKNOWN UINT32_MAX
+#define BUFFER_ELEMENT_ARRAY 1
+
+static const char* g_LogTag = "GLStateFilter";
+
+/* Entry points that set shadowed state: name, parameters, arguments, whether the call has to go through */
+#define GL_STATE_FILTERS(X) \
+    X(glActiveTexture, (GLenum texture), (texture), gl_state_active_texture(texture)) \
+    X(glActiveTextureARB, (GLenum texture), (texture), gl_state_active_texture(texture)) \
+    X(glBindTexture, (GLenum target, GLuint texture), (target, texture), gl_state_bind_texture(target, texture)) \
+    X(glBindTextureEXT, (GLenum target, GLuint texture), (target, texture), gl_state_bind_texture(target, texture)) \
+    X(glBindBuffer, (GLenum target, GLuint buffer), (target, buffer), gl_state_bind_buffer(target, buffer)) \
+    X(glBindBufferARB, (GLenum target, GLuint buffer), (target, buffer), gl_state_bind_buffer(target, buffer)) \
+    X(glBindVertexArray, (GLuint array), (array), gl_state_bind_vertex_array(array)) \
+    X(glBindVertexArrayAPPLE, (GLuint array), (array), gl_state_bind_vertex_array(array)) \
+    X(glUseProgram, (GLuint program), (program), gl_state_use_program(program)) \
+    X(glUseProgramObjectARB, (GLhandleARB programObj), (programObj), gl_state_use_program((uint32_t) programObj)) \
+    X(glEnable, (GLenum cap), (cap), gl_state_enable(cap, true)) \
+    X(glDisable, (GLenum cap), (cap), gl_state_enable(cap, false)) \
+    X(glEnablei, (GLenum target, GLuint index), (target, index), gl_state_forget_cap(target)) \
+    X(glDisablei, (GLenum target, GLuint index), (target, index), gl_state_forget_cap(target)) \
+    X(glEnableIndexedEXT, (GLenum target, GLuint index), (target, index), gl_state_forget_cap(target)) \
+    X(glDisableIndexedEXT, (GLenum target, GLuint index), (target, index), gl_state_forget_cap(target))
+
+/* Entry points that change shadowed state in ways that aren't worth tracking: name, parameters, arguments */
+#define GL_STATE_FORGETS(X) \
+    X(glBindTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures)) \
+    X(glBindTextureUnit, (GLuint unit, GLuint texture), (unit, texture)) \
+    X(glBindMultiTextureEXT, (GLenum texunit, GLenum target, GLuint texture), (texunit, target, texture)) \
+    X(glCallList, (GLuint list), (list)) \
+    X(glCallLists, (GLsizei n, GLenum type, const GLvoid *lists), (n, type, lists)) \
+    X(glPopAttrib, (void), ()) \
+    X(glPopClientAttrib, (void), ())
+
+/* Deletions unbind the deleted objects, and free their names for objects of any context of the share group */
+#define GL_STATE_DELETES(X) \
+    X(glDeleteTextures, (GLsizei n, const GLuint *textures), (n, textures)) \
+    X(glDeleteTexturesEXT, (GLsizei n, const GLuint *textures), (n, textures)) \
+    X(glDeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers)) \
+    X(glDeleteBuffersARB, (GLsizei n, const GLuint *buffers), (n, buffers)) \
+    X(glDeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays)) \
+    X(glDeleteVertexArraysAPPLE, (GLsizei n, const GLuint *arrays), (n, arrays))
+
+/* Calls that (re)link a program: name, parameters, arguments, the program */
+#define GL_STATE_LINKS(X) \
+    X(glLinkProgram, (GLuint program), (program), program) \
+    X(glLinkProgramARB, (GLhandleARB programObj), (programObj), (uint32_t) programObj) \
+    X(glProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), \
+      (program, binaryFormat, binary, length), program)
+
+#define GL_STATE_INDEX(name, ...) FILTER_##name,
+enum {
+    GL_STATE_FILTERS(GL_STATE_INDEX)
+    GL_STATE_FORGETS(GL_STATE_INDEX)
+    GL_STATE_DELETES(GL_STATE_INDEX)
+    GL_STATE_LINKS(GL_STATE_INDEX)
+    FILTER_COUNT
+};
+#undef GL_STATE_INDEX
+
+static const GLenum g_Caps[] = {
+        GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_DITHER, GL_POLYGON_OFFSET_FILL, GL_PRIMITIVE_RESTART_FIXED_INDEX,
+        GL_RASTERIZER_DISCARD, GL_SAMPLE_ALPHA_TO_COVERAGE, GL_SAMPLE_COVERAGE, GL_SCISSOR_TEST, GL_STENCIL_TEST
+};
+
+static bool g_Enabled;
+static int g_Slots[FILTER_COUNT];
+static void* g_Next[FILTER_COUNT];
+static atomic_ulong g_Calls, g_Elided, g_Forgotten;
+static __thread gl_state_shadow_t* t_Shadow;
+
+static void gl_state_forget(gl_state_shadow_t* shadow) {
+    shadow->activeTexture = GL_STATE_UNKNOWN;
+    memset(shadow->textures, 0xFF, sizeof(shadow->textures));
+    memset(shadow->buffers, 0xFF, sizeof(shadow->buffers));
+    shadow->vertexArray = GL_STATE_UNKNOWN;
+    shadow->program = GL_STATE_UNKNOWN;
+    shadow->capsKnown = 0;
+    atomic_fetch_add_explicit(&g_Forgotten, 1, memory_order_relaxed);
+}
+
+/** @return the shadow of the current context, NULL if there is none */
+static gl_state_shadow_t* gl_state_current() {
+    gl_state_shadow_t* shadow = t_Shadow;
+    atomic_fetch_add_explicit(&g_Calls, 1, memory_order_relaxed);
+    if (shadow == NULL) return NULL;
+    unsigned generation = atomic_load_explicit(shadow->group, memory_order_acquire);
+    if (generation != shadow->generation) {
+        gl_state_forget(shadow);
+        shadow->generation = generation;
+    }
+    return shadow;
+}
+
+/** @return whether the call has to go through */
+static bool gl_state_set(uint32_t* shadowed, uint32_t value) {
+    if (*shadowed == value) {
+        atomic_fetch_add_explicit(&g_Elided, 1, memory_order_relaxed);
+        return false;
+    }
+    *shadowed = value;
+    return true;
+}
+
+static int gl_state_texture_target(GLenum target) {
+    switch (target) {
+        case GL_TEXTURE_2D: return 0;
+        case GL_TEXTURE_CUBE_MAP: return 1;
+        case GL_TEXTURE_3D: return 2;
+        case GL_TEXTURE_2D_ARRAY: return 3;
+        default: return -1;
+    }
+}
+
+static int gl_state_buffer_target(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER: return 0;
+        case GL_ELEMENT_ARRAY_BUFFER: return BUFFER_ELEMENT_ARRAY;
+        case GL_PIXEL_PACK_BUFFER: return 2;
+        case GL_PIXEL_UNPACK_BUFFER: return 3;
+        default: return -1;
+    }
+}
+
+static int gl_state_cap(GLenum cap) {
+    for (int bit = 0; bit < (int) (sizeof(g_Caps) / sizeof(g_Caps[0])); bit++)
+        if (g_Caps[bit] == cap) return bit;
+    return -1;
+}
+
+static bool gl_state_active_texture(GLenum texture) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    if (shadow == NULL) return true;
+    uint32_t unit = texture - GL_TEXTURE0;
+    if (unit >= GL_STATE_TEXTURE_UNITS) {
+        shadow->activeTexture = GL_STATE_UNKNOWN;
+        return true;
+    }
+    return gl_state_set(&shadow->activeTexture, unit);
+}
+
+static bool gl_state_bind_texture(GLenum target, GLuint texture) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    int index = gl_state_texture_target(target);
+    if (shadow == NULL || index < 0) return true;
+    if (shadow->activeTexture == GL_STATE_UNKNOWN) {
+        // Whichever unit is active, its binding isn't known anymore
+        for (int unit = 0; unit < GL_STATE_TEXTURE_UNITS; unit++) shadow->textures[unit][index] = GL_STATE_UNKNOWN;
+        return true;
+    }
+    return gl_state_set(&shadow->textures[shadow->activeTexture][index], texture);
+}
+
+static bool gl_state_bind_buffer(GLenum target, GLuint buffer) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    int index = gl_state_buffer_target(target);
+    if (shadow == NULL || index < 0) return true;
+    return gl_state_set(&shadow->buffers[index], buffer);
+}
+
+static bool gl_state_bind_vertex_array(GLuint array) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    if (shadow == NULL) return true;
+    if (!gl_state_set(&shadow->vertexArray, array)) return false;
+    // The element array buffer binding belongs to the vertex array
+    shadow->buffers[BUFFER_ELEMENT_ARRAY] = GL_STATE_UNKNOWN;
+    return true;
+}
+
+static bool gl_state_use_program(uint32_t program) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    if (shadow == NULL) return true;
+    return gl_state_set(&shadow->program, program);
+}
+
+static bool gl_state_enable(GLenum cap, bool enabled) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    int bit = gl_state_cap(cap);
+    if (shadow == NULL || bit < 0) return true;
+    uint32_t mask = 1u << bit;
+    if ((shadow->capsKnown & mask) && ((shadow->capsEnabled & mask) != 0) == enabled) {
+        atomic_fetch_add_explicit(&g_Elided, 1, memory_order_relaxed);
+        return false;
+    }
+    shadow->capsKnown |= mask;
+    if (enabled) shadow->capsEnabled |= mask;
+    else shadow->capsEnabled &= ~mask;
+    return true;
+}
+
+static bool gl_state_forget_cap(GLenum cap) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    int bit = gl_state_cap(cap);
+    if (shadow != NULL && bit >= 0) shadow->capsKnown &= ~(1u << bit);
+    return true;
+}
+
+static void gl_state_forget_current() {
+    gl_state_shadow_t* shadow = gl_state_current();
+    if (shadow != NULL) gl_state_forget(shadow);
+}
+
+/*
+ * glUseProgram fails on a program that isn't linked, and the shadow was set anyway. Once the program
+ * is linked, the same call has to go through again.
+ */
+static void gl_state_linked(uint32_t program) {
+    gl_state_shadow_t* shadow = gl_state_current();
+    if (shadow != NULL && shadow->program == program) shadow->program = GL_STATE_UNKNOWN;
+}
+
+static void gl_state_deleted() {
+    gl_state_shadow_t* shadow = gl_state_current();
+    // The current context picks this up on its next call, like every other context of the group
+    if (shadow != NULL) atomic_fetch_add_explicit(shadow->group, 1, memory_order_release);
+}
+
+#define GL_STATE_FILTER(name, parameters, arguments, check) \
+    static void GLAPIENTRY gl_state_filter_##name parameters { \
+        if (check) ((void (GLAPIENTRY*) parameters) g_Next[FILTER_##name]) arguments; \
+    }
+#define GL_STATE_FORGET(name, parameters, arguments) \
+    static void GLAPIENTRY gl_state_filter_##name parameters { \
+        ((void (GLAPIENTRY*) parameters) g_Next[FILTER_##name]) arguments; \
+        gl_state_forget_current(); \
+    }
+#define GL_STATE_DELETE(name, parameters, arguments) \
+    static void GLAPIENTRY gl_state_filter_##name parameters { \
+        ((void (GLAPIENTRY*) parameters) g_Next[FILTER_##name]) arguments; \
+        gl_state_deleted(); \
+    }
+#define GL_STATE_LINK(name, parameters, arguments, program) \
+    static void GLAPIENTRY gl_state_filter_##name parameters { \
+        ((void (GLAPIENTRY*) parameters) g_Next[FILTER_##name]) arguments; \
+        gl_state_linked(program); \
+    }
+GL_STATE_FILTERS(GL_STATE_FILTER)
+GL_STATE_FORGETS(GL_STATE_FORGET)
+GL_STATE_DELETES(GL_STATE_DELETE)
+GL_STATE_LINKS(GL_STATE_LINK)
+#undef GL_STATE_FILTER
+#undef GL_STATE_FORGET
+#undef GL_STATE_DELETE
+#undef GL_STATE_LINK
+
+typedef struct {
+    const char* name;
+    void* filter;
+} gl_state_filter_entry_t;
+
+#define GL_STATE_ENTRY(name, ...) [FILTER_##name] = { #name, (void*) gl_state_filter_##name },
+static const gl_state_filter_entry_t g_Filters[FILTER_COUNT] = {
+    GL_STATE_FILTERS(GL_STATE_ENTRY)
+    GL_STATE_FORGETS(GL_STATE_ENTRY)
+    GL_STATE_DELETES(GL_STATE_ENTRY)
+    GL_STATE_LINKS(GL_STATE_ENTRY)
+};
+#undef GL_STATE_ENTRY
+
+void gl_state_filter_init(const char* setting) {
+    if (setting == NULL) return;
+    for (int filter = 0; filter < FILTER_COUNT; filter++) g_Slots[filter] = gl_proc_table_slot(g_Filters[filter].name);
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Redundant GL state changes are filtered");
+}
+
+bool gl_state_filter_enabled() {
+    return g_Enabled;
+}
+
+void* gl_state_filter_wrap(int slot, void* next) {
+    for (int filter = 0; filter < FILTER_COUNT; filter++) {
+        if (g_Slots[filter] != slot) continue;
+        g_Next[filter] = next;
+        return g_Filters[filter].filter;
+    }
+    return NULL;
+}
+
+void gl_state_shadow_init(gl_state_shadow_t* shadow, gl_state_shadow_t* share) {
+    atomic_init(&shadow->ownGeneration, 0);
+    shadow->group = share != NULL ? share->group : &shadow->ownGeneration;
+    shadow->generation = atomic_load_explicit(shadow->group, memory_order_acquire);
+    gl_state_forget(shadow);
+}
+
+void gl_state_filter_make_current(gl_state_shadow_t* shadow) {
+    t_Shadow = shadow;
+    // The context may have been used by anything while it wasn't current here
+    if (shadow != NULL && g_Enabled) {
+        shadow->generation = atomic_load_explicit(shadow->group, memory_order_acquire);
+        gl_state_forget(shadow);
+    }
+}
+
+/**
+ * Copy the filter statistics into the given array: filtered calls, calls that were dropped, times a shadow was forgotten.
+ * @return false if the filter is disabled (POJAV_GL_STATE_FILTER is not set)
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeGetGLStateFilterStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!g_Enabled) return JNI_FALSE;
+    jlong values[] = {
+            (jlong) atomic_load_explicit(&g_Calls, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Elided, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Forgotten, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
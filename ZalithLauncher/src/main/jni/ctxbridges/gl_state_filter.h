@@ -0,0 +1,56 @@
+//
+// Redundant GL state change filter, enabled with POJAV_GL_STATE_FILTER.
+//
+// pojavGetProcAddress() hands out filters for glBindTexture, glActiveTexture, glBindBuffer,
+// glBindVertexArray, glUseProgram and glEnable/glDisable. They shadow the state those calls set
+// in the current context and drop the calls that would not change it.
+//
+// Anything else that can change the shadowed state (deleting bound objects, display lists,
+// glPopAttrib, indexed enables...) forgets the whole shadow, and so does every make current.
+// Linking a program forgets it as the current program, in case glUseProgram failed on it before.
+// Contexts that share objects also share a generation counter: a deletion in one of them makes
+// the others forget theirs, as the deleted names can come back for other objects.
+//
+
+#ifndef POJAVLAUNCHER_GL_STATE_FILTER_H
+#define POJAVLAUNCHER_GL_STATE_FILTER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GL_STATE_TEXTURE_UNITS 32
+#define GL_STATE_TEXTURE_TARGETS 4 // 2D, cube map, 3D, 2D array
+#define GL_STATE_BUFFER_TARGETS 4 // array, element array, pixel pack, pixel unpack
+
+/** Per context, lives in gl_render_window_t. Values are GL_STATE_UNKNOWN until a call sets them. */
+typedef struct {
+    atomic_uint* group; // Generation of the share group, bumped by deletions
+    atomic_uint ownGeneration; // What `group` points to, unless the context was created with a share context
+    unsigned generation; // `group` when the shadow was last valid
+    uint32_t activeTexture; // Unit index
+    uint32_t textures[GL_STATE_TEXTURE_UNITS][GL_STATE_TEXTURE_TARGETS];
+    uint32_t buffers[GL_STATE_BUFFER_TARGETS];
+    uint32_t vertexArray;
+    uint32_t program;
+    uint32_t capsKnown, capsEnabled; // Bits of the capabilities in gl_state_filter.c
+} gl_state_shadow_t;
+
+/** Call once, before the first pojavGetProcAddress(). `setting` is the value of POJAV_GL_STATE_FILTER. */
+void gl_state_filter_init(const char* setting);
+
+bool gl_state_filter_enabled();
+
+/**
+ * @param next what the filter calls when the call does change state
+ * @return the filter of the entry point in table slot `slot`, NULL if it isn't filtered
+ */
+void* gl_state_filter_wrap(int slot, void* next);
+
+/** From gl_init_context(), `share` is the shadow of the share context or NULL. */
+void gl_state_shadow_init(gl_state_shadow_t* shadow, gl_state_shadow_t* share);
+
+/** From gl_make_current(), with the shadow of the context that became current on this thread, or NULL. */
+void gl_state_filter_make_current(gl_state_shadow_t* shadow);
+
+#endif //POJAVLAUNCHER_GL_STATE_FILTER_H
@@ -0,0 +1,531 @@
+//
+// Threaded GL dispatch, see gl_thread.h
+//
+
+#include <android/log.h>
+#include <jni.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GL/gl.h>
+
+#include "gl_thread.h"
+#include "gl_profile.h"
+#include "gl_proc_table.h"
+
+#define GL_THREAD_BATCH_SIZE (64 * 1024)
+#define GL_THREAD_BATCHES 4
+#define GL_THREAD_INLINE_LIMIT (16 * 1024) // Larger uploads wait instead of being copied
+#define GL_THREAD_SPIN 4000 // Checks before sleeping, most synchronous calls come back sooner
+#define GL_THREAD_ALIGN(size) (((size) + 15) & ~(size_t) 15)
+
+static const char* g_LogTag = "GLThread";
+
+typedef void (*gl_thread_replay_t)(const void* data);
+
+/* Followed by the data of the replay, padded to 16 bytes */
+typedef struct {
+    gl_thread_replay_t replay;
+    size_t size;
+} gl_thread_command_t;
+
+typedef struct {
+    size_t used;
+    _Alignas(16) uint8_t data[GL_THREAD_BATCH_SIZE];
+} gl_thread_batch_t;
+
+static bool g_Enabled;
+static void** g_Targets; // What the GL thread calls, by slot
+static gl_thread_batch_t* g_Batches;
+static gl_thread_batch_t* g_Recording; // The batch being recorded into, recording thread only
+static unsigned long g_PreviousFrame; // Batches that have to be executed before the next frame, recording thread only
+static atomic_ulong g_Submitted, g_Executed;
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_SubmittedCond = PTHREAD_COND_INITIALIZER, g_ExecutedCond = PTHREAD_COND_INITIALIZER;
+static atomic_bool g_Claimed;
+static __thread bool t_Claimed, t_Recording;
+
+/* Recording thread state, what decides whether draws and attribute pointers can be replayed later */
+static bool g_ClientArrays; // Some entry point pointed the GL at client memory, draws wait from now on
+static GLuint g_ArrayBuffer, g_VertexArray;
+static GLuint* g_ElementBuffers; // By vertex array
+static size_t g_VertexArrayCapacity;
+
+/* Statistics, only written by the recording thread */
+static atomic_ulong g_Commands, g_SyncCalls, g_WaitNs;
+
+static void gl_thread_count(atomic_ulong* counter, unsigned long amount) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+static uint64_t gl_thread_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+/** Wait until `batches` batches have been executed. */
+static void gl_thread_wait(unsigned long batches) {
+    if (atomic_load_explicit(&g_Executed, memory_order_acquire) >= batches) return;
+    uint64_t start = gl_thread_now();
+    for (int spin = 0; spin < GL_THREAD_SPIN; spin++)
+        if (atomic_load_explicit(&g_Executed, memory_order_acquire) >= batches) goto done;
+    pthread_mutex_lock(&g_Lock);
+    while (atomic_load_explicit(&g_Executed, memory_order_acquire) < batches) pthread_cond_wait(&g_ExecutedCond, &g_Lock);
+    pthread_mutex_unlock(&g_Lock);
+    done:
+    gl_thread_count(&g_WaitNs, gl_thread_now() - start);
+}
+
+/** Hand the batch being recorded over to the GL thread. */
+static void gl_thread_submit() {
+    if (g_Recording->used == 0) return;
+    unsigned long submitted = atomic_load_explicit(&g_Submitted, memory_order_relaxed) + 1;
+    pthread_mutex_lock(&g_Lock);
+    atomic_store_explicit(&g_Submitted, submitted, memory_order_release);
+    pthread_cond_signal(&g_SubmittedCond);
+    pthread_mutex_unlock(&g_Lock);
+    // The next batch is the oldest one, it can only be reused once it was executed
+    if (submitted >= GL_THREAD_BATCHES) gl_thread_wait(submitted - GL_THREAD_BATCHES + 1);
+    g_Recording = &g_Batches[submitted % GL_THREAD_BATCHES];
+    g_Recording->used = 0;
+}
+
+/** Submit everything recorded so far and wait until it was executed. */
+static void gl_thread_finish() {
+    gl_thread_submit();
+    gl_thread_wait(atomic_load_explicit(&g_Submitted, memory_order_relaxed));
+    gl_thread_count(&g_SyncCalls, 1);
+}
+
+/** @return where to put the `size` bytes of data `replay` gets */
+static __attribute__((noinline)) void* gl_thread_record(gl_thread_replay_t replay, size_t size) {
+    size_t total = GL_THREAD_ALIGN(sizeof(gl_thread_command_t) + size);
+    if (g_Recording->used + total > GL_THREAD_BATCH_SIZE) gl_thread_submit();
+    gl_thread_command_t* command = (gl_thread_command_t*) (g_Recording->data + g_Recording->used);
+    command->replay = replay;
+    command->size = total;
+    g_Recording->used += total;
+    gl_thread_count(&g_Commands, 1);
+    return command + 1;
+}
+
+/** Replay `replay` with a pointer to `call`, and wait for it. */
+static __attribute__((noinline)) void gl_thread_sync(gl_thread_replay_t replay, void* call) {
+    *(void**) gl_thread_record(replay, sizeof(void*)) = call;
+    gl_thread_finish();
+}
+
+static void* gl_thread_main(__attribute__((unused)) void* unused) {
+    pthread_setname_np(pthread_self(), "GLThread");
+    for (unsigned long executed = 0;; executed++) {
+        pthread_mutex_lock(&g_Lock);
+        while (atomic_load_explicit(&g_Submitted, memory_order_acquire) == executed) pthread_cond_wait(&g_SubmittedCond, &g_Lock);
+        pthread_mutex_unlock(&g_Lock);
+
+        gl_thread_batch_t* batch = &g_Batches[executed % GL_THREAD_BATCHES];
+        for (size_t offset = 0; offset < batch->used;) {
+            gl_thread_command_t* command = (gl_thread_command_t*) (batch->data + offset);
+            command->replay(command + 1);
+            offset += command->size;
+        }
+
+        pthread_mutex_lock(&g_Lock);
+        atomic_store_explicit(&g_Executed, executed + 1, memory_order_release);
+        pthread_cond_broadcast(&g_ExecutedCond);
+        pthread_mutex_unlock(&g_Lock);
+    }
+    return NULL;
+}
+
+#define GL_THREAD_UNPAREN(...) __VA_ARGS__
+
+// Calls that return nothing are copied into the batch, the synchronous ones then wait for it
+#define GL_THREAD_VOID(slot, name, parameters, arguments, fields, callArguments) \
+    struct gl_thread_##name { fields }; \
+    static void gl_thread_replay_##name(const void* data) { \
+        const struct gl_thread_##name* call = data; \
+        (void) call; \
+        ((void (GLAPIENTRY*) parameters) g_Targets[slot]) callArguments; \
+    }
+#define GL_THREAD_RECORD(name, arguments) \
+    (*(struct gl_thread_##name*) gl_thread_record(gl_thread_replay_##name, sizeof(struct gl_thread_##name)) = \
+        (struct gl_thread_##name) { GL_THREAD_UNPAREN arguments })
+
+#define GL_PROC_ASYNC(slot, name, parameters, arguments, fields, callArguments) \
+    GL_THREAD_VOID(slot, name, parameters, arguments, fields, callArguments) \
+    static void GLAPIENTRY gl_thread_##name parameters { \
+        if (!t_Recording) { ((void (GLAPIENTRY*) parameters) g_Targets[slot]) arguments; return; } \
+        GL_THREAD_RECORD(name, arguments); \
+    }
+#define GL_PROC_SYNC_VOID(slot, name, parameters, arguments, fields, callArguments) \
+    GL_THREAD_VOID(slot, name, parameters, arguments, fields, callArguments) \
+    static void GLAPIENTRY gl_thread_##name parameters { \
+        if (!t_Recording) { ((void (GLAPIENTRY*) parameters) g_Targets[slot]) arguments; return; } \
+        GL_THREAD_RECORD(name, arguments); \
+        gl_thread_finish(); \
+    }
+#define GL_PROC_SYNC_CLIENT_ARRAY(slot, name, parameters, arguments, fields, callArguments) \
+    GL_THREAD_VOID(slot, name, parameters, arguments, fields, callArguments) \
+    static void GLAPIENTRY gl_thread_##name parameters { \
+        if (!t_Recording) { ((void (GLAPIENTRY*) parameters) g_Targets[slot]) arguments; return; } \
+        g_ClientArrays = true; \
+        GL_THREAD_RECORD(name, arguments); \
+        gl_thread_finish(); \
+    }
+// The caller's own copy of the arguments is passed along, so that the result can be written back
+#define GL_PROC_SYNC(slot, type, name, parameters, arguments, fields, callArguments) \
+    struct gl_thread_##name { fields type result; }; \
+    static void gl_thread_replay_##name(const void* data) { \
+        struct gl_thread_##name* call = *(struct gl_thread_##name* const*) data; \
+        call->result = ((type (GLAPIENTRY*) parameters) g_Targets[slot]) callArguments; \
+    } \
+    static type GLAPIENTRY gl_thread_##name parameters { \
+        if (!t_Recording) return ((type (GLAPIENTRY*) parameters) g_Targets[slot]) arguments; \
+        struct gl_thread_##name call = { GL_THREAD_UNPAREN arguments }; \
+        gl_thread_sync(gl_thread_replay_##name, &call); \
+        return call.result; \
+    }
+#include "gl_proc_marshal.h"
+#undef GL_PROC_ASYNC
+#undef GL_PROC_SYNC_VOID
+#undef GL_PROC_SYNC_CLIENT_ARRAY
+#undef GL_PROC_SYNC
+
+#define GL_PROC_ASYNC(slot, name, ...) [slot] = (void*) gl_thread_##name,
+#define GL_PROC_SYNC_VOID(slot, name, ...) [slot] = (void*) gl_thread_##name,
+#define GL_PROC_SYNC_CLIENT_ARRAY(slot, name, ...) [slot] = (void*) gl_thread_##name,
+#define GL_PROC_SYNC(slot, type, name, ...) [slot] = (void*) gl_thread_##name,
+static void* const g_Wrappers[] = {
+#include "gl_proc_marshal.h"
+};
+#undef GL_PROC_ASYNC
+#undef GL_PROC_SYNC_VOID
+#undef GL_PROC_SYNC_CLIENT_ARRAY
+#undef GL_PROC_SYNC
+
+/* Buffer object bindings, so that pointers that are offsets into buffers can be told apart from client memory */
+
+static GLuint* gl_thread_element_buffer(GLuint vertexArray) {
+    if (vertexArray >= g_VertexArrayCapacity) {
+        size_t capacity = g_VertexArrayCapacity ? g_VertexArrayCapacity : 256;
+        while (capacity <= vertexArray) capacity *= 2;
+        GLuint* elementBuffers = realloc(g_ElementBuffers, capacity * sizeof(GLuint));
+        if (elementBuffers == NULL) abort();
+        memset(elementBuffers + g_VertexArrayCapacity, 0, (capacity - g_VertexArrayCapacity) * sizeof(GLuint));
+        g_ElementBuffers = elementBuffers;
+        g_VertexArrayCapacity = capacity;
+    }
+    return &g_ElementBuffers[vertexArray];
+}
+
+/** @return whether the draw about to be recorded only reads from buffer objects */
+static bool gl_thread_buffers_only(bool indexed) {
+    if (g_ClientArrays) return false;
+    return !indexed || *gl_thread_element_buffer(g_VertexArray) != 0;
+}
+
+/* The shadow is kept by every alias of these entry points, one that is missed leaves a stale binding behind */
+
+static void gl_thread_track_bind_buffer(GLenum target, GLuint buffer) {
+    if (!t_Recording) return;
+    if (target == GL_ARRAY_BUFFER) g_ArrayBuffer = buffer;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) *gl_thread_element_buffer(g_VertexArray) = buffer;
+}
+
+static void gl_thread_track_delete_buffers(GLsizei n, const GLuint* buffers) {
+    if (!t_Recording) return;
+    // Deleting a buffer unbinds it from the context and from the current vertex array
+    GLuint* elementBuffer = gl_thread_element_buffer(g_VertexArray);
+    for (GLsizei i = 0; i < n; i++) {
+        if (buffers[i] == 0) continue;
+        if (buffers[i] == g_ArrayBuffer) g_ArrayBuffer = 0;
+        if (buffers[i] == *elementBuffer) *elementBuffer = 0;
+    }
+}
+
+static void gl_thread_track_delete_vertex_arrays(GLsizei n, const GLuint* arrays) {
+    if (!t_Recording) return;
+    for (GLsizei i = 0; i < n; i++) {
+        if (arrays[i] == 0) continue;
+        *gl_thread_element_buffer(arrays[i]) = 0;
+        if (arrays[i] == g_VertexArray) g_VertexArray = 0;
+    }
+}
+
+static void GLAPIENTRY gl_thread_bind_buffer(GLenum target, GLuint buffer) {
+    gl_thread_track_bind_buffer(target, buffer);
+    gl_thread_glBindBuffer(target, buffer);
+}
+
+static void GLAPIENTRY gl_thread_bind_buffer_arb(GLenum target, GLuint buffer) {
+    gl_thread_track_bind_buffer(target, buffer);
+    gl_thread_glBindBufferARB(target, buffer);
+}
+
+static void GLAPIENTRY gl_thread_bind_vertex_array(GLuint array) {
+    if (t_Recording) g_VertexArray = array;
+    gl_thread_glBindVertexArray(array);
+}
+
+static void GLAPIENTRY gl_thread_bind_vertex_array_apple(GLuint array) {
+    if (t_Recording) g_VertexArray = array;
+    gl_thread_glBindVertexArrayAPPLE(array);
+}
+
+static void GLAPIENTRY gl_thread_vertex_array_element_buffer(GLuint vaobj, GLuint buffer) {
+    if (t_Recording) *gl_thread_element_buffer(vaobj) = buffer;
+    gl_thread_glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void GLAPIENTRY gl_thread_delete_buffers(GLsizei n, const GLuint* buffers) {
+    gl_thread_glDeleteBuffers(n, buffers);
+    gl_thread_track_delete_buffers(n, buffers);
+}
+
+static void GLAPIENTRY gl_thread_delete_buffers_arb(GLsizei n, const GLuint* buffers) {
+    gl_thread_glDeleteBuffersARB(n, buffers);
+    gl_thread_track_delete_buffers(n, buffers);
+}
+
+static void GLAPIENTRY gl_thread_delete_vertex_arrays(GLsizei n, const GLuint* arrays) {
+    gl_thread_glDeleteVertexArrays(n, arrays);
+    gl_thread_track_delete_vertex_arrays(n, arrays);
+}
+
+static void GLAPIENTRY gl_thread_delete_vertex_arrays_apple(GLsizei n, const GLuint* arrays) {
+    gl_thread_glDeleteVertexArraysAPPLE(n, arrays);
+    gl_thread_track_delete_vertex_arrays(n, arrays);
+}
+
+static void GLAPIENTRY gl_thread_vertex_attrib_pointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) {
+    if (!t_Recording || g_ArrayBuffer == 0) gl_thread_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    else GL_THREAD_RECORD(glVertexAttribPointer, (index, size, type, normalized, stride, pointer));
+}
+
+static void GLAPIENTRY gl_thread_vertex_attrib_i_pointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer) {
+    if (!t_Recording || g_ArrayBuffer == 0) gl_thread_glVertexAttribIPointer(index, size, type, stride, pointer);
+    else GL_THREAD_RECORD(glVertexAttribIPointer, (index, size, type, stride, pointer));
+}
+
+/* Every draw that reads the vertex arrays without an index pointer of its own, they wait while client arrays are in use */
+#define GL_THREAD_DRAW_ARRAYS(name, parameters, arguments) \
+    static void GLAPIENTRY gl_thread_##name##_draw parameters { \
+        gl_thread_##name arguments; \
+        if (t_Recording && !gl_thread_buffers_only(false)) gl_thread_finish(); \
+    }
+#define GL_THREAD_NON_INDEXED_DRAWS(X) \
+    X(glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(glDrawArraysEXT, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount)) \
+    X(glDrawArraysInstancedARB, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount)) \
+    X(glDrawArraysInstancedEXT, (GLenum mode, GLint start, GLsizei count, GLsizei primcount), (mode, start, count, primcount)) \
+    X(glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), \
+      (mode, first, count, instancecount, baseinstance)) \
+    X(glArrayElement, (GLint i), (i)) \
+    X(glArrayElementEXT, (GLint i), (i)) \
+    X(glDrawMeshArraysSUN, (GLenum mode, GLint first, GLsizei count, GLsizei width), (mode, first, count, width)) \
+    X(glDrawTransformFeedback, (GLenum mode, GLuint id), (mode, id)) \
+    X(glDrawTransformFeedbackNV, (GLenum mode, GLuint id), (mode, id)) \
+    X(glDrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount)) \
+    X(glDrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream)) \
+    X(glDrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), \
+      (mode, id, stream, instancecount)) \
+    /* The element array of these is set by gl*ElementPointer*, which counts as a client array */ \
+    X(glDrawElementArrayATI, (GLenum mode, GLsizei count), (mode, count)) \
+    X(glDrawRangeElementArrayATI, (GLenum mode, GLuint start, GLuint end, GLsizei count), (mode, start, end, count)) \
+    X(glDrawElementArrayAPPLE, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(glDrawRangeElementArrayAPPLE, (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count), (mode, start, end, first, count))
+GL_THREAD_NON_INDEXED_DRAWS(GL_THREAD_DRAW_ARRAYS)
+
+static void GLAPIENTRY gl_thread_draw_elements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+    if (!t_Recording || !gl_thread_buffers_only(true)) gl_thread_glDrawElements(mode, count, type, indices);
+    else GL_THREAD_RECORD(glDrawElements, (mode, count, type, indices));
+}
+
+static void GLAPIENTRY gl_thread_draw_elements_instanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount) {
+    if (!t_Recording || !gl_thread_buffers_only(true)) gl_thread_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    else GL_THREAD_RECORD(glDrawElementsInstanced, (mode, count, type, indices, instancecount));
+}
+
+static void GLAPIENTRY gl_thread_draw_elements_base_vertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex) {
+    if (!t_Recording || !gl_thread_buffers_only(true)) gl_thread_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    else GL_THREAD_RECORD(glDrawElementsBaseVertex, (mode, count, type, indices, basevertex));
+}
+
+static void GLAPIENTRY gl_thread_draw_range_elements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid* indices) {
+    if (!t_Recording || !gl_thread_buffers_only(true)) gl_thread_glDrawRangeElements(mode, start, end, count, type, indices);
+    else GL_THREAD_RECORD(glDrawRangeElements, (mode, start, end, count, type, indices));
+}
+
+/* Uploads small enough to be copied into the batch, the copy stands in for the caller's memory */
+
+/* Records `name` with `size` bytes of what `field` points to copied behind it, `field` then points to the copy */
+#define GL_THREAD_RECORD_DATA(name, arguments, field, size) do { \
+        struct gl_thread_##name* call = gl_thread_record(gl_thread_replay_##name, sizeof(struct gl_thread_##name) + (size)); \
+        *call = (struct gl_thread_##name) { GL_THREAD_UNPAREN arguments }; \
+        call->field = memcpy(call + 1, call->field, (size)); \
+    } while (0)
+
+static void GLAPIENTRY gl_thread_buffer_data(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+    if (!t_Recording || size < 0 || size > GL_THREAD_INLINE_LIMIT) gl_thread_glBufferData(target, size, data, usage);
+    else if (data == NULL) GL_THREAD_RECORD(glBufferData, (target, size, data, usage));
+    else GL_THREAD_RECORD_DATA(glBufferData, (target, size, data, usage), data, (size_t) size);
+}
+
+static void GLAPIENTRY gl_thread_buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    if (!t_Recording || data == NULL || size < 0 || size > GL_THREAD_INLINE_LIMIT) gl_thread_glBufferSubData(target, offset, size, data);
+    else GL_THREAD_RECORD_DATA(glBufferSubData, (target, offset, size, data), data, (size_t) size);
+}
+
+#define GL_THREAD_UNIFORM(name, type, components) \
+    static void GLAPIENTRY gl_thread_##name##_copy(GLint location, GLsizei count, const type* value) { \
+        size_t size = (size_t) count * (components) * sizeof(type); \
+        if (!t_Recording || count < 0 || size > GL_THREAD_INLINE_LIMIT) gl_thread_##name(location, count, value); \
+        else GL_THREAD_RECORD_DATA(name, (location, count, value), value, size); \
+    }
+#define GL_THREAD_UNIFORM_MATRIX(name, components) \
+    static void GLAPIENTRY gl_thread_##name##_copy(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) { \
+        size_t size = (size_t) count * (components) * sizeof(GLfloat); \
+        if (!t_Recording || count < 0 || size > GL_THREAD_INLINE_LIMIT) gl_thread_##name(location, count, transpose, value); \
+        else GL_THREAD_RECORD_DATA(name, (location, count, transpose, value), value, size); \
+    }
+#define GL_THREAD_UNIFORMS(X, MATRIX) \
+    X(glUniform1fv, GLfloat, 1) X(glUniform2fv, GLfloat, 2) X(glUniform3fv, GLfloat, 3) X(glUniform4fv, GLfloat, 4) \
+    X(glUniform1iv, GLint, 1) X(glUniform2iv, GLint, 2) X(glUniform3iv, GLint, 3) X(glUniform4iv, GLint, 4) \
+    X(glUniform1uiv, GLuint, 1) X(glUniform2uiv, GLuint, 2) X(glUniform3uiv, GLuint, 3) X(glUniform4uiv, GLuint, 4) \
+    MATRIX(glUniformMatrix2fv, 4) MATRIX(glUniformMatrix3fv, 9) MATRIX(glUniformMatrix4fv, 16) \
+    MATRIX(glUniformMatrix2x3fv, 6) MATRIX(glUniformMatrix3x2fv, 6) MATRIX(glUniformMatrix2x4fv, 8) \
+    MATRIX(glUniformMatrix4x2fv, 8) MATRIX(glUniformMatrix3x4fv, 12) MATRIX(glUniformMatrix4x3fv, 12)
+GL_THREAD_UNIFORMS(GL_THREAD_UNIFORM, GL_THREAD_UNIFORM_MATRIX)
+
+typedef struct {
+    const char* name;
+    void* wrapper;
+    int slot;
+} gl_thread_special_t;
+
+#define GL_THREAD_SPECIAL_UNIFORM(name, ...) { #name, (void*) gl_thread_##name##_copy, -1 },
+#define GL_THREAD_SPECIAL_DRAW(name, ...) { #name, (void*) gl_thread_##name##_draw, -1 },
+static gl_thread_special_t g_Specials[] = {
+        { "glBindBuffer", (void*) gl_thread_bind_buffer, -1 },
+        { "glBindBufferARB", (void*) gl_thread_bind_buffer_arb, -1 },
+        { "glBindVertexArray", (void*) gl_thread_bind_vertex_array, -1 },
+        { "glBindVertexArrayAPPLE", (void*) gl_thread_bind_vertex_array_apple, -1 },
+        { "glVertexArrayElementBuffer", (void*) gl_thread_vertex_array_element_buffer, -1 },
+        { "glDeleteBuffers", (void*) gl_thread_delete_buffers, -1 },
+        { "glDeleteBuffersARB", (void*) gl_thread_delete_buffers_arb, -1 },
+        { "glDeleteVertexArrays", (void*) gl_thread_delete_vertex_arrays, -1 },
+        { "glDeleteVertexArraysAPPLE", (void*) gl_thread_delete_vertex_arrays_apple, -1 },
+        { "glVertexAttribPointer", (void*) gl_thread_vertex_attrib_pointer, -1 },
+        { "glVertexAttribIPointer", (void*) gl_thread_vertex_attrib_i_pointer, -1 },
+        GL_THREAD_NON_INDEXED_DRAWS(GL_THREAD_SPECIAL_DRAW)
+        { "glDrawElements", (void*) gl_thread_draw_elements, -1 },
+        { "glDrawElementsInstanced", (void*) gl_thread_draw_elements_instanced, -1 },
+        { "glDrawElementsBaseVertex", (void*) gl_thread_draw_elements_base_vertex, -1 },
+        { "glDrawRangeElements", (void*) gl_thread_draw_range_elements, -1 },
+        { "glBufferData", (void*) gl_thread_buffer_data, -1 },
+        { "glBufferSubData", (void*) gl_thread_buffer_sub_data, -1 },
+        GL_THREAD_UNIFORMS(GL_THREAD_SPECIAL_UNIFORM, GL_THREAD_SPECIAL_UNIFORM)
+};
+#undef GL_THREAD_SPECIAL_UNIFORM
+#undef GL_THREAD_SPECIAL_DRAW
+
+void gl_thread_init(const char* setting) {
+    if (setting == NULL) return;
+    g_Batches = calloc(GL_THREAD_BATCHES, sizeof(gl_thread_batch_t));
+    g_Targets = calloc((size_t) gl_proc_table_count(), sizeof(void*));
+    pthread_t thread;
+    if (g_Batches == NULL || g_Targets == NULL || pthread_create(&thread, NULL, gl_thread_main, NULL) != 0) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Failed to start the GL thread, calls stay on the calling thread");
+        free(g_Batches);
+        free(g_Targets);
+        return;
+    }
+    pthread_detach(thread);
+    g_Recording = &g_Batches[0];
+    for (size_t i = 0; i < sizeof(g_Specials) / sizeof(g_Specials[0]); i++)
+        g_Specials[i].slot = gl_proc_table_slot(g_Specials[i].name);
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "GL calls are recorded for a dedicated GL thread");
+}
+
+bool gl_thread_enabled() {
+    return g_Enabled;
+}
+
+void* gl_thread_wrap(int slot, void* next) {
+    g_Targets[slot] = next;
+    for (size_t i = 0; i < sizeof(g_Specials) / sizeof(g_Specials[0]); i++)
+        if (g_Specials[i].slot == slot) return g_Specials[i].wrapper;
+    return g_Wrappers[slot];
+}
+
+bool gl_thread_claim() {
+    bool unclaimed = false;
+    if (!t_Claimed && atomic_compare_exchange_strong(&g_Claimed, &unclaimed, true)) t_Claimed = true;
+    return t_Claimed;
+}
+
+void gl_thread_set_recording(bool recording) {
+    t_Recording = recording;
+    // Whatever was bound before belongs to another context, or was bound without going through the wrappers
+    g_ArrayBuffer = 0;
+    g_VertexArray = 0;
+    if (g_ElementBuffers) memset(g_ElementBuffers, 0, g_VertexArrayCapacity * sizeof(GLuint));
+}
+
+bool gl_thread_recording() {
+    return t_Recording;
+}
+
+typedef struct {
+    void (*function)(void* argument);
+    void* argument;
+} gl_thread_call_t;
+
+static void gl_thread_replay_call(const void* data) {
+    const gl_thread_call_t* call = data;
+    call->function(call->argument);
+}
+
+void gl_thread_run(void (*function)(void* argument), void* argument) {
+    *(gl_thread_call_t*) gl_thread_record(gl_thread_replay_call, sizeof(gl_thread_call_t)) = (gl_thread_call_t) { function, argument };
+    gl_thread_finish();
+}
+
+static void gl_thread_replay_present(const void* data) {
+    if (gl_profile_enabled()) gl_profile_frame();
+    (*(void (* const*)()) data)();
+}
+
+void gl_thread_present(void (*swap)()) {
+    *(void (**)()) gl_thread_record(gl_thread_replay_present, sizeof(swap)) = swap;
+    gl_thread_submit();
+    // One frame may be queued behind the one the GL thread is working on
+    gl_thread_wait(g_PreviousFrame);
+    g_PreviousFrame = atomic_load_explicit(&g_Submitted, memory_order_relaxed);
+}
+
+/**
+ * Copy the GL thread statistics into the given array: recorded commands, times the recording thread waited for
+ * the GL thread (synchronous calls), batches handed over, nanoseconds spent waiting.
+ * @return false if threaded dispatch is disabled (POJAV_GL_THREAD is not set)
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeGetGLThreadStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!g_Enabled) return JNI_FALSE;
+    jlong values[] = {
+            (jlong) atomic_load_explicit(&g_Commands, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_SyncCalls, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Submitted, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_WaitNs, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
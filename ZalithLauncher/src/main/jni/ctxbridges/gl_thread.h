@@ -0,0 +1,46 @@
+//
+// Threaded GL dispatch, enabled with POJAV_GL_THREAD.
+//
+// The first thread that makes a context current through gl_make_current() becomes the recording
+// thread: the context is made current on a dedicated GL thread instead, and pojavGetProcAddress()
+// hands out wrappers (generated from gl_proc_marshal.h) that record calls into command batches
+// for it. Calls that return nothing and take no pointers are replayed later, everything else
+// (glGet*, glGen*, glReadPixels, glMapBufferRange...) hands the batch over and waits for its result.
+// A few hot calls are special-cased: buffer and uniform uploads copy their data into the batch,
+// and draws and attribute pointers stay asynchronous while they only refer to buffer objects.
+// Swaps are queued as well, the recording thread only waits for the frame before the current one.
+//
+// Other threads that make contexts current keep calling the driver directly, and so do entry
+// points that pojavGetProcAddress() doesn't find in the table of gl_proc_table.h.
+//
+
+#ifndef POJAVLAUNCHER_GL_THREAD_H
+#define POJAVLAUNCHER_GL_THREAD_H
+
+#include <stdbool.h>
+
+/** Call once, before the first pojavGetProcAddress(). `setting` is the value of POJAV_GL_THREAD. */
+void gl_thread_init(const char* setting);
+
+bool gl_thread_enabled();
+
+/**
+ * @param next what the GL thread calls for the entry point in table slot `slot`
+ * @return the recording wrapper of that entry point
+ */
+void* gl_thread_wrap(int slot, void* next);
+
+/** @return whether the calling thread is (or has now become) the recording thread */
+bool gl_thread_claim();
+
+/** From the recording thread, whether a context is current on the GL thread for it. */
+void gl_thread_set_recording(bool recording);
+bool gl_thread_recording();
+
+/** Run `function` on the GL thread after everything recorded so far, and wait for it. Recording thread only. */
+void gl_thread_run(void (*function)(void* argument), void* argument);
+
+/** Queue `swap` on the GL thread, and wait until at most this frame is still in flight. Recording thread only. */
+void gl_thread_present(void (*swap)());
+
+#endif //POJAVLAUNCHER_GL_THREAD_H
@@ -0,0 +1,589 @@
+//
+// Asynchronous texture uploads, see gl_upload.h
+//
+
+#include <android/log.h>
+#include <dlfcn.h>
+#include <jni.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GL/gl.h>
+
+#include "gl_upload.h"
+#include "gl_bridge.h"
+#include "gl_proc_table.h"
+#include "egl_loader.h"
+
+#define GL_UPLOAD_MAX_THREADS 4
+#define BATCHES_PER_THREAD 3
+// The pixel buffer of a batch, bigger uploads go to the driver directly
+#define BATCH_SIZE (4 << 20)
+#define BATCH_MAX_JOBS 1024
+
+static const char* g_LogTag = "GLUpload";
+
+/* Entry points the upload threads and the waits call, resolved like pojavGetProcAddress() does */
+#define GL_UPLOAD_FUNCTIONS(X) \
+    X(void, glBindBuffer, (GLenum target, GLuint buffer)) \
+    X(void, glBindTexture, (GLenum target, GLuint texture)) \
+    X(void, glBufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage)) \
+    X(GLenum, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    X(void, glDeleteSync, (GLsync sync)) \
+    X(GLsync, glFenceSync, (GLenum condition, GLbitfield flags)) \
+    X(void, glFlush, (void)) \
+    X(void, glGenBuffers, (GLsizei n, GLuint* buffers)) \
+    X(void*, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    X(void, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)) \
+    X(GLboolean, glUnmapBuffer, (GLenum target)) \
+    X(void, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout))
+
+#define GL_UPLOAD_POINTER(type, name, parameters) static type (*name##_p) parameters;
+GL_UPLOAD_FUNCTIONS(GL_UPLOAD_POINTER)
+#undef GL_UPLOAD_POINTER
+
+/* Entry points that may read an uploaded texture, or replace it: name, parameters, arguments */
+#define GL_UPLOAD_CONSUMERS(X) \
+    X(glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(glDrawArraysEXT, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(glDrawElements, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices)) \
+    X(glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount)) \
+    X(glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount), (mode, count, type, indices, instancecount)) \
+    X(glDrawArraysInstancedARB, (GLenum mode, GLint first, GLsizei count, GLsizei primcount), (mode, first, count, primcount)) \
+    X(glDrawArraysInstancedEXT, (GLenum mode, GLint start, GLsizei count, GLsizei primcount), (mode, start, count, primcount)) \
+    X(glDrawElementsInstancedARB, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount), (mode, count, type, indices, primcount)) \
+    X(glDrawElementsInstancedEXT, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount), (mode, count, type, indices, primcount)) \
+    X(glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices), (mode, start, end, count, type, indices)) \
+    X(glDrawRangeElementsEXT, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices), (mode, start, end, count, type, indices)) \
+    X(glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, count, type, indices, basevertex)) \
+    X(glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex)) \
+    X(glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex)) \
+    X(glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance)) \
+    X(glDrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance)) \
+    X(glDrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance)) \
+    X(glMultiDrawArrays, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount), (mode, first, count, drawcount)) \
+    X(glMultiDrawElements, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount), (mode, count, type, indices, drawcount)) \
+    X(glMultiDrawArraysEXT, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei primcount), (mode, first, count, primcount)) \
+    X(glMultiDrawElementsEXT, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei primcount), (mode, count, type, indices, primcount)) \
+    X(glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex), (mode, count, type, indices, drawcount, basevertex)) \
+    X(glDrawArraysIndirect, (GLenum mode, const void* indirect), (mode, indirect)) \
+    X(glDrawElementsIndirect, (GLenum mode, GLenum type, const void* indirect), (mode, type, indirect)) \
+    X(glMultiDrawArraysIndirect, (GLenum mode, const void* indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride)) \
+    X(glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride)) \
+    X(glDrawTransformFeedback, (GLenum mode, GLuint id), (mode, id)) \
+    X(glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z)) \
+    X(glDispatchComputeIndirect, (GLintptr indirect), (indirect)) \
+    X(glBindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format)) \
+    X(glClear, (GLbitfield mask), (mask)) \
+    X(glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter)) \
+    X(glGenerateMipmap, (GLenum target), (target)) \
+    X(glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border)) \
+    X(glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height)) \
+    X(glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height)) \
+    X(glCopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth)) \
+    X(glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, border, format, type, pixels)) \
+    X(glTexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height)) \
+    X(glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels)) \
+    X(glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param)) \
+    X(glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param)) \
+    X(glTexParameteriv, (GLenum target, GLenum pname, const GLint* params), (target, pname, params)) \
+    X(glTexParameterfv, (GLenum target, GLenum pname, const GLfloat* params), (target, pname, params)) \
+    X(glTexParameterIiv, (GLenum target, GLenum pname, const GLint* params), (target, pname, params)) \
+    X(glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint* params), (target, pname, params)) \
+    X(glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, border, imageSize, data)) \
+    X(glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, width, height, format, imageSize, data)) \
+    X(glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels), (x, y, width, height, format, type, pixels)) \
+    X(glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void* pixels), (target, level, format, type, pixels)) \
+    X(glFinish, (void), ())
+
+/* Entry points with wrappers of their own below */
+#define GL_UPLOAD_SPECIALS(X) \
+    X(glActiveTexture) \
+    X(glBindTexture) \
+    X(glBindBuffer) \
+    X(glPixelStorei) \
+    X(glDeleteTextures) \
+    X(glDeleteBuffers) \
+    X(glTexSubImage2D)
+
+enum {
+#define GL_UPLOAD_INDEX(name, ...) UPLOAD_##name,
+    GL_UPLOAD_CONSUMERS(GL_UPLOAD_INDEX)
+    GL_UPLOAD_SPECIALS(GL_UPLOAD_INDEX)
+#undef GL_UPLOAD_INDEX
+    UPLOAD_COUNT
+};
+
+#define NEXT(name, parameters) ((void (GLAPIENTRY*) parameters) g_Next[UPLOAD_##name])
+
+typedef struct {
+    GLuint texture;
+    GLint level, x, y;
+    GLsizei width, height;
+    GLenum format, type;
+    uint32_t offset; // In the pixel buffer
+} gl_upload_job_t;
+
+enum { BATCH_FREE, BATCH_FILLING, BATCH_QUEUED, BATCH_UPLOADING };
+
+typedef struct {
+    int state;
+    GLsync after; // Made on the queueing context before the first job
+    GLuint buffer;
+    uint8_t* mapping; // Written by the queueing thread while the batch is free or filling
+    uint32_t used, jobCount;
+    gl_upload_job_t jobs[BATCH_MAX_JOBS];
+} gl_upload_batch_t;
+
+typedef struct {
+    bool ready; // Whether its batches can be filled
+    gl_upload_batch_t* filling;
+    int queue[BATCHES_PER_THREAD]; // Queued batches, oldest first
+    int queueHead, queueCount;
+    gl_upload_batch_t batches[BATCHES_PER_THREAD];
+} gl_upload_thread_t;
+
+static bool g_Enabled;
+static int g_ThreadCount;
+static int g_Slots[UPLOAD_COUNT];
+static void* g_Next[UPLOAD_COUNT];
+static __thread gl_upload_shadow_t* t_Shadow;
+
+static pthread_mutex_t g_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_QueuedCond = PTHREAD_COND_INITIALIZER, g_FencedCond = PTHREAD_COND_INITIALIZER;
+/* Under g_Lock */
+static const gl_upload_shadow_t* g_Group; // The share group that got the upload threads
+static gl_upload_thread_t* g_Threads; // NULL if they couldn't be started
+static unsigned long g_Submitted, g_Fenced;
+static GLsync* g_Fences; // Made since the last wait
+static size_t g_FenceCount, g_FenceCapacity;
+static GLuint* g_Written; // Textures queued into since the last wait, each one once
+static size_t g_WrittenCount, g_WrittenCapacity;
+/* Whether anything was queued since the last wait, checked before every consumer */
+static atomic_bool g_Outstanding;
+
+/* Statistics */
+static atomic_ulong g_Queued, g_QueuedBytes, g_Direct, g_Waits, g_WaitNs;
+
+static uint64_t gl_upload_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+static bool gl_upload_resolve() {
+    bool found = true;
+#define GL_UPLOAD_RESOLVE(type, name, parameters) \
+    name##_p = dlsym(RTLD_DEFAULT, #name); \
+    if (name##_p == NULL) name##_p = (void*) eglGetProcAddress_p(#name); \
+    found &= name##_p != NULL;
+    GL_UPLOAD_FUNCTIONS(GL_UPLOAD_RESOLVE)
+#undef GL_UPLOAD_RESOLVE
+    return found;
+}
+
+/** @return the size of a pixel, -1 if uploads of `format` and `type` aren't queued */
+static int gl_upload_pixel_size(GLenum format, GLenum type) {
+    int components;
+    switch (format) {
+        case GL_RGBA: case GL_BGRA: components = 4; break;
+        case GL_RGB: components = 3; break;
+        case GL_RG: case GL_LUMINANCE_ALPHA: components = 2; break;
+        case GL_RED: case GL_ALPHA: case GL_LUMINANCE: components = 1; break;
+        default: return -1;
+    }
+    switch (type) {
+        case GL_UNSIGNED_BYTE: return components;
+        case GL_FLOAT: return components * 4;
+        case GL_UNSIGNED_SHORT_5_6_5: return format == GL_RGB ? 2 : -1;
+        case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1: return format == GL_RGBA ? 2 : -1;
+        case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: return components == 4 ? 4 : -1;
+        default: return -1;
+    }
+}
+
+/** Copy the pixels as the unpack state of `shadow` reads them, into rows aligned to 4 like the upload threads read them. */
+static void gl_upload_copy(uint8_t* destination, const uint8_t* pixels, const gl_upload_shadow_t* shadow,
+                           GLsizei width, GLsizei height, size_t pixelSize) {
+    size_t rowSize = width * pixelSize, packedStride = (rowSize + 3) & ~(size_t) 3;
+    size_t alignment = shadow->alignment > 0 ? (size_t) shadow->alignment : 4;
+    size_t rowPixels = shadow->rowLength > 0 ? (size_t) shadow->rowLength : (size_t) width;
+    size_t stride = (rowPixels * pixelSize + alignment - 1) / alignment * alignment;
+    const uint8_t* source = pixels + shadow->skipRows * stride + shadow->skipPixels * pixelSize;
+    if (stride == packedStride) {
+        memcpy(destination, source, stride * (height - 1) + rowSize);
+        return;
+    }
+    for (GLsizei row = 0; row < height; row++) memcpy(destination + row * packedStride, source + row * stride, rowSize);
+}
+
+/* The lock is held */
+static void gl_upload_submit(gl_upload_thread_t* thread) {
+    gl_upload_batch_t* batch = thread->filling;
+    if (batch == NULL) return;
+    thread->filling = NULL;
+    batch->state = BATCH_QUEUED;
+    thread->queue[(thread->queueHead + thread->queueCount++) % BATCHES_PER_THREAD] = (int) (batch - thread->batches);
+    g_Submitted++;
+    pthread_cond_broadcast(&g_QueuedCond);
+}
+
+/* Upload thread only, with the pixel buffer of `batch` bound */
+static bool gl_upload_map(gl_upload_batch_t* batch) {
+    batch->mapping = glMapBufferRange_p(GL_PIXEL_UNPACK_BUFFER, 0, BATCH_SIZE, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    return batch->mapping != NULL;
+}
+
+static void gl_upload_replay(gl_upload_batch_t* batch) {
+    if (batch->after != NULL) {
+        glWaitSync_p(batch->after, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync_p(batch->after);
+        batch->after = NULL;
+    }
+    glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, batch->buffer);
+    glUnmapBuffer_p(GL_PIXEL_UNPACK_BUFFER);
+    batch->mapping = NULL;
+    GLuint bound = 0;
+    for (uint32_t i = 0; i < batch->jobCount; i++) {
+        const gl_upload_job_t* job = &batch->jobs[i];
+        if (job->texture != bound) glBindTexture_p(GL_TEXTURE_2D, bound = job->texture);
+        glTexSubImage2D_p(GL_TEXTURE_2D, job->level, job->x, job->y, job->width, job->height, job->format, job->type,
+                          (const void*) (uintptr_t) job->offset);
+    }
+    glBindTexture_p(GL_TEXTURE_2D, 0);
+}
+
+static void* gl_upload_main(void* argument) {
+    gl_upload_thread_t* self = argument;
+    pthread_setname_np(pthread_self(), "GLUpload");
+    gl_render_window_t* bundle = gl_init_context((gl_render_window_t*) g_Group->bundle);
+    // Without a native surface, gl_swap_surface() gives it a 1x1 pbuffer
+    if (bundle != NULL) gl_make_current(bundle);
+    if (bundle == NULL || gl_get_current() != bundle) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't make a shared context current, uploads stay on the game thread");
+        return NULL;
+    }
+
+    bool mapped = true;
+    for (int i = 0; i < BATCHES_PER_THREAD && mapped; i++) {
+        gl_upload_batch_t* batch = &self->batches[i];
+        glGenBuffers_p(1, &batch->buffer);
+        glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, batch->buffer);
+        glBufferData_p(GL_PIXEL_UNPACK_BUFFER, BATCH_SIZE, NULL, GL_STREAM_DRAW);
+        mapped = gl_upload_map(batch);
+    }
+    glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (!mapped) {
+        __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't map pixel buffers, uploads stay on the game thread");
+        return NULL;
+    }
+    pthread_mutex_lock(&g_Lock);
+    self->ready = true;
+    while (true) {
+        while (self->queueCount == 0) pthread_cond_wait(&g_QueuedCond, &g_Lock);
+        gl_upload_batch_t* batch = &self->batches[self->queue[self->queueHead]];
+        self->queueHead = (self->queueHead + 1) % BATCHES_PER_THREAD;
+        self->queueCount--;
+        batch->state = BATCH_UPLOADING;
+        pthread_mutex_unlock(&g_Lock);
+
+        gl_upload_replay(batch);
+        GLsync fence = glFenceSync_p(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush_p();
+        // The buffer is orphaned, the uploads from it don't have to be finished
+        glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, batch->buffer);
+        bool remapped = gl_upload_map(batch);
+        glBindBuffer_p(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        pthread_mutex_lock(&g_Lock);
+        if (g_FenceCount == g_FenceCapacity) {
+            size_t capacity = g_FenceCapacity ? g_FenceCapacity * 2 : 16;
+            GLsync* fences = realloc(g_Fences, capacity * sizeof(GLsync));
+            if (fences != NULL) {
+                g_Fences = fences;
+                g_FenceCapacity = capacity;
+            }
+        }
+        // Without room for the fence, the wait is on the CPU
+        if (g_FenceCount < g_FenceCapacity) g_Fences[g_FenceCount++] = fence;
+        else glClientWaitSync_p(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        batch->used = 0;
+        batch->jobCount = 0;
+        if (remapped) {
+            batch->state = BATCH_FREE;
+        } else {
+            // Whatever was queued still gets replayed, nothing new is
+            self->ready = false;
+            __android_log_print(ANDROID_LOG_ERROR, g_LogTag, "Can't map a pixel buffer again, this upload thread stops taking uploads");
+        }
+        g_Fenced++;
+        pthread_cond_broadcast(&g_FencedCond);
+    }
+}
+
+/* The lock is held */
+static void gl_upload_start(const gl_upload_shadow_t* group) {
+    g_Group = group;
+    if (!gl_upload_resolve()) {
+        __android_log_print(ANDROID_LOG_WARN, g_LogTag, "Pixel buffers or fence syncs are missing, uploads stay on the game thread");
+        return;
+    }
+    g_Threads = calloc(g_ThreadCount, sizeof(gl_upload_thread_t));
+    if (g_Threads == NULL) return;
+    for (int i = 0; i < g_ThreadCount; i++) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, gl_upload_main, &g_Threads[i]) == 0) pthread_detach(thread);
+    }
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Started %d upload threads", g_ThreadCount);
+}
+
+/* The lock is held. Atlas stitching uploads into the same few textures, the list stays short. */
+static void gl_upload_written(GLuint texture) {
+    for (size_t i = g_WrittenCount; i > 0; i--)
+        if (g_Written[i - 1] == texture) return;
+    if (g_WrittenCount == g_WrittenCapacity) {
+        size_t capacity = g_WrittenCapacity ? g_WrittenCapacity * 2 : 16;
+        GLuint* written = realloc(g_Written, capacity * sizeof(GLuint));
+        if (written == NULL) abort();
+        g_Written = written;
+        g_WrittenCapacity = capacity;
+    }
+    g_Written[g_WrittenCount++] = texture;
+}
+
+/** @return whether the upload was queued, the driver has to get it otherwise */
+static bool gl_upload_queue(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height,
+                            GLenum format, GLenum type, const void* pixels) {
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow == NULL || target != GL_TEXTURE_2D || pixels == NULL || width <= 0 || height <= 0 ||
+        shadow->unpackBuffer != 0 || shadow->activeTexture >= GL_UPLOAD_UNITS) return false;
+    // The default texture isn't shared
+    GLuint texture = shadow->textures[shadow->activeTexture];
+    int pixelSize = gl_upload_pixel_size(format, type);
+    if (texture == 0 || pixelSize < 0) return false;
+    size_t size = (((size_t) width * pixelSize + 3) & ~(size_t) 3) * height;
+    if (size > BATCH_SIZE) return false;
+
+    pthread_mutex_lock(&g_Lock);
+    if (g_Group == NULL) gl_upload_start(shadow->group);
+    gl_upload_thread_t* thread = g_Threads != NULL && g_Group == shadow->group ? &g_Threads[texture % g_ThreadCount] : NULL;
+    gl_upload_batch_t* batch = thread != NULL ? thread->filling : NULL;
+    if (batch != NULL && (batch->used + size > BATCH_SIZE || batch->jobCount == BATCH_MAX_JOBS)) {
+        gl_upload_submit(thread);
+        batch = NULL;
+    }
+    while (batch == NULL && thread != NULL && thread->ready) {
+        for (int i = 0; i < BATCHES_PER_THREAD && batch == NULL; i++)
+            if (thread->batches[i].state == BATCH_FREE) batch = &thread->batches[i];
+        if (batch == NULL) pthread_cond_wait(&g_FencedCond, &g_Lock);
+    }
+    if (batch == NULL) {
+        pthread_mutex_unlock(&g_Lock);
+        return false;
+    }
+    if (batch->state == BATCH_FREE) {
+        // The upload thread waits for it before the replay, and sees the textures as this context left them
+        batch->after = glFenceSync_p(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush_p();
+    }
+    batch->state = BATCH_FILLING;
+    thread->filling = batch;
+    batch->jobs[batch->jobCount++] = (gl_upload_job_t) { texture, level, xoffset, yoffset, width, height, format, type, batch->used };
+    gl_upload_written(texture);
+    gl_upload_copy(batch->mapping + batch->used, pixels, shadow, width, height, pixelSize);
+    batch->used += size;
+    atomic_store_explicit(&g_Outstanding, true, memory_order_relaxed);
+    pthread_mutex_unlock(&g_Lock);
+
+    atomic_fetch_add_explicit(&g_Queued, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_QueuedBytes, size, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Another context only sees what the upload threads wrote once the texture is attached again, see
+ * appendix D of the GLES 3.0 spec. The textures that are bound already are bound again, the others
+ * get it at their next glBindTexture().
+ */
+static void gl_upload_rebind(const GLuint* written, size_t count) {
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow == NULL || count == 0 || g_Next[UPLOAD_glActiveTexture] == NULL || g_Next[UPLOAD_glBindTexture] == NULL) return;
+    uint32_t active = shadow->activeTexture;
+    for (uint32_t unit = 0; unit < GL_UPLOAD_UNITS; unit++) {
+        GLuint texture = shadow->textures[unit];
+        if (texture == 0) continue;
+        for (size_t i = 0; i < count; i++) {
+            if (written[i] != texture) continue;
+            if (unit != active) NEXT(glActiveTexture, (GLenum)) (GL_TEXTURE0 + (active = unit));
+            NEXT(glBindTexture, (GLenum, GLuint)) (GL_TEXTURE_2D, texture);
+            break;
+        }
+    }
+    if (active != shadow->activeTexture) NEXT(glActiveTexture, (GLenum)) (GL_TEXTURE0 + shadow->activeTexture);
+}
+
+/** Make the current context wait for everything queued so far. */
+static void gl_upload_wait() {
+    if (!atomic_load_explicit(&g_Outstanding, memory_order_relaxed)) return;
+    uint64_t start = gl_upload_now();
+    bool waited = false;
+    pthread_mutex_lock(&g_Lock);
+    for (int i = 0; i < g_ThreadCount && g_Threads != NULL; i++) gl_upload_submit(&g_Threads[i]);
+    while (g_Fenced != g_Submitted) {
+        waited = true;
+        pthread_cond_wait(&g_FencedCond, &g_Lock);
+    }
+    GLsync* fences = g_Fences;
+    size_t count = g_FenceCount;
+    g_Fences = NULL;
+    g_FenceCount = g_FenceCapacity = 0;
+    GLuint* written = g_Written;
+    size_t writtenCount = g_WrittenCount;
+    g_Written = NULL;
+    g_WrittenCount = g_WrittenCapacity = 0;
+    atomic_store_explicit(&g_Outstanding, false, memory_order_relaxed);
+    pthread_mutex_unlock(&g_Lock);
+
+    // On the GPU, the game thread only had to wait for the uploads to be submitted
+    for (size_t i = 0; i < count; i++) {
+        glWaitSync_p(fences[i], 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync_p(fences[i]);
+    }
+    free(fences);
+    gl_upload_rebind(written, writtenCount);
+    free(written);
+    if (waited) {
+        atomic_fetch_add_explicit(&g_Waits, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_WaitNs, gl_upload_now() - start, memory_order_relaxed);
+    }
+}
+
+#define GL_UPLOAD_CONSUMER(name, parameters, arguments) \
+    static void GLAPIENTRY gl_upload_##name parameters { \
+        gl_upload_wait(); \
+        NEXT(name, parameters) arguments; \
+    }
+GL_UPLOAD_CONSUMERS(GL_UPLOAD_CONSUMER)
+#undef GL_UPLOAD_CONSUMER
+
+static void GLAPIENTRY gl_upload_glActiveTexture(GLenum texture) {
+    NEXT(glActiveTexture, (GLenum)) (texture);
+    if (t_Shadow != NULL) t_Shadow->activeTexture = texture - GL_TEXTURE0;
+}
+
+static void GLAPIENTRY gl_upload_glBindTexture(GLenum target, GLuint texture) {
+    NEXT(glBindTexture, (GLenum, GLuint)) (target, texture);
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow != NULL && target == GL_TEXTURE_2D && shadow->activeTexture < GL_UPLOAD_UNITS)
+        shadow->textures[shadow->activeTexture] = texture;
+}
+
+static void GLAPIENTRY gl_upload_glBindBuffer(GLenum target, GLuint buffer) {
+    NEXT(glBindBuffer, (GLenum, GLuint)) (target, buffer);
+    if (t_Shadow != NULL && target == GL_PIXEL_UNPACK_BUFFER) t_Shadow->unpackBuffer = buffer;
+}
+
+static void GLAPIENTRY gl_upload_glPixelStorei(GLenum pname, GLint param) {
+    NEXT(glPixelStorei, (GLenum, GLint)) (pname, param);
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow == NULL) return;
+    switch (pname) {
+        case GL_UNPACK_ALIGNMENT: shadow->alignment = param; break;
+        case GL_UNPACK_ROW_LENGTH: shadow->rowLength = param; break;
+        case GL_UNPACK_SKIP_PIXELS: shadow->skipPixels = param; break;
+        case GL_UNPACK_SKIP_ROWS: shadow->skipRows = param; break;
+        default: break;
+    }
+}
+
+static void GLAPIENTRY gl_upload_glDeleteTextures(GLsizei n, const GLuint* textures) {
+    // Names are reused, queued uploads must not land in the next texture to get one of these
+    gl_upload_wait();
+    NEXT(glDeleteTextures, (GLsizei, const GLuint*)) (n, textures);
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow == NULL || textures == NULL) return;
+    for (GLsizei i = 0; i < n; i++)
+        for (int unit = 0; unit < GL_UPLOAD_UNITS; unit++)
+            if (shadow->textures[unit] == textures[i]) shadow->textures[unit] = 0;
+}
+
+static void GLAPIENTRY gl_upload_glDeleteBuffers(GLsizei n, const GLuint* buffers) {
+    NEXT(glDeleteBuffers, (GLsizei, const GLuint*)) (n, buffers);
+    gl_upload_shadow_t* shadow = t_Shadow;
+    if (shadow == NULL || buffers == NULL) return;
+    for (GLsizei i = 0; i < n; i++)
+        if (shadow->unpackBuffer == buffers[i]) shadow->unpackBuffer = 0;
+}
+
+static void GLAPIENTRY gl_upload_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width,
+                                                 GLsizei height, GLenum format, GLenum type, const void* pixels) {
+    if (gl_upload_queue(target, level, xoffset, yoffset, width, height, format, type, pixels)) return;
+    gl_upload_wait();
+    atomic_fetch_add_explicit(&g_Direct, 1, memory_order_relaxed);
+    NEXT(glTexSubImage2D, (GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*))
+            (target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+typedef struct {
+    const char* name;
+    void* wrapper;
+} gl_upload_entry_t;
+
+#define GL_UPLOAD_ENTRY(name, ...) [UPLOAD_##name] = { #name, (void*) gl_upload_##name },
+static const gl_upload_entry_t g_Entries[UPLOAD_COUNT] = {
+    GL_UPLOAD_CONSUMERS(GL_UPLOAD_ENTRY)
+    GL_UPLOAD_SPECIALS(GL_UPLOAD_ENTRY)
+};
+#undef GL_UPLOAD_ENTRY
+
+void gl_upload_init(const char* setting) {
+    if (setting == NULL) return;
+    int threads = atoi(setting);
+    g_ThreadCount = threads < 1 ? 1 : threads > GL_UPLOAD_MAX_THREADS ? GL_UPLOAD_MAX_THREADS : threads;
+    for (int entry = 0; entry < UPLOAD_COUNT; entry++) g_Slots[entry] = gl_proc_table_slot(g_Entries[entry].name);
+    g_Enabled = true;
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Texture uploads are queued for %d upload threads", g_ThreadCount);
+}
+
+bool gl_upload_enabled() {
+    return g_Enabled;
+}
+
+void* gl_upload_wrap(int slot, void* next) {
+    for (int entry = 0; entry < UPLOAD_COUNT; entry++) {
+        if (g_Slots[entry] != slot) continue;
+        g_Next[entry] = next;
+        return g_Entries[entry].wrapper;
+    }
+    return NULL;
+}
+
+void gl_upload_shadow_init(gl_upload_shadow_t* shadow, void* bundle, const gl_upload_shadow_t* share) {
+    memset(shadow, 0, sizeof(gl_upload_shadow_t));
+    shadow->bundle = bundle;
+    shadow->group = share != NULL ? share->group : shadow;
+    shadow->alignment = 4;
+}
+
+void gl_upload_make_current(gl_upload_shadow_t* shadow) {
+    if (g_Enabled) t_Shadow = shadow;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_CallbackBridge_nativeGetUploadStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!g_Enabled) return JNI_FALSE;
+    jlong values[] = {
+            (jlong) atomic_load_explicit(&g_Queued, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_QueuedBytes, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Direct, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_Waits, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&g_WaitNs, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
@@ -0,0 +1,58 @@
+//
+// Asynchronous texture uploads, enabled with POJAV_GL_UPLOAD_THREADS (the number of upload
+// contexts, 1 to 4, 1 if it isn't a number).
+//
+// The first share group that uploads gets a pool of upload threads, each with a shared context
+// current on a 1x1 pbuffer (see gl_swap_surface()). Every upload thread keeps a few pixel buffer
+// objects mapped. glTexSubImage2D() into a 2D texture copies the pixels into one of them, and the
+// upload thread replays the call from there. Small uploads are batched, as atlas stitching
+// uploads sprites one at a time. Uploads into the same texture go to the same thread, so they stay
+// in order.
+//
+// After each batch, the upload thread makes a fence. Calls that may read or change a texture (every
+// kind of draw, compute dispatches, image bindings, copies, mipmap generation, texture parameters,
+// reads, deletes...) first wait for every queued batch to be submitted, and make their context wait
+// on the fences on the GPU. The written textures that context has bound are then bound again, as
+// a context only has to see changes made by another one once the texture is attached again.
+//
+// The bound textures, unpack buffer and unpack pixel store state are shadowed per context, to avoid a
+// glGet*() for each upload. Uploads that can't be replayed (other targets, an unpack buffer, unknown
+// formats) go to the driver as usual, after the queued ones.
+//
+
+#ifndef POJAVLAUNCHER_GL_UPLOAD_H
+#define POJAVLAUNCHER_GL_UPLOAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GL_UPLOAD_UNITS 32
+
+/* What a context has bound, as far as uploads are concerned */
+typedef struct gl_upload_shadow_s {
+    void* bundle; // The gl_render_window_t of the context
+    const struct gl_upload_shadow_s* group; // The same for every context of a share group
+    uint32_t activeTexture; // As a unit index
+    uint32_t textures[GL_UPLOAD_UNITS]; // GL_TEXTURE_2D of each unit
+    uint32_t unpackBuffer;
+    int32_t alignment, rowLength, skipPixels, skipRows;
+} gl_upload_shadow_t;
+
+/** Call once, before the first pojavGetProcAddress(). `setting` is the value of POJAV_GL_UPLOAD_THREADS. */
+void gl_upload_init(const char* setting);
+
+bool gl_upload_enabled();
+
+/**
+ * @param next what the wrapper of the entry point in table slot `slot` calls
+ * @return the wrapper, NULL if the entry point isn't wrapped
+ */
+void* gl_upload_wrap(int slot, void* next);
+
+/** Reset `shadow` for the new context of `bundle`, `share` is the shadow of the context it shares with, if any. */
+void gl_upload_shadow_init(gl_upload_shadow_t* shadow, void* bundle, const gl_upload_shadow_t* share);
+
+/** From the thread `shadow`'s context (NULL for none) is made current on. */
+void gl_upload_make_current(gl_upload_shadow_t* shadow);
+
+#endif //POJAVLAUNCHER_GL_UPLOAD_H
@@ -13,6 +13,7 @@
 #include "environ/environ.h"
 #include "virgl_bridge.h"
 #include "egl_loader.h"
+#include "egl_config.h"
 #include "osmesa_loader.h"
 #include "renderer_config.h"
 
@@ -86,32 +87,20 @@ int virglInit() {
         return 0;
     }
 
-    static const EGLint attribs[] = {
-            EGL_RED_SIZE, 8,
-            EGL_GREEN_SIZE, 8,
-            EGL_BLUE_SIZE, 8,
-            EGL_ALPHA_SIZE, 8,
+    static const egl_config_request_t request = {
+            .redSize = 8, .greenSize = 8, .blueSize = 8, .alphaSize = 8,
             // Minecraft required on initial 24
-            EGL_DEPTH_SIZE, 24,
-            EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
-            EGL_NONE
+            .depthSize = 24,
+            .surfaceType = EGL_WINDOW_BIT,
+            .renderableType = EGL_OPENGL_ES2_BIT,
+            .nativeVisual = true
     };
 
-    EGLint num_configs;
     EGLint vid;
 
-    if (!eglChooseConfig_p(potatoBridge.eglDisplay, attribs, &config, 1, &num_configs))
-    {
-        printf("EGLBridge: Error couldn't get an EGL visual config: %s\n", eglGetError_p());
-        return 0;
-    }
-
-    assert(config);
-    assert(num_configs > 0);
-
-    if (!eglGetConfigAttrib_p(potatoBridge.eglDisplay, config, EGL_NATIVE_VISUAL_ID, &vid))
+    if (!egl_config_choose(potatoBridge.eglDisplay, &request, &config, &vid))
     {
-        printf("EGLBridge: Error eglGetConfigAttrib() failed: %s\n", eglGetError_p());
+        printf("EGLBridge: Error couldn't get an EGL visual config: %04x\n", eglGetError_p());
         return 0;
     }
 
@@ -20,6 +20,14 @@
 #include "ctxbridges/renderer_config.h"
 #include "utils.h"
 #include "ctxbridges/bridge_tbl.h"
+#include "ctxbridges/gl_proc_table.h"
+#include "ctxbridges/gl_profile.h"
+#include "ctxbridges/gl_state_filter.h"
+#include "ctxbridges/gl_thread.h"
+#include "ctxbridges/gl_present.h"
+#include "ctxbridges/gl_program_cache.h"
+#include "ctxbridges/gl_upload.h"
+#include "ctxbridges/frame_pacer.h"
 
 #define GLFW_CLIENT_API 0x22001
 #define GLFW_NO_API 0
@@ -31,15 +39,14 @@
 
 EXTERNAL_API EGLConfig config = NULL;
 EXTERNAL_API struct PotatoBridge potatoBridge;
+static frame_pacer_t g_FramePacer;
 
 static void* g_GLESv2_Handle = NULL;
 
 // --------------------------------------------------------------------------
 // [调试] 函数地址获取器
 // --------------------------------------------------------------------------
-EXTERNAL_API void* pojavGetProcAddress(const char* procname) {
-    if (!procname) return NULL;
-    
+static void* resolveProcAddress(const char* procname) {
     // [DEBUG] 打印 LWJGL 请求的函数名
     // printf("EGLBridge: Requesting symbol: %s\n", procname);
 
@@ -54,6 +61,11 @@ EXTERNAL_API void* pojavGetProcAddress(const char* procname) {
     if (!addr) {
         addr = dlsym(RTLD_DEFAULT, procname);
     }
+
+    // 3. 扩展函数可能只由厂商驱动通过 eglGetProcAddress 提供
+    if (!addr && eglGetProcAddress_p) {
+        addr = (void*) eglGetProcAddress_p(procname);
+    }
     
     // [DEBUG] 如果找到了核心函数，打印出来确认
     if (addr && strcmp(procname, "glGetString") == 0) {
@@ -63,6 +75,31 @@ EXTERNAL_API void* pojavGetProcAddress(const char* procname) {
     return addr;
 }
 
+EXTERNAL_API void* pojavGetProcAddress(const char* procname) {
+    if (!procname) return NULL;
+
+    // GL entry points come from a table resolved in one go, anything else goes through the linker.
+    // The table is only filled once libGLESv2 is loaded, so that it never misses its symbols.
+    int slot = -1;
+    void* addr = g_GLESv2_Handle ? gl_proc_table_get(procname, resolveProcAddress, &slot) : NULL;
+    if (slot < 0) return resolveProcAddress(procname);
+    if (addr == NULL) return NULL;
+    if (gl_profile_enabled()) addr = gl_profile_wrap(slot);
+    if (gl_upload_enabled())
+    {
+        // Behind the GL thread, the uploads are queued from wherever the context is current
+        void* upload = gl_upload_wrap(slot, addr);
+        if (upload) addr = upload;
+    }
+    if (gl_thread_enabled()) addr = gl_thread_wrap(slot, addr);
+    // The program cache and the filter go in front of the others, which then only see the calls that reach the driver.
+    // Both wrap glLinkProgram, the filter calls the program cache there.
+    void* front = gl_program_cache_enabled() ? gl_program_cache_wrap(slot, addr) : NULL;
+    if (front) addr = front;
+    front = gl_state_filter_enabled() ? gl_state_filter_wrap(slot, addr) : NULL;
+    return front ? front : addr;
+}
+
 // --------------------------------------------------------------------------
 // 初始化
 // --------------------------------------------------------------------------
@@ -89,6 +126,14 @@ int pojavInitOpenGL() {
         }
     }
 
+    gl_profile_init(getenv("POJAV_GL_PROFILE"));
+    gl_state_filter_init(getenv("POJAV_GL_STATE_FILTER"));
+    gl_thread_init(getenv("POJAV_GL_THREAD"));
+    gl_present_init(getenv("POJAV_GL_PRESENT_QUEUE"));
+    gl_program_cache_init(getenv("POJAV_GL_PROGRAM_CACHE"), pojavGetProcAddress);
+    gl_upload_init(getenv("POJAV_GL_UPLOAD_THREADS"));
+    frame_pacer_init(&g_FramePacer, getenv("POJAV_FRAME_CAP"), getenv("POJAV_FRAME_POWER_SAVE") != NULL, NULL);
+
     pojav_environ->config_renderer = RENDERER_GL4ES;
     unsetenv("LIBGL_EGL");
     unsetenv("LIBGL_GLES");
@@ -127,7 +172,15 @@ EXTERNAL_API void pojavMakeCurrent(void* window) {
 
 EXTERNAL_API void pojavSetWindowHint(int hint, int value) { }
 EXTERNAL_API void* pojavCreateContext(void* contextSrc) { return br_init_context((basic_render_window_t*)contextSrc); }
-EXTERNAL_API void pojavSwapBuffers() { br_swap_buffers(); }
+EXTERNAL_API void pojavSwapBuffers() {
+    // A released cursor means a menu or another screen is shown
+    if (frame_pacer_enabled(&g_FramePacer)) frame_pacer_wait(&g_FramePacer, !pojav_environ->isGrabbing);
+    if (pojav_environ->isLateLatching) late_latch_record(&pojav_environ->lateLatch);
+    // With threaded dispatch, the GL thread sums up its own frames
+    if (gl_profile_enabled() && !gl_thread_recording()) gl_profile_frame();
+    br_swap_buffers();
+    frame_time_record(&pojav_environ->frameTime, input_latency_now());
+}
 EXTERNAL_API void pojavSwapInterval(int interval) { br_swap_interval(interval); }
 EXTERNAL_API void pojavTerminate() { }
 EXTERNAL_API void* pojavGetCurrentContext() { return br_get_current(); }
@@ -139,6 +192,30 @@ JNIEXPORT void JNICALL Java_net_kdt_pojavlaunch_utils_JREUtils_setupBridgeWindow
 JNIEXPORT void JNICALL Java_net_kdt_pojavlaunch_utils_JREUtils_releaseBridgeWindow(ABI_COMPAT JNIEnv *env, ABI_COMPAT jclass clazz) {
     if (pojav_environ->pojavWindow) ANativeWindow_release(pojav_environ->pojavWindow);
 }
-EXTERNAL_API JNIEXPORT jint JNICALL Java_org_lwjgl_glfw_CallbackBridge_getCurrentFps(JNIEnv *env, jclass clazz) { return 0; }
+EXTERNAL_API JNIEXPORT jint JNICALL Java_org_lwjgl_glfw_CallbackBridge_getCurrentFps(ABI_COMPAT JNIEnv *env, ABI_COMPAT jclass clazz) {
+    return frame_time_fps(&pojav_environ->frameTime, input_latency_now());
+}
+EXTERNAL_API JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeGetFrameStats(JNIEnv *env, ABI_COMPAT jclass clazz, jlongArray stats) {
+    jlong values[FRAME_TIME_STATS];
+    frame_time_snapshot(&pojav_environ->frameTime, values);
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > FRAME_TIME_STATS) length = FRAME_TIME_STATS;
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+}
+EXTERNAL_API JNIEXPORT jboolean JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeGetFramePacerStats(JNIEnv *env, ABI_COMPAT jclass clazz, jlongArray stats) {
+    if (!frame_pacer_enabled(&g_FramePacer)) return JNI_FALSE;
+    jlong values[FRAME_PACER_STATS];
+    frame_pacer_snapshot(&g_FramePacer, values);
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > FRAME_PACER_STATS) length = FRAME_PACER_STATS;
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+    return JNI_TRUE;
+}
+EXTERNAL_API JNIEXPORT jint JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeCopyFrameTimes(JNIEnv *env, ABI_COMPAT jclass clazz, jobject buffer) {
+    uint32_t* times = (*env)->GetDirectBufferAddress(env, buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, buffer);
+    if (times == NULL || capacity < (jlong) sizeof(uint32_t)) return 0;
+    return (jint) frame_time_copy(&pojav_environ->frameTime, times, (size_t) capacity / sizeof(uint32_t));
+}
 EXTERNAL_API JNIEXPORT jlong JNICALL Java_org_lwjgl_vulkan_VK_getVulkanDriverHandle(ABI_COMPAT JNIEnv *env, ABI_COMPAT jclass thiz) { return 0; }
 EXTERNAL_API void* maybe_load_vulkan() { return NULL; }
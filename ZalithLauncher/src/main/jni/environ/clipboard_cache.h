@@ -0,0 +1,78 @@
+//
+// Native copy of the Android clipboard, so that the game can read it without crossing VMs.
+//
+// The Android side pushes the clipboard text whenever it changes (and whenever the game activity
+// gets focus back, as Android only lets focused apps read the clipboard). Game-side writes update
+// the cache right away and are handed to Android by a writer thread, only the latest one counts.
+//
+
+#ifndef POJAVLAUNCHER_CLIPBOARD_CACHE_H
+#define POJAVLAUNCHER_CLIPBOARD_CACHE_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t writeQueued;
+    char* text; // Latest known clipboard text, NULL until the Android side pushed it
+    char* pendingWrite; // Next text to hand to Android, NULL if there is none
+    bool writerStarted;
+} clipboard_cache_t;
+
+static inline void clipboard_cache_init(clipboard_cache_t* cache) {
+    pthread_mutex_init(&cache->lock, NULL);
+    pthread_cond_init(&cache->writeQueued, NULL);
+}
+
+static inline void clipboard_cache_set_locked(clipboard_cache_t* cache, char* text) {
+    free(cache->text);
+    cache->text = text;
+}
+
+/** The clipboard changed on the Android side. The text is copied. */
+static inline void clipboard_cache_update(clipboard_cache_t* cache, const char* text) {
+    char* copy = strdup(text);
+    pthread_mutex_lock(&cache->lock);
+    clipboard_cache_set_locked(cache, copy);
+    pthread_mutex_unlock(&cache->lock);
+}
+
+/** @return a copy of the cached text to free(), NULL if nothing was pushed yet */
+static inline char* clipboard_cache_read(clipboard_cache_t* cache) {
+    pthread_mutex_lock(&cache->lock);
+    char* copy = cache->text ? strdup(cache->text) : NULL;
+    pthread_mutex_unlock(&cache->lock);
+    return copy;
+}
+
+/**
+ * The game wrote to the clipboard. Takes ownership of `text`.
+ * @return true if the writer thread still has to be started
+ */
+static inline bool clipboard_cache_write(clipboard_cache_t* cache, char* text) {
+    char* copy = strdup(text);
+    pthread_mutex_lock(&cache->lock);
+    clipboard_cache_set_locked(cache, copy);
+    free(cache->pendingWrite);
+    cache->pendingWrite = text;
+    bool startWriter = !cache->writerStarted;
+    cache->writerStarted = true;
+    pthread_cond_signal(&cache->writeQueued);
+    pthread_mutex_unlock(&cache->lock);
+    return startWriter;
+}
+
+/** Writer thread. Blocks until a write is queued, then returns its text to free(). */
+static inline char* clipboard_cache_take_write(clipboard_cache_t* cache) {
+    pthread_mutex_lock(&cache->lock);
+    while (cache->pendingWrite == NULL) pthread_cond_wait(&cache->writeQueued, &cache->lock);
+    char* text = cache->pendingWrite;
+    cache->pendingWrite = NULL;
+    pthread_mutex_unlock(&cache->lock);
+    return text;
+}
+
+#endif //POJAVLAUNCHER_CLIPBOARD_CACHE_H
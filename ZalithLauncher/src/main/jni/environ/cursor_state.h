@@ -0,0 +1,101 @@
+//
+// Cursor position shared between the Android UI thread and the game thread.
+//
+// Reads go through a seqlock, so the game thread never sees the X of one update together with the
+// Y of the next one, and never takes a lock. Writers (the UI thread moving the cursor, the game
+// thread calling glfwSetCursorPos()) serialize on the sequence counter itself.
+//
+// Next to the absolute position, the motion between consecutive UI samples is summed up, so that
+// grabbed-camera mode can apply every bit of sub-pixel motion that happened during a frame.
+//
+
+#ifndef POJAVLAUNCHER_CURSOR_STATE_H
+#define POJAVLAUNCHER_CURSOR_STATE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <sched.h>
+
+typedef struct {
+    atomic_uint seq; // Odd while a writer is updating the fields below
+    _Atomic double x, y; // Latest absolute position
+    _Atomic double dx, dy; // Motion since the last cursor_state_take_motion()
+    double sampleX, sampleY; // Last UI sample, used to compute the motion. Only touched by writers.
+    bool hasSample;
+} cursor_state_t;
+
+static inline void cursor_state_write_lock(cursor_state_t* cursor) {
+    unsigned seq = atomic_load_explicit(&cursor->seq, memory_order_relaxed);
+    for (;;) {
+        if ((seq & 1) == 0 && atomic_compare_exchange_weak_explicit(&cursor->seq, &seq, seq + 1,
+                                                                   memory_order_acquire, memory_order_relaxed))
+            break;
+        if (seq & 1) {
+            sched_yield();
+            seq = atomic_load_explicit(&cursor->seq, memory_order_relaxed);
+        }
+    }
+    // Field stores must not become visible before the sequence turns odd
+    atomic_thread_fence(memory_order_release);
+}
+
+static inline void cursor_state_write_unlock(cursor_state_t* cursor) {
+    atomic_fetch_add_explicit(&cursor->seq, 1, memory_order_release);
+}
+
+/** UI thread. A new cursor sample came in from Android. */
+static inline void cursor_state_move(cursor_state_t* cursor, double x, double y) {
+    cursor_state_write_lock(cursor);
+    if (cursor->hasSample) {
+        atomic_store_explicit(&cursor->dx, atomic_load_explicit(&cursor->dx, memory_order_relaxed) + (x - cursor->sampleX), memory_order_relaxed);
+        atomic_store_explicit(&cursor->dy, atomic_load_explicit(&cursor->dy, memory_order_relaxed) + (y - cursor->sampleY), memory_order_relaxed);
+    }
+    cursor->sampleX = x;
+    cursor->sampleY = y;
+    cursor->hasSample = true;
+    atomic_store_explicit(&cursor->x, x, memory_order_relaxed);
+    atomic_store_explicit(&cursor->y, y, memory_order_relaxed);
+    cursor_state_write_unlock(cursor);
+}
+
+/** Game thread. The position was moved by the game (glfwSetCursorPos()), pending motion is kept. */
+static inline void cursor_state_set(cursor_state_t* cursor, double x, double y) {
+    cursor_state_write_lock(cursor);
+    atomic_store_explicit(&cursor->x, x, memory_order_relaxed);
+    atomic_store_explicit(&cursor->y, y, memory_order_relaxed);
+    cursor_state_write_unlock(cursor);
+}
+
+/** Any thread. Consistent snapshot of the absolute position. */
+static inline void cursor_state_read(cursor_state_t* cursor, double* x, double* y) {
+    unsigned seq;
+    do {
+        seq = atomic_load_explicit(&cursor->seq, memory_order_acquire);
+        *x = atomic_load_explicit(&cursor->x, memory_order_relaxed);
+        *y = atomic_load_explicit(&cursor->y, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || seq != atomic_load_explicit(&cursor->seq, memory_order_relaxed));
+}
+
+/** Any thread. Motion summed up since the last cursor_state_take_motion(), left in place. */
+static inline void cursor_state_peek_motion(cursor_state_t* cursor, double* dx, double* dy) {
+    unsigned seq;
+    do {
+        seq = atomic_load_explicit(&cursor->seq, memory_order_acquire);
+        *dx = atomic_load_explicit(&cursor->dx, memory_order_relaxed);
+        *dy = atomic_load_explicit(&cursor->dy, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || seq != atomic_load_explicit(&cursor->seq, memory_order_relaxed));
+}
+
+/** Game thread. Returns the motion summed up since the previous call and starts over from zero. */
+static inline void cursor_state_take_motion(cursor_state_t* cursor, double* dx, double* dy) {
+    cursor_state_write_lock(cursor);
+    *dx = atomic_load_explicit(&cursor->dx, memory_order_relaxed);
+    *dy = atomic_load_explicit(&cursor->dy, memory_order_relaxed);
+    atomic_store_explicit(&cursor->dx, 0, memory_order_relaxed);
+    atomic_store_explicit(&cursor->dy, 0, memory_order_relaxed);
+    cursor_state_write_unlock(cursor);
+}
+
+#endif //POJAVLAUNCHER_CURSOR_STATE_H
@@ -8,17 +8,16 @@
 #include <ctxbridges/common.h>
 #include <stdatomic.h>
 #include <jni.h>
-
-/* How many events can be handled at the same time */
-#define EVENT_WINDOW_SIZE 8000
-
-typedef struct {
-    int type;
-    int i1;
-    int i2;
-    int i3;
-    int i4;
-} GLFWInputEvent;
+#include <jni_env_cache.h>
+#include "input_ring.h"
+#include "input_latency.h"
+#include "cursor_state.h"
+#include "input_overflow.h"
+#include "input_trace.h"
+#include "clipboard_cache.h"
+#include "late_latch.h"
+#include "frame_time.h"
+#include "key_state.h"
 
 typedef void GLFW_invoke_Char_func(void* window, unsigned int codepoint);
 typedef void GLFW_invoke_CharMods_func(void* window, unsigned int codepoint, int mods);
@@ -30,18 +29,23 @@ typedef void GLFW_invoke_MouseButton_func(void* window, int button, int action,
 typedef void GLFW_invoke_Scroll_func(void* window, double xoffset, double yoffset);
 typedef void GLFW_invoke_WindowSize_func(void* window, int width, int height);
 
+/* Run of events in the current pumping round that belong to one window, see partitionEvents() */
+typedef struct {
+    input_ring_t* ring;
+    size_t start, end;
+    long window; // 0 if no window was shown yet when they were queued: every window gets them
+    bool measured; // Latencies were recorded already
+} input_span_t;
+#define INPUT_MAX_SPANS 32
+
 struct pojav_environ_s {
     struct ANativeWindow* pojavWindow;
     basic_render_window_t* mainWindowBundle;
     int config_renderer;
     bool force_vsync;
-    atomic_size_t eventCounter; // Count the number of events to be pumped out
-    GLFWInputEvent events[EVENT_WINDOW_SIZE];
-    size_t outEventIndex; // Point to the current event that has yet to be pumped out to MC
-    size_t outTargetIndex; // Point to the newt index to stop by
-    size_t inEventIndex; // Point to the next event that has to be filled
-    size_t inEventCount; // Count registered right before pumping OUT events. Used as a cache.
-    double cursorX, cursorY, cLastX, cLastY;
+    // Kept on its own cache line, away from the input ring and the UI-thread fields around it
+    _Alignas(INPUT_RING_CACHE_LINE) cursor_state_t cursor;
+    double cLastX, cLastY; // Position last sent to the game. Only touched by the game thread.
     jmethodID method_accessAndroidClipboard;
     jmethodID method_onGrabStateChanged;
     jmethodID method_glftSetWindowAttrib;
@@ -51,13 +55,37 @@ struct pojav_environ_s {
     jboolean isGrabbing;
     jbyte* keyDownBuffer;
     jbyte* mouseDownBuffer;
+    key_state_t keyState; // Packed copy of both buffers, see key_state.h
     JavaVM* runtimeJavaVMPtr;
     JNIEnv* runtimeJNIEnvPtr_JRE;
     JavaVM* dalvikJavaVMPtr;
     JNIEnv* dalvikJNIEnvPtr_ANDROID;
+    jni_env_cache_t dalvikEnvCache, runtimeEnvCache; // For upcalls from threads of the other VM
+    clipboard_cache_t clipboard;
     long showingWindow;
     bool isInputReady, isCursorEntered, isUseStackQueueCall, shouldUpdateMouse;
     int savedWidth, savedHeight;
+    bool isInputCoalescing; // Merge resize bursts and scroll deltas before dispatching them
+    size_t foldedResizeEvents, foldedScrollEvents; // How many events the coalescing pass merged away
+    bool isInputLatencyTracking; // Timestamp events on enqueue and dispatch, see input_latency.h
+    bool latencyPending; // Set by pojavStartPumping(), each span records latencies the first time it is dispatched
+    input_latency_t inputLatency;
+    bool isLateLatching; // POJAV_LATE_LATCH, see late_latch.h
+    late_latch_t lateLatch;
+    frame_time_t frameTime; // Recorded by pojavSwapBuffers() for every bridge
+    int inputOverflowPolicy; // What to do with events that don't fit in the ring, see input_overflow.h
+    input_ring_t* _Atomic overflowRing; // Second segment, allocated by the producer on the first overflow
+    input_ring_t* pumpingOverflowRing; // overflowRing as seen by pojavStartPumping(). Only touched by the game thread.
+    atomic_size_t droppedEvents, mailboxedEvents; // Events that didn't fit: lost, or folded into inputOverflow
+    atomic_size_t queueHighWater; // Most events ever claimed by a single pumping round
+    input_overflow_t inputOverflow;
+    input_overflow_pending_t overflowPending; // Mailbox content of the current round. Only touched by the game thread.
+    input_trace_writer_t inputTrace; // Open while POJAV_INPUT_RECORD is set
+    atomic_bool isInputReplaying; // Live input is ignored while a trace from POJAV_INPUT_REPLAY is replayed
+    long routedWindow; // Window of the last route marker the producer queued, see queueEvents()
+    long pumpRouteWindow; // Window the next unmarked events belong to. Only touched by the game thread.
+    input_span_t pumpSpans[INPUT_MAX_SPANS]; // Per-window runs of the current round. Only touched by the game thread.
+    size_t pumpSpanCount;
 #define ADD_CALLBACK_WWIN(NAME) \
     GLFW_invoke_##NAME##_func* GLFW_invoke_##NAME;
     ADD_CALLBACK_WWIN(Char);
@@ -71,6 +99,7 @@ struct pojav_environ_s {
     ADD_CALLBACK_WWIN(WindowSize);
 
 #undef ADD_CALLBACK_WWIN
+    input_ring_t inputRing;
 };
 extern struct pojav_environ_s *pojav_environ;
 
@@ -0,0 +1,84 @@
+//
+// Rolling FPS and percentile computation over the frame time ring.
+//
+
+#include <stdlib.h>
+#include "frame_time.h"
+
+#define NS_PER_SECOND 1000000000ULL
+
+size_t frame_time_copy(frame_time_t* frameTime, uint32_t* out, size_t capacity) {
+    uint64_t frames = atomic_load_explicit(&frameTime->frames, memory_order_acquire);
+    uint64_t count = frames < FRAME_TIME_HISTORY ? frames : FRAME_TIME_HISTORY;
+    if (count > capacity) count = capacity;
+    for (uint64_t i = 0; i < count; i++)
+        out[i] = atomic_load_explicit(&frameTime->times_us[(frames - count + i) % FRAME_TIME_HISTORY], memory_order_relaxed);
+    // The writer may have lapped the oldest entries while they were copied, and may be writing the next one
+    atomic_thread_fence(memory_order_acquire);
+    uint64_t written = atomic_load_explicit(&frameTime->frames, memory_order_relaxed);
+    uint64_t firstValid = written + 1 > FRAME_TIME_HISTORY ? written + 1 - FRAME_TIME_HISTORY : 0;
+    uint64_t first = frames - count;
+    if (first >= firstValid) return count;
+    uint64_t skip = firstValid - first;
+    if (skip >= count) return 0;
+    for (uint64_t i = skip; i < count; i++) out[i - skip] = out[i];
+    return count - skip;
+}
+
+int frame_time_fps(frame_time_t* frameTime, uint64_t now_ns) {
+    uint64_t swap = atomic_load_explicit(&frameTime->lastSwap, memory_order_relaxed);
+    if (swap == 0 || now_ns < swap || now_ns - swap >= NS_PER_SECOND) return 0;
+    uint32_t times[FRAME_TIME_HISTORY];
+    size_t count = frame_time_copy(frameTime, times, FRAME_TIME_HISTORY);
+    // Walk back from the newest swap, the one at `swap` is in the window already
+    uint64_t age = now_ns - swap;
+    int swaps = 1;
+    for (size_t i = count; i > 0; i--) {
+        age += (uint64_t) times[i - 1] * 1000;
+        if (age >= NS_PER_SECOND) return swaps;
+        swaps++;
+    }
+    // Less than a second of frames so far: `count` frames took `age`
+    return count ? (int) ((count * NS_PER_SECOND + age / 2) / age) : 0;
+}
+
+static int compare_times(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*) a, y = *(const uint32_t*) b;
+    return (x > y) - (x < y);
+}
+
+// Nearest rank
+static int64_t percentile(const uint32_t* sorted, size_t count, unsigned permille) {
+    size_t rank = (count * permille + 999) / 1000;
+    return sorted[rank ? rank - 1 : 0];
+}
+
+// Average of the slowest count * permille / 1000 frames, at least one
+static int64_t low(const uint32_t* sorted, size_t count, unsigned permille) {
+    size_t slowest = count * permille / 1000;
+    if (slowest == 0) slowest = 1;
+    uint64_t sum = 0;
+    for (size_t i = count - slowest; i < count; i++) sum += sorted[i];
+    return (int64_t) (sum / slowest);
+}
+
+void frame_time_snapshot(frame_time_t* frameTime, int64_t* out) {
+    uint32_t times[FRAME_TIME_HISTORY];
+    size_t count = frame_time_copy(frameTime, times, FRAME_TIME_HISTORY);
+    out[0] = (int64_t) atomic_load_explicit(&frameTime->frames, memory_order_relaxed);
+    out[1] = (int64_t) count;
+    if (count == 0) {
+        for (int i = 2; i < FRAME_TIME_STATS; i++) out[i] = 0;
+        return;
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) sum += times[i];
+    qsort(times, count, sizeof(uint32_t), compare_times);
+    out[2] = (int64_t) (sum / count);
+    out[3] = percentile(times, count, 500);
+    out[4] = percentile(times, count, 950);
+    out[5] = percentile(times, count, 990);
+    out[6] = times[count - 1];
+    out[7] = low(times, count, 10);
+    out[8] = low(times, count, 1);
+}
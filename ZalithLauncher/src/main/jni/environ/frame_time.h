@@ -0,0 +1,58 @@
+//
+// Frame time telemetry: pojavSwapBuffers() timestamps every swap, whatever the bridge.
+//
+// The time between two swaps goes into a lock-free ring of the last FRAME_TIME_HISTORY frames.
+// Only the game thread records into it, any thread may read it: readers copy the ring and throw
+// away the entries the writer may have overwritten meanwhile.
+//
+
+#ifndef POJAVLAUNCHER_FRAME_TIME_H
+#define POJAVLAUNCHER_FRAME_TIME_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Power of two, about 17 seconds at 60 FPS */
+#define FRAME_TIME_HISTORY 1024
+/* Values reported by frame_time_snapshot(): frames, history length, average, p50, p95, p99, max, 1% low, 0.1% low */
+#define FRAME_TIME_STATS 9
+
+typedef struct {
+    atomic_uint_fast64_t lastSwap; // When the newest frame was swapped, CLOCK_MONOTONIC nanoseconds, 0 before the first swap
+    atomic_uint_fast64_t frames; // Frame times written so far, the newest one is at (frames - 1) % FRAME_TIME_HISTORY
+    _Atomic uint32_t times_us[FRAME_TIME_HISTORY];
+} frame_time_t;
+
+/** Game thread, after each buffer swap. */
+static inline void frame_time_record(frame_time_t* frameTime, uint64_t now_ns) {
+    uint64_t last = atomic_load_explicit(&frameTime->lastSwap, memory_order_relaxed);
+    atomic_store_explicit(&frameTime->lastSwap, now_ns, memory_order_relaxed);
+    if (last == 0 || now_ns <= last) return;
+    uint64_t us = (now_ns - last) / 1000;
+    // Single writer: the slot is written before the frame is published
+    uint64_t frames = atomic_load_explicit(&frameTime->frames, memory_order_relaxed);
+    atomic_store_explicit(&frameTime->times_us[frames % FRAME_TIME_HISTORY], us < UINT32_MAX ? (uint32_t) us : UINT32_MAX,
+                          memory_order_relaxed);
+    atomic_store_explicit(&frameTime->frames, frames + 1, memory_order_release);
+}
+
+/**
+ * Copies the newest frame times, oldest first.
+ * @param out room for `capacity` frame times, in microseconds
+ * @return how many were copied
+ */
+size_t frame_time_copy(frame_time_t* frameTime, uint32_t* out, size_t capacity);
+
+/** Frames swapped during the second before `now_ns`, extrapolated if the history doesn't go back that far. */
+int frame_time_fps(frame_time_t* frameTime, uint64_t now_ns);
+
+/**
+ * Computes the frame count, how many frames the history holds, and the average, p50, p95, p99 and max frame
+ * time over the history, in microseconds. The lows are the average time of the slowest 1% and 0.1% frames
+ * (at least one), 1000000 / low is the "1% low" FPS.
+ * @param out FRAME_TIME_STATS values
+ */
+void frame_time_snapshot(frame_time_t* frameTime, int64_t* out);
+
+#endif //POJAVLAUNCHER_FRAME_TIME_H
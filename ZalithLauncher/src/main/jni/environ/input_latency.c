@@ -0,0 +1,76 @@
+//
+// Percentile computation and reporting for the input latency histograms.
+//
+
+#include <android/log.h>
+#include "input_latency.h"
+
+static const char* g_LogTag = "InputLatency";
+static const char* const g_TypeNames[INPUT_LATENCY_TYPES] = {
+        "char", "char_mods", "cursor_enter", "cursor_pos", "framebuffer_size",
+        "key", "mouse_button", "scroll", "window_size"
+};
+
+// Upper bound of a bucket, so that percentiles are never reported lower than they were
+static uint64_t bucket_upper_bound(int bucket) {
+    if (bucket < 4) return (uint64_t) bucket;
+    int octave = bucket / 4 + 1;
+    uint64_t lower = (uint64_t) (4 + bucket % 4) << (octave - 2);
+    return lower + ((uint64_t) 1 << (octave - 2)) - 1;
+}
+
+static uint64_t percentile(const uint64_t* buckets, uint64_t count, unsigned permille) {
+    uint64_t rank = (count * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for (int i = 0; i < INPUT_LATENCY_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) return bucket_upper_bound(i);
+    }
+    return bucket_upper_bound(INPUT_LATENCY_BUCKETS - 1);
+}
+
+void input_latency_snapshot(input_latency_t* latency, int64_t* out) {
+    for (int type = 0; type < INPUT_LATENCY_TYPES; type++) {
+        input_latency_histogram_t* histogram = &latency->types[type];
+        uint64_t buckets[INPUT_LATENCY_BUCKETS];
+        uint64_t count = 0;
+        // Sum the buckets instead of trusting histogram->count, the writer may be halfway through
+        for (int i = 0; i < INPUT_LATENCY_BUCKETS; i++) {
+            buckets[i] = atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+            count += buckets[i];
+        }
+        int64_t* stats = &out[type * INPUT_LATENCY_STATS];
+        int64_t max = (int64_t) atomic_load_explicit(&histogram->max_us, memory_order_relaxed);
+        stats[0] = (int64_t) count;
+        // A bucket bound can be past the largest value that actually landed in the bucket
+        for (int i = 0; i < 3; i++) {
+            static const unsigned permilles[] = { 500, 950, 990 };
+            int64_t value = count ? (int64_t) percentile(buckets, count, permilles[i]) : 0;
+            stats[1 + i] = value < max ? value : max;
+        }
+        stats[4] = max;
+    }
+}
+
+void input_latency_reset(input_latency_t* latency) {
+    for (int type = 0; type < INPUT_LATENCY_TYPES; type++) {
+        input_latency_histogram_t* histogram = &latency->types[type];
+        for (int i = 0; i < INPUT_LATENCY_BUCKETS; i++)
+            atomic_store_explicit(&histogram->buckets[i], 0, memory_order_relaxed);
+        atomic_store_explicit(&histogram->count, 0, memory_order_relaxed);
+        atomic_store_explicit(&histogram->max_us, 0, memory_order_relaxed);
+    }
+}
+
+void input_latency_dump(input_latency_t* latency) {
+    int64_t stats[INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS];
+    input_latency_snapshot(latency, stats);
+    __android_log_print(ANDROID_LOG_INFO, g_LogTag, "Input queueing latency (us):");
+    for (int type = 0; type < INPUT_LATENCY_TYPES; type++) {
+        int64_t* s = &stats[type * INPUT_LATENCY_STATS];
+        if (s[0] == 0) continue;
+        __android_log_print(ANDROID_LOG_INFO, g_LogTag, "%-16s n=%lld p50=%lld p95=%lld p99=%lld max=%lld",
+                            g_TypeNames[type], (long long) s[0], (long long) s[1], (long long) s[2],
+                            (long long) s[3], (long long) s[4]);
+    }
+}
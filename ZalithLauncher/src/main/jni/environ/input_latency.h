@@ -0,0 +1,68 @@
+//
+// Input queueing latency: time between sendData() and the dispatch of the event in pojavPumpEvents().
+//
+// Every event type gets a lock-free log-linear histogram with microsecond resolution. Only the
+// game thread records into them, any thread may read them.
+//
+
+#ifndef POJAVLAUNCHER_INPUT_LATENCY_H
+#define POJAVLAUNCHER_INPUT_LATENCY_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <time.h>
+
+/* Event types go from EVENT_TYPE_CHAR (1000) to EVENT_TYPE_WINDOW_SIZE (1008) */
+#define INPUT_LATENCY_FIRST_TYPE 1000
+#define INPUT_LATENCY_TYPES 9
+/* 4 buckets per power of two, the last one also holds everything above ~131ms */
+#define INPUT_LATENCY_BUCKETS 64
+/* Values reported per event type by input_latency_snapshot(): count, p50, p95, p99, max */
+#define INPUT_LATENCY_STATS 5
+
+typedef struct {
+    atomic_uint_fast64_t buckets[INPUT_LATENCY_BUCKETS];
+    atomic_uint_fast64_t count;
+    atomic_uint_fast64_t max_us;
+} input_latency_histogram_t;
+
+typedef struct {
+    input_latency_histogram_t types[INPUT_LATENCY_TYPES];
+} input_latency_t;
+
+static inline uint64_t input_latency_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static inline int input_latency_bucket(uint64_t us) {
+    if (us < 4) return (int) us;
+    int octave = 63 - __builtin_clzll(us);
+    int bucket = (octave - 1) * 4 + (int) ((us >> (octave - 2)) & 3);
+    return bucket < INPUT_LATENCY_BUCKETS ? bucket : INPUT_LATENCY_BUCKETS - 1;
+}
+
+/** Game thread only. Records the latency of one dispatched event. */
+static inline void input_latency_record(input_latency_t* latency, int type, uint64_t enqueue_ns, uint64_t dispatch_ns) {
+    unsigned index = (unsigned) (type - INPUT_LATENCY_FIRST_TYPE);
+    if (index >= INPUT_LATENCY_TYPES || enqueue_ns == 0 || dispatch_ns < enqueue_ns) return;
+    input_latency_histogram_t* histogram = &latency->types[index];
+    uint64_t us = (dispatch_ns - enqueue_ns) / 1000;
+    atomic_uint_fast64_t* bucket = &histogram->buckets[input_latency_bucket(us)];
+    // Single writer: no need for a read-modify-write, readers only need to see whole values
+    atomic_store_explicit(bucket, atomic_load_explicit(bucket, memory_order_relaxed) + 1, memory_order_relaxed);
+    atomic_store_explicit(&histogram->count, atomic_load_explicit(&histogram->count, memory_order_relaxed) + 1, memory_order_relaxed);
+    if (us > atomic_load_explicit(&histogram->max_us, memory_order_relaxed))
+        atomic_store_explicit(&histogram->max_us, us, memory_order_relaxed);
+}
+
+/**
+ * Computes count, p50, p95, p99 and max (in microseconds) for every event type.
+ * @param out INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS values
+ */
+void input_latency_snapshot(input_latency_t* latency, int64_t* out);
+void input_latency_reset(input_latency_t* latency);
+void input_latency_dump(input_latency_t* latency);
+
+#endif //POJAVLAUNCHER_INPUT_LATENCY_H
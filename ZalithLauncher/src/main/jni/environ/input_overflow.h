@@ -0,0 +1,132 @@
+//
+// What happens to input events that don't fit in the input ring anymore.
+//
+// When the game thread stalls (world save, GC pause), the Android UI thread keeps producing events.
+// Depending on POJAV_INPUT_OVERFLOW, the overflow is handled in one of these ways:
+// - coalesce (default): events that don't fit are folded into a small mailbox when they can be
+//   (scroll deltas are summed, only the latest size is kept, key and mouse button releases are
+//   remembered), everything else is dropped
+// - grow: a second ring segment is allocated and filled once the first one is full, the mailbox
+//   only takes over when both are full
+// - drop_oldest: like grow, but once the second segment is in use the stale events of the first one
+//   are discarded at the next pump, only key/button releases and resizes are still delivered
+//
+// The mailbox is lock-free: the producer folds into it with atomics, the consumer takes it as a whole
+// at the start of every pumping round and dispatches it after the queued events. Until then, the
+// producer keeps sending new events to the mailbox, so a release can't be overtaken by a later press.
+// The producer also remembers the ring heads when the mailbox becomes active: what was queued before
+// them is older than the mailbox, so the consumer holds the mailbox back until it claimed all of it.
+//
+
+#ifndef POJAVLAUNCHER_INPUT_OVERFLOW_H
+#define POJAVLAUNCHER_INPUT_OVERFLOW_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define INPUT_OVERFLOW_COALESCE 0
+#define INPUT_OVERFLOW_GROW 1
+#define INPUT_OVERFLOW_DROP_OLDEST 2
+
+/* GLFW key codes go up to GLFW_KEY_LAST (348) */
+#define INPUT_OVERFLOW_KEYS 352
+#define INPUT_OVERFLOW_KEY_WORDS (INPUT_OVERFLOW_KEYS / 32)
+#define INPUT_OVERFLOW_MOUSE_BUTTONS 8
+
+typedef struct {
+    atomic_bool active; // Set by the producer once something went to the mailbox, cleared by input_overflow_take()
+    atomic_int scrollX, scrollY;
+    atomic_uint_fast64_t framebufferSize; // width << 32 | height, 0 if there is none
+    atomic_uint_fast64_t windowSize;
+    atomic_uint keyReleases[INPUT_OVERFLOW_KEY_WORDS];
+    atomic_uint mouseReleases;
+    atomic_size_t ringHead, segmentHead; // Ring heads when the mailbox became active, see input_overflow_open()
+} input_overflow_t;
+
+/* Consumer-side copy of the mailbox, taken by input_overflow_take() */
+typedef struct {
+    int scrollX, scrollY;
+    uint64_t framebufferSize, windowSize;
+    uint32_t keyReleases[INPUT_OVERFLOW_KEY_WORDS];
+    uint32_t mouseReleases;
+    bool hasAny; // Whether there is something to dispatch this round
+} input_overflow_pending_t;
+
+static inline int input_overflow_parse_policy(const char* policy) {
+    if (policy == NULL) return INPUT_OVERFLOW_COALESCE;
+    if (!strcmp(policy, "grow")) return INPUT_OVERFLOW_GROW;
+    if (!strcmp(policy, "drop_oldest")) return INPUT_OVERFLOW_DROP_OLDEST;
+    return INPUT_OVERFLOW_COALESCE;
+}
+
+static inline uint64_t input_overflow_pack_size(int width, int height) {
+    return (uint64_t) (uint32_t) width << 32 | (uint32_t) height;
+}
+
+/**
+ * Producer only. Call before folding anything into a mailbox that isn't active yet.
+ * @param segmentHead head of the second segment, 0 if there is none
+ */
+static inline void input_overflow_open(input_overflow_t* overflow, size_t ringHead, size_t segmentHead) {
+    atomic_store_explicit(&overflow->ringHead, ringHead, memory_order_relaxed);
+    atomic_store_explicit(&overflow->segmentHead, segmentHead, memory_order_relaxed);
+}
+
+// Folding is a release: whoever takes a folded event also sees the heads stored before it
+static inline void input_overflow_add_scroll(input_overflow_t* overflow, int x, int y) {
+    atomic_fetch_add_explicit(&overflow->scrollX, x, memory_order_release);
+    atomic_fetch_add_explicit(&overflow->scrollY, y, memory_order_release);
+}
+
+static inline void input_overflow_set_size(atomic_uint_fast64_t* size, int width, int height) {
+    atomic_store_explicit(size, input_overflow_pack_size(width, height), memory_order_release);
+}
+
+/** @return false if the key can't be remembered */
+static inline bool input_overflow_add_key_release(input_overflow_t* overflow, int key) {
+    if (key < 0 || key >= INPUT_OVERFLOW_KEYS) return false;
+    atomic_fetch_or_explicit(&overflow->keyReleases[key / 32], 1u << (key % 32), memory_order_release);
+    return true;
+}
+
+/** @return false if the button can't be remembered */
+static inline bool input_overflow_add_mouse_release(input_overflow_t* overflow, int button) {
+    if (button < 0 || button >= INPUT_OVERFLOW_MOUSE_BUTTONS) return false;
+    atomic_fetch_or_explicit(&overflow->mouseReleases, 1u << button, memory_order_release);
+    return true;
+}
+
+/**
+ * Consumer only. Moves the content of the mailbox into `pending`, on top of what was held back there
+ * in earlier rounds, and empties it. Sizes replace the held ones, scrolling and releases add up.
+ * @return whether `pending` holds anything
+ */
+static inline bool input_overflow_take(input_overflow_t* overflow, input_overflow_pending_t* pending) {
+    atomic_store_explicit(&overflow->active, false, memory_order_seq_cst);
+    pending->scrollX += atomic_exchange_explicit(&overflow->scrollX, 0, memory_order_acquire);
+    pending->scrollY += atomic_exchange_explicit(&overflow->scrollY, 0, memory_order_acquire);
+    uint64_t size = atomic_exchange_explicit(&overflow->framebufferSize, 0, memory_order_acquire);
+    if (size) pending->framebufferSize = size;
+    size = atomic_exchange_explicit(&overflow->windowSize, 0, memory_order_acquire);
+    if (size) pending->windowSize = size;
+    uint32_t any = pending->mouseReleases |= atomic_exchange_explicit(&overflow->mouseReleases, 0, memory_order_acquire);
+    for (int i = 0; i < INPUT_OVERFLOW_KEY_WORDS; i++)
+        any |= pending->keyReleases[i] |= atomic_exchange_explicit(&overflow->keyReleases[i], 0, memory_order_acquire);
+    return any || pending->scrollX || pending->scrollY || pending->framebufferSize || pending->windowSize;
+}
+
+/**
+ * Consumer only. Call after input_overflow_take(): whether the claimed events reach the heads the
+ * mailbox was opened at, so that what was taken is newer than everything queued before it.
+ * @param segmentTarget read target of the second segment, 0 if it wasn't claimed
+ */
+static inline bool input_overflow_reached(input_overflow_t* overflow, size_t ringTarget, size_t segmentTarget) {
+    // The heads only grow, the difference stays right when they wrap around
+    return (intptr_t) (ringTarget - atomic_load_explicit(&overflow->ringHead, memory_order_acquire)) >= 0
+           && (intptr_t) (segmentTarget - atomic_load_explicit(&overflow->segmentHead, memory_order_acquire)) >= 0;
+}
+
+#endif //POJAVLAUNCHER_INPUT_OVERFLOW_H
@@ -0,0 +1,221 @@
+//
+// Lock-free single-producer/single-consumer queue for GLFW input events.
+//
+// The producer is the Android UI thread (sendData()), the consumer is the game thread
+// (pojavStartPumping()/pojavPumpEvents()/pojavStopPumping()). Each side owns one index, and
+// both indices live on their own cache line so that the threads don't fight over the same
+// line while input is flowing.
+//
+// The consumer can also park in input_ring_wait() until the producer publishes something, this
+// backs glfwWaitEvents(). The wakeup is a futex, the producer only pays for a fence while nobody waits.
+//
+// This header has no JNI or Android dependencies on purpose, so it can be benchmarked on a
+// regular Linux host (see hostbench/).
+//
+
+#ifndef POJAVLAUNCHER_INPUT_RING_H
+#define POJAVLAUNCHER_INPUT_RING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/* How many events can be handled at the same time. Must be a power of two. */
+#define INPUT_RING_CAPACITY 8192
+#define INPUT_RING_MASK (INPUT_RING_CAPACITY - 1)
+#define INPUT_RING_CACHE_LINE 64
+
+_Static_assert((INPUT_RING_CAPACITY & INPUT_RING_MASK) == 0, "INPUT_RING_CAPACITY must be a power of two");
+
+typedef struct {
+    int type;
+    int i1;
+    int i2;
+    int i3;
+    int i4;
+} GLFWInputEvent;
+
+typedef struct {
+    // Producer side. head is the next slot to be filled, it only ever grows.
+    _Alignas(INPUT_RING_CACHE_LINE) atomic_size_t head;
+    size_t tailCache; // Last tail seen by the producer, avoids touching the consumer line on every push
+    // Consumer side. tail is the next slot that has yet to be pumped out to MC.
+    _Alignas(INPUT_RING_CACHE_LINE) atomic_size_t tail;
+    size_t readTarget; // Head snapshot taken by input_ring_begin_read(), pumping stops there
+    // Wakeup for input_ring_wait(). Only written when somebody actually waits.
+    _Alignas(INPUT_RING_CACHE_LINE) atomic_uint wakeSeq; // futex word, bumped on every wakeup
+    atomic_uint waiters;
+    atomic_bool wakePending; // Set by input_ring_post_wakeup(), consumed by the next input_ring_wait()
+    _Alignas(INPUT_RING_CACHE_LINE) GLFWInputEvent events[INPUT_RING_CAPACITY];
+    uint64_t stamps[INPUT_RING_CAPACITY]; // Enqueue time of each event in nanoseconds, 0 if not measured
+} input_ring_t;
+
+static inline void input_ring_wake_waiters(input_ring_t* ring) {
+    atomic_fetch_add_explicit(&ring->wakeSeq, 1, memory_order_seq_cst);
+    syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+/** Producer only. Wakes up a consumer parked in input_ring_wait(), the push functions already call it. */
+static inline void input_ring_notify(input_ring_t* ring) {
+    // Pairs with the fetch_add on waiters in input_ring_wait(): either the consumer sees what was
+    // published to this ring before this call, or this call sees the consumer waiting.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ring->waiters, memory_order_relaxed) != 0)
+        input_ring_wake_waiters(ring);
+}
+
+/**
+ * Producer only. Like input_ring_notify(), for state input_ring_wait() doesn't look at: the cursor
+ * position, another segment, the overflow mailbox. The wakeup is posted, so the next wait returns
+ * even if it comes after this call, and the syscall is only made when a consumer is waiting.
+ */
+static inline void input_ring_notify_outside(input_ring_t* ring) {
+    // Pairs with the fetch_add on waiters and the exchange of wakePending in input_ring_wait()
+    atomic_store_explicit(&ring->wakePending, true, memory_order_seq_cst);
+    if (atomic_load_explicit(&ring->waiters, memory_order_seq_cst) != 0)
+        input_ring_wake_waiters(ring);
+}
+
+/** Any thread. Makes the current or the next input_ring_wait() return, even if no event is queued. */
+static inline void input_ring_post_wakeup(input_ring_t* ring) {
+    atomic_store_explicit(&ring->wakePending, true, memory_order_seq_cst);
+    input_ring_wake_waiters(ring);
+}
+
+/**
+ * Producer only. Publishes one event to the consumer.
+ * @param stamp the enqueue time to keep alongside the event, or 0
+ * @return false if the ring is full and the event was not queued
+ */
+static inline bool input_ring_push(input_ring_t* ring, const GLFWInputEvent* event, uint64_t stamp) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - ring->tailCache >= INPUT_RING_CAPACITY) {
+        ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head - ring->tailCache >= INPUT_RING_CAPACITY) return false;
+    }
+    ring->events[head & INPUT_RING_MASK] = *event;
+    ring->stamps[head & INPUT_RING_MASK] = stamp;
+    // Release: the event contents must be visible before the consumer can see the new head
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    input_ring_notify(ring);
+    return true;
+}
+
+/**
+ * Producer only. Publishes as many of the given events as there is room for, with a single release store.
+ * @param stamp the enqueue time shared by all of the events, or 0
+ * @return how many events were queued, starting from the first one
+ */
+static inline size_t input_ring_push_many(input_ring_t* ring, const GLFWInputEvent* events, size_t count, uint64_t stamp) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - ring->tailCache + count > INPUT_RING_CAPACITY)
+        ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t room = INPUT_RING_CAPACITY - (head - ring->tailCache);
+    if (count > room) count = room;
+    if (count == 0) return 0;
+
+    // At most two copies: up to the end of the array, then from its start
+    size_t start = head & INPUT_RING_MASK;
+    size_t first = INPUT_RING_CAPACITY - start;
+    if (first > count) first = count;
+    memcpy(&ring->events[start], events, first * sizeof(GLFWInputEvent));
+    memcpy(&ring->events[0], events + first, (count - first) * sizeof(GLFWInputEvent));
+    for (size_t i = 0; i < count; i++) ring->stamps[(head + i) & INPUT_RING_MASK] = stamp;
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+    input_ring_notify(ring);
+    return count;
+}
+
+/** Producer only. Whether the consumer is done with everything that was published. */
+static inline bool input_ring_producer_drained(input_ring_t* ring) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head == ring->tailCache) return true;
+    ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    return head == ring->tailCache;
+}
+
+/**
+ * Consumer only. Claims every event published so far as the current batch.
+ * The batch spans [input_ring_read_start(), ring->readTarget) and stays valid until input_ring_end_read().
+ * @return the amount of events in the batch
+ */
+static inline size_t input_ring_begin_read(input_ring_t* ring) {
+    ring->readTarget = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return ring->readTarget - atomic_load_explicit(&ring->tail, memory_order_relaxed);
+}
+
+/** Consumer only. First index of the batch claimed by input_ring_begin_read(). */
+static inline size_t input_ring_read_start(input_ring_t* ring) {
+    return atomic_load_explicit(&ring->tail, memory_order_relaxed);
+}
+
+static inline GLFWInputEvent* input_ring_at(input_ring_t* ring, size_t index) {
+    return &ring->events[index & INPUT_RING_MASK];
+}
+
+static inline uint64_t input_ring_stamp_at(input_ring_t* ring, size_t index) {
+    return ring->stamps[index & INPUT_RING_MASK];
+}
+
+/** Consumer only. Hands the slots of the current batch back to the producer. */
+static inline void input_ring_end_read(input_ring_t* ring) {
+    atomic_store_explicit(&ring->tail, ring->readTarget, memory_order_release);
+}
+
+/**
+ * Consumer only. Parks the calling thread until an event is published, input_ring_notify(),
+ * input_ring_notify_outside() or input_ring_post_wakeup() is called, or the timeout expires.
+ * @param timeout_ns how long to wait at most, negative to wait forever
+ * @return false if the timeout expired without a wakeup
+ */
+static inline bool input_ring_wait(input_ring_t* ring, int64_t timeout_ns) {
+    struct timespec deadline, remaining, *timeout = NULL;
+    if (timeout_ns >= 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ns / 1000000000;
+        deadline.tv_nsec += timeout_ns % 1000000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        timeout = &remaining;
+    }
+
+    atomic_fetch_add_explicit(&ring->waiters, 1, memory_order_seq_cst);
+    bool woken = false;
+    for (;;) {
+        unsigned seq = atomic_load_explicit(&ring->wakeSeq, memory_order_seq_cst);
+        if (atomic_exchange_explicit(&ring->wakePending, false, memory_order_seq_cst)
+            || atomic_load_explicit(&ring->head, memory_order_acquire) != atomic_load_explicit(&ring->tail, memory_order_relaxed)) {
+            woken = true;
+            break;
+        }
+        if (timeout != NULL) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            int64_t left = (int64_t) (deadline.tv_sec - now.tv_sec) * 1000000000 + (deadline.tv_nsec - now.tv_nsec);
+            if (left <= 0) break;
+            remaining.tv_sec = left / 1000000000;
+            remaining.tv_nsec = left % 1000000000;
+        }
+        // Returns right away if wakeSeq moved since it was read, so a wakeup can't slip in between
+        syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAIT_PRIVATE, seq, timeout, NULL, 0);
+        if (atomic_load_explicit(&ring->wakeSeq, memory_order_relaxed) != seq) {
+            // Whatever caused the wakeup has been seen, don't let a posted one fire twice
+            atomic_store_explicit(&ring->wakePending, false, memory_order_relaxed);
+            woken = true;
+            break;
+        }
+    }
+    atomic_fetch_sub_explicit(&ring->waiters, 1, memory_order_relaxed);
+    return woken;
+}
+
+#endif //POJAVLAUNCHER_INPUT_RING_H
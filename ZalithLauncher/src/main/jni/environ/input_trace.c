@@ -0,0 +1,107 @@
+//
+// Recording and replay of input traces, see input_trace.h
+//
+
+#include <errno.h>
+#include <time.h>
+#include "input_trace.h"
+#include "input_latency.h"
+
+/* Let stdio gather this much before writing, so that the UI thread doesn't do I/O on every event */
+#define INPUT_TRACE_BUFFER_SIZE (64 * 1024)
+/* Flush at least this often, the app may be killed without a chance to close the trace */
+#define INPUT_TRACE_FLUSH_INTERVAL_NS 1000000000ULL
+
+bool input_trace_open(input_trace_writer_t* writer, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) return false;
+    setvbuf(file, NULL, _IOFBF, INPUT_TRACE_BUFFER_SIZE);
+    input_trace_header_t header = {
+            .magic = INPUT_TRACE_MAGIC,
+            .version = INPUT_TRACE_VERSION,
+            .recordSize = sizeof(input_trace_record_t)
+    };
+    fwrite(&header, sizeof(header), 1, file);
+    pthread_mutex_init(&writer->lock, NULL);
+    writer->start_ns = writer->lastFlush_ns = input_latency_now();
+    writer->records = 0;
+    writer->unflushed = false;
+    atomic_store_explicit(&writer->file, file, memory_order_release);
+    return true;
+}
+
+void input_trace_write(input_trace_writer_t* writer, const GLFWInputEvent* events, size_t count, uint64_t now_ns) {
+    if (atomic_load_explicit(&writer->file, memory_order_acquire) == NULL) return;
+    pthread_mutex_lock(&writer->lock);
+    // Closed meanwhile
+    FILE* file = atomic_load_explicit(&writer->file, memory_order_relaxed);
+    if (file != NULL) {
+        input_trace_record_t record;
+        record.time_ns = now_ns > writer->start_ns ? now_ns - writer->start_ns : 0;
+        for (size_t i = 0; i < count; i++) {
+            record.event = events[i];
+            fwrite(&record, sizeof(record), 1, file);
+        }
+        writer->records += count;
+        writer->unflushed = true;
+        if (now_ns - writer->lastFlush_ns >= INPUT_TRACE_FLUSH_INTERVAL_NS) {
+            fflush(file);
+            writer->lastFlush_ns = now_ns;
+            writer->unflushed = false;
+        }
+    }
+    pthread_mutex_unlock(&writer->lock);
+}
+
+void input_trace_flush(input_trace_writer_t* writer, uint64_t now_ns) {
+    if (atomic_load_explicit(&writer->file, memory_order_acquire) == NULL) return;
+    // Don't wait on the UI thread, the next pump will try again
+    if (pthread_mutex_trylock(&writer->lock) != 0) return;
+    FILE* file = atomic_load_explicit(&writer->file, memory_order_relaxed);
+    if (file != NULL && writer->unflushed && now_ns - writer->lastFlush_ns >= INPUT_TRACE_FLUSH_INTERVAL_NS) {
+        fflush(file);
+        writer->lastFlush_ns = now_ns;
+        writer->unflushed = false;
+    }
+    pthread_mutex_unlock(&writer->lock);
+}
+
+void input_trace_close(input_trace_writer_t* writer) {
+    if (atomic_load_explicit(&writer->file, memory_order_acquire) == NULL) return;
+    pthread_mutex_lock(&writer->lock);
+    FILE* file = atomic_exchange_explicit(&writer->file, NULL, memory_order_relaxed);
+    if (file != NULL) fclose(file);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+static void sleep_until(uint64_t deadline_ns) {
+    struct timespec deadline = {
+            .tv_sec = (time_t) (deadline_ns / 1000000000ULL),
+            .tv_nsec = (long) (deadline_ns % 1000000000ULL)
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR);
+}
+
+long input_trace_replay(const char* path, double speed, input_trace_emit_func* emit, void* user) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return -1;
+    input_trace_header_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != INPUT_TRACE_MAGIC
+        || header.version != INPUT_TRACE_VERSION || header.recordSize != sizeof(input_trace_record_t)) {
+        fclose(file);
+        return -1;
+    }
+
+    uint64_t start_ns = input_latency_now();
+    input_trace_record_t record;
+    long replayed = 0;
+    while (fread(&record, sizeof(record), 1, file) == 1) {
+        // Sleep against the start of the replay rather than the previous event, so that errors don't add up
+        if (speed > 0) sleep_until(start_ns + (uint64_t) ((double) record.time_ns / speed));
+        GLFWInputEvent event = record.event; // The record is packed, don't hand out a pointer into it
+        emit(&event, user);
+        replayed++;
+    }
+    fclose(file);
+    return replayed;
+}
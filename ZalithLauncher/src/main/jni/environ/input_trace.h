@@ -0,0 +1,70 @@
+//
+// Binary traces of the input stream, for repeatable benchmarks without a human on the phone.
+//
+// A trace is a header followed by fixed-size records: the time since the start of the recording,
+// and the event exactly as it went through the input bridge. Cursor updates don't go through the
+// ring, they are recorded with type EVENT_TYPE_CURSOR_POS and the float bits of the coordinates,
+// like in event batches.
+//
+// Only the Android UI thread records, the trace may be closed from any thread. Replaying is done by whatever thread calls input_trace_replay(),
+// it sleeps so that the events come out with their original spacing.
+//
+// No JNI or Android dependencies, so traces can be replayed on a Linux host (see hostbench/).
+//
+
+#ifndef POJAVLAUNCHER_INPUT_TRACE_H
+#define POJAVLAUNCHER_INPUT_TRACE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "input_ring.h"
+
+#define INPUT_TRACE_MAGIC 0x54494A50 // "PJIT"
+#define INPUT_TRACE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize; // sizeof(input_trace_record_t), checked on replay
+    uint32_t reserved;
+} input_trace_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint64_t time_ns; // Since the start of the recording
+    GLFWInputEvent event;
+} input_trace_record_t;
+
+typedef struct {
+    FILE* _Atomic file; // NULL unless recording
+    pthread_mutex_t lock; // Keeps input_trace_close() away from a write in progress
+    uint64_t start_ns;
+    uint64_t lastFlush_ns;
+    size_t records;
+    bool unflushed; // Records were written since lastFlush_ns
+} input_trace_writer_t;
+
+typedef void input_trace_emit_func(const GLFWInputEvent* event, void* user);
+
+/** @return false if the file can't be created */
+bool input_trace_open(input_trace_writer_t* writer, const char* path);
+/** Records events that were sent at `now_ns` (CLOCK_MONOTONIC). Does nothing if the writer isn't open. */
+void input_trace_write(input_trace_writer_t* writer, const GLFWInputEvent* events, size_t count, uint64_t now_ns);
+/**
+ * From the end of every pump. Writes only flush once in a while, so records written after the last
+ * flush would stay buffered for as long as no new input comes. This flushes them once the interval has passed.
+ */
+void input_trace_flush(input_trace_writer_t* writer, uint64_t now_ns);
+/** Any thread. Flushes and closes the trace, later writes are dropped. */
+void input_trace_close(input_trace_writer_t* writer);
+
+/**
+ * Feeds every event of a trace to `emit`, sleeping in between to keep the original timing.
+ * @param speed 1 for the original timing, 2 for twice as fast, 0 to emit everything without sleeping
+ * @return how many events were replayed, -1 if the file can't be read or is not a trace
+ */
+long input_trace_replay(const char* path, double speed, input_trace_emit_func* emit, void* user);
+
+#endif //POJAVLAUNCHER_INPUT_TRACE_H
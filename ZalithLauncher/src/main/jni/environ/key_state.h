@@ -0,0 +1,86 @@
+//
+// Packed copy of GLFW.keyDownBuffer and GLFW.mouseDownBuffer, for glfwGetKeyStateSnapshot().
+//
+// Keybind handlers that check dozens of keys per tick read one bit set in a single JNI call
+// instead of one ByteBuffer byte per key. Every key or button that changed state since the
+// caller's previous snapshot is flagged, even if it went back to its old state in between.
+//
+// Changes are numbered by a generation counter, and each key remembers the generation of its last
+// change. A snapshot carries the generation it was taken at, so every caller keeps its own array
+// and sees its own changes: reading doesn't clear anything for the others.
+//
+
+#ifndef POJAVLAUNCHER_KEY_STATE_H
+#define POJAVLAUNCHER_KEY_STATE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Keys are indexed like GLFW.keyDownBuffer: max(0, key - 31) */
+#define KEY_STATE_KEY_WORDS 5
+#define KEY_STATE_MOUSE_BUTTONS 64
+/* Snapshot layout: key words, mouse button word, the same again for the changed mask, then the generation.
+ * Mirrored by GLFW_KEY_STATE_CHANGED_OFFSET, GLFW_KEY_STATE_GENERATION and GLFW_KEY_STATE_SNAPSHOT_SIZE in GLFW.java */
+#define KEY_STATE_GENERATION (2 * (KEY_STATE_KEY_WORDS + 1))
+#define KEY_STATE_SNAPSHOT (KEY_STATE_GENERATION + 1)
+
+typedef struct {
+    atomic_uint_fast64_t keys[KEY_STATE_KEY_WORDS], mouseButtons;
+    atomic_uint generation; // Of the last change, bumped by the writer once the change is in place
+    atomic_uint changedKeys[KEY_STATE_KEY_WORDS * 64], changedMouseButtons[KEY_STATE_MOUSE_BUTTONS]; // Generation of their last change
+} key_state_t;
+
+/* One writer at a time: the UI thread, or the replay thread while it has the input to itself */
+static inline void key_state_set_bit(key_state_t* state, atomic_uint_fast64_t* word, atomic_uint* changed, int bit, bool down) {
+    uint64_t mask = (uint64_t) 1 << bit;
+    uint64_t previous = down ? atomic_fetch_or_explicit(word, mask, memory_order_relaxed)
+                             : atomic_fetch_and_explicit(word, ~mask, memory_order_relaxed);
+    if (((previous & mask) != 0) == down) return;
+    unsigned generation = atomic_load_explicit(&state->generation, memory_order_relaxed) + 1;
+    atomic_store_explicit(changed, generation, memory_order_relaxed);
+    // Published last, so a snapshot that sees this generation also sees the change and the new state
+    atomic_store_explicit(&state->generation, generation, memory_order_release);
+}
+
+/** UI thread, next to the keyDownBuffer write. */
+static inline void key_state_set_key(key_state_t* state, int index, bool down) {
+    if (index < 0 || index >= KEY_STATE_KEY_WORDS * 64) return;
+    key_state_set_bit(state, &state->keys[index / 64], &state->changedKeys[index], index % 64, down);
+}
+
+/** UI thread, next to the mouseDownBuffer write. */
+static inline void key_state_set_mouse_button(key_state_t* state, int button, bool down) {
+    if (button < 0 || button >= KEY_STATE_MOUSE_BUTTONS) return;
+    key_state_set_bit(state, &state->mouseButtons, &state->changedMouseButtons[button], button, down);
+}
+
+/* Bit `i` is set for every change in (since, until] */
+static inline int64_t key_state_changed_word(atomic_uint* changed, unsigned since, unsigned until) {
+    uint64_t word = 0;
+    for (int i = 0; i < 64; i++) {
+        unsigned generation = atomic_load_explicit(&changed[i], memory_order_relaxed);
+        // Wraps around like the counter. Later changes are left for the next snapshot.
+        if ((int) (generation - since) > 0 && (int) (until - generation) >= 0) word |= (uint64_t) 1 << i;
+    }
+    return (int64_t) word;
+}
+
+/**
+ * Any thread.
+ * @param out KEY_STATE_SNAPSHOT words. out[KEY_STATE_GENERATION] is the generation of the caller's previous
+ *            snapshot (0 for the first one) and gets the one of this snapshot.
+ */
+static inline void key_state_snapshot(key_state_t* state, int64_t* out) {
+    unsigned since = (unsigned) out[KEY_STATE_GENERATION];
+    unsigned until = atomic_load_explicit(&state->generation, memory_order_acquire);
+    for (int word = 0; word < KEY_STATE_KEY_WORDS; word++) {
+        out[KEY_STATE_KEY_WORDS + 1 + word] = key_state_changed_word(&state->changedKeys[word * 64], since, until);
+        out[word] = (int64_t) atomic_load_explicit(&state->keys[word], memory_order_relaxed);
+    }
+    out[2 * KEY_STATE_KEY_WORDS + 1] = key_state_changed_word(state->changedMouseButtons, since, until);
+    out[KEY_STATE_KEY_WORDS] = (int64_t) atomic_load_explicit(&state->mouseButtons, memory_order_relaxed);
+    out[KEY_STATE_GENERATION] = until;
+}
+
+#endif //POJAVLAUNCHER_KEY_STATE_H
@@ -0,0 +1,58 @@
+//
+// Late latching of the cursor, enabled with POJAV_LATE_LATCH.
+//
+// pojavStartPumping() hands the game the cursor as it was at the start of the frame, which can be
+// a whole frame before pojavSwapBuffers() presents it. With late latching, the renderer can ask for
+// the motion that came in since then (pojavLateLatchCursor(), GLFW.nglfwLateLatchCursor()) as close
+// to the swap as it wants, and every swap records how much newer the newest sample was than the
+// pumped one.
+//
+
+#ifndef POJAVLAUNCHER_LATE_LATCH_H
+#define POJAVLAUNCHER_LATE_LATCH_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+/* Values reported by late_latch_snapshot(): swaps, swaps with a newer sample, average and max age gap in microseconds */
+#define LATE_LATCH_STATS 4
+
+typedef struct {
+    atomic_uint_fast64_t sampleTime; // When the newest cursor sample came in, CLOCK_MONOTONIC nanoseconds
+    uint64_t pumpedSampleTime; // sampleTime as seen by pojavStartPumping(). Only touched by the game thread.
+    atomic_uint_fast64_t swaps, newerSwaps, newerSum_us, newerMax_us;
+} late_latch_t;
+
+/** UI thread. A cursor sample was stored at `now_ns`. */
+static inline void late_latch_sample(late_latch_t* latch, uint64_t now_ns) {
+    atomic_store_explicit(&latch->sampleTime, now_ns, memory_order_relaxed);
+}
+
+/** Game thread, from pojavStartPumping(). */
+static inline void late_latch_pumped(late_latch_t* latch) {
+    latch->pumpedSampleTime = atomic_load_explicit(&latch->sampleTime, memory_order_relaxed);
+}
+
+/** Game thread, right before the buffer swap. Records how much newer the newest sample is than the pumped one. */
+static inline void late_latch_record(late_latch_t* latch) {
+    uint64_t newest = atomic_load_explicit(&latch->sampleTime, memory_order_relaxed);
+    // Single writer: plain load + store is enough for the readers
+    atomic_store_explicit(&latch->swaps, atomic_load_explicit(&latch->swaps, memory_order_relaxed) + 1, memory_order_relaxed);
+    if (newest <= latch->pumpedSampleTime) return;
+    uint64_t newer_us = (newest - latch->pumpedSampleTime) / 1000;
+    atomic_store_explicit(&latch->newerSwaps, atomic_load_explicit(&latch->newerSwaps, memory_order_relaxed) + 1, memory_order_relaxed);
+    atomic_store_explicit(&latch->newerSum_us, atomic_load_explicit(&latch->newerSum_us, memory_order_relaxed) + newer_us, memory_order_relaxed);
+    if (newer_us > atomic_load_explicit(&latch->newerMax_us, memory_order_relaxed))
+        atomic_store_explicit(&latch->newerMax_us, newer_us, memory_order_relaxed);
+}
+
+/** @param out LATE_LATCH_STATS values */
+static inline void late_latch_snapshot(late_latch_t* latch, int64_t* out) {
+    uint64_t newerSwaps = atomic_load_explicit(&latch->newerSwaps, memory_order_relaxed);
+    out[0] = (int64_t) atomic_load_explicit(&latch->swaps, memory_order_relaxed);
+    out[1] = (int64_t) newerSwaps;
+    out[2] = newerSwaps ? (int64_t) (atomic_load_explicit(&latch->newerSum_us, memory_order_relaxed) / newerSwaps) : 0;
+    out[3] = (int64_t) atomic_load_explicit(&latch->newerMax_us, memory_order_relaxed);
+}
+
+#endif //POJAVLAUNCHER_LATE_LATCH_H
@@ -0,0 +1,198 @@
+//
+// Host-side checks and benchmark for ctxbridges/frame_pacer.c
+//
+// Not part of the Android build. On a Linux host:
+//   make frame_pacer_bench
+//   ./frame_pacer_bench [fps]
+//
+// The pacer first runs against a mock clock: sleeps wake up late by a pseudo-random amount, every
+// clock read while spinning costs a little time, and the game renders for a varying time between
+// swaps. The runs check that frames are released evenly at the cap, that slow frames don't cause
+// a burst of fast ones afterwards, and that power saving halves the rate in menus.
+// Then it paces a few seconds of empty frames against the real clock and reports how far from
+// their deadlines they were released. Exits with 1 if any check fails.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ctxbridges/frame_pacer.h"
+
+#define DEFAULT_FPS 45
+#define MOCK_FRAMES 20000
+#define REAL_SECONDS 3
+
+typedef struct {
+    uint64_t now;
+    uint64_t readCost; // Time every clock read takes
+    uint64_t maxOversleep;
+    uint32_t seed;
+} mock_clock_t;
+
+static uint32_t next_random(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+static uint64_t mock_now(void* context) {
+    mock_clock_t* clock = context;
+    clock->now += clock->readCost;
+    return clock->now;
+}
+
+static void mock_sleep(void* context, uint64_t ns) {
+    mock_clock_t* clock = context;
+    clock->now += ns + (clock->maxOversleep ? next_random(&clock->seed) % clock->maxOversleep : 0);
+}
+
+typedef struct {
+    uint64_t frames, minInterval, maxInterval, sum;
+} intervals_t;
+
+static void intervals_add(intervals_t* intervals, uint64_t interval) {
+    if (intervals->frames == 0 || interval < intervals->minInterval) intervals->minInterval = interval;
+    if (interval > intervals->maxInterval) intervals->maxInterval = interval;
+    intervals->sum += interval;
+    intervals->frames++;
+}
+
+/*
+ * Swaps `frames` times, rendering for `render` ns plus up to `renderJitter` ns before each swap.
+ * `menuEvery` switches between the game and a menu every that many frames, never if 0.
+ * The intervals between swap releases go to `game` and `menu`, except around the switches.
+ */
+static void run_mock(frame_pacer_t* pacer, mock_clock_t* clock, int frames, uint64_t render, uint64_t renderJitter,
+                     int menuEvery, intervals_t* game, intervals_t* menu) {
+    uint64_t released = 0;
+    bool wasInMenu = false;
+    for (int i = 0; i < frames; i++) {
+        clock->now += render + (renderJitter ? next_random(&clock->seed) % renderJitter : 0);
+        bool inMenu = menuEvery && (i / menuEvery) % 2 == 1;
+        frame_pacer_wait(pacer, inMenu);
+        uint64_t now = clock->now;
+        if (i > 0 && inMenu == wasInMenu) intervals_add(inMenu ? menu : game, now - released);
+        released = now;
+        wasInMenu = inMenu;
+    }
+}
+
+static int failures;
+
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("  FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+static void print_stats(frame_pacer_t* pacer) {
+    int64_t stats[FRAME_PACER_STATS];
+    frame_pacer_snapshot(pacer, stats);
+    printf("  target %lld FPS, %lld paced, %lld late, overshoot avg %lld us max %lld us, spin margin %lld us\n",
+           (long long) stats[0], (long long) stats[1], (long long) stats[2], (long long) stats[3],
+           (long long) stats[4], (long long) stats[5]);
+}
+
+static void print_intervals(const char* name, const intervals_t* intervals) {
+    if (intervals->frames == 0) return;
+    printf("  %s: %llu intervals, min %.3f ms, avg %.3f ms, max %.3f ms\n", name,
+           (unsigned long long) intervals->frames, intervals->minInterval / 1e6,
+           (double) intervals->sum / (double) intervals->frames / 1e6, intervals->maxInterval / 1e6);
+}
+
+static void new_pacer(frame_pacer_t* pacer, mock_clock_t* clock, int fps, bool powerSave) {
+    *clock = (mock_clock_t) { .now = 1000000000ULL, .readCost = 2000, .maxOversleep = 1500000, .seed = 1 };
+    frame_pacer_clock_t mock = { mock_now, mock_sleep, clock };
+    char cap[16];
+    snprintf(cap, sizeof(cap), "%d", fps);
+    frame_pacer_init(pacer, fps ? cap : NULL, powerSave, &mock);
+}
+
+static void check_even(int fps) {
+    printf("Cap at %d FPS, renders well within a frame, sleeps wake up to 1.5 ms late\n", fps);
+    frame_pacer_t pacer;
+    mock_clock_t clock;
+    intervals_t game = {0}, menu = {0};
+    new_pacer(&pacer, &clock, fps, false);
+    uint64_t period = 1000000000ULL / fps;
+    run_mock(&pacer, &clock, MOCK_FRAMES, period / 3, period / 3, 0, &game, &menu);
+    print_intervals("game", &game);
+    print_stats(&pacer);
+    uint64_t average = game.sum / game.frames;
+    check(average + 1000 >= period && average <= period + 1000, "average interval is the period");
+    // Until the margin has seen the worst oversleep, a sleep may still end past the deadline
+    check(game.maxInterval < period + 1500000 && game.minInterval + 1500000 > period, "frames are evenly spaced");
+    int64_t stats[FRAME_PACER_STATS];
+    frame_pacer_snapshot(&pacer, stats);
+    check(stats[2] == 0, "no frame is late");
+    check(stats[3] < 20, "overshoot stays within a few clock reads on average");
+}
+
+static void check_slow(int fps) {
+    printf("Cap at %d FPS, every 10th frame takes three periods\n", fps);
+    frame_pacer_t pacer;
+    mock_clock_t clock;
+    intervals_t game = {0};
+    new_pacer(&pacer, &clock, fps, false);
+    uint64_t period = 1000000000ULL / fps;
+    uint64_t released = 0;
+    for (int i = 0; i < MOCK_FRAMES; i++) {
+        clock.now += i % 10 == 9 ? period * 3 : period / 2;
+        frame_pacer_wait(&pacer, false);
+        if (i > 0) intervals_add(&game, clock.now - released);
+        released = clock.now;
+    }
+    print_intervals("game", &game);
+    print_stats(&pacer);
+    // A late frame starts a new schedule: the next ones don't rush to make up for it
+    check(game.minInterval + 1500000 > period, "no burst after a slow frame");
+    int64_t stats[FRAME_PACER_STATS];
+    frame_pacer_snapshot(&pacer, stats);
+    check(stats[2] == MOCK_FRAMES / 10, "slow frames are counted as late");
+}
+
+static void check_power_save(int fps) {
+    printf("Cap at %d FPS with power saving, a menu every other 500 frames\n", fps);
+    frame_pacer_t pacer;
+    mock_clock_t clock;
+    intervals_t game = {0}, menu = {0};
+    new_pacer(&pacer, &clock, fps, true);
+    uint64_t period = 1000000000ULL / fps;
+    run_mock(&pacer, &clock, MOCK_FRAMES, period / 3, period / 3, 500, &game, &menu);
+    print_intervals("game", &game);
+    print_intervals("menu", &menu);
+    print_stats(&pacer);
+    check(game.sum / game.frames <= period + 1000, "game runs at the cap");
+    check(menu.sum / menu.frames + 2000 >= period * 2, "menus run at half the cap");
+
+    printf("Power saving without a cap\n");
+    game = (intervals_t) {0};
+    menu = (intervals_t) {0};
+    new_pacer(&pacer, &clock, 0, true);
+    run_mock(&pacer, &clock, MOCK_FRAMES, 5000000, 0, 500, &game, &menu);
+    print_intervals("game", &game);
+    print_intervals("menu", &menu);
+    check(game.maxInterval == 5000000, "game is not paced");
+    check(menu.sum / menu.frames + 2000 >= 1000000000ULL / 30, "menus run at 30 FPS");
+}
+
+static void bench_real(int fps) {
+    printf("Real clock, %d FPS for %d seconds\n", fps, REAL_SECONDS);
+    frame_pacer_t pacer;
+    char cap[16];
+    snprintf(cap, sizeof(cap), "%d", fps);
+    frame_pacer_init(&pacer, cap, false, NULL);
+    for (int i = 0; i < fps * REAL_SECONDS; i++) frame_pacer_wait(&pacer, false);
+    print_stats(&pacer);
+}
+
+int main(int argc, char** argv) {
+    int fps = argc > 1 ? atoi(argv[1]) : DEFAULT_FPS;
+    if (fps <= 0) fps = DEFAULT_FPS;
+    check_even(fps);
+    check_slow(fps);
+    check_power_save(fps);
+    bench_real(fps);
+    if (failures) printf("%d check(s) failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,214 @@
+//
+// Host-side benchmark for the whole input path of input_bridge_v3.c
+//
+// Not part of the Android build. On a Linux host:
+//   make input_bridge_bench
+//   ./input_bridge_bench [events] [producer_cpu consumer_cpu]
+//
+// A producer thread plays the Android UI thread and calls critical_send_key() and
+// critical_send_cursor_pos(), a consumer thread plays the game thread and pumps with
+// pojavStartPumping()/pojavPumpEvents()/pojavStopPumping() into stub GLFW callbacks.
+// Every key event carries its sequence number in the scancode, so the consumer can tell
+// whether anything was delivered twice or out of order, and whether every event was either
+// delivered or counted as dropped. The overflow policy comes from POJAV_INPUT_OVERFLOW, like
+// on the device.
+//
+// Without CPUs on the command line, every run is repeated unpinned, with both threads on the
+// same core and with the threads on two different cores. Exits with 1 if any run is incorrect.
+//
+
+// _GNU_SOURCE comes from the Makefile, environ.c needs it too
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "environ/environ.h"
+
+#define WINDOW ((void*) 0x1000)
+#define DEFAULT_EVENTS 2000000UL
+#define PACED_INTERVAL_NS 2000 // 500k events per second, still far above what a touch screen sends
+#define DRAIN_TIMEOUT_NS 1000000000ULL
+
+/* Exported by input_bridge_v3.c, the Android side reaches them through JNI */
+void critical_send_key(jint key, jint scancode, jint action, jint mods);
+void critical_send_cursor_pos(jfloat x, jfloat y);
+void pojavStartPumping();
+void pojavPumpEvents(void* window);
+void pojavStopPumping();
+
+/* Referenced by JNI_OnLoad(), which the benchmark never calls */
+void hookExec() {}
+void installLwjglDlopenHook() {}
+
+typedef struct {
+    const char* name;
+    uint64_t interval_ns; // 0: as fast as possible
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+        { "flood", 0 },
+        { "paced", PACED_INTERVAL_NS },
+};
+
+static struct {
+    int producer_cpu, consumer_cpu;
+    unsigned long events;
+    uint64_t interval_ns;
+    atomic_bool producer_done;
+    // Consumer side
+    long last_sequence;
+    unsigned long received, misordered, wrong_window, rounds;
+    double cursor_x, cursor_y;
+} run;
+
+static jbyte key_down[317], mouse_down[8];
+static cpu_set_t all_cpus;
+
+/** @param cpu -1 for every CPU the process started with */
+static void pin_to_cpu(int cpu) {
+    cpu_set_t set = all_cpus;
+    if (cpu >= 0) {
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        fprintf(stderr, "input_bridge_bench: failed to pin to cpu %d\n", cpu);
+}
+
+static void stub_key(void* window, __attribute__((unused)) int key, int scancode,
+                     __attribute__((unused)) int action, __attribute__((unused)) int mods) {
+    if (window != WINDOW) run.wrong_window++;
+    if (scancode <= run.last_sequence) run.misordered++;
+    run.last_sequence = scancode;
+    run.received++;
+}
+
+static void stub_cursor_pos(void* window, double x, double y) {
+    if (window != WINDOW) run.wrong_window++;
+    run.cursor_x = x;
+    run.cursor_y = y;
+}
+
+static void* producer_thread(__attribute__((unused)) void* arg) {
+    pin_to_cpu(run.producer_cpu);
+    uint64_t next = input_latency_now();
+    for (unsigned long sequence = 0; sequence < run.events; sequence++) {
+        if (run.interval_ns) {
+            next += run.interval_ns;
+            while (input_latency_now() < next);
+        }
+        // Presses only: the mailbox never keeps them, so each one is either queued or dropped
+        critical_send_key(32 + (int) (sequence % 300), (int) sequence, 1, 0);
+        if (sequence % 8 == 0) critical_send_cursor_pos((float) (sequence % 1920), (float) (sequence % 1080));
+    }
+    atomic_store(&run.producer_done, true);
+    return NULL;
+}
+
+static unsigned long dropped_events() {
+    return atomic_load_explicit(&pojav_environ->droppedEvents, memory_order_relaxed);
+}
+
+static void reset_run() {
+    run.producer_done = false;
+    run.last_sequence = -1;
+    run.received = run.misordered = run.wrong_window = run.rounds = 0;
+    memset(&pojav_environ->inputLatency, 0, sizeof(pojav_environ->inputLatency));
+    atomic_store(&pojav_environ->droppedEvents, 0);
+}
+
+/** Consumer side, runs on the calling thread. @return whether the run was correct */
+static bool run_once(const scenario_t* scenario, int producer_cpu, int consumer_cpu) {
+    reset_run();
+    run.producer_cpu = producer_cpu;
+    run.consumer_cpu = consumer_cpu;
+    run.interval_ns = scenario->interval_ns;
+    pin_to_cpu(consumer_cpu);
+
+    pthread_t producer;
+    uint64_t start = input_latency_now(), drain_deadline = 0;
+    pthread_create(&producer, NULL, producer_thread, NULL);
+    for (;;) {
+        bool done = atomic_load(&run.producer_done);
+        unsigned long received = run.received;
+        pojavStartPumping();
+        pojavPumpEvents(WINDOW);
+        pojavStopPumping();
+        run.rounds++;
+        if (done) {
+            // One more round after the producer finished picks up whatever it queued last
+            if (run.received + dropped_events() >= run.events) break;
+            if (drain_deadline == 0) drain_deadline = input_latency_now() + DRAIN_TIMEOUT_NS;
+            else if (input_latency_now() > drain_deadline) break;
+        }
+        if (run.received == received) sched_yield();
+    }
+    uint64_t elapsed = input_latency_now() - start;
+    pthread_join(producer, NULL);
+    pin_to_cpu(-1);
+
+    unsigned long dropped = dropped_events();
+    unsigned long last = run.events - 1;
+    bool cursor_ok = run.cursor_x == (double) ((last - last % 8) % 1920) && run.cursor_y == (double) ((last - last % 8) % 1080);
+    bool correct = run.misordered == 0 && run.wrong_window == 0 && run.received + dropped == run.events && cursor_ok;
+
+    int64_t stats[INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS];
+    input_latency_snapshot(&pojav_environ->inputLatency, stats);
+    int64_t* key = &stats[(1005 /* EVENT_TYPE_KEY */ - INPUT_LATENCY_FIRST_TYPE) * INPUT_LATENCY_STATS];
+
+    char pinning[32];
+    if (producer_cpu < 0) snprintf(pinning, sizeof(pinning), "unpinned");
+    else snprintf(pinning, sizeof(pinning), "cpu %d -> %d", producer_cpu, consumer_cpu);
+    printf("%-6s %-12s %9.2f %9lu %8lu %8lld %8lld %8lld %8lld  %s\n",
+           scenario->name, pinning, (double) run.received / ((double) elapsed / 1e9) / 1e6,
+           dropped, run.rounds, (long long) key[1], (long long) key[2], (long long) key[3], (long long) key[4],
+           correct ? "ok" : "FAILED");
+    if (!correct)
+        fprintf(stderr, "  received %lu + dropped %lu of %lu, %lu out of order, %lu to the wrong window, cursor %s\n",
+                run.received, dropped, run.events, run.misordered, run.wrong_window, cursor_ok ? "ok" : "stale");
+    return correct;
+}
+
+int main(int argc, char** argv) {
+    run.events = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_EVENTS;
+    if (run.events == 0) {
+        fprintf(stderr, "usage: %s [events] [producer_cpu consumer_cpu]\n", argv[0]);
+        return 2;
+    }
+
+    sched_getaffinity(0, sizeof(all_cpus), &all_cpus);
+
+    // What JNI_OnLoad() and the GLFW side would have set up on the device
+    pojav_environ->keyDownBuffer = key_down;
+    pojav_environ->mouseDownBuffer = mouse_down;
+    pojav_environ->GLFW_invoke_Key = stub_key;
+    pojav_environ->GLFW_invoke_CursorPos = stub_cursor_pos;
+    pojav_environ->showingWindow = (long) WINDOW;
+    pojav_environ->isUseStackQueueCall = true;
+    pojav_environ->isInputReady = true;
+    pojav_environ->isInputLatencyTracking = true;
+    pojav_environ->inputOverflowPolicy = input_overflow_parse_policy(getenv("POJAV_INPUT_OVERFLOW"));
+
+    int pinnings[3][2] = { { -1, -1 }, { 0, 0 }, { 0, 1 } };
+    int pinningCount = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? 3 : 2;
+    if (argc > 3) {
+        pinnings[0][0] = atoi(argv[2]);
+        pinnings[0][1] = atoi(argv[3]);
+        pinningCount = 1;
+    }
+
+    printf("%lu key events per run, overflow policy %d, ring capacity %d\n",
+           run.events, pojav_environ->inputOverflowPolicy, INPUT_RING_CAPACITY);
+    printf("%-6s %-12s %9s %9s %8s %8s %8s %8s %8s\n",
+           "run", "pinning", "Mev/s", "dropped", "rounds", "p50 us", "p95 us", "p99 us", "max us");
+    bool correct = true;
+    for (size_t scenario = 0; scenario < sizeof(scenarios) / sizeof(scenarios[0]); scenario++) {
+        for (int pinning = 0; pinning < pinningCount; pinning++)
+            correct &= run_once(&scenarios[scenario], pinnings[pinning][0], pinnings[pinning][1]);
+    }
+    return correct ? 0 : 1;
+}
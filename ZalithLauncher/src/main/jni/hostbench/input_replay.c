@@ -0,0 +1,166 @@
+//
+// Headless replay of input traces recorded with POJAV_INPUT_RECORD (see environ/input_trace.h)
+//
+// Not part of the Android build. On a Linux host:
+//   make input_replay
+//   ./input_replay play <trace> [speed]   replay with the original timing (speed 0: as fast as possible)
+//   ./input_replay gen <trace> [seconds]  write a synthetic "walk around and look" trace
+//
+// The replay thread is the producer, like the Android UI thread: events go to the input ring and
+// cursor updates to the cursor state. A game thread pumps them at 60 FPS into a stub callback
+// table, and reports how many events each callback got and how long they waited in the queue.
+//
+
+#define _GNU_SOURCE
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "environ/input_ring.h"
+#include "environ/input_latency.h"
+#include "environ/cursor_state.h"
+#include "environ/input_trace.h"
+
+/* Same values as in input_bridge_v3.c */
+#define EVENT_TYPE_CHAR 1000
+#define EVENT_TYPE_CHAR_MODS 1001
+#define EVENT_TYPE_CURSOR_ENTER 1002
+#define EVENT_TYPE_CURSOR_POS 1003
+#define EVENT_TYPE_FRAMEBUFFER_SIZE 1004
+#define EVENT_TYPE_KEY 1005
+#define EVENT_TYPE_MOUSE_BUTTON 1006
+#define EVENT_TYPE_SCROLL 1007
+#define EVENT_TYPE_WINDOW_SIZE 1008
+
+#define FRAME_NS 16666667
+
+static input_ring_t ring;
+static cursor_state_t cursor;
+static input_latency_t latency;
+static atomic_bool replaying = true;
+
+static struct {
+    unsigned long calls[INPUT_LATENCY_TYPES];
+    double cursorX, cursorY;
+    unsigned long frames;
+} stub;
+
+static void stub_dispatch(const GLFWInputEvent* event) {
+    unsigned index = (unsigned) (event->type - INPUT_LATENCY_FIRST_TYPE);
+    if (index < INPUT_LATENCY_TYPES) stub.calls[index]++;
+}
+
+static void emit(const GLFWInputEvent* event, __attribute__((unused)) void* user) {
+    if (event->type == EVENT_TYPE_CURSOR_POS) {
+        union { int bits; float value; } x = { event->i1 }, y = { event->i2 };
+        cursor_state_move(&cursor, x.value, y.value);
+        input_ring_notify(&ring);
+        return;
+    }
+    if (!input_ring_push(&ring, event, input_latency_now()))
+        fprintf(stderr, "ring full, event %d dropped\n", event->type);
+}
+
+static void* game_thread(__attribute__((unused)) void* arg) {
+    uint64_t next = input_latency_now();
+    for (;;) {
+        bool done = !atomic_load(&replaying);
+        size_t count = input_ring_begin_read(&ring);
+        uint64_t now = input_latency_now();
+        for (size_t index = input_ring_read_start(&ring); index != ring.readTarget; index++) {
+            input_latency_record(&latency, input_ring_at(&ring, index)->type, input_ring_stamp_at(&ring, index), now);
+            stub_dispatch(input_ring_at(&ring, index));
+        }
+        input_ring_end_read(&ring);
+        double x, y;
+        cursor_state_read(&cursor, &x, &y);
+        if (x != stub.cursorX || y != stub.cursorY) {
+            stub.cursorX = x;
+            stub.cursorY = y;
+            stub.calls[EVENT_TYPE_CURSOR_POS - INPUT_LATENCY_FIRST_TYPE]++;
+        }
+        stub.frames++;
+        if (done && count == 0) return NULL;
+        next += FRAME_NS;
+        struct timespec deadline = { (time_t) (next / 1000000000ULL), (long) (next % 1000000000ULL) };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    }
+}
+
+static int play(const char* path, double speed) {
+    static const char* const names[INPUT_LATENCY_TYPES] = {
+            "char", "char_mods", "cursor_enter", "cursor_pos", "framebuffer_size",
+            "key", "mouse_button", "scroll", "window_size"
+    };
+    pthread_t game;
+    pthread_create(&game, NULL, game_thread, NULL);
+    uint64_t start = input_latency_now();
+    long replayed = input_trace_replay(path, speed, emit, NULL);
+    atomic_store(&replaying, false);
+    pthread_join(game, NULL);
+    if (replayed < 0) {
+        fprintf(stderr, "%s is not an input trace\n", path);
+        return 1;
+    }
+
+    int64_t stats[INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS];
+    input_latency_snapshot(&latency, stats);
+    printf("replayed %ld events in %.3f s, %lu frames\n", replayed,
+           (double) (input_latency_now() - start) / 1e9, stub.frames);
+    printf("%-16s %8s %10s %10s %10s\n", "callback", "calls", "p50 us", "p99 us", "max us");
+    for (int type = 0; type < INPUT_LATENCY_TYPES; type++) {
+        if (stub.calls[type] == 0) continue;
+        int64_t* s = &stats[type * INPUT_LATENCY_STATS];
+        printf("%-16s %8lu %10lld %10lld %10lld\n", names[type], stub.calls[type],
+               (long long) s[1], (long long) s[3], (long long) s[4]);
+    }
+    return 0;
+}
+
+/* Hold W, look around with the cursor at 120 Hz, tap space and click now and then */
+static int generate(const char* path, double seconds) {
+    input_trace_writer_t writer;
+    if (!input_trace_open(&writer, path)) {
+        perror(path);
+        return 1;
+    }
+    uint64_t start = writer.start_ns;
+    GLFWInputEvent event = { EVENT_TYPE_KEY, 87 /* GLFW_KEY_W */, 17, 1, 0 };
+    input_trace_write(&writer, &event, 1, start);
+    uint64_t end = start + (uint64_t) (seconds * 1e9);
+    unsigned long step = 0;
+    for (uint64_t t = start; t < end; t += 8333333, step++) {
+        union { float value; int bits; } x = { 960 + 400 * sinf((float) step / 90) }, y = { 540 + 100 * cosf((float) step / 130) };
+        event = (GLFWInputEvent) { EVENT_TYPE_CURSOR_POS, x.bits, y.bits, 0, 0 };
+        input_trace_write(&writer, &event, 1, t);
+        if (step % 120 == 0) {
+            GLFWInputEvent jump[] = {
+                    { EVENT_TYPE_KEY, 32 /* GLFW_KEY_SPACE */, 57, 1, 0 },
+                    { EVENT_TYPE_KEY, 32, 57, 0, 0 }
+            };
+            input_trace_write(&writer, jump, 2, t);
+        }
+        if (step % 300 == 150) {
+            GLFWInputEvent click[] = {
+                    { EVENT_TYPE_MOUSE_BUTTON, 0, 1, 0, 0 },
+                    { EVENT_TYPE_MOUSE_BUTTON, 0, 0, 0, 0 }
+            };
+            input_trace_write(&writer, click, 2, t);
+        }
+    }
+    event = (GLFWInputEvent) { EVENT_TYPE_KEY, 87, 17, 0, 0 };
+    input_trace_write(&writer, &event, 1, end);
+    printf("wrote %zu events to %s\n", writer.records, path);
+    input_trace_close(&writer);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && !strcmp(argv[1], "play")) return play(argv[2], argc > 3 ? atof(argv[3]) : 1);
+    if (argc >= 3 && !strcmp(argv[1], "gen")) return generate(argv[2], argc > 3 ? atof(argv[3]) : 10);
+    fprintf(stderr, "usage: %s play <trace> [speed] | gen <trace> [seconds]\n", argv[0]);
+    return 2;
+}
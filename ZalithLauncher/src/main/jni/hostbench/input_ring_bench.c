@@ -0,0 +1,129 @@
+//
+// Host-side microbenchmark for environ/input_ring.h
+//
+// Not part of the Android build. On a Linux host:
+//   make input_ring_bench
+//   ./input_ring_bench [producer_cpu] [consumer_cpu]
+//
+// Reports the sustained throughput of one producer and one consumer thread, and the
+// cross-core latency of a single event measured with a ping-pong between two rings.
+//
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "environ/input_ring.h"
+
+#define THROUGHPUT_EVENTS 50000000UL
+#define PINGPONG_ROUNDS 1000000UL
+
+static input_ring_t ring_a, ring_b;
+static int producer_cpu = -1, consumer_cpu = -1;
+
+static double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static void pin_to_cpu(int cpu) {
+    if (cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        fprintf(stderr, "input_ring_bench: failed to pin to cpu %d\n", cpu);
+}
+
+// Blocks (spinning) until one event is available on the ring, then consumes it
+static GLFWInputEvent pop_one(input_ring_t* ring) {
+    while (input_ring_begin_read(ring) == 0) sched_yield();
+    size_t index = input_ring_read_start(ring);
+    GLFWInputEvent event = *input_ring_at(ring, index);
+    ring->readTarget = index + 1;
+    input_ring_end_read(ring);
+    return event;
+}
+
+static void push_one(input_ring_t* ring, const GLFWInputEvent* event) {
+    while (!input_ring_push(ring, event, 0)) sched_yield();
+}
+
+static void* throughput_producer(void* arg) {
+    pin_to_cpu(producer_cpu);
+    GLFWInputEvent event = { 1005, 0, 0, 1, 0 };
+    for (size_t i = 0; i < THROUGHPUT_EVENTS; i++) {
+        event.i1 = (int) i;
+        push_one(&ring_a, &event);
+    }
+    return NULL;
+}
+
+static void* pingpong_echo(void* arg) {
+    pin_to_cpu(producer_cpu);
+    for (size_t i = 0; i < PINGPONG_ROUNDS; i++) {
+        GLFWInputEvent event = pop_one(&ring_a);
+        push_one(&ring_b, &event);
+    }
+    return NULL;
+}
+
+static int run_throughput() {
+    pthread_t producer;
+    size_t received = 0, expected = 0;
+    pin_to_cpu(consumer_cpu);
+    double start = now_ns();
+    pthread_create(&producer, NULL, throughput_producer, NULL);
+    while (received < THROUGHPUT_EVENTS) {
+        // Consume in batches, the same way pojavStartPumping()/pojavStopPumping() do
+        if (input_ring_begin_read(&ring_a) == 0) {
+            sched_yield();
+            continue;
+        }
+        for (size_t index = input_ring_read_start(&ring_a); index != ring_a.readTarget; index++) {
+            if (input_ring_at(&ring_a, index)->i1 != (int) expected) {
+                fprintf(stderr, "input_ring_bench: out of order event at %zu\n", received);
+                return 1;
+            }
+            expected++;
+            received++;
+        }
+        input_ring_end_read(&ring_a);
+    }
+    double elapsed = now_ns() - start;
+    pthread_join(producer, NULL);
+    printf("throughput: %lu events in %.1f ms, %.2f Mevents/s\n",
+           THROUGHPUT_EVENTS, elapsed / 1e6, THROUGHPUT_EVENTS / (elapsed / 1e3));
+    return 0;
+}
+
+static void run_pingpong() {
+    pthread_t echo;
+    GLFWInputEvent event = { 1003, 0, 0, 0, 0 };
+    pin_to_cpu(consumer_cpu);
+    pthread_create(&echo, NULL, pingpong_echo, NULL);
+    double start = now_ns();
+    for (size_t i = 0; i < PINGPONG_ROUNDS; i++) {
+        push_one(&ring_a, &event);
+        pop_one(&ring_b);
+    }
+    double elapsed = now_ns() - start;
+    pthread_join(echo, NULL);
+    printf("cross-core latency: %.1f ns one way (%lu round trips)\n",
+           elapsed / PINGPONG_ROUNDS / 2, PINGPONG_ROUNDS);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) producer_cpu = atoi(argv[1]);
+    if (argc > 2) consumer_cpu = atoi(argv[2]);
+    printf("input ring: capacity=%d, sizeof=%zu, producer cpu=%d, consumer cpu=%d\n",
+           INPUT_RING_CAPACITY, sizeof(input_ring_t), producer_cpu, consumer_cpu);
+    if (run_throughput() != 0) return 1;
+    run_pingpong();
+    return 0;
+}
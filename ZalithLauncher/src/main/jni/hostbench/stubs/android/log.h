@@ -0,0 +1,17 @@
+//
+// Host stand-in for the NDK logging header, prints to stdout instead of logcat.
+//
+
+#ifndef POJAVLAUNCHER_HOSTBENCH_ANDROID_LOG_H
+#define POJAVLAUNCHER_HOSTBENCH_ANDROID_LOG_H
+
+#include <stdio.h>
+
+enum {
+    ANDROID_LOG_UNKNOWN = 0, ANDROID_LOG_DEFAULT, ANDROID_LOG_VERBOSE, ANDROID_LOG_DEBUG,
+    ANDROID_LOG_INFO, ANDROID_LOG_WARN, ANDROID_LOG_ERROR, ANDROID_LOG_FATAL, ANDROID_LOG_SILENT
+};
+
+#define __android_log_print(prio, tag, ...) (printf("%s: ", tag), printf(__VA_ARGS__), printf("\n"))
+
+#endif //POJAVLAUNCHER_HOSTBENCH_ANDROID_LOG_H
@@ -0,0 +1,117 @@
+//
+// Host stand-in for <jni.h>, just enough for the bridge sources to compile. Nothing in the
+// host benchmarks calls through these tables, so only the layout used by the sources matters.
+//
+
+#ifndef POJAVLAUNCHER_HOSTBENCH_JNI_H
+#define POJAVLAUNCHER_HOSTBENCH_JNI_H
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+typedef uint8_t  jboolean;
+typedef int8_t   jbyte;
+typedef uint16_t jchar;
+typedef int16_t  jshort;
+typedef int32_t  jint;
+typedef int64_t  jlong;
+typedef float    jfloat;
+typedef double   jdouble;
+typedef jint     jsize;
+
+typedef void* jobject;
+typedef jobject jclass;
+typedef jobject jstring;
+typedef jobject jarray;
+typedef jarray  jbyteArray;
+typedef jarray  jintArray;
+typedef jarray  jlongArray;
+typedef jarray  jdoubleArray;
+typedef jarray  jobjectArray;
+typedef struct _jfieldID* jfieldID;
+typedef struct _jmethodID* jmethodID;
+
+#define JNI_FALSE 0
+#define JNI_TRUE 1
+#define JNI_OK 0
+#define JNI_ERR (-1)
+#define JNI_EDETACHED (-2)
+#define JNI_VERSION_1_4 0x00010004
+#define JNI_VERSION_1_6 0x00010006
+#define JNI_ABORT 2
+#define JNIEXPORT __attribute__((visibility("default")))
+#define JNICALL
+
+typedef struct {
+    const char* name;
+    const char* signature;
+    void* fnPtr;
+} JNINativeMethod;
+
+struct JNINativeInterface;
+struct JNIInvokeInterface;
+typedef const struct JNINativeInterface* JNIEnv;
+typedef const struct JNIInvokeInterface* JavaVM;
+
+struct JNINativeInterface {
+    jclass (*FindClass)(JNIEnv*, const char*);
+    jobject (*NewGlobalRef)(JNIEnv*, jobject);
+    void (*DeleteGlobalRef)(JNIEnv*, jobject);
+    void (*DeleteLocalRef)(JNIEnv*, jobject);
+    jint (*PushLocalFrame)(JNIEnv*, jint);
+    jobject (*PopLocalFrame)(JNIEnv*, jobject);
+    jfieldID (*GetFieldID)(JNIEnv*, jclass, const char*, const char*);
+    jobject (*NewObject)(JNIEnv*, jclass, jmethodID, ...);
+    jobject (*CallObjectMethod)(JNIEnv*, jobject, jmethodID, ...);
+    jint (*GetIntField)(JNIEnv*, jobject, jfieldID);
+    void (*SetIntField)(JNIEnv*, jobject, jfieldID, jint);
+    jclass (*GetObjectClass)(JNIEnv*, jobject);
+    jmethodID (*GetMethodID)(JNIEnv*, jclass, const char*, const char*);
+    jmethodID (*GetStaticMethodID)(JNIEnv*, jclass, const char*, const char*);
+    jfieldID (*GetStaticFieldID)(JNIEnv*, jclass, const char*, const char*);
+    jobject (*GetStaticObjectField)(JNIEnv*, jclass, jfieldID);
+    void (*CallStaticVoidMethod)(JNIEnv*, jclass, jmethodID, ...);
+    jobject (*CallStaticObjectMethod)(JNIEnv*, jclass, jmethodID, ...);
+    jint (*CallStaticIntMethod)(JNIEnv*, jclass, jmethodID, ...);
+    jlong (*CallLongMethod)(JNIEnv*, jobject, jmethodID, ...);
+    void (*CallVoidMethod)(JNIEnv*, jobject, jmethodID, ...);
+    jstring (*NewStringUTF)(JNIEnv*, const char*);
+    const char* (*GetStringUTFChars)(JNIEnv*, jstring, jboolean*);
+    void (*ReleaseStringUTFChars)(JNIEnv*, jstring, const char*);
+    jsize (*GetStringUTFLength)(JNIEnv*, jstring);
+    jsize (*GetArrayLength)(JNIEnv*, jarray);
+    jobjectArray (*NewObjectArray)(JNIEnv*, jsize, jclass, jobject);
+    jobject (*GetObjectArrayElement)(JNIEnv*, jobjectArray, jsize);
+    void (*SetObjectArrayElement)(JNIEnv*, jobjectArray, jsize, jobject);
+    jbyteArray (*NewByteArray)(JNIEnv*, jsize);
+    jintArray (*NewIntArray)(JNIEnv*, jsize);
+    jbyte* (*GetByteArrayElements)(JNIEnv*, jbyteArray, jboolean*);
+    void (*ReleaseByteArrayElements)(JNIEnv*, jbyteArray, jbyte*, jint);
+    jint* (*GetIntArrayElements)(JNIEnv*, jintArray, jboolean*);
+    void (*ReleaseIntArrayElements)(JNIEnv*, jintArray, jint*, jint);
+    void (*SetByteArrayRegion)(JNIEnv*, jbyteArray, jsize, jsize, const jbyte*);
+    void (*GetByteArrayRegion)(JNIEnv*, jbyteArray, jsize, jsize, jbyte*);
+    void (*SetIntArrayRegion)(JNIEnv*, jintArray, jsize, jsize, const jint*);
+    void (*SetLongArrayRegion)(JNIEnv*, jlongArray, jsize, jsize, const jlong*);
+    void (*GetLongArrayRegion)(JNIEnv*, jlongArray, jsize, jsize, jlong*);
+    void (*SetDoubleArrayRegion)(JNIEnv*, jdoubleArray, jsize, jsize, const jdouble*);
+    jint (*RegisterNatives)(JNIEnv*, jclass, const JNINativeMethod*, jint);
+    jint (*UnregisterNatives)(JNIEnv*, jclass);
+    jboolean (*ExceptionCheck)(JNIEnv*);
+    void (*ExceptionDescribe)(JNIEnv*);
+    void (*ExceptionClear)(JNIEnv*);
+    void* (*GetDirectBufferAddress)(JNIEnv*, jobject);
+    jlong (*GetDirectBufferCapacity)(JNIEnv*, jobject);
+    jint (*GetJavaVM)(JNIEnv*, JavaVM**);
+};
+
+struct JNIInvokeInterface {
+    jint (*DestroyJavaVM)(JavaVM*);
+    jint (*AttachCurrentThread)(JavaVM*, JNIEnv**, void*);
+    jint (*DetachCurrentThread)(JavaVM*);
+    jint (*GetEnv)(JavaVM*, void**, jint);
+    jint (*AttachCurrentThreadAsDaemon)(JavaVM*, JNIEnv**, void*);
+};
+
+#endif //POJAVLAUNCHER_HOSTBENCH_JNI_H
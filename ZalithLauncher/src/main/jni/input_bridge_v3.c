@@ -18,14 +18,19 @@
 #include <string.h>
 #include <stdatomic.h>
 #include <math.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "log.h"
 #include "utils.h"
 #include "environ/environ.h"
 
+#define EVENT_TYPE_FOLDED 0 // Merged into another event by coalesceEvents(), never dispatched
+#define EVENT_TYPE_ROUTE 1 // The events after it go to another window, i1 and i2 carry the low and high half of its handle
 #define EVENT_TYPE_CHAR 1000
 #define EVENT_TYPE_CHAR_MODS 1001
 #define EVENT_TYPE_CURSOR_ENTER 1002
+#define EVENT_TYPE_CURSOR_POS 1003 // Only used by batches, i1 and i2 carry the raw bits of the float coordinates
 #define EVENT_TYPE_FRAMEBUFFER_SIZE 1004
 #define EVENT_TYPE_KEY 1005
 #define EVENT_TYPE_MOUSE_BUTTON 1006
@@ -33,12 +38,23 @@
 #define EVENT_TYPE_WINDOW_SIZE 1008
 
 static void registerFunctions(JNIEnv *env);
+static void startInputReplay(const char* path);
+
+// Set on the thread replaying POJAV_INPUT_REPLAY, the only one allowed to send input while it runs
+static __thread bool isReplayThread;
+
+/** Whether live input has to be ignored because a trace is being replayed. Checked before any side effect. */
+static bool isLiveInputBlocked() {
+    return atomic_load_explicit(&pojav_environ->isInputReplaying, memory_order_relaxed) && !isReplayThread;
+}
 
 jint JNI_OnLoad(JavaVM* vm, __attribute__((unused)) void* reserved) {
     if (pojav_environ->dalvikJavaVMPtr == NULL) {
         __android_log_print(ANDROID_LOG_INFO, "Native", "Saving DVM environ...");
         //Save dalvik global JavaVM pointer
         pojav_environ->dalvikJavaVMPtr = vm;
+        jni_env_cache_init(&pojav_environ->dalvikEnvCache, vm);
+        clipboard_cache_init(&pojav_environ->clipboard);
         (*vm)->GetEnv(vm, (void**) &pojav_environ->dalvikJNIEnvPtr_ANDROID, JNI_VERSION_1_4);
         pojav_environ->bridgeClazz = (*pojav_environ->dalvikJNIEnvPtr_ANDROID)->NewGlobalRef(pojav_environ->dalvikJNIEnvPtr_ANDROID,(*pojav_environ->dalvikJNIEnvPtr_ANDROID) ->FindClass(pojav_environ->dalvikJNIEnvPtr_ANDROID,"org/lwjgl/glfw/CallbackBridge"));
         pojav_environ->method_accessAndroidClipboard = (*pojav_environ->dalvikJNIEnvPtr_ANDROID)->GetStaticMethodID(pojav_environ->dalvikJNIEnvPtr_ANDROID, pojav_environ->bridgeClazz, "accessAndroidClipboard", "(ILjava/lang/String;)Ljava/lang/String;");
@@ -47,6 +63,7 @@ jint JNI_OnLoad(JavaVM* vm, __attribute__((unused)) void* reserved) {
     } else if (pojav_environ->dalvikJavaVMPtr != vm) {
         __android_log_print(ANDROID_LOG_INFO, "Native", "Saving JVM environ...");
         pojav_environ->runtimeJavaVMPtr = vm;
+        jni_env_cache_init(&pojav_environ->runtimeEnvCache, vm);
         (*vm)->GetEnv(vm, (void**) &pojav_environ->runtimeJNIEnvPtr_JRE, JNI_VERSION_1_4);
         pojav_environ->vmGlfwClass = (*pojav_environ->runtimeJNIEnvPtr_JRE)->NewGlobalRef(pojav_environ->runtimeJNIEnvPtr_JRE, (*pojav_environ->runtimeJNIEnvPtr_JRE)->FindClass(pojav_environ->runtimeJNIEnvPtr_JRE, "org/lwjgl/glfw/GLFW"));
         pojav_environ->method_glftSetWindowAttrib = (*pojav_environ->runtimeJNIEnvPtr_JRE)->GetStaticMethodID(pojav_environ->runtimeJNIEnvPtr_JRE, pojav_environ->vmGlfwClass, "glfwSetWindowAttrib", "(JII)V");
@@ -60,6 +77,19 @@ jint JNI_OnLoad(JavaVM* vm, __attribute__((unused)) void* reserved) {
         hookExec();
         installLwjglDlopenHook();
         installEMUIIteratorMititgation();
+        pojav_environ->isInputCoalescing = getenv("POJAV_INPUT_COALESCE") != NULL;
+        pojav_environ->isInputLatencyTracking = getenv("POJAV_INPUT_LATENCY") != NULL;
+        pojav_environ->inputOverflowPolicy = input_overflow_parse_policy(getenv("POJAV_INPUT_OVERFLOW"));
+        pojav_environ->isLateLatching = getenv("POJAV_LATE_LATCH") != NULL;
+        const char* recordPath = getenv("POJAV_INPUT_RECORD");
+        if (recordPath != NULL) {
+            if (input_trace_open(&pojav_environ->inputTrace, recordPath))
+                __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Recording input to %s", recordPath);
+            else
+                __android_log_print(ANDROID_LOG_ERROR, "NativeInput", "Failed to create input trace %s", recordPath);
+        }
+        const char* replayPath = getenv("POJAV_INPUT_REPLAY");
+        if (replayPath != NULL) startInputReplay(replayPath);
     }
 
     if(pojav_environ->dalvikJavaVMPtr == vm) {
@@ -96,105 +126,366 @@ void handleFramebufferSizeJava(long window, int w, int h) {
     (*pojav_environ->runtimeJNIEnvPtr_JRE)->CallStaticVoidMethod(pojav_environ->runtimeJNIEnvPtr_JRE, pojav_environ->vmGlfwClass, pojav_environ->method_internalWindowSizeChanged, (long)window, w, h);
 }
 
+static void dispatchEvent(void* window, const GLFWInputEvent* event) {
+    switch (event->type) {
+        case EVENT_TYPE_CHAR:
+            if(pojav_environ->GLFW_invoke_Char) pojav_environ->GLFW_invoke_Char(window, event->i1);
+            break;
+        case EVENT_TYPE_CHAR_MODS:
+            if(pojav_environ->GLFW_invoke_CharMods) pojav_environ->GLFW_invoke_CharMods(window, event->i1, event->i2);
+            break;
+        case EVENT_TYPE_KEY:
+            if(pojav_environ->GLFW_invoke_Key) pojav_environ->GLFW_invoke_Key(window, event->i1, event->i2, event->i3, event->i4);
+            break;
+        case EVENT_TYPE_MOUSE_BUTTON:
+            if(pojav_environ->GLFW_invoke_MouseButton) pojav_environ->GLFW_invoke_MouseButton(window, event->i1, event->i2, event->i3);
+            break;
+        case EVENT_TYPE_SCROLL:
+            if(pojav_environ->GLFW_invoke_Scroll) pojav_environ->GLFW_invoke_Scroll(window, event->i1, event->i2);
+            break;
+        case EVENT_TYPE_FRAMEBUFFER_SIZE:
+            handleFramebufferSizeJava(pojav_environ->showingWindow, event->i1, event->i2);
+            if(pojav_environ->GLFW_invoke_FramebufferSize) pojav_environ->GLFW_invoke_FramebufferSize(window, event->i1, event->i2);
+            break;
+        case EVENT_TYPE_WINDOW_SIZE:
+            handleFramebufferSizeJava(pojav_environ->showingWindow, event->i1, event->i2);
+            if(pojav_environ->GLFW_invoke_WindowSize) pojav_environ->GLFW_invoke_WindowSize(window, event->i1, event->i2);
+            break;
+    }
+}
+
+static void dispatchSpan(void* window, input_span_t* span) {
+    bool trackLatency = pojav_environ->latencyPending && !span->measured;
+    span->measured = true;
+    for (size_t index = span->start; index != span->end; index++) {
+        GLFWInputEvent event = *input_ring_at(span->ring, index);
+        if (trackLatency)
+            input_latency_record(&pojav_environ->inputLatency, event.type,
+                                 input_ring_stamp_at(span->ring, index), input_latency_now());
+        dispatchEvent(window, &event);
+    }
+}
+
+/** Dispatch what was folded into the overflow mailbox, it is always newer than the queued events */
+static void dispatchOverflowPending(void* window) {
+    input_overflow_pending_t* pending = &pojav_environ->overflowPending;
+    if (!pending->hasAny) return;
+    for (int key = 0; key < INPUT_OVERFLOW_KEYS; key++) {
+        if (pending->keyReleases[key / 32] & (1u << (key % 32)))
+            dispatchEvent(window, &(GLFWInputEvent) { EVENT_TYPE_KEY, key, 0, 0, 0 });
+    }
+    for (int button = 0; button < INPUT_OVERFLOW_MOUSE_BUTTONS; button++) {
+        if (pending->mouseReleases & (1u << button))
+            dispatchEvent(window, &(GLFWInputEvent) { EVENT_TYPE_MOUSE_BUTTON, button, 0, 0, 0 });
+    }
+    if (pending->scrollX || pending->scrollY)
+        dispatchEvent(window, &(GLFWInputEvent) { EVENT_TYPE_SCROLL, pending->scrollX, pending->scrollY, 0, 0 });
+    if (pending->framebufferSize)
+        dispatchEvent(window, &(GLFWInputEvent) { EVENT_TYPE_FRAMEBUFFER_SIZE,
+                (int) (pending->framebufferSize >> 32), (int) (uint32_t) pending->framebufferSize, 0, 0 });
+    if (pending->windowSize)
+        dispatchEvent(window, &(GLFWInputEvent) { EVENT_TYPE_WINDOW_SIZE,
+                (int) (pending->windowSize >> 32), (int) (uint32_t) pending->windowSize, 0, 0 });
+}
+
+/** Whether input routed to `target` goes to `window`. Nothing was shown yet with 0, then every window gets it. */
+static bool isRoutedTo(void* window, long target) {
+    return target == 0 || target == (long) window;
+}
+
 void pojavPumpEvents(void* window) {
-    if(pojav_environ->shouldUpdateMouse) {
-        pojav_environ->GLFW_invoke_CursorPos(window, floor(pojav_environ->cursorX),
-                                             floor(pojav_environ->cursorY));
+    // The cursor and the overflow mailbox always belong to the window shown right now
+    bool isShowing = isRoutedTo(window, pojav_environ->showingWindow);
+    if(pojav_environ->shouldUpdateMouse && isShowing) {
+        // Grabbed camera motion keeps its sub-pixel part, the GUI gets whole pixels like before
+        if (pojav_environ->isGrabbing) {
+            pojav_environ->GLFW_invoke_CursorPos(window, pojav_environ->cLastX, pojav_environ->cLastY);
+        } else {
+            pojav_environ->GLFW_invoke_CursorPos(window, floor(pojav_environ->cLastX),
+                                                 floor(pojav_environ->cLastY));
+        }
     }
 
-    size_t index = pojav_environ->outEventIndex;
-    size_t targetIndex = pojav_environ->outTargetIndex;
+    // Spans are in queue order, the first segment always holds the older events, see queueEvents()
+    for (size_t span = 0; span < pojav_environ->pumpSpanCount; span++) {
+        if (isRoutedTo(window, pojav_environ->pumpSpans[span].window))
+            dispatchSpan(window, &pojav_environ->pumpSpans[span]);
+    }
+    if (isShowing) dispatchOverflowPending(window);
+
+    // The ring tail is only moved forward by pojavStopPumping()
+}
 
-    while (targetIndex != index) {
-        GLFWInputEvent event = pojav_environ->events[index];
-        switch (event.type) {
-            case EVENT_TYPE_CHAR:
-                if(pojav_environ->GLFW_invoke_Char) pojav_environ->GLFW_invoke_Char(window, event.i1);
+/**
+ * Fold the events of the current pumping batch in place, before any window sees them.
+ * - In a run of consecutive resize events, only the last FRAMEBUFFER_SIZE and the last WINDOW_SIZE are kept
+ * - Consecutive SCROLL events are summed up into the first one
+ * Slots between the ring tail and the read target belong to the consumer, so rewriting them is safe.
+ */
+static void coalesceEvents(input_ring_t* ring) {
+    GLFWInputEvent* lastFramebufferSize = NULL;
+    GLFWInputEvent* lastWindowSize = NULL;
+    GLFWInputEvent* lastScroll = NULL;
+
+    for (size_t index = input_ring_read_start(ring); index != ring->readTarget; index++) {
+        GLFWInputEvent* event = input_ring_at(ring, index);
+        switch (event->type) {
+            case EVENT_TYPE_FRAMEBUFFER_SIZE:
+                if (lastFramebufferSize) {
+                    lastFramebufferSize->type = EVENT_TYPE_FOLDED;
+                    pojav_environ->foldedResizeEvents++;
+                }
+                lastFramebufferSize = event;
+                lastScroll = NULL;
+                break;
+            case EVENT_TYPE_WINDOW_SIZE:
+                if (lastWindowSize) {
+                    lastWindowSize->type = EVENT_TYPE_FOLDED;
+                    pojav_environ->foldedResizeEvents++;
+                }
+                lastWindowSize = event;
+                lastScroll = NULL;
+                break;
+            case EVENT_TYPE_SCROLL:
+                if (lastScroll) {
+                    lastScroll->i1 += event->i1;
+                    lastScroll->i2 += event->i2;
+                    event->type = EVENT_TYPE_FOLDED;
+                    pojav_environ->foldedScrollEvents++;
+                } else {
+                    lastScroll = event;
+                }
+                lastFramebufferSize = lastWindowSize = NULL;
                 break;
-            case EVENT_TYPE_CHAR_MODS:
-                if(pojav_environ->GLFW_invoke_CharMods) pojav_environ->GLFW_invoke_CharMods(window, event.i1, event.i2);
+            default:
+                lastFramebufferSize = lastWindowSize = lastScroll = NULL;
                 break;
+        }
+    }
+}
+
+/**
+ * drop_oldest policy: the producer had to spill into the second segment, so the first one is stale.
+ * Its events are discarded, except for key and mouse button releases so that nothing stays held
+ * down, and resizes so that the game ends up with the right size.
+ */
+static void discardStaleEvents(input_ring_t* ring) {
+    size_t discarded = 0;
+    for (size_t index = input_ring_read_start(ring); index != ring->readTarget; index++) {
+        GLFWInputEvent* event = input_ring_at(ring, index);
+        switch (event->type) {
             case EVENT_TYPE_KEY:
-                if(pojav_environ->GLFW_invoke_Key) pojav_environ->GLFW_invoke_Key(window, event.i1, event.i2, event.i3, event.i4);
+                if (event->i3 == 0) continue;
                 break;
             case EVENT_TYPE_MOUSE_BUTTON:
-                if(pojav_environ->GLFW_invoke_MouseButton) pojav_environ->GLFW_invoke_MouseButton(window, event.i1, event.i2, event.i3);
-                break;
-            case EVENT_TYPE_SCROLL:
-                if(pojav_environ->GLFW_invoke_Scroll) pojav_environ->GLFW_invoke_Scroll(window, event.i1, event.i2);
+                if (event->i2 == 0) continue;
                 break;
             case EVENT_TYPE_FRAMEBUFFER_SIZE:
-                handleFramebufferSizeJava(pojav_environ->showingWindow, event.i1, event.i2);
-                if(pojav_environ->GLFW_invoke_FramebufferSize) pojav_environ->GLFW_invoke_FramebufferSize(window, event.i1, event.i2);
-                break;
             case EVENT_TYPE_WINDOW_SIZE:
-                handleFramebufferSizeJava(pojav_environ->showingWindow, event.i1, event.i2);
-                if(pojav_environ->GLFW_invoke_WindowSize) pojav_environ->GLFW_invoke_WindowSize(window, event.i1, event.i2);
-                break;
+            case EVENT_TYPE_FOLDED:
+            case EVENT_TYPE_ROUTE:
+                continue;
         }
+        event->type = EVENT_TYPE_FOLDED;
+        discarded++;
+    }
+    atomic_fetch_add_explicit(&pojav_environ->droppedEvents, discarded, memory_order_relaxed);
+}
 
-        index++;
-        if (index >= EVENT_WINDOW_SIZE)
-            index -= EVENT_WINDOW_SIZE;
+static void addSpan(input_ring_t* ring, size_t start, size_t end, size_t limit) {
+    if (start == end) return;
+    size_t count = pojav_environ->pumpSpanCount;
+    input_span_t* last = count ? &pojav_environ->pumpSpans[count - 1] : NULL;
+    // Route markers left inside a merged span are ignored by dispatchEvent()
+    if (last && last->ring == ring &&
+        (last->window == pojav_environ->pumpRouteWindow || count == limit)) {
+        // Out of spans means a window was shown and hidden dozens of times in one frame: let every window have the rest
+        if (last->window != pojav_environ->pumpRouteWindow) last->window = 0;
+        last->end = end;
+        return;
     }
+    pojav_environ->pumpSpans[count] = (input_span_t) { ring, start, end, pojav_environ->pumpRouteWindow, false };
+    pojav_environ->pumpSpanCount = count + 1;
+}
 
-    // The out target index is updated by the rewinder
+/**
+ * Split the claimed events of a segment into per-window spans at the route markers queueEvents()
+ * put in, so that each pojavPumpEvents() only walks the events of its own window.
+ * @param limit how many spans this segment may use up
+ */
+static void partitionEvents(input_ring_t* ring, size_t limit) {
+    size_t start = input_ring_read_start(ring);
+    for (size_t index = start; index != ring->readTarget; index++) {
+        GLFWInputEvent* event = input_ring_at(ring, index);
+        if (event->type != EVENT_TYPE_ROUTE) continue;
+        addSpan(ring, start, index, limit);
+        pojav_environ->pumpRouteWindow = (long) (((uint64_t) (uint32_t) event->i2 << 32) | (uint32_t) event->i1);
+        start = index + 1;
+    }
+    addSpan(ring, start, ring->readTarget, limit);
 }
 
 /** Prepare the library for sending out callbacks to all windows */
 void pojavStartPumping() {
-    size_t counter = atomic_load_explicit(&pojav_environ->eventCounter, memory_order_acquire);
-    size_t index = pojav_environ->outEventIndex;
-
-    unsigned targetIndex = index + counter;
-    if (targetIndex >= EVENT_WINDOW_SIZE)
-        targetIndex -= EVENT_WINDOW_SIZE;
-
-    // Only accessed by one unique thread, no need for atomic store
-    pojav_environ->inEventCount = counter;
-    pojav_environ->outTargetIndex = targetIndex;
+    // Events published after this point are left for the next round.
+    // The second segment is claimed first: anything the producer put in the first segment after
+    // that is newer than the claimed part of the second one, so it has to wait for the next round.
+    input_ring_t* segment = atomic_load_explicit(&pojav_environ->overflowRing, memory_order_acquire);
+    size_t segmentCounter = segment ? input_ring_begin_read(segment) : 0;
+    size_t counter = input_ring_begin_read(&pojav_environ->inputRing);
+    pojav_environ->pumpingOverflowRing = segment;
+    // The mailbox is newer than what was queued before it became active. If a press got the last
+    // free slot after the heads were claimed and its release went to the mailbox, the mailbox is
+    // held back for the next round, otherwise the release would be dispatched before the press.
+    input_overflow_pending_t* pending = &pojav_environ->overflowPending;
+    if (pending->hasAny) memset(pending, 0, sizeof(input_overflow_pending_t));
+    pending->hasAny = input_overflow_take(&pojav_environ->inputOverflow, pending)
+                      && input_overflow_reached(&pojav_environ->inputOverflow, pojav_environ->inputRing.readTarget,
+                                                segment ? segment->readTarget : 0);
+
+    if (counter + segmentCounter > atomic_load_explicit(&pojav_environ->queueHighWater, memory_order_relaxed))
+        atomic_store_explicit(&pojav_environ->queueHighWater, counter + segmentCounter, memory_order_relaxed);
+    if (pojav_environ->inputOverflowPolicy == INPUT_OVERFLOW_DROP_OLDEST && segmentCounter > 0)
+        discardStaleEvents(&pojav_environ->inputRing);
+
+    pojav_environ->latencyPending = pojav_environ->isInputLatencyTracking && counter + segmentCounter > 0;
+    if (pojav_environ->isInputCoalescing && counter + segmentCounter > 1) {
+        coalesceEvents(&pojav_environ->inputRing);
+        if (segmentCounter > 1) coalesceEvents(segment);
+#ifdef DEBUG
+        LOGD("Input coalescing: %zu resize and %zu scroll events folded so far\n",
+             pojav_environ->foldedResizeEvents, pojav_environ->foldedScrollEvents);
+#endif
+    }
+    pojav_environ->pumpSpanCount = 0;
+    // The first segment keeps one span free for the second one
+    partitionEvents(&pojav_environ->inputRing, INPUT_MAX_SPANS - 1);
+    if (segmentCounter > 0) partitionEvents(segment, INPUT_MAX_SPANS);
 
     //PumpEvents is called for every window, so this logic should be there in order to correctly distribute events to all windows.
-    if((pojav_environ->cLastX != pojav_environ->cursorX || pojav_environ->cLastY != pojav_environ->cursorY) && pojav_environ->GLFW_invoke_CursorPos) {
-        pojav_environ->cLastX = pojav_environ->cursorX;
-        pojav_environ->cLastY = pojav_environ->cursorY;
+    // The motion is taken every round, so that a grab never starts with the motion made in menus
+    double x, y, dx, dy;
+    cursor_state_take_motion(&pojav_environ->cursor, &dx, &dy);
+    if (pojav_environ->isGrabbing) {
+        // Sum of every sample since the last round, rather than whichever sample came in last
+        x = pojav_environ->cLastX + dx;
+        y = pojav_environ->cLastY + dy;
+    } else {
+        cursor_state_read(&pojav_environ->cursor, &x, &y);
+    }
+    if (pojav_environ->isLateLatching) late_latch_pumped(&pojav_environ->lateLatch);
+    if((pojav_environ->cLastX != x || pojav_environ->cLastY != y) && pojav_environ->GLFW_invoke_CursorPos) {
+        pojav_environ->cLastX = x;
+        pojav_environ->cLastY = y;
         pojav_environ->shouldUpdateMouse = true;
     }
 }
 
 /** Prepare the library for the next round of new events */
 void pojavStopPumping() {
-    pojav_environ->outEventIndex = pojav_environ->outTargetIndex;
-
-    // New events may have arrived while pumping, so remove only the difference before the start and end of execution
-    atomic_fetch_sub_explicit(&pojav_environ->eventCounter, pojav_environ->inEventCount, memory_order_acquire);
+    // New events may have arrived while pumping, so only release the slots claimed by pojavStartPumping()
+    input_ring_end_read(&pojav_environ->inputRing);
+    if (pojav_environ->pumpingOverflowRing) input_ring_end_read(pojav_environ->pumpingOverflowRing);
     // Make sure the next frame won't send mouse updates if it's unnecessary
     pojav_environ->shouldUpdateMouse = false;
+    if (pojav_environ->inputTrace.file)
+        input_trace_flush(&pojav_environ->inputTrace, input_latency_now());
+}
+
+JNIEXPORT void JNICALL JavaCritical_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(__attribute__((unused)) jlong window, jint lengthx, jdouble* xpos, jint lengthy, jdouble* ypos) {
+    // While grabbed the game works with the position built from summed motion, report that one
+    if (pojav_environ->isGrabbing) {
+        *xpos = pojav_environ->cLastX;
+        *ypos = pojav_environ->cLastY;
+    } else {
+        cursor_state_read(&pojav_environ->cursor, xpos, ypos);
+    }
 }
 
 JNIEXPORT void JNICALL
-Java_org_lwjgl_glfw_GLFW_nglfwGetCursorPos(JNIEnv *env, __attribute__((unused)) jclass clazz, __attribute__((unused)) jlong window, jobject xpos,
+Java_org_lwjgl_glfw_GLFW_nglfwGetCursorPos(JNIEnv *env, __attribute__((unused)) jclass clazz, jlong window, jobject xpos,
                                           jobject ypos) {
-    *(double*)(*env)->GetDirectBufferAddress(env, xpos) = pojav_environ->cursorX;
-    *(double*)(*env)->GetDirectBufferAddress(env, ypos) = pojav_environ->cursorY;
+    JavaCritical_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(window, 1, (*env)->GetDirectBufferAddress(env, xpos), 1, (*env)->GetDirectBufferAddress(env, ypos));
 }
 
-JNIEXPORT void JNICALL JavaCritical_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(__attribute__((unused)) jlong window, jint lengthx, jdouble* xpos, jint lengthy, jdouble* ypos) {
-    *xpos = pojav_environ->cursorX;
-    *ypos = pojav_environ->cursorY;
+JNIEXPORT void JNICALL
+Java_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(JNIEnv *env, __attribute__((unused)) jclass clazz, jlong window,
+                                            jdoubleArray xpos, jdoubleArray ypos) {
+    jdouble x, y;
+    JavaCritical_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(window, 1, &x, 1, &y);
+    (*env)->SetDoubleArrayRegion(env, xpos, 0,1, &x);
+    (*env)->SetDoubleArrayRegion(env, ypos, 0,1, &y);
 }
 
+/**
+ * Late latching hook for renderers: the cursor motion that came in since pojavStartPumping(), on top
+ * of the position the game got for this frame. Meant to be called as close to the buffer swap as possible.
+ */
+void pojavLateLatchCursor(double* dx, double* dy) {
+    if (pojav_environ->isGrabbing) {
+        // Nothing takes the motion before the next round, so it is exactly what came in since
+        cursor_state_peek_motion(&pojav_environ->cursor, dx, dy);
+    } else {
+        double x, y;
+        cursor_state_read(&pojav_environ->cursor, &x, &y);
+        *dx = x - pojav_environ->cLastX;
+        *dy = y - pojav_environ->cLastY;
+    }
+}
+
+/**
+ * Java side of pojavLateLatchCursor().
+ * @return false if late latching is disabled (POJAV_LATE_LATCH is not set)
+ */
+JNIEXPORT jboolean JNICALL
+Java_org_lwjgl_glfw_GLFW_nglfwLateLatchCursor(JNIEnv *env, __attribute__((unused)) jclass clazz, jdoubleArray delta) {
+    if (!pojav_environ->isLateLatching) return JNI_FALSE;
+    jdouble values[2];
+    pojavLateLatchCursor(&values[0], &values[1]);
+    (*env)->SetDoubleArrayRegion(env, delta, 0, 2, values);
+    return JNI_TRUE;
+}
+
+/**
+ * All key and mouse button states in one call, see key_state.h for the layout.
+ * Fills as much of `state` as fits. The changed mask covers what changed since the previous snapshot
+ * taken into the same array, an array without room for the generation gets every change since the start.
+ */
 JNIEXPORT void JNICALL
-Java_org_lwjgl_glfw_GLFW_nglfwGetCursorPosA(JNIEnv *env, __attribute__((unused)) jclass clazz, __attribute__((unused)) jlong window,
-                                            jdoubleArray xpos, jdoubleArray ypos) {
-    (*env)->SetDoubleArrayRegion(env, xpos, 0,1, &pojav_environ->cursorX);
-    (*env)->SetDoubleArrayRegion(env, ypos, 0,1, &pojav_environ->cursorY);
+Java_org_lwjgl_glfw_GLFW_glfwGetKeyStateSnapshot(JNIEnv *env, __attribute__((unused)) jclass clazz, jlongArray state) {
+    int64_t values[KEY_STATE_SNAPSHOT];
+    jsize length = (*env)->GetArrayLength(env, state);
+    values[KEY_STATE_GENERATION] = 0;
+    if (length > KEY_STATE_GENERATION)
+        (*env)->GetLongArrayRegion(env, state, KEY_STATE_GENERATION, 1, (jlong*) &values[KEY_STATE_GENERATION]);
+    key_state_snapshot(&pojav_environ->keyState, values);
+    if (length > KEY_STATE_SNAPSHOT) length = KEY_STATE_SNAPSHOT;
+    (*env)->SetLongArrayRegion(env, state, 0, length, (const jlong*) values);
+}
+
+/**
+ * Park the game thread until there is input to pump, glfwPostEmptyEvent() is called or the timeout expires.
+ * @param timeout in seconds, negative to wait forever
+ */
+JNIEXPORT void JNICALL
+Java_org_lwjgl_glfw_GLFW_nglfwWaitEvents(__attribute__((unused)) JNIEnv *env, __attribute__((unused)) jclass clazz, jdouble timeout) {
+    // Only the first segment can be waited on, overflowed input is already there to pump
+    input_ring_t* segment = atomic_load_explicit(&pojav_environ->overflowRing, memory_order_acquire);
+    if (segment && atomic_load_explicit(&segment->head, memory_order_acquire) != atomic_load_explicit(&segment->tail, memory_order_relaxed))
+        return;
+    input_ring_wait(&pojav_environ->inputRing, timeout < 0 ? -1 : (int64_t) (timeout * 1e9));
+}
+
+JNIEXPORT void JNICALL
+Java_org_lwjgl_glfw_GLFW_glfwPostEmptyEvent(__attribute__((unused)) JNIEnv *env, __attribute__((unused)) jclass clazz) {
+    input_ring_post_wakeup(&pojav_environ->inputRing);
 }
 
 JNIEXPORT void JNICALL JavaCritical_org_lwjgl_glfw_GLFW_glfwSetCursorPos(__attribute__((unused)) jlong window, jdouble xpos,
                                                                          jdouble ypos) {
-    pojav_environ->cLastX = pojav_environ->cursorX = xpos;
-    pojav_environ->cLastY = pojav_environ->cursorY = ypos;
+    cursor_state_set(&pojav_environ->cursor, xpos, ypos);
+    pojav_environ->cLastX = xpos;
+    pojav_environ->cLastY = ypos;
 }
 
 JNIEXPORT void JNICALL
@@ -205,18 +496,105 @@ Java_org_lwjgl_glfw_GLFW_glfwSetCursorPos(__attribute__((unused)) JNIEnv *env, _
 
 
 
-void sendData(int type, int i1, int i2, int i3, int i4) {
-    GLFWInputEvent *event = &pojav_environ->events[pojav_environ->inEventIndex];
-    event->type = type;
-    event->i1 = i1;
-    event->i2 = i2;
-    event->i3 = i3;
-    event->i4 = i4;
+static input_ring_t* allocateOverflowRing() {
+    input_ring_t* segment;
+    if (posix_memalign((void**) &segment, INPUT_RING_CACHE_LINE, sizeof(input_ring_t)) != 0) return NULL;
+    memset(segment, 0, sizeof(input_ring_t));
+    atomic_store_explicit(&pojav_environ->overflowRing, segment, memory_order_release);
+    __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Input queue overflowed, second segment allocated");
+    return segment;
+}
 
-    if (++pojav_environ->inEventIndex >= EVENT_WINDOW_SIZE)
-        pojav_environ->inEventIndex -= EVENT_WINDOW_SIZE;
+/** An event found no room in the queue, fold it into the mailbox or drop it */
+static void overflowEvent(const GLFWInputEvent* event) {
+    input_overflow_t* overflow = &pojav_environ->inputOverflow;
+    bool kept;
+    switch (event->type) {
+        case EVENT_TYPE_SCROLL:
+            input_overflow_add_scroll(overflow, event->i1, event->i2);
+            kept = true;
+            break;
+        case EVENT_TYPE_FRAMEBUFFER_SIZE:
+            input_overflow_set_size(&overflow->framebufferSize, event->i1, event->i2);
+            kept = true;
+            break;
+        case EVENT_TYPE_WINDOW_SIZE:
+            input_overflow_set_size(&overflow->windowSize, event->i1, event->i2);
+            kept = true;
+            break;
+        case EVENT_TYPE_KEY:
+            kept = event->i3 == 0 && input_overflow_add_key_release(overflow, event->i1);
+            break;
+        case EVENT_TYPE_MOUSE_BUTTON:
+            kept = event->i2 == 0 && input_overflow_add_mouse_release(overflow, event->i1);
+            break;
+        default:
+            kept = false;
+            break;
+    }
+    atomic_fetch_add_explicit(kept ? &pojav_environ->mailboxedEvents : &pojav_environ->droppedEvents, 1, memory_order_relaxed);
+#ifdef DEBUG
+    if (!kept) LOGD("Input queue is full, dropping event %d\n", event->type);
+#endif
+}
 
-    atomic_fetch_add_explicit(&pojav_environ->eventCounter, 1, memory_order_acquire);
+/** Put events in the ring, or in the second segment when the policy allows it. @return how many made it */
+static size_t pushEvents(const GLFWInputEvent* events, size_t count, uint64_t stamp) {
+    input_ring_t* ring = &pojav_environ->inputRing;
+    // Only this thread ever stores the pointer
+    input_ring_t* segment = atomic_load_explicit(&pojav_environ->overflowRing, memory_order_relaxed);
+    size_t queued = 0;
+    bool mailboxActive = atomic_load_explicit(&pojav_environ->inputOverflow.active, memory_order_acquire);
+    if (!mailboxActive && (segment == NULL || input_ring_producer_drained(segment)))
+        queued = input_ring_push_many(ring, events, count, stamp);
+    if (queued == count) return queued;
+
+    if (!mailboxActive && pojav_environ->inputOverflowPolicy != INPUT_OVERFLOW_COALESCE) {
+        if (segment == NULL) segment = allocateOverflowRing();
+        if (segment != NULL) {
+            queued += input_ring_push_many(segment, events + queued, count - queued, stamp);
+            // Waiters are parked on the first segment, and only check that one for events
+            input_ring_notify_outside(ring);
+        }
+    }
+    return queued;
+}
+
+/**
+ * Android UI thread. Queue events for the game thread, handling overflow as configured by POJAV_INPUT_OVERFLOW.
+ * Once the second segment is in use, events keep going there until the game thread drained it: that
+ * way the first segment only ever holds older events, and pojavPumpEvents() can pump one after the other.
+ */
+static void queueEvents(const GLFWInputEvent* events, size_t count, uint64_t stamp) {
+    // Keep a single producer while a trace is replayed
+    if (isLiveInputBlocked()) return;
+    if (pojav_environ->inputTrace.file)
+        input_trace_write(&pojav_environ->inputTrace, events, count, stamp ? stamp : input_latency_now());
+
+    // Input belongs to the window shown when it comes in, not to the ones pumped later on
+    long window = pojav_environ->showingWindow;
+    if (window != pojav_environ->routedWindow) {
+        GLFWInputEvent route = { EVENT_TYPE_ROUTE, (int) (uint32_t) window, (int) ((uint64_t) window >> 32), 0, 0 };
+        if (pushEvents(&route, 1, 0) == 1) pojav_environ->routedWindow = window;
+    }
+    // Without its marker, the events go to the mailbox, which always belongs to the shown window
+    size_t queued = window == pojav_environ->routedWindow ? pushEvents(events, count, stamp) : 0;
+    if (queued == count) return;
+    input_overflow_t* overflow = &pojav_environ->inputOverflow;
+    if (!atomic_load_explicit(&overflow->active, memory_order_relaxed)) {
+        // Nothing goes to the rings while the mailbox is active, so these heads stay valid until it is taken
+        input_ring_t* segment = atomic_load_explicit(&pojav_environ->overflowRing, memory_order_relaxed);
+        input_overflow_open(overflow, atomic_load_explicit(&pojav_environ->inputRing.head, memory_order_relaxed),
+                            segment ? atomic_load_explicit(&segment->head, memory_order_relaxed) : 0);
+    }
+    for (; queued < count; queued++) overflowEvent(&events[queued]);
+    atomic_store_explicit(&overflow->active, true, memory_order_release);
+    input_ring_notify_outside(&pojav_environ->inputRing);
+}
+
+void sendData(int type, int i1, int i2, int i3, int i4) {
+    GLFWInputEvent event = { type, i1, i2, i3, i4 };
+    queueEvents(&event, 1, pojav_environ->isInputLatencyTracking ? input_latency_now() : 0);
 }
 
 /**
@@ -264,41 +642,161 @@ void noncritical_set_stackqueue(__attribute__((unused)) JNIEnv *env, __attribute
     critical_set_stackqueue(use_input_stack_queue);
 }
 
+/**
+ * The clipboard calls come from threads that stay attached: an exception left pending there
+ * would abort the next JNI call. Logs and clears it.
+ */
+static void clearClipboardException(JNIEnv* env) {
+    if (!(*env)->ExceptionCheck(env)) return;
+    __android_log_print(ANDROID_LOG_ERROR, "NativeInput", "accessAndroidClipboard() threw an exception");
+    (*env)->ExceptionDescribe(env);
+    (*env)->ExceptionClear(env);
+}
+
+/** Hands the clipboard writes of the game to Android, so that glfwSetClipboardString() never waits on it */
+static void* clipboardWriterThread(__attribute__((unused)) void* arg) {
+    JNIEnv *dalvikEnv = jni_env_cache_get(&pojav_environ->dalvikEnvCache);
+    assert(dalvikEnv != NULL);
+    for (;;) {
+        char* text = clipboard_cache_take_write(&pojav_environ->clipboard);
+        if (!jni_env_cache_push_frame(dalvikEnv, 2)) {
+            free(text);
+            continue;
+        }
+        (*dalvikEnv)->CallStaticObjectMethod(dalvikEnv, pojav_environ->bridgeClazz, pojav_environ->method_accessAndroidClipboard,
+                                             CLIPBOARD_COPY, (*dalvikEnv)->NewStringUTF(dalvikEnv, text));
+        clearClipboardException(dalvikEnv);
+        (*dalvikEnv)->PopLocalFrame(dalvikEnv, NULL);
+        free(text);
+    }
+    return NULL;
+}
+
 JNIEXPORT jstring JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeClipboard(JNIEnv* env, __attribute__((unused)) jclass clazz, jint action, jbyteArray copySrc) {
 #ifdef DEBUG
     LOGD("Debug: Clipboard access is going on\n", pojav_environ->isUseStackQueueCall);
 #endif
 
-    JNIEnv *dalvikEnv;
-    (*pojav_environ->dalvikJavaVMPtr)->AttachCurrentThread(pojav_environ->dalvikJavaVMPtr, &dalvikEnv, NULL);
+    char *copySrcC = NULL;
+    if (copySrc) {
+        jbyte* bytes = (*env)->GetByteArrayElements(env, copySrc, NULL);
+        copySrcC = strndup((const char*) bytes, (*env)->GetArrayLength(env, copySrc));
+        (*env)->ReleaseByteArrayElements(env, copySrc, bytes, JNI_ABORT);
+    }
+
+    // Reads and writes go through the cache, only the first read before Android pushed anything waits on it
+    if (action == CLIPBOARD_PASTE) {
+        char* cached = clipboard_cache_read(&pojav_environ->clipboard);
+        if (cached != NULL) {
+            jstring pasteDst = (*env)->NewStringUTF(env, cached);
+            free(cached);
+            free(copySrcC);
+            return pasteDst;
+        }
+    } else if (action == CLIPBOARD_COPY && copySrcC != NULL) {
+        if (clipboard_cache_write(&pojav_environ->clipboard, copySrcC)) {
+            pthread_t writer;
+            if (pthread_create(&writer, NULL, clipboardWriterThread, NULL) == 0) pthread_detach(writer);
+        }
+        return NULL;
+    }
+
+    JNIEnv *dalvikEnv = jni_env_cache_get(&pojav_environ->dalvikEnvCache);
     assert(dalvikEnv != NULL);
     assert(pojav_environ->bridgeClazz != NULL);
-    
-    LOGD("Clipboard: Converting string\n");
-    char *copySrcC;
-    jstring copyDst = NULL;
-    if (copySrc) {
-        copySrcC = (char *)((*env)->GetByteArrayElements(env, copySrc, NULL));
-        copyDst = (*dalvikEnv)->NewStringUTF(dalvikEnv, copySrcC);
+    if (!jni_env_cache_push_frame(dalvikEnv, 4)) {
+        free(copySrcC);
+        return NULL;
     }
 
     LOGD("Clipboard: Calling 2nd\n");
-    jstring pasteDst = convertStringJVM(dalvikEnv, env, (jstring) (*dalvikEnv)->CallStaticObjectMethod(dalvikEnv, pojav_environ->bridgeClazz, pojav_environ->method_accessAndroidClipboard, action, copyDst));
-
-    if (copySrc) {
-        (*dalvikEnv)->DeleteLocalRef(dalvikEnv, copyDst);    
-        (*env)->ReleaseByteArrayElements(env, copySrc, (jbyte *)copySrcC, 0);
+    jstring copyDst = copySrcC ? (*dalvikEnv)->NewStringUTF(dalvikEnv, copySrcC) : NULL;
+    jstring result = (jstring) (*dalvikEnv)->CallStaticObjectMethod(dalvikEnv, pojav_environ->bridgeClazz, pojav_environ->method_accessAndroidClipboard, action, copyDst);
+    clearClipboardException(dalvikEnv);
+    jstring pasteDst = NULL;
+    if (result != NULL) {
+        const char* resultC = (*dalvikEnv)->GetStringUTFChars(dalvikEnv, result, NULL);
+        if (action == CLIPBOARD_PASTE) clipboard_cache_update(&pojav_environ->clipboard, resultC);
+        pasteDst = (*env)->NewStringUTF(env, resultC);
+        (*dalvikEnv)->ReleaseStringUTFChars(dalvikEnv, result, resultC);
     }
-    (*pojav_environ->dalvikJavaVMPtr)->DetachCurrentThread(pojav_environ->dalvikJavaVMPtr);
+
+    (*dalvikEnv)->PopLocalFrame(dalvikEnv, NULL);
+    free(copySrcC);
     return pasteDst;
 }
 
+/** Android UI thread. The system clipboard changed, or could be read again. */
+JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeClipboardChanged(JNIEnv* env, __attribute__((unused)) jclass clazz, jstring text) {
+    const char* textC = (*env)->GetStringUTFChars(env, text, NULL);
+    clipboard_cache_update(&pojav_environ->clipboard, textC);
+    (*env)->ReleaseStringUTFChars(env, text, textC);
+}
+
+/**
+ * Copy the input latency statistics into the given array.
+ * For each event type from EVENT_TYPE_CHAR to EVENT_TYPE_WINDOW_SIZE: count, p50, p95, p99, max in microseconds.
+ * @return false if latency tracking is disabled (POJAV_INPUT_LATENCY is not set)
+ */
+JNIEXPORT jboolean JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeGetInputLatency(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!pojav_environ->isInputLatencyTracking) return JNI_FALSE;
+    int64_t values[INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS];
+    input_latency_snapshot(&pojav_environ->inputLatency, values);
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS) length = INPUT_LATENCY_TYPES * INPUT_LATENCY_STATS;
+    (*env)->SetLongArrayRegion(env, stats, 0, length, (const jlong*) values);
+    return JNI_TRUE;
+}
+
+JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeDumpInputLatency(__attribute__((unused)) JNIEnv* env, __attribute__((unused)) jclass clazz, jboolean reset) {
+    if (!pojav_environ->isInputLatencyTracking) return;
+    input_latency_dump(&pojav_environ->inputLatency);
+    if (reset) input_latency_reset(&pojav_environ->inputLatency);
+}
+
+/**
+ * Copy the input queue overflow statistics into the given array:
+ * policy, capacity, high-water mark, dropped events, events folded into the overflow mailbox.
+ */
+JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeGetInputQueueStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    jlong values[] = {
+            pojav_environ->inputOverflowPolicy,
+            atomic_load_explicit(&pojav_environ->overflowRing, memory_order_acquire) ? 2 * INPUT_RING_CAPACITY : INPUT_RING_CAPACITY,
+            (jlong) atomic_load_explicit(&pojav_environ->queueHighWater, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&pojav_environ->droppedEvents, memory_order_relaxed),
+            (jlong) atomic_load_explicit(&pojav_environ->mailboxedEvents, memory_order_relaxed)
+    };
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > (jsize) (sizeof(values) / sizeof(values[0]))) length = sizeof(values) / sizeof(values[0]);
+    (*env)->SetLongArrayRegion(env, stats, 0, length, values);
+}
+
+/**
+ * Copy the late latching statistics into the given array: swaps, swaps where a newer cursor sample
+ * than the pumped one was available, average and max age gap in microseconds.
+ * @return false if late latching is disabled (POJAV_LATE_LATCH is not set)
+ */
+JNIEXPORT jboolean JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeGetLateLatchStats(JNIEnv* env, __attribute__((unused)) jclass clazz, jlongArray stats) {
+    if (!pojav_environ->isLateLatching) return JNI_FALSE;
+    int64_t values[LATE_LATCH_STATS];
+    late_latch_snapshot(&pojav_environ->lateLatch, values);
+    jsize length = (*env)->GetArrayLength(env, stats);
+    if (length > LATE_LATCH_STATS) length = LATE_LATCH_STATS;
+    (*env)->SetLongArrayRegion(env, stats, 0, length, (const jlong*) values);
+    return JNI_TRUE;
+}
+
 JNIEXPORT jboolean JNICALL JavaCritical_org_lwjgl_glfw_CallbackBridge_nativeSetInputReady(jboolean inputReady) {
 #ifdef DEBUG
     LOGD("Debug: Changing input state, isReady=%d, pojav_environ->isUseStackQueueCall=%d\n", inputReady, pojav_environ->isUseStackQueueCall);
 #endif
     __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Input ready: %i", inputReady);
     pojav_environ->isInputReady = inputReady;
+    // glfwTerminate(): the game is shutting down, and the trace may not get another chance to be flushed
+    if (!inputReady && pojav_environ->inputTrace.file) {
+        input_trace_close(&pojav_environ->inputTrace);
+        __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Input trace closed");
+    }
     return pojav_environ->isUseStackQueueCall;
 }
 
@@ -307,15 +805,15 @@ JNIEXPORT jboolean JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeSetInputRead
 }
 
 JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeSetGrabbing(__attribute__((unused)) JNIEnv* env, __attribute__((unused)) jclass clazz, jboolean grabbing) {
-    JNIEnv *dalvikEnv;
-    (*pojav_environ->dalvikJavaVMPtr)->AttachCurrentThread(pojav_environ->dalvikJavaVMPtr, &dalvikEnv, NULL);
-    (*dalvikEnv)->CallStaticVoidMethod(dalvikEnv, pojav_environ->bridgeClazz, pojav_environ->method_onGrabStateChanged, grabbing);
-    (*pojav_environ->dalvikJavaVMPtr)->DetachCurrentThread(pojav_environ->dalvikJavaVMPtr);
+    JNIEnv *dalvikEnv = jni_env_cache_get(&pojav_environ->dalvikEnvCache);
+    if (dalvikEnv != NULL)
+        (*dalvikEnv)->CallStaticVoidMethod(dalvikEnv, pojav_environ->bridgeClazz, pojav_environ->method_onGrabStateChanged, grabbing);
     pojav_environ->isGrabbing = grabbing;
 }
 
 jboolean critical_send_char(jchar codepoint) {
     if (pojav_environ->GLFW_invoke_Char && pojav_environ->isInputReady) {
+        if (isLiveInputBlocked()) return JNI_TRUE;
         if (pojav_environ->isUseStackQueueCall) {
             sendData(EVENT_TYPE_CHAR, codepoint, 0, 0, 0);
         } else {
@@ -332,6 +830,7 @@ jboolean noncritical_send_char(__attribute__((unused)) JNIEnv* env, __attribute_
 
 jboolean critical_send_char_mods(jchar codepoint, jint mods) {
     if (pojav_environ->GLFW_invoke_CharMods && pojav_environ->isInputReady) {
+        if (isLiveInputBlocked()) return JNI_TRUE;
         if (pojav_environ->isUseStackQueueCall) {
             sendData(EVENT_TYPE_CHAR_MODS, (int) codepoint, mods, 0, 0);
         } else {
@@ -361,6 +860,7 @@ void critical_send_cursor_pos(jfloat x, jfloat y) {
 #ifdef DEBUG
         LOGD("pojav_environ->GLFW_invoke_CursorPos && pojav_environ->isInputReady \n");
 #endif
+        if (isLiveInputBlocked()) return;
         if (!pojav_environ->isCursorEntered) {
             if (pojav_environ->GLFW_invoke_CursorEnter) {
                 pojav_environ->isCursorEntered = true;
@@ -379,8 +879,15 @@ void critical_send_cursor_pos(jfloat x, jfloat y) {
         if (!pojav_environ->isUseStackQueueCall) {
             pojav_environ->GLFW_invoke_CursorPos((void*) pojav_environ->showingWindow, (double) (x), (double) (y));
         } else {
-            pojav_environ->cursorX = x;
-            pojav_environ->cursorY = y;
+            if (pojav_environ->inputTrace.file) {
+                union { jfloat value; jint bits; } bitsX = { x }, bitsY = { y };
+                GLFWInputEvent event = { EVENT_TYPE_CURSOR_POS, bitsX.bits, bitsY.bits, 0, 0 };
+                input_trace_write(&pojav_environ->inputTrace, &event, 1, input_latency_now());
+            }
+            cursor_state_move(&pojav_environ->cursor, x, y);
+            if (pojav_environ->isLateLatching) late_latch_sample(&pojav_environ->lateLatch, input_latency_now());
+            // The cursor doesn't go through the ring, but glfwWaitEvents() still has to notice it
+            input_ring_notify_outside(&pojav_environ->inputRing);
         }
     }
 }
@@ -393,8 +900,9 @@ void noncritical_send_cursor_pos(__attribute__((unused)) JNIEnv* env, __attribut
        __typeof__ (b) _b = (b); \
      _a > _b ? _a : _b; })
 void critical_send_key(jint key, jint scancode, jint action, jint mods) {
-    if (pojav_environ->GLFW_invoke_Key && pojav_environ->isInputReady) {
+    if (pojav_environ->GLFW_invoke_Key && pojav_environ->isInputReady && !isLiveInputBlocked()) {
         pojav_environ->keyDownBuffer[max(0, key-31)] = (jbyte) action;
+        key_state_set_key(&pojav_environ->keyState, max(0, key-31), action != 0);
         if (pojav_environ->isUseStackQueueCall) {
             sendData(EVENT_TYPE_KEY, key, scancode, action, mods);
         } else {
@@ -407,8 +915,9 @@ void noncritical_send_key(__attribute__((unused)) JNIEnv* env, __attribute__((un
 }
 
 void critical_send_mouse_button(jint button, jint action, jint mods) {
-    if (pojav_environ->GLFW_invoke_MouseButton && pojav_environ->isInputReady) {
+    if (pojav_environ->GLFW_invoke_MouseButton && pojav_environ->isInputReady && !isLiveInputBlocked()) {
         pojav_environ->mouseDownBuffer[max(0, button)] = (jbyte) action;
+        key_state_set_mouse_button(&pojav_environ->keyState, max(0, button), action != 0);
         if (pojav_environ->isUseStackQueueCall) {
             sendData(EVENT_TYPE_MOUSE_BUTTON, button, action, mods, 0);
         } else {
@@ -424,7 +933,7 @@ void noncritical_send_mouse_button(__attribute__((unused)) JNIEnv* env, __attrib
 void critical_send_screen_size(jint width, jint height) {
     pojav_environ->savedWidth = width;
     pojav_environ->savedHeight = height;
-    if (pojav_environ->isInputReady) {
+    if (pojav_environ->isInputReady && !isLiveInputBlocked()) {
         if (pojav_environ->GLFW_invoke_FramebufferSize) {
             if (pojav_environ->isUseStackQueueCall) {
                 sendData(EVENT_TYPE_FRAMEBUFFER_SIZE, width, height, 0, 0);
@@ -448,7 +957,7 @@ void noncritical_send_screen_size(__attribute__((unused)) JNIEnv* env, __attribu
 }
 
 void critical_send_scroll(jdouble xoffset, jdouble yoffset) {
-    if (pojav_environ->GLFW_invoke_Scroll && pojav_environ->isInputReady) {
+    if (pojav_environ->GLFW_invoke_Scroll && pojav_environ->isInputReady && !isLiveInputBlocked()) {
         if (pojav_environ->isUseStackQueueCall) {
             sendData(EVENT_TYPE_SCROLL, (int)xoffset, (int)yoffset, 0, 0);
         } else {
@@ -461,6 +970,126 @@ void noncritical_send_scroll(__attribute__((unused)) JNIEnv* env, __attribute__(
     critical_send_scroll(xoffset, yoffset);
 }
 
+/**
+ * Apply the side effects the matching critical_send_* function would have for a batched event.
+ * @return whether the event has to be queued
+ */
+static bool prepareBatchedEvent(const GLFWInputEvent* event) {
+    switch (event->type) {
+        case EVENT_TYPE_CHAR:
+            return pojav_environ->GLFW_invoke_Char != NULL;
+        case EVENT_TYPE_CHAR_MODS:
+            return pojav_environ->GLFW_invoke_CharMods != NULL;
+        case EVENT_TYPE_KEY:
+            if (!pojav_environ->GLFW_invoke_Key) return false;
+            pojav_environ->keyDownBuffer[max(0, event->i1-31)] = (jbyte) event->i3;
+            key_state_set_key(&pojav_environ->keyState, max(0, event->i1-31), event->i3 != 0);
+            return true;
+        case EVENT_TYPE_MOUSE_BUTTON:
+            if (!pojav_environ->GLFW_invoke_MouseButton) return false;
+            pojav_environ->mouseDownBuffer[max(0, event->i1)] = (jbyte) event->i2;
+            key_state_set_mouse_button(&pojav_environ->keyState, max(0, event->i1), event->i2 != 0);
+            return true;
+        case EVENT_TYPE_SCROLL:
+            return pojav_environ->GLFW_invoke_Scroll != NULL;
+        default:
+            return false;
+    }
+}
+
+static void sendBatchedEventDirect(const GLFWInputEvent* event) {
+    switch (event->type) {
+        case EVENT_TYPE_CHAR: critical_send_char((jchar) event->i1); break;
+        case EVENT_TYPE_CHAR_MODS: critical_send_char_mods((jchar) event->i1, event->i2); break;
+        case EVENT_TYPE_KEY: critical_send_key(event->i1, event->i2, event->i3, event->i4); break;
+        case EVENT_TYPE_MOUSE_BUTTON: critical_send_mouse_button(event->i1, event->i2, event->i3); break;
+        case EVENT_TYPE_SCROLL: critical_send_scroll(event->i1, event->i2); break;
+    }
+}
+
+/**
+ * Receive many input events packed by the Android side in one JNI transition.
+ * The buffer holds `count` GLFWInputEvent records in native byte order. It is only touched by the
+ * Android UI thread, so the queued events are compacted in place and pushed to the ring in one go.
+ */
+JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeSendEventBatch(JNIEnv* env, __attribute__((unused)) jclass clazz, jobject buffer, jint count) {
+    GLFWInputEvent* events = (*env)->GetDirectBufferAddress(env, buffer);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, buffer) / (jlong) sizeof(GLFWInputEvent);
+    // prepareBatchedEvent() writes the key buffers before queueEvents() could drop the events
+    if (events == NULL || count <= 0 || !pojav_environ->isInputReady || isLiveInputBlocked()) return;
+    if (count > capacity) count = (jint) capacity;
+
+    uint64_t stamp = pojav_environ->isInputLatencyTracking ? input_latency_now() : 0;
+    size_t queued = 0;
+    for (jint i = 0; i < count; i++) {
+        GLFWInputEvent event = events[i];
+        if (event.type == EVENT_TYPE_CURSOR_POS) {
+            union { jint bits; jfloat value; } x = { event.i1 }, y = { event.i2 };
+            // Entering the window queues an event of its own, keep it behind what came before
+            if (!pojav_environ->isCursorEntered && queued > 0) {
+                queueEvents(events, queued, stamp);
+                queued = 0;
+            }
+            critical_send_cursor_pos(x.value, y.value);
+        } else if (!pojav_environ->isUseStackQueueCall) {
+            sendBatchedEventDirect(&event);
+        } else if (prepareBatchedEvent(&event)) {
+            events[queued++] = event;
+        }
+    }
+    if (queued > 0) queueEvents(events, queued, stamp);
+}
+
+
+/** Feed a replayed event through the same path live input takes */
+static void replayEvent(const GLFWInputEvent* event, __attribute__((unused)) void* user) {
+    switch (event->type) {
+        case EVENT_TYPE_CURSOR_POS: {
+            union { jint bits; jfloat value; } x = { event->i1 }, y = { event->i2 };
+            critical_send_cursor_pos(x.value, y.value);
+            break;
+        }
+        case EVENT_TYPE_FRAMEBUFFER_SIZE:
+        case EVENT_TYPE_WINDOW_SIZE:
+            if (pojav_environ->isInputReady && pojav_environ->isUseStackQueueCall)
+                sendData(event->type, event->i1, event->i2, 0, 0);
+            break;
+        case EVENT_TYPE_CURSOR_ENTER:
+            // Sent again by critical_send_cursor_pos() if needed
+            break;
+        default:
+            sendBatchedEventDirect(event);
+            break;
+    }
+}
+
+static void* inputReplayThread(void* path) {
+    isReplayThread = true;
+    // Events sent before the game is ready would be thrown away
+    while (!pojav_environ->isInputReady) usleep(100000);
+    const char* speedValue = getenv("POJAV_INPUT_REPLAY_SPEED");
+    double speed = speedValue ? atof(speedValue) : 1;
+    __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Replaying input from %s", (const char*) path);
+    atomic_store(&pojav_environ->isInputReplaying, true);
+    long replayed = input_trace_replay(path, speed, replayEvent, NULL);
+    atomic_store(&pojav_environ->isInputReplaying, false);
+    if (replayed < 0)
+        __android_log_print(ANDROID_LOG_ERROR, "NativeInput", "Failed to read input trace %s", (const char*) path);
+    else
+        __android_log_print(ANDROID_LOG_INFO, "NativeInput", "Input replay done, %ld events", replayed);
+    free(path);
+    return NULL;
+}
+
+static void startInputReplay(const char* path) {
+    pthread_t thread;
+    char* pathCopy = strdup(path);
+    if (pthread_create(&thread, NULL, inputReplayThread, pathCopy) != 0) {
+        free(pathCopy);
+        return;
+    }
+    pthread_detach(thread);
+}
 
 JNIEXPORT void JNICALL Java_org_lwjgl_glfw_GLFW_nglfwSetShowingWindow(__attribute__((unused)) JNIEnv* env, __attribute__((unused)) jclass clazz, jlong window) {
     pojav_environ->showingWindow = (long) window;
@@ -475,18 +1104,10 @@ JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeSetWindowAttrib(
 
     // We cannot use pojav_environ->runtimeJNIEnvPtr_JRE here because that environment is attached
     // on the thread that loaded pojavexec (which is the thread that first references the GLFW class)
-    // But this method is only called from the Android UI thread
-    // Technically the better solution would be to have a permanently attached env pointer stored
-    // in environ for the Android UI thread but this is the only place that uses it
-    // (very rarely, only in lifecycle callbacks) so i dont care
-    JavaVM* jvm = pojav_environ->runtimeJavaVMPtr;
-    JNIEnv *jvm_env = NULL;
-    jint env_result = (*jvm)->GetEnv(jvm, (void**)&jvm_env, JNI_VERSION_1_4);
-    if(env_result == JNI_EDETACHED) {
-        env_result = (*jvm)->AttachCurrentThread(jvm, &jvm_env, NULL);
-    }
-    if(env_result != JNI_OK) {
-        printf("input_bridge nativeSetWindowAttrib() JNI call failed: %i\n", env_result);
+    // But this method is only called from the Android UI thread, which stays attached after the first call
+    JNIEnv *jvm_env = jni_env_cache_get(&pojav_environ->runtimeEnvCache);
+    if(jvm_env == NULL) {
+        printf("input_bridge nativeSetWindowAttrib() JNI call failed: can't attach to the JRE\n");
         return;
     }
     (*jvm_env)->CallStaticVoidMethod(
@@ -494,8 +1115,6 @@ JNIEXPORT void JNICALL Java_org_lwjgl_glfw_CallbackBridge_nativeSetWindowAttrib(
             pojav_environ->method_glftSetWindowAttrib,
             (jlong) pojav_environ->showingWindow, attrib, value
     );
-
-    // Attaching every time is annoying, so stick the attachment to the Android GUI thread around
 }
 const static JNINativeMethod critical_fcns[] = {
         {"nativeSetUseInputStackQueue", "(Z)V", critical_set_stackqueue},
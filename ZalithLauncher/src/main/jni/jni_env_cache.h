@@ -0,0 +1,56 @@
+//
+// Per-thread JNIEnv cache for calls that cross from one VM into the other.
+//
+// A thread that calls into a VM it doesn't belong to (the game thread calling into Dalvik, the
+// Android UI thread calling into the JRE) is attached the first time, and stays attached until it
+// exits: a pthread key destructor detaches it then. Attaching and detaching around every call costs
+// milliseconds on low-end devices.
+//
+// Header-only, as it is shared by pojavexec and pojavexec_awt.
+//
+
+#ifndef POJAVLAUNCHER_JNI_ENV_CACHE_H
+#define POJAVLAUNCHER_JNI_ENV_CACHE_H
+
+#include <jni.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+typedef struct {
+    JavaVM* vm;
+    pthread_key_t attachedKey; // Set to the cache itself on threads it attached
+} jni_env_cache_t;
+
+static inline void jni_env_cache_detach(void* value) {
+    jni_env_cache_t* cache = value;
+    (*cache->vm)->DetachCurrentThread(cache->vm);
+}
+
+/** Call once, before any jni_env_cache_get(). */
+static inline void jni_env_cache_init(jni_env_cache_t* cache, JavaVM* vm) {
+    cache->vm = vm;
+    pthread_key_create(&cache->attachedKey, jni_env_cache_detach);
+}
+
+/** @return the JNIEnv of the calling thread for the VM of the cache, attaching the thread if needed. NULL on failure. */
+static inline JNIEnv* jni_env_cache_get(jni_env_cache_t* cache) {
+    JNIEnv* env;
+    if (cache->vm == NULL) return NULL;
+    if ((*cache->vm)->GetEnv(cache->vm, (void**) &env, JNI_VERSION_1_4) == JNI_OK) return env;
+    if ((*cache->vm)->AttachCurrentThread(cache->vm, &env, NULL) != JNI_OK) return NULL;
+    pthread_setspecific(cache->attachedKey, cache);
+    return env;
+}
+
+/**
+ * Local references only go away when a native method returns to the VM, which never happens on a
+ * thread that stays attached: every call that creates some has to run in its own local frame.
+ * @return false if the frame could not be pushed, with the exception cleared. Don't pop it then.
+ */
+static inline bool jni_env_cache_push_frame(JNIEnv* env, jint capacity) {
+    if ((*env)->PushLocalFrame(env, capacity) == 0) return true;
+    (*env)->ExceptionClear(env);
+    return false;
+}
+
+#endif //POJAVLAUNCHER_JNI_ENV_CACHE_H
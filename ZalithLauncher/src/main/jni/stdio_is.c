@@ -116,6 +116,8 @@ Java_net_kdt_pojavlaunch_Logger_begin(JNIEnv *env, __attribute((unused)) jclass
 }
 
 _Noreturn void nominal_exit(int code, bool is_signal) {
+    // Games that exit without glfwTerminate() never close the input trace
+    input_trace_close(&pojav_environ->inputTrace);
     JNIEnv *env;
     jint errorCode = (*exitTrap_jvm)->GetEnv(exitTrap_jvm, (void**)&env, JNI_VERSION_1_6);
 
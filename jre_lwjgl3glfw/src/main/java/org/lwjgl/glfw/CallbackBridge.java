@@ -46,5 +46,32 @@ public class CallbackBridge {
     public static native boolean nativeSetInputReady(boolean ready);
     public static native String nativeClipboard(int action, byte[] copy);
     public static native void nativeSetGrabbing(boolean grab);
+    /** Logs the GL entry points that took the most time, when POJAV_GL_PROFILE is set. */
+    public static native void nativeLogGLProfile(int top);
+    /**
+     * Filtered calls, calls that were dropped as redundant, times a context's shadow state was reset.
+     * @return false if POJAV_GL_STATE_FILTER is not set
+     */
+    public static native boolean nativeGetGLStateFilterStats(long[] stats);
+    /**
+     * Recorded commands, synchronous waits for the GL thread, batches handed over, nanoseconds spent waiting.
+     * @return false if POJAV_GL_THREAD is not set
+     */
+    public static native boolean nativeGetGLThreadStats(long[] stats);
+    /**
+     * Queue depth, frames swapped, frames dropped without a window, nanoseconds the game waited for a free slot, longest wait.
+     * @return false if POJAV_GL_PRESENT_QUEUE is not set
+     */
+    public static native boolean nativeGetPresentStats(long[] stats);
+    /**
+     * Programs restored from binaries, programs linked from source, binaries the driver refused, binaries stored, shader compilations deferred.
+     * @return false if POJAV_GL_PROGRAM_CACHE is not set
+     */
+    public static native boolean nativeGetProgramCacheStats(long[] stats);
+    /**
+     * Texture uploads queued, bytes queued, uploads that went to the driver directly, waits for the upload threads, nanoseconds spent waiting.
+     * @return false if POJAV_GL_UPLOAD_THREADS is not set
+     */
+    public static native boolean nativeGetUploadStats(long[] stats);
 }
 
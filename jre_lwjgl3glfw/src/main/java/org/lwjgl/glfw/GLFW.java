@@ -1135,22 +1135,28 @@ public class GLFW
         }
     }
 
-    public static void glfwWaitEvents() {}
+    public static void glfwWaitEvents() {
+        // Nothing gets queued before the input is ready, and waiting while pumping would deadlock the queue
+        if (mGLFWIsInputReady && !mGLFWInputPumping) nglfwWaitEvents(-1);
+        glfwPollEvents();
+    }
 
     public static void glfwWaitEventsTimeout(double timeout) {
-        // Boardwalk: this isn't how you do a frame limiter, but oh well
-        // System.out.println("Frame limiter");
-    /*
-        try {
-            Thread.sleep((long)(timeout * 1000));
-        } catch (InterruptedException ie) {
-        }
-    */
-        // System.out.println("Out of the frame limiter");
-
+        if (mGLFWIsInputReady && !mGLFWInputPumping) nglfwWaitEvents(timeout);
+        glfwPollEvents();
     }
 
-    public static void glfwPostEmptyEvent() {}
+    /** Parks the calling thread until input arrives, glfwPostEmptyEvent() is called or the timeout (in seconds, negative for none) expires. */
+    private static native void nglfwWaitEvents(double timeout);
+
+    public static native void glfwPostEmptyEvent();
+
+    /**
+     * Late latching hook for renderers, only available when POJAV_LATE_LATCH is set.
+     * @param delta receives the cursor motion (x, y) that came in since the events of this frame were polled
+     * @return false if late latching is disabled
+     */
+    public static native boolean nglfwLateLatchCursor(double[] delta);
 
     public static int glfwGetInputMode(@NativeType("GLFWwindow *") long window, int mode) {
         return internalGetWindow(window).inputModes.get(mode);
@@ -1184,6 +1190,33 @@ public class GLFW
     public static int glfwGetMouseButton(@NativeType("GLFWwindow *") long window, int button) {
         return mouseDownBuffer.get(button);
     }
+
+    /** Index of the first changed-state word in a snapshot, KEY_STATE_KEY_WORDS + 1 in environ/key_state.h. */
+    public static final int GLFW_KEY_STATE_CHANGED_OFFSET = 6;
+    /** Index of the generation of a snapshot, KEY_STATE_GENERATION in environ/key_state.h. */
+    public static final int GLFW_KEY_STATE_GENERATION = 2 * GLFW_KEY_STATE_CHANGED_OFFSET;
+    /** Length of the array filled by {@link #glfwGetKeyStateSnapshot}, KEY_STATE_SNAPSHOT in environ/key_state.h. */
+    public static final int GLFW_KEY_STATE_SNAPSHOT_SIZE = GLFW_KEY_STATE_GENERATION + 1;
+
+    /**
+     * Reads every key and mouse button state at once, for handlers that check a lot of keybinds per tick.
+     * Words 0-4 hold the key bits, indexed like {@link #keyDownBuffer}, word 5 the mouse button bits.
+     * Words 6-11 use the same layout for what changed since the previous snapshot taken into the same array,
+     * word 12 is the generation that is tracked by. Each caller keeps its own array, a new one starts at 0.
+     * Use {@link #glfwSnapshotKey} and {@link #glfwSnapshotKeyChanged} to read it.
+     */
+    public static native void glfwGetKeyStateSnapshot(long[] state);
+
+    public static boolean glfwSnapshotKey(long[] state, int key) {
+        int index = Math.max(0, key - 31);
+        return (state[index >> 6] & (1L << index)) != 0;
+    }
+
+    public static boolean glfwSnapshotKeyChanged(long[] state, int key) {
+        int index = Math.max(0, key - 31);
+        return (state[GLFW_KEY_STATE_CHANGED_OFFSET + (index >> 6)] & (1L << index)) != 0;
+    }
+
     public static void glfwGetCursorPos(@NativeType("GLFWwindow *") long window, @Nullable @NativeType("double *") DoubleBuffer xpos, @Nullable @NativeType("double *") DoubleBuffer ypos) {
         if (CHECKS) {
             checkSafe(xpos, 1);